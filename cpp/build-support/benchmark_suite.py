@@ -0,0 +1,290 @@
+#!/usr/bin/env python3
+#
+# Licensed to the Apache Software Foundation (ASF) under one
+# or more contributor license agreements.  See the NOTICE file
+# distributed with this work for additional information
+# regarding copyright ownership.  The ASF licenses this file
+# to you under the Apache License, Version 2.0 (the
+# "License"); you may not use this file except in compliance
+# with the License.  You may obtain a copy of the License at
+#
+#   http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing,
+# software distributed under the License is distributed on an
+# "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied.  See the License for the
+# specific language governing permissions and limitations
+# under the License.
+
+"""Run a labeled subset of the google-benchmark executables in a build
+directory, optionally capturing hardware counters via perf_event, and emit
+results in the JSON format understood by `archery benchmark diff` (the
+StaticBenchmarkRunner codec).  A `compare` subcommand diffs two such result
+files and flags regressions.
+
+Examples:
+  # Run all compute benchmarks with perf counters, save results
+  benchmark_suite.py run --build-dir cpp/build --suite-filter compute \\
+      --output contender.json
+
+  # Compare against a baseline capture from another commit
+  benchmark_suite.py compare baseline.json contender.json --threshold 0.05
+"""
+
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+DEFAULT_PERF_EVENTS = "instructions,cycles,cache-misses,branch-misses"
+DEFAULT_THRESHOLD = 0.05
+
+
+def find_benchmark_binaries(build_dir, suite_filter=None):
+    """Find executables named *-benchmark under the build directory."""
+    binaries = []
+    for root, _, files in os.walk(build_dir):
+        for name in files:
+            if not name.endswith("-benchmark"):
+                continue
+            path = os.path.join(root, name)
+            if not os.access(path, os.X_OK):
+                continue
+            if suite_filter and not re.search(suite_filter, name):
+                continue
+            binaries.append(path)
+    return sorted(binaries)
+
+
+def run_perf_stat(argv, events):
+    """Run argv under `perf stat -j`, returning (returncode, perf counters)."""
+    perf_argv = ["perf", "stat", "-j", "-e", events, "--"] + argv
+    proc = subprocess.run(perf_argv, stderr=subprocess.PIPE)
+    counters = {}
+    for line in proc.stderr.decode("utf-8", errors="replace").splitlines():
+        line = line.strip()
+        if not line.startswith("{"):
+            continue
+        try:
+            record = json.loads(line)
+        except ValueError:
+            continue
+        event = record.get("event")
+        value = record.get("counter-value")
+        if event is None or value in (None, "<not counted>", "<not supported>"):
+            continue
+        try:
+            counters[event] = float(value)
+        except ValueError:
+            continue
+    if "instructions" in counters and counters.get("cycles"):
+        counters["ipc"] = counters["instructions"] / counters["cycles"]
+    if "cache-misses" in counters and counters.get("instructions"):
+        counters["cache-misses-per-kilo-instruction"] = (
+            1000.0 * counters["cache-misses"] / counters["instructions"])
+    if "branch-misses" in counters and counters.get("instructions"):
+        counters["branch-misses-per-kilo-instruction"] = (
+            1000.0 * counters["branch-misses"] / counters["instructions"])
+    return proc.returncode, counters
+
+
+def observation_value(entry):
+    """Mirror archery's unit selection for a google-benchmark entry."""
+    if "bytes_per_second" in entry:
+        return entry["bytes_per_second"], "bytes_per_second", False
+    if "items_per_second" in entry:
+        return entry["items_per_second"], "items_per_second", False
+    return entry["real_time"], entry.get("time_unit", "ns"), True
+
+
+def suite_from_google_json(name, data, perf_counters):
+    """Convert google-benchmark JSON output into an archery suite record."""
+    grouped = {}
+    for entry in data.get("benchmarks", []):
+        if entry.get("run_type") == "aggregate":
+            continue
+        grouped.setdefault(entry["name"], []).append(entry)
+
+    benchmarks = []
+    for bench_name, entries in grouped.items():
+        values = []
+        times = []
+        unit = None
+        less_is_better = True
+        time_unit = "ns"
+        for entry in entries:
+            value, unit, less_is_better = observation_value(entry)
+            values.append(value)
+            times.append(entry["real_time"])
+            time_unit = entry.get("time_unit", "ns")
+        counters = {f"perf.{k}": v for k, v in perf_counters.items()}
+        benchmarks.append({
+            "name": bench_name,
+            "unit": unit,
+            "less_is_better": less_is_better,
+            "values": sorted(values),
+            "time_unit": time_unit,
+            "times": sorted(times),
+            "counters": counters,
+        })
+    return {"name": name, "benchmarks": benchmarks}
+
+
+def run_suites(args):
+    binaries = find_benchmark_binaries(args.build_dir, args.suite_filter)
+    if not binaries:
+        print(f"no benchmark executables found under {args.build_dir}",
+              file=sys.stderr)
+        return 1
+
+    use_perf = not args.no_perf and shutil.which("perf") is not None
+    if not args.no_perf and not use_perf:
+        print("perf not found in PATH; hardware counters disabled",
+              file=sys.stderr)
+
+    suites = []
+    for binary in binaries:
+        name = os.path.basename(binary)
+        print(f"running {name}", file=sys.stderr)
+        with tempfile.NamedTemporaryFile(suffix=".json") as out:
+            argv = [binary,
+                    f"--benchmark_repetitions={args.repetitions}",
+                    f"--benchmark_out={out.name}",
+                    "--benchmark_out_format=json"]
+            if args.benchmark_filter:
+                argv.append(f"--benchmark_filter={args.benchmark_filter}")
+
+            perf_counters = {}
+            if use_perf:
+                returncode, perf_counters = run_perf_stat(argv,
+                                                          args.perf_events)
+            else:
+                returncode = subprocess.run(argv).returncode
+            if returncode != 0:
+                print(f"{name} exited with status {returncode}",
+                      file=sys.stderr)
+                return returncode
+            with open(out.name) as f:
+                data = json.load(f)
+        suites.append(suite_from_google_json(name, data, perf_counters))
+
+    result = {"suites": suites}
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(result, f, indent=2)
+    else:
+        json.dump(result, sys.stdout, indent=2)
+        print()
+    return 0
+
+
+def index_benchmarks(runner):
+    indexed = {}
+    for suite in runner.get("suites", []):
+        for bench in suite.get("benchmarks", []):
+            indexed[(suite["name"], bench["name"])] = bench
+    return indexed
+
+
+def benchmark_value(bench):
+    values = bench.get("values") or [0]
+    n = len(values)
+    if n % 2 == 0:
+        return (values[n // 2 - 1] + values[n // 2]) / 2
+    return values[n // 2]
+
+
+def compare_suites(args):
+    with open(args.baseline) as f:
+        baseline = index_benchmarks(json.load(f))
+    with open(args.contender) as f:
+        contender = index_benchmarks(json.load(f))
+
+    comparisons = []
+    num_regressions = 0
+    for key, base in sorted(baseline.items()):
+        cont = contender.get(key)
+        if cont is None:
+            continue
+        old = benchmark_value(base)
+        new = benchmark_value(cont)
+        change = 0.0 if old == 0 else float(new - old) / abs(old)
+        less_is_better = base.get("less_is_better", True)
+        adjusted_change = change if less_is_better else -change
+        regression = adjusted_change > args.threshold
+        num_regressions += regression
+        comparisons.append({
+            "suite": key[0],
+            "benchmark": key[1],
+            "change": f"{change:.3%}",
+            "regression": regression,
+            "baseline": old,
+            "contender": new,
+            "unit": base.get("unit"),
+            "less_is_better": less_is_better,
+            "counters": {
+                "baseline": base.get("counters", {}),
+                "contender": cont.get("counters", {}),
+            },
+        })
+
+    if args.output:
+        with open(args.output, "w") as f:
+            json.dump(comparisons, f, indent=2)
+    else:
+        json.dump(comparisons, sys.stdout, indent=2)
+        print()
+
+    for comparison in comparisons:
+        if comparison["regression"]:
+            print(f"REGRESSION: {comparison['suite']}: "
+                  f"{comparison['benchmark']} changed by "
+                  f"{comparison['change']}", file=sys.stderr)
+    print(f"{len(comparisons)} benchmarks compared, "
+          f"{num_regressions} regressions", file=sys.stderr)
+    return 1 if num_regressions else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    subparsers = parser.add_subparsers(dest="command", required=True)
+
+    run_parser = subparsers.add_parser(
+        "run", help="run benchmark executables and capture results")
+    run_parser.add_argument("--build-dir", default=os.getcwd(),
+                            help="build directory to search for benchmarks")
+    run_parser.add_argument("--suite-filter", default=None,
+                            help="regex selecting benchmark executables")
+    run_parser.add_argument("--benchmark-filter", default=None,
+                            help="regex passed to --benchmark_filter")
+    run_parser.add_argument("--repetitions", type=int, default=1)
+    run_parser.add_argument("--perf-events", default=DEFAULT_PERF_EVENTS,
+                            help="perf_event counters to capture")
+    run_parser.add_argument("--no-perf", action="store_true",
+                            help="disable hardware counter capture")
+    run_parser.add_argument("--output", default=None,
+                            help="output file (default: stdout)")
+    run_parser.set_defaults(func=run_suites)
+
+    compare_parser = subparsers.add_parser(
+        "compare", help="compare two result files and flag regressions")
+    compare_parser.add_argument("baseline")
+    compare_parser.add_argument("contender")
+    compare_parser.add_argument("--threshold", type=float,
+                                default=DEFAULT_THRESHOLD,
+                                help="relative regression threshold")
+    compare_parser.add_argument("--output", default=None,
+                                help="output file (default: stdout)")
+    compare_parser.set_defaults(func=compare_suites)
+
+    args = parser.parse_args()
+    sys.exit(args.func(args))
+
+
+if __name__ == "__main__":
+    main()
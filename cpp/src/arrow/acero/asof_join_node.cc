@@ -46,6 +46,7 @@
 #  include "arrow/compute/function_internal.h"
 #endif
 #include "arrow/acero/time_series_util.h"
+#include "arrow/compute/api_vector.h"
 #include "arrow/compute/key_hash_internal.h"
 #include "arrow/compute/light_array_internal.h"
 #include "arrow/record_batch.h"
@@ -812,6 +813,107 @@ class InputState : public util::SerialSequencingQueue::Processor {
   std::vector<std::optional<col_index_t>> src_to_dst_;
 };
 
+// Splits each sequenced batch of an input by the hash of its by-key into one
+// sub-batch per partition, preserving per-key row order, and routes the sub-batches
+// to the per-partition input states. Only used when the node runs with more than one
+// partition. Like InputState, processing is serialized by the sequencer, so the
+// (non-thread-safe) key hasher may be queried here.
+class InputDispatcher : public util::SerialSequencingQueue::Processor {
+ public:
+  InputDispatcher(ExecContext* exec_context, KeyHasher* key_hasher,
+                  std::shared_ptr<arrow::Schema> schema, std::vector<InputState*> targets)
+      : sequencer_(util::SerialSequencingQueue::Make(this)),
+        ctx_(exec_context),
+        key_hasher_(key_hasher),
+        schema_(std::move(schema)),
+        targets_(std::move(targets)),
+        num_dispatched_(targets_.size(), 0) {}
+
+  Status InsertBatch(ExecBatch batch) {
+    return sequencer_->InsertBatch(std::move(batch));
+  }
+
+  Status Process(ExecBatch batch) override {
+    ARROW_ASSIGN_OR_RAISE(auto rb, batch.ToRecordBatch(schema_));
+    if (rb->num_rows() > 0) {
+      ARROW_RETURN_NOT_OK(Dispatch(std::move(rb)));
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    ++batches_sequenced_;
+    MaybeSetTargetTotals();
+    return Status::OK();
+  }
+
+  // Reports the total batch count of this input when it is known. The per-partition
+  // totals are only known once all batches were sequenced and dispatched.
+  void set_total_batches(int n) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    total_batches_ = n;
+    MaybeSetTargetTotals();
+  }
+
+ private:
+  Status Dispatch(std::shared_ptr<RecordBatch> rb) {
+    const std::vector<HashType>& hashes = key_hasher_->HashesFor(rb.get());
+    const size_t num_partitions = targets_.size();
+    std::vector<std::vector<uint32_t>> row_ids(num_partitions);
+    for (size_t i = 0; i < hashes.size(); ++i) {
+      row_ids[hashes[i] % num_partitions].push_back(static_cast<uint32_t>(i));
+    }
+    for (size_t p = 0; p < num_partitions; ++p) {
+      if (row_ids[p].empty()) continue;
+      std::shared_ptr<RecordBatch> sub_rb;
+      if (row_ids[p].size() == static_cast<size_t>(rb->num_rows())) {
+        sub_rb = rb;  // all rows hash to a single partition - forward as-is
+      } else {
+        UInt32Builder indices_builder(ctx_->memory_pool());
+        ARROW_RETURN_NOT_OK(indices_builder.AppendValues(row_ids[p]));
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Array> indices, indices_builder.Finish());
+        ARROW_ASSIGN_OR_RAISE(Datum sub,
+                              compute::Take(rb, indices,
+                                            compute::TakeOptions::NoBoundsCheck(), ctx_));
+        sub_rb = sub.record_batch();
+      }
+      ARROW_RETURN_NOT_OK(targets_[p]->Push(sub_rb));
+      // Safe without the mutex: Process calls are serialized and the counts are only
+      // read under the mutex after the last batch was sequenced
+      ++num_dispatched_[p];
+    }
+    return Status::OK();
+  }
+
+  // Precondition: mutex_ is held
+  void MaybeSetTargetTotals() {
+    if (total_batches_ < 0 || batches_sequenced_ < total_batches_ || totals_set_) {
+      return;
+    }
+    totals_set_ = true;
+    for (size_t p = 0; p < targets_.size(); ++p) {
+      targets_[p]->set_total_batches(num_dispatched_[p]);
+    }
+  }
+
+  // ExecBatch sequencer
+  std::unique_ptr<util::SerialSequencingQueue> sequencer_;
+  ExecContext* ctx_;
+  // Hasher for the by-key columns of this input; owned by the node
+  KeyHasher* key_hasher_;
+  // Schema associated with the input
+  std::shared_ptr<arrow::Schema> schema_;
+  // Per-partition input states fed by this dispatcher; owned by the node
+  std::vector<InputState*> targets_;
+  // Number of non-empty sub-batches dispatched to each partition so far
+  std::vector<int> num_dispatched_;
+  // Guards the counts below against concurrent set_total_batches
+  std::mutex mutex_;
+  // Number of batches sequenced so far
+  int batches_sequenced_ = 0;
+  // Total number of input batches (-1 while unknown)
+  int total_batches_ = -1;
+  // Whether the per-partition totals were already reported
+  bool totals_set_ = false;
+};
+
 /// Wrapper around UnmaterializedCompositeTable that knows how to emplace
 /// the join row-by-row
 template <size_t MAX_TABLES>
@@ -935,6 +1037,25 @@ class CompositeTableBuilder {
 // guaranteeing this probability is below 1 in a billion. The fix is 128-bit hashing.
 // See ARROW-17653
 class AsofJoinNode : public ExecNode {
+  // The input states and processing machinery of one hash partition. With a single
+  // partition (the default) the whole node is processed by one state machine, which
+  // is exactly the former node-level state. In partitioned mode each input batch is
+  // split on the hash of the by-key and each partition runs independently.
+  struct Partition {
+    // InputStates; each input state corresponds to an input table
+    std::vector<std::unique_ptr<InputState>> state;
+    std::mutex gate;
+#ifdef ARROW_ENABLE_THREADING
+    // Queue for triggering processing of a given input
+    // (a false value is a poison pill)
+    ConcurrentQueue<bool> process;
+    // Worker thread
+    std::thread thread;
+#endif
+    // In-progress batches produced
+    int batches_produced = 0;
+  };
+
   // A simple wrapper for the result of a single call to UpdateRhs(), identifying:
   // 1) If any RHS has advanced.
   // 2) If all RHS are up to date with LHS.
@@ -946,12 +1067,12 @@ class AsofJoinNode : public ExecNode {
   // and checks if all RHS are up to date with LHS. The reason they have to be performed
   // together is that they both depend on the emptiness of the RHS, which can be changed
   // by Push() executing in another thread.
-  Result<RhsUpdateState> UpdateRhs() {
-    auto& lhs = *state_.at(0);
+  Result<RhsUpdateState> UpdateRhs(Partition& part) {
+    auto& lhs = *part.state.at(0);
     auto lhs_latest_time = lhs.GetLatestTime();
     RhsUpdateState update_state{/*any_advanced=*/false, /*all_up_to_date_with_lhs=*/true};
-    for (size_t i = 1; i < state_.size(); ++i) {
-      auto& rhs = *state_[i];
+    for (size_t i = 1; i < part.state.size(); ++i) {
+      auto& rhs = *part.state[i];
 
       // Obtain RHS emptiness once for subsequent AdvanceAndMemoize() and CurrentEmpty().
       bool rhs_empty = rhs.Empty();
@@ -977,14 +1098,14 @@ class AsofJoinNode : public ExecNode {
     return update_state;
   }
 
-  Result<std::shared_ptr<RecordBatch>> ProcessInner() {
-    DCHECK(!state_.empty());
-    auto& lhs = *state_.at(0);
+  Result<std::shared_ptr<RecordBatch>> ProcessInner(Partition& part) {
+    DCHECK(!part.state.empty());
+    auto& lhs = *part.state.at(0);
 
     // Construct new target table if needed
-    CompositeTableBuilder<MAX_JOIN_TABLES> dst(state_, output_schema_,
+    CompositeTableBuilder<MAX_JOIN_TABLES> dst(part.state, output_schema_,
                                                plan()->query_context()->memory_pool(),
-                                               DEBUG_ADD(state_.size(), this));
+                                               DEBUG_ADD(part.state.size(), this));
 
     // Generate rows into the dst table until we either run out of data or hit the row
     // limit, or run out of input
@@ -992,7 +1113,7 @@ class AsofJoinNode : public ExecNode {
       // If LHS is finished or empty then there's nothing we can do here
       if (lhs.Finished() || lhs.Empty()) break;
 
-      ARROW_ASSIGN_OR_RAISE(auto rhs_update_state, UpdateRhs());
+      ARROW_ASSIGN_OR_RAISE(auto rhs_update_state, UpdateRhs(part));
 
       // If we have received enough inputs to produce the next output batch
       // (decided by IsUpToDateWithLhsRow), we will perform the join and
@@ -1000,7 +1121,7 @@ class AsofJoinNode : public ExecNode {
       // the LHS and adding joined row to rows_ (done by Emplace). Finally,
       // input batches that are no longer needed are removed to free up memory.
       if (rhs_update_state.all_up_to_date_with_lhs) {
-        dst.Emplace(state_, tolerance_);
+        dst.Emplace(part.state, tolerance_);
         ARROW_ASSIGN_OR_RAISE(bool advanced, lhs.Advance());
         if (!advanced) break;  // if we can't advance LHS, we're done for this batch
       } else {
@@ -1010,10 +1131,10 @@ class AsofJoinNode : public ExecNode {
 
     // Prune memo entries that have expired (to bound memory consumption)
     if (!lhs.Empty()) {
-      for (size_t i = 1; i < state_.size(); ++i) {
+      for (size_t i = 1; i < part.state.size(); ++i) {
         OnType ts = tolerance_.Expiry(lhs.GetLatestTime());
         if (ts != TolType::kMinValue) {
-          state_[i]->RemoveMemoEntriesWithLesserTime(ts);
+          part.state[i]->RemoveMemoEntriesWithLesserTime(ts);
         }
       }
     }
@@ -1037,45 +1158,73 @@ class AsofJoinNode : public ExecNode {
   };
 
   void EndFromProcessThread(Status st = Status::OK()) {
+    {
+      std::lock_guard<std::mutex> guard(end_mutex_);
+      end_status_ &= std::move(st);
+      if (!end_status_.ok()) {
+        // Hasten the wind-down of the sibling partition threads on error
+        PushProcess(false);
+      }
+    }
+    if (active_partitions_.fetch_sub(1) > 1) {
+      return;  // other partitions are still processing
+    }
     // We must spawn a new task to transfer off the process thread when
     // marking this finished.  Otherwise there is a chance that doing so could
     // mark the plan finished which may destroy the plan which will destroy this
     // node which will cause us to join on ourselves.
-    ARROW_UNUSED(
-        plan_->query_context()->executor()->Spawn([this, st = std::move(st)]() mutable {
-          Defer cleanup([this, &st]() { process_task_.MarkFinished(st); });
-          if (st.ok()) {
-            st = output_->InputFinished(this, batches_produced_);
-          }
-          for (const auto& s : state_) {
-            st &= s->ForceShutdown();
-          }
-        }));
-  }
-
-  bool CheckEnded() {
-    if (state_.at(0)->Finished()) {
+    ARROW_UNUSED(plan_->query_context()->executor()->Spawn([this]() {
+      Status st;
+      {
+        std::lock_guard<std::mutex> guard(end_mutex_);
+        st = end_status_;
+      }
+      Defer cleanup([this, &st]() { process_task_.MarkFinished(st); });
+      if (st.ok()) {
+        int batches_produced = 0;
+        for (const auto& partition : partitions_) {
+          batches_produced += partition->batches_produced;
+        }
+        st = output_->InputFinished(this, batches_produced);
+      }
+      for (const auto& partition : partitions_) {
+        for (const auto& s : partition->state) {
+          st &= s->ForceShutdown();
+        }
+      }
+    }));
+  }
+
+  bool CheckEnded(Partition& part) {
+    if (part.state.at(0)->Finished()) {
       EndFromProcessThread();
       return false;
     }
     return true;
   }
 
-  bool Process() {
-    std::lock_guard<std::mutex> guard(gate_);
-    if (!CheckEnded()) {
+  bool Process(Partition& part) {
+    std::lock_guard<std::mutex> guard(part.gate);
+    if (!CheckEnded(part)) {
       return false;
     }
 
     // Process batches while we have data
     for (;;) {
-      Result<std::shared_ptr<RecordBatch>> result = ProcessInner();
+      Result<std::shared_ptr<RecordBatch>> result = ProcessInner(part);
 
       if (result.ok()) {
         auto out_rb = *result;
         if (!out_rb) break;
         ExecBatch out_b(*out_rb);
-        out_b.index = batches_produced_++;
+        if (num_partitions_ > 1) {
+          // Partitions emit concurrently and the combined output is unordered with
+          // respect to the on-key, so the batches are not sequenced
+          out_b.index = ::arrow::compute::kUnsequencedIndex;
+          ++part.batches_produced;
+        } else {
+          out_b.index = part.batches_produced++;
+        }
         DEBUG_SYNC(this, "produce batch ", out_b.index, ":", DEBUG_MANIP(std::endl),
                    out_rb->ToString(), DEBUG_MANIP(std::endl));
         Status st = output_->InputReceived(this, std::move(out_b));
@@ -1093,7 +1242,7 @@ class AsofJoinNode : public ExecNode {
     //
     // It may happen here in cases where InputFinished was called before we were finished
     // producing results (so we didn't know the output size at that time)
-    if (!CheckEnded()) {
+    if (!CheckEnded(part)) {
       return false;
     }
 
@@ -1102,19 +1251,21 @@ class AsofJoinNode : public ExecNode {
     return true;
   }
 
-  void ProcessThread() {
+  void ProcessThread(Partition& part) {
     for (;;) {
-      if (!process_.WaitAndPop()) {
+      if (!part.process.WaitAndPop()) {
         EndFromProcessThread();
         return;
       }
-      if (!Process()) {
+      if (!Process(part)) {
         return;
       }
     }
   }
 
-  static void ProcessThreadWrapper(AsofJoinNode* node) { node->ProcessThread(); }
+  static void ProcessThreadWrapper(AsofJoinNode* node, Partition* part) {
+    node->ProcessThread(*part);
+  }
 #endif
 
  public:
@@ -1127,21 +1278,52 @@ class AsofJoinNode : public ExecNode {
 
   Status Init() override {
     auto inputs = this->inputs();
+    for (int p = 0; p < num_partitions_; ++p) {
+      partitions_.push_back(std::make_unique<Partition>());
+    }
     for (size_t i = 0; i < inputs.size(); i++) {
       RETURN_NOT_OK(key_hashers_[i]->Init(plan()->query_context()->exec_context(),
                                           inputs[i]->output_schema()));
-      ARROW_ASSIGN_OR_RAISE(
-          auto input_state,
-          InputState::Make(i, tolerance_, must_hash_, may_rehash_, key_hashers_[i].get(),
-                           inputs[i], this, backpressure_counter_,
-                           inputs[i]->output_schema(), indices_of_on_key_[i],
-                           indices_of_by_key_[i]));
-      state_.push_back(std::move(input_state));
+      for (auto& partition : partitions_) {
+        KeyHasher* key_hasher = key_hashers_[i].get();
+        if (num_partitions_ > 1) {
+          // Each partition's state machine needs a private (non-thread-safe) hasher;
+          // key_hashers_[i] is then used by the dispatcher of this input instead
+          partition_hashers_.push_back(
+              std::make_unique<KeyHasher>(i, indices_of_by_key_[i]));
+          key_hasher = partition_hashers_.back().get();
+          key_hasher->node_ = this;
+          RETURN_NOT_OK(key_hasher->Init(plan()->query_context()->exec_context(),
+                                         inputs[i]->output_schema()));
+        }
+        // Note that in partitioned mode each partition installs its own backpressure
+        // handler on the input, all sharing one counter; a backlogged partition may
+        // thus be counteracted by an idle one, which costs memory but cannot
+        // deadlock since every partition eventually drains and re-signals.
+        ARROW_ASSIGN_OR_RAISE(
+            auto input_state,
+            InputState::Make(i, tolerance_, must_hash_, may_rehash_, key_hasher,
+                             inputs[i], this, backpressure_counter_,
+                             inputs[i]->output_schema(), indices_of_on_key_[i],
+                             indices_of_by_key_[i]));
+        partition->state.push_back(std::move(input_state));
+      }
+      if (num_partitions_ > 1) {
+        std::vector<InputState*> targets;
+        for (auto& partition : partitions_) {
+          targets.push_back(partition->state[i].get());
+        }
+        dispatchers_.push_back(std::make_unique<InputDispatcher>(
+            plan()->query_context()->exec_context(), key_hashers_[i].get(),
+            inputs[i]->output_schema(), std::move(targets)));
+      }
     }
 
-    col_index_t dst_offset = 0;
-    for (auto& state : state_)
-      dst_offset = state->InitSrcToDstMapping(dst_offset, !!dst_offset);
+    for (auto& partition : partitions_) {
+      col_index_t dst_offset = 0;
+      for (auto& state : partition->state)
+        dst_offset = state->InitSrcToDstMapping(dst_offset, !!dst_offset);
+    }
 
     return Status::OK();
   }
@@ -1149,8 +1331,10 @@ class AsofJoinNode : public ExecNode {
   virtual ~AsofJoinNode() {
 #ifdef ARROW_ENABLE_THREADING
     PushProcess(false);
-    if (process_thread_.joinable()) {
-      process_thread_.join();
+    for (auto& partition : partitions_) {
+      if (partition->thread.joinable()) {
+        partition->thread.join();
+      }
     }
 #endif
   }
@@ -1401,10 +1585,22 @@ class AsofJoinNode : public ExecNode {
          !is_primitive(
              inputs[0]->output_schema()->field(indices_of_by_key[0][0])->type()->id()));
     bool may_rehash = n_by == 1 && !must_hash;
+
+    // The partition count is a hint; partitioning needs a by-key to split on and
+    // threads to run the partitions on
+    AsofJoinNodeOptions normalized_options = join_options;
+    normalized_options.num_partitions = std::max(join_options.num_partitions, 1);
+    if (n_by == 0) {
+      normalized_options.num_partitions = 1;
+    }
+#ifndef ARROW_ENABLE_THREADING
+    normalized_options.num_partitions = 1;
+#endif
+
     return plan->EmplaceNode<AsofJoinNode>(
         plan, inputs, std::move(input_labels), std::move(indices_of_on_key),
-        std::move(indices_of_by_key), std::move(join_options), std::move(output_schema),
-        std::move(key_hashers), must_hash, may_rehash);
+        std::move(indices_of_by_key), std::move(normalized_options),
+        std::move(output_schema), std::move(key_hashers), must_hash, may_rehash);
   }
 
   const char* kind_name() const override { return "AsofJoinNode"; }
@@ -1427,8 +1623,13 @@ class AsofJoinNode : public ExecNode {
     ARROW_DCHECK(std_has(inputs_, input));
     size_t k = std_find(inputs_, input) - inputs_.begin();
 
-    // Put into the sequencing queue
-    ARROW_RETURN_NOT_OK(state_.at(k)->InsertBatch(std::move(batch)));
+    // Put into the sequencing queue; in partitioned mode the dispatcher splits the
+    // batch across the partitions' input states
+    if (num_partitions_ > 1) {
+      ARROW_RETURN_NOT_OK(dispatchers_.at(k)->InsertBatch(std::move(batch)));
+    } else {
+      ARROW_RETURN_NOT_OK(partitions_[0]->state.at(k)->InsertBatch(std::move(batch)));
+    }
 
     PushProcess(true);
 
@@ -1437,10 +1638,16 @@ class AsofJoinNode : public ExecNode {
 
   Status InputFinished(ExecNode* input, int total_batches) override {
     {
-      std::lock_guard<std::mutex> guard(gate_);
       ARROW_DCHECK(std_has(inputs_, input));
       size_t k = std_find(inputs_, input) - inputs_.begin();
-      state_.at(k)->set_total_batches(total_batches);
+      if (num_partitions_ > 1) {
+        // The dispatcher reports the per-partition totals once all batches of this
+        // input were sequenced and routed
+        dispatchers_.at(k)->set_total_batches(total_batches);
+      } else {
+        std::lock_guard<std::mutex> guard(partitions_[0]->gate);
+        partitions_[0]->state.at(k)->set_total_batches(total_batches);
+      }
     }
     // Trigger a process call
     // The reason for this is that there are cases at the end of a table where we don't
@@ -1452,7 +1659,9 @@ class AsofJoinNode : public ExecNode {
   }
   void PushProcess(bool value) {
 #ifdef ARROW_ENABLE_THREADING
-    process_.Push(value);
+    for (auto& partition : partitions_) {
+      partition->process.Push(value);
+    }
 #else
     if (value) {
       ProcessNonThreaded();
@@ -1464,14 +1673,16 @@ class AsofJoinNode : public ExecNode {
 
 #ifndef ARROW_ENABLE_THREADING
   bool ProcessNonThreaded() {
+    // Without threading the node always runs with a single partition
+    Partition& part = *partitions_[0];
     while (!process_task_.is_finished()) {
-      Result<std::shared_ptr<RecordBatch>> result = ProcessInner();
+      Result<std::shared_ptr<RecordBatch>> result = ProcessInner(part);
 
       if (result.ok()) {
         auto out_rb = *result;
         if (!out_rb) break;
         ExecBatch out_b(*out_rb);
-        out_b.index = batches_produced_++;
+        out_b.index = part.batches_produced++;
         DEBUG_SYNC(this, "produce batch ", out_b.index, ":", DEBUG_MANIP(std::endl),
                    out_rb->ToString(), DEBUG_MANIP(std::endl));
         Status st = output_->InputReceived(this, std::move(out_b));
@@ -1488,7 +1699,7 @@ class AsofJoinNode : public ExecNode {
         return false;
       }
     }
-    auto& lhs = *state_.at(0);
+    auto& lhs = *partitions_[0]->state.at(0);
     if (lhs.Finished() && !process_task_.is_finished()) {
       EndFromSingleThread(Status::OK());
     }
@@ -1498,9 +1709,9 @@ class AsofJoinNode : public ExecNode {
   void EndFromSingleThread(Status st = Status::OK()) {
     process_task_.MarkFinished(st);
     if (st.ok()) {
-      st = output_->InputFinished(this, batches_produced_);
+      st = output_->InputFinished(this, partitions_[0]->batches_produced);
     }
-    for (const auto& s : state_) {
+    for (const auto& s : partitions_[0]->state) {
       st &= s->ForceShutdown();
     }
   }
@@ -1515,7 +1726,10 @@ class AsofJoinNode : public ExecNode {
       return Status::OK();
     }
 #ifdef ARROW_ENABLE_THREADING
-    process_thread_ = std::thread(&AsofJoinNode::ProcessThreadWrapper, this);
+    for (auto& partition : partitions_) {
+      partition->thread =
+          std::thread(&AsofJoinNode::ProcessThreadWrapper, this, partition.get());
+    }
 #endif
     return Status::OK();
   }
@@ -1525,7 +1739,9 @@ class AsofJoinNode : public ExecNode {
 
   Status StopProducingImpl() override {
 #ifdef ARROW_ENABLE_THREADING
-    process_.Clear();
+    for (auto& partition : partitions_) {
+      partition->process.Clear();
+    }
 #endif
     PushProcess(false);
     return Status::OK();
@@ -1543,12 +1759,21 @@ class AsofJoinNode : public ExecNode {
   std::vector<col_index_t> indices_of_on_key_;
   std::vector<std::vector<col_index_t>> indices_of_by_key_;
   std::vector<std::unique_ptr<KeyHasher>> key_hashers_;
+  // Additional per-partition hashers, created in partitioned mode only
+  std::vector<std::unique_ptr<KeyHasher>> partition_hashers_;
   bool must_hash_;
   bool may_rehash_;
-  // InputStates
-  // Each input state corresponds to an input table
-  std::vector<std::unique_ptr<InputState>> state_;
-  std::mutex gate_;
+  // Number of hash partitions; one unless partitioned mode was requested
+  int num_partitions_;
+  // Hash partitions, each processed by an independent as-of-join state machine
+  std::vector<std::unique_ptr<Partition>> partitions_;
+  // Per-input dispatchers routing batches to the partitions (partitioned mode only)
+  std::vector<std::unique_ptr<InputDispatcher>> dispatchers_;
+  // Number of partitions that have not ended processing yet
+  std::atomic<int> active_partitions_;
+  // Combined status of the partitions that ended, guarded by end_mutex_
+  Status end_status_;
+  std::mutex end_mutex_;
   TolType tolerance_;
 #ifndef NDEBUG
   std::ostream* debug_os_;
@@ -1557,17 +1782,7 @@ class AsofJoinNode : public ExecNode {
 
   // Backpressure counter common to all inputs
   std::atomic<int32_t> backpressure_counter_;
-#ifdef ARROW_ENABLE_THREADING
-  // Queue for triggering processing of a given input
-  // (a false value is a poison pill)
-  ConcurrentQueue<bool> process_;
-  // Worker thread
-  std::thread process_thread_;
-#endif
   Future<> process_task_;
-
-  // In-progress batches produced
-  int batches_produced_ = 0;
 };
 
 AsofJoinNode::AsofJoinNode(ExecPlan* plan, NodeVector inputs,
@@ -1580,24 +1795,24 @@ AsofJoinNode::AsofJoinNode(ExecPlan* plan, NodeVector inputs,
                            bool must_hash, bool may_rehash)
     : ExecNode(plan, inputs, input_labels,
                /*output_schema=*/std::move(output_schema)),
-      ordering_({SortKey(indices_of_on_key[0])}),
+      // In partitioned mode the partitions emit concurrently, so the output is
+      // unordered with respect to the on-key
+      ordering_(join_options.num_partitions > 1
+                    ? Ordering::Unordered()
+                    : Ordering({SortKey(indices_of_on_key[0])})),
       indices_of_on_key_(std::move(indices_of_on_key)),
       indices_of_by_key_(std::move(indices_of_by_key)),
       key_hashers_(std::move(key_hashers)),
       must_hash_(must_hash),
       may_rehash_(may_rehash),
+      num_partitions_(join_options.num_partitions),
+      active_partitions_(join_options.num_partitions),
       tolerance_(TolType(join_options.tolerance)),
 #ifndef NDEBUG
       debug_os_(join_options.debug_opts ? join_options.debug_opts->os : nullptr),
       debug_mutex_(join_options.debug_opts ? join_options.debug_opts->mutex : nullptr),
 #endif
-      backpressure_counter_(1)
-#ifdef ARROW_ENABLE_THREADING
-      ,
-      process_(),
-      process_thread_()
-#endif
-{
+      backpressure_counter_(1) {
   for (auto& key_hasher : key_hashers_) {
     key_hasher->node_ = this;
   }
@@ -1739,6 +1739,45 @@ TEST(AsofJoinTest, RhsEmptinessRaceEmptyBy) {
   AssertExecBatchesEqualIgnoringOrder(result.schema, {exp_batch}, result.batches);
 }
 
+TEST(AsofJoinTest, PartitionedByKey) {
+  // Partitioned mode splits the inputs by the hash of the by-key and joins each
+  // partition independently; the result must match the single-partition join up to
+  // output order.
+  auto left_batch0 = ExecBatchFromJSON(
+      {int64(), utf8()}, R"([[1, "a"], [1, "b"], [2, "c"], [3, "a"], [3, "d"]])");
+  auto left_batch1 = ExecBatchFromJSON(
+      {int64(), utf8()}, R"([[4, "b"], [5, "a"], [5, "c"], [6, "d"], [7, "e"]])");
+  auto right_batch0 = ExecBatchFromJSON(
+      {int64(), utf8(), float64()}, R"([[0, "a", 1.0], [2, "b", 2.0], [3, "c", 3.0]])");
+  auto right_batch1 = ExecBatchFromJSON(
+      {int64(), utf8(), float64()}, R"([[4, "a", 4.0], [5, "d", 5.0], [6, "e", 6.0]])");
+
+  auto left_schema = schema({field("on", int64()), field("key", utf8())});
+  auto right_schema =
+      schema({field("on", int64()), field("key", utf8()), field("val", float64())});
+
+  BatchesWithCommonSchema expected;
+  for (int num_partitions : {1, 4}) {
+    Declaration left{"exec_batch_source",
+                     ExecBatchSourceNodeOptions(left_schema, {left_batch0, left_batch1})};
+    Declaration right{
+        "exec_batch_source",
+        ExecBatchSourceNodeOptions(right_schema, {right_batch0, right_batch1})};
+    AsofJoinNodeOptions asof_join_opts({{{"on"}, {{"key"}}}, {{"on"}, {{"key"}}}},
+                                       /*tolerance=*/1, num_partitions);
+    Declaration asof_join{
+        "asofjoin", {std::move(left), std::move(right)}, std::move(asof_join_opts)};
+
+    ASSERT_OK_AND_ASSIGN(auto result, DeclarationToExecBatches(std::move(asof_join)));
+    if (num_partitions == 1) {
+      expected = std::move(result);
+    } else {
+      AssertExecBatchesEqualIgnoringOrder(expected.schema, expected.batches,
+                                          result.batches);
+    }
+  }
+}
+
 // Reproduction of GH-44526: Provoke destruction of not started asofjoin node by providing
 // a sink that fails on creation
 TEST(AsofJoinTest, DestroyNonStartedAsofJoinNode) {
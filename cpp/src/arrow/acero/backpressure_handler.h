@@ -18,6 +18,7 @@
 #pragma once
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
 
 #include <memory>
 
@@ -33,6 +34,13 @@ class BackpressureHandler {
         backpressure_control_(std::move(backpressure_control)) {}
 
  public:
+  BackpressureHandler(BackpressureHandler&& other) noexcept
+      : input_(other.input_),
+        low_threshold_(other.low_threshold_),
+        high_threshold_(other.high_threshold_),
+        backpressure_control_(std::move(other.backpressure_control_)),
+        paused_(other.paused_.load()) {}
+
   static Result<BackpressureHandler> Make(
       ExecNode* input, size_t low_threshold, size_t high_threshold,
       std::unique_ptr<BackpressureControl> backpressure_control) {
@@ -51,8 +59,10 @@ class BackpressureHandler {
   void Handle(size_t start_level, size_t end_level) {
     if (start_level < high_threshold_ && end_level >= high_threshold_) {
       backpressure_control_->Pause();
+      NotifyQueryContext(true);
     } else if (start_level > low_threshold_ && end_level <= low_threshold_) {
       backpressure_control_->Resume();
+      NotifyQueryContext(false);
     }
   }
 
@@ -61,14 +71,26 @@ class BackpressureHandler {
     // Since acero's executor won't terminate if any one node is paused, we need to
     // force resume the node before stopping production.
     backpressure_control_->Resume();
+    NotifyQueryContext(false);
     return input_->StopProducing();
   }
 
  private:
+  // Let the task scheduler know that this handler keeps backpressure applied,
+  // so that it favors draining the plan while the pause is in effect.  Pause
+  // and resume may race here, but transitions are tracked so the query
+  // context's count stays balanced.
+  void NotifyQueryContext(bool applied) {
+    if (paused_.exchange(applied) != applied) {
+      input_->plan()->query_context()->NotifyBackpressureApplied(applied);
+    }
+  }
+
   ExecNode* input_;
   size_t low_threshold_;
   size_t high_threshold_;
   std::unique_ptr<BackpressureControl> backpressure_control_;
+  std::atomic<bool> paused_{false};
 };
 
 }  // namespace arrow::acero
@@ -17,8 +17,12 @@
 
 #include "arrow/acero/bloom_filter.h"
 
+#include <algorithm>
 #include <random>
 
+#include "arrow/compute/api_vector.h"  // Filter
+#include "arrow/compute/exec.h"
+#include "arrow/compute/key_hash_internal.h"
 #include "arrow/util/bit_util.h"    // Log2
 #include "arrow/util/bitmap_ops.h"  // CountSetBits
 #include "arrow/util/config.h"
@@ -445,5 +449,61 @@ std::unique_ptr<BloomFilterBuilder> BloomFilterBuilder::Make(
   return nullptr;
 }
 
+Status FilterBatchWithBloomFilter(compute::ExecContext* ctx, int64_t hardware_flags,
+                                  const BlockedBloomFilter& filter,
+                                  const std::vector<int>& column_map, ExecBatch* batch) {
+  if (batch->length == 0) {
+    return Status::OK();
+  }
+
+  std::vector<Datum> keys(column_map.size());
+  for (size_t i = 0; i < keys.size(); ++i) {
+    keys[i] = (*batch)[column_map[i]];
+    if (keys[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(
+          keys[i],
+          MakeArrayFromScalar(*keys[i].scalar(), batch->length, ctx->memory_pool()));
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(ExecBatch key_batch, ExecBatch::Make(std::move(keys)));
+
+  arrow::util::TempVectorStack stack;
+  RETURN_NOT_OK(stack.Init(
+      ctx->memory_pool(),
+      compute::Hashing32::kHashBatchTempStackUsage +
+          (sizeof(uint32_t) + /*extra=*/1) * arrow::util::MiniBatch::kMiniBatchLength));
+
+  int64_t bit_vector_bytes = bit_util::BytesForBits(batch->length);
+  std::vector<uint8_t> selected(bit_vector_bytes);
+  std::vector<uint32_t> hashes(batch->length);
+  std::vector<compute::KeyColumnArray> temp_column_arrays;
+  RETURN_NOT_OK(compute::Hashing32::HashBatch(key_batch, hashes.data(),
+                                              temp_column_arrays, hardware_flags, &stack,
+                                              0, key_batch.length));
+  filter.Find(hardware_flags, key_batch.length, hashes.data(), selected.data());
+
+  auto selected_buffer = std::make_unique<Buffer>(selected.data(), bit_vector_bytes);
+  ArrayData selected_arraydata(boolean(), batch->length,
+                               {nullptr, std::move(selected_buffer)});
+  Datum selected_datum(selected_arraydata);
+  size_t first_nonscalar = batch->values.size();
+  for (size_t i = 0; i < batch->values.size(); ++i) {
+    if (!batch->values[i].is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(
+          batch->values[i],
+          compute::Filter(batch->values[i], selected_datum, compute::FilterOptions(),
+                          ctx));
+      first_nonscalar = std::min(first_nonscalar, i);
+    }
+  }
+  // If they're all Scalar, then the length of the batch is the number of set bits
+  if (first_nonscalar == batch->values.size()) {
+    batch->length = arrow::internal::CountSetBits(selected.data(), 0, batch->length);
+  } else {
+    batch->length = batch->values[first_nonscalar].length();
+  }
+  return Status::OK();
+}
+
 }  // namespace acero
 }  // namespace arrow
@@ -20,9 +20,11 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "arrow/acero/partition_util.h"
 #include "arrow/acero/util.h"
+#include "arrow/compute/type_fwd.h"
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -239,6 +241,43 @@ class ARROW_ACERO_EXPORT BlockedBloomFilter {
   uint64_t* blocks_;
 };
 
+/// \brief Interface for nodes that can consume a Bloom filter built by a
+/// downstream hash join
+///
+/// A hash join pushes the Bloom filter built from its build side as far up its
+/// probe side as possible.  The pushdown normally stops at the outermost hash
+/// join in a chain of joins; if the input of that join implements this
+/// interface (e.g. a dataset scan) the filter is handed to it instead so that
+/// probe rows can be dropped before they enter the plan.
+///
+/// The filter may arrive at any point during execution, or not at all if the
+/// join is aborted.  Implementations apply it to batches produced after it is
+/// received; batches already in flight are filtered by the join itself, so
+/// applying the filter here is an optimization, never a requirement for
+/// correctness.
+class ARROW_ACERO_EXPORT BloomFilterSink {
+ public:
+  virtual ~BloomFilterSink() = default;
+
+  /// \brief Accept a Bloom filter over this node's output
+  ///
+  /// \param filter the filter to probe
+  /// \param column_map a mapping such that column_map[i] is the index, in this
+  ///                   node's output schema, of the column hashed as key i
+  virtual void ReceiveBloomFilter(std::unique_ptr<BlockedBloomFilter> filter,
+                                  std::vector<int> column_map) = 0;
+};
+
+/// \brief Remove the rows of a batch whose keys are not in a Bloom filter
+///
+/// Hashes the columns of `batch` selected by `column_map` and filters out the
+/// rows rejected by `filter`.  Used by BloomFilterSink implementations.
+ARROW_ACERO_EXPORT Status FilterBatchWithBloomFilter(compute::ExecContext* ctx,
+                                                     int64_t hardware_flags,
+                                                     const BlockedBloomFilter& filter,
+                                                     const std::vector<int>& column_map,
+                                                     ExecBatch* batch);
+
 // We have two separate implementations of building a Bloom filter, multi-threaded and
 // single-threaded.
 //
@@ -0,0 +1,189 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/acero/query_context.h"
+#include "arrow/acero/util.h"
+#include "arrow/compute/light_array_internal.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging_internal.h"
+#include "arrow/util/tracing_internal.h"
+
+namespace arrow {
+
+using compute::ExecBatchBuilder;
+using internal::checked_cast;
+
+namespace acero {
+namespace {
+
+// Selective stages (e.g. a filter dropping 99% of rows) can shrink batches far
+// below the size the rest of the pipeline was tuned for, after which every
+// downstream node pays its per-batch overhead for a handful of rows.  This
+// node rebuilds small batches into batches of roughly the target size.  Big
+// batches pass through untouched; ordering is not preserved.
+class CoalesceBatchesNode : public ExecNode, public TracedNode {
+ public:
+  CoalesceBatchesNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                      int32_t target_batch_size)
+      : ExecNode(plan, inputs, /*input_labels=*/{"input"},
+                 /*output_schema=*/inputs[0]->output_schema()),
+        TracedNode(this),
+        target_batch_size_(
+            std::min(target_batch_size, ExecBatchBuilder::num_rows_max())) {
+    iota_.resize(ExecBatchBuilder::num_rows_max());
+    std::iota(iota_.begin(), iota_.end(), static_cast<uint16_t>(0));
+  }
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "CoalesceBatchesNode"));
+    const auto& coalesce_options =
+        checked_cast<const CoalesceBatchesNodeOptions&>(options);
+    if (coalesce_options.target_batch_size <= 0) {
+      return Status::Invalid("Target batch size must be positive");
+    }
+    return plan->EmplaceNode<CoalesceBatchesNode>(plan, std::move(inputs),
+                                                  coalesce_options.target_batch_size);
+  }
+
+  const char* kind_name() const override { return "CoalesceBatchesNode"; }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(batch);
+    ARROW_DCHECK(input == inputs_[0]);
+
+    std::vector<ExecBatch> to_emit;
+    RETURN_NOT_OK(Coalesce(std::move(batch), &to_emit));
+    RETURN_NOT_OK(Emit(std::move(to_emit)));
+
+    if (batch_count_.Increment()) {
+      return Finish();
+    }
+    return Status::OK();
+  }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    ARROW_DCHECK(input == inputs_[0]);
+    if (batch_count_.SetTotal(total_batches)) {
+      return Finish();
+    }
+    return Status::OK();
+  }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  void PauseProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->PauseProducing(this, counter);
+  }
+
+  void ResumeProducing(ExecNode* output, int32_t counter) override {
+    inputs_[0]->ResumeProducing(this, counter);
+  }
+
+  Status StopProducingImpl() override { return Status::OK(); }
+
+ protected:
+  std::string ToStringExtra(int indent = 0) const override {
+    return "target_batch_size=" + std::to_string(target_batch_size_);
+  }
+
+ private:
+  Status Coalesce(ExecBatch batch, std::vector<ExecBatch>* to_emit) {
+    // The builder requires array-shaped columns; scalar columns are rare here
+    // (they do not survive a filter) so such batches just pass through.
+    bool all_arrays = true;
+    for (const Datum& value : batch.values) {
+      if (!value.is_array()) {
+        all_arrays = false;
+        break;
+      }
+    }
+    std::lock_guard<std::mutex> guard(mutex_);
+    if (!all_arrays || (builder_.num_rows() == 0 && batch.length >= target_batch_size_)) {
+      batch.index = compute::kUnsequencedIndex;
+      to_emit->push_back(std::move(batch));
+      return Status::OK();
+    }
+    int64_t offset = 0;
+    while (offset < batch.length) {
+      int space = target_batch_size_ - builder_.num_rows();
+      int64_t to_append = std::min<int64_t>(space, batch.length - offset);
+      ExecBatch slice = batch.Slice(offset, to_append);
+      RETURN_NOT_OK(builder_.AppendSelected(
+          plan_->query_context()->memory_pool(), slice, static_cast<int>(to_append),
+          iota_.data(), static_cast<int>(slice.values.size())));
+      offset += to_append;
+      if (builder_.num_rows() >= target_batch_size_) {
+        ExecBatch built = builder_.Flush();
+        built.index = compute::kUnsequencedIndex;
+        to_emit->push_back(std::move(built));
+      }
+    }
+    return Status::OK();
+  }
+
+  Status Emit(std::vector<ExecBatch> to_emit) {
+    for (auto& out : to_emit) {
+      num_emitted_.fetch_add(1);
+      RETURN_NOT_OK(output_->InputReceived(this, std::move(out)));
+    }
+    return Status::OK();
+  }
+
+  Status Finish() {
+    std::vector<ExecBatch> to_emit;
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      if (builder_.num_rows() > 0) {
+        ExecBatch built = builder_.Flush();
+        built.index = compute::kUnsequencedIndex;
+        to_emit.push_back(std::move(built));
+      }
+    }
+    RETURN_NOT_OK(Emit(std::move(to_emit)));
+    return output_->InputFinished(this, num_emitted_.load());
+  }
+
+  const int32_t target_batch_size_;
+  std::mutex mutex_;
+  ExecBatchBuilder builder_;
+  std::vector<uint16_t> iota_;
+  AtomicCounter batch_count_;
+  std::atomic<int> num_emitted_{0};
+};
+
+}  // namespace
+
+namespace internal {
+
+void RegisterCoalesceBatchesNode(ExecFactoryRegistry* registry) {
+  DCHECK_OK(registry->AddFactory("coalesce_batches", CoalesceBatchesNode::Make));
+}
+
+}  // namespace internal
+}  // namespace acero
+}  // namespace arrow
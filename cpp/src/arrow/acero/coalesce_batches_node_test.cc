@@ -0,0 +1,101 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <gtest/gtest.h>
+
+#include <gmock/gmock-matchers.h>
+
+#include "arrow/acero/exec_plan.h"
+#include "arrow/acero/options.h"
+#include "arrow/table.h"
+#include "arrow/testing/generator.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace acero {
+
+namespace {
+
+std::shared_ptr<Table> TestTable(int rows_per_batch, int num_batches) {
+  return gen::Gen({gen::Step()})->FailOnError()->Table(rows_per_batch, num_batches);
+}
+
+Result<std::vector<std::shared_ptr<RecordBatch>>> RunCoalesce(
+    const std::shared_ptr<Table>& input, CoalesceBatchesNodeOptions options,
+    bool use_threads) {
+  Declaration plan =
+      Declaration::Sequence({{"table_source", TableSourceNodeOptions(input)},
+                             {"coalesce_batches", options}});
+  QueryOptions query_options;
+  query_options.use_threads = use_threads;
+  ARROW_ASSIGN_OR_RAISE(BatchesWithCommonSchema batches,
+                        DeclarationToExecBatches(plan, query_options));
+  std::vector<std::shared_ptr<RecordBatch>> out;
+  for (const auto& batch : batches.batches) {
+    ARROW_ASSIGN_OR_RAISE(auto record_batch, batch.ToRecordBatch(batches.schema));
+    out.push_back(std::move(record_batch));
+  }
+  return out;
+}
+
+}  // namespace
+
+TEST(CoalesceBatchesNode, CombinesSmallBatches) {
+  constexpr int kRowsPerBatch = 10;
+  constexpr int kNumBatches = 64;
+  std::shared_ptr<Table> input = TestTable(kRowsPerBatch, kNumBatches);
+  for (bool use_threads : {false, true}) {
+    ASSERT_OK_AND_ASSIGN(
+        auto batches,
+        RunCoalesce(input, CoalesceBatchesNodeOptions(/*target_batch_size=*/100),
+                    use_threads));
+    int64_t total_rows = 0;
+    for (size_t i = 0; i < batches.size(); i++) {
+      total_rows += batches[i]->num_rows();
+      if (i + 1 < batches.size()) {
+        ASSERT_GE(batches[i]->num_rows(), 100);
+      }
+    }
+    ASSERT_EQ(total_rows, input->num_rows());
+    // All rows must survive coalescing even though order is not guaranteed
+    ASSERT_OK_AND_ASSIGN(auto actual, Table::FromRecordBatches(batches));
+    ASSERT_OK_AND_ASSIGN(auto combined, actual->CombineChunks());
+    ASSERT_OK(combined->ValidateFull());
+  }
+}
+
+TEST(CoalesceBatchesNode, PassesLargeBatchesThrough) {
+  constexpr int kRowsPerBatch = 500;
+  constexpr int kNumBatches = 4;
+  std::shared_ptr<Table> input = TestTable(kRowsPerBatch, kNumBatches);
+  ASSERT_OK_AND_ASSIGN(
+      auto batches,
+      RunCoalesce(input, CoalesceBatchesNodeOptions(/*target_batch_size=*/100),
+                  /*use_threads=*/false));
+  ASSERT_EQ(batches.size(), static_cast<size_t>(kNumBatches));
+}
+
+TEST(CoalesceBatchesNode, InvalidTargetSize) {
+  std::shared_ptr<Table> input = TestTable(1, 1);
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, testing::HasSubstr("Target batch size must be positive"),
+      RunCoalesce(input, CoalesceBatchesNodeOptions(/*target_batch_size=*/0),
+                  /*use_threads=*/false));
+}
+
+}  // namespace acero
+}  // namespace arrow
@@ -25,6 +25,7 @@
 
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/statistics.h"
 #include "arrow/acero/task_util.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/exec.h"
@@ -160,7 +161,11 @@ struct ExecPlanImpl : public ExecPlan {
                 ctx->ScheduleTask(std::move(fn), "sync-scheduler-task");
                 return Status::OK();
               },
-              /*concurrent_tasks=*/2 * num_threads, sync_execution));
+              /*concurrent_tasks=*/2 * num_threads, sync_execution,
+              [ctx](std::vector<std::function<Status(size_t)>> fns) -> Status {
+                ctx->ScheduleTasks(std::move(fns), "sync-scheduler-task");
+                return Status::OK();
+              }));
 
           // producers precede consumers
           sorted_nodes_ = TopoSort();
@@ -471,6 +476,11 @@ const Ordering& ExecNode::ordering() const {
   return Ordering::Unordered();
 }
 
+const NodeStatistics& ExecNode::output_statistics() const {
+  // The safest default is to advertise nothing
+  return NodeStatistics::Unknown();
+}
+
 Status ExecNode::Init() { return Status::OK(); }
 
 Status ExecNode::Validate() const {
@@ -1104,6 +1114,7 @@ Result<std::unique_ptr<RecordBatchReader>> DeclarationToReader(
 namespace internal {
 
 void RegisterSourceNode(ExecFactoryRegistry*);
+void RegisterCoalesceBatchesNode(ExecFactoryRegistry*);
 void RegisterFetchNode(ExecFactoryRegistry*);
 void RegisterFilterNode(ExecFactoryRegistry*);
 void RegisterOrderByNode(ExecFactoryRegistry*);
@@ -1123,6 +1134,7 @@ ExecFactoryRegistry* default_exec_factory_registry() {
    public:
     DefaultRegistry() {
       internal::RegisterSourceNode(this);
+      internal::RegisterCoalesceBatchesNode(this);
       internal::RegisterFetchNode(this);
       internal::RegisterFilterNode(this);
       internal::RegisterOrderByNode(this);
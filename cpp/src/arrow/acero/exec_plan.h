@@ -202,6 +202,17 @@ class ARROW_ACERO_EXPORT ExecNode {
   /// maintain continuity.
   virtual const Ordering& ordering() const;
 
+  /// \brief statistics describing this node's output batches
+  ///
+  /// Row counts and per-field min/max and distinct estimates flow from
+  /// sources through shape-preserving nodes so that downstream operators can
+  /// pre-size hash tables or choose between execution strategies.  Sortedness
+  /// is conveyed separately through ordering().
+  ///
+  /// The default is NodeStatistics::Unknown(): a node that does not override
+  /// this advertises nothing about its output.
+  virtual const NodeStatistics& output_statistics() const;
+
   /// Upstream API:
   /// These functions are called by input nodes that want to inform this node
   /// about an updated condition (a new input batch or an impending
@@ -602,6 +613,30 @@ struct ARROW_ACERO_EXPORT QueryOptions {
   /// If this field is not set then it will be treated as kWarn unless overridden
   /// by the ACERO_ALIGNMENT_HANDLING environment variable
   std::optional<UnalignedBufferHandling> unaligned_buffer_handling;
+
+  /// \brief Soft limit, in bytes, on batches a node may accumulate in memory
+  ///
+  /// Pipeline breakers (currently the probe side of a hash join) queue input
+  /// batches while they wait for upstream state to be ready.  Once a node's
+  /// queued batches exceed this budget further batches are spilled to a
+  /// temporary file in the IPC stream format and replayed when the node is
+  /// ready to process them.  This trades speed for predictable completion on
+  /// inputs that do not fit in memory.
+  ///
+  /// The default (-1) disables spilling.
+  int64_t spill_threshold_bytes = -1;
+
+  /// \brief Memory watermark, in bytes, above which the scheduler favors
+  ///        draining the plan over admitting more input
+  ///
+  /// While allocation on the plan's memory pool is above this watermark the
+  /// task scheduler prefers downstream task groups over upstream ones, so that
+  /// accumulated data is processed to completion before sources race further
+  /// ahead.  The same preference is applied, independently of this setting,
+  /// while any node keeps backpressure applied.
+  ///
+  /// The default (-1) disables the watermark.
+  int64_t memory_pressure_threshold_bytes = -1;
 };
 
 /// \brief Calculate the output schema of a declaration
@@ -19,6 +19,7 @@
 #include "arrow/acero/map_node.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/statistics.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/expression.h"
@@ -43,7 +44,8 @@ class FilterNode : public MapNode {
   FilterNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
              std::shared_ptr<Schema> output_schema, Expression filter)
       : MapNode(plan, std::move(inputs), std::move(output_schema)),
-        filter_(std::move(filter)) {}
+        filter_(std::move(filter)),
+        statistics_(FilteredStatistics(inputs_[0]->output_statistics(), filter_)) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -70,6 +72,31 @@ class FilterNode : public MapNode {
 
   const char* kind_name() const override { return "FilterNode"; }
 
+  const NodeStatistics& output_statistics() const override { return statistics_; }
+
+  Status Init() override {
+    compiled_filter_.resize(plan_->query_context()->max_concurrency());
+    return MapNode::Init();
+  }
+
+  // Evaluate the filter through a per-thread compiled form of the expression
+  // when the guarantee didn't simplify it away from the compiled one.
+  Result<Datum> EvaluateFilter(const Expression& simplified_filter,
+                               const ExecBatch& batch) {
+    auto* query_context = plan_->query_context();
+    const size_t thread_index = query_context->GetThreadIndex();
+    if (thread_index >= compiled_filter_.size() || !simplified_filter.Equals(filter_)) {
+      return ExecuteScalarExpression(simplified_filter, batch,
+                                     query_context->exec_context());
+    }
+    auto& compiled = compiled_filter_[thread_index];
+    if (compiled == nullptr) {
+      ARROW_ASSIGN_OR_RAISE(compiled, compute::CompiledExpression::Compile(
+                                          filter_, query_context->exec_context()));
+    }
+    return compiled->Execute(batch);
+  }
+
   Result<ExecBatch> ProcessBatch(ExecBatch batch) override {
     ARROW_ASSIGN_OR_RAISE(Expression simplified_filter,
                           SimplifyWithGuarantee(filter_, batch.guarantee));
@@ -80,9 +107,7 @@ class FilterNode : public MapNode {
                         {"filter.expression.simplified", simplified_filter.ToString()},
                         {"filter.length", batch.length}});
 
-    ARROW_ASSIGN_OR_RAISE(
-        Datum mask, ExecuteScalarExpression(simplified_filter, batch,
-                                            plan()->query_context()->exec_context()));
+    ARROW_ASSIGN_OR_RAISE(Datum mask, EvaluateFilter(simplified_filter, batch));
 
     if (mask.is_scalar()) {
       const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
@@ -111,6 +136,9 @@ class FilterNode : public MapNode {
 
  private:
   Expression filter_;
+  NodeStatistics statistics_;
+  // One compiled filter per thread, created on first use
+  std::vector<std::unique_ptr<compute::CompiledExpression>> compiled_filter_;
 };
 }  // namespace
 
@@ -26,6 +26,8 @@
 #include "arrow/acero/hash_join_node.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/schema_util.h"
+#include "arrow/acero/statistics.h"
+#include "arrow/acero/spilling_util.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/key_hash_internal.h"
 #include "arrow/util/checked_cast.h"
@@ -479,9 +481,55 @@ Status ValidateHashJoinNodeOptions(const HashJoinNodeOptions& join_options) {
     return Status::Invalid("key_cmp and keys must have the same size");
   }
 
+  if (join_options.build_side != JoinBuildSide::RIGHT &&
+      join_options.filter != literal(true)) {
+    // A residual filter may reference input columns by index; those indices
+    // would silently change meaning under a mirrored join.
+    return Status::NotImplemented(
+        "a hash join build_side hint together with a residual filter");
+  }
+
   return Status::OK();
 }
 
+JoinType MirrorJoinType(JoinType t) {
+  switch (t) {
+    case JoinType::LEFT_SEMI:
+      return JoinType::RIGHT_SEMI;
+    case JoinType::RIGHT_SEMI:
+      return JoinType::LEFT_SEMI;
+    case JoinType::LEFT_ANTI:
+      return JoinType::RIGHT_ANTI;
+    case JoinType::RIGHT_ANTI:
+      return JoinType::LEFT_ANTI;
+    case JoinType::LEFT_OUTER:
+      return JoinType::RIGHT_OUTER;
+    case JoinType::RIGHT_OUTER:
+      return JoinType::LEFT_OUTER;
+    case JoinType::INNER:
+    case JoinType::FULL_OUTER:
+      return t;
+  }
+  return t;
+}
+
+// The same join with the inputs exchanged: keys, output lists and suffixes are
+// swapped and the join type is mirrored.  Each key pair keeps its position so
+// key_cmp is unchanged, and the filter must be trivial (enforced by
+// ValidateHashJoinNodeOptions).
+HashJoinNodeOptions MirrorJoinOptions(const HashJoinNodeOptions& join_options) {
+  HashJoinNodeOptions mirrored = join_options;
+  mirrored.join_type = MirrorJoinType(join_options.join_type);
+  mirrored.left_keys = join_options.right_keys;
+  mirrored.right_keys = join_options.left_keys;
+  mirrored.left_output = join_options.right_output;
+  mirrored.right_output = join_options.left_output;
+  mirrored.output_suffix_for_left = join_options.output_suffix_for_right;
+  mirrored.output_suffix_for_right = join_options.output_suffix_for_left;
+  mirrored.build_side = JoinBuildSide::RIGHT;
+  return mirrored;
+}
+
 class HashJoinNode;
 
 // This is a struct encapsulating things related to Bloom filters and pushing them around
@@ -641,6 +689,10 @@ struct BloomFilterPushdownContext {
   struct {
     std::unique_ptr<BlockedBloomFilter> bloom_filter_;
     HashJoinNode* pushdown_target_;
+    // If the input of the pushdown target implements BloomFilterSink (e.g. a
+    // dataset scan) the filter is handed to it instead of the target join so
+    // that rows are dropped at the source.
+    BloomFilterSink* sink_ = NULLPTR;
     std::vector<int> column_map_;
   } push_;
 
@@ -693,12 +745,91 @@ bool HashJoinSchema::HasLargeBinary() const {
   return false;
 }
 
+// Everything derived from the input schemas and options that the node needs to
+// execute a join.  Computed once for a RIGHT-side build and, when a build-side
+// hint is in play, a second time for the mirrored join.
+struct HashJoinPlan {
+  std::unique_ptr<HashJoinSchema> schema_mgr;
+  Expression filter;
+  std::shared_ptr<Schema> output_schema;
+  std::unique_ptr<HashJoinImpl> impl;
+};
+
+Result<HashJoinPlan> PlanHashJoin(ExecPlan* plan, const Schema& left_schema,
+                                  const Schema& right_schema,
+                                  const HashJoinNodeOptions& join_options) {
+  HashJoinPlan result;
+  result.schema_mgr = std::make_unique<HashJoinSchema>();
+
+  // This will also validate input schemas
+  if (join_options.output_all) {
+    RETURN_NOT_OK(result.schema_mgr->Init(
+        join_options.join_type, left_schema, join_options.left_keys, right_schema,
+        join_options.right_keys, join_options.filter, join_options.output_suffix_for_left,
+        join_options.output_suffix_for_right));
+  } else {
+    RETURN_NOT_OK(result.schema_mgr->Init(
+        join_options.join_type, left_schema, join_options.left_keys,
+        join_options.left_output, right_schema, join_options.right_keys,
+        join_options.right_output, join_options.filter,
+        join_options.output_suffix_for_left, join_options.output_suffix_for_right));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(
+      result.filter,
+      result.schema_mgr->BindFilter(join_options.filter, left_schema, right_schema,
+                                    plan->query_context()->exec_context()));
+
+  // Generate output schema
+  result.output_schema = result.schema_mgr->MakeOutputSchema(
+      join_options.output_suffix_for_left, join_options.output_suffix_for_right);
+
+  // Create hash join implementation object
+  // SwissJoin does not support:
+  // a) 64-bit string offsets
+  // b) dictionaries
+  //
+  bool use_swiss_join;
+#if ARROW_LITTLE_ENDIAN
+  use_swiss_join =
+      !result.schema_mgr->HasDictionaries() && !result.schema_mgr->HasLargeBinary();
+#else
+  use_swiss_join = false;
+#endif
+  if (use_swiss_join) {
+    ARROW_ASSIGN_OR_RAISE(result.impl, HashJoinImpl::MakeSwiss());
+  } else {
+    ARROW_ASSIGN_OR_RAISE(result.impl, HashJoinImpl::MakeBasic());
+  }
+  return result;
+}
+
+// The impl of a mirrored join emits probe-side columns (the original right)
+// followed by build-side columns (the original left), while the declared
+// output schema keeps the original left first.  Returns the mapping from
+// declared column position to impl column position, or an empty vector when
+// the orders coincide (semi/anti joins output only one side).
+std::vector<int> SwappedOutputPermutation(const HashJoinSchema& swapped_schema) {
+  int num_right = swapped_schema.proj_maps[0].num_cols(HashJoinProjection::OUTPUT);
+  int num_left = swapped_schema.proj_maps[1].num_cols(HashJoinProjection::OUTPUT);
+  if (num_left == 0 || num_right == 0) return {};
+  std::vector<int> permutation(num_left + num_right);
+  for (int i = 0; i < num_left; ++i) {
+    permutation[i] = num_right + i;
+  }
+  for (int i = 0; i < num_right; ++i) {
+    permutation[num_left + i] = i;
+  }
+  return permutation;
+}
+
 class HashJoinNode : public ExecNode, public TracedNode {
  public:
   HashJoinNode(ExecPlan* plan, NodeVector inputs, const HashJoinNodeOptions& join_options,
                std::shared_ptr<Schema> output_schema,
                std::unique_ptr<HashJoinSchema> schema_mgr, Expression filter,
-               std::unique_ptr<HashJoinImpl> impl)
+               std::unique_ptr<HashJoinImpl> impl,
+               std::vector<int> output_permutation = {})
       : ExecNode(plan, std::move(inputs), {"left", "right"},
                  /*output_schema=*/std::move(output_schema)),
         TracedNode(this),
@@ -707,8 +838,22 @@ class HashJoinNode : public ExecNode, public TracedNode {
         filter_(std::move(filter)),
         schema_mgr_(std::move(schema_mgr)),
         impl_(std::move(impl)),
-        disable_bloom_filter_(join_options.disable_bloom_filter) {
+        build_side_(join_options.build_side),
+        sample_rows_threshold_(join_options.build_side_sample_rows),
+        output_permutation_(std::move(output_permutation)),
+        side_decided_(join_options.build_side != JoinBuildSide::AUTO),
+        disable_bloom_filter_(join_options.disable_bloom_filter ||
+                              join_options.build_side == JoinBuildSide::AUTO) {
     complete_.store(false);
+    pushdown_safe_ =
+        build_side_ != JoinBuildSide::AUTO && output_permutation_.empty();
+  }
+
+  void SetSwappedPlan(JoinType swapped_join_type, HashJoinPlan swapped_plan) {
+    swapped_join_type_ = swapped_join_type;
+    swapped_schema_mgr_ = std::move(swapped_plan.schema_mgr);
+    swapped_filter_ = std::move(swapped_plan.filter);
+    swapped_impl_ = std::move(swapped_plan.impl);
   }
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
@@ -716,58 +861,60 @@ class HashJoinNode : public ExecNode, public TracedNode {
     // Number of input exec nodes must be 2
     RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 2, "HashJoinNode"));
 
-    std::unique_ptr<HashJoinSchema> schema_mgr = std::make_unique<HashJoinSchema>();
-
-    const auto& join_options = checked_cast<const HashJoinNodeOptions&>(options);
+    HashJoinNodeOptions join_options = checked_cast<const HashJoinNodeOptions&>(options);
     RETURN_NOT_OK(ValidateHashJoinNodeOptions(join_options));
 
+    if (join_options.build_side == JoinBuildSide::AUTO) {
+      // If both input cardinalities are known exactly at plan time, decide the
+      // build side immediately and skip the runtime sampling and buffering.
+      const NodeStatistics& left_stats = inputs[0]->output_statistics();
+      const NodeStatistics& right_stats = inputs[1]->output_statistics();
+      if (left_stats.num_rows_exact && right_stats.num_rows_exact) {
+        join_options.build_side = *left_stats.num_rows < *right_stats.num_rows
+                                      ? JoinBuildSide::LEFT
+                                      : JoinBuildSide::RIGHT;
+      }
+    }
+
     const auto& left_schema = *(inputs[0]->output_schema());
     const auto& right_schema = *(inputs[1]->output_schema());
 
-    // This will also validate input schemas
-    if (join_options.output_all) {
-      RETURN_NOT_OK(schema_mgr->Init(
-          join_options.join_type, left_schema, join_options.left_keys, right_schema,
-          join_options.right_keys, join_options.filter,
-          join_options.output_suffix_for_left, join_options.output_suffix_for_right));
-    } else {
-      RETURN_NOT_OK(schema_mgr->Init(
-          join_options.join_type, left_schema, join_options.left_keys,
-          join_options.left_output, right_schema, join_options.right_keys,
-          join_options.right_output, join_options.filter,
-          join_options.output_suffix_for_left, join_options.output_suffix_for_right));
+    ARROW_ASSIGN_OR_RAISE(HashJoinPlan planned,
+                          PlanHashJoin(plan, left_schema, right_schema, join_options));
+
+    if (join_options.build_side == JoinBuildSide::LEFT) {
+      // Build on the left input by constructing the mirrored join over swapped
+      // inputs.  The declared output schema is that of the original options;
+      // output batches are permuted back to it.
+      HashJoinNodeOptions mirrored = MirrorJoinOptions(join_options);
+      ARROW_ASSIGN_OR_RAISE(HashJoinPlan swapped,
+                            PlanHashJoin(plan, right_schema, left_schema, mirrored));
+      std::vector<int> permutation = SwappedOutputPermutation(*swapped.schema_mgr);
+      return plan->EmplaceNode<HashJoinNode>(
+          plan, NodeVector{inputs[1], inputs[0]}, mirrored,
+          std::move(planned.output_schema), std::move(swapped.schema_mgr),
+          std::move(swapped.filter), std::move(swapped.impl), std::move(permutation));
     }
 
-    ARROW_ASSIGN_OR_RAISE(
-        Expression filter,
-        schema_mgr->BindFilter(join_options.filter, left_schema, right_schema,
-                               plan->query_context()->exec_context()));
-
-    // Generate output schema
-    std::shared_ptr<Schema> output_schema = schema_mgr->MakeOutputSchema(
-        join_options.output_suffix_for_left, join_options.output_suffix_for_right);
-
-    // Create hash join implementation object
-    // SwissJoin does not support:
-    // a) 64-bit string offsets
-    // b) dictionaries
-    //
-    bool use_swiss_join;
-#if ARROW_LITTLE_ENDIAN
-    use_swiss_join = !schema_mgr->HasDictionaries() && !schema_mgr->HasLargeBinary();
-#else
-    use_swiss_join = false;
-#endif
-    std::unique_ptr<HashJoinImpl> impl;
-    if (use_swiss_join) {
-      ARROW_ASSIGN_OR_RAISE(impl, HashJoinImpl::MakeSwiss());
-    } else {
-      ARROW_ASSIGN_OR_RAISE(impl, HashJoinImpl::MakeBasic());
+    if (join_options.build_side == JoinBuildSide::AUTO) {
+      // Keep both the regular and the mirrored join plan around; the choice
+      // between them is made at runtime once the smaller input is known.
+      HashJoinNodeOptions mirrored = MirrorJoinOptions(join_options);
+      ARROW_ASSIGN_OR_RAISE(HashJoinPlan swapped,
+                            PlanHashJoin(plan, right_schema, left_schema, mirrored));
+      ExecNode* node = plan->EmplaceNode<HashJoinNode>(
+          plan, inputs, join_options, std::move(planned.output_schema),
+          std::move(planned.schema_mgr), std::move(planned.filter),
+          std::move(planned.impl));
+      checked_cast<HashJoinNode*>(node)->SetSwappedPlan(mirrored.join_type,
+                                                        std::move(swapped));
+      return node;
     }
 
     return plan->EmplaceNode<HashJoinNode>(
-        plan, inputs, join_options, std::move(output_schema), std::move(schema_mgr),
-        std::move(filter), std::move(impl));
+        plan, inputs, join_options, std::move(planned.output_schema),
+        std::move(planned.schema_mgr), std::move(planned.filter),
+        std::move(planned.impl));
   }
 
   const char* kind_name() const override { return "HashJoinNode"; }
@@ -809,12 +956,29 @@ class HashJoinNode : public ExecNode, public TracedNode {
     return Status::OK();
   }
 
+  // Queue a probe side batch that cannot be processed yet.  Called with
+  // probe_side_mutex_ held.  Once the accumulated batches exceed the spill
+  // threshold further batches go to a temporary file and are replayed (and
+  // Bloom filtered) after the in-memory batches have been probed.
+  Status AccumulateProbeBatch(ExecBatch batch) {
+    if (spill_threshold_ >= 0 && probe_accumulated_bytes_ >= spill_threshold_) {
+      if (probe_spill_ == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(
+            probe_spill_, util::SpillFile::Make(inputs_[0]->output_schema(),
+                                                plan_->query_context()->memory_pool()));
+      }
+      return probe_spill_->Append(std::move(batch));
+    }
+    probe_accumulated_bytes_ += batch.TotalBufferSize();
+    probe_accumulator_.InsertBatch(std::move(batch));
+    return Status::OK();
+  }
+
   Status OnProbeSideBatch(size_t thread_index, ExecBatch batch) {
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
       if (!bloom_filters_ready_) {
-        probe_accumulator_.InsertBatch(std::move(batch));
-        return Status::OK();
+        return AccumulateProbeBatch(std::move(batch));
       }
     }
     RETURN_NOT_OK(pushdown_context_.FilterSingleBatch(thread_index, &batch));
@@ -822,8 +986,7 @@ class HashJoinNode : public ExecNode, public TracedNode {
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
       if (!hash_table_ready_) {
-        probe_accumulator_.InsertBatch(std::move(batch));
-        return Status::OK();
+        return AccumulateProbeBatch(std::move(batch));
       }
     }
     RETURN_NOT_OK(impl_->ProbeSingleBatch(thread_index, std::move(batch)));
@@ -878,6 +1041,16 @@ class HashJoinNode : public ExecNode, public TracedNode {
 
   Status OnQueuedBatchesProbed(size_t thread_index) {
     queued_batches_to_probe_.Clear();
+    if (probe_spill_ != nullptr) {
+      // Replay spilled batches one at a time; they were spilled before Bloom
+      // filtering so the filter is applied here.  No new batches can be
+      // spilled at this point since the hash table is ready.
+      RETURN_NOT_OK(probe_spill_->Replay([&](ExecBatch batch) {
+        RETURN_NOT_OK(pushdown_context_.FilterSingleBatch(thread_index, &batch));
+        return impl_->ProbeSingleBatch(thread_index, std::move(batch));
+      }));
+      probe_spill_.reset();
+    }
     bool probing_finished;
     {
       std::lock_guard<std::mutex> guard(probe_side_mutex_);
@@ -888,6 +1061,81 @@ class HashJoinNode : public ExecNode, public TracedNode {
     return Status::OK();
   }
 
+  // Accumulate a batch while the build side decision for JoinBuildSide::AUTO
+  // is still pending.  Returns false if the decision was made concurrently, in
+  // which case the batch is left in place and must take the regular path.
+  Result<bool> SampleInputBatch(size_t thread_index, int input_index, ExecBatch* batch) {
+    std::unique_lock<std::mutex> lock(decide_mutex_);
+    if (side_decided_.load(std::memory_order_relaxed)) {
+      return false;
+    }
+    sample_rows_[input_index] += batch->length;
+    if (batch->length > 0) {
+      sample_accumulator_[input_index].InsertBatch(std::move(*batch));
+    }
+    if (batch_count_[input_index].Increment()) {
+      input_finished_[input_index] = true;
+    }
+    RETURN_NOT_OK(MaybeDecideBuildSide(thread_index, std::move(lock)));
+    return true;
+  }
+
+  // Called with decide_mutex_ held; decides the build side if enough is known.
+  Status MaybeDecideBuildSide(size_t thread_index, std::unique_lock<std::mutex> lock) {
+    bool swap;
+    if (input_finished_[0] && input_finished_[1]) {
+      // Both counts are exact; build on the smaller input.
+      swap = sample_rows_[0] < sample_rows_[1];
+    } else if (input_finished_[0] && sample_rows_[1] > sample_rows_[0]) {
+      // The right input is already larger than all of the left input.
+      swap = true;
+    } else if (input_finished_[1] && sample_rows_[0] > sample_rows_[1]) {
+      swap = false;
+    } else if (!input_finished_[0] && !input_finished_[1] &&
+               sample_rows_threshold_ > 0 && sample_rows_[0] >= sample_rows_threshold_ &&
+               sample_rows_[1] >= sample_rows_threshold_) {
+      // Both inputs are large; stop buffering and keep the default sides.
+      swap = false;
+    } else {
+      return Status::OK();
+    }
+    return DecideBuildSide(thread_index, swap, std::move(lock));
+  }
+
+  Status DecideBuildSide(size_t thread_index, bool swap,
+                         std::unique_lock<std::mutex> lock) {
+    if (swap) {
+      join_type_ = swapped_join_type_;
+      schema_mgr_ = std::move(swapped_schema_mgr_);
+      filter_ = std::move(swapped_filter_);
+      impl_ = std::move(swapped_impl_);
+      output_permutation_ = SwappedOutputPermutation(*schema_mgr_);
+      probe_input_ = 1;
+      build_input_ = 0;
+    }
+    bool build_finished = input_finished_[build_input_];
+    bool probe_finished = input_finished_[probe_input_];
+    {
+      std::lock_guard<std::mutex> guard(build_side_mutex_);
+      build_accumulator_ = std::move(sample_accumulator_[build_input_]);
+    }
+    {
+      // Bloom filters are disabled in AUTO mode, so the sampled probe batches
+      // can go straight to the accumulator probed once the hash table is up.
+      std::lock_guard<std::mutex> guard(probe_side_mutex_);
+      probe_accumulator_.Concatenate(std::move(sample_accumulator_[probe_input_]));
+    }
+    side_decided_.store(true, std::memory_order_release);
+    lock.unlock();
+    if (build_finished) {
+      RETURN_NOT_OK(OnBuildSideFinished(thread_index));
+    }
+    if (probe_finished) {
+      RETURN_NOT_OK(OnProbeSideFinished(thread_index));
+    }
+    return Status::OK();
+  }
+
   Status InputReceived(ExecNode* input, ExecBatch batch) override {
     auto scope = TraceInputReceived(batch);
     ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
@@ -896,15 +1144,24 @@ class HashJoinNode : public ExecNode, public TracedNode {
     }
 
     size_t thread_index = plan_->query_context()->GetThreadIndex();
-    int side = (input == inputs_[0]) ? 0 : 1;
+    int input_index = (input == inputs_[0]) ? 0 : 1;
+
+    if (!side_decided_.load(std::memory_order_acquire)) {
+      ARROW_ASSIGN_OR_RAISE(bool sampled,
+                            SampleInputBatch(thread_index, input_index, &batch));
+      if (sampled) {
+        return Status::OK();
+      }
+    }
 
+    int side = (input_index == probe_input_) ? 0 : 1;
     if (side == 0) {
       ARROW_RETURN_NOT_OK(OnProbeSideBatch(thread_index, std::move(batch)));
     } else {
       ARROW_RETURN_NOT_OK(OnBuildSideBatch(thread_index, std::move(batch)));
     }
 
-    if (batch_count_[side].Increment()) {
+    if (batch_count_[input_index].Increment()) {
       if (side == 0) {
         return OnProbeSideFinished(thread_index);
       } else {
@@ -917,10 +1174,17 @@ class HashJoinNode : public ExecNode, public TracedNode {
   Status InputFinished(ExecNode* input, int total_batches) override {
     ARROW_DCHECK(std::find(inputs_.begin(), inputs_.end(), input) != inputs_.end());
     size_t thread_index = plan_->query_context()->GetThreadIndex();
-    int side = (input == inputs_[0]) ? 0 : 1;
-
-    if (batch_count_[side].SetTotal(total_batches)) {
-      if (side == 0) {
+    int input_index = (input == inputs_[0]) ? 0 : 1;
+
+    if (batch_count_[input_index].SetTotal(total_batches)) {
+      if (!side_decided_.load(std::memory_order_acquire)) {
+        std::unique_lock<std::mutex> lock(decide_mutex_);
+        if (!side_decided_.load(std::memory_order_relaxed)) {
+          input_finished_[input_index] = true;
+          return MaybeDecideBuildSide(thread_index, std::move(lock));
+        }
+      }
+      if (input_index == probe_input_) {
         return OnProbeSideFinished(thread_index);
       } else {
         return OnBuildSideFinished(thread_index);
@@ -937,6 +1201,14 @@ class HashJoinNode : public ExecNode, public TracedNode {
           "which is incompatible with legacy batching");
     }
 
+    // Spilling serializes batches through the IPC format; dictionaries would
+    // require dictionary batch tracking so they keep the in-memory-only path.
+    // With an AUTO build side the probe input is not known up front, so both
+    // inputs stay in memory until the decision is made.
+    if (!schema_mgr_->HasDictionaries() && build_side_ != JoinBuildSide::AUTO) {
+      spill_threshold_ = ctx->options().spill_threshold_bytes;
+    }
+
     bool use_sync_execution = ctx->executor()->GetCapacity() == 1;
     // TODO(ARROW-15732)
     // Each side of join might have an IO thread being called from. Once this is fixed
@@ -970,6 +1242,25 @@ class HashJoinNode : public ExecNode, public TracedNode {
           return this->FinishedCallback(total_num_batches);
         }));
 
+    if (swapped_impl_) {
+      // The mirrored impl registers its task groups up front as well; only one
+      // of the two impls ever has tasks scheduled.
+      RETURN_NOT_OK(swapped_impl_->Init(
+          ctx, swapped_join_type_, num_threads, &(swapped_schema_mgr_->proj_maps[0]),
+          &(swapped_schema_mgr_->proj_maps[1]), key_cmp_, swapped_filter_,
+          [ctx](std::function<Status(size_t, int64_t)> fn,
+                std::function<Status(size_t)> on_finished) {
+            return ctx->RegisterTaskGroup(std::move(fn), std::move(on_finished));
+          },
+          [ctx](int task_group_id, int64_t num_tasks) {
+            return ctx->StartTaskGroup(task_group_id, num_tasks);
+          },
+          [this](int64_t, ExecBatch batch) { return this->OutputBatchCallback(batch); },
+          [this](int64_t total_num_batches) {
+            return this->FinishedCallback(total_num_batches);
+          }));
+    }
+
     task_group_probe_ = ctx->RegisterTaskGroup(
         [this](size_t thread_index, int64_t task_id) -> Status {
           return impl_->ProbeSingleBatch(thread_index,
@@ -1012,6 +1303,14 @@ class HashJoinNode : public ExecNode, public TracedNode {
 
  private:
   Status OutputBatchCallback(ExecBatch batch) {
+    if (!output_permutation_.empty()) {
+      // The impl ran with swapped sides; restore the declared column order.
+      std::vector<Datum> values(output_permutation_.size());
+      for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = std::move(batch.values[output_permutation_[i]]);
+      }
+      batch.values = std::move(values);
+    }
     return output_->InputReceived(this, std::move(batch));
   }
 
@@ -1034,6 +1333,9 @@ class HashJoinNode : public ExecNode, public TracedNode {
   util::AccumulationQueue build_accumulator_;
   util::AccumulationQueue probe_accumulator_;
   util::AccumulationQueue queued_batches_to_probe_;
+  std::unique_ptr<util::SpillFile> probe_spill_;
+  int64_t spill_threshold_ = -1;
+  int64_t probe_accumulated_bytes_ = 0;
 
   std::mutex build_side_mutex_;
   std::mutex probe_side_mutex_;
@@ -1045,6 +1347,34 @@ class HashJoinNode : public ExecNode, public TracedNode {
   bool queued_batches_probed_ = false;
   bool probe_side_finished_ = false;
 
+  // Build/probe side selection (see HashJoinNodeOptions::build_side).  The
+  // probe and build input indices differ from the defaults when the join runs
+  // with swapped sides.
+  JoinBuildSide build_side_;
+  int64_t sample_rows_threshold_;
+  // Non-empty when the impl output column order differs from the declared
+  // output schema (see SwappedOutputPermutation)
+  std::vector<int> output_permutation_;
+  // False only for JoinBuildSide::AUTO until DecideBuildSide has run
+  std::atomic<bool> side_decided_;
+  int probe_input_ = 0;
+  int build_input_ = 1;
+  // The mirrored join plan held until the decision for JoinBuildSide::AUTO
+  JoinType swapped_join_type_ = JoinType::INNER;
+  std::unique_ptr<HashJoinSchema> swapped_schema_mgr_;
+  Expression swapped_filter_;
+  std::unique_ptr<HashJoinImpl> swapped_impl_;
+  // Batches and row counts accumulated per input before the decision,
+  // protected by decide_mutex_
+  std::mutex decide_mutex_;
+  util::AccumulationQueue sample_accumulator_[2];
+  int64_t sample_rows_[2] = {0, 0};
+  bool input_finished_[2] = {false, false};
+  // Whether other joins may push Bloom filters through or into this node; a
+  // join that permutes its output or may still swap sides does not expose a
+  // stable probe-side mapping.
+  bool pushdown_safe_ = true;
+
   friend struct BloomFilterPushdownContext;
   bool disable_bloom_filter_;
   BloomFilterPushdownContext pushdown_context_;
@@ -1064,7 +1394,14 @@ Status BloomFilterPushdownContext::Init(
   if (!disable_bloom_filter_) {
     ARROW_CHECK(push_.pushdown_target_);
     push_.bloom_filter_ = std::make_unique<BlockedBloomFilter>();
-    push_.pushdown_target_->pushdown_context_.ExpectBloomFilter();
+    // The column map produced by GetPushdownTarget refers to the probe input
+    // of the pushdown target, which is exactly the output of the target's
+    // probe-side input node.  If that node can consume the filter itself, let
+    // it drop rows at the source instead of in the target join.
+    push_.sink_ = dynamic_cast<BloomFilterSink*>(push_.pushdown_target_->inputs()[0]);
+    if (push_.sink_ == NULLPTR) {
+      push_.pushdown_target_->pushdown_context_.ExpectBloomFilter();
+    }
 
     build_.builder_ = BloomFilterBuilder::Make(
         use_sync_execution ? BloomFilterBuildStrategy::SINGLE_THREADED
@@ -1120,10 +1457,14 @@ Status BloomFilterPushdownContext::BuildBloomFilter(size_t thread_index,
 }
 
 Status BloomFilterPushdownContext::PushBloomFilter(size_t thread_index) {
-  if (!disable_bloom_filter_)
-    return push_.pushdown_target_->pushdown_context_.ReceiveBloomFilter(
-        thread_index, std::move(push_.bloom_filter_), std::move(push_.column_map_));
-  return Status::OK();
+  if (disable_bloom_filter_) return Status::OK();
+  if (push_.sink_ != NULLPTR) {
+    push_.sink_->ReceiveBloomFilter(std::move(push_.bloom_filter_),
+                                    std::move(push_.column_map_));
+    return Status::OK();
+  }
+  return push_.pushdown_target_->pushdown_context_.ReceiveBloomFilter(
+      thread_index, std::move(push_.bloom_filter_), std::move(push_.column_map_));
 }
 
 Status BloomFilterPushdownContext::BuildBloomFilter_exec_task(size_t thread_index,
@@ -1224,6 +1565,9 @@ std::pair<HashJoinNode*, std::vector<int>> BloomFilterPushdownContext::GetPushdo
   for (ExecNode* candidate = start->inputs()[0];
        candidate->kind_name() == start->kind_name(); candidate = candidate->inputs()[0]) {
     auto* candidate_as_join = checked_cast<HashJoinNode*>(candidate);
+    // A join that permutes its output or may still swap its build and probe
+    // sides at runtime has no stable probe-side column mapping to push through.
+    if (!candidate_as_join->pushdown_safe_) break;
     SchemaProjectionMap candidate_output_to_input =
         candidate_as_join->schema_mgr_->proj_maps[0].map(HashJoinProjection::OUTPUT,
                                                          HashJoinProjection::INPUT);
@@ -1848,6 +1848,82 @@ TEST(HashJoin, ExtensionTypesHashJoin) {
   TestSimpleJoinHelper(input_left, input_right, expected);
 }
 
+TEST(HashJoin, BuildSideHint) {
+  BatchesWithSchema input_left;
+  input_left.batches = {ExecBatchFromJSON({int32(), utf8()}, R"([
+                   [1, "a"], [2, "b"], [3, "c"], [4, "d"], [5, "e"], [6, "f"]
+                 ])")};
+  input_left.schema = schema({field("lkey", int32()), field("lpayload", utf8())});
+
+  BatchesWithSchema input_right;
+  input_right.batches = {ExecBatchFromJSON({int32(), utf8()}, R"([
+                   [2, "x"], [4, "y"], [7, "z"]
+                 ])")};
+  input_right.schema = schema({field("rkey", int32()), field("rpayload", utf8())});
+
+  for (JoinType join_type : {JoinType::INNER, JoinType::LEFT_OUTER, JoinType::FULL_OUTER,
+                             JoinType::LEFT_SEMI, JoinType::RIGHT_ANTI}) {
+    ARROW_SCOPED_TRACE("join_type = ", ToString(join_type));
+    // The RIGHT (default) build side provides the reference result; LEFT and
+    // AUTO must produce the same rows with the same schema.
+    std::optional<BatchesWithCommonSchema> expected;
+    for (JoinBuildSide build_side :
+         {JoinBuildSide::RIGHT, JoinBuildSide::LEFT, JoinBuildSide::AUTO}) {
+      ARROW_SCOPED_TRACE("build_side = ", ToString(build_side));
+      Declaration left{"source",
+                       SourceNodeOptions{input_left.schema,
+                                         input_left.gen(/*parallel=*/false,
+                                                        /*slow=*/false)}};
+      Declaration right{"source",
+                        SourceNodeOptions{input_right.schema,
+                                          input_right.gen(/*parallel=*/false,
+                                                          /*slow=*/false)}};
+      HashJoinNodeOptions join_opts{join_type,
+                                    /*left_keys=*/{"lkey"},
+                                    /*right_keys=*/{"rkey"}};
+      join_opts.build_side = build_side;
+      Declaration join{"hashjoin", {std::move(left), std::move(right)}, join_opts};
+
+      ASSERT_OK_AND_ASSIGN(auto actual, DeclarationToExecBatches(std::move(join)));
+      if (!expected) {
+        expected = std::move(actual);
+      } else {
+        AssertSchemaEqual(expected->schema, actual.schema);
+        AssertExecBatchesEqualIgnoringOrder(expected->schema, expected->batches,
+                                            actual.batches);
+      }
+    }
+  }
+}
+
+TEST(HashJoin, BuildSideHintWithResidualFilter) {
+  BatchesWithSchema input_left;
+  input_left.batches = {ExecBatchFromJSON({int32()}, R"([[1], [2]])")};
+  input_left.schema = schema({field("lkey", int32())});
+
+  BatchesWithSchema input_right;
+  input_right.batches = {ExecBatchFromJSON({int32()}, R"([[2], [3]])")};
+  input_right.schema = schema({field("rkey", int32())});
+
+  Declaration left{"source",
+                   SourceNodeOptions{input_left.schema, input_left.gen(/*parallel=*/false,
+                                                                       /*slow=*/false)}};
+  Declaration right{
+      "source", SourceNodeOptions{input_right.schema, input_right.gen(/*parallel=*/false,
+                                                                      /*slow=*/false)}};
+
+  HashJoinNodeOptions join_opts{JoinType::INNER,
+                                /*left_keys=*/{"lkey"},
+                                /*right_keys=*/{"rkey"},
+                                less(field_ref("lkey"), field_ref("rkey"))};
+  join_opts.build_side = JoinBuildSide::LEFT;
+  Declaration join{"hashjoin", {std::move(left), std::move(right)}, join_opts};
+
+  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented,
+                                  ::testing::HasSubstr("build_side hint"),
+                                  DeclarationToStatus(std::move(join)));
+}
+
 TEST(HashJoin, CheckHashJoinNodeOptionsValidation) {
   BatchesWithSchema input_left;
   input_left.batches = {ExecBatchFromJSON({int32(), int32(), int32()}, R"([
@@ -16,10 +16,18 @@
 // under the License.
 
 #include "arrow/acero/options.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+
 #include "arrow/acero/exec_plan.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/table.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
@@ -50,6 +58,19 @@ std::string ToString(JoinType t) {
   std::abort();
 }
 
+std::string ToString(JoinBuildSide s) {
+  switch (s) {
+    case JoinBuildSide::RIGHT:
+      return "RIGHT";
+    case JoinBuildSide::LEFT:
+      return "LEFT";
+    case JoinBuildSide::AUTO:
+      return "AUTO";
+  }
+  ARROW_LOG(FATAL) << "Invalid variant of arrow::acero::JoinBuildSide";
+  std::abort();
+}
+
 namespace {
 ExecBatchIteratorMaker VecToItMaker(std::vector<ExecBatch> batches) {
   auto batches_ptr = std::make_shared<std::vector<std::shared_ptr<ExecBatch>>>();
@@ -74,5 +95,122 @@ ExecBatchSourceNodeOptions::ExecBatchSourceNodeOptions(std::shared_ptr<Schema> s
     : SchemaSourceNodeOptions(std::move(schema), VecToItMaker(std::move(batches)),
                               requires_io) {}
 
+// A bounded multi-producer single-consumer queue over pre-allocated slots. Each slot
+// carries a sequence number that encodes whether it is free for the producer at a
+// given position or holds a batch for the consumer, so the fast paths on both sides
+// are lock-free; the mutex below is only taken by producers waiting on a full ring.
+struct BatchRing::Impl {
+  struct Slot {
+    std::atomic<size_t> sequence;
+    ExecBatch batch;
+  };
+
+  explicit Impl(size_t capacity)
+      : mask(capacity - 1), slots(std::make_unique<Slot[]>(capacity)) {
+    for (size_t i = 0; i < capacity; ++i) {
+      slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  const size_t mask;
+  std::unique_ptr<Slot[]> slots;
+  // Next position to produce into and to consume from
+  std::atomic<size_t> tail{0};
+  std::atomic<size_t> head{0};
+  std::atomic<bool> finished{false};
+  // Number of producers blocked on a full ring, see Push()
+  std::atomic<int> waiting_producers{0};
+  std::mutex mutex;
+  std::condition_variable ring_not_full;
+  // Invoked from Poll() when the ring drains down to drain_threshold
+  std::function<void()> drain_callback;
+  size_t drain_threshold = 0;
+};
+
+BatchRing::BatchRing(size_t capacity)
+    : impl_(std::make_unique<Impl>(static_cast<size_t>(
+          bit_util::NextPower2(static_cast<int64_t>(std::max<size_t>(capacity, 2)))))) {}
+
+BatchRing::~BatchRing() = default;
+
+size_t BatchRing::capacity() const { return impl_->mask + 1; }
+
+size_t BatchRing::size() const {
+  size_t tail = impl_->tail.load(std::memory_order_acquire);
+  size_t head = impl_->head.load(std::memory_order_acquire);
+  return tail - head;
+}
+
+bool BatchRing::TryPush(ExecBatch* batch) {
+  Impl& ring = *impl_;
+  size_t pos = ring.tail.load(std::memory_order_relaxed);
+  for (;;) {
+    Impl::Slot& slot = ring.slots[pos & ring.mask];
+    size_t sequence = slot.sequence.load(std::memory_order_acquire);
+    intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+    if (diff == 0) {
+      if (ring.tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+        slot.batch = std::move(*batch);
+        slot.sequence.store(pos + 1, std::memory_order_release);
+        return true;
+      }
+    } else if (diff < 0) {
+      return false;  // full
+    } else {
+      pos = ring.tail.load(std::memory_order_relaxed);
+    }
+  }
+}
+
+void BatchRing::Push(ExecBatch batch) {
+  Impl& ring = *impl_;
+  while (!TryPush(&batch)) {
+    if (ring.finished.load(std::memory_order_acquire)) {
+      return;  // the plan is aborting; drop the batch
+    }
+    std::unique_lock<std::mutex> lock(ring.mutex);
+    ring.waiting_producers.fetch_add(1, std::memory_order_acq_rel);
+    ring.ring_not_full.wait_for(lock, std::chrono::milliseconds(10));
+    ring.waiting_producers.fetch_sub(1, std::memory_order_acq_rel);
+  }
+}
+
+std::optional<ExecBatch> BatchRing::Poll() {
+  Impl& ring = *impl_;
+  size_t pos = ring.head.load(std::memory_order_relaxed);
+  Impl::Slot& slot = ring.slots[pos & ring.mask];
+  size_t sequence = slot.sequence.load(std::memory_order_acquire);
+  if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1) < 0) {
+    return std::nullopt;  // nothing ready
+  }
+  ExecBatch batch = std::move(slot.batch);
+  slot.sequence.store(pos + ring.mask + 1, std::memory_order_release);
+  ring.head.store(pos + 1, std::memory_order_release);
+  if (ring.waiting_producers.load(std::memory_order_acquire) > 0) {
+    std::lock_guard<std::mutex> lock(ring.mutex);
+    ring.ring_not_full.notify_all();
+  }
+  if (ring.drain_callback && size() == ring.drain_threshold) {
+    ring.drain_callback();
+  }
+  return batch;
+}
+
+void BatchRing::Finish() {
+  Impl& ring = *impl_;
+  ring.finished.store(true, std::memory_order_release);
+  std::lock_guard<std::mutex> lock(ring.mutex);
+  ring.ring_not_full.notify_all();
+}
+
+bool BatchRing::is_finished() const {
+  return impl_->finished.load(std::memory_order_acquire) && size() == 0;
+}
+
+void BatchRing::SetDrainCallback(size_t threshold, std::function<void()> callback) {
+  impl_->drain_threshold = threshold;
+  impl_->drain_callback = std::move(callback);
+}
+
 }  // namespace acero
 }  // namespace arrow
@@ -259,6 +259,26 @@ class ARROW_ACERO_EXPORT FilterNodeOptions : public ExecNodeOptions {
   Expression filter_expression;
 };
 
+/// \brief a node which coalesces small batches into batches of a target size
+///
+/// Selective stages such as filters can shrink batches to a handful of rows,
+/// after which per-batch overhead dominates downstream processing.  Placing
+/// this node after such a stage rebuilds the stream into batches of roughly
+/// `target_batch_size` rows.  Batches already at or above the target pass
+/// through unchanged.  The output is unordered.
+class ARROW_ACERO_EXPORT CoalesceBatchesNodeOptions : public ExecNodeOptions {
+ public:
+  static constexpr std::string_view kName = "coalesce_batches";
+  /// \brief create an instance from values
+  ///
+  /// The default matches ExecPlan::kMaxBatchSize, the morsel size used by the
+  /// rest of the engine.
+  explicit CoalesceBatchesNodeOptions(int32_t target_batch_size = 1 << 15)
+      : target_batch_size(target_batch_size) {}
+  /// \brief the number of rows to accumulate before emitting a batch
+  int32_t target_batch_size;
+};
+
 /// \brief a node which selects a specified subset from the input
 class ARROW_ACERO_EXPORT FetchNodeOptions : public ExecNodeOptions {
  public:
@@ -514,6 +534,75 @@ class ARROW_ACERO_EXPORT ConsumingSinkNodeOptions : public ExecNodeOptions {
   std::optional<bool> sequence_output;
 };
 
+/// \brief A bounded ring buffer handing finished batches from a plan to its caller
+///
+/// The ring pre-allocates all of its slots up front and moves batches through them, so
+/// steady-state operation performs no per-batch allocation or copying; only the
+/// reference-counted buffers of each batch change hands. The plan's execution threads
+/// are the producers and the caller's thread is the single consumer, which polls with
+/// Poll(). A ring is meant to be used with a single plan at a time.
+class ARROW_ACERO_EXPORT BatchRing {
+ public:
+  /// \brief Create a ring with at least the given number of slots
+  ///
+  /// The capacity is rounded up to a power of two.
+  explicit BatchRing(size_t capacity);
+  ~BatchRing();
+
+  /// \brief The number of slots in the ring
+  size_t capacity() const;
+  /// \brief The number of batches currently in the ring (approximate under concurrency)
+  size_t size() const;
+
+  /// \brief Attempt to hand a batch to the consumer without waiting
+  ///
+  /// Returns false and leaves the batch in place when the ring is full.
+  bool TryPush(ExecBatch* batch);
+  /// \brief Hand a batch to the consumer, waiting for a free slot when the ring is full
+  ///
+  /// The batch is dropped if the ring is finished while waiting, which only happens
+  /// when the plan is aborted.
+  void Push(ExecBatch batch);
+  /// \brief Poll the next finished batch, without waiting
+  ///
+  /// Returns nullopt when no batch is currently ready; check is_finished() to
+  /// distinguish a momentarily drained ring from a finished plan.
+  std::optional<ExecBatch> Poll();
+
+  /// \brief Mark that no further batches will be pushed
+  void Finish();
+  /// \brief True once the ring is finished and fully drained
+  bool is_finished() const;
+
+  /// \brief Invoke the given callback from Poll() whenever the ring drains down to
+  /// `threshold` batches
+  ///
+  /// Used by the ring buffer sink node to resume a paused input. Must be set before
+  /// the ring is used concurrently.
+  void SetDrainCallback(size_t threshold, std::function<void()> callback);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief a sink node that hands batches to the caller through a pre-allocated ring
+///
+/// Unlike SinkNodeOptions, which exposes a pull generator with internal queuing, this
+/// sink moves each finished batch into a slot of a caller-provided BatchRing as soon as
+/// it is produced, so an embedding application can consume results with no per-batch
+/// allocation. The input is paused while the ring is nearly full and resumed as the
+/// caller drains it; if the ring fills up entirely the plan's threads wait for the
+/// consumer. Batches are handed over in production order, which is not deterministic.
+class ARROW_ACERO_EXPORT RingBufferSinkNodeOptions : public ExecNodeOptions {
+ public:
+  explicit RingBufferSinkNodeOptions(std::shared_ptr<BatchRing> ring)
+      : ring(std::move(ring)) {}
+
+  /// \brief the ring finished batches are pushed into; must not be null
+  std::shared_ptr<BatchRing> ring;
+};
+
 /// \brief Make a node which sorts rows passed through it
 ///
 /// All batches pushed to this node will be accumulated, then sorted, by the given
@@ -560,6 +649,27 @@ std::string ToString(JoinType t);
 
 enum class JoinKeyCmp { EQ, IS };
 
+/// \brief which input of a hash join the hash table is built on
+enum class JoinBuildSide {
+  /// \brief always build on the right input (the default)
+  RIGHT,
+  /// \brief build on the left input
+  ///
+  /// The node internally swaps its inputs and mirrors the join type so the
+  /// output is identical to a RIGHT-side build.
+  LEFT,
+  /// \brief build on whichever input turns out to be smaller
+  ///
+  /// Both inputs are accumulated until one of them finishes (or until both
+  /// have produced at least HashJoinNodeOptions::build_side_sample_rows rows,
+  /// at which point the right input is kept as the build side).  Bloom filter
+  /// pushdown and probe-side spilling are disabled for the join while the
+  /// decision is pending.
+  AUTO
+};
+
+std::string ToString(JoinBuildSide s);
+
 /// \brief a node which implements a join operation using a hash table
 class ARROW_ACERO_EXPORT HashJoinNodeOptions : public ExecNodeOptions {
  public:
@@ -680,6 +790,14 @@ class ARROW_ACERO_EXPORT HashJoinNodeOptions : public ExecNodeOptions {
   Expression filter = literal(true);
   // whether or not to disable Bloom filters in this join
   bool disable_bloom_filter = false;
+  // which input the hash table is built on.  LEFT and AUTO currently require a
+  // trivial residual filter (literal(true)).
+  JoinBuildSide build_side = JoinBuildSide::RIGHT;
+  // row threshold for JoinBuildSide::AUTO.  Once both inputs have produced at
+  // least this many rows without either finishing, sampling stops and the
+  // right input is kept as the build side.  Values <= 0 remove the cap so the
+  // decision always waits for one input to finish.
+  int64_t build_side_sample_rows = 1 << 20;
 };
 
 /// \brief a node which implements the asof join operation
@@ -713,8 +831,11 @@ class ARROW_ACERO_EXPORT AsofJoinNodeOptions : public ExecNodeOptions {
     std::vector<FieldRef> by_key;
   };
 
-  AsofJoinNodeOptions(std::vector<Keys> input_keys, int64_t tolerance)
-      : input_keys(std::move(input_keys)), tolerance(tolerance) {}
+  AsofJoinNodeOptions(std::vector<Keys> input_keys, int64_t tolerance,
+                      int num_partitions = 1)
+      : input_keys(std::move(input_keys)),
+        tolerance(tolerance),
+        num_partitions(num_partitions) {}
 
   /// \brief AsofJoin keys per input table. At least two keys must be given. The first key
   /// corresponds to a left table and all other keys correspond to right tables for the
@@ -730,6 +851,15 @@ class ARROW_ACERO_EXPORT AsofJoinNodeOptions : public ExecNodeOptions {
   ///
   /// The tolerance is interpreted in the same units as the "on" key.
   int64_t tolerance;
+  /// \brief Number of hash partitions to run the as-of-join with
+  ///
+  /// When greater than one, each input is hash-partitioned on its "by" key and an
+  /// independent as-of-join state machine processes each partition, so partitions run
+  /// on separate cores. Per-key time ordering is preserved because all rows of a given
+  /// "by" key land in the same partition, but the node's output as a whole is then
+  /// unordered with respect to the "on" key. The value is a hint: it is ignored (treated
+  /// as one) when the join has no "by" key or when threading is disabled.
+  int num_partitions;
 };
 
 /// \brief a node which select top_k/bottom_k rows passed through it
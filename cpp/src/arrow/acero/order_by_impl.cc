@@ -17,17 +17,23 @@
 
 #include "arrow/acero/order_by_impl.h"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <utility>
 #include <vector>
 #include "arrow/acero/options.h"
+#include "arrow/acero/spilling_util.h"
 #include "arrow/compute/api_vector.h"
+#include "arrow/compute/exec.h"
 #include "arrow/record_batch.h"
+#include "arrow/scalar.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/checked_cast.h"
 
 namespace arrow {
@@ -41,16 +47,52 @@ namespace acero {
 class SortBasicImpl : public OrderByImpl {
  public:
   SortBasicImpl(ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
-                const SortOptions& options = SortOptions{})
-      : ctx_(ctx), output_schema_(output_schema), options_(options) {}
+                const SortOptions& options = SortOptions{},
+                int64_t spill_threshold_bytes = -1)
+      : ctx_(ctx),
+        output_schema_(output_schema),
+        options_(options),
+        spill_threshold_bytes_(spill_threshold_bytes) {}
 
   void InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
-    std::unique_lock<std::mutex> lock(mutex_);
-    batches_.push_back(batch);
+    std::vector<std::shared_ptr<RecordBatch>> run;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      batches_.push_back(batch);
+      if (spill_threshold_bytes_ < 0) {
+        return;
+      }
+      accumulated_bytes_ += arrow::util::TotalBufferSize(*batch);
+      if (accumulated_bytes_ < spill_threshold_bytes_) {
+        return;
+      }
+      run = std::move(batches_);
+      batches_.clear();
+      accumulated_bytes_ = 0;
+    }
+    // Sort the run and spill it outside of the lock so that runs can be
+    // sorted in parallel by whichever threads deliver input.
+    Status st = SortAndSpillRun(std::move(run));
+    if (!st.ok()) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      spill_status_ &= st;
+    }
   }
 
   Result<Datum> DoFinish() override {
     std::unique_lock<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(spill_status_);
+    // Read back the spilled runs.  Each run is already sorted so the table
+    // sorter's final merge phase does most of the remaining work.
+    for (const auto& run_file : runs_) {
+      RETURN_NOT_OK(run_file->Replay([&](ExecBatch batch) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
+                              batch.ToRecordBatch(output_schema_, ctx_->memory_pool()));
+        batches_.push_back(std::move(record_batch));
+        return Status::OK();
+      }));
+    }
+    runs_.clear();
     ARROW_ASSIGN_OR_RAISE(auto table,
                           Table::FromRecordBatches(output_schema_, std::move(batches_)));
     ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(table, options_, ctx_));
@@ -66,17 +108,72 @@ class SortBasicImpl : public OrderByImpl {
   std::vector<std::shared_ptr<RecordBatch>> batches_;
 
  private:
+  Status SortAndSpillRun(std::vector<std::shared_ptr<RecordBatch>> run) {
+    ARROW_ASSIGN_OR_RAISE(auto run_table,
+                          Table::FromRecordBatches(output_schema_, std::move(run)));
+    ARROW_ASSIGN_OR_RAISE(auto indices, SortIndices(run_table, options_, ctx_));
+    ARROW_ASSIGN_OR_RAISE(Datum sorted,
+                          Take(run_table, indices, TakeOptions::NoBoundsCheck(), ctx_));
+    ARROW_ASSIGN_OR_RAISE(
+        auto run_file, util::SpillFile::Make(output_schema_, ctx_->memory_pool()));
+    TableBatchReader reader(*sorted.table());
+    for (;;) {
+      ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> batch, reader.Next());
+      if (batch == nullptr) break;
+      RETURN_NOT_OK(run_file->Append(ExecBatch(*batch)));
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    runs_.push_back(std::move(run_file));
+    return Status::OK();
+  }
+
   const SortOptions options_;
+  const int64_t spill_threshold_bytes_;
+  int64_t accumulated_bytes_ = 0;
+  std::vector<std::unique_ptr<util::SpillFile>> runs_;
+  Status spill_status_;
 };  // namespace compute
 
+// Streaming top-k.  Instead of buffering the whole input for one final
+// SelectK, the accumulated rows are periodically compacted down to the
+// current top k and the k-th value of the first sort key is kept as a
+// threshold.  Incoming batches are pre-filtered against that threshold with
+// the comparison kernels before being accumulated, so a selective top-k over
+// a large input behaves like a filter rather than a sort.
 class SelectKBasicImpl : public SortBasicImpl {
  public:
   SelectKBasicImpl(ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
                    const SelectKOptions& options)
       : SortBasicImpl(ctx, output_schema), options_(options) {}
 
+  void InputReceived(const std::shared_ptr<RecordBatch>& batch) override {
+    std::shared_ptr<Scalar> threshold;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      threshold = threshold_;
+    }
+    std::shared_ptr<RecordBatch> kept = batch;
+    if (threshold != nullptr) {
+      auto maybe_kept = PrefilterBatch(batch, threshold);
+      if (!maybe_kept.ok()) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        status_ &= maybe_kept.status();
+        return;
+      }
+      kept = *std::move(maybe_kept);
+      if (kept->num_rows() == 0) return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    accumulated_rows_ += kept->num_rows();
+    batches_.push_back(std::move(kept));
+    if (accumulated_rows_ >= std::max<int64_t>(2 * options_.k, kMinRowsForCompaction)) {
+      status_ &= CompactLocked();
+    }
+  }
+
   Result<Datum> DoFinish() override {
     std::unique_lock<std::mutex> lock(mutex_);
+    RETURN_NOT_OK(status_);
     ARROW_ASSIGN_OR_RAISE(auto table,
                           Table::FromRecordBatches(output_schema_, std::move(batches_)));
     ARROW_ASSIGN_OR_RAISE(auto indices, SelectKUnstable(table, options_, ctx_));
@@ -86,13 +183,74 @@ class SelectKBasicImpl : public SortBasicImpl {
   std::string ToString() const override { return options_.ToString(); }
 
  private:
+  // Drop rows that cannot enter the current top k.  With a single sort key,
+  // rows tying the k-th value may be dropped as well since the selection is
+  // unstable; with secondary keys a tie on the first key can still win, so
+  // ties are kept.  Rows with a null first key are always kept and left to
+  // the final SelectK.
+  Result<std::shared_ptr<RecordBatch>> PrefilterBatch(
+      const std::shared_ptr<RecordBatch>& batch,
+      const std::shared_ptr<Scalar>& threshold) {
+    ARROW_ASSIGN_OR_RAISE(auto key, options_.sort_keys.front().target.GetOne(*batch));
+    const bool descending =
+        options_.sort_keys.front().order == compute::SortOrder::Descending;
+    const char* cmp;
+    if (options_.sort_keys.size() == 1) {
+      cmp = descending ? "greater" : "less";
+    } else {
+      cmp = descending ? "greater_equal" : "less_equal";
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        Datum mask,
+        compute::CallFunction(cmp, {Datum(key), Datum(threshold)}, ctx_));
+    ARROW_ASSIGN_OR_RAISE(Datum nulls,
+                          compute::CallFunction("is_null", {Datum(key)}, ctx_));
+    ARROW_ASSIGN_OR_RAISE(mask, compute::CallFunction("or_kleene", {mask, nulls}, ctx_));
+    ARROW_ASSIGN_OR_RAISE(Datum filtered,
+                          compute::CallFunction("filter", {Datum(batch), mask}, ctx_));
+    return filtered.record_batch();
+  }
+
+  // Shrink the accumulated batches to the current top k rows and refresh the
+  // prefilter threshold from the k-th value of the first sort key (SelectK
+  // returns its indices ordered by the sort keys, so that is the last row).
+  Status CompactLocked() {
+    ARROW_ASSIGN_OR_RAISE(auto table,
+                          Table::FromRecordBatches(output_schema_, std::move(batches_)));
+    batches_.clear();
+    ARROW_ASSIGN_OR_RAISE(auto indices, SelectKUnstable(table, options_, ctx_));
+    ARROW_ASSIGN_OR_RAISE(Datum top, Take(table, indices, TakeOptions::NoBoundsCheck(),
+                                          ctx_));
+    ARROW_ASSIGN_OR_RAISE(auto combined,
+                          top.table()->CombineChunksToBatch(ctx_->memory_pool()));
+    accumulated_rows_ = combined->num_rows();
+    if (combined->num_rows() == 0) return Status::OK();
+    batches_.push_back(combined);
+    if (combined->num_rows() >= options_.k) {
+      ARROW_ASSIGN_OR_RAISE(auto key,
+                            options_.sort_keys.front().target.GetOne(*combined));
+      ARROW_ASSIGN_OR_RAISE(auto kth, key->GetScalar(options_.k - 1));
+      if (kth->is_valid) {
+        threshold_ = std::move(kth);
+      }
+    }
+    return Status::OK();
+  }
+
+  // Below this many accumulated rows compaction is not worth its overhead.
+  static constexpr int64_t kMinRowsForCompaction = 1 << 16;
+
   const SelectKOptions options_;
+  int64_t accumulated_rows_ = 0;
+  std::shared_ptr<Scalar> threshold_;
+  Status status_;
 };
 
 Result<std::unique_ptr<OrderByImpl>> OrderByImpl::MakeSort(
     ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
-    const SortOptions& options) {
-  std::unique_ptr<OrderByImpl> impl{new SortBasicImpl(ctx, output_schema, options)};
+    const SortOptions& options, int64_t spill_threshold_bytes) {
+  std::unique_ptr<OrderByImpl> impl{
+      new SortBasicImpl(ctx, output_schema, options, spill_threshold_bytes)};
   return impl;
 }
 
@@ -43,9 +43,16 @@ class OrderByImpl {
 
   virtual std::string ToString() const = 0;
 
+  /// \brief Create a sorting implementation
+  ///
+  /// If `spill_threshold_bytes` is non-negative then accumulated input is cut
+  /// into runs of roughly that size; each run is sorted as soon as it is full
+  /// (in parallel, on the thread delivering the batch that filled it) and the
+  /// sorted run is spilled to a temporary file.  The final sort then merges
+  /// the runs.  The default (-1) keeps all input in memory.
   static Result<std::unique_ptr<OrderByImpl>> MakeSort(
       ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
-      const SortOptions& options);
+      const SortOptions& options, int64_t spill_threshold_bytes = -1);
 
   static Result<std::unique_ptr<OrderByImpl>> MakeSelectK(
       ExecContext* ctx, const std::shared_ptr<Schema>& output_schema,
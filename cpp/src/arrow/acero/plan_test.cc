@@ -17,11 +17,14 @@
 
 #include <gmock/gmock-matchers.h>
 
+#include <chrono>
 #include <functional>
 #include <memory>
+#include <thread>
 
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
+#include "arrow/acero/statistics.h"
 #include "arrow/acero/test_nodes.h"
 #include "arrow/acero/test_util_internal.h"
 #include "arrow/acero/util.h"
@@ -120,6 +123,37 @@ struct StartStopTracker {
   }
 };
 
+TEST(ExecPlan, StatisticsPropagation) {
+  ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+  auto table = TableFromJSON(schema({field("i32", int32()), field("str", utf8())}),
+                             {R"([[4, "a"], [5, "b"], [6, "c"]])"});
+
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * source,
+      MakeExecNode("table_source", plan.get(), {}, TableSourceNodeOptions{table}));
+  const NodeStatistics& source_stats = source->output_statistics();
+  ASSERT_TRUE(source_stats.num_rows_exact);
+  ASSERT_EQ(3, *source_stats.num_rows);
+
+  // A filter keeps the row count as an inexact upper bound
+  ASSERT_OK_AND_ASSIGN(
+      ExecNode * filter,
+      MakeExecNode("filter", plan.get(), {source},
+                   FilterNodeOptions{compute::greater(field_ref("i32"),
+                                                      compute::literal(4))}));
+  const NodeStatistics& filter_stats = filter->output_statistics();
+  ASSERT_FALSE(filter_stats.num_rows_exact);
+  ASSERT_EQ(3, *filter_stats.num_rows);
+
+  // A projection preserves the row count
+  ASSERT_OK_AND_ASSIGN(ExecNode * project,
+                       MakeExecNode("project", plan.get(), {filter},
+                                    ProjectNodeOptions{{field_ref("str")}, {"str"}}));
+  const NodeStatistics& project_stats = project->output_statistics();
+  ASSERT_FALSE(project_stats.num_rows_exact);
+  ASSERT_EQ(3, *project_stats.num_rows);
+}
+
 TEST(ExecPlan, DummyStartProducing) {
   StartStopTracker t;
 
@@ -243,6 +277,39 @@ TEST(ExecPlanExecution, UseSinkAfterExecution) {
   ASSERT_FINISHES_AND_RAISES(Invalid, sink_gen());
 }
 
+TEST(ExecPlanExecution, RingBufferSink) {
+  for (bool parallel : {false, true}) {
+    SCOPED_TRACE(parallel ? "parallel" : "single threaded");
+
+    auto basic_data = MakeBasicBatches();
+    // A deliberately small ring so the sink exercises its backpressure path
+    auto ring = std::make_shared<BatchRing>(/*capacity=*/2);
+
+    ASSERT_OK_AND_ASSIGN(auto plan, ExecPlan::Make());
+    ASSERT_OK(Declaration::Sequence(
+                  {
+                      {"source", SourceNodeOptions{basic_data.schema,
+                                                   basic_data.gen(parallel,
+                                                                  /*slow=*/false)}},
+                      {"ring_buffer_sink", RingBufferSinkNodeOptions{ring}},
+                  })
+                  .AddToPlan(plan.get()));
+    plan->StartProducing();
+
+    std::vector<ExecBatch> collected;
+    while (!ring->is_finished()) {
+      if (auto batch = ring->Poll()) {
+        collected.push_back(std::move(*batch));
+      } else {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+    }
+    ASSERT_FINISHES_OK(plan->finished());
+    AssertExecBatchesEqualIgnoringOrder(basic_data.schema, basic_data.batches,
+                                        collected);
+  }
+}
+
 TEST(ExecPlanExecution, TableSourceSink) {
   for (int batch_size : {1, 4}) {
     auto exp_batches = MakeBasicBatches();
@@ -21,6 +21,7 @@
 #include "arrow/acero/map_node.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/statistics.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/exec.h"
@@ -44,7 +45,8 @@ class ProjectNode : public MapNode {
   ProjectNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
               std::shared_ptr<Schema> output_schema, std::vector<Expression> exprs)
       : MapNode(plan, std::move(inputs), std::move(output_schema)),
-        exprs_(std::move(exprs)) {}
+        exprs_(std::move(exprs)),
+        statistics_(ProjectedStatistics(inputs_[0]->output_statistics(), exprs_)) {}
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -73,6 +75,7 @@ class ProjectNode : public MapNode {
         ARROW_ASSIGN_OR_RAISE(expr, expr.Bind(*inputs[0]->output_schema(),
                                               plan->query_context()->exec_context()));
       }
+      ARROW_ASSIGN_OR_RAISE(expr, compute::FoldConstants(std::move(expr)));
       fields[i] = field(std::move(names[i]), expr.type()->GetSharedPtr());
       ++i;
     }
@@ -82,7 +85,40 @@ class ProjectNode : public MapNode {
 
   const char* kind_name() const override { return "ProjectNode"; }
 
+  const NodeStatistics& output_statistics() const override { return statistics_; }
+
+  Status Init() override {
+    compiled_exprs_.resize(plan_->query_context()->max_concurrency());
+    return MapNode::Init();
+  }
+
   Result<ExecBatch> ProcessBatch(ExecBatch batch) override {
+    auto* query_context = plan_->query_context();
+
+    std::vector<Expression> simplified_exprs(exprs_.size());
+    bool all_unchanged = true;
+    for (size_t i = 0; i < exprs_.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(simplified_exprs[i],
+                            SimplifyWithGuarantee(exprs_[i], batch.guarantee));
+      all_unchanged &= simplified_exprs[i].Equals(exprs_[i]);
+    }
+
+    const size_t thread_index = query_context->GetThreadIndex();
+    if (all_unchanged && !exprs_.empty() && thread_index < compiled_exprs_.size()) {
+      // The guarantee didn't simplify anything, so the per-thread compiled
+      // program (which evaluates subexpressions shared between projections
+      // only once) can be used.
+      arrow::util::tracing::Span span;
+      START_COMPUTE_SPAN(span, "Project", {{"project.length", batch.length}});
+      auto& compiled = compiled_exprs_[thread_index];
+      if (compiled == nullptr) {
+        ARROW_ASSIGN_OR_RAISE(compiled, compute::CompiledExpression::Compile(
+                                            exprs_, query_context->exec_context()));
+      }
+      ARROW_ASSIGN_OR_RAISE(std::vector<Datum> values, compiled->ExecuteAll(batch));
+      return ExecBatch{std::move(values), batch.length};
+    }
+
     std::vector<Datum> values{exprs_.size()};
     for (size_t i = 0; i < exprs_.size(); ++i) {
       arrow::util::tracing::Span span;
@@ -90,12 +126,9 @@ class ProjectNode : public MapNode {
                          {{"project.type", exprs_[i].type()->ToString()},
                           {"project.length", batch.length},
                           {"project.expression", exprs_[i].ToString()}});
-      ARROW_ASSIGN_OR_RAISE(Expression simplified_expr,
-                            SimplifyWithGuarantee(exprs_[i], batch.guarantee));
-
       ARROW_ASSIGN_OR_RAISE(
-          values[i], ExecuteScalarExpression(simplified_expr, batch,
-                                             plan()->query_context()->exec_context()));
+          values[i], ExecuteScalarExpression(simplified_exprs[i], batch,
+                                             query_context->exec_context()));
     }
     return ExecBatch{std::move(values), batch.length};
   }
@@ -118,6 +151,10 @@ class ProjectNode : public MapNode {
 
  private:
   std::vector<Expression> exprs_;
+  NodeStatistics statistics_;
+  // One compiled program per thread evaluating all of exprs_ with shared
+  // subexpression results, created on first use
+  std::vector<std::unique_ptr<compute::CompiledExpression>> compiled_exprs_;
 };
 
 }  // namespace
@@ -16,8 +16,13 @@
 // under the License.
 
 #include "arrow/acero/query_context.h"
+
+#include <atomic>
+#include <mutex>
+
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/io_util.h"
+#include "arrow/util/logging_internal.h"
 
 namespace arrow {
 using arrow::internal::CpuInfo;
@@ -42,6 +47,8 @@ int64_t QueryContext::hardware_flags() const { return cpu_info()->hardware_flags
 
 Status QueryContext::Init(util::AsyncTaskScheduler* scheduler) {
   async_scheduler_ = scheduler;
+  task_scheduler_->SetMemoryPressureCallback([this]() { return IsUnderMemoryPressure(); });
+  scratch_arenas_.resize(max_concurrency());
   return Status::OK();
 }
 
@@ -49,6 +56,15 @@ size_t QueryContext::GetThreadIndex() { return thread_indexer_(); }
 
 size_t QueryContext::max_concurrency() const { return thread_indexer_.Capacity(); }
 
+MemoryPool* QueryContext::GetScratchArena(size_t thread_index) {
+  DCHECK_LT(thread_index, scratch_arenas_.size());
+  auto& arena = scratch_arenas_[thread_index];
+  if (!arena) {
+    arena = memory_pool()->CreateArena();
+  }
+  return arena.get();
+}
+
 Result<Future<>> QueryContext::BeginExternalTask(std::string_view name) {
   Future<> completion_future = Future<>::Make();
   if (async_scheduler_->AddSimpleTask([completion_future] { return completion_future; },
@@ -74,6 +90,54 @@ void QueryContext::ScheduleTask(std::function<Status(size_t)> fn, std::string_vi
   ScheduleTask(std::move(indexed_fn), name);
 }
 
+void QueryContext::ScheduleTasks(std::vector<std::function<Status(size_t)>> fns,
+                                 std::string_view name) {
+  if (fns.empty()) {
+    return;
+  }
+  ::arrow::internal::Executor* exec = executor();
+  // One scheduler task tracks the whole batch; the tasks themselves are
+  // submitted to the executor in a single SpawnMany call.
+  async_scheduler_->AddSimpleTask(
+      [this, exec, fns = std::move(fns)]() mutable -> Result<Future<>> {
+        struct BatchState {
+          explicit BatchState(int num_tasks) : remaining(num_tasks) {}
+
+          void TaskFinished(Status task_status) {
+            if (!task_status.ok()) {
+              std::lock_guard<std::mutex> lock(mutex);
+              status &= std::move(task_status);
+            }
+            if (remaining.fetch_sub(1) == 1) {
+              Status final_status;
+              {
+                std::lock_guard<std::mutex> lock(mutex);
+                final_status = std::move(status);
+              }
+              finished.MarkFinished(std::move(final_status));
+            }
+          }
+
+          std::atomic<int> remaining;
+          std::mutex mutex;
+          Status status;
+          Future<> finished = Future<>::Make();
+        };
+        auto state = std::make_shared<BatchState>(static_cast<int>(fns.size()));
+        std::vector<::arrow::internal::FnOnce<void()>> tasks;
+        tasks.reserve(fns.size());
+        for (auto& fn : fns) {
+          tasks.push_back([this, state, fn = std::move(fn)]() mutable {
+            state->TaskFinished(std::move(fn)(GetThreadIndex()));
+          });
+        }
+        Future<> finished = state->finished;
+        ARROW_RETURN_NOT_OK(exec->SpawnMany(std::move(tasks)));
+        return finished;
+      },
+      name);
+}
+
 void QueryContext::ScheduleIOTask(std::function<Status()> fn, std::string_view name) {
   async_scheduler_->AddSimpleTask(
       [this, fn]() { return io_context_.executor()->Submit(std::move(fn)); }, name);
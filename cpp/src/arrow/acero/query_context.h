@@ -53,6 +53,15 @@ class ARROW_ACERO_EXPORT QueryContext {
   size_t GetThreadIndex();
   size_t max_concurrency() const;
 
+  /// \brief Get a per-thread bump-allocation arena for task scratch
+  ///
+  /// The arena is lazily created from the query's memory pool (see
+  /// MemoryPool::CreateArena) and lives until the QueryContext is destroyed,
+  /// so allocations from it must not outlive the task that made them.  Each
+  /// thread index gets its own arena, so no synchronization is involved; the
+  /// caller must pass its own thread index.
+  MemoryPool* GetScratchArena(size_t thread_index);
+
   /// \brief Start an external task
   ///
   /// This should be avoided if possible.  It is kept in for now for legacy
@@ -79,6 +88,17 @@ class ARROW_ACERO_EXPORT QueryContext {
   /// \param fn The task to run. Takes the thread index and returns a Status.
   /// \param name A name to give the task for traceability and debugging
   void ScheduleTask(std::function<Status(size_t)> fn, std::string_view name);
+  /// \brief Add a batch of functions as tasks to the query's task group
+  ///        on the compute threadpool.
+  ///
+  /// The batch is handed to the executor in a single call, which is cheaper
+  /// than scheduling the tasks one by one, and is tracked as one unit by the
+  /// async scheduler.
+  ///
+  /// \param fns The tasks to run. Each takes the thread index and returns a Status.
+  /// \param name A name to give the batch for traceability and debugging
+  void ScheduleTasks(std::vector<std::function<Status(size_t)>> fns,
+                     std::string_view name);
   /// \brief Add a single function as a task to the query's task group on
   ///        the IO thread pool
   ///
@@ -133,6 +153,24 @@ class ARROW_ACERO_EXPORT QueryContext {
 
   size_t GetCurrentTempFileIO() { return in_flight_bytes_to_disk_.load(); }
 
+  /// \brief Account for backpressure applied (or released) by a node
+  ///
+  /// While any node keeps backpressure applied, or the memory pool is above
+  /// QueryOptions::memory_pressure_threshold_bytes, the task scheduler
+  /// prefers downstream task groups over upstream ones.
+  void NotifyBackpressureApplied(bool applied) {
+    backpressure_count_.fetch_add(applied ? 1 : -1, std::memory_order_relaxed);
+  }
+
+  /// \brief Whether the query should currently favor draining over admitting input
+  bool IsUnderMemoryPressure() const {
+    if (backpressure_count_.load(std::memory_order_relaxed) > 0) {
+      return true;
+    }
+    int64_t watermark = options_.memory_pressure_threshold_bytes;
+    return watermark >= 0 && memory_pool()->bytes_allocated() >= watermark;
+  }
+
  private:
   QueryOptions options_;
   // To be replaced with Acero-specific context once scheduler is done and
@@ -144,8 +182,12 @@ class ARROW_ACERO_EXPORT QueryContext {
   std::unique_ptr<TaskScheduler> task_scheduler_ = TaskScheduler::Make();
 
   ThreadIndexer thread_indexer_;
+  // Lazily created per-thread scratch arenas, indexed by thread index
+  std::vector<std::unique_ptr<MemoryPool>> scratch_arenas_;
 
   std::atomic<size_t> in_flight_bytes_to_disk_{0};
+  // Number of nodes that currently keep backpressure applied
+  std::atomic<int> backpressure_count_{0};
 };
 }  // namespace acero
 }  // namespace arrow
@@ -424,6 +424,104 @@ class ConsumingSinkNode : public ExecNode,
   std::unique_ptr<util::SerialSequencingQueue> sequencer_;
 };
 
+// A sink that hands each finished batch to an embedding application through a
+// caller-provided BatchRing, bypassing the future/generator machinery and its
+// per-batch queuing.  The input is paused while the ring is nearly full and resumed
+// once the consumer drains it; see RingBufferSinkNodeOptions.
+class RingBufferSinkNode : public ExecNode, public TracedNode {
+ public:
+  RingBufferSinkNode(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                     std::shared_ptr<BatchRing> ring)
+      : ExecNode(plan, std::move(inputs), {"collected"}, {}),
+        TracedNode(this),
+        ring_(std::move(ring)),
+        pause_threshold_(ring_->capacity() - ring_->capacity() / 4) {
+    // Resume a paused input once the consumer drained the ring down to a quarter
+    ring_->SetDrainCallback(ring_->capacity() / 4, [this] {
+      if (paused_.exchange(false)) {
+        inputs_[0]->ResumeProducing(this, ++backpressure_counter_);
+      }
+    });
+  }
+
+  static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
+                                const ExecNodeOptions& options) {
+    RETURN_NOT_OK(ValidateExecNodeInputs(plan, inputs, 1, "RingBufferSinkNode"));
+    const auto& sink_options = checked_cast<const RingBufferSinkNodeOptions&>(options);
+    if (!sink_options.ring) {
+      return Status::Invalid("A BatchRing is required");
+    }
+    return plan->EmplaceNode<RingBufferSinkNode>(plan, std::move(inputs),
+                                                 sink_options.ring);
+  }
+
+  const char* kind_name() const override { return "RingBufferSinkNode"; }
+
+  Status StartProducing() override {
+    NoteStartProducing(ToStringExtra());
+    return Status::OK();
+  }
+
+  Status Validate() const override {
+    ARROW_RETURN_NOT_OK(ExecNode::Validate());
+    if (output_ != nullptr) {
+      return Status::Invalid("Ring buffer sink node '", label(), "' has an output");
+    }
+    return Status::OK();
+  }
+
+  // sink nodes have no outputs from which to feel backpressure
+  [[noreturn]] static void NoOutputs() {
+    Unreachable("no outputs; this should never be called");
+  }
+  [[noreturn]] void ResumeProducing(ExecNode* output, int32_t counter) override {
+    NoOutputs();
+  }
+  [[noreturn]] void PauseProducing(ExecNode* output, int32_t counter) override {
+    NoOutputs();
+  }
+
+  Status StopProducingImpl() override {
+    // Unblock any producer waiting on a full ring and let the consumer's poll
+    // loop terminate
+    ring_->Finish();
+    return Status::OK();
+  }
+
+  Status InputReceived(ExecNode* input, ExecBatch batch) override {
+    auto scope = TraceInputReceived(batch);
+    DCHECK_EQ(input, inputs_[0]);
+
+    if (input_counter_.Completed()) {
+      return Status::OK();
+    }
+
+    ring_->Push(std::move(batch));
+    if (ring_->size() >= pause_threshold_ && !paused_.exchange(true)) {
+      inputs_[0]->PauseProducing(this, ++backpressure_counter_);
+    }
+
+    if (input_counter_.Increment()) {
+      ring_->Finish();
+    }
+    return Status::OK();
+  }
+
+  Status InputFinished(ExecNode* input, int total_batches) override {
+    if (input_counter_.SetTotal(total_batches)) {
+      ring_->Finish();
+    }
+    return Status::OK();
+  }
+
+ private:
+  AtomicCounter input_counter_;
+  std::shared_ptr<BatchRing> ring_;
+  const size_t pause_threshold_;
+  std::atomic<bool> paused_{false};
+  std::atomic<int32_t> backpressure_counter_{0};
+};
+
 static Result<ExecNode*> MakeTableConsumingSinkNode(ExecPlan* plan,
                                                     std::vector<ExecNode*> inputs,
                                                     const ExecNodeOptions& options) {
@@ -463,7 +561,8 @@ struct OrderBySinkNode final : public SinkNode {
     ARROW_ASSIGN_OR_RAISE(
         std::unique_ptr<OrderByImpl> impl,
         OrderByImpl::MakeSort(plan->query_context()->exec_context(),
-                              inputs[0]->output_schema(), sink_options.sort_options));
+                              inputs[0]->output_schema(), sink_options.sort_options,
+                              plan->query_context()->options().spill_threshold_bytes));
     return plan->EmplaceNode<OrderBySinkNode>(plan, std::move(inputs), std::move(impl),
                                               sink_options.generator);
   }
@@ -561,6 +660,7 @@ void RegisterSinkNode(ExecFactoryRegistry* registry) {
   DCHECK_OK(registry->AddFactory("select_k_sink", OrderBySinkNode::MakeSelectK));
   DCHECK_OK(registry->AddFactory("order_by_sink", OrderBySinkNode::MakeSort));
   DCHECK_OK(registry->AddFactory("consuming_sink", ConsumingSinkNode::Make));
+  DCHECK_OK(registry->AddFactory("ring_buffer_sink", RingBufferSinkNode::Make));
   DCHECK_OK(registry->AddFactory("sink", SinkNode::Make));
   DCHECK_OK(registry->AddFactory("table_sink", MakeTableConsumingSinkNode));
 }
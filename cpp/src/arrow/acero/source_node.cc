@@ -22,7 +22,9 @@
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/acero/statistics.h"
 #include "arrow/acero/util.h"
+#include "arrow/array/data.h"
 #include "arrow/compute/exec.h"
 #include "arrow/compute/exec_internal.h"
 #include "arrow/compute/expression.h"
@@ -92,6 +94,21 @@ Status HandleUnalignedBuffers(ExecBatch* batch, UnalignedBufferHandling handling
   return Status::OK();
 }
 
+// Null counts are computed lazily and cached per array.  Computing them up
+// front for the whole batch in one prefetch-pipelined bitmap pass keeps
+// downstream kernels from each touching cold bitmap memory on demand,
+// which causes measurable cache thrash on wide tables.
+void PrecomputeBatchNullCounts(const ExecBatch& batch) {
+  std::vector<std::shared_ptr<ArrayData>> arrays;
+  arrays.reserve(batch.values.size());
+  for (const auto& value : batch.values) {
+    if (value.is_array()) {
+      arrays.push_back(value.array());
+    }
+  }
+  arrow::internal::PrecomputeNullCounts(arrays);
+}
+
 struct SourceNode : ExecNode, public TracedNode {
   SourceNode(ExecPlan* plan, std::shared_ptr<Schema> output_schema,
              AsyncGenerator<std::optional<ExecBatch>> generator,
@@ -150,6 +167,7 @@ struct SourceNode : ExecNode, public TracedNode {
                     GetDefaultUnalignedBufferHandling());
             ARROW_RETURN_NOT_OK(
                 HandleUnalignedBuffers(&batch, unaligned_buffer_handling));
+            PrecomputeBatchNullCounts(batch);
             if (has_ordering) {
               batch.index = batch_index;
             }
@@ -302,7 +320,12 @@ struct SourceNode : ExecNode, public TracedNode {
 struct TableSourceNode : public SourceNode {
   TableSourceNode(ExecPlan* plan, std::shared_ptr<Table> table, int64_t batch_size)
       : SourceNode(plan, table->schema(), TableGenerator(*table, batch_size),
-                   Ordering::Implicit()) {}
+                   Ordering::Implicit()) {
+    statistics_.num_rows = table->num_rows();
+    statistics_.num_rows_exact = true;
+  }
+
+  const NodeStatistics& output_statistics() const override { return statistics_; }
 
   static Result<ExecNode*> Make(ExecPlan* plan, std::vector<ExecNode*> inputs,
                                 const ExecNodeOptions& options) {
@@ -365,6 +388,8 @@ struct TableSourceNode : public SourceNode {
     }
     return exec_batches;
   }
+
+  NodeStatistics statistics_;
 };
 
 template <typename This, typename Options>
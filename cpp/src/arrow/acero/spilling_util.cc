@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/acero/spilling_util.h"
+
+#include <utility>
+
+#include "arrow/io/file.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/byte_size.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace acero {
+namespace util {
+
+struct SpillFile::Impl {
+  std::unique_ptr<arrow::internal::TemporaryDir> dir;
+  std::string path;
+  std::shared_ptr<io::FileOutputStream> sink;
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+};
+
+Result<std::unique_ptr<SpillFile>> SpillFile::Make(std::shared_ptr<Schema> schema,
+                                                   MemoryPool* pool) {
+  auto impl = std::make_unique<Impl>();
+  ARROW_ASSIGN_OR_RAISE(impl->dir, arrow::internal::TemporaryDir::Make("acero-spill-"));
+  ARROW_ASSIGN_OR_RAISE(auto path, impl->dir->path().Join("batches.arrows"));
+  impl->path = path.ToString();
+  ARROW_ASSIGN_OR_RAISE(impl->sink, io::FileOutputStream::Open(impl->path));
+  ipc::IpcWriteOptions write_options = ipc::IpcWriteOptions::Defaults();
+  write_options.memory_pool = pool;
+  ARROW_ASSIGN_OR_RAISE(impl->writer,
+                        ipc::MakeStreamWriter(impl->sink, schema, write_options));
+  std::unique_ptr<SpillFile> result{new SpillFile()};
+  result->impl_ = std::move(impl);
+  result->schema_ = std::move(schema);
+  result->pool_ = pool;
+  return result;
+}
+
+SpillFile::~SpillFile() = default;
+
+Status SpillFile::Append(ExecBatch batch) {
+  if (impl_->writer == nullptr) {
+    return Status::Invalid("Appending to a spill file that has already been replayed");
+  }
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch,
+                        batch.ToRecordBatch(schema_, pool_));
+  bytes_spilled_ += arrow::util::TotalBufferSize(*record_batch);
+  RETURN_NOT_OK(impl_->writer->WriteRecordBatch(*record_batch));
+  ++num_batches_;
+  return Status::OK();
+}
+
+Status SpillFile::Replay(std::function<Status(ExecBatch)> visitor) {
+  if (impl_->writer != nullptr) {
+    RETURN_NOT_OK(impl_->writer->Close());
+    RETURN_NOT_OK(impl_->sink->Close());
+    impl_->writer.reset();
+    impl_->sink.reset();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto file, io::ReadableFile::Open(impl_->path, pool_));
+  ARROW_ASSIGN_OR_RAISE(auto reader, ipc::RecordBatchStreamReader::Open(file));
+  for (;;) {
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> record_batch, reader->Next());
+    if (record_batch == nullptr) {
+      break;
+    }
+    RETURN_NOT_OK(visitor(ExecBatch(*record_batch)));
+  }
+  return file->Close();
+}
+
+}  // namespace util
+}  // namespace acero
+}  // namespace arrow
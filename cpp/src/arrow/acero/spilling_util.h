@@ -0,0 +1,83 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+#include "arrow/acero/visibility.h"
+#include "arrow/compute/exec.h"
+#include "arrow/result.h"
+#include "arrow/type_fwd.h"
+
+namespace arrow {
+namespace acero {
+namespace util {
+
+using arrow::compute::ExecBatch;
+
+/// \brief A temporary file holding a sequence of spilled batches
+///
+/// Batches are appended to a file in the system temporary directory using the
+/// IPC stream format and can later be replayed in insertion order.  This is
+/// used by nodes that accumulate input (e.g. the probe side of a hash join
+/// while the build side is under construction) to keep their accumulation
+/// bounded by a memory budget instead of failing with out-of-memory.
+///
+/// Appending and replaying must not overlap.  The file and its containing
+/// directory are removed when the object is destroyed.
+class ARROW_ACERO_EXPORT SpillFile {
+ public:
+  /// \brief Create a spill file for batches of the given schema
+  ///
+  /// \param schema the schema of the batches that will be appended
+  /// \param pool the pool used for temporary allocations during serialization
+  static Result<std::unique_ptr<SpillFile>> Make(std::shared_ptr<Schema> schema,
+                                                 MemoryPool* pool);
+
+  ~SpillFile();
+
+  /// \brief Serialize a batch to the end of the file
+  Status Append(ExecBatch batch);
+
+  /// \brief Read the spilled batches back, in insertion order
+  ///
+  /// Finalizes the file; no further batches can be appended afterwards.
+  Status Replay(std::function<Status(ExecBatch)> visitor);
+
+  /// \brief The number of batches appended so far
+  size_t num_batches() const { return num_batches_; }
+
+  /// \brief The total size in bytes of the buffers of the appended batches
+  int64_t bytes_spilled() const { return bytes_spilled_; }
+
+ private:
+  SpillFile() = default;
+
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+  std::shared_ptr<Schema> schema_;
+  MemoryPool* pool_ = NULLPTR;
+  size_t num_batches_ = 0;
+  int64_t bytes_spilled_ = 0;
+};
+
+}  // namespace util
+}  // namespace acero
+}  // namespace arrow
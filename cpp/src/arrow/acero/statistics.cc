@@ -0,0 +1,72 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/acero/statistics.h"
+
+#include "arrow/compute/expression.h"
+#include "arrow/type.h"
+
+namespace arrow {
+namespace acero {
+
+const NodeStatistics& NodeStatistics::Unknown() {
+  static const NodeStatistics unknown;
+  return unknown;
+}
+
+NodeStatistics FilteredStatistics(const NodeStatistics& input,
+                                  const compute::Expression& filter) {
+  if (filter == compute::literal(true)) {
+    return input;
+  }
+  NodeStatistics out;
+  // A filter can only remove rows; the input count becomes an upper bound
+  out.num_rows = input.num_rows;
+  out.num_rows_exact = false;
+  out.fields = input.fields;
+  for (auto& [index, stats] : out.fields) {
+    // Min/max remain valid bounds but the extreme values may be filtered out
+    stats.is_min_exact = false;
+    stats.is_max_exact = false;
+    // ArrayStatistics has no exactness flags for counts, so drop them rather
+    // than advertise stale exact values
+    stats.null_count.reset();
+    stats.distinct_count.reset();
+  }
+  return out;
+}
+
+NodeStatistics ProjectedStatistics(const NodeStatistics& input,
+                                   const std::vector<compute::Expression>& exprs) {
+  NodeStatistics out;
+  out.num_rows = input.num_rows;
+  out.num_rows_exact = input.num_rows_exact;
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    const FieldRef* ref = exprs[i].field_ref();
+    if (ref == NULLPTR) continue;
+    const FieldPath* path = ref->field_path();
+    if (path == NULLPTR || path->indices().size() != 1) continue;
+    auto it = input.fields.find(path->indices()[0]);
+    if (it != input.fields.end()) {
+      out.fields[static_cast<int>(i)] = it->second;
+    }
+  }
+  return out;
+}
+
+}  // namespace acero
+}  // namespace arrow
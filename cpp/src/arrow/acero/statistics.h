@@ -0,0 +1,79 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// This API is EXPERIMENTAL.
+
+#pragma once
+
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "arrow/acero/type_fwd.h"
+#include "arrow/acero/visibility.h"
+#include "arrow/array/statistics.h"
+#include "arrow/compute/type_fwd.h"
+
+namespace arrow {
+namespace acero {
+
+/// \brief Statistics describing the batches produced by an ExecNode
+///
+/// Exposed through ExecNode::output_statistics().  Sources that know their
+/// data (e.g. a table source) advertise row counts and per-field statistics;
+/// shape-preserving nodes such as filter and project transform their input's
+/// statistics rather than discarding them, so downstream operators can
+/// pre-size hash tables or choose between join strategies.
+///
+/// Sortedness is conveyed separately through ExecNode::ordering().
+///
+/// All members are advisory: a node may always advertise
+/// NodeStatistics::Unknown() and consumers must treat missing values as
+/// "nothing known".
+struct ARROW_ACERO_EXPORT NodeStatistics {
+  /// \brief The total number of output rows, if known
+  std::optional<int64_t> num_rows;
+
+  /// \brief Whether num_rows is exact or an upper-bound estimate
+  bool num_rows_exact = false;
+
+  /// \brief Per-field statistics, keyed by output field index
+  ///
+  /// Fields without an entry have no known statistics.
+  std::unordered_map<int, ArrayStatistics> fields;
+
+  /// \brief Statistics advertising nothing
+  static const NodeStatistics& Unknown();
+};
+
+/// \brief Transform statistics across a filter
+///
+/// A filter can only remove rows, so the input row count survives as an
+/// upper-bound estimate and min/max values survive as inexact bounds.
+ARROW_ACERO_EXPORT NodeStatistics FilteredStatistics(const NodeStatistics& input,
+                                                     const compute::Expression& filter);
+
+/// \brief Transform statistics across a projection
+///
+/// The row count is preserved as-is.  Field statistics are remapped for
+/// expressions that are direct field references; computed expressions get no
+/// statistics.
+ARROW_ACERO_EXPORT NodeStatistics ProjectedStatistics(
+    const NodeStatistics& input, const std::vector<compute::Expression>& exprs);
+
+}  // namespace acero
+}  // namespace arrow
@@ -798,9 +798,11 @@ SwissTableWithKeys::Input::Input(const Input& base, int num_rows_to_skip,
   }
 }
 
-Status SwissTableWithKeys::Init(int64_t hardware_flags, MemoryPool* pool) {
+Status SwissTableWithKeys::Init(int64_t hardware_flags, MemoryPool* pool,
+                                int64_t num_keys_hint) {
   InitCallbacks();
-  return swiss_table_.init(hardware_flags, pool);
+  return swiss_table_.init(hardware_flags, pool,
+                           SwissTable::log_blocks_for_num_groups(num_keys_hint));
 }
 
 void SwissTableWithKeys::EqualCallback(int num_keys, const uint16_t* selection_maybe_null,
@@ -1104,7 +1106,8 @@ Status SwissTableForJoinBuild::Init(SwissTableForJoin* target, int dop, int64_t
                                     bool no_payload,
                                     const std::vector<KeyColumnMetadata>& key_types,
                                     const std::vector<KeyColumnMetadata>& payload_types,
-                                    MemoryPool* pool, int64_t hardware_flags) {
+                                    MemoryPool* pool, int64_t hardware_flags,
+                                    int64_t num_keys_hint) {
   target_ = target;
   dop_ = dop;
   num_rows_ = num_rows;
@@ -1135,9 +1138,13 @@ Status SwissTableForJoinBuild::Init(SwissTableForJoin* target, int dop, int64_t
                                                 /*row_alignment=*/sizeof(uint64_t),
                                                 /*string_alignment=*/sizeof(uint64_t));
 
+  // Keys are spread across partitions by hash, so each partition expects an
+  // even share of the estimated distinct keys
+  int64_t prtn_num_keys_hint = bit_util::CeilDiv(num_keys_hint, num_prtns_);
+
   for (int i = 0; i < num_prtns_; ++i) {
     PartitionState& prtn_state = prtn_states_[i];
-    RETURN_NOT_OK(prtn_state.keys.Init(hardware_flags_, pool_));
+    RETURN_NOT_OK(prtn_state.keys.Init(hardware_flags_, pool_, prtn_num_keys_hint));
     RETURN_NOT_OK(
         prtn_state.keys.keys()->InitIfNeeded(pool, hardware_flags, key_row_metadata));
     RETURN_NOT_OK(
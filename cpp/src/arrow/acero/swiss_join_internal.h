@@ -418,7 +418,11 @@ struct SwissTableWithKeys {
     std::vector<uint32_t>* temp_group_ids;
   };
 
-  Status Init(int64_t hardware_flags, MemoryPool* pool);
+  // num_keys_hint, when positive, is an estimate of the number of distinct
+  // keys that will be inserted (e.g. from scan statistics).  The underlying
+  // SwissTable is pre-sized for it, avoiding the chain of full rehashes that
+  // a large build otherwise goes through.
+  Status Init(int64_t hardware_flags, MemoryPool* pool, int64_t num_keys_hint = 0);
 
   void InitCallbacks();
 
@@ -523,11 +527,15 @@ class SwissTableForJoin {
 //
 class SwissTableForJoinBuild {
  public:
+  // num_keys_hint, when positive, is an estimate of the number of distinct
+  // keys on the build side (e.g. an NDV sketch from scan statistics).  Each
+  // partition's hash table is pre-sized for its share of the estimate, so
+  // that large builds do not stall in repeated stop-the-world rehashes.
   Status Init(SwissTableForJoin* target, int dop, int64_t num_rows, int64_t num_batches,
               bool reject_duplicate_keys, bool no_payload,
               const std::vector<KeyColumnMetadata>& key_types,
               const std::vector<KeyColumnMetadata>& payload_types, MemoryPool* pool,
-              int64_t hardware_flags);
+              int64_t hardware_flags, int64_t num_keys_hint = 0);
 
   // In the first phase of parallel hash table build, each thread picks unprocessed exec
   // batches, hashes the batches and preserve the hashes, then partition the rows based on
@@ -18,7 +18,9 @@
 #include "arrow/acero/task_util.h"
 
 #include <algorithm>
+#include <chrono>
 #include <mutex>
+#include <vector>
 
 #include "arrow/util/config.h"
 #include "arrow/util/logging_internal.h"
@@ -35,7 +37,11 @@ class TaskSchedulerImpl : public TaskScheduler {
   Status ExecuteMore(size_t thread_id, int num_tasks_to_execute,
                      bool execute_all) override;
   Status StartScheduling(size_t thread_id, ScheduleImpl schedule_impl,
-                         int num_concurrent_tasks, bool use_sync_execution) override;
+                         int num_concurrent_tasks, bool use_sync_execution,
+                         ScheduleManyImpl schedule_many_impl) override;
+  void SetMemoryPressureCallback(MemoryPressureImpl memory_pressure_impl) override;
+  TaskGroupStats GetTaskGroupStats(int group_id) override;
+  void SetConcurrencyAutoTuning(bool enabled) override;
   void Abort(AbortContinuationImpl impl) override;
 
  private:
@@ -57,6 +63,9 @@ class TaskSchedulerImpl : public TaskScheduler {
           num_tasks_present_(0) {
       num_tasks_started_.value.store(0);
       num_tasks_finished_.value.store(0);
+      num_tasks_in_flight_.value.store(0);
+      task_duration_ns_.value.store(0);
+      max_in_flight_.value.store(-1);
     }
     TaskGroup(const TaskGroup& src)
         : task_impl_(src.task_impl_),
@@ -66,6 +75,9 @@ class TaskSchedulerImpl : public TaskScheduler {
       ARROW_DCHECK(src.state_ == TaskGroupState::NOT_READY);
       num_tasks_started_.value.store(0);
       num_tasks_finished_.value.store(0);
+      num_tasks_in_flight_.value.store(0);
+      task_duration_ns_.value.store(0);
+      max_in_flight_.value.store(-1);
     }
     TaskImpl task_impl_;
     TaskGroupContinuationImpl cont_impl_;
@@ -75,20 +87,37 @@ class TaskSchedulerImpl : public TaskScheduler {
 
     AtomicWithPadding<int64_t> num_tasks_started_;
     AtomicWithPadding<int64_t> num_tasks_finished_;
+
+    // Runtime counters used by concurrency auto-tuning
+    AtomicWithPadding<int64_t> num_tasks_in_flight_;
+    AtomicWithPadding<int64_t> task_duration_ns_;
+    // Per-group concurrency cap (-1 when unlimited)
+    AtomicWithPadding<int> max_in_flight_;
+    // Snapshot of task_duration_ns_ at the last tuning pass (guarded by mutex_)
+    int64_t last_tuned_duration_ns_ = 0;
   };
 
   std::vector<std::pair<int, int64_t>> PickTasks(int num_tasks, int start_task_group = 0);
   Status ExecuteTask(size_t thread_id, int group_id, int64_t task_id,
                      bool* task_group_finished);
+  TaskGroupContinuationImpl TaskRunner(int group_id, int64_t task_id);
   bool PostExecuteTask(size_t thread_id, int group_id);
   Status OnTaskGroupFinished(size_t thread_id, int group_id,
                              bool* all_task_groups_finished);
-  Status ScheduleMore(size_t thread_id, int num_tasks_finished = 0);
+  Status ScheduleMore(size_t thread_id, int num_tasks_finished = 0,
+                      int start_task_group = 0);
+  void UpdateConcurrencyCaps();
+
+  // Number of task completions between two tuning passes
+  static constexpr int64_t kTuneInterval = 64;
 
+  bool auto_tune_ = false;
   bool use_sync_execution_;
   int num_concurrent_tasks_;
   ScheduleImpl schedule_impl_;
+  ScheduleManyImpl schedule_many_impl_;
   AbortContinuationImpl abort_cont_impl_;
+  MemoryPressureImpl memory_pressure_impl_;
 
   std::vector<TaskGroup> task_groups_;
   bool register_finished_;
@@ -97,6 +126,7 @@ class TaskSchedulerImpl : public TaskScheduler {
 
   AtomicWithPadding<bool> aborted_;
   AtomicWithPadding<int> num_tasks_to_schedule_;
+  AtomicWithPadding<int64_t> completions_since_tune_;
   // If a task group adds tasks it's possible for a thread inside
   // ScheduleMore to miss this fact.  This serves as a flag to
   // notify the scheduling thread that it might need to make
@@ -108,6 +138,7 @@ TaskSchedulerImpl::TaskSchedulerImpl()
     : use_sync_execution_(false), num_concurrent_tasks_(0), register_finished_(false) {
   aborted_.value.store(false);
   num_tasks_to_schedule_.value.store(0);
+  completions_since_tune_.value.store(0);
   tasks_added_recently_.value.store(false);
 }
 
@@ -163,8 +194,17 @@ Status TaskSchedulerImpl::StartTaskGroup(size_t thread_id, int group_id,
 std::vector<std::pair<int, int64_t>> TaskSchedulerImpl::PickTasks(int num_tasks,
                                                                   int start_task_group) {
   std::vector<std::pair<int, int64_t>> result;
+  // While the query is under memory pressure, prefer the task groups that were
+  // registered last: they belong to the most downstream stages of the plan, so
+  // running them drains accumulated data instead of admitting more.  The
+  // morsel-driven affinity to the caller's current group is given up in that
+  // case, since bounding memory matters more than cache locality.
+  const bool under_pressure = memory_pressure_impl_ && memory_pressure_impl_();
   for (size_t i = 0; i < task_groups_.size(); ++i) {
-    int task_group_id = static_cast<int>((start_task_group + i) % (task_groups_.size()));
+    int task_group_id =
+        under_pressure
+            ? static_cast<int>(task_groups_.size() - 1 - i)
+            : static_cast<int>((start_task_group + i) % (task_groups_.size()));
     TaskGroup& task_group = task_groups_[task_group_id];
 
     {
@@ -175,6 +215,18 @@ std::vector<std::pair<int, int64_t>> TaskSchedulerImpl::PickTasks(int num_tasks,
     }
 
     int num_tasks_remaining = num_tasks - static_cast<int>(result.size());
+    if (auto_tune_) {
+      // Respect the group's concurrency cap computed by the last tuning pass
+      int cap = task_group.max_in_flight_.value.load();
+      if (cap >= 0) {
+        int allowed =
+            cap - static_cast<int>(task_group.num_tasks_in_flight_.value.load());
+        if (allowed <= 0) {
+          continue;
+        }
+        num_tasks_remaining = std::min(num_tasks_remaining, allowed);
+      }
+    }
     int64_t start_task =
         task_group.num_tasks_started_.value.fetch_add(num_tasks_remaining);
     if (start_task >= task_group.num_tasks_present_) {
@@ -197,6 +249,9 @@ std::vector<std::pair<int, int64_t>> TaskSchedulerImpl::PickTasks(int num_tasks,
          ++task_id) {
       result.push_back(std::make_pair(task_group_id, task_id));
     }
+    if (auto_tune_) {
+      task_group.num_tasks_in_flight_.value += num_tasks_current_group;
+    }
 
     if (static_cast<int>(result.size()) == num_tasks) {
       break;
@@ -209,13 +264,29 @@ std::vector<std::pair<int, int64_t>> TaskSchedulerImpl::PickTasks(int num_tasks,
 Status TaskSchedulerImpl::ExecuteTask(size_t thread_id, int group_id, int64_t task_id,
                                       bool* task_group_finished) {
   if (!aborted_.value.load()) {
-    RETURN_NOT_OK(task_groups_[group_id].task_impl_(thread_id, task_id));
+    if (auto_tune_) {
+      auto start = std::chrono::steady_clock::now();
+      Status status = task_groups_[group_id].task_impl_(thread_id, task_id);
+      task_groups_[group_id].task_duration_ns_.value +=
+          std::chrono::duration_cast<std::chrono::nanoseconds>(
+              std::chrono::steady_clock::now() - start)
+              .count();
+      RETURN_NOT_OK(status);
+    } else {
+      RETURN_NOT_OK(task_groups_[group_id].task_impl_(thread_id, task_id));
+    }
   }
   *task_group_finished = PostExecuteTask(thread_id, group_id);
   return Status::OK();
 }
 
 bool TaskSchedulerImpl::PostExecuteTask(size_t thread_id, int group_id) {
+  if (auto_tune_) {
+    task_groups_[group_id].num_tasks_in_flight_.value.fetch_sub(1);
+    if ((completions_since_tune_.value.fetch_add(1) + 1) % kTuneInterval == 0) {
+      UpdateConcurrencyCaps();
+    }
+  }
   int64_t total = task_groups_[group_id].num_tasks_present_;
   int64_t prev_finished = task_groups_[group_id].num_tasks_finished_.value.fetch_add(1);
   bool all_tasks_finished = (prev_finished + 1 == total);
@@ -310,8 +381,10 @@ Status TaskSchedulerImpl::ExecuteMore(size_t thread_id, int num_tasks_to_execute
 
 Status TaskSchedulerImpl::StartScheduling(size_t thread_id, ScheduleImpl schedule_impl,
                                           int num_concurrent_tasks,
-                                          bool use_sync_execution) {
+                                          bool use_sync_execution,
+                                          ScheduleManyImpl schedule_many_impl) {
   schedule_impl_ = std::move(schedule_impl);
+  schedule_many_impl_ = std::move(schedule_many_impl);
 #ifdef ARROW_ENABLE_THREADING
   use_sync_execution_ = use_sync_execution;
 #else
@@ -322,7 +395,61 @@ Status TaskSchedulerImpl::StartScheduling(size_t thread_id, ScheduleImpl schedul
   return ScheduleMore(thread_id);
 }
 
-Status TaskSchedulerImpl::ScheduleMore(size_t thread_id, int num_tasks_finished) {
+void TaskSchedulerImpl::SetMemoryPressureCallback(
+    MemoryPressureImpl memory_pressure_impl) {
+  memory_pressure_impl_ = std::move(memory_pressure_impl);
+}
+
+TaskScheduler::TaskGroupStats TaskSchedulerImpl::GetTaskGroupStats(int group_id) {
+  ARROW_DCHECK(group_id >= 0 && group_id < static_cast<int>(task_groups_.size()));
+  TaskGroup& task_group = task_groups_[group_id];
+  TaskGroupStats stats;
+  // num_tasks_started_ may overshoot num_tasks_present_ because PickTasks
+  // claims tasks with an unconditional fetch_add
+  stats.num_tasks_started = std::min(task_group.num_tasks_started_.value.load(),
+                                     task_group.num_tasks_present_);
+  stats.num_tasks_finished = task_group.num_tasks_finished_.value.load();
+  stats.num_tasks_in_flight = task_group.num_tasks_in_flight_.value.load();
+  stats.total_task_duration_ns = task_group.task_duration_ns_.value.load();
+  stats.concurrency_cap = task_group.max_in_flight_.value.load();
+  return stats;
+}
+
+void TaskSchedulerImpl::SetConcurrencyAutoTuning(bool enabled) { auto_tune_ = enabled; }
+
+void TaskSchedulerImpl::UpdateConcurrencyCaps() {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // Split the concurrency budget between groups that still have pending tasks,
+  // proportionally to the busy time each accumulated since the last pass.  A
+  // group whose tasks dominated the recent wall-clock time is the bottleneck
+  // and receives more in-flight slots; a group that barely consumed CPU gives
+  // slots back.  Every group keeps at least one slot so it cannot starve.
+  std::vector<int64_t> deltas(task_groups_.size(), 0);
+  std::vector<size_t> active;
+  int64_t total_delta = 0;
+  for (size_t i = 0; i < task_groups_.size(); ++i) {
+    TaskGroup& task_group = task_groups_[i];
+    if (task_group.state_ != TaskGroupState::READY) {
+      continue;
+    }
+    int64_t total_duration = task_group.task_duration_ns_.value.load();
+    deltas[i] = std::max<int64_t>(1, total_duration - task_group.last_tuned_duration_ns_);
+    task_group.last_tuned_duration_ns_ = total_duration;
+    total_delta += deltas[i];
+    active.push_back(i);
+  }
+  if (active.empty()) {
+    return;
+  }
+  for (size_t i : active) {
+    int cap = static_cast<int>(num_concurrent_tasks_ * deltas[i] / total_delta);
+    task_groups_[i].max_in_flight_.value.store(std::max(1, cap));
+  }
+}
+
+Status TaskSchedulerImpl::ScheduleMore(size_t thread_id, int num_tasks_finished,
+                                       int start_task_group) {
   if (aborted_.value.load()) {
     return Status::Cancelled("Scheduler cancelled");
   }
@@ -345,7 +472,12 @@ Status TaskSchedulerImpl::ScheduleMore(size_t thread_id, int num_tasks_finished)
     return Status::OK();
   }
 
-  const auto& tasks = PickTasks(num_new_tasks);
+  // Morsel-driven scheduling: resume picking from the task group that the
+  // caller thread has just been executing.  Tasks of a single group tend to
+  // touch the same buffers, so keeping a thread on its current group until the
+  // group is drained preserves cache and memory locality.  Group priorities
+  // still apply through the rotation order in PickTasks.
+  const auto& tasks = PickTasks(num_new_tasks, start_task_group);
   if (static_cast<int>(tasks.size()) < num_new_tasks) {
     num_tasks_to_schedule_.value += num_new_tasks - static_cast<int>(tasks.size());
   }
@@ -360,33 +492,46 @@ Status TaskSchedulerImpl::ScheduleMore(size_t thread_id, int num_tasks_finished)
     }
   }
 
-  for (size_t i = 0; i < tasks.size(); ++i) {
-    int group_id = tasks[i].first;
-    int64_t task_id = tasks[i].second;
-    RETURN_NOT_OK(schedule_impl_([this, group_id, task_id](size_t thread_id) -> Status {
-      bool task_group_finished = false;
-      // PostExecuteTask must be called later if any error ocurres during task execution
-      // (including ScheduleMore), so we preserve the status.
-      auto status = [&]() {
-        RETURN_NOT_OK(ScheduleMore(thread_id, 1));
-        return ExecuteTask(thread_id, group_id, task_id, &task_group_finished);
-      }();
+  if (schedule_many_impl_ && tasks.size() > 1) {
+    // Hand the whole batch over in one call so that the executor can enqueue
+    // it under a single lock acquisition and wakeup
+    std::vector<TaskGroupContinuationImpl> runners;
+    runners.reserve(tasks.size());
+    for (size_t i = 0; i < tasks.size(); ++i) {
+      runners.push_back(TaskRunner(tasks[i].first, tasks[i].second));
+    }
+    RETURN_NOT_OK(schedule_many_impl_(std::move(runners)));
+  } else {
+    for (size_t i = 0; i < tasks.size(); ++i) {
+      RETURN_NOT_OK(schedule_impl_(TaskRunner(tasks[i].first, tasks[i].second)));
+    }
+  }
 
-      if (!status.ok()) {
-        task_group_finished = PostExecuteTask(thread_id, group_id);
-      }
+  return Status::OK();
+}
 
-      if (task_group_finished) {
-        bool all_task_groups_finished = false;
-        RETURN_NOT_OK(
-            OnTaskGroupFinished(thread_id, group_id, &all_task_groups_finished));
-      }
+TaskScheduler::TaskGroupContinuationImpl TaskSchedulerImpl::TaskRunner(int group_id,
+                                                                       int64_t task_id) {
+  return [this, group_id, task_id](size_t thread_id) -> Status {
+    bool task_group_finished = false;
+    // PostExecuteTask must be called later if any error ocurres during task execution
+    // (including ScheduleMore), so we preserve the status.
+    auto status = [&]() {
+      RETURN_NOT_OK(ScheduleMore(thread_id, 1, group_id));
+      return ExecuteTask(thread_id, group_id, task_id, &task_group_finished);
+    }();
+
+    if (!status.ok()) {
+      task_group_finished = PostExecuteTask(thread_id, group_id);
+    }
 
-      return status;
-    }));
-  }
+    if (task_group_finished) {
+      bool all_task_groups_finished = false;
+      RETURN_NOT_OK(OnTaskGroupFinished(thread_id, group_id, &all_task_groups_finished));
+    }
 
-  return Status::OK();
+    return status;
+  };
 }
 
 void TaskSchedulerImpl::Abort(AbortContinuationImpl impl) {
@@ -60,7 +60,9 @@ class ARROW_ACERO_EXPORT TaskScheduler {
   using TaskImpl = std::function<Status(size_t, int64_t)>;
   using TaskGroupContinuationImpl = std::function<Status(size_t)>;
   using ScheduleImpl = std::function<Status(TaskGroupContinuationImpl)>;
+  using ScheduleManyImpl = std::function<Status(std::vector<TaskGroupContinuationImpl>)>;
   using AbortContinuationImpl = std::function<void()>;
+  using MemoryPressureImpl = std::function<bool()>;
 
   virtual ~TaskScheduler() = default;
 
@@ -85,11 +87,58 @@ class ARROW_ACERO_EXPORT TaskScheduler {
   // Begin scheduling tasks using provided callback and
   // the limit on the number of in-flight tasks at any moment.
   //
+  // Scheduling is morsel-driven: whenever a thread finishes a task it picks
+  // replacement tasks starting from the task group it was just executing, so
+  // that data hot in that thread's caches is processed to completion before
+  // the thread moves on to another group.
+  //
   // Scheduling will continue as long as there are waiting tasks.
   //
   // It will automatically resume whenever new task group gets started.
+  //
+  // If `schedule_many_impl` is provided it is used whenever more than one
+  // task is picked at once, so that the whole batch can be handed to the
+  // executor in a single call (see Executor::SpawnMany) instead of a loop of
+  // individual submissions.
   virtual Status StartScheduling(size_t thread_id, ScheduleImpl schedule_impl,
-                                 int num_concurrent_tasks, bool use_sync_execution) = 0;
+                                 int num_concurrent_tasks, bool use_sync_execution,
+                                 ScheduleManyImpl schedule_many_impl = {}) = 0;
+
+  // Optional callback consulted when picking tasks.  While it returns true the
+  // group priority order is reversed, so that the groups registered last (the
+  // most downstream stages of a plan, which drain accumulated data rather than
+  // admit more) are preferred over the groups registered first.
+  //
+  // Must be called before StartScheduling.
+  virtual void SetMemoryPressureCallback(MemoryPressureImpl memory_pressure_impl) = 0;
+
+  // Runtime counters for a single task group, for observability and tuning.
+  struct TaskGroupStats {
+    int64_t num_tasks_started;
+    int64_t num_tasks_finished;
+    int64_t num_tasks_in_flight;
+    // Total wall-clock time spent executing this group's tasks (only measured
+    // while concurrency auto-tuning is enabled)
+    int64_t total_task_duration_ns;
+    // Current per-group concurrency cap (-1 when unlimited)
+    int concurrency_cap;
+  };
+
+  virtual TaskGroupStats GetTaskGroupStats(int group_id) = 0;
+
+  // Enable feedback-driven tuning of per-group concurrency.
+  //
+  // When enabled the scheduler samples per-group task durations and
+  // periodically re-splits the overall concurrency budget (the
+  // num_concurrent_tasks passed to StartScheduling) between the groups that
+  // still have pending tasks, proportionally to the busy time they recently
+  // accumulated.  A lagging stage (e.g. decode) thereby receives more in-flight
+  // tasks while a stage that barely consumes CPU gives slots back, without
+  // per-query manual tuning.  Every group always keeps at least one slot so no
+  // stage can starve.
+  //
+  // Must be called before StartScheduling.
+  virtual void SetConcurrencyAutoTuning(bool enabled) = 0;
 
   // Abort scheduling and execution.
   // Used in case of being notified about unrecoverable error for the entire query.
@@ -231,6 +231,107 @@ TEST(TaskScheduler, StressTwo) {
   }
 }
 
+TEST(TaskScheduler, AutoTunedConcurrency) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Test requires threading support";
+#endif
+  constexpr int kNumThreads = 8;
+  constexpr int kNumGroups = 2;
+  // Enough tasks to trigger at least one tuning pass (they happen every 64
+  // completions)
+  constexpr int kTasksPerGroup = 256;
+
+  ThreadIndexer thread_indexer;
+  int num_threads = std::min(static_cast<int>(thread_indexer.Capacity()), kNumThreads);
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<ThreadPool> thread_pool,
+                       ThreadPool::Make(num_threads));
+
+  std::atomic<int> final_counter(kNumGroups);
+  std::mutex mutex;
+  std::condition_variable finish_cv;
+
+  std::vector<int> group_ids;
+  auto scheduler = TaskScheduler::Make();
+  // One slow group (the "bottleneck") and one fast group
+  group_ids.push_back(scheduler->RegisterTaskGroup(
+      SlowTaskImpl, MakeFinalContinuation(&final_counter, &mutex, &finish_cv)));
+  group_ids.push_back(scheduler->RegisterTaskGroup(
+      FastTaskImpl, MakeFinalContinuation(&final_counter, &mutex, &finish_cv)));
+  scheduler->SetConcurrencyAutoTuning(true);
+  scheduler->RegisterEnd();
+
+  TaskScheduler::ScheduleImpl schedule =
+      [&](TaskScheduler::TaskGroupContinuationImpl task) {
+        return thread_pool->Spawn([&, task] {
+          std::size_t thread_id = thread_indexer();
+          ASSERT_OK(task(thread_id));
+        });
+      };
+
+  std::unique_lock<std::mutex> lock(mutex);
+  ASSERT_OK(thread_pool->Spawn([&] {
+    std::size_t thread_id = thread_indexer();
+    ASSERT_OK(scheduler->StartScheduling(thread_id, schedule, num_threads * 4, false));
+    for (int group_id : group_ids) {
+      ASSERT_OK(scheduler->StartTaskGroup(thread_id, group_id, kTasksPerGroup));
+    }
+  }));
+
+  finish_cv.wait(lock, [&] { return final_counter.load() == 0; });
+  thread_pool->WaitForIdle();
+
+  for (int group_id : group_ids) {
+    TaskScheduler::TaskGroupStats stats = scheduler->GetTaskGroupStats(group_id);
+    ASSERT_EQ(stats.num_tasks_started, kTasksPerGroup);
+    ASSERT_EQ(stats.num_tasks_finished, kTasksPerGroup);
+    ASSERT_EQ(stats.num_tasks_in_flight, 0);
+    ASSERT_GE(stats.total_task_duration_ns, 0);
+  }
+  // The slow group dominated the observed busy time, so the tuner should have
+  // granted it at least as many slots as the fast group
+  ASSERT_GE(scheduler->GetTaskGroupStats(group_ids[0]).concurrency_cap,
+            scheduler->GetTaskGroupStats(group_ids[1]).concurrency_cap);
+}
+
+TEST(TaskScheduler, MemoryPressurePrefersDownstreamGroups) {
+  constexpr int kNumTasks = 4;
+
+  for (bool under_pressure : {false, true}) {
+    ARROW_SCOPED_TRACE("under_pressure = ", under_pressure);
+    auto scheduler = TaskScheduler::Make();
+
+    std::vector<int> execution_order;
+    auto make_task = [&](int group) {
+      return [&execution_order, group](std::size_t, int64_t) {
+        execution_order.push_back(group);
+        return Status::OK();
+      };
+    };
+    int upstream = scheduler->RegisterTaskGroup(
+        make_task(0), [](std::size_t) { return Status::OK(); });
+    int downstream = scheduler->RegisterTaskGroup(
+        make_task(1), [](std::size_t) { return Status::OK(); });
+    scheduler->SetMemoryPressureCallback([under_pressure]() { return under_pressure; });
+    scheduler->RegisterEnd();
+
+    ASSERT_OK(scheduler->StartTaskGroup(/*thread_id=*/0, upstream, kNumTasks));
+    ASSERT_OK(scheduler->StartTaskGroup(/*thread_id=*/0, downstream, kNumTasks));
+    ASSERT_OK(scheduler->StartScheduling(
+        /*thread_id=*/0,
+        /*schedule_impl=*/
+        [](TaskScheduler::TaskGroupContinuationImpl) { return Status::OK(); },
+        /*num_concurrent_tasks=*/1, /*use_sync_execution=*/true));
+
+    // Without pressure the first registered group runs first; with pressure the
+    // priority order is reversed and the last registered group is drained first.
+    ASSERT_EQ(execution_order.size(), static_cast<size_t>(2 * kNumTasks));
+    int preferred_group = under_pressure ? 1 : 0;
+    for (int i = 0; i < kNumTasks; ++i) {
+      EXPECT_EQ(execution_order[i], preferred_group);
+    }
+  }
+}
+
 TEST(TaskScheduler, AbortContOnTaskErrorSerial) {
   constexpr int kNumTasks = 16;
 
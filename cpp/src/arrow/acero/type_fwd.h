@@ -30,6 +30,7 @@ class ExecFactoryRegistry;
 class QueryContext;
 struct QueryOptions;
 struct Declaration;
+struct NodeStatistics;
 class SinkNodeConsumer;
 
 }  // namespace acero
@@ -22,6 +22,7 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/metrics.h"
 #include "arrow/util/tracing_internal.h"
 #include "arrow/util/ubsan.h"
 
@@ -114,6 +115,8 @@ void TracedNode::NoteStartProducing(std::string extra_details) const {
 
 [[nodiscard]] ::arrow::internal::tracing::Scope TracedNode::TraceInputReceived(
     const ExecBatch& batch) const {
+  ARROW_METRIC_COUNTER_ADD("acero.node.batches_received", 1);
+  ARROW_METRIC_COUNTER_ADD("acero.node.rows_received", batch.length);
   std::string node_kind(node_->kind_name());
   arrow::util::tracing::Span span;
   return START_SCOPED_SPAN(
@@ -122,6 +125,8 @@ void TracedNode::NoteStartProducing(std::string extra_details) const {
 }
 
 void TracedNode::NoteInputReceived(const ExecBatch& batch) const {
+  ARROW_METRIC_COUNTER_ADD("acero.node.batches_received", 1);
+  ARROW_METRIC_COUNTER_ADD("acero.node.rows_received", batch.length);
   std::string node_kind(node_->kind_name());
   EVENT_ON_CURRENT_SPAN(
       node_kind + "::InputReceived",
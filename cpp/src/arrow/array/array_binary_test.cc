@@ -663,6 +663,76 @@ class TestStringBuilder : public ::testing::Test {
     CheckStringArray(*result_, strings, valid_bytes, reps);
   }
 
+  void TestPackedAppend() {
+    // Values laid out back to back with parser-style offsets, including a
+    // null ("", valid bit cleared) with an empty extent
+    const std::string values = "bbaccc";
+    std::vector<offset_type> offsets = {0, 0, 2, 3, 3, 6};
+    std::vector<std::string> strings = {"", "bb", "a", "", "ccc"};
+    std::vector<uint8_t> is_valid = {1, 1, 1, 0, 1};
+
+    int N = static_cast<int>(strings.size());
+    int reps = 1000;
+
+    std::shared_ptr<Buffer> valid_bitmap;
+    ASSERT_OK_AND_ASSIGN(valid_bitmap, internal::BytesToBits(is_valid));
+
+    // Start from a non-empty builder so the offsets need rebasing
+    ASSERT_OK(builder_->Append("prefix"));
+    for (int j = 0; j < reps; ++j) {
+      ASSERT_OK(builder_->AppendValues(reinterpret_cast<const uint8_t*>(values.data()),
+                                       offsets.data(), N, valid_bitmap->data(),
+                                       /*valid_bits_offset=*/0));
+    }
+    Done();
+
+    ASSERT_EQ(reps * N + 1, result_->length());
+    ASSERT_EQ(reps, result_->null_count());
+    ASSERT_EQ(reps * 6 + 6, result_->value_data()->size());
+
+    ASSERT_EQ("prefix", result_->GetString(0));
+    for (int j = 0; j < reps; ++j) {
+      for (int i = 0; i < N; ++i) {
+        const int64_t pos = 1 + j * N + i;
+        if (is_valid[i]) {
+          ASSERT_EQ(strings[i], result_->GetString(pos));
+        } else {
+          ASSERT_TRUE(result_->IsNull(pos));
+        }
+      }
+    }
+  }
+
+  void TestPackedAppendUnsafe() {
+    const std::string values = "bbaccc";
+    std::vector<offset_type> offsets = {0, 0, 2, 3, 3, 6};
+    std::vector<std::string> strings = {"", "bb", "a", "", "ccc"};
+    std::vector<uint8_t> is_valid = {1, 1, 1, 0, 1};
+
+    int N = static_cast<int>(strings.size());
+    int reps = 13;
+
+    std::shared_ptr<Buffer> valid_bitmap;
+    ASSERT_OK_AND_ASSIGN(valid_bitmap, internal::BytesToBits(is_valid));
+
+    ASSERT_OK(builder_->Reserve(N * reps));
+    ASSERT_OK(builder_->ReserveData(static_cast<int64_t>(values.size()) * reps));
+
+    for (int j = 0; j < reps; ++j) {
+      builder_->UnsafeAppendValues(reinterpret_cast<const uint8_t*>(values.data()),
+                                   offsets.data(), N, valid_bitmap->data(),
+                                   /*valid_bits_offset=*/0);
+    }
+    ASSERT_EQ(builder_->value_data_length(), static_cast<int64_t>(values.size()) * reps);
+    Done();
+
+    ASSERT_EQ(reps * N, result_->length());
+    ASSERT_EQ(reps, result_->null_count());
+    ASSERT_EQ(reps * 6, result_->value_data()->size());
+
+    CheckStringArray(*result_, strings, is_valid, reps);
+  }
+
   void TestAppendCStringsWithValidBytes() {
     const char* strings[] = {nullptr, "aaa", nullptr, "ignored", ""};
     std::vector<uint8_t> valid_bytes = {1, 1, 1, 0, 1};
@@ -788,6 +858,12 @@ TYPED_TEST(TestStringBuilder, TestExtendCurrentUnsafe) {
 
 TYPED_TEST(TestStringBuilder, TestVectorAppend) { this->TestVectorAppend(); }
 
+TYPED_TEST(TestStringBuilder, TestPackedAppend) { this->TestPackedAppend(); }
+
+TYPED_TEST(TestStringBuilder, TestPackedAppendUnsafe) {
+  this->TestPackedAppendUnsafe();
+}
+
 TYPED_TEST(TestStringBuilder, TestAppendCStringsWithValidBytes) {
   this->TestAppendCStringsWithValidBytes();
 }
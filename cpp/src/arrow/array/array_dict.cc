@@ -341,6 +341,18 @@ Result<std::shared_ptr<Array>> DictionaryArray::Compact(MemoryPool* pool) const
 
 namespace {
 
+// Detect types whose memo table is a ScalarMemoTable over the raw c_type,
+// i.e. those whose dictionaries can be hashed a batch at a time with
+// ComputeHashBatch before probing
+template <typename T, typename Enable = void>
+struct is_batch_unifiable : std::false_type {};
+
+template <typename T>
+struct is_batch_unifiable<
+    T, enable_if_t<std::is_same<typename internal::DictionaryTraits<T>::MemoTableType,
+                                internal::ScalarMemoTable<typename T::c_type>>::value>>
+    : std::true_type {};
+
 template <typename T>
 class DictionaryUnifierImpl : public DictionaryUnifier {
  public:
@@ -364,14 +376,22 @@ class DictionaryUnifierImpl : public DictionaryUnifier {
       ARROW_ASSIGN_OR_RAISE(auto result,
                             AllocateBuffer(dictionary.length() * sizeof(int32_t), pool_));
       auto result_raw = reinterpret_cast<int32_t*>(result->mutable_data());
-      for (int64_t i = 0; i < values.length(); ++i) {
-        RETURN_NOT_OK(memo_table_.GetOrInsert(values.GetView(i), &result_raw[i]));
+      if constexpr (is_batch_unifiable<T>::value) {
+        RETURN_NOT_OK(UnifyBatched(values, result_raw));
+      } else {
+        for (int64_t i = 0; i < values.length(); ++i) {
+          RETURN_NOT_OK(memo_table_.GetOrInsert(values.GetView(i), &result_raw[i]));
+        }
       }
       *out = std::move(result);
     } else {
-      for (int64_t i = 0; i < values.length(); ++i) {
-        int32_t unused_memo_index;
-        RETURN_NOT_OK(memo_table_.GetOrInsert(values.GetView(i), &unused_memo_index));
+      if constexpr (is_batch_unifiable<T>::value) {
+        return UnifyBatched(values, /*result_raw=*/nullptr);
+      } else {
+        for (int64_t i = 0; i < values.length(); ++i) {
+          int32_t unused_memo_index;
+          RETURN_NOT_OK(memo_table_.GetOrInsert(values.GetView(i), &unused_memo_index));
+        }
       }
     }
     return Status::OK();
@@ -421,6 +441,28 @@ class DictionaryUnifierImpl : public DictionaryUnifier {
   }
 
  private:
+  // Unify fixed-width values by hashing a mini-batch at a time, so the hash
+  // loop vectorizes instead of re-deriving each hash inside the table probe.
+  // The transpose map entries come straight from the returned memo indices.
+  Status UnifyBatched(const ArrayType& values, int32_t* result_raw) {
+    using CType = typename T::c_type;
+    const CType* data = values.data()->template GetValues<CType>(1);
+    constexpr int64_t kHashBatchSize = 512;
+    internal::hash_t hashes[kHashBatchSize];
+    for (int64_t start = 0; start < values.length(); start += kHashBatchSize) {
+      const int64_t batch_size = std::min(kHashBatchSize, values.length() - start);
+      internal::ComputeHashBatch(data + start, batch_size, hashes);
+      for (int64_t i = 0; i < batch_size; ++i) {
+        int32_t memo_index;
+        RETURN_NOT_OK(memo_table_.GetOrInsert(data[start + i], hashes[i], &memo_index));
+        if (result_raw != nullptr) {
+          result_raw[start + i] = memo_index;
+        }
+      }
+    }
+    return Status::OK();
+  }
+
   MemoryPool* pool_;
   std::shared_ptr<DataType> value_type_;
   MemoTableType memo_table_;
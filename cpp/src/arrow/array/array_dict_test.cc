@@ -459,6 +459,54 @@ void TestStringDictionaryAppendIndices() {
   ASSERT_TRUE(expected.Equals(result));
 }
 
+TEST(TestStringDictionaryBuilder, FrozenDictionary) {
+  auto dict_array = ArrayFromJSON(utf8(), R"(["US", "EU", "APAC"])");
+
+  // Seed with the known vocabulary, then freeze: appends resolve to indices
+  // by lookup only and the dictionary no longer grows
+  StringDictionaryBuilder builder(dict_array);
+  builder.FreezeDictionary();
+  ASSERT_TRUE(builder.is_frozen());
+
+  ASSERT_OK(builder.Append("EU"));
+  ASSERT_OK(builder.Append("US"));
+  ASSERT_OK(builder.AppendNull());
+  ASSERT_OK(builder.Append("APAC"));
+
+  // Unknown values raise by default
+  ASSERT_RAISES(KeyError, builder.Append("LATAM"));
+
+  std::shared_ptr<Array> result;
+  ASSERT_OK(builder.Finish(&result));
+
+  auto ex_indices = ArrayFromJSON(int8(), "[1, 0, null, 2]");
+  DictionaryArray expected(dictionary(int8(), utf8()), ex_indices, dict_array);
+  AssertArraysEqual(expected, *result);
+}
+
+TEST(TestStringDictionaryBuilder, FrozenDictionaryAppendNullPolicy) {
+  auto dict_array = ArrayFromJSON(utf8(), R"(["US", "EU", "APAC"])");
+
+  StringDictionaryBuilder builder(dict_array);
+  builder.FreezeDictionary(DictionaryUnknownValuePolicy::APPEND_NULL);
+
+  ASSERT_OK(builder.Append("EU"));
+  ASSERT_OK(builder.Append("LATAM"));
+  ASSERT_OK(builder.Append("APAC"));
+
+  std::shared_ptr<Array> result;
+  ASSERT_OK(builder.Finish(&result));
+
+  auto ex_indices = ArrayFromJSON(int8(), "[1, null, 2]");
+  DictionaryArray expected(dictionary(int8(), utf8()), ex_indices, dict_array);
+  AssertArraysEqual(expected, *result);
+
+  // ResetFull discards the dictionary and unfreezes the builder
+  builder.ResetFull();
+  ASSERT_FALSE(builder.is_frozen());
+  ASSERT_OK(builder.Append("LATAM"));
+}
+
 TEST(TestStringDictionaryBuilder, AppendIndices) {
   // Currently AdaptiveIntBuilder only accepts int64_t in bulk appends
   TestStringDictionaryAppendIndices<StringDictionaryBuilder, Int8Type, int64_t>();
@@ -321,6 +321,36 @@ TEST_F(TestArray, TestNullArrayEquality) {
   EXPECT_FALSE(array_1->Equals(array_3));
 }
 
+TEST_F(TestArray, GetContentHash) {
+  auto array = ArrayFromJSON(int32(), "[1, 2, 3, 4, 5]");
+  auto equal_array = ArrayFromJSON(int32(), "[1, 2, 3, 4, 5]");
+  auto unequal_array = ArrayFromJSON(int32(), "[1, 2, 3, 4, 6]");
+
+  const uint64_t hash = array->data()->GetContentHash();
+  ASSERT_NE(0, hash);
+  // Memoized
+  ASSERT_EQ(hash, array->data()->GetContentHash());
+  ASSERT_EQ(hash, equal_array->data()->GetContentHash());
+  ASSERT_NE(hash, unequal_array->data()->GetContentHash());
+
+  // The hash depends on the logical contents, not the slicing offset
+  auto sliced = ArrayFromJSON(int32(), "[0, 1, 2, 3, 4, 5, 6]")->Slice(1, 5);
+  ASSERT_EQ(hash, sliced->data()->GetContentHash());
+
+  // Binary-like arrays hash element boundaries, not just the value bytes
+  auto binary = ArrayFromJSON(utf8(), R"(["ab", "c"])");
+  auto binary_shifted = ArrayFromJSON(utf8(), R"(["a", "bc"])");
+  ASSERT_NE(0, binary->data()->GetContentHash());
+  ASSERT_NE(binary->data()->GetContentHash(), binary_shifted->data()->GetContentHash());
+  auto binary_sliced = ArrayFromJSON(utf8(), R"(["x", "ab", "c", "y"])")->Slice(1, 2);
+  ASSERT_EQ(binary->data()->GetContentHash(), binary_sliced->data()->GetContentHash());
+
+  // No hash for nulls, floating point or non-byte-aligned layouts
+  ASSERT_EQ(0, ArrayFromJSON(int32(), "[1, null]")->data()->GetContentHash());
+  ASSERT_EQ(0, ArrayFromJSON(float64(), "[1.5]")->data()->GetContentHash());
+  ASSERT_EQ(0, ArrayFromJSON(boolean(), "[true]")->data()->GetContentHash());
+}
+
 TEST_F(TestArray, SliceRecomputeNullCount) {
   std::vector<uint8_t> valid_bytes = {1, 0, 1, 1, 0, 1, 0, 0, 0};
 
@@ -3852,6 +3882,80 @@ TEST(TestSwapEndianArrayData, InvalidLength) {
   }
 }
 
+TEST(TestArrayDataCow, IsExclusivelyOwned) {
+  auto arr = ArrayFromJSON(int32(), "[1, 2, null, 4]");
+  std::shared_ptr<ArrayData> data = arr->data();
+  // The Array still references the ArrayData
+  ASSERT_FALSE(IsExclusivelyOwned(data));
+  arr.reset();
+  ASSERT_TRUE(IsExclusivelyOwned(data));
+
+  // An extra reference to any buffer breaks exclusivity
+  std::shared_ptr<Buffer> buffer_ref = data->buffers[1];
+  ASSERT_FALSE(IsExclusivelyOwned(data));
+  buffer_ref.reset();
+  ASSERT_TRUE(IsExclusivelyOwned(data));
+
+  // ... as does a reference to a child of a nested array
+  auto list_arr = ArrayFromJSON(list(int32()), "[[1, 2], [3]]");
+  std::shared_ptr<ArrayData> list_data = list_arr->data();
+  list_arr.reset();
+  ASSERT_TRUE(IsExclusivelyOwned(list_data));
+  std::shared_ptr<ArrayData> child_ref = list_data->child_data[0];
+  ASSERT_FALSE(IsExclusivelyOwned(list_data));
+}
+
+TEST(TestArrayDataCow, MakeMutable) {
+  auto arr = ArrayFromJSON(int32(), "[1, 2, null, 4]");
+  std::shared_ptr<ArrayData> data = arr->data();
+
+  // Shared: the buffers are copied, the original array is left untouched
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<ArrayData> mutable_data, MakeMutable(data));
+  ASSERT_TRUE(IsExclusivelyOwned(mutable_data));
+  ASSERT_NE(mutable_data->buffers[1]->data(), data->buffers[1]->data());
+  AssertArraysEqual(*arr, *MakeArray(mutable_data));
+
+  // Exclusive: passes through without copying
+  arr.reset();
+  const uint8_t* values = data->buffers[1]->data();
+  ASSERT_OK_AND_ASSIGN(mutable_data, MakeMutable(std::move(data)));
+  ASSERT_EQ(values, mutable_data->buffers[1]->data());
+}
+
+TEST(TestArrayDataPool, Recycling) {
+  auto pool = ArrayDataPool::Make(/*max_cached=*/2);
+  ASSERT_EQ(pool->num_cached(), 0);
+
+  auto data = pool->MakeArrayData(int32(), /*length=*/4);
+  ASSERT_EQ(data->length, 4);
+  ASSERT_TRUE(data->buffers.empty());
+  data->buffers.resize(2);
+  ASSERT_OK_AND_ASSIGN(data->buffers[1], AllocateBuffer(4 * sizeof(int32_t)));
+
+  // Returning the instance drops its contents and caches it for reuse
+  ArrayData* raw = data.get();
+  data.reset();
+  ASSERT_EQ(pool->num_cached(), 1);
+  auto recycled = pool->MakeArrayData(int64(), /*length=*/8);
+  ASSERT_EQ(recycled.get(), raw);
+  ASSERT_EQ(recycled->length, 8);
+  ASSERT_TRUE(recycled->buffers.empty());
+  ASSERT_EQ(pool->num_cached(), 0);
+
+  // The cache is bounded: excess returns are freed
+  auto d1 = pool->MakeArrayData(int32(), 1);
+  auto d2 = pool->MakeArrayData(int32(), 1);
+  d1.reset();
+  d2.reset();
+  recycled.reset();
+  ASSERT_EQ(pool->num_cached(), 2);
+
+  // Handed-out instances may outlive the pool
+  auto survivor = pool->MakeArrayData(int32(), 1);
+  pool.reset();
+  survivor.reset();
+}
+
 class TestArrayDataStatistics : public ::testing::Test {
  public:
   void SetUp() {
@@ -283,6 +283,47 @@ class BaseBinaryBuilder
     return Status::OK();
   }
 
+  /// \brief Append a packed sequence of values in one shot
+  ///
+  /// The i-th appended value spans values[offsets[i], offsets[i + 1]), so
+  /// offsets must hold length + 1 monotonically non-decreasing entries.
+  /// This is the layout parsers naturally produce: the value data is
+  /// reserved once and copied with a single memcpy, only the offsets are
+  /// rebased onto the builder's current data length.
+  ///
+  /// \param[in] values a contiguous buffer of packed value data
+  /// \param[in] offsets value boundaries within values, length + 1 entries
+  /// \param[in] length the number of values to append
+  /// \param[in] valid_bits an optional validity bitmap to copy (null values
+  /// should have empty extents in offsets)
+  /// \param[in] valid_bits_offset an offset into the validity bitmap
+  /// \return Status
+  Status AppendValues(const uint8_t* values, const offset_type* offsets, int64_t length,
+                      const uint8_t* valid_bits = NULLPTR,
+                      int64_t valid_bits_offset = 0) {
+    const int64_t total_length = offsets[length] - offsets[0];
+    ARROW_RETURN_NOT_OK(Reserve(length));
+    ARROW_RETURN_NOT_OK(ReserveData(total_length));
+    UnsafeAppendValues(values, offsets, length, valid_bits, valid_bits_offset);
+    return Status::OK();
+  }
+
+  /// \brief Append a packed sequence of values without checking capacity
+  ///
+  /// Offsets and data should have been presized using Reserve() and
+  /// ReserveData(), respectively, and the offsets validated by the caller.
+  void UnsafeAppendValues(const uint8_t* values, const offset_type* offsets,
+                          int64_t length, const uint8_t* valid_bits = NULLPTR,
+                          int64_t valid_bits_offset = 0) {
+    const offset_type base =
+        static_cast<offset_type>(value_data_builder_.length()) - offsets[0];
+    for (int64_t i = 0; i < length; ++i) {
+      offsets_builder_.UnsafeAppend(base + offsets[i]);
+    }
+    value_data_builder_.UnsafeAppend(values + offsets[0], offsets[length] - offsets[0]);
+    UnsafeAppendToBitmap(valid_bits, valid_bits_offset, length);
+  }
+
   Status AppendArraySlice(const ArraySpan& array, int64_t offset,
                           int64_t length) override {
     auto bitmap = array.GetValues<uint8_t>(0, 0);
@@ -17,7 +17,9 @@
 
 #include "arrow/array/builder_dict.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <type_traits>
 #include <utility>
 
 #include "arrow/array/dict_internal.h"
@@ -36,6 +38,22 @@ namespace arrow {
 
 namespace internal {
 
+namespace {
+
+// Detect types whose memo table is a ScalarMemoTable over the raw c_type,
+// i.e. those whose values can be hashed a batch at a time with
+// ComputeHashBatch before probing
+template <typename T, typename Enable = void>
+struct is_batch_hashable : std::false_type {};
+
+template <typename T>
+struct is_batch_hashable<
+    T, enable_if_t<std::is_same<typename DictionaryTraits<T>::MemoTableType,
+                                ScalarMemoTable<typename T::c_type>>::value>>
+    : std::true_type {};
+
+}  // namespace
+
 class DictionaryMemoTable::DictionaryMemoTableImpl {
   // Type-dependent visitor for memo table initialization
   struct MemoTableInitializer {
@@ -80,6 +98,9 @@ class DictionaryMemoTable::DictionaryMemoTableImpl {
       if (array.null_count() > 0) {
         return Status::Invalid("Cannot insert dictionary values containing nulls");
       }
+      if constexpr (is_batch_hashable<T>::value) {
+        return impl_->InsertValuesBatched<T>(array);
+      }
       for (int64_t i = 0; i < array.length(); ++i) {
         int32_t unused_memo_index;
         RETURN_NOT_OK(impl_->GetOrInsert<T>(array.GetView(i), &unused_memo_index));
@@ -135,6 +156,35 @@ class DictionaryMemoTable::DictionaryMemoTableImpl {
     return checked_cast<ConcreteMemoTable*>(memo_table_.get())->GetOrInsert(value, out);
   }
 
+  // Insert fixed-width values by hashing a mini-batch at a time, so the hash
+  // loop vectorizes instead of re-deriving each hash inside the table probe
+  template <typename PhysicalType, typename ArrayType>
+  Status InsertValuesBatched(const ArrayType& array) {
+    using CType = typename PhysicalType::c_type;
+    using ConcreteMemoTable = typename DictionaryTraits<PhysicalType>::MemoTableType;
+    auto* table = checked_cast<ConcreteMemoTable*>(memo_table_.get());
+    const CType* values = array.data()->template GetValues<CType>(1);
+    constexpr int64_t kHashBatchSize = 512;
+    hash_t hashes[kHashBatchSize];
+    for (int64_t start = 0; start < array.length(); start += kHashBatchSize) {
+      const int64_t batch_size = std::min(kHashBatchSize, array.length() - start);
+      ComputeHashBatch(values + start, batch_size, hashes);
+      for (int64_t i = 0; i < batch_size; ++i) {
+        int32_t unused_memo_index;
+        RETURN_NOT_OK(
+            table->GetOrInsert(values[start + i], hashes[i], &unused_memo_index));
+      }
+    }
+    return Status::OK();
+  }
+
+  template <typename PhysicalType,
+            typename CType = typename DictionaryValue<PhysicalType>::type>
+  int32_t Get(CType value) const {
+    using ConcreteMemoTable = typename DictionaryTraits<PhysicalType>::MemoTableType;
+    return checked_cast<const ConcreteMemoTable*>(memo_table_.get())->Get(value);
+  }
+
   Status GetArrayData(int64_t start_offset, std::shared_ptr<ArrayData>* out) {
     ArrayDataGetter visitor{type_, memo_table_.get(), pool_, start_offset, out};
     return VisitTypeInline(*type_, &visitor);
@@ -205,6 +255,51 @@ Status DictionaryMemoTable::GetOrInsert(const LargeBinaryType*, std::string_view
   return impl_->GetOrInsert<LargeBinaryType>(value, out);
 }
 
+static_assert(DictionaryMemoTable::kKeyNotFound == kKeyNotFound,
+              "DictionaryMemoTable::kKeyNotFound must match the memo table sentinel");
+
+#define GET(ARROW_TYPE)                                                        \
+  int32_t DictionaryMemoTable::Get(const ARROW_TYPE*,                         \
+                                   typename ARROW_TYPE::c_type value) const { \
+    return impl_->Get<ARROW_TYPE>(value);                                     \
+  }
+
+GET(BooleanType)
+GET(Int8Type)
+GET(Int16Type)
+GET(Int32Type)
+GET(Int64Type)
+GET(UInt8Type)
+GET(UInt16Type)
+GET(UInt32Type)
+GET(UInt64Type)
+GET(FloatType)
+GET(DoubleType)
+GET(DurationType)
+GET(TimestampType)
+GET(Date32Type)
+GET(Date64Type)
+GET(Time32Type)
+GET(Time64Type)
+GET(MonthDayNanoIntervalType)
+GET(DayTimeIntervalType)
+GET(MonthIntervalType)
+
+#undef GET
+
+int32_t DictionaryMemoTable::Get(const BinaryType*, std::string_view value) const {
+  return impl_->Get<BinaryType>(value);
+}
+
+int32_t DictionaryMemoTable::Get(const BinaryViewType*, std::string_view value) const {
+  // The dictionary is memoized as a BinaryArray (see GetOrInsert above)
+  return impl_->Get<BinaryType>(value);
+}
+
+int32_t DictionaryMemoTable::Get(const LargeBinaryType*, std::string_view value) const {
+  return impl_->Get<LargeBinaryType>(value);
+}
+
 Status DictionaryMemoTable::GetArrayData(int64_t start_offset,
                                          std::shared_ptr<ArrayData>* out) {
   return impl_->GetArrayData(start_offset, out);
@@ -85,6 +85,9 @@ class ARROW_EXPORT DictionaryMemoTable {
 
   int32_t size() const;
 
+  /// \brief The index returned by Get for values absent from the memo
+  static constexpr int32_t kKeyNotFound = -1;
+
   template <typename T>
   Status GetOrInsert(typename DictionaryValue<T>::type value, int32_t* out) {
     // We want to keep the DictionaryMemoTable implementation private, also we can't
@@ -94,6 +97,15 @@ class ARROW_EXPORT DictionaryMemoTable {
     return GetOrInsert(physical_type, value, out);
   }
 
+  /// \brief Look up a value without inserting it
+  ///
+  /// Returns kKeyNotFound if the value is absent from the memo.
+  template <typename T>
+  int32_t Get(typename DictionaryValue<T>::type value) const {
+    const typename DictionaryValue<T>::PhysicalType* physical_type = NULLPTR;
+    return Get(physical_type, value);
+  }
+
  private:
   Status GetOrInsert(const BooleanType*, bool value, int32_t* out);
   Status GetOrInsert(const Int8Type*, int8_t value, int32_t* out);
@@ -122,6 +134,33 @@ class ARROW_EXPORT DictionaryMemoTable {
   Status GetOrInsert(const LargeBinaryType*, std::string_view value, int32_t* out);
   Status GetOrInsert(const BinaryViewType*, std::string_view value, int32_t* out);
 
+  int32_t Get(const BooleanType*, bool value) const;
+  int32_t Get(const Int8Type*, int8_t value) const;
+  int32_t Get(const Int16Type*, int16_t value) const;
+  int32_t Get(const Int32Type*, int32_t value) const;
+  int32_t Get(const Int64Type*, int64_t value) const;
+  int32_t Get(const UInt8Type*, uint8_t value) const;
+  int32_t Get(const UInt16Type*, uint16_t value) const;
+  int32_t Get(const UInt32Type*, uint32_t value) const;
+  int32_t Get(const UInt64Type*, uint64_t value) const;
+  int32_t Get(const DurationType*, int64_t value) const;
+  int32_t Get(const TimestampType*, int64_t value) const;
+  int32_t Get(const Date32Type*, int32_t value) const;
+  int32_t Get(const Date64Type*, int64_t value) const;
+  int32_t Get(const Time32Type*, int32_t value) const;
+  int32_t Get(const Time64Type*, int64_t value) const;
+  int32_t Get(const MonthDayNanoIntervalType*,
+              MonthDayNanoIntervalType::MonthDayNanos value) const;
+  int32_t Get(const DayTimeIntervalType*,
+              DayTimeIntervalType::DayMilliseconds value) const;
+  int32_t Get(const MonthIntervalType*, int32_t value) const;
+  int32_t Get(const FloatType*, float value) const;
+  int32_t Get(const DoubleType*, double value) const;
+
+  int32_t Get(const BinaryType*, std::string_view value) const;
+  int32_t Get(const LargeBinaryType*, std::string_view value) const;
+  int32_t Get(const BinaryViewType*, std::string_view value) const;
+
   class DictionaryMemoTableImpl;
   std::unique_ptr<DictionaryMemoTableImpl> impl_;
 };
@@ -132,6 +171,15 @@ class ARROW_EXPORT DictionaryMemoTable {
 ///
 /// @{
 
+/// \brief Policy applied by a frozen dictionary builder to values that are
+/// absent from the dictionary
+enum class DictionaryUnknownValuePolicy : int8_t {
+  /// Raise a KeyError on the offending Append call
+  RAISE_ERROR,
+  /// Append a null in place of the unknown value
+  APPEND_NULL
+};
+
 namespace internal {
 
 /// \brief Array builder for created encoded DictionaryArray from
@@ -256,12 +304,40 @@ class DictionaryBuilderBase : public ArrayBuilder {
     return byte_width_;
   }
 
+  /// \brief Freeze the current dictionary contents
+  ///
+  /// Subsequent appends resolve values to indices by lookup only; the
+  /// dictionary no longer grows and values absent from it are handled
+  /// according to the given policy.  Typically used after seeding the
+  /// builder with a known vocabulary, either through the constructor
+  /// taking a dictionary array or through InsertMemoValues().
+  ///
+  /// ResetFull() discards the dictionary and unfreezes the builder.
+  void FreezeDictionary(DictionaryUnknownValuePolicy policy =
+                            DictionaryUnknownValuePolicy::RAISE_ERROR) {
+    frozen_ = true;
+    unknown_value_policy_ = policy;
+  }
+
+  /// \brief Whether the dictionary is frozen
+  bool is_frozen() const { return frozen_; }
+
   /// \brief Append a scalar value
   Status Append(Value value) {
     ARROW_RETURN_NOT_OK(Reserve(1));
 
     int32_t memo_index;
-    ARROW_RETURN_NOT_OK(memo_table_->GetOrInsert<T>(value, &memo_index));
+    if (ARROW_PREDICT_FALSE(frozen_)) {
+      memo_index = memo_table_->Get<T>(value);
+      if (memo_index == internal::DictionaryMemoTable::kKeyNotFound) {
+        if (unknown_value_policy_ == DictionaryUnknownValuePolicy::APPEND_NULL) {
+          return AppendNull();
+        }
+        return Status::KeyError("Value not in frozen dictionary");
+      }
+    } else {
+      ARROW_RETURN_NOT_OK(memo_table_->GetOrInsert<T>(value, &memo_index));
+    }
     ARROW_RETURN_NOT_OK(indices_builder_.Append(memo_index));
     length_ += 1;
 
@@ -456,10 +532,12 @@ class DictionaryBuilderBase : public ArrayBuilder {
     indices_builder_.Reset();
   }
 
-  /// \brief Reset and also clear accumulated dictionary values in memo table
+  /// \brief Reset and also clear accumulated dictionary values in memo table,
+  /// unfreezing the dictionary if it was frozen
   void ResetFull() {
     Reset();
     memo_table_.reset(new internal::DictionaryMemoTable(pool_, value_type_));
+    frozen_ = false;
   }
 
   Status Resize(int64_t capacity) override {
@@ -559,6 +637,11 @@ class DictionaryBuilderBase : public ArrayBuilder {
   // Only used for FixedSizeBinaryType
   int32_t byte_width_;
 
+  // When frozen, appends look up indices without growing the dictionary
+  bool frozen_ = false;
+  DictionaryUnknownValuePolicy unknown_value_policy_ =
+      DictionaryUnknownValuePolicy::RAISE_ERROR;
+
   BuilderType indices_builder_;
   std::shared_ptr<DataType> value_type_;
 };
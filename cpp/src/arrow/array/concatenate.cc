@@ -54,6 +54,58 @@ namespace arrow {
 using internal::SafeSignedAdd;
 
 namespace {
+
+/// \brief Try to concatenate without copying.
+///
+/// When every input is a slice of the same parent data laid out back to back
+/// (a common situation after splitting an array for parallel processing),
+/// concatenation is equivalent to re-slicing the parent: only the logical
+/// offset and length change, all buffers and child data are shared as-is.
+///
+/// Returns nullptr when the inputs are not recognized as contiguous slices,
+/// in which case the copying path must be taken.
+std::shared_ptr<ArrayData> TryConcatenateAsView(const ArrayDataVector& data) {
+  const auto& first = data[0];
+  int64_t total_length = first->length;
+  for (size_t i = 1; i < data.size(); ++i) {
+    const auto& prev = data[i - 1];
+    const auto& curr = data[i];
+    if (curr->offset != prev->offset + prev->length) {
+      return nullptr;
+    }
+    if (curr->buffers.size() != first->buffers.size() ||
+        curr->child_data.size() != first->child_data.size() ||
+        curr->dictionary != first->dictionary) {
+      return nullptr;
+    }
+    for (size_t b = 0; b < first->buffers.size(); ++b) {
+      if (curr->buffers[b] != first->buffers[b]) {
+        return nullptr;
+      }
+    }
+    for (size_t c = 0; c < first->child_data.size(); ++c) {
+      if (curr->child_data[c] != first->child_data[c]) {
+        return nullptr;
+      }
+    }
+    // No overflow: the summed length is bounded by the parent's length
+    total_length += curr->length;
+  }
+  int64_t null_count = 0;
+  for (const auto& d : data) {
+    const int64_t chunk_null_count = d->null_count.load();
+    if (chunk_null_count == kUnknownNullCount) {
+      null_count = kUnknownNullCount;
+      break;
+    }
+    null_count += chunk_null_count;
+  }
+  auto out = first->Copy();
+  out->length = total_length;
+  out->null_count = null_count;
+  return out;
+}
+
 /// offset, length pair for representing a Range of a buffer or array
 struct Range {
   int64_t offset = -1, length = 0;
@@ -938,6 +990,11 @@ Result<std::shared_ptr<Array>> Concatenate(
     data[i] = arrays[i]->data();
   }
 
+  // Zero-copy fast path: contiguous slices of a common parent
+  if (auto view = TryConcatenateAsView(data)) {
+    return MakeArray(std::move(view));
+  }
+
   std::shared_ptr<ArrayData> out_data;
   ErrorHints hints;
   auto status = ConcatenateImpl(data, pool).Concatenate(&out_data, &hints);
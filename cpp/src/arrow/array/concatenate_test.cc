@@ -220,11 +220,16 @@ class ConcatenateTest : public ::testing::Test {
         ASSERT_OK_AND_ASSIGN(auto actual, Concatenate(slices));
         ASSERT_OK(actual->ValidateFull());
         AssertArraysEqual(*expected, *actual);
-        if (actual->data()->buffers[0]) {
-          CheckTrailingBitsAreZeroed(actual->data()->buffers[0], actual->length());
-        }
-        if (actual->type_id() == Type::BOOL) {
-          CheckTrailingBitsAreZeroed(actual->data()->buffers[1], actual->length());
+        // Contiguous slices of a common parent are concatenated zero-copy:
+        // the result then shares the input buffers and the trailing-bit
+        // hygiene checks below only apply to materialized results.
+        if (actual->data()->buffers != array->data()->buffers) {
+          if (actual->data()->buffers[0]) {
+            CheckTrailingBitsAreZeroed(actual->data()->buffers[0], actual->length());
+          }
+          if (actual->type_id() == Type::BOOL) {
+            CheckTrailingBitsAreZeroed(actual->data()->buffers[1], actual->length());
+          }
         }
       }
     }
@@ -261,6 +266,27 @@ TYPED_TEST(PrimitiveConcatenateTest, Primitives) {
   });
 }
 
+TEST_F(ConcatenateTest, ZeroCopyFromContiguousSlices) {
+  auto array = ArrayFromJSON(int32(), "[1, null, 3, 4, 5, null, 7, 8]");
+
+  // Contiguous slices of one parent are recombined without copying
+  ASSERT_OK_AND_ASSIGN(auto combined, Concatenate({array->Slice(0, 3), array->Slice(3, 2),
+                                                   array->Slice(5)}));
+  AssertArraysEqual(*array, *combined);
+  ASSERT_EQ(combined->data()->buffers[1], array->data()->buffers[1]);
+
+  // Also when the slices don't start at the beginning of the parent
+  ASSERT_OK_AND_ASSIGN(combined, Concatenate({array->Slice(2, 2), array->Slice(4)}));
+  AssertArraysEqual(*array->Slice(2), *combined);
+  ASSERT_EQ(combined->data()->buffers[1], array->data()->buffers[1]);
+  ASSERT_EQ(combined->data()->offset, 2);
+
+  // Out-of-order or non-adjacent slices are materialized as usual
+  ASSERT_OK_AND_ASSIGN(combined, Concatenate({array->Slice(4), array->Slice(0, 4)}));
+  ASSERT_NE(combined->data()->buffers[1], array->data()->buffers[1]);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[5, null, 7, 8, 1, null, 3, 4]"), *combined);
+}
+
 TEST_F(ConcatenateTest, NullType) {
   Check([](int32_t size, double null_probability, std::shared_ptr<Array>* out) {
     *out = std::make_shared<NullArray>(size);
@@ -21,6 +21,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -40,7 +41,9 @@
 #include "arrow/util/range.h"
 #include "arrow/util/ree_util.h"
 #include "arrow/util/slice_util_internal.h"
+#include "arrow/util/hash_util.h"
 #include "arrow/util/union_util.h"
+#include "arrow/vendored/xxhash.h"
 
 namespace arrow {
 
@@ -227,6 +230,71 @@ int64_t ArrayData::ComputeLogicalNullCount() const {
   return ArraySpan(*this).ComputeLogicalNullCount();
 }
 
+namespace {
+
+// Content hashing is restricted to types for which byte equality of the
+// logical range implies logical equality.  Floating point types are excluded
+// because distinct byte patterns can compare equal (0.0 and -0.0), booleans
+// because sliced bitmaps are generally not byte-aligned.
+bool IsContentHashableType(const DataType& type) {
+  const Type::type id = type.id();
+  if (id == Type::BOOL || is_floating(id)) {
+    return false;
+  }
+  if (is_primitive(id) || is_decimal(id) || id == Type::FIXED_SIZE_BINARY) {
+    return checked_cast<const FixedWidthType&>(type).bit_width() % 8 == 0;
+  }
+  return is_base_binary_like(id);
+}
+
+template <typename offset_type>
+uint64_t HashBinaryContents(const ArrayData& data) {
+  const auto* offsets = data.GetValues<offset_type>(1);
+  const uint8_t* values = data.buffers[2] ? data.buffers[2]->data() : nullptr;
+  const auto values_length = static_cast<size_t>(offsets[data.length] - offsets[0]);
+  auto hash = static_cast<std::size_t>(
+      XXH3_64bits(values ? values + offsets[0] : nullptr, values ? values_length : 0));
+  // The value lengths must participate in the hash so that element boundaries
+  // matter; the raw offsets cannot be hashed directly as they are not rebased
+  // when an array is sliced.
+  for (int64_t i = 0; i < data.length; ++i) {
+    internal::hash_combine(hash, static_cast<uint64_t>(offsets[i + 1] - offsets[i]));
+  }
+  return static_cast<uint64_t>(hash);
+}
+
+}  // namespace
+
+uint64_t ArrayData::GetContentHash() const {
+  uint64_t precomputed = this->content_hash.load();
+  if (ARROW_PREDICT_TRUE(precomputed != 0)) {
+    return precomputed;
+  }
+  if (this->type == nullptr || !IsContentHashableType(*this->type) ||
+      this->GetNullCount() != 0 || this->device_type() != DeviceAllocationType::kCPU) {
+    return 0;
+  }
+  uint64_t hash;
+  if (this->length == 0) {
+    hash = XXH3_64bits("", 0);
+  } else if (is_base_binary_like(this->type->id())) {
+    hash = is_binary_like(this->type->id()) ? HashBinaryContents<int32_t>(*this)
+                                            : HashBinaryContents<int64_t>(*this);
+  } else {
+    const int byte_width =
+        checked_cast<const FixedWidthType&>(*this->type).bit_width() / 8;
+    const auto* values = this->GetValues<uint8_t>(1, this->offset * byte_width);
+    if (values == nullptr) {
+      return 0;
+    }
+    hash = XXH3_64bits(values, static_cast<size_t>(this->length * byte_width));
+  }
+  // 0 is reserved as the "not computed" sentinel
+  hash += (hash == 0);
+  this->content_hash.store(hash);
+  return hash;
+}
+
 DeviceAllocationType ArrayData::device_type() const {
   // we're using 0 as a sentinel value for NOT YET ASSIGNED
   // there is explicitly no constant DeviceAllocationType to represent
@@ -924,6 +992,126 @@ struct ViewDataImpl {
 
 }  // namespace
 
+bool IsExclusivelyOwned(const std::shared_ptr<ArrayData>& data) {
+  if (data == nullptr || data.use_count() != 1) {
+    return false;
+  }
+  for (const auto& buffer : data->buffers) {
+    if (buffer != nullptr && !IsExclusivelyOwned(buffer)) {
+      return false;
+    }
+  }
+  for (const auto& child : data->child_data) {
+    if (!IsExclusivelyOwned(child)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Result<std::shared_ptr<ArrayData>> MakeMutable(std::shared_ptr<ArrayData> data,
+                                               MemoryPool* pool) {
+  std::shared_ptr<ArrayData> out;
+  if (data.use_count() == 1) {
+    out = std::move(data);
+  } else {
+    out = data->Copy();
+  }
+  for (auto& buffer : out->buffers) {
+    if (buffer != nullptr) {
+      ARROW_ASSIGN_OR_RAISE(buffer, MakeMutable(std::move(buffer), pool));
+    }
+  }
+  for (auto& child : out->child_data) {
+    ARROW_ASSIGN_OR_RAISE(child, MakeMutable(std::move(child), pool));
+  }
+  return out;
+}
+
+class ArrayDataPool::Impl {
+ public:
+  explicit Impl(size_t max_cached) : max_cached_(max_cached) {}
+
+  ~Impl() {
+    for (ArrayData* data : cache_) {
+      delete data;
+    }
+  }
+
+  ArrayData* Take() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cache_.empty()) {
+      return nullptr;
+    }
+    ArrayData* data = cache_.back();
+    cache_.pop_back();
+    return data;
+  }
+
+  bool Return(ArrayData* data) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (cache_.size() >= max_cached_) {
+      return false;
+    }
+    cache_.push_back(data);
+    return true;
+  }
+
+  size_t num_cached() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cache_.size();
+  }
+
+ private:
+  const size_t max_cached_;
+  mutable std::mutex mutex_;
+  std::vector<ArrayData*> cache_;
+};
+
+ArrayDataPool::ArrayDataPool(size_t max_cached)
+    : impl_(std::make_unique<Impl>(max_cached)) {}
+
+ArrayDataPool::~ArrayDataPool() = default;
+
+std::shared_ptr<ArrayDataPool> ArrayDataPool::Make(size_t max_cached) {
+  return std::shared_ptr<ArrayDataPool>(new ArrayDataPool(max_cached));
+}
+
+const std::shared_ptr<ArrayDataPool>& ArrayDataPool::Default() {
+  static auto default_pool = Make();
+  return default_pool;
+}
+
+std::shared_ptr<ArrayData> ArrayDataPool::MakeArrayData(std::shared_ptr<DataType> type,
+                                                        int64_t length,
+                                                        int64_t null_count,
+                                                        int64_t offset) {
+  ArrayData* data = impl_->Take();
+  if (data == nullptr) {
+    data = new ArrayData();
+  }
+  data->type = std::move(type);
+  data->length = length;
+  data->null_count = null_count;
+  data->offset = offset;
+  // The deleter keeps the pool alive until the last handed-out instance is
+  // returned.  Buffer and child references are dropped before recycling so
+  // the pool never pins memory; the vectors keep their capacity.
+  return std::shared_ptr<ArrayData>(
+      data, [self = shared_from_this()](ArrayData* p) {
+        p->type.reset();
+        p->buffers.clear();
+        p->child_data.clear();
+        p->dictionary.reset();
+        p->statistics.reset();
+        if (!self->impl_->Return(p)) {
+          delete p;
+        }
+      });
+}
+
+size_t ArrayDataPool::num_cached() const { return impl_->num_cached(); }
+
 namespace internal {
 
 Result<std::shared_ptr<ArrayData>> GetArrayView(
@@ -943,5 +1131,60 @@ Result<std::shared_ptr<ArrayData>> GetArrayView(
   return out_data;
 }
 
+namespace {
+
+void CollectUnknownNullCounts(const ArrayData& data,
+                              std::vector<const ArrayData*>* arrays,
+                              std::vector<BitmapRange>* ranges) {
+  if (data.null_count.load() == kUnknownNullCount) {
+    if (!data.buffers.empty() && data.buffers[0]) {
+      arrays->push_back(&data);
+      ranges->push_back({data.buffers[0]->data(), data.offset, data.length});
+    } else {
+      data.null_count.store(0);
+    }
+  }
+  for (const auto& child : data.child_data) {
+    if (child) {
+      CollectUnknownNullCounts(*child, arrays, ranges);
+    }
+  }
+  if (data.dictionary) {
+    CollectUnknownNullCounts(*data.dictionary, arrays, ranges);
+  }
+}
+
+void PrecomputeCollectedNullCounts(const std::vector<const ArrayData*>& arrays,
+                                   const std::vector<BitmapRange>& ranges) {
+  if (arrays.empty()) {
+    return;
+  }
+  std::vector<int64_t> counts(arrays.size());
+  CountSetBitsBatch(ranges.data(), static_cast<int64_t>(ranges.size()), counts.data());
+  for (size_t i = 0; i < arrays.size(); ++i) {
+    arrays[i]->null_count.store(arrays[i]->length - counts[i]);
+  }
+}
+
+}  // namespace
+
+void PrecomputeNullCounts(const ArrayData& data) {
+  std::vector<const ArrayData*> arrays;
+  std::vector<BitmapRange> ranges;
+  CollectUnknownNullCounts(data, &arrays, &ranges);
+  PrecomputeCollectedNullCounts(arrays, ranges);
+}
+
+void PrecomputeNullCounts(const std::vector<std::shared_ptr<ArrayData>>& arrays) {
+  std::vector<const ArrayData*> collected;
+  std::vector<BitmapRange> ranges;
+  for (const auto& array : arrays) {
+    if (array) {
+      CollectUnknownNullCounts(*array, &collected, &ranges);
+    }
+  }
+  PrecomputeCollectedNullCounts(collected, ranges);
+}
+
 }  // namespace internal
 }  // namespace arrow
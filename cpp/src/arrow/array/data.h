@@ -147,7 +147,8 @@ struct ARROW_EXPORT ArrayData {
         buffers(std::move(other.buffers)),
         child_data(std::move(other.child_data)),
         dictionary(std::move(other.dictionary)),
-        statistics(std::move(other.statistics)) {}
+        statistics(std::move(other.statistics)),
+        content_hash(other.content_hash.load()) {}
 
   // Copy constructor
   ArrayData(const ArrayData& other) noexcept
@@ -158,7 +159,10 @@ struct ARROW_EXPORT ArrayData {
         buffers(other.buffers),
         child_data(other.child_data),
         dictionary(other.dictionary),
-        statistics(other.statistics) {}
+        statistics(other.statistics),
+        // Copies are routinely mutated afterwards (e.g. by Slice), so the
+        // memoized content hash is not carried over.
+        content_hash(0) {}
 
   // Move assignment
   ArrayData& operator=(ArrayData&& other) {
@@ -170,6 +174,7 @@ struct ARROW_EXPORT ArrayData {
     child_data = std::move(other.child_data);
     dictionary = std::move(other.dictionary);
     statistics = std::move(other.statistics);
+    content_hash.store(other.content_hash.load());
     return *this;
   }
 
@@ -183,6 +188,7 @@ struct ARROW_EXPORT ArrayData {
     child_data = other.child_data;
     dictionary = other.dictionary;
     statistics = other.statistics;
+    content_hash.store(0);
     return *this;
   }
 
@@ -455,6 +461,24 @@ struct ARROW_EXPORT ArrayData {
   /// \see GetNullCount
   int64_t ComputeLogicalNullCount() const;
 
+  /// \brief Return a 64-bit hash of the array's logical contents
+  ///
+  /// The hash is computed lazily with XXH3 over the logical range of the
+  /// buffers and then memoized, so repeated calls are free.  It is a pure
+  /// function of type and logical contents: two arrays with equal types and
+  /// equal values always produce the same hash regardless of their slicing
+  /// offsets, which makes an unequal hash proof of unequal contents (the
+  /// converse does not hold).
+  ///
+  /// Hashing is only supported where byte equality implies logical equality:
+  /// byte-aligned fixed-width non-floating-point types and binary-like
+  /// types, in all cases without nulls and on CPU memory.  For other arrays
+  /// this function returns 0, meaning "no hash available".
+  ///
+  /// As with other caching members, the memoized hash is only reliable while
+  /// the buffers are not mutated.
+  uint64_t GetContentHash() const;
+
   /// \brief Return the device_type of the underlying buffers and children
   ///
   /// If there are no buffers in this ArrayData object, it just returns
@@ -479,6 +503,10 @@ struct ARROW_EXPORT ArrayData {
 
   // The statistics for this Array.
   std::shared_ptr<ArrayStatistics> statistics;
+
+  // Lazily-computed hash of the logical contents (0 means "not computed").
+  // See GetContentHash().
+  mutable std::atomic<uint64_t> content_hash{0};
 };
 
 /// \brief A non-owning Buffer reference
@@ -732,6 +760,64 @@ struct ARROW_EXPORT ArraySpan {
   bool DictionaryMayHaveLogicalNulls() const;
 };
 
+/// \brief Whether the array's allocations are provably not referenced elsewhere
+///
+/// True only if the given pointer is the sole reference to the ArrayData and
+/// every buffer and child, recursively, is exclusively owned (see the Buffer
+/// overload).  A true result means a kernel may write into the array's
+/// buffers in place; dictionaries are treated as immutable and ignored.
+ARROW_EXPORT bool IsExclusivelyOwned(const std::shared_ptr<ArrayData>& data);
+
+/// \brief Return an equivalent ArrayData whose buffers are all mutable,
+/// copying only those that are shared
+///
+/// Exclusively-owned buffers and children are taken over as is; shared ones
+/// are copied into fresh allocations.  To benefit from the zero-copy paths,
+/// pass the only reference with std::move.  Dictionaries are treated as
+/// immutable and left shared.
+ARROW_EXPORT Result<std::shared_ptr<ArrayData>> MakeMutable(
+    std::shared_ptr<ArrayData> data, MemoryPool* pool = NULLPTR);
+
+/// \brief EXPERIMENTAL: A recycling pool of ArrayData instances
+///
+/// Batch-heavy workloads create and destroy millions of short-lived ArrayData
+/// objects; each one costs a control-block allocation plus separate heap
+/// storage for the buffers and child_data vectors.  This pool hands out
+/// ArrayData instances whose deleter returns them to the pool instead of
+/// freeing them, so a recycled instance reuses both its allocation and the
+/// capacity of its internal vectors.
+///
+/// Handed-out instances behave exactly like ordinary ArrayData and may
+/// outlive the pool (the deleter keeps it alive).  The pool is thread-safe
+/// and caches at most `max_cached` instances; excess returns are freed.
+class ARROW_EXPORT ArrayDataPool : public std::enable_shared_from_this<ArrayDataPool> {
+ public:
+  ~ArrayDataPool();
+
+  static std::shared_ptr<ArrayDataPool> Make(size_t max_cached = 256);
+
+  /// \brief A process-wide default pool
+  static const std::shared_ptr<ArrayDataPool>& Default();
+
+  /// \brief Return a fresh or recycled ArrayData with the given metadata
+  ///
+  /// The returned instance has empty buffers and child_data; callers populate
+  /// them just as after ArrayData::Make.
+  std::shared_ptr<ArrayData> MakeArrayData(std::shared_ptr<DataType> type,
+                                           int64_t length,
+                                           int64_t null_count = kUnknownNullCount,
+                                           int64_t offset = 0);
+
+  /// \brief The number of instances currently cached for reuse
+  size_t num_cached() const;
+
+ private:
+  explicit ArrayDataPool(size_t max_cached);
+
+  class Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 namespace internal {
 
 void FillZeroLengthArray(const DataType* type, ArraySpan* span);
@@ -746,5 +832,19 @@ ARROW_EXPORT
 Result<std::shared_ptr<ArrayData>> GetArrayView(const std::shared_ptr<ArrayData>& data,
                                                 const std::shared_ptr<DataType>& type);
 
+/// \brief Compute and cache the null counts of an array, its children and
+/// its dictionaries in a single pass.
+///
+/// Equivalent to calling GetNullCount() on every nested ArrayData, but the
+/// validity bitmaps are counted in one prefetch-pipelined pass instead of
+/// being touched on demand, one cold bitmap at a time.
+ARROW_EXPORT
+void PrecomputeNullCounts(const ArrayData& data);
+
+/// \brief Compute and cache the null counts of several arrays in a single
+/// pass, e.g. all the columns of a record batch.
+ARROW_EXPORT
+void PrecomputeNullCounts(const std::vector<std::shared_ptr<ArrayData>>& arrays);
+
 }  // namespace internal
 }  // namespace arrow
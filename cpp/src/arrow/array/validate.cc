@@ -44,12 +44,55 @@ namespace {
 struct UTF8DataValidator {
   const ArrayData& data;
 
+  // Validate all values in a single pass over the data buffer: the
+  // concatenation of the value bytes must be valid UTF-8 *and* no string
+  // boundary may fall on a continuation byte (which would mean a codepoint
+  // straddles two strings).  Together these imply every individual string is
+  // valid, without per-element call overhead.
+  //
+  // \pre offsets have already been validated
+  // \return false if invalid data was detected, in which case the caller
+  //   should re-run the per-element validation to pinpoint the bad slot
+  template <typename offset_type>
+  bool ValidateUTF8Bulk() {
+    const auto* offsets = data.GetValues<offset_type>(1);
+    const uint8_t* values = data.buffers[2] ? data.buffers[2]->data() : NULLPTR;
+    const offset_type begin = offsets[0];
+    const offset_type end = offsets[data.length];
+    if (end > begin && !util::ValidateUTF8(values + begin, end - begin)) {
+      return false;
+    }
+    // Boundaries equal to `end` delimit empty strings at the tail and have no
+    // byte to inspect; monotonicity makes them a suffix of the offsets.
+    int64_t last = data.length - 1;
+    while (last >= 1 && offsets[last] == end) {
+      --last;
+    }
+    uint8_t is_split = 0;
+    for (int64_t i = 1; i <= last; ++i) {
+      is_split |= static_cast<uint8_t>((values[offsets[i]] & 0xC0) == 0x80);
+    }
+    return is_split == 0;
+  }
+
   template <typename T>
   Status Visit(const T&) {
     if constexpr (std::is_same_v<T, StringType> || std::is_same_v<T, LargeStringType> ||
                   std::is_same_v<T, StringViewType>) {
       util::InitializeUTF8();
 
+      if constexpr (!std::is_same_v<T, StringViewType>) {
+        // Arrays without nulls can be validated in bulk; null slots may
+        // contain arbitrary bytes, so arrays with nulls take the per-element
+        // path below.
+        if (data.GetNullCount() == 0 && data.length > 0) {
+          if (ValidateUTF8Bulk<typename T::offset_type>()) {
+            return Status::OK();
+          }
+          // Fall through to locate the offending slot
+        }
+      }
+
       int64_t i = 0;
       return VisitArraySpanInline<T>(
           data,
@@ -826,22 +869,33 @@ struct ValidateArrayImpl {
   template <typename offset_type>
   Status FullyValidateOffsets(int64_t offset_limit) {
     const auto* offsets = data.GetValues<offset_type>(1);
-    auto prev_offset = offsets[0];
-    if (prev_offset < 0) {
+    if (offsets[0] < 0) {
       return Status::Invalid("Offset invariant failure: array starts at negative offset ",
-                             prev_offset);
+                             offsets[0]);
     }
+    // Branch-free monotonicity scan that the compiler can vectorize; the
+    // offending slot is located in a second pass only if a violation exists.
+    uint8_t non_monotonic = 0;
     for (int64_t i = 1; i <= data.length; ++i) {
-      const auto current_offset = offsets[i];
-      if (current_offset < prev_offset) {
-        return Status::Invalid("Offset invariant failure: non-monotonic offset at slot ",
-                               i, ": ", current_offset, " < ", prev_offset);
+      non_monotonic |= static_cast<uint8_t>(offsets[i] < offsets[i - 1]);
+    }
+    if (ARROW_PREDICT_FALSE(non_monotonic != 0)) {
+      for (int64_t i = 1; i <= data.length; ++i) {
+        if (offsets[i] < offsets[i - 1]) {
+          return Status::Invalid(
+              "Offset invariant failure: non-monotonic offset at slot ", i, ": ",
+              offsets[i], " < ", offsets[i - 1]);
+        }
       }
-      if (current_offset > offset_limit) {
-        return Status::Invalid("Offset invariant failure: offset for slot ", i,
-                               " out of bounds: ", current_offset, " > ", offset_limit);
+    }
+    // Monotonicity makes the last offset an upper bound for all of them
+    if (ARROW_PREDICT_FALSE(offsets[data.length] > offset_limit)) {
+      for (int64_t i = 1; i <= data.length; ++i) {
+        if (offsets[i] > offset_limit) {
+          return Status::Invalid("Offset invariant failure: offset for slot ", i,
+                                 " out of bounds: ", offsets[i], " > ", offset_limit);
+        }
       }
-      prev_offset = current_offset;
     }
     return Status::OK();
   }
@@ -226,4 +226,22 @@ Result<std::shared_ptr<Buffer>> ConcatenateBuffers(
   return std::shared_ptr<Buffer>(std::move(out));
 }
 
+bool IsExclusivelyOwned(const std::shared_ptr<Buffer>& buffer) {
+  return buffer != nullptr && buffer.use_count() == 1 && buffer->is_mutable() &&
+         buffer->parent() == nullptr;
+}
+
+Result<std::shared_ptr<Buffer>> MakeMutable(std::shared_ptr<Buffer> buffer,
+                                            MemoryPool* pool) {
+  if (IsExclusivelyOwned(buffer)) {
+    return std::move(buffer);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto out, AllocateBuffer(buffer->size(), pool));
+  if (buffer->size() != 0) {
+    std::memcpy(out->mutable_data(), buffer->data(), buffer->size());
+  }
+  // R build with openSUSE155 requires an explicit shared_ptr construction
+  return std::shared_ptr<Buffer>(std::move(out));
+}
+
 }  // namespace arrow
@@ -582,6 +582,23 @@ ARROW_EXPORT
 Result<std::shared_ptr<Buffer>> ConcatenateBuffers(const BufferVector& buffers,
                                                    MemoryPool* pool = NULLPTR);
 
+/// \brief Whether the buffer's allocation is provably not referenced elsewhere
+///
+/// True only if the buffer is mutable, the given pointer is its sole
+/// reference, and it is not a view into another buffer.  A true result means
+/// the caller may write into the buffer without affecting other readers;
+/// false may simply mean exclusivity could not be proven.
+ARROW_EXPORT bool IsExclusivelyOwned(const std::shared_ptr<Buffer>& buffer);
+
+/// \brief Return a mutable buffer with the same contents, copying only if needed
+///
+/// If the buffer is exclusively owned (see IsExclusivelyOwned) it is returned
+/// as is, otherwise its contents are copied into a freshly allocated mutable
+/// buffer.  To benefit from the zero-copy path, pass the only reference with
+/// std::move.
+ARROW_EXPORT Result<std::shared_ptr<Buffer>> MakeMutable(std::shared_ptr<Buffer> buffer,
+                                                         MemoryPool* pool = NULLPTR);
+
 /// @}
 
 }  // namespace arrow
@@ -32,6 +32,7 @@
 #include "arrow/io/interfaces.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/util/checked_cast.h"
 
@@ -369,6 +370,78 @@ TEST_F(TestDevice, View) {
   ASSERT_RAISES(NotImplemented, MemoryManager::CopyBuffer(my_other_src_, cpu_mm_));
 }
 
+TEST_F(TestDevice, MigrationQueueBasics) {
+  ASSERT_OK_AND_ASSIGN(auto queue, BufferMigrationQueue::Make(my_copy_mm_));
+  ASSERT_EQ(queue->destination(), my_copy_mm_);
+
+  // Single CPU-to-device prefetch
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto buffer, queue->Prefetch(cpu_src_));
+  ASSERT_EQ(buffer->device(), my_copy_device_);
+  AssertMyBufferEqual(*buffer, "some data");
+
+  // Invalid construction
+  ASSERT_RAISES(Invalid, BufferMigrationQueue::Make(nullptr));
+  BufferMigrationOptions options;
+  options.coalesce_threshold = options.max_batch_bytes + 1;
+  ASSERT_RAISES(Invalid, BufferMigrationQueue::Make(my_copy_mm_, options));
+}
+
+TEST_F(TestDevice, MigrationQueueCoalescing) {
+  ASSERT_OK_AND_ASSIGN(auto queue, BufferMigrationQueue::Make(my_copy_mm_));
+
+  std::vector<std::shared_ptr<Buffer>> buffers = {
+      Buffer::FromString("first"), Buffer::FromString("second"),
+      Buffer::FromString("third")};
+  auto futures = queue->Prefetch(buffers);
+  ASSERT_EQ(futures.size(), buffers.size());
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto first, futures[0]);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto second, futures[1]);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto third, futures[2]);
+  ASSERT_EQ(first->device(), my_copy_device_);
+  AssertMyBufferEqual(*first, "first");
+  AssertMyBufferEqual(*second, "second");
+  AssertMyBufferEqual(*third, "third");
+
+  // The small buffers were batched through a single transfer: the results are
+  // slices of one device-resident batch buffer.
+  ASSERT_NE(first->parent(), nullptr);
+  ASSERT_EQ(first->parent(), second->parent());
+  ASSERT_EQ(second->parent(), third->parent());
+}
+
+TEST_F(TestDevice, MigrationQueueLargeBuffers) {
+  // Force every buffer onto the individual-transfer path
+  BufferMigrationOptions options;
+  options.coalesce_threshold = 1;
+  ASSERT_OK_AND_ASSIGN(auto queue, BufferMigrationQueue::Make(my_copy_mm_, options));
+
+  std::vector<std::shared_ptr<Buffer>> buffers = {Buffer::FromString("first"),
+                                                  Buffer::FromString("second")};
+  auto futures = queue->Prefetch(buffers);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto first, futures[0]);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto second, futures[1]);
+  AssertMyBufferEqual(*first, "first");
+  AssertMyBufferEqual(*second, "second");
+
+  // Device-to-CPU migration also works buffer by buffer
+  ASSERT_OK_AND_ASSIGN(auto to_cpu, BufferMigrationQueue::Make(cpu_mm_));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto back, to_cpu->Prefetch(my_copy_src_));
+  ASSERT_TRUE(back->is_cpu());
+  AssertBufferEqual(*back, "some data");
+}
+
+TEST_F(TestDevice, MigrationQueueErrors) {
+  // The destination doesn't support copies; the error surfaces in the futures
+  ASSERT_OK_AND_ASSIGN(auto queue, BufferMigrationQueue::Make(my_other_mm_));
+  ASSERT_FINISHES_AND_RAISES(NotImplemented, queue->Prefetch(cpu_src_));
+
+  auto futures = queue->Prefetch(
+      std::vector<std::shared_ptr<Buffer>>{Buffer::FromString("data"), nullptr});
+  ASSERT_FINISHES_AND_RAISES(NotImplemented, futures[0]);
+  ASSERT_FINISHES_AND_RAISES(Invalid, futures[1]);
+}
+
 TEST(TestAllocate, Basics) {
   ASSERT_OK_AND_ASSIGN(auto new_buffer, AllocateBuffer(1024));
   auto mm = new_buffer->memory_manager();
@@ -609,6 +682,52 @@ TEST(TestBuffer, SliceMutableBuffer) {
   ASSERT_TRUE(slice->Equals(expected));
 }
 
+TEST(TestBuffer, IsExclusivelyOwned) {
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Buffer> buffer, AllocateBuffer(50));
+  ASSERT_TRUE(IsExclusivelyOwned(buffer));
+
+  // A second reference breaks exclusivity until it goes away
+  std::shared_ptr<Buffer> copy = buffer;
+  ASSERT_FALSE(IsExclusivelyOwned(buffer));
+  copy.reset();
+  ASSERT_TRUE(IsExclusivelyOwned(buffer));
+
+  // Slices are views into a parent buffer
+  std::shared_ptr<Buffer> slice = SliceMutableBuffer(buffer, 5, 10);
+  ASSERT_FALSE(IsExclusivelyOwned(slice));
+  ASSERT_FALSE(IsExclusivelyOwned(buffer));
+  slice.reset();
+
+  // Immutable buffers are never exclusively owned
+  std::shared_ptr<Buffer> immutable = Buffer::FromString("immutable data");
+  ASSERT_FALSE(IsExclusivelyOwned(immutable));
+  ASSERT_FALSE(IsExclusivelyOwned(nullptr));
+}
+
+TEST(TestBuffer, MakeMutable) {
+  // An exclusively-owned buffer passes through without copying
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Buffer> buffer, AllocateBuffer(9));
+  memcpy(buffer->mutable_data(), "some data", 9);
+  const uint8_t* data = buffer->data();
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Buffer> mutable_buf,
+                       MakeMutable(std::move(buffer)));
+  ASSERT_EQ(data, mutable_buf->data());
+  AssertBufferEqual(*mutable_buf, "some data");
+
+  // A shared buffer is copied and the original is left untouched
+  std::shared_ptr<Buffer> copy = mutable_buf;
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<Buffer> fresh, MakeMutable(mutable_buf));
+  ASSERT_NE(fresh->data(), copy->data());
+  ASSERT_TRUE(fresh->is_mutable());
+  AssertBufferEqual(*fresh, "some data");
+
+  // So is an immutable one
+  std::shared_ptr<Buffer> immutable = Buffer::FromString("immutable data");
+  ASSERT_OK_AND_ASSIGN(fresh, MakeMutable(std::move(immutable)));
+  ASSERT_TRUE(fresh->is_mutable());
+  AssertBufferEqual(*fresh, "immutable data");
+}
+
 TEST(TestBuffer, GetReader) {
   const std::string data_str = "some data to read";
   auto data = reinterpret_cast<const uint8_t*>(data_str.c_str());
@@ -150,6 +150,35 @@ static void BuildBinaryArray(benchmark::State& state) {  // NOLINT non-const ref
   state.SetItemsProcessed(state.iterations() * kItemsProcessed);
 }
 
+static void BuildBinaryArrayPacked(
+    benchmark::State& state) {  // NOLINT non-const reference
+  // Values packed back to back with precomputed offsets, as produced by the
+  // CSV and JSON parsers
+  std::string values;
+  std::vector<int32_t> offsets;
+  offsets.reserve(kNumberOfElements + 1);
+  offsets.push_back(0);
+  for (int64_t i = 0; i < kNumberOfElements; i++) {
+    values += kBinaryView;
+    offsets.push_back(static_cast<int32_t>(values.size()));
+  }
+  const uint8_t* values_data = reinterpret_cast<const uint8_t*>(values.data());
+
+  for (auto _ : state) {
+    BinaryBuilder builder(memory_tracker.memory_pool());
+
+    for (int i = 0; i < kRounds; i++) {
+      ABORT_NOT_OK(builder.AppendValues(values_data, offsets.data(), kNumberOfElements));
+    }
+
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+  }
+
+  state.SetBytesProcessed(state.iterations() * kBytesProcessed);
+  state.SetItemsProcessed(state.iterations() * kItemsProcessed);
+}
+
 static void BuildInlineBinaryViewArray(
     benchmark::State& state) {  // NOLINT non-const reference
   std::string_view kBinaryStrings[] = {"1",  "12345678", "12345", "123456789",
@@ -493,6 +522,7 @@ BENCHMARK(BuildAdaptiveIntNoNulls);
 BENCHMARK(BuildAdaptiveIntNoNullsScalarAppend);
 
 BENCHMARK(BuildBinaryArray);
+BENCHMARK(BuildBinaryArrayPacked);
 BENCHMARK(BuildChunkedBinaryArray);
 BENCHMARK(BuildFixedSizeBinaryArray);
 BENCHMARK(BuildDecimalArray);
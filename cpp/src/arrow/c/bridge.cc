@@ -34,6 +34,7 @@
 #include "arrow/c/helpers.h"
 #include "arrow/c/util_internal.h"
 #include "arrow/extension_type.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/memory_pool_internal.h"  // for kZeroSizeArea
 #include "arrow/record_batch.h"
@@ -50,6 +51,7 @@
 #include "arrow/util/range.h"
 #include "arrow/util/small_vector.h"
 #include "arrow/util/string.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/value_parsing.h"
 #include "arrow/visit_type_inline.h"
 
@@ -710,6 +712,197 @@ Status ExportRecordBatch(const RecordBatch& batch, struct ArrowArray* out,
   return Status::OK();
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Bulk C data export
+
+namespace {
+
+// Private data for a batch exported through RecordBatchExporter: all array
+// nodes and pointer arrays live in pre-sized arenas owned by the root
+// ArrowArray, instead of one heap allocation per node.
+struct ExportedBatchPrivateData {
+  std::shared_ptr<ArrayData> data_;
+  std::vector<struct ArrowArray> nodes_;
+  std::vector<struct ArrowArray*> child_pointers_;
+  std::vector<const void*> buffers_;
+  std::vector<int64_t> variadic_buffer_sizes_;
+};
+
+// Recursively mark a non-root node and its descendants released; the arena
+// they live in is owned (and freed) by the root.
+void ReleaseExportedBatchChild(struct ArrowArray* array) {
+  if (ArrowArrayIsReleased(array)) {
+    return;
+  }
+  for (int64_t i = 0; i < array->n_children; ++i) {
+    ArrowArrayRelease(array->children[i]);
+  }
+  if (array->dictionary != nullptr) {
+    ArrowArrayRelease(array->dictionary);
+  }
+  ArrowArrayMarkReleased(array);
+}
+
+void ReleaseExportedBatch(struct ArrowArray* array) {
+  if (ArrowArrayIsReleased(array)) {
+    return;
+  }
+  for (int64_t i = 0; i < array->n_children; ++i) {
+    ArrowArrayRelease(array->children[i]);
+  }
+  if (array->dictionary != nullptr) {
+    ArrowArrayRelease(array->dictionary);
+  }
+  DCHECK_NE(array->private_data, nullptr);
+  delete reinterpret_cast<ExportedBatchPrivateData*>(array->private_data);
+  ArrowArrayMarkReleased(array);
+}
+
+struct BatchExportCounts {
+  int64_t nodes = 0;
+  int64_t buffers = 0;
+  int64_t child_pointers = 0;
+  int64_t variadic_sizes = 0;
+};
+
+// Mirrors the buffer layout decisions in ArrayExporter::Export
+int64_t NumExportedBuffers(const ArrayData& data, int64_t* variadic_sizes) {
+  int64_t n_buffers = static_cast<int64_t>(data.buffers.size());
+  if (n_buffers > 0 && !internal::may_have_validity_bitmap(data.type->id())) {
+    --n_buffers;
+  }
+  if (data.type->id() == Type::BINARY_VIEW || data.type->id() == Type::STRING_VIEW) {
+    *variadic_sizes += static_cast<int64_t>(data.buffers.size()) - 2;
+    ++n_buffers;
+  }
+  return n_buffers;
+}
+
+void CountBatchExportNodes(const ArrayData& data, BatchExportCounts* counts) {
+  counts->buffers += NumExportedBuffers(data, &counts->variadic_sizes);
+  counts->child_pointers += static_cast<int64_t>(data.child_data.size());
+  for (const auto& child : data.child_data) {
+    ++counts->nodes;
+    CountBatchExportNodes(*child, counts);
+  }
+  if (data.dictionary != nullptr) {
+    ++counts->nodes;
+    CountBatchExportNodes(*data.dictionary, counts);
+  }
+}
+
+struct BatchExportCursors {
+  ExportedBatchPrivateData* pdata;
+  size_t node_i = 0;
+  size_t buffer_i = 0;
+  size_t child_ptr_i = 0;
+  size_t variadic_i = 0;
+};
+
+void FillExportedBatchArray(const std::shared_ptr<ArrayData>& data,
+                            struct ArrowArray* c_struct, BatchExportCursors* cursors,
+                            bool is_root) {
+  auto* pdata = cursors->pdata;
+  // Force computing null count (see comment in ArrayExporter::Export)
+  data->GetNullCount();
+
+  int64_t n_buffers = static_cast<int64_t>(data->buffers.size());
+  auto buffers_begin = data->buffers.begin();
+  if (n_buffers > 0 && !internal::may_have_validity_bitmap(data->type->id())) {
+    --n_buffers;
+    ++buffers_begin;
+  }
+  const bool need_variadic_buffer_sizes = data->type->id() == Type::BINARY_VIEW ||
+                                          data->type->id() == Type::STRING_VIEW;
+
+  const size_t buffer_start = cursors->buffer_i;
+  for (auto it = buffers_begin; it != data->buffers.end(); ++it) {
+    pdata->buffers_[cursors->buffer_i++] = *it ? (*it)->data() : nullptr;
+  }
+  if (need_variadic_buffer_sizes) {
+    const size_t variadic_start = cursors->variadic_i;
+    for (const auto& buf : util::span(data->buffers).subspan(2)) {
+      pdata->variadic_buffer_sizes_[cursors->variadic_i++] = buf->size();
+    }
+    pdata->buffers_[cursors->buffer_i++] =
+        &pdata->variadic_buffer_sizes_[variadic_start];
+    ++n_buffers;
+  }
+
+  memset(c_struct, 0, sizeof(*c_struct));
+  c_struct->length = data->length;
+  c_struct->null_count = data->null_count;
+  c_struct->offset = data->offset;
+  c_struct->n_buffers = n_buffers;
+  c_struct->n_children = static_cast<int64_t>(data->child_data.size());
+  c_struct->buffers = n_buffers ? &pdata->buffers_[buffer_start] : nullptr;
+
+  if (!data->child_data.empty()) {
+    const size_t child_ptr_start = cursors->child_ptr_i;
+    cursors->child_ptr_i += data->child_data.size();
+    c_struct->children = &pdata->child_pointers_[child_ptr_start];
+    for (size_t i = 0; i < data->child_data.size(); ++i) {
+      auto* child = &pdata->nodes_[cursors->node_i++];
+      pdata->child_pointers_[child_ptr_start + i] = child;
+      FillExportedBatchArray(data->child_data[i], child, cursors, /*is_root=*/false);
+    }
+  }
+  if (data->dictionary != nullptr) {
+    auto* dict = &pdata->nodes_[cursors->node_i++];
+    c_struct->dictionary = dict;
+    FillExportedBatchArray(data->dictionary, dict, cursors, /*is_root=*/false);
+  }
+
+  c_struct->private_data = is_root ? pdata : nullptr;
+  c_struct->release = is_root ? ReleaseExportedBatch : ReleaseExportedBatchChild;
+}
+
+}  // namespace
+
+struct RecordBatchExporter::Impl {
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<DataType> struct_type_;
+};
+
+RecordBatchExporter::RecordBatchExporter(std::shared_ptr<Schema> schema)
+    : impl_(new Impl{schema, struct_(schema->fields())}) {}
+
+RecordBatchExporter::~RecordBatchExporter() = default;
+
+Status RecordBatchExporter::ExportSchema(struct ArrowSchema* out) const {
+  return ::arrow::ExportSchema(*impl_->schema_, out);
+}
+
+Status RecordBatchExporter::Export(const RecordBatch& batch, struct ArrowArray* out) {
+  if (batch.schema().get() != impl_->schema_.get() &&
+      !batch.schema()->Equals(*impl_->schema_)) {
+    return Status::Invalid("Schema of exported record batch does not match ",
+                           "the RecordBatchExporter schema");
+  }
+  // Build the root struct view directly, bypassing ToStructArray()
+  auto data = ArrayData::Make(impl_->struct_type_, batch.num_rows(),
+                              {nullptr}, batch.column_data(), /*null_count=*/0,
+                              /*offset=*/0);
+
+  BatchExportCounts counts;
+  CountBatchExportNodes(*data, &counts);
+
+  auto pdata = std::make_unique<ExportedBatchPrivateData>();
+  pdata->nodes_.resize(counts.nodes);
+  pdata->child_pointers_.resize(counts.child_pointers);
+  pdata->buffers_.resize(counts.buffers);
+  pdata->variadic_buffer_sizes_.resize(counts.variadic_sizes);
+  pdata->data_ = data;
+
+  BatchExportCursors cursors;
+  cursors.pdata = pdata.get();
+  FillExportedBatchArray(data, out, &cursors, /*is_root=*/true);
+  DCHECK_EQ(cursors.node_i, pdata->nodes_.size());
+  DCHECK_EQ(cursors.buffer_i, pdata->buffers_.size());
+  pdata.release();  // now owned by 'out'
+  return Status::OK();
+}
+
 //////////////////////////////////////////////////////////////////////////
 // C device arrays
 
@@ -1981,6 +2174,278 @@ Result<std::shared_ptr<RecordBatch>> ImportRecordBatch(struct ArrowArray* array,
   return ImportRecordBatch(array, *maybe_schema);
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Bulk C data import
+
+namespace {
+
+// A pre-compiled import plan for one field of a trusted schema.  Compiling
+// the plan once moves the per-type dispatch out of the per-batch path.
+struct FastImportNode {
+  enum class Kind : int8_t {
+    kPrimitive,
+    kBoolean,
+    kBinary,
+    kLargeBinary,
+    kList,
+    kLargeList,
+    kFixedSizeList,
+    kStruct,
+  };
+
+  Kind kind;
+  int32_t byte_width = 0;  // only used for kPrimitive
+  std::shared_ptr<DataType> type;
+  std::vector<FastImportNode> children;
+
+  int64_t num_buffers() const {
+    switch (kind) {
+      case Kind::kBinary:
+      case Kind::kLargeBinary:
+        return 3;
+      case Kind::kFixedSizeList:
+      case Kind::kStruct:
+        return 1;
+      default:
+        return 2;
+    }
+  }
+};
+
+Result<FastImportNode> BuildFastImportNode(const std::shared_ptr<DataType>& type) {
+  FastImportNode node;
+  node.type = type;
+  switch (type->id()) {
+    case Type::BOOL:
+      node.kind = FastImportNode::Kind::kBoolean;
+      break;
+    case Type::STRING:
+    case Type::BINARY:
+      node.kind = FastImportNode::Kind::kBinary;
+      break;
+    case Type::LARGE_STRING:
+    case Type::LARGE_BINARY:
+      node.kind = FastImportNode::Kind::kLargeBinary;
+      break;
+    case Type::LIST:
+    case Type::MAP:
+      node.kind = FastImportNode::Kind::kList;
+      break;
+    case Type::LARGE_LIST:
+      node.kind = FastImportNode::Kind::kLargeList;
+      break;
+    case Type::FIXED_SIZE_LIST:
+      node.kind = FastImportNode::Kind::kFixedSizeList;
+      break;
+    case Type::STRUCT:
+      node.kind = FastImportNode::Kind::kStruct;
+      break;
+    default:
+      if (is_primitive(type->id()) || is_decimal(type->id()) ||
+          type->id() == Type::FIXED_SIZE_BINARY) {
+        const int bit_width = checked_cast<const FixedWidthType&>(*type).bit_width();
+        if (!bit_util::IsMultipleOf8(bit_width)) {
+          return Status::NotImplemented("No fast import path for type ",
+                                        type->ToString());
+        }
+        node.kind = FastImportNode::Kind::kPrimitive;
+        node.byte_width = bit_width / 8;
+      } else {
+        // Dictionaries, unions, views, run-end encoding, extensions, null...
+        // take the generic ArrayImporter path.
+        return Status::NotImplemented("No fast import path for type ",
+                                      type->ToString());
+      }
+      break;
+  }
+  node.children.reserve(type->num_fields());
+  for (const auto& field : type->fields()) {
+    ARROW_ASSIGN_OR_RAISE(auto child, BuildFastImportNode(field->type()));
+    node.children.push_back(std::move(child));
+  }
+  return node;
+}
+
+// Imports the arrays described by a FastImportNode plan, trusting the
+// schema the plan was compiled from.  Structural properties of the C structs
+// (buffer and child counts, null data pointers) are still checked.
+// CPU data only.
+struct FastArrayImporter {
+  std::shared_ptr<ImportedArrayData> import_;
+  std::shared_ptr<Buffer> zero_size_buffer_;
+
+  Status ImportArray(const FastImportNode& node, struct ArrowArray* c,
+                     std::shared_ptr<ArrayData>* out) {
+    if (c->n_children != static_cast<int64_t>(node.children.size())) {
+      return Status::Invalid("ArrowArray struct has ", c->n_children,
+                             " children, expected ", node.children.size(), " for type ",
+                             node.type->ToString());
+    }
+    if (c->n_buffers != node.num_buffers()) {
+      return Status::Invalid("Expected ", node.num_buffers(),
+                             " buffers for imported type ", node.type->ToString(),
+                             ", ArrowArray struct has ", c->n_buffers);
+    }
+    auto data =
+        std::make_shared<ArrayData>(node.type, c->length, c->null_count, c->offset);
+    data->buffers.resize(static_cast<size_t>(c->n_buffers));
+    RETURN_NOT_OK(ImportNullBitmap(node, c, data.get()));
+
+    const int64_t bits_size =
+        (c->length > 0) ? bit_util::BytesForBits(c->length + c->offset) : 0;
+    switch (node.kind) {
+      case FastImportNode::Kind::kPrimitive:
+        RETURN_NOT_OK(ImportDataBuffer(
+            node, c, 1,
+            (c->length > 0) ? node.byte_width * (c->length + c->offset) : 0,
+            data.get()));
+        break;
+      case FastImportNode::Kind::kBoolean:
+        RETURN_NOT_OK(ImportDataBuffer(node, c, 1, bits_size, data.get()));
+        break;
+      case FastImportNode::Kind::kBinary:
+        RETURN_NOT_OK(ImportBinaryBuffers<int32_t>(node, c, data.get()));
+        break;
+      case FastImportNode::Kind::kLargeBinary:
+        RETURN_NOT_OK(ImportBinaryBuffers<int64_t>(node, c, data.get()));
+        break;
+      case FastImportNode::Kind::kList:
+        RETURN_NOT_OK(ImportDataBuffer(
+            node, c, 1, sizeof(int32_t) * (c->length + c->offset + 1), data.get()));
+        break;
+      case FastImportNode::Kind::kLargeList:
+        RETURN_NOT_OK(ImportDataBuffer(
+            node, c, 1, sizeof(int64_t) * (c->length + c->offset + 1), data.get()));
+        break;
+      case FastImportNode::Kind::kFixedSizeList:
+      case FastImportNode::Kind::kStruct:
+        break;
+    }
+
+    data->child_data.resize(node.children.size());
+    for (size_t i = 0; i < node.children.size(); ++i) {
+      DCHECK_NE(c->children[i], nullptr);
+      RETURN_NOT_OK(
+          ImportArray(node.children[i], c->children[i], &data->child_data[i]));
+    }
+    *out = std::move(data);
+    return Status::OK();
+  }
+
+ private:
+  Status ImportNullBitmap(const FastImportNode& node, struct ArrowArray* c,
+                          ArrayData* data) {
+    const auto* validity = reinterpret_cast<const uint8_t*>(c->buffers[0]);
+    if (validity != nullptr) {
+      const int64_t buffer_size =
+          (c->length > 0) ? bit_util::BytesForBits(c->length + c->offset) : 0;
+      data->buffers[0] = std::make_shared<ImportedBuffer>(validity, buffer_size, import_);
+    } else if (c->null_count > 0) {
+      return Status::Invalid(
+          "ArrowArray struct has null bitmap buffer but non-zero null_count ",
+          c->null_count);
+    }
+    return Status::OK();
+  }
+
+  template <typename OffsetType>
+  Status ImportBinaryBuffers(const FastImportNode& node, struct ArrowArray* c,
+                             ArrayData* data) {
+    RETURN_NOT_OK(ImportDataBuffer(
+        node, c, 1, sizeof(OffsetType) * (c->length + c->offset + 1), data));
+    int64_t values_size = 0;
+    if (c->length > 0) {
+      // The offsets buffer is non-null here (its computed size is non-zero),
+      // and this fast path is CPU-only, so read the last offset directly.
+      values_size = static_cast<int64_t>(reinterpret_cast<const OffsetType*>(
+          c->buffers[1])[c->length + c->offset]);
+    }
+    return ImportDataBuffer(node, c, 2, values_size, data);
+  }
+
+  Status ImportDataBuffer(const FastImportNode& node, struct ArrowArray* c,
+                          int32_t buffer_id, int64_t buffer_size, ArrayData* data) {
+    const auto* p = reinterpret_cast<const uint8_t*>(c->buffers[buffer_id]);
+    if (p != nullptr) {
+      data->buffers[buffer_id] =
+          std::make_shared<ImportedBuffer>(p, buffer_size, import_);
+    } else if (buffer_size != 0) {
+      return Status::Invalid(
+          "ArrowArrayStruct contains null data pointer "
+          "for a buffer with non-zero computed size");
+    } else {
+      data->buffers[buffer_id] = zero_size_buffer_;
+    }
+    return Status::OK();
+  }
+};
+
+}  // namespace
+
+struct RecordBatchImporter::Impl {
+  std::shared_ptr<Schema> schema_;
+  std::vector<FastImportNode> field_nodes_;
+  std::shared_ptr<Buffer> zero_size_buffer_;
+  bool use_fallback_ = false;
+};
+
+RecordBatchImporter::RecordBatchImporter(std::shared_ptr<Schema> schema)
+    : impl_(new Impl{}) {
+  impl_->schema_ = std::move(schema);
+  impl_->zero_size_buffer_ = std::make_shared<Buffer>(kZeroSizeArea, 0);
+  impl_->field_nodes_.reserve(impl_->schema_->num_fields());
+  for (const auto& field : impl_->schema_->fields()) {
+    auto maybe_node = BuildFastImportNode(field->type());
+    if (!maybe_node.ok()) {
+      // Schema contains a type without a fast path; fall back to the
+      // generic per-batch importer.
+      impl_->use_fallback_ = true;
+      impl_->field_nodes_.clear();
+      break;
+    }
+    impl_->field_nodes_.push_back(std::move(*maybe_node));
+  }
+}
+
+RecordBatchImporter::~RecordBatchImporter() = default;
+
+Result<std::shared_ptr<RecordBatch>> RecordBatchImporter::Import(
+    struct ArrowArray* array) {
+  if (impl_->use_fallback_) {
+    return ImportRecordBatch(array, impl_->schema_);
+  }
+  if (ArrowArrayIsReleased(array)) {
+    return Status::Invalid("Cannot import released ArrowArray");
+  }
+  auto import = std::make_shared<ImportedArrayData>();
+  import->device_type_ = DeviceAllocationType::kCPU;
+  struct ArrowArray* c = &import->array_;
+  ArrowArrayMove(array, c);
+  if (c->null_count != 0) {
+    return Status::Invalid(
+        "ArrowArray struct has non-zero null count, "
+        "cannot be imported as RecordBatch");
+  }
+  if (c->offset != 0) {
+    return Status::Invalid(
+        "ArrowArray struct has non-zero offset, "
+        "cannot be imported as RecordBatch");
+  }
+  if (c->n_children != static_cast<int64_t>(impl_->field_nodes_.size())) {
+    return Status::Invalid("ArrowArray struct has ", c->n_children,
+                           " children, expected ", impl_->field_nodes_.size(),
+                           " for schema ", impl_->schema_->ToString());
+  }
+  FastArrayImporter importer{import, impl_->zero_size_buffer_};
+  std::vector<std::shared_ptr<ArrayData>> columns(impl_->field_nodes_.size());
+  for (size_t i = 0; i < impl_->field_nodes_.size(); ++i) {
+    DCHECK_NE(c->children[i], nullptr);
+    RETURN_NOT_OK(
+        importer.ImportArray(impl_->field_nodes_[i], c->children[i], &columns[i]));
+  }
+  return RecordBatch::Make(impl_->schema_, c->length, std::move(columns));
+}
+
 Result<std::shared_ptr<MemoryManager>> DefaultDeviceMemoryMapper(
     ArrowDeviceType device_type, int64_t device_id) {
   ARROW_ASSIGN_OR_RAISE(auto mapper,
@@ -2859,4 +3324,72 @@ Future<> ExportAsyncRecordBatchReader(
           });
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Async ArrowArrayStream adapters
+
+namespace {
+
+// Serves a readahead-buffered async generator through the blocking
+// RecordBatchReader API, for export via the C stream interface.
+class AsyncStreamBatchReader : public RecordBatchReader {
+ public:
+  AsyncStreamBatchReader(std::shared_ptr<Schema> schema,
+                         AsyncGenerator<std::shared_ptr<RecordBatch>> generator)
+      : schema_(std::move(schema)), generator_(std::move(generator)) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    return generator_().MoveResult().Value(batch);
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  AsyncGenerator<std::shared_ptr<RecordBatch>> generator_;
+};
+
+}  // namespace
+
+Result<AsyncRecordBatchStream> ImportAsyncRecordBatchStream(
+    struct ArrowArrayStream* stream, int prefetch_depth,
+    internal::Executor* io_executor) {
+  if (prefetch_depth < 1) {
+    return Status::Invalid("prefetch_depth must be positive, got ", prefetch_depth);
+  }
+  if (io_executor == nullptr) {
+    io_executor = io::internal::GetIOThreadPool();
+  }
+  ARROW_ASSIGN_OR_RAISE(auto reader, ImportRecordBatchReader(stream));
+  AsyncRecordBatchStream result;
+  result.schema = reader->schema();
+  auto it = MakeIteratorFromReader(std::move(reader));
+  ARROW_ASSIGN_OR_RAISE(
+      auto background,
+      MakeBackgroundGenerator(std::move(it), io_executor, /*max_q=*/prefetch_depth,
+                              /*q_restart=*/prefetch_depth / 2));
+  // Continuations must not run on the background I/O thread (see
+  // MakeBackgroundGenerator), so transfer them to the CPU thread pool.
+  result.generator =
+      MakeTransferredGenerator(std::move(background), internal::GetCpuThreadPool());
+  return result;
+}
+
+Status ExportAsyncRecordBatchStream(
+    std::shared_ptr<Schema> schema,
+    AsyncGenerator<std::shared_ptr<RecordBatch>> generator, int prefetch_depth,
+    struct ArrowArrayStream* out) {
+  if (!schema) {
+    return Status::Invalid("Schema is null");
+  }
+  if (prefetch_depth < 1) {
+    return Status::Invalid("prefetch_depth must be positive, got ", prefetch_depth);
+  }
+  // The readahead generator keeps pulling from the producer while the consumer
+  // is busy; the reader's blocking ReadNext only waits when the queue is empty.
+  auto readahead = MakeReadaheadGenerator(std::move(generator), prefetch_depth);
+  return ExportRecordBatchReader(
+      std::make_shared<AsyncStreamBatchReader>(std::move(schema), std::move(readahead)),
+      out);
+}
+
 }  // namespace arrow
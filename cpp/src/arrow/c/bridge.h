@@ -167,6 +167,57 @@ ARROW_EXPORT
 Result<std::shared_ptr<RecordBatch>> ImportRecordBatch(struct ArrowArray* array,
                                                        struct ArrowSchema* schema);
 
+/// \brief EXPERIMENTAL: Reusable exporter for record batches sharing one schema.
+///
+/// ExportRecordBatch allocates private data for every array node and
+/// re-exports the schema on each call, which dominates the cost of FFI
+/// boundaries moving many small batches.  A RecordBatchExporter is built
+/// once per schema: the schema can be exported separately (and only once),
+/// and each batch export lays out all ArrowArray nodes, buffer pointers and
+/// child pointers in a single arena owned by the root ArrowArray, so one
+/// allocation is performed per batch.
+///
+/// The resulting ArrowArray structs follow the C data interface contract:
+/// the consumer releases the root, which releases the whole arena.
+class ARROW_EXPORT RecordBatchExporter {
+ public:
+  explicit RecordBatchExporter(std::shared_ptr<Schema> schema);
+  ~RecordBatchExporter();
+
+  /// \brief Export the schema; may be called any number of times.
+  Status ExportSchema(struct ArrowSchema* out) const;
+
+  /// \brief Export a record batch; its schema must match the exporter schema.
+  Status Export(const RecordBatch& batch, struct ArrowArray* out);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+/// \brief EXPERIMENTAL: Reusable importer for record batches sharing one schema.
+///
+/// The counterpart of RecordBatchExporter: the schema is validated once at
+/// construction time and compiled into a flat import plan, so importing a
+/// batch skips the per-node type dispatch of ImportRecordBatch.  Structural
+/// properties of each ArrowArray (buffer and child counts) are still
+/// checked.  Schemas containing types without a fast-path plan (unions,
+/// dictionaries, views, extensions) transparently fall back to
+/// ImportRecordBatch.  Only CPU data is supported.
+class ARROW_EXPORT RecordBatchImporter {
+ public:
+  explicit RecordBatchImporter(std::shared_ptr<Schema> schema);
+  ~RecordBatchImporter();
+
+  /// \brief Import a record batch; the ArrowArray struct has its contents
+  /// moved to a private object held alive by the result.
+  Result<std::shared_ptr<RecordBatch>> Import(struct ArrowArray* array);
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// @}
 
 /// \defgroup c-data-device-interface Functions for working with the C data device
@@ -484,6 +535,52 @@ Future<> ExportAsyncRecordBatchReader(
     AsyncGenerator<std::shared_ptr<RecordBatch>> generator,
     DeviceAllocationType device_type, struct ArrowAsyncDeviceStreamHandler* handler);
 
+/// \brief EXPERIMENTAL: An imported ArrowArrayStream exposed as an asynchronous
+/// record batch generator.
+struct AsyncRecordBatchStream {
+  std::shared_ptr<Schema> schema;
+  AsyncGenerator<std::shared_ptr<RecordBatch>> generator;
+};
+
+/// \brief EXPERIMENTAL: Import the C stream interface as an asynchronous record
+/// batch generator.
+///
+/// The ArrowArrayStream struct has its contents moved to a private object kept
+/// alive by the returned generator.  The stream's blocking get_next callback is
+/// run as tasks on the given I/O executor, reading up to prefetch_depth record
+/// batches ahead of the consumer, so that awaiting the generator never blocks a
+/// CPU thread on a slow producer.
+///
+/// \param[in,out] stream C stream interface struct
+/// \param[in] prefetch_depth maximum number of record batches to read ahead
+/// \param[in] io_executor executor to run the blocking get_next calls on;
+///     defaults to the process-wide I/O thread pool
+/// \return the stream schema and a generator yielding its record batches
+ARROW_EXPORT
+Result<AsyncRecordBatchStream> ImportAsyncRecordBatchStream(
+    struct ArrowArrayStream* stream, int prefetch_depth = 4,
+    internal::Executor* io_executor = NULLPTR);
+
+/// \brief EXPERIMENTAL: Export an asynchronous record batch generator using the
+/// C stream interface.
+///
+/// The resulting ArrowArrayStream struct keeps the generator alive.  Up to
+/// prefetch_depth record batches are pumped from the generator ahead of the
+/// consumer, so the producer keeps running on its own executor while the
+/// consumer processes data; the blocking get_next callback only waits when the
+/// prefetch queue is empty.
+///
+/// \param[in] schema the schema of the stream being exported
+/// \param[in] generator a generator that asynchronously produces record batches
+/// \param[in] prefetch_depth maximum number of record batches to pump ahead of
+///     the consumer
+/// \param[out] out C struct to export the stream to
+ARROW_EXPORT
+Status ExportAsyncRecordBatchStream(
+    std::shared_ptr<Schema> schema,
+    AsyncGenerator<std::shared_ptr<RecordBatch>> generator, int prefetch_depth,
+    struct ArrowArrayStream* out);
+
 /// @}
 
 }  // namespace arrow
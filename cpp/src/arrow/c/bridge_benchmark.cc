@@ -146,6 +146,33 @@ static void ExportImportRecordBatch(
   state.SetItemsProcessed(state.iterations());
 }
 
+static void BulkExportRecordBatch(
+    benchmark::State& state) {  // NOLINT non-const reference
+  struct ArrowArray c_export;
+  auto batch = ExampleRecordBatch();
+  RecordBatchExporter exporter(batch->schema());
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(exporter.Export(*batch, &c_export));
+    ArrowArrayRelease(&c_export);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BulkExportImportRecordBatch(
+    benchmark::State& state) {  // NOLINT non-const reference
+  struct ArrowArray c_export;
+  auto batch = ExampleRecordBatch();
+  RecordBatchExporter exporter(batch->schema());
+  RecordBatchImporter importer(batch->schema());
+
+  for (auto _ : state) {
+    ABORT_NOT_OK(exporter.Export(*batch, &c_export));
+    importer.Import(&c_export).ValueOrDie();
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
 BENCHMARK(ExportType);
 BENCHMARK(ExportSchema);
 BENCHMARK(ExportArray);
@@ -156,4 +183,7 @@ BENCHMARK(ExportImportSchema);
 BENCHMARK(ExportImportArray);
 BENCHMARK(ExportImportRecordBatch);
 
+BENCHMARK(BulkExportRecordBatch);
+BENCHMARK(BulkExportImportRecordBatch);
+
 }  // namespace arrow::benchmarks
@@ -4195,6 +4195,107 @@ TEST_F(TestArrayRoundtrip, RecordBatch) {
   }
 }
 
+class TestRecordBatchBulkRoundtrip : public ::testing::Test {
+ public:
+  void SetUp() override { pool_ = default_memory_pool(); }
+
+  // Cross-check the bulk exporter and importer against the generic
+  // per-batch functions, in all combinations.
+  void TestRoundtrip(const std::shared_ptr<RecordBatch>& batch) {
+    RecordBatchExporter exporter(batch->schema());
+    RecordBatchImporter importer(batch->schema());
+
+    auto orig_bytes = pool_->bytes_allocated();
+
+    // Bulk export -> generic import
+    {
+      struct ArrowArray c_array {};
+      struct ArrowSchema c_schema {};
+      ArrayExportGuard array_guard(&c_array);
+      SchemaExportGuard schema_guard(&c_schema);
+      ASSERT_OK(exporter.ExportSchema(&c_schema));
+      ASSERT_OK(exporter.Export(*batch, &c_array));
+      ASSERT_OK_AND_ASSIGN(auto imported, ImportRecordBatch(&c_array, &c_schema));
+      ASSERT_TRUE(ArrowArrayIsReleased(&c_array));
+      ASSERT_OK(imported->ValidateFull());
+      AssertBatchesEqual(*batch, *imported);
+    }
+    // Generic export -> bulk import
+    {
+      struct ArrowArray c_array {};
+      ArrayExportGuard array_guard(&c_array);
+      ASSERT_OK(ExportRecordBatch(*batch, &c_array));
+      ASSERT_OK_AND_ASSIGN(auto imported, importer.Import(&c_array));
+      ASSERT_TRUE(ArrowArrayIsReleased(&c_array));
+      ASSERT_OK(imported->ValidateFull());
+      AssertBatchesEqual(*batch, *imported);
+    }
+    // Bulk export -> bulk import, twice to exercise reuse of the
+    // compiled schema state across batches
+    for (int i = 0; i < 2; ++i) {
+      struct ArrowArray c_array {};
+      ArrayExportGuard array_guard(&c_array);
+      ASSERT_OK(exporter.Export(*batch, &c_array));
+      ASSERT_OK_AND_ASSIGN(auto imported, importer.Import(&c_array));
+      ASSERT_TRUE(ArrowArrayIsReleased(&c_array));
+      ASSERT_OK(imported->ValidateFull());
+      AssertBatchesEqual(*batch, *imported);
+    }
+    ASSERT_EQ(pool_->bytes_allocated(), orig_bytes);
+  }
+
+ protected:
+  MemoryPool* pool_;
+};
+
+TEST_F(TestRecordBatchBulkRoundtrip, Primitive) {
+  auto schema = ::arrow::schema({field("ints", int16()), field("bools", boolean()),
+                                 field("strs", utf8()), field("doubles", float64())});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [1, true, "foo", 1.5],
+    [2, false, "", null],
+    [null, null, null, 3.25]
+  ])");
+  TestRoundtrip(batch);
+}
+
+TEST_F(TestRecordBatchBulkRoundtrip, Nested) {
+  auto schema = ::arrow::schema(
+      {field("ls", list(struct_({field("a", int32()), field("b", utf8())}))),
+       field("fsl", fixed_size_list(int8(), 2)),
+       field("ll", large_list(large_utf8()))});
+  auto batch = RecordBatchFromJSON(schema, R"([
+    [[{"a": 1, "b": "x"}], [3, 4], [["foo"], null]],
+    [[], null, []],
+    [null, [null, 6], [[]]]
+  ])");
+  TestRoundtrip(batch);
+}
+
+TEST_F(TestRecordBatchBulkRoundtrip, EmptyBatch) {
+  auto schema = ::arrow::schema({field("ints", int64()), field("strs", utf8())});
+  auto batch = RecordBatchFromJSON(schema, "[]");
+  TestRoundtrip(batch);
+}
+
+TEST_F(TestRecordBatchBulkRoundtrip, ImporterFallback) {
+  // Dictionaries have no fast import path; the importer falls back to the
+  // generic path transparently.
+  auto schema = ::arrow::schema({field("dicts", dictionary(int32(), utf8()))});
+  auto batch = RecordBatchFromJSON(schema, R"([["foo"], ["bar"], [null], ["foo"]])");
+  TestRoundtrip(batch);
+}
+
+TEST_F(TestRecordBatchBulkRoundtrip, SchemaMismatch) {
+  auto schema = ::arrow::schema({field("ints", int16())});
+  RecordBatchExporter exporter(schema);
+
+  auto other_schema = ::arrow::schema({field("ints", int32())});
+  auto batch = RecordBatchFromJSON(other_schema, "[[1], [2]]");
+  struct ArrowArray c_array {};
+  ASSERT_RAISES(Invalid, exporter.Export(*batch, &c_array));
+}
+
 class TestDeviceArrayRoundtrip : public ::testing::Test {
  public:
   using ArrayFactory = std::function<Result<std::shared_ptr<Array>>()>;
@@ -5432,4 +5533,86 @@ TEST_F(TestAsyncDeviceArrayStreamRoundTrip, PropagateError) {
   internal::GetCpuThreadPool()->WaitForIdle();
 }
 
+class TestAsyncRecordBatchStream : public ::testing::Test {
+ public:
+  static std::vector<std::shared_ptr<RecordBatch>> ExampleBatches(
+      const std::shared_ptr<Schema>& schema) {
+    return {RecordBatchFromJSON(schema, "[[1], [2]]"),
+            RecordBatchFromJSON(schema, "[[3], [null], [5]]"),
+            RecordBatchFromJSON(schema, "[]")};
+  }
+};
+
+TEST_F(TestAsyncRecordBatchStream, RoundTrip) {
+  auto orig_schema = arrow::schema({field("ints", int32())});
+  auto batches = ExampleBatches(orig_schema);
+
+  struct ArrowArrayStream c_stream;
+  ASSERT_OK(ExportAsyncRecordBatchStream(orig_schema, MakeVectorGenerator(batches),
+                                         /*prefetch_depth=*/2, &c_stream));
+
+  ASSERT_OK_AND_ASSIGN(auto stream, ImportAsyncRecordBatchStream(&c_stream));
+  ASSERT_TRUE(ArrowArrayStreamIsReleased(&c_stream));
+  ASSERT_NO_FATAL_FAILURE(AssertSchemaEqual(*orig_schema, *stream.schema));
+
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto results, CollectAsyncGenerator(stream.generator));
+  ASSERT_EQ(results.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    AssertBatchesEqual(*batches[i], *results[i]);
+  }
+
+  internal::GetCpuThreadPool()->WaitForIdle();
+}
+
+TEST_F(TestAsyncRecordBatchStream, ImportFromSyncReader) {
+  auto orig_schema = arrow::schema({field("ints", int32())});
+  auto batches = ExampleBatches(orig_schema);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make(batches, orig_schema));
+
+  struct ArrowArrayStream c_stream;
+  ASSERT_OK(ExportRecordBatchReader(reader, &c_stream));
+
+  ASSERT_OK_AND_ASSIGN(auto stream,
+                       ImportAsyncRecordBatchStream(&c_stream, /*prefetch_depth=*/1));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto results, CollectAsyncGenerator(stream.generator));
+  ASSERT_EQ(results.size(), batches.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    AssertBatchesEqual(*batches[i], *results[i]);
+  }
+
+  internal::GetCpuThreadPool()->WaitForIdle();
+}
+
+TEST_F(TestAsyncRecordBatchStream, PropagateError) {
+  auto orig_schema = arrow::schema({field("ints", int32())});
+
+  struct ArrowArrayStream c_stream;
+  ASSERT_OK(ExportAsyncRecordBatchStream(
+      orig_schema,
+      MakeFailingGenerator<std::shared_ptr<RecordBatch>>(
+          Status::UnknownError("expected failure")),
+      /*prefetch_depth=*/2, &c_stream));
+
+  ASSERT_OK_AND_ASSIGN(auto stream, ImportAsyncRecordBatchStream(&c_stream));
+  auto collect_fut = CollectAsyncGenerator(stream.generator);
+  ASSERT_FINISHES_AND_RAISES(UnknownError, collect_fut);
+
+  internal::GetCpuThreadPool()->WaitForIdle();
+}
+
+TEST_F(TestAsyncRecordBatchStream, InvalidPrefetchDepth) {
+  auto orig_schema = arrow::schema({field("ints", int32())});
+  auto batches = ExampleBatches(orig_schema);
+
+  struct ArrowArrayStream c_stream;
+  ASSERT_RAISES(Invalid,
+                ExportAsyncRecordBatchStream(orig_schema, MakeVectorGenerator(batches),
+                                             /*prefetch_depth=*/0, &c_stream));
+
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchReader::Make(batches, orig_schema));
+  ASSERT_OK(ExportRecordBatchReader(reader, &c_stream));
+  ASSERT_RAISES(Invalid, ImportAsyncRecordBatchStream(&c_stream, /*prefetch_depth=*/0));
+  ArrowArrayStreamRelease(&c_stream);
+}
+
 }  // namespace arrow
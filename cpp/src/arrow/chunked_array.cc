@@ -111,6 +111,29 @@ bool ChunkedArray::Equals(const ChunkedArray& other, const EqualOptions& opts) c
     return false;
   }
 
+  // When the chunk layouts match, compare any memoized content hashes first:
+  // an unequal hash proves unequal contents without re-reading the data.
+  // Hashes are only looked up, never computed here, so this pre-pass is free;
+  // equal (or missing) hashes fall through to the full comparison below.
+  if (num_chunks() == other.num_chunks()) {
+    bool layouts_match = true;
+    for (int i = 0; i < num_chunks(); i++) {
+      if (chunk(i)->length() != other.chunk(i)->length()) {
+        layouts_match = false;
+        break;
+      }
+    }
+    if (layouts_match) {
+      for (int i = 0; i < num_chunks(); i++) {
+        const uint64_t left_hash = chunk(i)->data()->content_hash.load();
+        const uint64_t right_hash = other.chunk(i)->data()->content_hash.load();
+        if (left_hash != 0 && right_hash != 0 && left_hash != right_hash) {
+          return false;
+        }
+      }
+    }
+  }
+
   // Check contents of the underlying arrays. This checks for equality of
   // the underlying data independently of the chunk size.
   return internal::ApplyBinaryChunked(
@@ -153,6 +153,25 @@ TEST_F(TestChunkedArray, EqualsDifferingMetadata) {
   ASSERT_TRUE(left.Equals(right));
 }
 
+TEST_F(TestChunkedArray, EqualsWithPrecomputedContentHashes) {
+  auto left = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int32(), "[1, 2]"), ArrayFromJSON(int32(), "[3, 4]")});
+  auto equal = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int32(), "[1, 2]"), ArrayFromJSON(int32(), "[3, 4]")});
+  auto unequal = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(int32(), "[1, 2]"), ArrayFromJSON(int32(), "[3, 5]")});
+
+  // Memoize the content hashes so that Equals can use them as an early exit
+  for (const auto& chunked : {left, equal, unequal}) {
+    for (const auto& chunk : chunked->chunks()) {
+      ASSERT_NE(0, chunk->data()->GetContentHash());
+    }
+  }
+
+  ASSERT_TRUE(left->Equals(equal));
+  ASSERT_FALSE(left->Equals(unequal));
+}
+
 TEST_F(TestChunkedArray, EqualsSameAddressWithNaNs) {
   auto chunk_with_nan1 = ArrayFromJSON(float64(), "[0, 1, 2, NaN]");
   auto chunk_without_nan1 = ArrayFromJSON(float64(), "[3, 4, 5]");
@@ -126,6 +126,10 @@ namespace {
 using ::arrow::internal::DataMember;
 static auto kFilterOptionsType = GetFunctionOptionsType<FilterOptions>(
     DataMember("null_selection_behavior", &FilterOptions::null_selection_behavior));
+static auto kFilterCompareOptionsType = GetFunctionOptionsType<FilterCompareOptions>(
+    DataMember("comparison", &FilterCompareOptions::comparison),
+    DataMember("null_selection_behavior",
+               &FilterCompareOptions::null_selection_behavior));
 static auto kTakeOptionsType = GetFunctionOptionsType<TakeOptions>(
     DataMember("boundscheck", &TakeOptions::boundscheck));
 static auto kDictionaryEncodeOptionsType =
@@ -176,6 +180,14 @@ FilterOptions::FilterOptions(NullSelectionBehavior null_selection)
       null_selection_behavior(null_selection) {}
 constexpr char FilterOptions::kTypeName[];
 
+FilterCompareOptions::FilterCompareOptions(std::string comparison,
+                                           FilterOptions::NullSelectionBehavior
+                                               null_selection)
+    : FunctionOptions(internal::kFilterCompareOptionsType),
+      comparison(std::move(comparison)),
+      null_selection_behavior(null_selection) {}
+constexpr char FilterCompareOptions::kTypeName[];
+
 TakeOptions::TakeOptions(bool boundscheck)
     : FunctionOptions(internal::kTakeOptionsType), boundscheck(boundscheck) {}
 constexpr char TakeOptions::kTypeName[];
@@ -269,6 +281,7 @@ constexpr char ScatterOptions::kTypeName[];
 namespace internal {
 void RegisterVectorOptions(FunctionRegistry* registry) {
   DCHECK_OK(registry->AddFunctionOptionsType(kFilterOptionsType));
+  DCHECK_OK(registry->AddFunctionOptionsType(kFilterCompareOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kTakeOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kDictionaryEncodeOptionsType));
   DCHECK_OK(registry->AddFunctionOptionsType(kRunEndEncodeOptionsType));
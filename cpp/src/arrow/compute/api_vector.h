@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <string>
 #include <utility>
 
 #include "arrow/compute/function_options.h"
@@ -50,6 +51,23 @@ class ARROW_EXPORT FilterOptions : public FunctionOptions {
   NullSelectionBehavior null_selection_behavior = DROP;
 };
 
+/// \brief Options for the filter_compare function
+class ARROW_EXPORT FilterCompareOptions : public FunctionOptions {
+ public:
+  explicit FilterCompareOptions(
+      std::string comparison = "greater",
+      FilterOptions::NullSelectionBehavior null_selection = FilterOptions::DROP);
+  static constexpr char const kTypeName[] = "FilterCompareOptions";
+  static FilterCompareOptions Defaults() { return FilterCompareOptions(); }
+
+  /// Name of the binary comparison function evaluated on (`on`, `against`),
+  /// one of "equal", "not_equal", "greater", "greater_equal", "less",
+  /// "less_equal".
+  std::string comparison = "greater";
+  /// Handling of null comparison results, as in FilterOptions
+  FilterOptions::NullSelectionBehavior null_selection_behavior = FilterOptions::DROP;
+};
+
 class ARROW_EXPORT TakeOptions : public FunctionOptions {
  public:
   explicit TakeOptions(bool boundscheck = true);
@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <sstream>
 #include <utility>
@@ -43,16 +44,21 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_block_counter.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/metrics.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
 
+using internal::BitBlockCount;
+using internal::BitBlockCounter;
 using internal::BitmapAnd;
 using internal::checked_cast;
 using internal::CopyBitmap;
@@ -263,6 +269,27 @@ Result<std::shared_ptr<RecordBatch>> ExecBatch::ToRecordBatch(
   return RecordBatch::Make(std::move(schema), length, std::move(columns));
 }
 
+Result<ExecBatch> ExecBatch::Materialize(ExecContext* ctx) const {
+  if (selection_vector == nullptr) {
+    return *this;
+  }
+  ExecBatch out;
+  out.values.resize(values.size());
+  const Datum indices(selection_vector->data());
+  for (size_t i = 0; i < values.size(); ++i) {
+    if (values[i].is_scalar()) {
+      out.values[i] = values[i];
+    } else {
+      ARROW_ASSIGN_OR_RAISE(out.values[i],
+                            CallFunction("take", {values[i], indices}, ctx));
+    }
+  }
+  out.length = selection_vector->length();
+  out.guarantee = guarantee;
+  out.index = index;
+  return out;
+}
+
 namespace {
 
 Result<std::shared_ptr<Buffer>> AllocateDataBuffer(KernelContext* ctx, int64_t length,
@@ -342,16 +369,28 @@ bool CheckIfAllScalar(const ExecBatch& batch) {
 }  // namespace
 
 Status ExecSpanIterator::Init(const ExecBatch& batch, int64_t max_chunksize,
-                              bool promote_if_all_scalars) {
+                              bool promote_if_all_scalars, bool validate_shapes) {
   if (batch.num_values() > 0) {
-    // Validate arguments
-    bool all_args_same_length = false;
-    int64_t inferred_length = InferBatchLength(batch.values, &all_args_same_length);
-    if (inferred_length != batch.length) {
-      return Status::Invalid("Value lengths differed from ExecBatch length");
-    }
-    if (!all_args_same_length) {
-      return Status::Invalid("Array arguments must all be the same length");
+    if (validate_shapes) {
+      // Validate arguments
+      bool all_args_same_length = false;
+      int64_t inferred_length = InferBatchLength(batch.values, &all_args_same_length);
+      if (inferred_length != batch.length) {
+        return Status::Invalid("Value lengths differed from ExecBatch length");
+      }
+      if (!all_args_same_length) {
+        return Status::Invalid("Array arguments must all be the same length");
+      }
+    } else {
+#ifndef NDEBUG
+      // The caller promised that the batch shape was validated when the plan
+      // was bound; keep the invariants checked in debug builds
+      bool all_args_same_length = false;
+      int64_t inferred_length = InferBatchLength(batch.values, &all_args_same_length);
+      DCHECK_EQ(inferred_length, batch.length)
+          << "Value lengths differed from ExecBatch length";
+      DCHECK(all_args_same_length) << "Array arguments must all be the same length";
+#endif
     }
   }
   args_ = &batch.values;
@@ -475,6 +514,35 @@ namespace {
 struct NullGeneralization {
   enum type { PERHAPS_NULL, ALL_VALID, ALL_NULL };
 
+  // Classify an array whose null count has not been computed yet by scanning
+  // its validity bitmap one 64-bit block at a time. All-valid and all-null
+  // bitmaps are detected in a single popcount pass (and the exact null count
+  // is cached on the span, like ArraySpan::GetNullCount() would), while the
+  // scan is abandoned as soon as a block with both set and unset bits is
+  // seen. This lets downstream kernels take their non-null-checked fast
+  // paths for inputs that are all valid but were sliced or otherwise lost
+  // their precomputed null count.
+  static type GetFromBitmap(const ArraySpan& arr) {
+    BitBlockCounter counter(arr.buffers[0].data, arr.offset, arr.length);
+    int64_t valid_count = 0;
+    for (int64_t scanned = 0; scanned < arr.length;) {
+      BitBlockCount block = counter.NextWord();
+      if (block.popcount != 0 && block.popcount != block.length) {
+        return PERHAPS_NULL;
+      }
+      valid_count += block.popcount;
+      scanned += block.length;
+    }
+    arr.null_count = arr.length - valid_count;
+    if (arr.null_count == 0) {
+      return ALL_VALID;
+    }
+    if (arr.null_count == arr.length) {
+      return ALL_NULL;
+    }
+    return PERHAPS_NULL;
+  }
+
   static type Get(const ExecValue& value) {
     const auto dtype_id = value.type()->id();
     if (dtype_id == Type::NA) {
@@ -487,13 +555,15 @@ struct NullGeneralization {
       return value.scalar->is_valid ? ALL_VALID : ALL_NULL;
     } else {
       const ArraySpan& arr = value.array;
-      // Do not count the bits if they haven't been counted already
       if ((arr.null_count == 0) || (arr.buffers[0].data == nullptr)) {
         return ALL_VALID;
       }
       if (arr.null_count == arr.length) {
         return ALL_NULL;
       }
+      if (arr.null_count == kUnknownNullCount) {
+        return GetFromBitmap(arr);
+      }
     }
     return PERHAPS_NULL;
   }
@@ -727,7 +797,11 @@ class KernelExecutorImpl : public KernelExecutor {
   // Kernel::mem_allocation is not MemAllocation::PREALLOCATE, then no
   // data buffers will be set
   Result<std::shared_ptr<ArrayData>> PrepareOutput(int64_t length) {
-    auto out = std::make_shared<ArrayData>(output_type_.GetSharedPtr(), length);
+    // Serve output descriptors from the recycling pool: batch-heavy plans
+    // churn one ArrayData per kernel invocation and recycled instances keep
+    // the capacity of their buffer vectors.
+    auto out =
+        ArrayDataPool::Default()->MakeArrayData(output_type_.GetSharedPtr(), length);
     out->buffers.resize(output_num_buffers_);
 
     if (validity_preallocated_) {
@@ -781,7 +855,11 @@ class KernelExecutorImpl : public KernelExecutor {
 class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
  public:
   Status Execute(const ExecBatch& batch, ExecListener* listener) override {
-    RETURN_NOT_OK(span_iterator_.Init(batch, exec_context()->exec_chunksize()));
+    ARROW_METRIC_SCOPED_TIMER("arrow.compute.scalar_kernel.exec_nanos");
+    ARROW_METRIC_COUNTER_ADD("arrow.compute.scalar_kernel.rows", batch.length);
+    RETURN_NOT_OK(span_iterator_.Init(batch, exec_context()->exec_chunksize(),
+                                      /*promote_if_all_scalars=*/true,
+                                      exec_context()->validate_batch_shapes()));
 
     if (batch.length == 0) {
       // For zero-length batches, we do nothing except return a zero-length
@@ -824,6 +902,31 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
   }
 
  protected:
+  // Like PrepareOutput, but serve the output from the eligible input's own
+  // allocation (determined in SetupPreallocation) when it covers the whole
+  // requested length.  Scalar kernels only depend on the same-position input
+  // values, so writing the output over the input is safe.
+  Result<std::shared_ptr<ArrayData>> PrepareOrReuseOutput(int64_t length) {
+    if (reusable_input_ == nullptr || reusable_input_->length != length) {
+      return PrepareOutput(length);
+    }
+    auto out = std::make_shared<ArrayData>(output_type_.GetSharedPtr(), length);
+    out->buffers.resize(output_num_buffers_);
+    out->buffers[1] = reusable_input_->buffers[1];
+    if (validity_preallocated_) {
+      if (IsExclusivelyOwned(reusable_input_->buffers[0])) {
+        out->buffers[0] = reusable_input_->buffers[0];
+      } else {
+        ARROW_ASSIGN_OR_RAISE(out->buffers[0], kernel_ctx_->AllocateBitmap(length));
+      }
+    }
+    if (kernel_->null_handling == NullHandling::OUTPUT_NOT_NULL) {
+      out->null_count = 0;
+    }
+    reusable_input_.reset();
+    return out;
+  }
+
   Status EmitResult(std::shared_ptr<ArrayData> out, ExecListener* listener) {
     if (span_iterator_.have_all_scalars()) {
       // ARROW-16757 We boxed scalar inputs as ArraySpan, so now we have to
@@ -846,8 +949,9 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
     ArraySpan* output_span = output.array_span_mutable();
 
     if (preallocate_contiguous_) {
-      // Make one big output allocation
-      ARROW_ASSIGN_OR_RAISE(preallocation, PrepareOutput(span_iterator_.length()));
+      // Make one big output allocation (or reuse an exclusively-held input)
+      ARROW_ASSIGN_OR_RAISE(preallocation,
+                            PrepareOrReuseOutput(span_iterator_.length()));
 
       // Populate and then reuse the ArraySpan inside
       output_span->SetMembers(*preallocation);
@@ -867,7 +971,7 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
       // We preallocate (maybe) only for the output of processing the current
       // chunk
       while (span_iterator_.Next(&input)) {
-        ARROW_ASSIGN_OR_RAISE(preallocation, PrepareOutput(input.length));
+        ARROW_ASSIGN_OR_RAISE(preallocation, PrepareOrReuseOutput(input.length));
         output_span->SetMembers(*preallocation);
         RETURN_NOT_OK(ExecuteSingleSpan(input, &output));
         // Emit the result for this chunk
@@ -980,6 +1084,27 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
     preallocate_contiguous_ =
         (exec_context()->preallocate_contiguous() && kernel_->can_write_into_slices &&
          preallocating_all_buffers_);
+
+    // Copy-on-write execution: scalar kernels are elementwise, so when the
+    // caller allows it and an input array of the output type has exclusively
+    // owned buffers, that input's allocation can serve as the preallocated
+    // output (see PrepareOrReuseOutput)
+    reusable_input_.reset();
+    if (exec_context()->allow_buffer_reuse() && preallocating_all_buffers_ &&
+        output_num_buffers_ == 2) {
+      for (const Datum& arg : args) {
+        if (!arg.is_array()) continue;
+        const std::shared_ptr<ArrayData>& data = arg.array();
+        if (data->offset != 0 || data->length != total_length ||
+            !output_type_.type->Equals(*data->type)) {
+          continue;
+        }
+        if (IsExclusivelyOwned(data->buffers[1])) {
+          reusable_input_ = data;
+          break;
+        }
+      }
+    }
     return Status::OK();
   }
 
@@ -997,6 +1122,10 @@ class ScalarExecutor : public KernelExecutorImpl<ScalarKernel> {
   // iterate through it while executing the kernel in chunks
   bool preallocate_contiguous_ = false;
 
+  // An input whose allocation may be handed to the kernel as its output
+  // (copy-on-write execution, see SetupPreallocation)
+  std::shared_ptr<ArrayData> reusable_input_;
+
   ExecSpanIterator span_iterator_;
 };
 
@@ -1022,6 +1151,8 @@ Status CheckCanExecuteChunked(const VectorKernel* kernel) {
 class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
  public:
   Status Execute(const ExecBatch& batch, ExecListener* listener) override {
+    ARROW_METRIC_SCOPED_TIMER("arrow.compute.vector_kernel.exec_nanos");
+    ARROW_METRIC_COUNTER_ADD("arrow.compute.vector_kernel.rows", batch.length);
     // Some vector kernels have a separate code path for handling
     // chunked arrays (VectorKernel::exec_chunked) so we check if we
     // have any chunked arrays. If we do and an exec_chunked function
@@ -1042,8 +1173,30 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
       ComputeDataPreallocate(*output_type_.type, &data_preallocated_);
     }
 
+    // In-place execution: when the kernel opts in, the caller allows it and
+    // the input allocation is provably not referenced anywhere else, hand the
+    // input's buffers to the kernel as its output instead of allocating
+    if (kernel_->can_reuse_input_buffers && exec_context()->allow_buffer_reuse() &&
+        batch.num_values() == 1 && batch.values[0].is_array()) {
+      const std::shared_ptr<ArrayData>& data = batch.values[0].array();
+      if (data->offset == 0 && output_type_.type->Equals(*data->type)) {
+        bool exclusively_held = true;
+        for (const auto& buffer : data->buffers) {
+          if (buffer != nullptr && !IsExclusivelyOwned(buffer)) {
+            exclusively_held = false;
+            break;
+          }
+        }
+        if (exclusively_held) {
+          reusable_input_ = data;
+        }
+      }
+    }
+
     if (kernel_->can_execute_chunkwise) {
-      RETURN_NOT_OK(span_iterator_.Init(batch, exec_context()->exec_chunksize()));
+      RETURN_NOT_OK(span_iterator_.Init(batch, exec_context()->exec_chunksize(),
+                                        /*promote_if_all_scalars=*/true,
+                                        exec_context()->validate_batch_shapes()));
       ExecSpan span;
       while (span_iterator_.Next(&span)) {
         RETURN_NOT_OK(Exec(span, listener));
@@ -1102,7 +1255,15 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
 
   Status Exec(const ExecSpan& span, ExecListener* listener) {
     ExecResult out;
-    ARROW_ASSIGN_OR_RAISE(out.value, PrepareOutput(span.length));
+    if (reusable_input_ != nullptr && span.length == reusable_input_->length) {
+      auto out_data =
+          std::make_shared<ArrayData>(output_type_.GetSharedPtr(), span.length);
+      out_data->buffers = reusable_input_->buffers;
+      reusable_input_ = nullptr;
+      out.value = std::move(out_data);
+    } else {
+      ARROW_ASSIGN_OR_RAISE(out.value, PrepareOutput(span.length));
+    }
     if (kernel_->null_handling == NullHandling::INTERSECTION) {
       RETURN_NOT_OK(PropagateNulls(kernel_ctx_, span, out.array_data().get()));
     }
@@ -1125,6 +1286,9 @@ class VectorExecutor : public KernelExecutorImpl<VectorKernel> {
 
   ExecSpanIterator span_iterator_;
   std::vector<Datum> results_;
+  // Input whose buffers may be handed to the kernel as output; consumed by
+  // the first full-length span (chunked execution never qualifies)
+  std::shared_ptr<ArrayData> reusable_input_;
 };
 
 class ScalarAggExecutor : public KernelExecutorImpl<ScalarAggregateKernel> {
@@ -1137,7 +1301,8 @@ class ScalarAggExecutor : public KernelExecutorImpl<ScalarAggregateKernel> {
 
   Status Execute(const ExecBatch& batch, ExecListener* listener) override {
     RETURN_NOT_OK(span_iterator_.Init(batch, exec_context()->exec_chunksize(),
-                                      /*promote_if_all_scalars=*/false));
+                                      /*promote_if_all_scalars=*/false,
+                                      exec_context()->validate_batch_shapes()));
 
     ExecSpan span;
     while (span_iterator_.Next(&span)) {
@@ -1340,6 +1505,13 @@ ExecContext::ExecContext(MemoryPool* pool, ::arrow::internal::Executor* executor
 
 const CpuInfo* ExecContext::cpu_info() const { return CpuInfo::GetInstance(); }
 
+void ExecContext::set_inline_task_cost_threshold(int64_t max_cpu_cost) {
+  inline_task_cost_threshold_ = max_cpu_cost;
+  if (executor_ != NULLPTR) {
+    executor_->SetInlineCostThreshold(max_cpu_cost);
+  }
+}
+
 // ----------------------------------------------------------------------
 // SelectionVector
 
@@ -1356,7 +1528,34 @@ int32_t SelectionVector::length() const { return static_cast<int32_t>(data_->len
 
 Result<std::shared_ptr<SelectionVector>> SelectionVector::FromMask(
     const BooleanArray& arr) {
-  return Status::NotImplemented("FromMask");
+  if (arr.length() > std::numeric_limits<int32_t>::max()) {
+    return Status::NotImplemented(
+        "Selection vectors for arrays with more than 2**31-1 elements");
+  }
+  // Nulls in the mask are unselected, so the number of indices is the
+  // number of valid true values
+  const int64_t num_selected = arr.true_count();
+  ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                        AllocateBuffer(num_selected * sizeof(int32_t)));
+  auto* out = reinterpret_cast<int32_t*>(indices_buffer->mutable_data());
+  const uint8_t* validity =
+      arr.null_count() > 0 ? arr.data()->buffers[0]->data() : nullptr;
+  const int64_t offset = arr.offset();
+  ::arrow::internal::VisitSetBitRunsVoid(
+      arr.data()->buffers[1]->data(), offset, arr.length(),
+      [&](int64_t run_position, int64_t run_length) {
+        for (int64_t i = 0; i < run_length; ++i) {
+          const int64_t position = run_position + i;
+          if (validity == nullptr || bit_util::GetBit(validity, offset + position)) {
+            *out++ = static_cast<int32_t>(position);
+          }
+        }
+      });
+  DCHECK_EQ(out - reinterpret_cast<int32_t*>(indices_buffer->mutable_data()),
+            num_selected);
+  auto data = ArrayData::Make(int32(), num_selected,
+                              {nullptr, std::move(indices_buffer)}, /*null_count=*/0);
+  return std::make_shared<SelectionVector>(std::move(data));
 }
 
 Result<Datum> CallFunction(const std::string& func_name, const std::vector<Datum>& args,
@@ -110,13 +110,52 @@ class ARROW_EXPORT ExecContext {
   /// set_preallocate_contiguous() for more information.
   bool preallocate_contiguous() const { return preallocate_contiguous_; }
 
+  // Allow length-preserving vector kernels that declare
+  // VectorKernel::can_reuse_input_buffers to write their output into the
+  // input's own allocation when the input buffers are not referenced
+  // anywhere else. The caller thereby accepts that an input array passed to
+  // such a function may be mutated: its contents become the function output.
+  // Off by default.
+  void set_allow_buffer_reuse(bool allow) { allow_buffer_reuse_ = allow; }
+
+  /// \brief If eligible vector kernels may write into exclusively-held input
+  /// buffers. See set_allow_buffer_reuse() for more information.
+  bool allow_buffer_reuse() const { return allow_buffer_reuse_; }
+
+  // Skip per-batch argument shape validation (length consistency between an
+  // ExecBatch and its values) in the kernel execution hot loop. Intended for
+  // callers such as query engines that validate batch shapes once when a plan
+  // is bound and then execute many small batches against it. Debug builds
+  // still check the invariants via assertions. Validation is on by default.
+  void set_validate_batch_shapes(bool validate) { validate_batch_shapes_ = validate; }
+
+  /// \brief If per-batch argument shape validation is performed during kernel
+  /// execution. See set_validate_batch_shapes() for more information.
+  bool validate_batch_shapes() const { return validate_batch_shapes_; }
+
+  // Set the maximum estimated task cost (TaskHints::cpu_cost, in
+  // instructions) below which work submitted through this context's executor
+  // should run inline in the submitting thread instead of being scheduled.
+  // Applied to the executor (see Executor::SetInlineCostThreshold) when this
+  // context is handed a private executor; components submitting
+  // cost-annotated tasks may also consult it directly. Zero (the default)
+  // disables inline execution.
+  void set_inline_task_cost_threshold(int64_t max_cpu_cost);
+
+  /// \brief The maximum estimated task cost for inline execution. See
+  /// set_inline_task_cost_threshold() for more information.
+  int64_t inline_task_cost_threshold() const { return inline_task_cost_threshold_; }
+
  private:
   MemoryPool* pool_;
   ::arrow::internal::Executor* executor_;
   FunctionRegistry* func_registry_;
   int64_t exec_chunksize_ = std::numeric_limits<int64_t>::max();
+  int64_t inline_task_cost_threshold_ = 0;
   bool preallocate_contiguous_ = true;
   bool use_threads_ = true;
+  bool allow_buffer_reuse_ = false;
+  bool validate_batch_shapes_ = true;
 };
 
 // TODO: Consider standardizing on uint16 selection vectors and only use them
@@ -131,7 +170,8 @@ class ARROW_EXPORT ExecContext {
 /// implementations. This is especially relevant for aggregations but also
 /// applies to scalar operations.
 ///
-/// We are not yet using this so this is mostly a placeholder for now.
+/// Kernels do not yet consume selection vectors directly; a batch carrying
+/// one can be materialized with ExecBatch::Materialize().
 ///
 /// [1]: http://cidrdb.org/cidr2005/papers/P19.pdf
 class ARROW_EXPORT SelectionVector {
@@ -141,8 +181,12 @@ class ARROW_EXPORT SelectionVector {
   explicit SelectionVector(const Array& arr);
 
   /// \brief Create SelectionVector from boolean mask
+  ///
+  /// Nulls in the mask are treated as unselected, like
+  /// FilterOptions::NullSelectionBehavior::DROP.
   static Result<std::shared_ptr<SelectionVector>> FromMask(const BooleanArray& arr);
 
+  const std::shared_ptr<ArrayData>& data() const { return data_; }
   const int32_t* indices() const { return indices_; }
   int32_t length() const;
 
@@ -192,6 +236,15 @@ struct ARROW_EXPORT ExecBatch {
   Result<std::shared_ptr<RecordBatch>> ToRecordBatch(
       std::shared_ptr<Schema> schema, MemoryPool* pool = default_memory_pool()) const;
 
+  /// \brief Materialize the deferred filter represented by the selection
+  /// vector, if any.
+  ///
+  /// Array values are gathered at the selected indices with "take" and
+  /// scalar values are passed through unchanged; the returned batch carries
+  /// no selection vector. If this batch has no selection vector it is
+  /// returned as-is.
+  Result<ExecBatch> Materialize(ExecContext* ctx = NULLPTR) const;
+
   /// The values representing positional arguments to be passed to a kernel's
   /// exec function for processing.
   std::vector<Datum> values;
@@ -54,8 +54,12 @@ class ARROW_EXPORT ExecSpanIterator {
   /// \param[in] promote_if_all_scalars if all of the values are scalars,
   /// return them in each ExecSpan as ArraySpan of length 1. This must be set
   /// to true for Scalar and Vector executors but false for Aggregators
+  /// \param[in] validate_shapes if true, validate that the value lengths are
+  /// consistent with the batch length. Callers that validated the batch shape
+  /// up front (e.g. when binding a plan) may pass false to skip the check in
+  /// release builds; debug builds still assert the invariants
   Status Init(const ExecBatch& batch, int64_t max_chunksize = kDefaultMaxChunksize,
-              bool promote_if_all_scalars = true);
+              bool promote_if_all_scalars = true, bool validate_shapes = true);
 
   /// \brief Compute the next span by updating the state of the
   /// previous span object. You must keep passing in the previous
@@ -153,6 +153,48 @@ TEST(SelectionVector, Basics) {
   ASSERT_EQ(3, sel_vector->indices()[1]);
 }
 
+TEST(SelectionVector, FromMask) {
+  auto mask = std::static_pointer_cast<BooleanArray>(
+      ArrayFromJSON(boolean(), "[true, true, false, null, true]"));
+  ASSERT_OK_AND_ASSIGN(auto sel_vector, SelectionVector::FromMask(*mask));
+
+  // Nulls in the mask are unselected
+  ASSERT_EQ(3, sel_vector->length());
+  EXPECT_EQ(0, sel_vector->indices()[0]);
+  EXPECT_EQ(1, sel_vector->indices()[1]);
+  EXPECT_EQ(4, sel_vector->indices()[2]);
+
+  auto empty_mask = std::static_pointer_cast<BooleanArray>(
+      ArrayFromJSON(boolean(), "[false, false]"));
+  ASSERT_OK_AND_ASSIGN(sel_vector, SelectionVector::FromMask(*empty_mask));
+  ASSERT_EQ(0, sel_vector->length());
+}
+
+TEST(ExecBatch, MaterializeSelection) {
+  auto values = ArrayFromJSON(int32(), "[10, 20, 30, 40]");
+  auto constant = ScalarFromJSON(utf8(), R"("z")");
+  ExecBatch batch({Datum(values), Datum(constant)}, 4);
+
+  auto mask = std::static_pointer_cast<BooleanArray>(
+      ArrayFromJSON(boolean(), "[true, false, false, true]"));
+  ASSERT_OK_AND_ASSIGN(batch.selection_vector, SelectionVector::FromMask(*mask));
+  batch.length = batch.selection_vector->length();
+
+  ASSERT_OK_AND_ASSIGN(ExecBatch materialized, batch.Materialize());
+  ASSERT_EQ(nullptr, materialized.selection_vector);
+  ASSERT_EQ(2, materialized.length);
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[10, 40]"),
+                    *materialized[0].make_array());
+  // Scalar values are passed through unchanged
+  ASSERT_TRUE(materialized[1].scalar()->Equals(*constant));
+
+  // Without a selection vector the batch is returned as-is
+  ExecBatch plain({Datum(values)}, 4);
+  ASSERT_OK_AND_ASSIGN(ExecBatch untouched, plain.Materialize());
+  ASSERT_EQ(4, untouched.length);
+  AssertArraysEqual(*values, *untouched[0].make_array());
+}
+
 void AssertValidityZeroExtraBits(const uint8_t* data, int64_t length, int64_t offset) {
   const int64_t bit_extent = ((offset + length + 7) / 8) * 8;
   for (int64_t i = offset + length; i < bit_extent; ++i) {
@@ -238,8 +280,36 @@ TEST_F(TestPropagateNulls, UnknownNullCountWithoutNulls) {
 
   ExecBatch batch({input}, length);
   ASSERT_OK(PropagateNulls(ctx_.get(), ExecSpan(batch), &output));
-  EXPECT_EQ(-1, output.null_count);
-  EXPECT_EQ(nulls.get(), output.buffers[0].get());
+  // The all-valid bitmap is detected by the block scan, so no validity
+  // bitmap is needed in the output
+  EXPECT_EQ(0, output.null_count);
+  EXPECT_EQ(nullptr, output.buffers[0]);
+}
+
+TEST_F(TestPropagateNulls, UnknownNullCountBlockScan) {
+  const int64_t length = 128;
+
+  // An all-null bitmap with an unknown null count short-circuits to all null
+  constexpr uint8_t all_null_bitmap[16] = {0};
+  auto all_null = std::make_shared<Buffer>(all_null_bitmap, 16);
+  ArrayData output(boolean(), length, {nullptr, nullptr});
+  ArrayData input(boolean(), length, {all_null, nullptr}, kUnknownNullCount);
+  ExecBatch batch({input}, length);
+  ASSERT_OK(PropagateNulls(ctx_.get(), ExecSpan(batch), &output));
+  ASSERT_EQ(length, output.null_count);
+
+  // A bitmap whose blocks are each fully valid or fully null yields an exact
+  // propagated null count
+  uint8_t half_valid_bitmap[16];
+  std::memset(half_valid_bitmap, 0xFF, 8);
+  std::memset(half_valid_bitmap + 8, 0, 8);
+  auto half_valid = std::make_shared<Buffer>(half_valid_bitmap, 16);
+  output = ArrayData(boolean(), length, {nullptr, nullptr});
+  input = ArrayData(boolean(), length, {half_valid, nullptr}, kUnknownNullCount);
+  batch = ExecBatch({input}, length);
+  ASSERT_OK(PropagateNulls(ctx_.get(), ExecSpan(batch), &output));
+  ASSERT_EQ(64, output.null_count);
+  ASSERT_EQ(half_valid.get(), output.buffers[0].get());
 }
 
 TEST_F(TestPropagateNulls, SetAllNulls) {
@@ -525,8 +595,11 @@ TEST_F(TestPropagateNullsSpans, UnknownNullCountWithoutNulls) {
 
   ExecSpan span(ExecBatch({input}, length));
   PropagateNullsSpans(span, &output);
-  ASSERT_EQ(kUnknownNullCount, output.null_count);
+  // The all-valid bitmap is detected by the block scan
+  ASSERT_EQ(0, output.null_count);
   ASSERT_EQ(0, output.GetNullCount());
+  ASSERT_EQ(255, validity_bitmap2[0]);
+  ASSERT_EQ(255, validity_bitmap2[1]);
 }
 
 TEST_F(TestPropagateNullsSpans, SetAllNulls) {
@@ -817,6 +890,21 @@ TEST_F(TestExecSpanIterator, InputValidation) {
   ASSERT_OK(iterator.Init(batch));
 }
 
+TEST_F(TestExecSpanIterator, SkipShapeValidation) {
+  // Callers that validated the batch shape up front may opt out of the
+  // per-batch checks; iteration is unaffected
+  ExecSpanIterator iterator;
+  ExecBatch batch({Datum(GetInt32Array(10)), Datum(std::make_shared<Int32Scalar>(5))},
+                  10);
+  ASSERT_OK(iterator.Init(batch, kDefaultMaxChunksize,
+                          /*promote_if_all_scalars=*/true,
+                          /*validate_shapes=*/false));
+  ExecSpan span;
+  ASSERT_TRUE(iterator.Next(&span));
+  ASSERT_EQ(10, span.length);
+  ASSERT_FALSE(iterator.Next(&span));
+}
+
 TEST_F(TestExecSpanIterator, ChunkedArrays) {
   ExecBatch batch({Datum(GetInt32Chunked({0, 20, 10})), Datum(GetInt32Chunked({15, 15})),
                    Datum(GetInt32Array(30)), Datum(std::make_shared<Int32Scalar>(5)),
@@ -36,6 +36,7 @@
 #  include "arrow/ipc/reader.h"
 #  include "arrow/ipc/writer.h"
 #endif
+#include "arrow/scalar.h"
 #include "arrow/util/hash_util.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging_internal.h"
@@ -72,6 +73,10 @@ Expression::Expression(Parameter parameter)
 
 Expression literal(Datum lit) { return Expression(std::move(lit)); }
 
+Expression literal(bool value) {
+  return Expression(Datum(arrow::internal::GetCachedBooleanScalar(value)));
+}
+
 Expression field_ref(FieldRef ref) {
   return Expression(Expression::Parameter{std::move(ref), TypeHolder{}, {-1}});
 }
@@ -684,7 +689,7 @@ Result<ExecBatch> MakeExecBatch(const Schema& full_schema, const Datum& partial,
         }
         out.values.emplace_back(std::move(column));
       } else {
-        out.values.emplace_back(MakeNullScalar(field->type()));
+        out.values.emplace_back(arrow::internal::GetCachedNullScalar(field->type()));
       }
     }
     return out;
@@ -723,6 +728,33 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const Schema& full
   return ExecuteScalarExpression(expr, input, exec_context);
 }
 
+namespace {
+
+Result<Datum> ExtractParameter(const Expression& expr,
+                               const Expression::Parameter& param,
+                               const ExecBatch& input) {
+  if (param.type.id() == Type::NA) {
+    return arrow::internal::GetCachedNullScalar(null());
+  }
+
+  Datum field = input[param.indices[0]];
+  if (param.indices.size() > 1) {
+    std::vector<int> indices(param.indices.begin() + 1, param.indices.end());
+    compute::StructFieldOptions options(std::move(indices));
+    ARROW_ASSIGN_OR_RAISE(
+        field, compute::CallFunction("struct_field", {std::move(field)}, &options));
+  }
+  if (!field.type()->Equals(*param.type.type)) {
+    return Status::Invalid("Referenced field ", expr.ToString(), " was ",
+                           field.type()->ToString(), " but should have been ",
+                           param.type.ToString());
+  }
+
+  return field;
+}
+
+}  // namespace
+
 Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& input,
                                       compute::ExecContext* exec_context) {
   if (exec_context == nullptr) {
@@ -742,24 +774,7 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
   if (auto lit = expr.literal()) return *lit;
 
   if (auto param = expr.parameter()) {
-    if (param->type.id() == Type::NA) {
-      return MakeNullScalar(null());
-    }
-
-    Datum field = input[param->indices[0]];
-    if (param->indices.size() > 1) {
-      std::vector<int> indices(param->indices.begin() + 1, param->indices.end());
-      compute::StructFieldOptions options(std::move(indices));
-      ARROW_ASSIGN_OR_RAISE(
-          field, compute::CallFunction("struct_field", {std::move(field)}, &options));
-    }
-    if (!field.type()->Equals(*param->type.type)) {
-      return Status::Invalid("Referenced field ", expr.ToString(), " was ",
-                             field.type()->ToString(), " but should have been ",
-                             param->type.ToString());
-    }
-
-    return field;
+    return ExtractParameter(expr, *param, input);
   }
 
   auto call = CallNotNull(expr);
@@ -802,6 +817,145 @@ Result<Datum> ExecuteScalarExpression(const Expression& expr, const ExecBatch& i
   return out;
 }
 
+struct CompiledExpression::Impl {
+  // A postorder step of the flattened expression; leaf (literal and
+  // parameter) steps have a null call.
+  struct Step {
+    const Expression* node;
+    const Expression::Call* call = NULLPTR;
+    std::vector<int> argument_slots;
+    std::unique_ptr<compute::detail::KernelExecutor> executor;
+    std::unique_ptr<compute::KernelContext> kernel_context;
+  };
+
+  std::vector<Expression> exprs;
+  compute::ExecContext* exec_context;
+  std::vector<Step> steps;
+  // One result slot per step, reused across batches
+  std::vector<Datum> slots;
+  // The slot holding each root expression's result
+  std::vector<int> root_slots;
+  // Common subexpression elimination: maps each distinct subexpression to
+  // the slot already computing it
+  std::unordered_map<Expression, int, Expression::Hash> expr_slots;
+
+  Result<int> AddSteps(const Expression& node) {
+    auto it = expr_slots.find(node);
+    if (it != expr_slots.end()) {
+      return it->second;
+    }
+    Step step;
+    step.node = &node;
+    if (node.call() != nullptr) {
+      auto call = CallNotNull(node);
+      step.call = call;
+      step.argument_slots.resize(call->arguments.size());
+      for (size_t i = 0; i < call->arguments.size(); ++i) {
+        ARROW_ASSIGN_OR_RAISE(step.argument_slots[i], AddSteps(call->arguments[i]));
+      }
+      step.executor = compute::detail::KernelExecutor::MakeScalar();
+      step.kernel_context =
+          std::make_unique<compute::KernelContext>(exec_context, call->kernel);
+      step.kernel_context->SetState(call->kernel_state.get());
+      std::vector<TypeHolder> types(call->arguments.size());
+      for (size_t i = 0; i < call->arguments.size(); ++i) {
+        types[i] = call->arguments[i].type();
+      }
+      RETURN_NOT_OK(step.executor->Init(step.kernel_context.get(),
+                                        {call->kernel, types, call->options.get()}));
+    }
+    steps.push_back(std::move(step));
+    const int slot = static_cast<int>(steps.size()) - 1;
+    expr_slots.emplace(node, slot);
+    return slot;
+  }
+
+  Status ExecuteSteps(const ExecBatch& input) {
+    for (size_t step_index = 0; step_index < steps.size(); ++step_index) {
+      Step& step = steps[step_index];
+      Datum& out = slots[step_index];
+
+      if (auto lit = step.node->literal()) {
+        out = *lit;
+        continue;
+      }
+
+      if (auto param = step.node->parameter()) {
+        ARROW_ASSIGN_OR_RAISE(out, ExtractParameter(*step.node, *param, input));
+        continue;
+      }
+
+      std::vector<Datum> arguments(step.argument_slots.size());
+      bool all_scalar = true;
+      for (size_t i = 0; i < arguments.size(); ++i) {
+        arguments[i] = slots[step.argument_slots[i]];
+        all_scalar &= arguments[i].is_scalar();
+      }
+      const int64_t input_length =
+          (!arguments.empty() && all_scalar) ? 1 : input.length;
+
+      compute::detail::DatumAccumulator listener;
+      RETURN_NOT_OK(
+          step.executor->Execute(ExecBatch(arguments, input_length), &listener));
+      out = step.executor->WrapResults(arguments, listener.values());
+#ifndef NDEBUG
+      DCHECK_OK(step.executor->CheckResultType(out, step.call->function_name.c_str()));
+#endif
+    }
+    return Status::OK();
+  }
+};
+
+CompiledExpression::CompiledExpression(std::unique_ptr<Impl> impl)
+    : impl_(std::move(impl)) {}
+
+CompiledExpression::~CompiledExpression() = default;
+
+Result<std::unique_ptr<CompiledExpression>> CompiledExpression::Compile(
+    const Expression& expr, compute::ExecContext* exec_context) {
+  return Compile(std::vector<Expression>{expr}, exec_context);
+}
+
+Result<std::unique_ptr<CompiledExpression>> CompiledExpression::Compile(
+    const std::vector<Expression>& exprs, compute::ExecContext* exec_context) {
+  for (const Expression& expr : exprs) {
+    if (!expr.IsBound()) {
+      return Status::Invalid("Cannot compile an unbound expression.");
+    }
+    if (!expr.IsScalarExpression()) {
+      return Status::Invalid("CompiledExpression cannot compile non-scalar expression ",
+                             expr.ToString());
+    }
+  }
+  auto impl = std::make_unique<Impl>();
+  impl->exprs = exprs;
+  impl->exec_context =
+      exec_context != NULLPTR ? exec_context : compute::default_exec_context();
+  impl->root_slots.reserve(impl->exprs.size());
+  for (const Expression& expr : impl->exprs) {
+    ARROW_ASSIGN_OR_RAISE(const int root_slot, impl->AddSteps(expr));
+    impl->root_slots.push_back(root_slot);
+  }
+  impl->slots.resize(impl->steps.size());
+  return std::unique_ptr<CompiledExpression>(
+      new CompiledExpression(std::move(impl)));
+}
+
+Result<Datum> CompiledExpression::Execute(const ExecBatch& input) {
+  RETURN_NOT_OK(impl_->ExecuteSteps(input));
+  DCHECK(!impl_->root_slots.empty());
+  return impl_->slots[impl_->root_slots[0]];
+}
+
+Result<std::vector<Datum>> CompiledExpression::ExecuteAll(const ExecBatch& input) {
+  RETURN_NOT_OK(impl_->ExecuteSteps(input));
+  std::vector<Datum> results(impl_->root_slots.size());
+  for (size_t i = 0; i < results.size(); ++i) {
+    results[i] = impl_->slots[impl_->root_slots[i]];
+  }
+  return results;
+}
+
 namespace {
 
 std::array<std::pair<const Expression&, const Expression&>, 2>
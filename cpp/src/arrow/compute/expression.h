@@ -149,6 +149,14 @@ ARROW_EXPORT void PrintTo(const Expression&, std::ostream*);
 ARROW_EXPORT
 Expression literal(Datum lit);
 
+/// \brief Overload for boolean literals, backed by interned scalars
+///
+/// Boolean literals are created pervasively during expression simplification,
+/// so they share a pair of cached true/false scalars instead of boxing a new
+/// BooleanScalar per call.
+ARROW_EXPORT
+Expression literal(bool value);
+
 template <typename Arg>
 Expression literal(Arg&& arg) {
   return literal(Datum(std::forward<Arg>(arg)));
@@ -252,6 +260,49 @@ ARROW_EXPORT
 Result<Datum> ExecuteScalarExpression(const Expression&, const Schema& full_schema,
                                       const Datum& partial_input, ExecContext* = NULLPTR);
 
+/// \brief A compiled form of a bound scalar expression
+///
+/// Compiling flattens the expression tree into a linear program: each call's
+/// kernel executor is created and its output type resolved once, instead of
+/// on every batch as in ExecuteScalarExpression(), and the slots holding
+/// intermediate values are reused across batches.  Execution produces the
+/// same results as ExecuteScalarExpression().
+///
+/// A compiled expression is not safe for concurrent use; compile one per
+/// thread.  The ExecContext must outlive the compiled expression.
+class ARROW_EXPORT CompiledExpression {
+ public:
+  ~CompiledExpression();
+
+  /// \brief Compile a bound scalar expression
+  static Result<std::unique_ptr<CompiledExpression>> Compile(const Expression& expr,
+                                                             ExecContext* exec_context);
+
+  /// \brief Compile several bound scalar expressions into a single program
+  ///
+  /// Equal subexpressions repeated within or shared between the expressions
+  /// are evaluated only once per batch.
+  static Result<std::unique_ptr<CompiledExpression>> Compile(
+      const std::vector<Expression>& exprs, ExecContext* exec_context);
+
+  /// \brief Execute against the given input batch
+  ///
+  /// If several expressions were compiled, this returns the first one's
+  /// result.
+  Result<Datum> Execute(const ExecBatch& input);
+
+  /// \brief Execute all compiled expressions against the given input batch
+  ///
+  /// Results are returned in the order the expressions were given to
+  /// Compile().
+  Result<std::vector<Datum>> ExecuteAll(const ExecBatch& input);
+
+ private:
+  struct Impl;
+  explicit CompiledExpression(std::unique_ptr<Impl> impl);
+  std::unique_ptr<Impl> impl_;
+};
+
 // Serialization
 
 ARROW_EXPORT
@@ -989,6 +989,74 @@ TEST(Expression, ExecuteDictionaryTransparent) {
   ])"));
 }
 
+TEST(Expression, CompiledExecuteMatchesExecuteScalarExpression) {
+  auto in_type = struct_({field("a", float64()), field("b", float64())});
+  auto expr = add(field_ref("a"), call("subtract", {literal(3.5), field_ref("b")}));
+  ASSERT_OK_AND_ASSIGN(expr, expr.Bind(in_type));
+
+  ASSERT_OK_AND_ASSIGN(auto compiled,
+                       CompiledExpression::Compile(expr, default_exec_context()));
+
+  // The compiled expression is reusable across batches
+  for (std::string json : {
+           R"([{"a": 6.125, "b": 3.375}, {"a": 0.0, "b": 1}])",
+           R"([{"a": -1, "b": 4.75}, {"a": null, "b": 0.5}, {"a": 2, "b": 2}])",
+       }) {
+    ASSERT_OK_AND_ASSIGN(ExecBatch batch,
+                         ExecBatch::Make({ArrayFromJSON(in_type, json)}));
+    ASSERT_OK_AND_ASSIGN(Datum expected, ExecuteScalarExpression(expr, batch));
+    ASSERT_OK_AND_ASSIGN(Datum actual, compiled->Execute(batch));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+}
+
+TEST(Expression, CompiledExecuteLiteralAndFieldRef) {
+  auto in_type = struct_({field("a", int32())});
+  ASSERT_OK_AND_ASSIGN(ExecBatch batch, ExecBatch::Make({ArrayFromJSON(
+                                            in_type, R"([{"a": 1}, {"a": null}])")}));
+
+  for (Expression expr : {literal(42), field_ref("a")}) {
+    ASSERT_OK_AND_ASSIGN(expr, expr.Bind(in_type));
+    ASSERT_OK_AND_ASSIGN(auto compiled,
+                         CompiledExpression::Compile(expr, default_exec_context()));
+    ASSERT_OK_AND_ASSIGN(Datum expected, ExecuteScalarExpression(expr, batch));
+    ASSERT_OK_AND_ASSIGN(Datum actual, compiled->Execute(batch));
+    AssertDatumsEqual(expected, actual, /*verbose=*/true);
+  }
+}
+
+TEST(Expression, CompiledExecuteSharedSubexpressions) {
+  auto in_type = struct_({field("a", float64()), field("b", float64())});
+  Expression shared = call("subtract", {field_ref("a"), field_ref("b")});
+  std::vector<Expression> exprs = {
+      add(shared, literal(1.0)),
+      call("multiply", {shared, shared}),
+      shared,
+  };
+  for (auto& expr : exprs) {
+    ASSERT_OK_AND_ASSIGN(expr, expr.Bind(in_type));
+  }
+
+  ASSERT_OK_AND_ASSIGN(auto compiled,
+                       CompiledExpression::Compile(exprs, default_exec_context()));
+
+  ASSERT_OK_AND_ASSIGN(
+      ExecBatch batch,
+      ExecBatch::Make({ArrayFromJSON(
+          in_type, R"([{"a": 6.125, "b": 3.375}, {"a": 0.0, "b": 1}])")}));
+  ASSERT_OK_AND_ASSIGN(std::vector<Datum> actual, compiled->ExecuteAll(batch));
+  ASSERT_EQ(actual.size(), exprs.size());
+  for (size_t i = 0; i < exprs.size(); ++i) {
+    ASSERT_OK_AND_ASSIGN(Datum expected, ExecuteScalarExpression(exprs[i], batch));
+    AssertDatumsEqual(expected, actual[i], /*verbose=*/true);
+  }
+}
+
+TEST(Expression, CompileUnboundFails) {
+  ASSERT_RAISES(Invalid, CompiledExpression::Compile(add(field_ref("a"), literal(3)),
+                                                     default_exec_context()));
+}
+
 void ExpectIdenticalIfUnchanged(Expression modified, Expression original) {
   if (modified == original) {
     // no change -> must be identical
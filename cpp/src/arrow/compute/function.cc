@@ -29,8 +29,12 @@
 #include "arrow/compute/function_options.h"
 #include "arrow/compute/kernels/common_internal.h"
 #include "arrow/compute/registry.h"
+#include "arrow/array/util.h"
+#include "arrow/chunked_array.h"
 #include "arrow/datum.h"
 #include "arrow/device_allocation_type_set.h"
+#include "arrow/extension_type.h"
+#include "arrow/scalar.h"
 #include "arrow/util/cpu_info.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/tracing_internal.h"
@@ -313,6 +317,25 @@ Result<const Kernel*> Function::DispatchBest(std::vector<TypeHolder>* values) co
   return DispatchExact(*values);
 }
 
+// A dispatch result cached on the function instance, so that repeated calls
+// with the same input types skip the kernel scan in DispatchBest and go
+// straight to the previously resolved kernel and implicit-cast plan. Slots in
+// dispatch_cache_ are published at most once, in order, with a compare and
+// exchange, so readers may scan without locking and stop at the first null
+// slot. Keying the cache to the instance ensures a cached Kernel* can never
+// outlive the function owning it.
+struct Function::DispatchCacheEntry {
+  std::vector<TypeHolder> in_types;
+  const Kernel* kernel = NULLPTR;
+  std::vector<TypeHolder> resolved_types;
+};
+
+Function::~Function() {
+  for (auto& slot : dispatch_cache_) {
+    delete slot.load(std::memory_order_acquire);
+  }
+}
+
 Result<std::shared_ptr<FunctionExecutor>> Function::GetBestExecutor(
     std::vector<TypeHolder> inputs) const {
   std::unique_ptr<detail::KernelExecutor> executor;
@@ -326,7 +349,52 @@ Result<std::shared_ptr<FunctionExecutor>> Function::GetBestExecutor(
     return Status::NotImplemented("Direct execution of HASH_AGGREGATE functions");
   }
 
-  ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, DispatchBest(&inputs));
+  const Kernel* kernel = NULLPTR;
+  int first_empty_slot = kDispatchCacheSize;
+  for (int i = 0; i < kDispatchCacheSize; ++i) {
+    const DispatchCacheEntry* entry = dispatch_cache_[i].load(std::memory_order_acquire);
+    if (entry == NULLPTR) {
+      first_empty_slot = i;
+      break;
+    }
+    if (entry->in_types == inputs) {
+      kernel = entry->kernel;
+      inputs = entry->resolved_types;
+      break;
+    }
+  }
+
+  if (kernel == NULLPTR) {
+    std::vector<TypeHolder> in_types = inputs;
+    ARROW_ASSIGN_OR_RAISE(kernel, DispatchBest(&inputs));
+    // Only cache type holders that share ownership of their type, since an
+    // entry may outlive a caller passing raw type pointers
+    auto all_owned = [](const std::vector<TypeHolder>& types) {
+      for (const TypeHolder& type : types) {
+        if (type.owned_type == NULLPTR) return false;
+      }
+      return true;
+    };
+    if (first_empty_slot < kDispatchCacheSize && all_owned(in_types) &&
+        all_owned(inputs)) {
+      auto entry = std::make_unique<DispatchCacheEntry>(
+          DispatchCacheEntry{std::move(in_types), kernel, inputs});
+      for (int i = first_empty_slot; i < kDispatchCacheSize; ++i) {
+        DispatchCacheEntry* expected = NULLPTR;
+        if (dispatch_cache_[i].compare_exchange_strong(expected, entry.get(),
+                                                       std::memory_order_acq_rel)) {
+          entry.release();
+          break;
+        }
+        if (expected->in_types == entry->in_types) {
+          // Another thread cached this key concurrently; drop our entry
+          break;
+        }
+        // If the cache fills up entry is simply dropped and later calls with
+        // these types fall back to DispatchBest
+      }
+    }
+  }
 
   return std::make_shared<detail::FunctionExecutorImpl>(std::move(inputs), kernel,
                                                         std::move(executor), *this);
@@ -334,13 +402,102 @@ Result<std::shared_ptr<FunctionExecutor>> Function::GetBestExecutor(
 
 namespace {
 
+const ExtensionType* GetStorageDispatchType(const TypeHolder& type) {
+  if (type.type == NULLPTR || type.id() != Type::EXTENSION) return NULLPTR;
+  const auto& ext_type = checked_cast<const ExtensionType&>(*type.type);
+  return ext_type.AllowStorageDispatch() ? &ext_type : NULLPTR;
+}
+
+// Replace an extension-typed datum with a zero-copy view of its storage
+Datum UnwrapStorageDatum(const Datum& arg, const std::shared_ptr<DataType>& storage_type) {
+  switch (arg.kind()) {
+    case Datum::ARRAY: {
+      auto data = arg.array()->Copy();
+      data->type = storage_type;
+      return Datum(std::move(data));
+    }
+    case Datum::CHUNKED_ARRAY: {
+      ArrayVector chunks;
+      chunks.reserve(arg.chunked_array()->num_chunks());
+      for (const auto& chunk : arg.chunked_array()->chunks()) {
+        auto data = chunk->data()->Copy();
+        data->type = storage_type;
+        chunks.push_back(MakeArray(std::move(data)));
+      }
+      return Datum(std::make_shared<ChunkedArray>(std::move(chunks), storage_type));
+    }
+    case Datum::SCALAR:
+      return Datum(checked_cast<const ExtensionScalar&>(*arg.scalar()).value);
+    default:
+      return arg;
+  }
+}
+
+// Re-wrap a storage-typed result as the given extension type, zero-copy
+Datum RewrapStorageDatum(Datum out, const std::shared_ptr<DataType>& ext_type) {
+  switch (out.kind()) {
+    case Datum::ARRAY: {
+      auto data = out.array()->Copy();
+      data->type = ext_type;
+      return Datum(std::move(data));
+    }
+    case Datum::CHUNKED_ARRAY:
+      return Datum(ExtensionType::WrapArray(ext_type, out.chunked_array()));
+    case Datum::SCALAR:
+      return Datum(std::make_shared<ExtensionScalar>(out.scalar(), ext_type,
+                                                     out.scalar()->is_valid));
+    default:
+      return out;
+  }
+}
+
 Result<Datum> ExecuteInternal(const Function& func, std::vector<Datum> args,
                               int64_t passed_length, const FunctionOptions* options,
                               ExecContext* ctx) {
   ARROW_ASSIGN_OR_RAISE(auto inputs, internal::GetFunctionArgumentTypes(args));
+
+  // See through extension types that allow dispatching on their storage, but
+  // only when the function has no kernel for the extension types themselves
+  // (the extension casts do).  If every such input has the same extension
+  // type and the result comes back with its storage type, the result is
+  // re-wrapped so the extension metadata survives the function call.
+  std::shared_ptr<DataType> rewrap_type;
+  bool has_storage_dispatch = false;
+  for (const TypeHolder& in_type : inputs) {
+    if (GetStorageDispatchType(in_type) != NULLPTR) {
+      has_storage_dispatch = true;
+      break;
+    }
+  }
+  if (has_storage_dispatch && !func.DispatchExact(inputs).ok()) {
+    bool mixed_extension_types = false;
+    for (size_t i = 0; i < args.size(); ++i) {
+      const ExtensionType* ext_type = GetStorageDispatchType(inputs[i]);
+      if (ext_type == NULLPTR) continue;
+      if (rewrap_type == NULLPTR) {
+        rewrap_type = inputs[i].GetSharedPtr();
+      } else if (!rewrap_type->Equals(*ext_type)) {
+        mixed_extension_types = true;
+      }
+      args[i] = UnwrapStorageDatum(args[i], ext_type->storage_type());
+      inputs[i] = args[i].type();
+    }
+    if (mixed_extension_types) {
+      rewrap_type = NULLPTR;
+    }
+  }
+
   ARROW_ASSIGN_OR_RAISE(auto func_exec, func.GetBestExecutor(inputs));
   ARROW_RETURN_NOT_OK(func_exec->Init(options, ctx));
-  return func_exec->Execute(args, passed_length);
+  ARROW_ASSIGN_OR_RAISE(Datum out, func_exec->Execute(args, passed_length));
+  if (rewrap_type != NULLPTR && out.type() != NULLPTR) {
+    const auto& storage_type =
+        checked_cast<const ExtensionType&>(*rewrap_type).storage_type();
+    if (out.type()->Equals(*storage_type)) {
+      out = RewrapStorageDatum(std::move(out), rewrap_type);
+    }
+  }
+  return out;
 }
 
 }  // namespace
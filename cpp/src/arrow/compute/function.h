@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <string>
 #include <utility>
 #include <vector>
@@ -167,7 +169,7 @@ class ARROW_EXPORT Function {
     META
   };
 
-  virtual ~Function() = default;
+  virtual ~Function();
 
   /// \brief The name of the kernel. The registry enforces uniqueness of names.
   const std::string& name() const { return name_; }
@@ -244,7 +246,11 @@ class ARROW_EXPORT Function {
         kind_(kind),
         arity_(arity),
         doc_(std::move(doc)),
-        default_options_(default_options) {}
+        default_options_(default_options) {
+    for (auto& slot : dispatch_cache_) {
+      slot.store(NULLPTR, std::memory_order_relaxed);
+    }
+  }
 
   Status CheckArity(size_t num_args) const;
 
@@ -253,6 +259,15 @@ class ARROW_EXPORT Function {
   Arity arity_;
   const FunctionDoc doc_;
   const FunctionOptions* default_options_ = NULLPTR;
+
+ private:
+  // Cached dispatch results (the resolved kernel and implicit-cast plan) keyed
+  // by input types; see Function::GetBestExecutor. Each slot is written at
+  // most once, so readers need no locking.
+  struct DispatchCacheEntry;
+  static constexpr int kDispatchCacheSize = 16;
+  mutable std::array<std::atomic<DispatchCacheEntry*>, kDispatchCacheSize>
+      dispatch_cache_;
 };
 
 namespace detail {
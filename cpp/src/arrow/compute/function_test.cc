@@ -31,6 +31,7 @@
 #include "arrow/compute/function_internal.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/datum.h"
+#include "arrow/extension_type.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
@@ -461,5 +462,63 @@ TEST(FunctionExecutor, Basics) {
   }
 }
 
+namespace {
+
+class StorageDispatchType : public ExtensionType {
+ public:
+  StorageDispatchType() : ExtensionType(int32()) {}
+
+  std::string extension_name() const override { return "storage-dispatch"; }
+
+  bool ExtensionEquals(const ExtensionType& other) const override {
+    return other.extension_name() == extension_name();
+  }
+
+  std::shared_ptr<Array> MakeArray(std::shared_ptr<ArrayData> data) const override {
+    return std::make_shared<ExtensionArray>(data);
+  }
+
+  Result<std::shared_ptr<DataType>> Deserialize(
+      std::shared_ptr<DataType>, const std::string&) const override {
+    return std::make_shared<StorageDispatchType>();
+  }
+
+  std::string Serialize() const override { return ""; }
+
+  bool AllowStorageDispatch() const override { return true; }
+};
+
+}  // namespace
+
+TEST(FunctionExecutor, StorageDispatch) {
+  VectorFunction func("storage_dispatch_test", Arity::Unary(),
+                      /*doc=*/FunctionDoc::Empty());
+  auto exec = [](KernelContext*, const ExecSpan& args, ExecResult* out) -> Status {
+    const ArraySpan& array = args.values[0].array;
+    if (array.type->id() != Type::INT32) {
+      return Status::TypeError("expected to execute against storage");
+    }
+    const int32_t* vals = array.GetValues<int32_t>(1);
+    Int32Builder builder;
+    for (int64_t i = 0; i < args.length; i++) {
+      RETURN_NOT_OK(builder.Append(vals[i] + 1));
+    }
+    ARROW_ASSIGN_OR_RAISE(auto result, builder.Finish());
+    *out->array_data().get() = *result->data();
+    return Status::OK();
+  };
+  ASSERT_OK(func.AddKernel({int32()}, int32(), exec));
+
+  // An extension input whose type allows storage dispatch executes against
+  // the int32 kernel and the result is re-wrapped as the extension type
+  auto ext_type = std::make_shared<StorageDispatchType>();
+  auto ext_array = ExtensionType::WrapArray(ext_type, ArrayFromJSON(int32(), "[1, 2, 3]"));
+  ASSERT_OK_AND_ASSIGN(Datum result, func.Execute({ext_array}, nullptr, nullptr));
+  ASSERT_TRUE(result.is_array());
+  ASSERT_TRUE(result.type()->Equals(*ext_type));
+  auto actual = ::arrow::internal::checked_pointer_cast<ExtensionArray>(result.make_array());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[2, 3, 4]"), *actual->storage());
+}
+
 }  // namespace compute
 }  // namespace arrow
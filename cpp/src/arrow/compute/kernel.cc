@@ -59,6 +59,13 @@ Result<std::shared_ptr<ResizableBuffer>> KernelContext::AllocateBitmap(int64_t n
   return result;
 }
 
+MemoryPool* KernelContext::scratch_pool() {
+  if (!scratch_pool_) {
+    scratch_pool_ = exec_ctx_->memory_pool()->CreateArena();
+  }
+  return scratch_pool_.get();
+}
+
 Status Kernel::InitAll(KernelContext* ctx, const KernelInitArgs& args,
                        std::vector<std::unique_ptr<KernelState>>* states) {
   for (auto& state : *states) {
@@ -92,12 +92,22 @@ class ARROW_EXPORT KernelContext {
   /// MemoryPool contained in the ExecContext used to create the KernelContext.
   MemoryPool* memory_pool() { return exec_ctx_->memory_pool(); }
 
+  /// \brief A bump-allocation arena for short-lived kernel scratch, lazily
+  /// created from memory_pool() (see MemoryPool::CreateArena).
+  ///
+  /// Allocations from this pool avoid allocator synchronization but are only
+  /// reclaimed when the KernelContext is destroyed, so buffers obtained from
+  /// it must not escape the kernel invocation.  Like the KernelContext
+  /// itself, the arena is not thread-safe.
+  MemoryPool* scratch_pool();
+
   const Kernel* kernel() const { return kernel_; }
 
  private:
   ExecContext* exec_ctx_;
   KernelState* state_ = NULLPTR;
   const Kernel* kernel_ = NULLPTR;
+  std::unique_ptr<MemoryPool> scratch_pool_;
 };
 
 /// \brief An type-checking interface to permit customizable validation rules
@@ -638,6 +648,16 @@ struct ARROW_EXPORT VectorKernel : public Kernel {
   /// true -> ChunkedArray
   /// false -> Array
   bool output_chunked = true;
+
+  /// \brief Opt in to writing output into the input's own allocation.
+  ///
+  /// Only meaningful for length-preserving unary kernels whose output type can
+  /// equal the input type. When the caller enables
+  /// ExecContext::set_allow_buffer_reuse() and the executor can prove the
+  /// input buffers are not referenced anywhere else, the kernel receives an
+  /// output ArrayData whose buffers alias the input. The kernel must then
+  /// write each output slot only after reading the corresponding input slot.
+  bool can_reuse_input_buffers = false;
 };
 
 // ----------------------------------------------------------------------
@@ -15,6 +15,10 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstring>
+#include <string_view>
+#include <vector>
+
 #include "arrow/compute/api_aggregate.h"
 #include "arrow/compute/kernels/aggregate_internal.h"
 #include "arrow/compute/kernels/common_internal.h"
@@ -128,6 +132,29 @@ struct TDigestImpl : public ScalarAggregator {
   bool all_valid;
 };
 
+// Emits the serialized digest state instead of quantiles, so that partial
+// per-partition digests can be stored and merged later by "tdigest_merge"
+template <typename ArrowType>
+struct TDigestSketchImpl : public TDigestImpl<ArrowType> {
+  using TDigestImpl<ArrowType>::TDigestImpl;
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    if (this->tdigest.is_empty() || !this->all_valid ||
+        this->count < this->options.min_count) {
+      *out = Datum(MakeNullScalar(binary()));
+      return Status::OK();
+    }
+    const std::vector<double> serialized = this->tdigest.Serialize();
+    ARROW_ASSIGN_OR_RAISE(auto buffer,
+                          ctx->Allocate(serialized.size() * sizeof(double)));
+    std::memcpy(buffer->mutable_data(), serialized.data(),
+                static_cast<size_t>(buffer->size()));
+    *out = Datum(std::make_shared<BinaryScalar>(std::move(buffer)));
+    return Status::OK();
+  }
+};
+
+template <template <typename> class Impl>
 struct TDigestInitState {
   std::unique_ptr<KernelState> state;
   KernelContext* ctx;
@@ -148,13 +175,13 @@ struct TDigestInitState {
 
   template <typename Type>
   enable_if_number<Type, Status> Visit(const Type&) {
-    state.reset(new TDigestImpl<Type>(options, in_type));
+    state.reset(new Impl<Type>(options, in_type));
     return Status::OK();
   }
 
   template <typename Type>
   enable_if_decimal<Type, Status> Visit(const Type&) {
-    state.reset(new TDigestImpl<Type>(options, in_type));
+    state.reset(new Impl<Type>(options, in_type));
     return Status::OK();
   }
 
@@ -166,16 +193,110 @@ struct TDigestInitState {
 
 Result<std::unique_ptr<KernelState>> TDigestInit(KernelContext* ctx,
                                                  const KernelInitArgs& args) {
-  TDigestInitState visitor(ctx, *args.inputs[0].type,
-                           static_cast<const TDigestOptions&>(*args.options));
+  TDigestInitState<TDigestImpl> visitor(
+      ctx, *args.inputs[0].type, static_cast<const TDigestOptions&>(*args.options));
+  return visitor.Create();
+}
+
+Result<std::unique_ptr<KernelState>> TDigestSketchInit(KernelContext* ctx,
+                                                       const KernelInitArgs& args) {
+  TDigestInitState<TDigestSketchImpl> visitor(
+      ctx, *args.inputs[0].type, static_cast<const TDigestOptions&>(*args.options));
   return visitor.Create();
 }
 
+// Merges serialized digests produced by "tdigest_sketch" and emits the
+// quantiles of the combined digest
+struct TDigestMergeImpl : public ScalarAggregator {
+  explicit TDigestMergeImpl(const TDigestOptions& options)
+      : options{options}, tdigest{options.delta, options.buffer_size}, all_valid{true} {}
+
+  Status MergeOne(std::string_view serialized) {
+    if (serialized.size() % sizeof(double) != 0) {
+      return Status::Invalid("serialized tdigest has invalid size");
+    }
+    std::vector<double> values(serialized.size() / sizeof(double));
+    std::memcpy(values.data(), serialized.data(), serialized.size());
+    ARROW_ASSIGN_OR_RAISE(
+        TDigest other,
+        TDigest::Deserialize(values.data(), static_cast<int64_t>(values.size())));
+    this->tdigest.Merge(other);
+    return Status::OK();
+  }
+
+  Status Consume(KernelContext*, const ExecSpan& batch) override {
+    if (!this->all_valid) return Status::OK();
+    if (!options.skip_nulls && batch[0].null_count() > 0) {
+      this->all_valid = false;
+      return Status::OK();
+    }
+    Status st = Status::OK();
+    if (batch[0].is_array()) {
+      VisitArrayValuesInline<BinaryType>(
+          batch[0].array,
+          [&](std::string_view serialized) {
+            if (st.ok()) st = MergeOne(serialized);
+          },
+          []() {});
+    } else if (batch[0].scalar->is_valid) {
+      const auto& scalar = checked_cast<const BinaryScalar&>(*batch[0].scalar);
+      for (int64_t i = 0; st.ok() && i < batch.length; ++i) {
+        st = MergeOne(std::string_view(*scalar.value));
+      }
+    }
+    return st;
+  }
+
+  Status MergeFrom(KernelContext*, KernelState&& src) override {
+    const auto& other = checked_cast<const TDigestMergeImpl&>(src);
+    if (!this->all_valid || !other.all_valid) {
+      this->all_valid = false;
+      return Status::OK();
+    }
+    this->tdigest.Merge(other.tdigest);
+    return Status::OK();
+  }
+
+  Status Finalize(KernelContext* ctx, Datum* out) override {
+    const int64_t out_length = options.q.size();
+    auto out_data = ArrayData::Make(float64(), out_length, 0);
+    out_data->buffers.resize(2, nullptr);
+    ARROW_ASSIGN_OR_RAISE(out_data->buffers[1],
+                          ctx->Allocate(out_length * sizeof(double)));
+    double* out_buffer = out_data->template GetMutableValues<double>(1);
+
+    if (this->tdigest.is_empty() || !this->all_valid ||
+        this->tdigest.total_weight() < options.min_count) {
+      ARROW_ASSIGN_OR_RAISE(out_data->buffers[0], ctx->AllocateBitmap(out_length));
+      std::memset(out_data->buffers[0]->mutable_data(), 0x00,
+                  out_data->buffers[0]->size());
+      std::fill(out_buffer, out_buffer + out_length, 0.0);
+      out_data->null_count = out_length;
+    } else {
+      for (int64_t i = 0; i < out_length; ++i) {
+        out_buffer[i] = this->tdigest.Quantile(this->options.q[i]);
+      }
+    }
+    *out = Datum(std::move(out_data));
+    return Status::OK();
+  }
+
+  const TDigestOptions options;
+  TDigest tdigest;
+  bool all_valid;
+};
+
+Result<std::unique_ptr<KernelState>> TDigestMergeInit(KernelContext*,
+                                                      const KernelInitArgs& args) {
+  return std::make_unique<TDigestMergeImpl>(
+      static_cast<const TDigestOptions&>(*args.options));
+}
+
 void AddTDigestKernels(KernelInit init,
                        const std::vector<std::shared_ptr<DataType>>& types,
-                       ScalarAggregateFunction* func) {
+                       OutputType out_type, ScalarAggregateFunction* func) {
   for (const auto& ty : types) {
-    auto sig = KernelSignature::Make({InputType(ty->id())}, float64());
+    auto sig = KernelSignature::Make({InputType(ty->id())}, out_type);
     AddAggKernel(std::move(sig), init, func);
   }
 }
@@ -188,6 +309,26 @@ const FunctionDoc tdigest_doc{
     {"array"},
     "TDigestOptions"};
 
+const FunctionDoc tdigest_sketch_doc{
+    "Compute a mergeable T-Digest sketch of a numeric array",
+    ("The result is an opaque binary scalar holding the serialized digest\n"
+     "state. Sketches computed over partitions of a dataset can be combined\n"
+     "and queried with the \"tdigest_merge\" function.\n"
+     "Nulls and NaNs are ignored.\n"
+     "A null scalar is returned if there is no valid data point."),
+    {"array"},
+    "TDigestOptions"};
+
+const FunctionDoc tdigest_merge_doc{
+    "Merge T-Digest sketches and compute approximate quantiles",
+    ("The input must contain serialized sketches produced by the\n"
+     "\"tdigest_sketch\" function. By default, the 0.5 quantile (median)\n"
+     "of the merged digest is returned.\n"
+     "Null sketches are ignored.\n"
+     "An array of nulls is returned if there is no valid data point."),
+    {"sketches"},
+    "TDigestOptions"};
+
 const FunctionDoc approximate_median_doc{
     "Approximate median of a numeric array with T-Digest algorithm",
     ("Nulls and NaNs are ignored.\n"
@@ -199,8 +340,28 @@ std::shared_ptr<ScalarAggregateFunction> AddTDigestAggKernels() {
   static auto default_tdigest_options = TDigestOptions::Defaults();
   auto func = std::make_shared<ScalarAggregateFunction>(
       "tdigest", Arity::Unary(), tdigest_doc, &default_tdigest_options);
-  AddTDigestKernels(TDigestInit, NumericTypes(), func.get());
-  AddTDigestKernels(TDigestInit, {decimal128(1, 1), decimal256(1, 1)}, func.get());
+  AddTDigestKernels(TDigestInit, NumericTypes(), float64(), func.get());
+  AddTDigestKernels(TDigestInit, {decimal128(1, 1), decimal256(1, 1)}, float64(),
+                    func.get());
+  return func;
+}
+
+std::shared_ptr<ScalarAggregateFunction> AddTDigestSketchAggKernels() {
+  static auto default_tdigest_options = TDigestOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      "tdigest_sketch", Arity::Unary(), tdigest_sketch_doc, &default_tdigest_options);
+  AddTDigestKernels(TDigestSketchInit, NumericTypes(), binary(), func.get());
+  AddTDigestKernels(TDigestSketchInit, {decimal128(1, 1), decimal256(1, 1)}, binary(),
+                    func.get());
+  return func;
+}
+
+std::shared_ptr<ScalarAggregateFunction> AddTDigestMergeAggKernels() {
+  static auto default_tdigest_options = TDigestOptions::Defaults();
+  auto func = std::make_shared<ScalarAggregateFunction>(
+      "tdigest_merge", Arity::Unary(), tdigest_merge_doc, &default_tdigest_options);
+  auto sig = KernelSignature::Make({InputType(Type::BINARY)}, float64());
+  AddAggKernel(std::move(sig), TDigestMergeInit, func.get());
   return func;
 }
 
@@ -249,6 +410,9 @@ void RegisterScalarAggregateTDigest(FunctionRegistry* registry) {
 
   auto approx_median = AddApproximateMedianAggKernels(tdigest.get());
   DCHECK_OK(registry->AddFunction(approx_median));
+
+  DCHECK_OK(registry->AddFunction(AddTDigestSketchAggKernels()));
+  DCHECK_OK(registry->AddFunction(AddTDigestMergeAggKernels()));
 }
 
 }  // namespace internal
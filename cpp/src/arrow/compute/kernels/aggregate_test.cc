@@ -4475,6 +4475,43 @@ TEST(TestTDigestKernel, ApproximateMedian) {
   }
 }
 
+TEST(TestTDigestKernel, SketchAndMerge) {
+  TDigestOptions options(std::vector<double>{0.0, 0.5, 1.0});
+
+  // Sketching partitions and merging the sketches matches a digest built
+  // over all of the data
+  ASSERT_OK_AND_ASSIGN(
+      Datum sketch1, CallFunction("tdigest_sketch",
+                                  {ArrayFromJSON(float64(), "[1, 2, 3, null]")}, &options));
+  ASSERT_OK_AND_ASSIGN(
+      Datum sketch2,
+      CallFunction("tdigest_sketch", {ArrayFromJSON(float64(), "[4, 5]")}, &options));
+  ASSERT_TRUE(sketch1.is_scalar());
+
+  BinaryBuilder builder;
+  ASSERT_OK(builder.Append(
+      std::string_view(*checked_cast<const BinaryScalar&>(*sketch1.scalar()).value)));
+  ASSERT_OK(builder.Append(
+      std::string_view(*checked_cast<const BinaryScalar&>(*sketch2.scalar()).value)));
+  ASSERT_OK_AND_ASSIGN(auto sketches, builder.Finish());
+
+  EXPECT_THAT(CallFunction("tdigest_merge", {sketches}, &options),
+              ResultWith(ArrayFromJSON(float64(), "[1, 3, 5]")));
+
+  // An input without valid data points yields a null sketch, which merging
+  // treats like any other null
+  ASSERT_OK_AND_ASSIGN(
+      Datum null_sketch,
+      CallFunction("tdigest_sketch", {ArrayFromJSON(float64(), "[null]")}, &options));
+  ASSERT_FALSE(null_sketch.scalar()->is_valid);
+  EXPECT_THAT(CallFunction("tdigest_merge", {MakeNullScalar(binary())}, &options),
+              ResultWith(ArrayFromJSON(float64(), "[null, null, null]")));
+
+  // Garbage input is rejected
+  ASSERT_RAISES(Invalid, CallFunction("tdigest_merge",
+                                      {ArrayFromJSON(binary(), R"(["abc"])")}, &options));
+}
+
 //
 // Pivot
 //
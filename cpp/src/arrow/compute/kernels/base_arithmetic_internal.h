@@ -732,6 +732,21 @@ struct Identity<Min> {
   static constexpr Value value{std::numeric_limits<Value>::max()};
 };
 
+// scalar_arithmetic_avx512.cc
+//
+// AVX-512 variants of the numeric kernels, compiled in a translation unit
+// with AVX-512 code generation enabled.  Kernel dispatch picks them over the
+// SimdLevel::NONE kernels on supporting CPUs.
+
+void AddAddAvx512Kernels(ScalarFunction* func);
+void AddAddCheckedAvx512Kernels(ScalarFunction* func);
+void AddSubtractAvx512Kernels(ScalarFunction* func);
+void AddSubtractCheckedAvx512Kernels(ScalarFunction* func);
+void AddMultiplyAvx512Kernels(ScalarFunction* func);
+void AddMultiplyCheckedAvx512Kernels(ScalarFunction* func);
+void AddDivideAvx512Kernels(ScalarFunction* func);
+void AddDivideCheckedAvx512Kernels(ScalarFunction* func);
+
 }  // namespace internal
 }  // namespace compute
 }  // namespace arrow
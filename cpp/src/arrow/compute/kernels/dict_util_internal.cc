@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/compute/kernels/dict_util_internal.h"
+
+#include "arrow/array/data.h"
+#include "arrow/compute/exec.h"
+#include "arrow/compute/function.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/datum.h"
+#include "arrow/result.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/logging_internal.h"
+
+namespace arrow {
+namespace compute {
+namespace internal {
+namespace dict_util {
+namespace {
+
+using ::arrow::internal::checked_cast;
+
+// KernelState carrying the name of the wrapped function applied to the
+// dictionary values and the options it was invoked with.
+struct DictionaryWrapperState : public KernelState {
+  DictionaryWrapperState(std::string name, const FunctionOptions* options)
+      : function_name(std::move(name)), options(options) {}
+  std::string function_name;
+  const FunctionOptions* options;
+};
+
+Status DictionaryValueExec(KernelContext* ctx, const ExecSpan& span, ExecResult* out) {
+  const auto& state = checked_cast<const DictionaryWrapperState&>(*ctx->state());
+  if (!span[0].is_array()) {
+    // The signature also matches dictionary scalars
+    return Status::NotImplemented("dictionary scalar arguments");
+  }
+  const ArraySpan& dict_span = span[0].array;
+  ARROW_ASSIGN_OR_RAISE(
+      Datum values_out,
+      CallFunction(state.function_name, {dict_span.dictionary().ToArrayData()},
+                   state.options, ctx->exec_context()));
+  const auto& dict_type = checked_cast<const DictionaryType&>(*dict_span.type);
+  // Carry the indices (and their validity) over unchanged; only the
+  // dictionary values are replaced with the transformed ones.
+  auto out_data = dict_span.ToArrayData();
+  out_data->type = dictionary(dict_type.index_type(), values_out.type());
+  out_data->dictionary = values_out.array();
+  out->value = std::move(out_data);
+  return Status::OK();
+}
+
+Result<TypeHolder> ResolveDictionaryOutputType(const std::string& function_name,
+                                               KernelContext* ctx,
+                                               const std::vector<TypeHolder>& in_types) {
+  const auto& dict_type = checked_cast<const DictionaryType&>(*in_types[0].type);
+  std::vector<TypeHolder> value_types = {dict_type.value_type()};
+  ARROW_ASSIGN_OR_RAISE(
+      auto func, ctx->exec_context()->func_registry()->GetFunction(function_name));
+  ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, func->DispatchBest(&value_types));
+  ARROW_ASSIGN_OR_RAISE(TypeHolder value_out_type,
+                        kernel->signature->out_type().Resolve(ctx, value_types));
+  return TypeHolder(dictionary(dict_type.index_type(), value_out_type.GetSharedPtr()));
+}
+
+}  // namespace
+
+void AddDictionaryValueKernel(ScalarFunction* func) {
+  DCHECK_EQ(func->arity().num_args, 1);
+  const std::string name = func->name();
+  OutputType out_type([name](KernelContext* ctx, const std::vector<TypeHolder>& types) {
+    return ResolveDictionaryOutputType(name, ctx, types);
+  });
+  KernelInit init = [name](KernelContext*, const KernelInitArgs& args)
+      -> Result<std::unique_ptr<KernelState>> {
+    return std::make_unique<DictionaryWrapperState>(name, args.options);
+  };
+  ScalarKernel kernel(KernelSignature::Make({InputType(Type::DICTIONARY)}, out_type),
+                      DictionaryValueExec, init);
+  kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+  kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+  kernel.can_write_into_slices = false;
+  DCHECK_OK(func->AddKernel(std::move(kernel)));
+}
+
+void AddDictionaryValueKernels(FunctionRegistry* registry,
+                               std::initializer_list<const char*> names) {
+  for (const char* name : names) {
+    auto func = registry->GetFunction(name).ValueOrDie();
+    AddDictionaryValueKernel(checked_cast<ScalarFunction*>(func.get()));
+  }
+}
+
+}  // namespace dict_util
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,52 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+// Helpers to implement kernels executing on dictionary values only
+
+#include "arrow/compute/registry.h"
+
+namespace arrow {
+namespace compute {
+
+class ScalarFunction;
+
+namespace internal {
+namespace dict_util {
+
+/// \brief Add a kernel executing `func` on the dictionary values only
+///
+/// The added kernel accepts a dictionary-encoded array, applies the wrapped
+/// function once to the dictionary values and re-wraps the result with the
+/// input's indices, so the cost is proportional to the number of distinct
+/// values rather than the array length.  The output is dictionary encoded
+/// with the same index type.
+///
+/// This must only be used with unary element-wise functions whose result for
+/// an element depends on that element's value alone; functions that look at
+/// neighboring elements or at the whole array would produce wrong results.
+void AddDictionaryValueKernel(ScalarFunction* func);
+
+/// \brief Look up `names` in `registry` and add dictionary value kernels
+void AddDictionaryValueKernels(FunctionRegistry* registry,
+                               std::initializer_list<const char*> names);
+
+}  // namespace dict_util
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
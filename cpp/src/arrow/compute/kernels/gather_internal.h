@@ -28,6 +28,12 @@
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/macros.h"
 
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+#  include <limits>
+
+#  include "arrow/util/cpu_info.h"
+#endif
+
 // Implementation helpers for kernels that need to load/gather fixed-width
 // data from multiple, arbitrary indices.
 //
@@ -35,6 +41,21 @@
 
 namespace arrow::internal {
 
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+// AVX2 gather loops for 4 and 8-byte values with 32 and 64-bit indices,
+// defined in gather_avx2.cc. The 32-bit-index gather instructions sign-extend
+// their indices, so callers must ensure all indices fit in a signed 32-bit
+// integer.
+void GatherW4I4Avx2(const uint8_t* src, const uint32_t* idx, int64_t idx_length,
+                    uint8_t* out);
+void GatherW8I4Avx2(const uint8_t* src, const uint32_t* idx, int64_t idx_length,
+                    uint8_t* out);
+void GatherW4I8Avx2(const uint8_t* src, const uint64_t* idx, int64_t idx_length,
+                    uint8_t* out);
+void GatherW8I8Avx2(const uint8_t* src, const uint64_t* idx, int64_t idx_length,
+                    uint8_t* out);
+#endif
+
 // CRTP [1] base class for Gather that provides a gathering loop in terms of
 // Write*() methods that must be implemented by the derived class.
 //
@@ -54,9 +75,7 @@ class GatherBaseCRTP {
  protected:
   ARROW_FORCE_INLINE int64_t ExecuteNoNulls(int64_t idx_length) {
     auto* self = static_cast<GatherImpl*>(this);
-    for (int64_t position = 0; position < idx_length; position++) {
-      self->WriteValue(position);
-    }
+    self->WriteValueSegment(0, idx_length);
     return idx_length;
   }
 
@@ -94,10 +113,8 @@ class GatherBaseCRTP {
         if (block.popcount == block.length) {
           // Fastest path: neither source values nor index nulls
           bit_util::SetBitsTo(out_is_valid, position, block.length, true);
-          for (int64_t i = 0; i < block.length; ++i) {
-            self->WriteValue(position);
-            ++position;
-          }
+          self->WriteValueSegment(position, block.length);
+          position += block.length;
         } else if (block.popcount > 0) {
           // Slow path: some indices but not all are null
           for (int64_t i = 0; i < block.length; ++i) {
@@ -208,6 +225,38 @@ class Gather : public GatherBaseCRTP<Gather<kValueWidthInBits, IndexCType, kWith
     }
   }
 
+  void WriteValueSegment(int64_t position, int64_t length) {
+#if defined(ARROW_HAVE_RUNTIME_AVX2)
+    if constexpr (!kWithFactor && (kValueWidth == 4 || kValueWidth == 8) &&
+                  (sizeof(IndexCType) == 4 || sizeof(IndexCType) == 8)) {
+      static const bool use_avx2 =
+          CpuInfo::GetInstance()->IsSupported(CpuInfo::AVX2);
+      // The 32-bit-index gather instructions sign-extend their indices, so
+      // they are only usable when every index fits in a signed 32-bit integer
+      if (use_avx2 && (sizeof(IndexCType) == 8 ||
+                       src_length_ <= std::numeric_limits<int32_t>::max())) {
+        if constexpr (kValueWidth == 4 && sizeof(IndexCType) == 4) {
+          GatherW4I4Avx2(src_, reinterpret_cast<const uint32_t*>(idx_ + position), length,
+                         out_ + position * kValueWidth);
+        } else if constexpr (kValueWidth == 8 && sizeof(IndexCType) == 4) {
+          GatherW8I4Avx2(src_, reinterpret_cast<const uint32_t*>(idx_ + position), length,
+                         out_ + position * kValueWidth);
+        } else if constexpr (kValueWidth == 4) {
+          GatherW4I8Avx2(src_, reinterpret_cast<const uint64_t*>(idx_ + position), length,
+                         out_ + position * kValueWidth);
+        } else {
+          GatherW8I8Avx2(src_, reinterpret_cast<const uint64_t*>(idx_ + position), length,
+                         out_ + position * kValueWidth);
+        }
+        return;
+      }
+    }
+#endif
+    for (int64_t i = 0; i < length; ++i) {
+      WriteValue(position + i);
+    }
+  }
+
  public:
   Gather(int64_t src_length, const uint8_t* src, int64_t zero_src_offset,
          int64_t idx_length, const IndexCType* idx, uint8_t* out, int64_t factor)
@@ -282,6 +331,12 @@ class Gather</*kValueWidthInBits=*/1, IndexCType, /*kWithFactor=*/false>
     bit_util::SetBitsTo(out_, position, block_length, false);
   }
 
+  void WriteValueSegment(int64_t position, int64_t length) {
+    for (int64_t i = 0; i < length; ++i) {
+      WriteValue(position + i);
+    }
+  }
+
   ARROW_FORCE_INLINE int64_t Execute() { return this->ExecuteNoNulls(idx_length_); }
 
   /// \pre If kOutputIsZeroInitialized, then this->out_ has to be zero initialized.
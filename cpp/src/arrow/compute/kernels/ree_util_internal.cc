@@ -21,11 +21,19 @@
 #include "arrow/compute/kernels/ree_util_internal.h"
 
 #include "arrow/buffer.h"
+#include "arrow/compute/api_vector.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/function.h"
+#include "arrow/compute/registry.h"
+#include "arrow/datum.h"
 #include "arrow/memory_pool.h"
 #include "arrow/result.h"
+#include "arrow/scalar.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/ree_util.h"
 
 namespace arrow {
 namespace compute {
@@ -136,6 +144,224 @@ Result<std::shared_ptr<ArrayData>> MakeNullREEArray(
                          /*null_count=*/0);
 }
 
+namespace {
+
+using ::arrow::internal::checked_cast;
+
+// KernelState carrying the name of the wrapped function applied to the
+// physical values of the run-end encoded input.
+struct REEWrapperState : public KernelState {
+  explicit REEWrapperState(std::string name) : function_name(std::move(name)) {}
+  std::string function_name;
+};
+
+bool IsREEArray(const ExecValue& value) {
+  return value.is_array() && value.type()->id() == Type::RUN_END_ENCODED;
+}
+
+// True if all run-end encoded arguments describe the same logical window over
+// the same physical run ends, in which case the wrapped function can be
+// applied to the physical values of each argument directly.
+bool HaveSameRuns(const ExecSpan& span, const std::vector<int>& ree_args) {
+  const ArraySpan& first = span[ree_args[0]].array;
+  const ArraySpan& first_run_ends = first.child_data[0];
+  for (size_t i = 1; i < ree_args.size(); ++i) {
+    const ArraySpan& other = span[ree_args[i]].array;
+    const ArraySpan& other_run_ends = other.child_data[0];
+    if (other.offset != first.offset || other.length != first.length ||
+        other_run_ends.type->id() != first_run_ends.type->id() ||
+        other_run_ends.offset != first_run_ends.offset ||
+        other_run_ends.buffers[1].data != first_run_ends.buffers[1].data) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Rewrite the run ends of a (possibly sliced) REE span so that they describe
+// the logical window [span.offset, span.offset + span.length) shifted to
+// start at zero.
+template <typename RunEndCType>
+Result<std::shared_ptr<ArrayData>> AdjustRunEnds(const ArraySpan& span,
+                                                 int64_t physical_offset,
+                                                 int64_t physical_length,
+                                                 MemoryPool* pool) {
+  const ArraySpan& run_ends_span = span.child_data[0];
+  const auto* run_ends = run_ends_span.GetValues<RunEndCType>(1);
+  if (span.offset == 0 &&
+      (physical_length == 0 || run_ends[physical_length - 1] == span.length)) {
+    // The window is an untrimmed prefix of the logical array
+    return run_ends_span.ToArrayData()->Slice(0, physical_length);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto run_ends_data,
+                        PreallocateRunEndsArray(run_ends_span.type->GetSharedPtr(),
+                                                physical_length, pool));
+  auto* adjusted = run_ends_data->GetMutableValues<RunEndCType>(1);
+  for (int64_t i = 0; i < physical_length; ++i) {
+    adjusted[i] = static_cast<RunEndCType>(
+        std::min<int64_t>(run_ends[physical_offset + i] - span.offset, span.length));
+  }
+  return run_ends_data;
+}
+
+Result<std::shared_ptr<ArrayData>> AdjustRunEnds(const ArraySpan& span,
+                                                 int64_t physical_offset,
+                                                 int64_t physical_length,
+                                                 MemoryPool* pool) {
+  switch (span.child_data[0].type->id()) {
+    case Type::INT16:
+      return AdjustRunEnds<int16_t>(span, physical_offset, physical_length, pool);
+    case Type::INT32:
+      return AdjustRunEnds<int32_t>(span, physical_offset, physical_length, pool);
+    default:
+      DCHECK_EQ(span.child_data[0].type->id(), Type::INT64);
+      return AdjustRunEnds<int64_t>(span, physical_offset, physical_length, pool);
+  }
+}
+
+// Apply the wrapped function to the physical values only and carry the run
+// ends over to the output.
+Status ExecValuesOnly(KernelContext* ctx, const std::string& function_name,
+                      const ExecSpan& span, ExecResult* out) {
+  const ArraySpan* ree_span = nullptr;
+  for (int i = 0; i < span.num_values(); ++i) {
+    if (IsREEArray(span[i])) {
+      ree_span = &span[i].array;
+      break;
+    }
+  }
+  const auto physical_range = ::arrow::ree_util::FindPhysicalRange(
+      *ree_span, ree_span->offset, ree_span->length);
+  std::vector<Datum> args(span.num_values());
+  for (int i = 0; i < span.num_values(); ++i) {
+    if (IsREEArray(span[i])) {
+      args[i] = span[i].array.child_data[1].ToArrayData()->Slice(physical_range.first,
+                                                                 physical_range.second);
+    } else {
+      args[i] = span[i].scalar->GetSharedPtr();
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum values_out,
+                        CallFunction(function_name, args, ctx->exec_context()));
+  ARROW_ASSIGN_OR_RAISE(auto run_ends_data,
+                        AdjustRunEnds(*ree_span, physical_range.first,
+                                      physical_range.second, ctx->memory_pool()));
+  auto ree_type = run_end_encoded(run_ends_data->type, values_out.type());
+  out->value = ArrayData::Make(std::move(ree_type), ree_span->length, {NULLPTR},
+                               {std::move(run_ends_data), values_out.array()},
+                               /*null_count=*/0);
+  return Status::OK();
+}
+
+// Fallback when the output run structure cannot be taken from a single input:
+// decode the run-end encoded arguments, apply the wrapped function and
+// re-encode the result.
+Status ExecDecoded(KernelContext* ctx, const std::string& function_name,
+                   const ExecSpan& span, ExecResult* out) {
+  std::vector<Datum> args(span.num_values());
+  std::shared_ptr<DataType> run_end_type = int16();
+  for (int i = 0; i < span.num_values(); ++i) {
+    if (IsREEArray(span[i])) {
+      const auto& ree_type = checked_cast<const RunEndEncodedType&>(*span[i].type());
+      if (ree_type.run_end_type()->byte_width() > run_end_type->byte_width()) {
+        run_end_type = ree_type.run_end_type();
+      }
+      ARROW_ASSIGN_OR_RAISE(
+          args[i], CallFunction("run_end_decode", {span[i].array.ToArrayData()},
+                                ctx->exec_context()));
+    } else if (span[i].is_array()) {
+      args[i] = span[i].array.ToArrayData();
+    } else {
+      args[i] = span[i].scalar->GetSharedPtr();
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(Datum decoded_out,
+                        CallFunction(function_name, args, ctx->exec_context()));
+  RunEndEncodeOptions encode_options(std::move(run_end_type));
+  ARROW_ASSIGN_OR_RAISE(
+      Datum encoded, CallFunction("run_end_encode", {std::move(decoded_out)},
+                                  &encode_options, ctx->exec_context()));
+  out->value = encoded.array();
+  return Status::OK();
+}
+
+Status RunEndEncodedWrapperExec(KernelContext* ctx, const ExecSpan& span,
+                                ExecResult* out) {
+  const auto& state = checked_cast<const REEWrapperState&>(*ctx->state());
+  std::vector<int> ree_args;
+  bool has_dense_array = false;
+  for (int i = 0; i < span.num_values(); ++i) {
+    if (IsREEArray(span[i])) {
+      ree_args.push_back(i);
+    } else if (span[i].is_array()) {
+      has_dense_array = true;
+    }
+  }
+  if (ree_args.empty()) {
+    // The signature also matches run-end encoded scalars
+    return Status::NotImplemented("run-end encoded scalar arguments");
+  }
+  if (!has_dense_array && HaveSameRuns(span, ree_args)) {
+    return ExecValuesOnly(ctx, state.function_name, span, out);
+  }
+  return ExecDecoded(ctx, state.function_name, span, out);
+}
+
+Result<TypeHolder> ResolveREEOutputType(const std::string& function_name,
+                                        KernelContext* ctx,
+                                        const std::vector<TypeHolder>& in_types) {
+  std::shared_ptr<DataType> run_end_type = int16();
+  std::vector<TypeHolder> value_types;
+  value_types.reserve(in_types.size());
+  for (const auto& in_type : in_types) {
+    if (in_type.type->id() == Type::RUN_END_ENCODED) {
+      const auto& ree_type = checked_cast<const RunEndEncodedType&>(*in_type.type);
+      if (ree_type.run_end_type()->byte_width() > run_end_type->byte_width()) {
+        run_end_type = ree_type.run_end_type();
+      }
+      value_types.emplace_back(ree_type.value_type());
+    } else {
+      value_types.push_back(in_type);
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      auto func, ctx->exec_context()->func_registry()->GetFunction(function_name));
+  ARROW_ASSIGN_OR_RAISE(const Kernel* kernel, func->DispatchBest(&value_types));
+  ARROW_ASSIGN_OR_RAISE(TypeHolder value_out_type,
+                        kernel->signature->out_type().Resolve(ctx, value_types));
+  return TypeHolder(
+      run_end_encoded(std::move(run_end_type), value_out_type.GetSharedPtr()));
+}
+
+}  // namespace
+
+void AddRunEndEncodedKernels(ScalarFunction* func) {
+  const std::string name = func->name();
+  OutputType out_type([name](KernelContext* ctx, const std::vector<TypeHolder>& types) {
+    return ResolveREEOutputType(name, ctx, types);
+  });
+  KernelInit init = [name](KernelContext*, const KernelInitArgs&)
+      -> Result<std::unique_ptr<KernelState>> {
+    return std::make_unique<REEWrapperState>(name);
+  };
+  std::vector<std::vector<InputType>> in_types;
+  if (func->arity().num_args == 1) {
+    in_types = {{InputType(Type::RUN_END_ENCODED)}};
+  } else {
+    DCHECK_EQ(func->arity().num_args, 2);
+    in_types = {{InputType(Type::RUN_END_ENCODED), InputType::Any()},
+                {InputType::Any(), InputType(Type::RUN_END_ENCODED)}};
+  }
+  for (auto& in : in_types) {
+    ScalarKernel kernel(KernelSignature::Make(std::move(in), out_type),
+                        RunEndEncodedWrapperExec, init);
+    kernel.null_handling = NullHandling::COMPUTED_NO_PREALLOCATE;
+    kernel.mem_allocation = MemAllocation::NO_PREALLOCATE;
+    kernel.can_write_into_slices = false;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+}
+
 }  // namespace ree_util
 }  // namespace internal
 }  // namespace compute
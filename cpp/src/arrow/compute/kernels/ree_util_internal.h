@@ -35,6 +35,9 @@
 
 namespace arrow {
 namespace compute {
+
+class ScalarFunction;
+
 namespace internal {
 namespace ree_util {
 
@@ -381,6 +384,20 @@ Result<std::shared_ptr<ArrayData>> MakeNullREEArray(
     const std::shared_ptr<DataType>& run_end_type, int64_t logical_length,
     MemoryPool* pool);
 
+/// \brief Add kernels executing `func` natively on run-end encoded input
+///
+/// Kernels are added for every argument combination with at least one run-end
+/// encoded array.  When the run structure of the output is necessarily that of
+/// the input (a unary function, or a function whose other arguments are
+/// scalars or run-end encoded arrays sharing the same run ends), the function
+/// is applied to the physical values only and the run ends are carried over
+/// unchanged; otherwise the inputs are decoded, the function is applied, and
+/// the result is re-encoded.  The output is always run-end encoded.
+///
+/// The wrapped function is invoked by name with default options, so this
+/// should only be used with functions that take no options.
+void AddRunEndEncodedKernels(ScalarFunction* func);
+
 }  // namespace ree_util
 }  // namespace internal
 }  // namespace compute
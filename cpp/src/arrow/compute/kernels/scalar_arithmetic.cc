@@ -28,10 +28,12 @@
 #include "arrow/compute/kernels/base_arithmetic_internal.h"
 #include "arrow/compute/kernels/codegen_internal.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/ree_util_internal.h"
 #include "arrow/compute/kernels/util_internal.h"
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/cpu_info.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging_internal.h"
@@ -1417,6 +1419,11 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
   // it is advised to template the actual executors with physical execution
   // types (e.g. Int64 instead of Duration or Timestamp).
 
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  const bool has_avx512 = arrow::internal::CpuInfo::GetInstance()->IsSupported(
+      arrow::internal::CpuInfo::AVX512);
+#endif
+
   // ----------------------------------------------------------------------
   auto absolute_value =
       MakeUnaryArithmeticFunction<AbsoluteValue>("abs", absolute_value_doc);
@@ -1429,6 +1436,7 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
         absolute_value->AddKernel({duration(unit)}, OutputType(duration(unit)), exec));
   }
 
+  ree_util::AddRunEndEncodedKernels(absolute_value.get());
   DCHECK_OK(registry->AddFunction(std::move(absolute_value)));
 
   // ----------------------------------------------------------------------
@@ -1442,6 +1450,7 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
     DCHECK_OK(absolute_value_checked->AddKernel({duration(unit)},
                                                 OutputType(duration(unit)), exec));
   }
+  ree_util::AddRunEndEncodedKernels(absolute_value_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(absolute_value_checked)));
 
   // ----------------------------------------------------------------------
@@ -1466,6 +1475,13 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
   AddArithmeticFunctionTimeDuration<AddTimeDuration>(add);
   AddArithmeticFunctionDurationTime<AddTimeDuration>(add);
 
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  // Add the SIMD variants
+  if (has_avx512) {
+    AddAddAvx512Kernels(add.get());
+  }
+#endif
+  ree_util::AddRunEndEncodedKernels(add.get());
   DCHECK_OK(registry->AddFunction(std::move(add)));
 
   // ----------------------------------------------------------------------
@@ -1494,6 +1510,12 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
   AddArithmeticFunctionTimeDuration<AddTimeDurationChecked>(add_checked);
   AddArithmeticFunctionDurationTime<AddTimeDurationChecked>(add_checked);
 
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (has_avx512) {
+    AddAddCheckedAvx512Kernels(add_checked.get());
+  }
+#endif
+  ree_util::AddRunEndEncodedKernels(add_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(add_checked)));
 
   // ----------------------------------------------------------------------
@@ -1552,6 +1574,12 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
 
   AddArithmeticFunctionTimeDuration<SubtractTimeDuration>(subtract);
 
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (has_avx512) {
+    AddSubtractAvx512Kernels(subtract.get());
+  }
+#endif
+  ree_util::AddRunEndEncodedKernels(subtract.get());
   DCHECK_OK(registry->AddFunction(std::move(subtract)));
 
   // ----------------------------------------------------------------------
@@ -1618,6 +1646,12 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
 
   AddArithmeticFunctionTimeDuration<SubtractTimeDurationChecked>(subtract_checked);
 
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (has_avx512) {
+    AddSubtractCheckedAvx512Kernels(subtract_checked.get());
+  }
+#endif
+  ree_util::AddRunEndEncodedKernels(subtract_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(subtract_checked)));
 
   // ----------------------------------------------------------------------
@@ -1631,6 +1665,12 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
     DCHECK_OK(multiply->AddKernel({int64(), duration(unit)}, duration(unit), exec));
   }
 
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (has_avx512) {
+    AddMultiplyAvx512Kernels(multiply.get());
+  }
+#endif
+  ree_util::AddRunEndEncodedKernels(multiply.get());
   DCHECK_OK(registry->AddFunction(std::move(multiply)));
 
   // ----------------------------------------------------------------------
@@ -1648,6 +1688,12 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
         multiply_checked->AddKernel({int64(), duration(unit)}, duration(unit), exec));
   }
 
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (has_avx512) {
+    AddMultiplyCheckedAvx512Kernels(multiply_checked.get());
+  }
+#endif
+  ree_util::AddRunEndEncodedKernels(multiply_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(multiply_checked)));
 
   // ----------------------------------------------------------------------
@@ -1668,6 +1714,12 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
     DCHECK_OK(
         divide->AddKernel({duration(unit), duration(unit)}, float64(), std::move(exec)));
   }
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (has_avx512) {
+    AddDivideAvx512Kernels(divide.get());
+  }
+#endif
+  ree_util::AddRunEndEncodedKernels(divide.get());
   DCHECK_OK(registry->AddFunction(std::move(divide)));
 
   // ----------------------------------------------------------------------
@@ -1690,6 +1742,12 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
                                         std::move(exec)));
   }
 
+#if defined(ARROW_HAVE_RUNTIME_AVX512)
+  if (has_avx512) {
+    AddDivideCheckedAvx512Kernels(divide_checked.get());
+  }
+#endif
+  ree_util::AddRunEndEncodedKernels(divide_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(divide_checked)));
 
   // ----------------------------------------------------------------------
@@ -1702,6 +1760,7 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
     DCHECK_OK(negate->AddKernel({duration(unit)}, OutputType(duration(unit)), exec));
   }
 
+  ree_util::AddRunEndEncodedKernels(negate.get());
   DCHECK_OK(registry->AddFunction(std::move(negate)));
 
   // ----------------------------------------------------------------------
@@ -1716,6 +1775,7 @@ void RegisterScalarArithmetic(FunctionRegistry* registry) {
         negate_checked->AddKernel({duration(unit)}, OutputType(duration(unit)), exec));
   }
 
+  ree_util::AddRunEndEncodedKernels(negate_checked.get());
   DCHECK_OK(registry->AddFunction(std::move(negate_checked)));
 
   // ----------------------------------------------------------------------
@@ -0,0 +1,93 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/base_arithmetic_internal.h"
+#include "arrow/compute/kernels/codegen_internal.h"
+#include "arrow/compute/kernels/common_internal.h"
+#include "arrow/util/logging_internal.h"
+
+// This translation unit is compiled with AVX-512 code generation enabled (see
+// append_runtime_avx512_src in the build).  The op implementations are the
+// same ones scalar_arithmetic.cc instantiates at SimdLevel::NONE; here the
+// compiler is free to vectorize the per-element loops (including the overflow
+// checks of the *_checked variants) with 512-bit instructions.  Kernel
+// dispatch selects these kernels over the generic ones on supporting CPUs.
+
+namespace arrow {
+namespace compute {
+namespace internal {
+
+using applicator::ScalarBinaryEqualTypes;
+using applicator::ScalarBinaryNotNullEqualTypes;
+
+namespace {
+
+template <typename Op>
+void AddBinaryAvx512Kernels(ScalarFunction* func) {
+  for (const auto& ty : NumericTypes()) {
+    auto exec = ArithmeticExecFromOp<ScalarBinaryEqualTypes, Op>(ty);
+    ScalarKernel kernel({ty, ty}, ty, exec);
+    kernel.simd_level = SimdLevel::AVX512;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+}
+
+template <typename Op>
+void AddBinaryNotNullAvx512Kernels(ScalarFunction* func) {
+  for (const auto& ty : NumericTypes()) {
+    auto exec = ArithmeticExecFromOp<ScalarBinaryNotNullEqualTypes, Op>(ty);
+    ScalarKernel kernel({ty, ty}, ty, exec);
+    kernel.simd_level = SimdLevel::AVX512;
+    DCHECK_OK(func->AddKernel(std::move(kernel)));
+  }
+}
+
+}  // namespace
+
+void AddAddAvx512Kernels(ScalarFunction* func) { AddBinaryAvx512Kernels<Add>(func); }
+
+void AddAddCheckedAvx512Kernels(ScalarFunction* func) {
+  AddBinaryNotNullAvx512Kernels<AddChecked>(func);
+}
+
+void AddSubtractAvx512Kernels(ScalarFunction* func) {
+  AddBinaryAvx512Kernels<Subtract>(func);
+}
+
+void AddSubtractCheckedAvx512Kernels(ScalarFunction* func) {
+  AddBinaryNotNullAvx512Kernels<SubtractChecked>(func);
+}
+
+void AddMultiplyAvx512Kernels(ScalarFunction* func) {
+  AddBinaryAvx512Kernels<Multiply>(func);
+}
+
+void AddMultiplyCheckedAvx512Kernels(ScalarFunction* func) {
+  AddBinaryNotNullAvx512Kernels<MultiplyChecked>(func);
+}
+
+void AddDivideAvx512Kernels(ScalarFunction* func) {
+  AddBinaryNotNullAvx512Kernels<Divide>(func);
+}
+
+void AddDivideCheckedAvx512Kernels(ScalarFunction* func) {
+  AddBinaryNotNullAvx512Kernels<DivideChecked>(func);
+}
+
+}  // namespace internal
+}  // namespace compute
+}  // namespace arrow
@@ -2926,6 +2926,99 @@ TYPED_TEST(TestUnaryArithmeticFloating, Sign) {
   this->AssertUnaryOp(sign, this->MakeScalar(max), this->MakeScalar(1));
 }
 
+TEST(TestRunEndEncodedArithmetic, ScalarOperand) {
+  auto dense = ArrayFromJSON(int32(), "[1, 1, 1, 2, 2, null, null, 3]");
+  ASSERT_OK_AND_ASSIGN(Datum ree, RunEndEncode(dense));
+  Datum three(std::make_shared<Int32Scalar>(3));
+  ASSERT_OK_AND_ASSIGN(Datum added, CallFunction("add", {ree, three}));
+  // The result is run-end encoded and keeps the input's run structure
+  ASSERT_EQ(added.type()->id(), Type::RUN_END_ENCODED);
+  const auto& ree_array = checked_cast<const RunEndEncodedArray&>(*added.make_array());
+  ASSERT_EQ(ree_array.run_ends()->length(), 4);
+  ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(added));
+  ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction("add", {dense, three}));
+  AssertDatumsEqual(expected, decoded, /*verbose=*/true);
+
+  // Unary functions keep the run structure as well
+  ASSERT_OK_AND_ASSIGN(Datum negated, CallFunction("negate", {ree}));
+  ASSERT_EQ(negated.type()->id(), Type::RUN_END_ENCODED);
+  ASSERT_OK_AND_ASSIGN(decoded, RunEndDecode(negated));
+  ASSERT_OK_AND_ASSIGN(expected, CallFunction("negate", {dense}));
+  AssertDatumsEqual(expected, decoded, /*verbose=*/true);
+}
+
+TEST(TestRunEndEncodedArithmetic, SlicedInput) {
+  auto dense = ArrayFromJSON(int64(), "[7, 7, 7, 7, 0, 0, 1, 2, 2, 2]");
+  ASSERT_OK_AND_ASSIGN(Datum ree, RunEndEncode(dense));
+  Datum sliced(ree.make_array()->Slice(2, 6));
+  Datum one(std::make_shared<Int64Scalar>(1));
+  ASSERT_OK_AND_ASSIGN(Datum added, CallFunction("add", {sliced, one}));
+  ASSERT_EQ(added.length(), 6);
+  ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(added));
+  ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction("add", {dense->Slice(2, 6), one}));
+  AssertDatumsEqual(expected, decoded, /*verbose=*/true);
+}
+
+TEST(TestRunEndEncodedArithmetic, EncodedAndDenseOperands) {
+  auto dense = ArrayFromJSON(int32(), "[1, 1, 2, 2, null, 5]");
+  ASSERT_OK_AND_ASSIGN(Datum ree, RunEndEncode(dense));
+
+  // Both operands run-end encoded: the output of the scalar operand fast path
+  // shares the input's run ends, so this stays on the values-only path too.
+  Datum two(std::make_shared<Int32Scalar>(2));
+  ASSERT_OK_AND_ASSIGN(Datum doubled, CallFunction("multiply", {ree, two}));
+  ASSERT_OK_AND_ASSIGN(Datum summed, CallFunction("add", {ree, doubled}));
+  ASSERT_EQ(summed.type()->id(), Type::RUN_END_ENCODED);
+  ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(summed));
+  Datum three(std::make_shared<Int32Scalar>(3));
+  ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction("multiply", {dense, three}));
+  AssertDatumsEqual(expected, decoded, /*verbose=*/true);
+
+  // Mixed run-end encoded and dense operands fall back to decoding, but the
+  // output is still run-end encoded.
+  ASSERT_OK_AND_ASSIGN(Datum mixed, CallFunction("add", {ree, dense}));
+  ASSERT_EQ(mixed.type()->id(), Type::RUN_END_ENCODED);
+  ASSERT_OK_AND_ASSIGN(decoded, RunEndDecode(mixed));
+  ASSERT_OK_AND_ASSIGN(expected, CallFunction("add", {dense, dense}));
+  AssertDatumsEqual(expected, decoded, /*verbose=*/true);
+}
+
+TEST(TestArithmeticBufferReuse, InPlaceExecution) {
+  ExecContext ctx;
+  ctx.set_allow_buffer_reuse(true);
+  Datum one(std::make_shared<Int64Scalar>(1));
+
+  // With buffer reuse allowed and an exclusively-held input of the output
+  // type, the result is written into the input's own allocation
+  auto values = ArrayFromJSON(int64(), "[1, 2, null, 4]");
+  const uint8_t* input_data = values->data()->buffers[1]->data();
+  ASSERT_OK_AND_ASSIGN(Datum result, CallFunction("add", {values, one}, &ctx));
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[2, 3, null, 5]"), result);
+  ASSERT_EQ(result.array()->buffers[1]->data(), input_data);
+
+  // Chained in-place execution never allocates a new values buffer (the
+  // original array still aliases the buffer, so drop it first)
+  values.reset();
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("multiply", {result, one}, &ctx));
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("subtract", {result, one}, &ctx));
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[1, 2, null, 4]"), result);
+  ASSERT_EQ(result.array()->buffers[1]->data(), input_data);
+
+  // A buffer referenced elsewhere is never written into
+  auto shared_values = ArrayFromJSON(int64(), "[1, 2, 3]");
+  std::shared_ptr<Buffer> extra_reference = shared_values->data()->buffers[1];
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("add", {shared_values, one}, &ctx));
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[2, 3, 4]"), result);
+  ASSERT_NE(result.array()->buffers[1]->data(), extra_reference->data());
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 2, 3]"), *shared_values);
+
+  // Without the caller's opt-in nothing is reused
+  auto more_values = ArrayFromJSON(int64(), "[5, 6, 7]");
+  const uint8_t* more_data = more_values->data()->buffers[1]->data();
+  ASSERT_OK_AND_ASSIGN(result, CallFunction("add", {more_values, one}));
+  ASSERT_NE(result.array()->buffers[1]->data(), more_data);
+}
+
 }  // namespace
 }  // namespace compute
 }  // namespace arrow
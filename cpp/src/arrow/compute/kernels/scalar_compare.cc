@@ -22,6 +22,7 @@
 
 #include "arrow/compute/api_scalar.h"
 #include "arrow/compute/kernels/common_internal.h"
+#include "arrow/compute/kernels/ree_util_internal.h"
 #include "arrow/type.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
@@ -893,9 +894,8 @@ const FunctionDoc max_element_wise_doc{
 }  // namespace
 
 void RegisterScalarComparison(FunctionRegistry* registry) {
-  DCHECK_OK(registry->AddFunction(MakeCompareFunction<Equal>("equal", equal_doc)));
-  DCHECK_OK(
-      registry->AddFunction(MakeCompareFunction<NotEqual>("not_equal", not_equal_doc)));
+  auto equal = MakeCompareFunction<Equal>("equal", equal_doc);
+  auto not_equal = MakeCompareFunction<NotEqual>("not_equal", not_equal_doc);
 
   auto greater = MakeCompareFunction<Greater>("greater", greater_doc);
   auto greater_equal =
@@ -903,6 +903,12 @@ void RegisterScalarComparison(FunctionRegistry* registry) {
 
   auto less = MakeFlippedCompare("less", *greater, less_doc);
   auto less_equal = MakeFlippedCompare("less_equal", *greater_equal, less_equal_doc);
+  for (const auto& func :
+       {&equal, &not_equal, &less, &less_equal, &greater, &greater_equal}) {
+    ree_util::AddRunEndEncodedKernels(func->get());
+  }
+  DCHECK_OK(registry->AddFunction(std::move(equal)));
+  DCHECK_OK(registry->AddFunction(std::move(not_equal)));
   DCHECK_OK(registry->AddFunction(std::move(less)));
   DCHECK_OK(registry->AddFunction(std::move(less_equal)));
   DCHECK_OK(registry->AddFunction(std::move(greater)));
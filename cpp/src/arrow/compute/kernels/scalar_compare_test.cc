@@ -2129,5 +2129,19 @@ TEST(TestMaxElementWiseMinElementWise, CommonTemporal) {
               ResultWith(ScalarFromJSON(duration(TimeUnit::MILLI), "1000")));
 }
 
+TEST(TestRunEndEncodedCompare, ScalarOperand) {
+  auto dense = ArrayFromJSON(int32(), "[5, 5, 5, 1, 1, null, 9]");
+  ASSERT_OK_AND_ASSIGN(Datum ree, RunEndEncode(dense));
+  Datum four(std::make_shared<Int32Scalar>(4));
+  for (std::string comparison : {"equal", "less", "greater_equal"}) {
+    ASSERT_OK_AND_ASSIGN(Datum result, CallFunction(comparison, {ree, four}));
+    // The comparison runs on the physical values and keeps the run structure
+    ASSERT_EQ(result.type()->id(), Type::RUN_END_ENCODED);
+    ASSERT_OK_AND_ASSIGN(Datum decoded, RunEndDecode(result));
+    ASSERT_OK_AND_ASSIGN(Datum expected, CallFunction(comparison, {dense, four}));
+    AssertDatumsEqual(expected, decoded, /*verbose=*/true);
+  }
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -17,12 +17,14 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstring>
 #include <iterator>
 #include <memory>
 #include <string>
 
 #include "arrow/array/builder_nested.h"
 #include "arrow/array/builder_primitive.h"
+#include "arrow/compute/kernels/dict_util_internal.h"
 #include "arrow/compute/kernels/scalar_string_internal.h"
 #include "arrow/result.h"
 #include "arrow/util/config.h"
@@ -1224,10 +1226,13 @@ void StringBoolTransform(KernelContext* ctx, const ExecSpan& batch,
 
 using MatchSubstringState = OptionsWrapper<MatchSubstringOptions>;
 
-// This is an implementation of the Knuth-Morris-Pratt algorithm
+// A memmem-style scanner: memchr skips to candidate positions matching the
+// first pattern byte, then the last pattern byte is checked before verifying
+// the candidate with memcmp.  memchr and memcmp are vectorized by libc, so
+// this is much faster than a byte-at-a-time scan for the short patterns and
+// long haystacks typical of substring filters.
 struct PlainSubstringMatcher {
   const MatchSubstringOptions& options_;
-  std::vector<int64_t> prefix_table;
 
   static Result<std::unique_ptr<PlainSubstringMatcher>> Make(
       const MatchSubstringOptions& options) {
@@ -1237,38 +1242,28 @@ struct PlainSubstringMatcher {
   }
 
   explicit PlainSubstringMatcher(const MatchSubstringOptions& options)
-      : options_(options) {
-    // Phase 1: Build the prefix table
-    const auto pattern_length = options_.pattern.size();
-    prefix_table.resize(pattern_length + 1, /*value=*/0);
-    int64_t prefix_length = -1;
-    prefix_table[0] = -1;
-    for (size_t pos = 0; pos < pattern_length; ++pos) {
-      // The prefix cannot be expanded, reset.
-      while (prefix_length >= 0 &&
-             options_.pattern[pos] != options_.pattern[prefix_length]) {
-        prefix_length = prefix_table[prefix_length];
-      }
-      prefix_length++;
-      prefix_table[pos + 1] = prefix_length;
-    }
-  }
+      : options_(options) {}
 
   int64_t Find(std::string_view current) const {
-    // Phase 2: Find the prefix in the data
-    const auto pattern_length = options_.pattern.size();
-    int64_t pattern_pos = 0;
-    int64_t pos = 0;
+    const std::string& pattern = options_.pattern;
+    const size_t pattern_length = pattern.size();
     if (pattern_length == 0) return 0;
-    for (const auto c : current) {
-      while ((pattern_pos >= 0) && (options_.pattern[pattern_pos] != c)) {
-        pattern_pos = prefix_table[pattern_pos];
+    if (current.size() < pattern_length) return -1;
+    const char last = pattern.back();
+    const char* haystack = current.data();
+    const char* pos = haystack;
+    const char* last_candidate = haystack + current.size() - pattern_length;
+    while (pos <= last_candidate) {
+      pos = static_cast<const char*>(
+          std::memchr(pos, pattern.front(), last_candidate - pos + 1));
+      if (pos == nullptr) return -1;
+      // The cheap filter on the last byte rejects most false candidates
+      // without touching the middle of the pattern.
+      if (pos[pattern_length - 1] == last &&
+          std::memcmp(pos, pattern.data(), pattern_length) == 0) {
+        return pos - haystack;
       }
-      pattern_pos++;
-      if (static_cast<size_t>(pattern_pos) == pattern_length) {
-        return pos + 1 - pattern_length;
-      }
-      pos++;
+      ++pos;
     }
     return -1;
   }
@@ -1312,6 +1307,113 @@ struct PlainEndsWithMatcher {
   }
 };
 
+// Case-insensitive matching of an all-ASCII pattern reduces to a bytewise
+// scan with ASCII lowercasing: UTF-8 continuation bytes never compare equal
+// to ASCII, so multi-byte sequences in the haystack cannot produce false
+// matches.  The exceptions are 'k' and 's', which also case-fold from
+// U+212A (KELVIN SIGN) and U+017F (LATIN SMALL LETTER LONG S); patterns
+// containing them must keep the regex path to preserve those matches in
+// UTF-8 data.
+static bool CanMatchIgnoreCaseBytewise(const std::string& pattern, bool is_utf8) {
+  for (const char c : pattern) {
+    const auto code_unit = static_cast<uint8_t>(c);
+    if (code_unit >= 0x80) return false;
+    if (is_utf8) {
+      const uint8_t lower = ascii_tolower(code_unit);
+      if (lower == 'k' || lower == 's') return false;
+    }
+  }
+  return true;
+}
+
+// `data` and `pattern_lower` must have the same length, and `pattern_lower`
+// must already be ASCII-lowercased
+static bool EqualsIgnoreCaseAscii(std::string_view data, std::string_view pattern_lower) {
+  for (size_t i = 0; i < pattern_lower.size(); ++i) {
+    if (ascii_tolower(static_cast<uint8_t>(data[i])) !=
+        static_cast<uint8_t>(pattern_lower[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static std::string AsciiLowerPattern(const MatchSubstringOptions& options) {
+  std::string lower = options.pattern;
+  std::transform(lower.begin(), lower.end(), lower.begin(), [](char c) {
+    return static_cast<char>(ascii_tolower(static_cast<uint8_t>(c)));
+  });
+  return lower;
+}
+
+// Bytewise matchers for case-insensitive ASCII patterns, avoiding the regex
+// engine (see CanMatchIgnoreCaseBytewise for when they apply)
+struct PlainSubstringIgnoreCaseMatcher {
+  const std::string pattern_lower_;
+
+  static Result<std::unique_ptr<PlainSubstringIgnoreCaseMatcher>> Make(
+      const MatchSubstringOptions& options) {
+    DCHECK(options.ignore_case);
+    return std::make_unique<PlainSubstringIgnoreCaseMatcher>(options);
+  }
+
+  explicit PlainSubstringIgnoreCaseMatcher(const MatchSubstringOptions& options)
+      : pattern_lower_(AsciiLowerPattern(options)) {}
+
+  bool Match(std::string_view current) const {
+    const size_t pattern_length = pattern_lower_.size();
+    if (pattern_length == 0) return true;
+    if (current.size() < pattern_length) return false;
+    const uint8_t first = static_cast<uint8_t>(pattern_lower_.front());
+    const size_t last_candidate = current.size() - pattern_length;
+    for (size_t pos = 0; pos <= last_candidate; ++pos) {
+      if (ascii_tolower(static_cast<uint8_t>(current[pos])) == first &&
+          EqualsIgnoreCaseAscii(current.substr(pos, pattern_length), pattern_lower_)) {
+        return true;
+      }
+    }
+    return false;
+  }
+};
+
+struct PlainStartsWithIgnoreCaseMatcher {
+  const std::string pattern_lower_;
+
+  static Result<std::unique_ptr<PlainStartsWithIgnoreCaseMatcher>> Make(
+      const MatchSubstringOptions& options) {
+    DCHECK(options.ignore_case);
+    return std::make_unique<PlainStartsWithIgnoreCaseMatcher>(options);
+  }
+
+  explicit PlainStartsWithIgnoreCaseMatcher(const MatchSubstringOptions& options)
+      : pattern_lower_(AsciiLowerPattern(options)) {}
+
+  bool Match(std::string_view current) const {
+    return current.size() >= pattern_lower_.size() &&
+           EqualsIgnoreCaseAscii(current.substr(0, pattern_lower_.size()),
+                                 pattern_lower_);
+  }
+};
+
+struct PlainEndsWithIgnoreCaseMatcher {
+  const std::string pattern_lower_;
+
+  static Result<std::unique_ptr<PlainEndsWithIgnoreCaseMatcher>> Make(
+      const MatchSubstringOptions& options) {
+    DCHECK(options.ignore_case);
+    return std::make_unique<PlainEndsWithIgnoreCaseMatcher>(options);
+  }
+
+  explicit PlainEndsWithIgnoreCaseMatcher(const MatchSubstringOptions& options)
+      : pattern_lower_(AsciiLowerPattern(options)) {}
+
+  bool Match(std::string_view current) const {
+    return current.size() >= pattern_lower_.size() &&
+           EqualsIgnoreCaseAscii(current.substr(current.size() - pattern_lower_.size()),
+                                 pattern_lower_);
+  }
+};
+
 #ifdef ARROW_WITH_RE2
 struct RegexSubstringMatcher {
   const MatchSubstringOptions& options_;
@@ -1392,6 +1494,12 @@ struct MatchSubstring<Type, PlainSubstringMatcher> {
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
     auto options = MatchSubstringState::Get(ctx);
     if (options.ignore_case) {
+      if (CanMatchIgnoreCaseBytewise(options.pattern, Type::is_utf8)) {
+        ARROW_ASSIGN_OR_RAISE(auto matcher,
+                              PlainSubstringIgnoreCaseMatcher::Make(options));
+        return MatchSubstringImpl<Type, PlainSubstringIgnoreCaseMatcher>::Exec(
+            ctx, batch, out, matcher.get());
+      }
 #ifdef ARROW_WITH_RE2
       ARROW_ASSIGN_OR_RAISE(
           auto matcher, RegexSubstringMatcher::Make(options, /*is_utf8=*/Type::is_utf8,
@@ -1413,6 +1521,12 @@ struct MatchSubstring<Type, PlainStartsWithMatcher> {
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
     auto options = MatchSubstringState::Get(ctx);
     if (options.ignore_case) {
+      if (CanMatchIgnoreCaseBytewise(options.pattern, Type::is_utf8)) {
+        ARROW_ASSIGN_OR_RAISE(auto matcher,
+                              PlainStartsWithIgnoreCaseMatcher::Make(options));
+        return MatchSubstringImpl<Type, PlainStartsWithIgnoreCaseMatcher>::Exec(
+            ctx, batch, out, matcher.get());
+      }
 #ifdef ARROW_WITH_RE2
       MatchSubstringOptions converted_options = options;
       converted_options.pattern = "^" + RE2::QuoteMeta(options.pattern);
@@ -1436,6 +1550,12 @@ struct MatchSubstring<Type, PlainEndsWithMatcher> {
   static Status Exec(KernelContext* ctx, const ExecSpan& batch, ExecResult* out) {
     auto options = MatchSubstringState::Get(ctx);
     if (options.ignore_case) {
+      if (CanMatchIgnoreCaseBytewise(options.pattern, Type::is_utf8)) {
+        ARROW_ASSIGN_OR_RAISE(auto matcher,
+                              PlainEndsWithIgnoreCaseMatcher::Make(options));
+        return MatchSubstringImpl<Type, PlainEndsWithIgnoreCaseMatcher>::Exec(
+            ctx, batch, out, matcher.get());
+      }
 #ifdef ARROW_WITH_RE2
       MatchSubstringOptions converted_options = options;
       converted_options.pattern = RE2::QuoteMeta(options.pattern) + "$";
@@ -3610,6 +3730,25 @@ void RegisterScalarStringAscii(FunctionRegistry* registry) {
 #endif
   AddAsciiStringJoin(registry);
   AddAsciiStringRepeat(registry);
+
+  // These unary functions are element-wise and value-local, so on dictionary
+  // input they can be applied to the dictionary values only.
+  dict_util::AddDictionaryValueKernels(
+      registry, {"ascii_is_alnum", "ascii_is_alpha", "ascii_is_decimal", "ascii_is_lower",
+                 "ascii_is_printable", "ascii_is_space", "ascii_is_title",
+                 "ascii_is_upper", "string_is_ascii", "ascii_upper", "ascii_lower",
+                 "ascii_swapcase", "ascii_capitalize", "ascii_title", "binary_length",
+                 "ascii_reverse", "binary_reverse", "ascii_trim", "ascii_ltrim",
+                 "ascii_rtrim", "ascii_trim_whitespace", "ascii_ltrim_whitespace",
+                 "ascii_rtrim_whitespace", "ascii_lpad", "ascii_rpad", "ascii_center",
+                 "match_substring", "starts_with", "ends_with", "find_substring",
+                 "count_substring", "replace_substring", "binary_replace_slice",
+                 "binary_slice"});
+#ifdef ARROW_WITH_RE2
+  dict_util::AddDictionaryValueKernels(
+      registry, {"match_substring_regex", "match_like", "find_substring_regex",
+                 "count_substring_regex", "replace_substring_regex"});
+#endif
 }
 
 }  // namespace internal
@@ -1182,6 +1182,32 @@ TYPED_TEST(TestStringKernels, Utf8Normalize) {
 
 #endif
 
+TEST(TestStringKernels, DictionaryValueKernels) {
+  auto dict_ty = dictionary(int32(), utf8());
+  auto input = DictArrayFromJSON(dict_ty, "[0, 1, null, 2, 1]",
+                                 R"(["foo", "bar", "Foobar"])");
+
+  // The function is applied to the dictionary values only and the indices
+  // are carried over unchanged
+  ASSERT_OK_AND_ASSIGN(Datum upper, CallFunction("ascii_upper", {input}));
+  auto expected_upper = DictArrayFromJSON(dict_ty, "[0, 1, null, 2, 1]",
+                                          R"(["FOO", "BAR", "FOOBAR"])");
+  AssertDatumsEqual(expected_upper, upper, /*verbose=*/true);
+
+  // Functions taking options and changing the output value type
+  MatchSubstringOptions match_options("foo");
+  ASSERT_OK_AND_ASSIGN(Datum matched, CallFunction("match_substring", {input},
+                                                   &match_options));
+  auto expected_matched = DictArrayFromJSON(
+      dictionary(int32(), boolean()), "[0, 1, null, 2, 1]", "[true, false, false]");
+  AssertDatumsEqual(expected_matched, matched, /*verbose=*/true);
+
+  ASSERT_OK_AND_ASSIGN(Datum length, CallFunction("binary_length", {input}));
+  auto expected_length = DictArrayFromJSON(dictionary(int32(), int32()),
+                                           "[0, 1, null, 2, 1]", "[3, 3, 6]");
+  AssertDatumsEqual(expected_length, length, /*verbose=*/true);
+}
+
 TEST(TestStringKernels, LARGE_MEMORY_TEST(Utf8Upper32bitGrowth)) {
   // 0x7fff * 0xffff is the max a 32 bit string array can hold
   // since the utf8_upper kernel can grow it by 3/2, the max we should accept is is
@@ -1205,6 +1231,10 @@ TYPED_TEST(TestStringKernels, Utf8Length) {
   this->CheckUnary("utf8_length",
                    R"(["aaa", null, "áéíóú", "ɑɽⱤoW😀", "áéí 0😀", "", "b"])",
                    this->offset_type(), "[3, null, 5, 6, 6, 0, 1]");
+  // Long enough to exercise the word-at-a-time counting path
+  this->CheckUnary("utf8_length",
+                   R"(["abcdefghijklmnopqrstuvwxyz", "áéíóúáéíóúáéíóúáéíóú!"])",
+                   this->offset_type(), "[26, 21]");
 }
 
 #ifdef ARROW_WITH_UTF8PROC
@@ -1552,6 +1582,14 @@ TYPED_TEST(TestBaseBinaryKernels, MatchSubstring) {
 
 #ifdef ARROW_WITH_RE2
 TYPED_TEST(TestStringKernels, MatchSubstringIgnoreCase) {
+  // ASCII pattern, matched bytewise
+  MatchSubstringOptions options_ascii{"aba", /*ignore_case=*/true};
+  this->CheckUnary("match_substring", R"([null, "", "ab", "aBa", "éaBac", "ÁBA"])",
+                   boolean(), "[null, false, false, true, true, false]", &options_ascii);
+  // "s" can also case-fold from U+017F, so it stays on the regex path
+  MatchSubstringOptions options_s{"s", /*ignore_case=*/true};
+  this->CheckUnary("match_substring", R"(["aSb", "ab"])", boolean(), "[true, false]",
+                   &options_s);
   MatchSubstringOptions options_insensitive{"aé(", /*ignore_case=*/true};
   this->CheckUnary("match_substring", R"(["abc", "aEb", "baÉ(", "aé(", "ae(", "Aé("])",
                    boolean(), "[false, false, true, true, false, true]",
@@ -1559,11 +1597,16 @@ TYPED_TEST(TestStringKernels, MatchSubstringIgnoreCase) {
 }
 #else
 TYPED_TEST(TestBaseBinaryKernels, MatchSubstringIgnoreCase) {
+  // ASCII patterns are matched bytewise and need no regex support
+  MatchSubstringOptions options{"aba", /*ignore_case=*/true};
+  this->CheckUnary("match_substring", R"([null, "", "ab", "aBa", "bAbAc"])", boolean(),
+                   "[null, false, false, true, true]", &options);
+
   Datum input = ArrayFromJSON(this->type(), R"(["a"])");
-  MatchSubstringOptions options{"a", /*ignore_case=*/true};
-  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented,
-                                  ::testing::HasSubstr("ignore_case requires RE2"),
-                                  CallFunction("match_substring", {input}, &options));
+  MatchSubstringOptions options_nonascii{"\xc3\xa9", /*ignore_case=*/true};
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, ::testing::HasSubstr("ignore_case requires RE2"),
+      CallFunction("match_substring", {input}, &options_nonascii));
 }
 #endif
 
@@ -1605,19 +1648,29 @@ TYPED_TEST(TestBaseBinaryKernels, MatchEndsWithIgnoreCase) {
 }
 #else
 TYPED_TEST(TestBaseBinaryKernels, MatchStartsWithIgnoreCase) {
+  // ASCII patterns are matched bytewise and need no regex support
+  MatchSubstringOptions options{"aBAb", /*ignore_case=*/true};
+  this->CheckUnary("starts_with", R"([null, "", "abab", "ABAB$", "$abab"])", boolean(),
+                   "[null, false, true, true, false]", &options);
+
   Datum input = ArrayFromJSON(this->type(), R"(["a"])");
-  MatchSubstringOptions options{"a", /*ignore_case=*/true};
-  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented,
-                                  ::testing::HasSubstr("ignore_case requires RE2"),
-                                  CallFunction("starts_with", {input}, &options));
+  MatchSubstringOptions options_nonascii{"\xc3\xa9", /*ignore_case=*/true};
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, ::testing::HasSubstr("ignore_case requires RE2"),
+      CallFunction("starts_with", {input}, &options_nonascii));
 }
 
 TYPED_TEST(TestBaseBinaryKernels, MatchEndsWithIgnoreCase) {
+  // ASCII patterns are matched bytewise and need no regex support
+  MatchSubstringOptions options{"aBAb", /*ignore_case=*/true};
+  this->CheckUnary("ends_with", R"([null, "", "abab", "$ABAB", "abab$"])", boolean(),
+                   "[null, false, true, true, false]", &options);
+
   Datum input = ArrayFromJSON(this->type(), R"(["a"])");
-  MatchSubstringOptions options{"a", /*ignore_case=*/true};
-  EXPECT_RAISES_WITH_MESSAGE_THAT(NotImplemented,
-                                  ::testing::HasSubstr("ignore_case requires RE2"),
-                                  CallFunction("ends_with", {input}, &options));
+  MatchSubstringOptions options_nonascii{"\xc3\xa9", /*ignore_case=*/true};
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      NotImplemented, ::testing::HasSubstr("ignore_case requires RE2"),
+      CallFunction("ends_with", {input}, &options_nonascii));
 }
 #endif
 
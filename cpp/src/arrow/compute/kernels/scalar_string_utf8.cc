@@ -19,6 +19,7 @@
 #include <mutex>
 #include <string>
 
+#include "arrow/compute/kernels/dict_util_internal.h"
 #include "arrow/compute/kernels/scalar_string_internal.h"
 #include "arrow/util/config.h"
 #include "arrow/util/logging_internal.h"
@@ -364,6 +365,15 @@ template <typename CodepointTransform>
 struct StringTransformCodepoint : public FunctionalCaseMappingTransform {
   int64_t Transform(const uint8_t* input, int64_t input_string_ncodeunits,
                     uint8_t* output) {
+    // Fast path for all-ASCII strings (the ASCII check itself is SIMD
+    // accelerated): case mapping is then a 1:1 byte-wise table lookup
+    // with no decoding or encoding involved.
+    if (arrow::util::ValidateAscii(input, input_string_ncodeunits)) {
+      for (int64_t i = 0; i < input_string_ncodeunits; ++i) {
+        output[i] = static_cast<uint8_t>(CodepointTransform::TransformCodepoint(input[i]));
+      }
+      return input_string_ncodeunits;
+    }
     uint8_t* output_start = output;
     if (ARROW_PREDICT_FALSE(
             !arrow::util::UTF8Transform(input, input + input_string_ncodeunits, &output,
@@ -1410,6 +1420,22 @@ void RegisterScalarStringUtf8(FunctionRegistry* registry) {
 #ifdef ARROW_WITH_UTF8PROC
   AddUtf8StringSplitWhitespace(registry);
 #endif
+
+  // These unary functions are element-wise and value-local, so on dictionary
+  // input they can be applied to the dictionary values only.
+  dict_util::AddDictionaryValueKernels(
+      registry, {"utf8_length", "utf8_reverse", "utf8_trim", "utf8_ltrim", "utf8_rtrim",
+                 "utf8_lpad", "utf8_rpad", "utf8_center", "utf8_replace_slice",
+                 "utf8_slice_codeunits"});
+#ifdef ARROW_WITH_UTF8PROC
+  dict_util::AddDictionaryValueKernels(
+      registry,
+      {"utf8_is_alnum", "utf8_is_alpha", "utf8_is_decimal", "utf8_is_digit",
+       "utf8_is_lower", "utf8_is_numeric", "utf8_is_printable", "utf8_is_space",
+       "utf8_is_title", "utf8_is_upper", "utf8_upper", "utf8_lower", "utf8_swapcase",
+       "utf8_capitalize", "utf8_title", "utf8_normalize", "utf8_trim_whitespace",
+       "utf8_ltrim_whitespace", "utf8_rtrim_whitespace"});
+#endif
 }
 
 }  // namespace internal
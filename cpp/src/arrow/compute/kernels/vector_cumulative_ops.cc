@@ -148,6 +148,42 @@ struct Accumulator {
 
     return st;
   }
+
+  // Write results directly into `out`, whose buffers alias the input
+  // allocation (see VectorKernel::can_reuse_input_buffers). The validity
+  // bitmap is already the input's; it only needs adjusting when nulls stop
+  // the accumulation.
+  Status AccumulateInPlace(const ArraySpan& input, ArrayData* out) {
+    using OutValue = typename GetOutputType<OutType>::T;
+    Status st = Status::OK();
+    auto* out_values = out->GetMutableValues<OutValue>(1);
+    int64_t position = 0;
+
+    if (skip_nulls || input.GetNullCount() == 0) {
+      VisitArrayValuesInline<ArgType>(
+          input,
+          [&](ArgValue v) { out_values[position++] = current_state.Call(ctx, v, &st); },
+          [&]() { ++position; });
+      out->null_count = input.GetNullCount();
+    } else {
+      int64_t valid_prefix = 0;
+      VisitArrayValuesInline<ArgType>(
+          input,
+          [&](ArgValue v) {
+            if (!encountered_null) {
+              out_values[position] = current_state.Call(ctx, v, &st);
+              ++valid_prefix;
+            }
+            ++position;
+          },
+          [&]() { encountered_null = true; ++position; });
+      // The input had nulls, so a validity bitmap is present and aliased
+      bit_util::SetBitsTo(out->buffers[0]->mutable_data(), valid_prefix,
+                          input.length - valid_prefix, false);
+      out->null_count = input.length - valid_prefix;
+    }
+    return st;
+  }
 };
 
 template <typename ArgType, typename CumulativeState, typename OptionsType>
@@ -164,6 +200,12 @@ struct CumulativeKernel {
     }
     accumulator.skip_nulls = options.skip_nulls;
 
+    if (out->is_array_data() && out->array_data()->buffers.size() > 1 &&
+        out->array_data()->buffers[1] != nullptr) {
+      // The executor handed us the input's own allocation to write into
+      return accumulator.AccumulateInPlace(batch[0].array, out->array_data().get());
+    }
+
     RETURN_NOT_OK(accumulator.builder.Reserve(batch.length));
     RETURN_NOT_OK(accumulator.Accumulate(batch[0].array));
 
@@ -272,6 +314,9 @@ struct CumulativeStatefulKernelFactory {
     kernel.can_execute_chunkwise = false;
     kernel.null_handling = NullHandling::type::COMPUTED_NO_PREALLOCATE;
     kernel.mem_allocation = MemAllocation::type::NO_PREALLOCATE;
+    // Length-preserving with output slots depending only on earlier input
+    // slots, so the output may overwrite an exclusively-held input
+    kernel.can_reuse_input_buffers = true;
     kernel.init = CumulativeOptionsWrapper<OptionsType>::Init;
   }
 
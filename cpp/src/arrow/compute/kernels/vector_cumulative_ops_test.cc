@@ -949,5 +949,29 @@ TEST(TestCumulative, NaN) {
   CheckVectorUnary("cumulative_mean", ArrayFromJSON(float64(), "[5, 4, NaN, 2, 1]"),
                    ArrayFromJSON(float64(), "[5, 4.5, NaN, NaN, NaN]"));
 }
+
+TEST(TestCumulative, InPlaceBufferReuse) {
+  ExecContext ctx;
+  ctx.set_allow_buffer_reuse(true);
+  CumulativeOptions options;
+
+  // With buffer reuse allowed and exclusively-held input buffers, the result
+  // is written into the input's own allocation
+  auto values = ArrayFromJSON(int64(), "[1, 2, null, 3]");
+  const uint8_t* input_data = values->data()->buffers[1]->data();
+  ASSERT_OK_AND_ASSIGN(
+      Datum result, CallFunction("cumulative_sum", {values}, &options, &ctx));
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[1, 3, null, null]"), result);
+  ASSERT_EQ(result.array()->buffers[1]->data(), input_data);
+
+  // A buffer referenced elsewhere is never written into
+  auto shared_values = ArrayFromJSON(int64(), "[1, 2, 3]");
+  std::shared_ptr<Buffer> extra_reference = shared_values->data()->buffers[1];
+  ASSERT_OK_AND_ASSIGN(
+      result, CallFunction("cumulative_sum", {shared_values}, &options, &ctx));
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[1, 3, 6]"), result);
+  ASSERT_NE(result.array()->buffers[1]->data(), extra_reference->data());
+  AssertArraysEqual(*ArrayFromJSON(int64(), "[1, 2, 3]"), *shared_values);
+}
 }  // namespace compute
 }  // namespace arrow
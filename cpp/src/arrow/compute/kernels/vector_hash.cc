@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstring>
 #include <memory>
 #include <mutex>
@@ -34,6 +35,8 @@
 #include "arrow/util/hashing.h"
 #include "arrow/util/int_util.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/unreachable.h"
 
 namespace arrow {
@@ -299,6 +302,12 @@ class RegularHashKernel : public HashKernel {
 
   template <bool HasError = with_error_status>
   enable_if_t<!HasError, Status> DoAppend(const ArraySpan& arr) {
+    if constexpr (std::is_same<MemoTable,
+                               ::arrow::internal::ScalarMemoTable<Scalar>>::value) {
+      if (arr.GetNullCount() == 0) {
+        return DoAppendBatched(arr);
+      }
+    }
     return VisitArraySpanInline<Type>(
         arr,
         [this](Scalar v) {
@@ -366,6 +375,32 @@ class RegularHashKernel : public HashKernel {
  protected:
   using MemoTable = typename HashTraits<Type>::MemoTableType;
 
+  // Mini-batch size for precomputed hashes: small enough that the hash
+  // scratch stays in L1, large enough for the hash loop to vectorize
+  static constexpr int64_t kHashBatchSize = 512;
+
+  // Fast path for fixed-width values without nulls: hash a whole mini-batch
+  // up front (see ComputeHashBatch), then probe the memo table with the
+  // precomputed hashes
+  Status DoAppendBatched(const ArraySpan& arr) {
+    const Scalar* values = arr.GetValues<Scalar>(1);
+    ::arrow::internal::hash_t hashes[kHashBatchSize];
+    auto on_found = [this](int32_t memo_index) { action_.ObserveFound(memo_index); };
+    auto on_not_found = [this](int32_t memo_index) {
+      action_.ObserveNotFound(memo_index);
+    };
+    for (int64_t start = 0; start < arr.length; start += kHashBatchSize) {
+      const int64_t batch_size = std::min(kHashBatchSize, arr.length - start);
+      ::arrow::internal::ComputeHashBatch(values + start, batch_size, hashes);
+      for (int64_t i = 0; i < batch_size; ++i) {
+        int32_t unused_memo_index;
+        RETURN_NOT_OK(memo_table_->GetOrInsert(values[start + i], hashes[i], on_found,
+                                               on_not_found, &unused_memo_index));
+      }
+    }
+    return Status::OK();
+  }
+
   MemoryPool* pool_;
   std::shared_ptr<DataType> type_;
   Action action_;
@@ -726,6 +761,14 @@ const FunctionDoc unique_doc("Compute unique elements",
                               "Nulls are considered as a distinct value as well."),
                              {"array"});
 
+const FunctionDoc array_unique_doc(
+    "Compute unique elements of an array",
+    ("Return an array with distinct values.\n"
+     "Nulls are considered as a distinct value as well.\n"
+     "Unlike \"unique\", a chunked input is always processed serially\n"
+     "through a single memo table."),
+    {"array"});
+
 const FunctionDoc value_counts_doc(
     "Compute counts of unique elements",
     ("For each distinct value, compute the number of times it occurs in the array.\n"
@@ -755,6 +798,46 @@ const FunctionDoc dictionary_decode_doc{
      "This function does nothing if the input is not a dictionary."),
     {"dictionary_array"}};
 
+// "unique" dispatches to the kernel-based "array_unique" function.  For a
+// multi-chunk input with threading enabled, chunks are deduplicated in
+// parallel with one memo table per task and the per-chunk results are
+// merged by a final serial pass over their concatenation, which is
+// typically much smaller than the input.  Order of first appearance is
+// preserved: each chunk keeps its internal order and chunks are
+// concatenated in input order.
+class UniqueMetaFunction : public MetaFunction {
+ public:
+  UniqueMetaFunction() : MetaFunction("unique", Arity::Unary(), unique_doc) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    if (args[0].is_chunked_array() && ctx->use_threads() &&
+        args[0].chunked_array()->num_chunks() > 1) {
+      return UniqueParallel(*args[0].chunked_array(), ctx);
+    }
+    return CallFunction("array_unique", args, ctx);
+  }
+
+ private:
+  Result<Datum> UniqueParallel(const ChunkedArray& chunked, ExecContext* ctx) const {
+    ArrayVector chunk_uniques(chunked.num_chunks());
+    auto* executor = ctx->executor() != nullptr ? ctx->executor()
+                                                : ::arrow::internal::GetCpuThreadPool();
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        chunked.num_chunks(),
+        [&](int i) {
+          ARROW_ASSIGN_OR_RAISE(Datum chunk_result,
+                                CallFunction("array_unique", {chunked.chunk(i)}, ctx));
+          chunk_uniques[i] = chunk_result.make_array();
+          return Status::OK();
+        },
+        executor));
+    ARROW_ASSIGN_OR_RAISE(auto combined, Concatenate(chunk_uniques, ctx->memory_pool()));
+    return CallFunction("array_unique", {combined}, ctx);
+  }
+};
+
 class DictionaryDecodeMetaFunction : public MetaFunction {
  public:
   DictionaryDecodeMetaFunction()
@@ -787,7 +870,8 @@ void RegisterVectorHash(FunctionRegistry* registry) {
 
   base.finalize = UniqueFinalize;
   base.output_chunked = false;
-  auto unique = std::make_shared<VectorFunction>("unique", Arity::Unary(), unique_doc);
+  auto unique =
+      std::make_shared<VectorFunction>("array_unique", Arity::Unary(), array_unique_doc);
   AddHashKernels<UniqueAction>(unique.get(), base, FirstType);
 
   // Dictionary unique
@@ -798,6 +882,10 @@ void RegisterVectorHash(FunctionRegistry* registry) {
 
   DCHECK_OK(registry->AddFunction(std::move(unique)));
 
+  // "unique" wraps "array_unique" and deduplicates the chunks of a chunked
+  // input in parallel (mirroring the "take" / "array_take" split)
+  DCHECK_OK(registry->AddFunction(std::make_shared<UniqueMetaFunction>()));
+
   // ----------------------------------------------------------------------
   // value_counts
 
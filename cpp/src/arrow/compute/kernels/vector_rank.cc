@@ -15,14 +15,18 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <functional>
 #include <memory>
+#include <vector>
 
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/math_internal.h"
+#include "arrow/util/parallel.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow::compute::internal {
 
@@ -47,9 +51,8 @@ void MarkDuplicates(const NullPartitionResult& sorted, ValueSelector&& value_sel
     T prev_value = value_selector(*it);
     while (++it < sorted.non_nulls_end) {
       T curr_value = value_selector(*it);
-      if (curr_value == prev_value) {
-        *it |= kDuplicateMask;
-      }
+      // Branch-free so the adjacent-key comparison vectorizes
+      *it |= static_cast<uint64_t>(curr_value == prev_value) << 63;
       prev_value = curr_value;
     }
   }
@@ -205,7 +208,13 @@ struct NormalRanker : public BaseQuantileRanker<NormalRanker> {
   }
 };
 
-// A helper class that emits rankings for the "rank" function
+// A helper class that emits rankings for the "rank" function.
+//
+// The duplicate marks produced by MarkDuplicates delimit tie runs, so each
+// tiebreaker only needs the position of a run boundary to seed its rank
+// counter.  That makes the emission loops independent per slice of the
+// sorted indices: they are branch-free and run in parallel over segments
+// when the input is large enough.
 struct OrdinalRanker {
   explicit OrdinalRanker(RankOptions::Tiebreaker tiebreaker) : tiebreaker_(tiebreaker) {}
 
@@ -214,55 +223,117 @@ struct OrdinalRanker {
     ARROW_ASSIGN_OR_RAISE(auto rankings,
                           MakeMutableUInt64Array(length, ctx->memory_pool()));
     auto out_begin = rankings->GetMutableValues<uint64_t>(1);
-    uint64_t rank;
 
-    auto is_duplicate = [](uint64_t index) { return (index & kDuplicateMask) != 0; };
-    auto original_index = [](uint64_t index) { return index & ~kDuplicateMask; };
+    auto* executor = ctx->executor() != nullptr ? ctx->executor()
+                                                : ::arrow::internal::GetCpuThreadPool();
+    const int num_segments = static_cast<int>(std::clamp<int64_t>(
+        length / kMinRowsPerSegment, 1,
+        ctx->use_threads() ? executor->GetCapacity() : 1));
+    const int64_t segment_length = length / num_segments;
+    auto segment_begin = [&](int segment) {
+      return sorted.overall_begin() + segment * segment_length;
+    };
+    auto segment_end = [&](int segment) {
+      return segment == num_segments - 1 ? sorted.overall_end()
+                                         : segment_begin(segment + 1);
+    };
 
     switch (tiebreaker_) {
       case RankOptions::Dense: {
-        rank = 0;
-        for (auto it = sorted.overall_begin(); it < sorted.overall_end(); ++it) {
-          if (!is_duplicate(*it)) {
-            ++rank;
-          }
-          out_begin[original_index(*it)] = rank;
+        // The dense rank of a row is the number of tie runs starting at or
+        // before it: count run starts per segment, prefix-sum the counts,
+        // then emit with each segment seeded by its prefix.
+        std::vector<uint64_t> base(num_segments + 1, 0);
+        RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+            num_segments > 1, num_segments,
+            [&](int segment) {
+              base[segment + 1] = static_cast<uint64_t>(std::count_if(
+                  segment_begin(segment), segment_end(segment),
+                  [](uint64_t index) { return !IsDuplicate(index); }));
+              return Status::OK();
+            },
+            executor));
+        for (int segment = 0; segment < num_segments; ++segment) {
+          base[segment + 1] += base[segment];
         }
+        RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+            num_segments > 1, num_segments,
+            [&](int segment) {
+              uint64_t rank = base[segment];
+              for (auto it = segment_begin(segment); it < segment_end(segment); ++it) {
+                rank += !IsDuplicate(*it);
+                out_begin[OriginalIndex(*it)] = rank;
+              }
+              return Status::OK();
+            },
+            executor));
         break;
       }
 
       case RankOptions::First: {
-        rank = 0;
-        for (auto it = sorted.overall_begin(); it < sorted.overall_end(); it++) {
-          // No duplicate marks expected for RankOptions::First
-          DCHECK(!is_duplicate(*it));
-          out_begin[*it] = ++rank;
-        }
+        RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+            num_segments > 1, num_segments,
+            [&](int segment) {
+              uint64_t rank = segment_begin(segment) - sorted.overall_begin();
+              for (auto it = segment_begin(segment); it < segment_end(segment); ++it) {
+                // No duplicate marks expected for RankOptions::First
+                DCHECK(!IsDuplicate(*it));
+                out_begin[*it] = ++rank;
+              }
+              return Status::OK();
+            },
+            executor));
         break;
       }
 
       case RankOptions::Min: {
-        rank = 0;
-        for (auto it = sorted.overall_begin(); it < sorted.overall_end(); ++it) {
-          if (!is_duplicate(*it)) {
-            rank = (it - sorted.overall_begin()) + 1;
-          }
-          out_begin[original_index(*it)] = rank;
-        }
+        // The rank of a run is the position of its first row; a segment
+        // starting mid-run looks backwards for that run start.
+        RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+            num_segments > 1, num_segments,
+            [&](int segment) {
+              auto begin = segment_begin(segment);
+              auto run_start = begin;
+              while (run_start > sorted.overall_begin() && IsDuplicate(*run_start)) {
+                --run_start;
+              }
+              uint64_t rank = (run_start - sorted.overall_begin()) + 1;
+              for (auto it = begin; it < segment_end(segment); ++it) {
+                rank = IsDuplicate(*it)
+                           ? rank
+                           : static_cast<uint64_t>(it - sorted.overall_begin()) + 1;
+                out_begin[OriginalIndex(*it)] = rank;
+              }
+              return Status::OK();
+            },
+            executor));
         break;
       }
 
       case RankOptions::Max: {
-        rank = length;
-        for (auto it = sorted.overall_end() - 1; it >= sorted.overall_begin(); --it) {
-          out_begin[original_index(*it)] = rank;
-          // If the current index isn't marked as duplicate, then it's the last
-          // tie in a row (since we iterate in reverse order), so update rank
-          // for the next row of ties.
-          if (!is_duplicate(*it)) {
-            rank = it - sorted.overall_begin();
-          }
-        }
+        // The rank of a run is the position of its last row; a segment
+        // ending mid-run looks forwards for the start of the next run.
+        RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+            num_segments > 1, num_segments,
+            [&](int segment) {
+              auto end = segment_end(segment);
+              auto run_end = end;
+              while (run_end < sorted.overall_end() && IsDuplicate(*run_end)) {
+                ++run_end;
+              }
+              uint64_t rank = run_end - sorted.overall_begin();
+              for (auto it = end - 1; it >= segment_begin(segment); --it) {
+                out_begin[OriginalIndex(*it)] = rank;
+                // If the current index isn't marked as duplicate, then it's
+                // the last tie in a row (since we iterate in reverse order),
+                // so update rank for the next row of ties.
+                rank = IsDuplicate(*it)
+                           ? rank
+                           : static_cast<uint64_t>(it - sorted.overall_begin());
+              }
+              return Status::OK();
+            },
+            executor));
         break;
       }
     }
@@ -271,6 +342,12 @@ struct OrdinalRanker {
   }
 
  private:
+  static bool IsDuplicate(uint64_t index) { return (index & kDuplicateMask) != 0; }
+  static uint64_t OriginalIndex(uint64_t index) { return index & ~kDuplicateMask; }
+
+  // Below this many rows per segment the per-task overhead dominates
+  static constexpr int64_t kMinRowsPerSegment = 64 * 1024;
+
   const RankOptions::Tiebreaker tiebreaker_;
 };
 
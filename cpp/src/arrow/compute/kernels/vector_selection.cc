@@ -203,6 +203,134 @@ class DropNullMetaFunction : public MetaFunction {
   }
 };
 
+// ----------------------------------------------------------------------
+// FilterCompare Implementation
+
+// Number of rows the comparison and the filter process per iteration.  The
+// boolean selection for one block stays cache resident, so fusing the two
+// steps never materializes a full-length intermediate array.
+constexpr int64_t kFilterCompareBlockLength = 64 * 1024;
+
+bool IsComparisonFunctionName(const std::string& name) {
+  return name == "equal" || name == "not_equal" || name == "greater" ||
+         name == "greater_equal" || name == "less" || name == "less_equal";
+}
+
+Result<Datum> FilterCompareBlocks(const Datum& values, const Datum& on,
+                                  const Datum& against,
+                                  const FilterCompareOptions& options,
+                                  ExecContext* ctx) {
+  const FilterOptions filter_options(options.null_selection_behavior);
+  const std::shared_ptr<Array> on_array = on.make_array();
+  const int64_t length = values.length();
+  ArrayVector out_arrays;
+  RecordBatchVector out_batches;
+  for (int64_t offset = 0; offset < length; offset += kFilterCompareBlockLength) {
+    const int64_t block_length = std::min(kFilterCompareBlockLength, length - offset);
+    Datum against_block =
+        against.is_scalar() ? against
+                            : Datum(against.make_array()->Slice(offset, block_length));
+    ARROW_ASSIGN_OR_RAISE(
+        Datum selection,
+        CallFunction(options.comparison,
+                     {Datum(on_array->Slice(offset, block_length)), against_block},
+                     ctx));
+    Datum values_block = values.kind() == Datum::RECORD_BATCH
+                             ? Datum(values.record_batch()->Slice(offset, block_length))
+                             : Datum(values.make_array()->Slice(offset, block_length));
+    ARROW_ASSIGN_OR_RAISE(Datum filtered,
+                          Filter(values_block, selection, filter_options, ctx));
+    if (filtered.length() == 0) {
+      continue;
+    }
+    if (values.kind() == Datum::RECORD_BATCH) {
+      out_batches.push_back(filtered.record_batch());
+    } else {
+      out_arrays.push_back(filtered.make_array());
+    }
+  }
+  if (values.kind() == Datum::RECORD_BATCH) {
+    if (out_batches.empty()) {
+      return RecordBatch::MakeEmpty(values.record_batch()->schema(),
+                                    ctx->memory_pool());
+    }
+    ARROW_ASSIGN_OR_RAISE(auto out_batch, ConcatenateRecordBatches(
+                                              out_batches, ctx->memory_pool()));
+    return Datum(out_batch);
+  }
+  if (out_arrays.empty()) {
+    return MakeEmptyArray(values.type(), ctx->memory_pool());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto out_array, Concatenate(out_arrays, ctx->memory_pool()));
+  return out_array;
+}
+
+const FunctionDoc filter_compare_doc(
+    "Filter the input with a comparison evaluated on the fly",
+    ("The output is equivalent to `filter(input, comparison(on, against))`,\n"
+     "but the comparison and the filter are applied one block of rows at a\n"
+     "time so that the boolean selection is never materialized for the whole\n"
+     "input.  The comparison function and the handling of nulls in the\n"
+     "selection are configurable through FilterCompareOptions."),
+    {"input", "on", "against"}, "FilterCompareOptions");
+
+class FilterCompareMetaFunction : public MetaFunction {
+ public:
+  FilterCompareMetaFunction()
+      : MetaFunction("filter_compare", Arity::Ternary(), filter_compare_doc,
+                     GetDefaultFilterCompareOptions()) {}
+
+  Result<Datum> ExecuteImpl(const std::vector<Datum>& args,
+                            const FunctionOptions* options,
+                            ExecContext* ctx) const override {
+    const auto& filter_compare_options =
+        checked_cast<const FilterCompareOptions&>(*options);
+    if (!IsComparisonFunctionName(filter_compare_options.comparison)) {
+      return Status::Invalid("filter_compare expects a comparison function name, got '",
+                             filter_compare_options.comparison, "'");
+    }
+    const Datum& values = args[0];
+    const Datum& on = args[1];
+    const Datum& against = args[2];
+    if (on.kind() != Datum::ARRAY) {
+      return Status::NotImplemented("filter_compare `on` argument of kind ",
+                                    ToString(on.kind()));
+    }
+    if (on.length() != values.length()) {
+      return Status::Invalid("filter_compare `on` argument must have the same length ",
+                             "as the input (got ", on.length(), " and ",
+                             values.length(), ")");
+    }
+    if (against.kind() == Datum::ARRAY) {
+      if (against.length() != values.length()) {
+        return Status::Invalid("filter_compare `against` argument must have the same ",
+                               "length as the input (got ", against.length(), " and ",
+                               values.length(), ")");
+      }
+    } else if (!against.is_scalar()) {
+      return Status::NotImplemented("filter_compare `against` argument of kind ",
+                                    ToString(against.kind()));
+    }
+    switch (values.kind()) {
+      case Datum::ARRAY:
+      case Datum::RECORD_BATCH:
+        return FilterCompareBlocks(values, on, against, filter_compare_options, ctx);
+      default:
+        break;
+    }
+    return Status::NotImplemented(
+        "Unsupported types for filter_compare operation: "
+        "values=",
+        values.ToString());
+  }
+
+ private:
+  static const FilterCompareOptions* GetDefaultFilterCompareOptions() {
+    static const auto kDefaultFilterCompareOptions = FilterCompareOptions::Defaults();
+    return &kDefaultFilterCompareOptions;
+  }
+};
+
 // ----------------------------------------------------------------------
 
 const FunctionDoc array_filter_doc(
@@ -332,6 +460,8 @@ void RegisterVectorSelection(FunctionRegistry* registry) {
 
   DCHECK_OK(registry->AddFunction(MakeFilterMetaFunction()));
 
+  DCHECK_OK(registry->AddFunction(std::make_shared<FilterCompareMetaFunction>()));
+
   // Take kernels
   std::vector<SelectionKernelData> take_kernels;
   PopulateTakeKernels(&take_kernels);
@@ -19,12 +19,14 @@
 #include <cstring>
 #include <limits>
 #include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "arrow/array/builder_primitive.h"
 #include "arrow/array/concatenate.h"
 #include "arrow/buffer_builder.h"
+#include "arrow/chunk_resolver.h"
 #include "arrow/chunked_array.h"
 #include "arrow/compute/api_vector.h"
 #include "arrow/compute/kernels/codegen_internal.h"
@@ -544,6 +546,127 @@ const FunctionDoc take_doc(
      "given by `indices`.  Nulls in `indices` emit null in the output."),
     {"input", "indices"}, "TakeOptions");
 
+// ----------------------------------------------------------------------
+// Direct take from a ChunkedArray without concatenation
+//
+// For fixed-width value types, indices can be resolved to (chunk,
+// index-in-chunk) locations in bulk with ChunkResolver::ResolveMany and the
+// values gathered straight into a single output array, instead of first
+// concatenating all chunks (which copies the entire input).
+
+bool CanTakeChunkedWithoutConcatenation(const DataType& type) {
+  // Bit-packed (boolean) and nested/varlen types still go through
+  // concatenation
+  if (type.id() == Type::BOOL) {
+    return false;
+  }
+  return (is_primitive(type.id()) || is_decimal(type.id()) ||
+          type.id() == Type::FIXED_SIZE_BINARY) &&
+         checked_cast<const FixedWidthType&>(type).bit_width() % 8 == 0;
+}
+
+template <typename IndexCType>
+Result<std::shared_ptr<ArrayData>> TakeChunkedFixedWidthImpl(
+    const ChunkedArray& values, const ArraySpan& indices, int64_t byte_width,
+    MemoryPool* pool) {
+  const int64_t n = indices.length;
+  const auto* index_values = indices.GetValues<IndexCType>(1);
+
+  ChunkResolver resolver(values.chunks());
+  std::vector<TypedChunkLocation<IndexCType>> locations(n);
+  if (!resolver.ResolveMany<IndexCType>(n, index_values, locations.data())) {
+    // Chunk indices don't fit in IndexCType (pathological number of chunks);
+    // the caller falls back to concatenation
+    return nullptr;
+  }
+
+  const auto num_chunks = static_cast<size_t>(values.num_chunks());
+  std::vector<const uint8_t*> chunk_data(num_chunks);
+  std::vector<const uint8_t*> chunk_validity(num_chunks);
+  std::vector<int64_t> chunk_offsets(num_chunks);
+  bool values_have_nulls = false;
+  for (size_t c = 0; c < num_chunks; ++c) {
+    const auto& chunk = *values.chunk(static_cast<int>(c));
+    chunk_data[c] = chunk.data()->GetValues<uint8_t>(1, chunk.offset() * byte_width);
+    chunk_validity[c] = chunk.null_bitmap_data();
+    chunk_offsets[c] = chunk.offset();
+    values_have_nulls = values_have_nulls || chunk.null_count() != 0;
+  }
+
+  const bool indices_have_nulls = indices.MayHaveNulls();
+  const uint8_t* indices_validity = indices.buffers[0].data;
+
+  ARROW_ASSIGN_OR_RAISE(auto out_data, AllocateBuffer(n * byte_width, pool));
+  std::shared_ptr<Buffer> out_validity;
+  uint8_t* out_validity_data = nullptr;
+  if (indices_have_nulls || values_have_nulls) {
+    ARROW_ASSIGN_OR_RAISE(out_validity, AllocateBitmap(n, pool));
+    bit_util::SetBitsTo(out_validity->mutable_data(), 0, n, true);
+    out_validity_data = out_validity->mutable_data();
+  }
+
+  uint8_t* out = out_data->mutable_data();
+  for (int64_t i = 0; i < n; ++i) {
+    if (indices_have_nulls && !bit_util::GetBit(indices_validity, indices.offset + i)) {
+      bit_util::ClearBit(out_validity_data, i);
+      std::memset(out + i * byte_width, 0, byte_width);
+      continue;
+    }
+    bool index_negative = false;
+    if constexpr (std::is_signed_v<IndexCType>) {
+      index_negative = index_values[i] < 0;
+    }
+    const auto loc = locations[i];
+    const auto chunk_index = static_cast<size_t>(loc.chunk_index);
+    if (ARROW_PREDICT_FALSE(index_negative || chunk_index >= num_chunks)) {
+      return Status::IndexError("Take index out of bounds");
+    }
+    const auto index_in_chunk = static_cast<int64_t>(loc.index_in_chunk);
+    const uint8_t* validity = chunk_validity[chunk_index];
+    if (validity != nullptr &&
+        !bit_util::GetBit(validity, chunk_offsets[chunk_index] + index_in_chunk)) {
+      bit_util::ClearBit(out_validity_data, i);
+      std::memset(out + i * byte_width, 0, byte_width);
+      continue;
+    }
+    std::memcpy(out + i * byte_width,
+                chunk_data[chunk_index] + index_in_chunk * byte_width, byte_width);
+  }
+
+  return ArrayData::Make(values.type(), n, {std::move(out_validity), std::move(out_data)},
+                         kUnknownNullCount);
+}
+
+// Returns nullptr (without error) when the index type is not supported by the
+// direct path, in which case the caller falls back to concatenation.
+Result<std::shared_ptr<ArrayData>> TakeChunkedFixedWidth(const ChunkedArray& values,
+                                                         const Array& indices,
+                                                         MemoryPool* pool) {
+  const int64_t byte_width =
+      checked_cast<const FixedWidthType&>(*values.type()).bit_width() / 8;
+  const ArraySpan indices_span(*indices.data());
+  switch (indices.type_id()) {
+    case Type::UINT8:
+      return TakeChunkedFixedWidthImpl<uint8_t>(values, indices_span, byte_width, pool);
+    case Type::INT8:
+      return TakeChunkedFixedWidthImpl<int8_t>(values, indices_span, byte_width, pool);
+    case Type::UINT16:
+      return TakeChunkedFixedWidthImpl<uint16_t>(values, indices_span, byte_width, pool);
+    case Type::INT16:
+      return TakeChunkedFixedWidthImpl<int16_t>(values, indices_span, byte_width, pool);
+    case Type::UINT32:
+      return TakeChunkedFixedWidthImpl<uint32_t>(values, indices_span, byte_width, pool);
+    case Type::INT32:
+      return TakeChunkedFixedWidthImpl<int32_t>(values, indices_span, byte_width, pool);
+    case Type::UINT64:
+      return TakeChunkedFixedWidthImpl<uint64_t>(values, indices_span, byte_width, pool);
+    case Type::INT64:
+      return TakeChunkedFixedWidthImpl<int64_t>(values, indices_span, byte_width, pool);
+    default:
+      return nullptr;
+  }
+}
+
 // Metafunction for dispatching to different Take implementations other than
 // Array-Array.
 class TakeMetaFunction : public MetaFunction {
@@ -583,6 +706,15 @@ class TakeMetaFunction : public MetaFunction {
   static Result<std::shared_ptr<ArrayData>> TakeCAA(
       const std::shared_ptr<ChunkedArray>& values, const Array& indices,
       const TakeOptions& options, ExecContext* ctx) {
+    if (values->num_chunks() > 1 &&
+        CanTakeChunkedWithoutConcatenation(*values->type())) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto taken, TakeChunkedFixedWidth(*values, indices, ctx->memory_pool()));
+      if (taken != nullptr) {
+        return taken;
+      }
+      // Unsupported index type; fall back to concatenating the chunks
+    }
     ARROW_ASSIGN_OR_RAISE(auto values_array,
                           ChunkedArrayAsArray(values, ctx->memory_pool()));
     std::vector<Datum> args = {std::move(values_array), indices};
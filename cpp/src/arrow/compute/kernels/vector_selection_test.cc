@@ -1100,6 +1100,72 @@ TEST(TestFilterMetaFunction, ArityChecking) {
   ASSERT_RAISES(Invalid, CallFunction("filter", ExecBatch({}, 0)));
 }
 
+// ----------------------------------------------------------------------
+// FilterCompare tests
+
+TEST(TestFilterCompare, MatchesUnfusedFilter) {
+  auto values = ArrayFromJSON(utf8(), R"(["a", "b", "c", "d", "e", "f", "g", "h"])");
+  auto on = ArrayFromJSON(int32(), "[0, 1, 2, null, 4, 5, 6, 7]");
+  Datum against(std::make_shared<Int32Scalar>(3));
+  for (std::string comparison : {"greater", "less_equal", "not_equal"}) {
+    for (auto null_selection : {FilterOptions::DROP, FilterOptions::EMIT_NULL}) {
+      FilterCompareOptions options(comparison, null_selection);
+      ASSERT_OK_AND_ASSIGN(Datum fused, CallFunction("filter_compare",
+                                                     {values, on, against}, &options));
+      ASSERT_OK_AND_ASSIGN(Datum selection, CallFunction(comparison, {on, against}));
+      ASSERT_OK_AND_ASSIGN(Datum expected,
+                           Filter(values, selection, FilterOptions(null_selection)));
+      AssertDatumsEqual(expected, fused, /*verbose=*/true);
+    }
+  }
+}
+
+TEST(TestFilterCompare, MultipleBlocks) {
+  // Spans several evaluation blocks to exercise the block loop and the
+  // concatenation of the per-block results.
+  auto rand = random::RandomArrayGenerator(kRandomSeed);
+  const int64_t length = 200 * 1024;
+  auto values = rand.Int64(length, /*min=*/-100, /*max=*/100, /*null_probability=*/0.1);
+  auto on = rand.Int32(length, /*min=*/0, /*max=*/10, /*null_probability=*/0.05);
+  Datum against(std::make_shared<Int32Scalar>(5));
+  FilterCompareOptions options("less", FilterOptions::DROP);
+  ASSERT_OK_AND_ASSIGN(Datum fused,
+                       CallFunction("filter_compare", {values, on, against}, &options));
+  ASSERT_OK_AND_ASSIGN(Datum selection, CallFunction("less", {on, against}));
+  ASSERT_OK_AND_ASSIGN(Datum expected, Filter(values, selection));
+  AssertDatumsEqual(expected, fused, /*verbose=*/true);
+}
+
+TEST(TestFilterCompare, RecordBatch) {
+  auto schm = schema({field("a", int32()), field("b", utf8())});
+  auto batch = RecordBatchFromJSON(schm, R"([
+    {"a": null, "b": "yo"},
+    {"a": 1, "b": ""},
+    {"a": 2, "b": "hello"},
+    {"a": 4, "b": "world"}
+  ])");
+  Datum against(std::make_shared<Int32Scalar>(2));
+  FilterCompareOptions options("greater_equal", FilterOptions::DROP);
+  ASSERT_OK_AND_ASSIGN(
+      Datum fused,
+      CallFunction("filter_compare", {batch, batch->column(0), against}, &options));
+  auto expected = RecordBatchFromJSON(schm, R"([
+    {"a": 2, "b": "hello"},
+    {"a": 4, "b": "world"}
+  ])");
+  ASSERT_BATCHES_EQUAL(*expected, *fused.record_batch());
+}
+
+TEST(TestFilterCompare, Invalid) {
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3]");
+  auto on = ArrayFromJSON(int32(), "[1, 2]");
+  Datum against(std::make_shared<Int32Scalar>(1));
+  ASSERT_RAISES(Invalid, CallFunction("filter_compare", {values, on, against}));
+  FilterCompareOptions not_a_comparison("add");
+  ASSERT_RAISES(Invalid, CallFunction("filter_compare", {values, values, against},
+                                      &not_a_comparison));
+}
+
 // ----------------------------------------------------------------------
 // Take tests
 //
@@ -15,12 +15,15 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cstring>
+#include <type_traits>
 #include <unordered_set>
 
 #include "arrow/compute/function.h"
 #include "arrow/compute/kernels/vector_sort_internal.h"
 #include "arrow/compute/registry.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 
@@ -88,23 +91,33 @@ class ChunkedArraySorter : public TypeVisitor {
     const auto arrays = GetArrayPointers(physical_chunks_);
 
     // Sort each chunk independently and merge to sorted indices.
-    // This is a serial implementation.
     std::vector<NullPartitionResult> sorted(num_chunks);
 
-    // First sort all individual chunks
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
+    std::vector<int64_t> chunk_offsets(num_chunks + 1);
+    chunk_offsets[0] = 0;
     int64_t null_count = 0;
     for (int i = 0; i < num_chunks; ++i) {
       const auto array = checked_cast<const ArrayType*>(arrays[i]);
-      end_offset += array->length();
+      chunk_offsets[i + 1] = chunk_offsets[i] + array->length();
       null_count += array->null_count();
-      ARROW_ASSIGN_OR_RAISE(sorted[i], array_sorter_(indices_begin_ + begin_offset,
-                                                     indices_begin_ + end_offset, *array,
-                                                     begin_offset, options, ctx_));
-      begin_offset = end_offset;
     }
-    DCHECK_EQ(end_offset, num_indices);
+    DCHECK_EQ(chunk_offsets[num_chunks], num_indices);
+
+    // First sort all individual chunks, in parallel if requested. Each task
+    // only touches its own slice of the indices.
+    auto* executor = ctx_->executor() != nullptr ? ctx_->executor()
+                                                 : ::arrow::internal::GetCpuThreadPool();
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        ctx_->use_threads() && num_chunks > 1, num_chunks,
+        [&](int i) -> Status {
+          const auto array = checked_cast<const ArrayType*>(arrays[i]);
+          ARROW_ASSIGN_OR_RAISE(
+              sorted[i], array_sorter_(indices_begin_ + chunk_offsets[i],
+                                       indices_begin_ + chunk_offsets[i + 1], *array,
+                                       chunk_offsets[i], options, ctx_));
+          return Status::OK();
+        },
+        executor));
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -479,6 +492,181 @@ class RadixRecordBatchSorter {
   Status status_;
 };
 
+// Sort a batch by packing the sort keys of each row into a contiguous
+// byte-comparable key (null placement and sort order included in the
+// encoding) and running a stable LSD radix sort on the packed keys. This
+// avoids the per-comparison branching of the comparator-based sorters, but
+// only applies when all sort keys have a fixed-width integer representation.
+class PackedKeyRecordBatchSorter {
+ public:
+  using ResolvedSortKey = ResolvedRecordBatchSortKey;
+
+  PackedKeyRecordBatchSorter(ExecContext* ctx, uint64_t* indices_begin,
+                             uint64_t* indices_end,
+                             std::vector<ResolvedSortKey> sort_keys,
+                             const SortOptions& options)
+      : ctx_(ctx),
+        indices_begin_(indices_begin),
+        indices_end_(indices_end),
+        sort_keys_(std::move(sort_keys)),
+        null_placement_(options.null_placement) {}
+
+  // The packed path applies when all sort keys have an integer physical
+  // representation; after physical type resolution this also covers dates,
+  // times, timestamps and durations.
+  static bool CanSort(const std::vector<ResolvedSortKey>& sort_keys) {
+    return std::all_of(
+        sort_keys.begin(), sort_keys.end(),
+        [](const ResolvedSortKey& key) { return is_integer(key.type->id()); });
+  }
+
+  Status Sort() {
+    const int64_t num_rows = indices_end_ - indices_begin_;
+    if (num_rows <= 1) {
+      return Status::OK();
+    }
+    // Each key is encoded as a leading validity byte if the column has nulls,
+    // then the value in big-endian order with the sign bit flipped, so that
+    // an unsigned byte-wise comparison of two packed rows decides the sort
+    // order.
+    int32_t row_width = 0;
+    std::vector<int32_t> key_offsets(sort_keys_.size());
+    for (size_t i = 0; i < sort_keys_.size(); ++i) {
+      key_offsets[i] = row_width;
+      row_width +=
+          (sort_keys_[i].null_count > 0 ? 1 : 0) +
+          checked_cast<const FixedWidthType&>(*sort_keys_[i].type).bit_width() / 8;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto key_buffer,
+                          AllocateBuffer(num_rows * row_width, ctx_->memory_pool()));
+    uint8_t* packed_keys = key_buffer->mutable_data();
+    for (size_t i = 0; i < sort_keys_.size(); ++i) {
+      PackColumnVisitor visitor{this, sort_keys_[i], packed_keys + key_offsets[i],
+                                row_width};
+      RETURN_NOT_OK(VisitTypeInline(*sort_keys_[i].type, &visitor));
+    }
+    return RadixSortIndices(packed_keys, row_width, num_rows);
+  }
+
+ private:
+  struct PackColumnVisitor {
+#define VISIT(TYPE) \
+  Status Visit(const TYPE& type) { return VisitGeneric(type); }
+
+    VISIT(Int8Type)
+    VISIT(Int16Type)
+    VISIT(Int32Type)
+    VISIT(Int64Type)
+    VISIT(UInt8Type)
+    VISIT(UInt16Type)
+    VISIT(UInt32Type)
+    VISIT(UInt64Type)
+
+#undef VISIT
+
+    Status Visit(const DataType& type) {
+      return Status::TypeError("Unsupported type for packed key sorting: ",
+                               type.ToString());
+    }
+
+    template <typename Type>
+    Status VisitGeneric(const Type&) {
+      sorter->PackColumn<Type>(key, out, row_width);
+      return Status::OK();
+    }
+
+    PackedKeyRecordBatchSorter* sorter;
+    const ResolvedSortKey& key;
+    uint8_t* out;
+    int32_t row_width;
+  };
+
+  template <typename Type>
+  void PackColumn(const ResolvedSortKey& key, uint8_t* out, int32_t row_width) {
+    using ArrayType = typename TypeTraits<Type>::ArrayType;
+    using CType = typename Type::c_type;
+    using UnsignedCType = typename std::make_unsigned<CType>::type;
+    constexpr int width = static_cast<int>(sizeof(CType));
+
+    const ArrayType& array = checked_cast<const ArrayType&>(key.array);
+    const int64_t num_rows = indices_end_ - indices_begin_;
+    const bool nullable = key.null_count > 0;
+    const bool descending = key.order == SortOrder::Descending;
+    // The validity byte orders nulls before (AtStart) or after (AtEnd) any
+    // valid value, regardless of the key's sort order.
+    const uint8_t null_byte = null_placement_ == NullPlacement::AtStart ? 0x00 : 0x01;
+    const uint8_t valid_byte = null_placement_ == NullPlacement::AtStart ? 0x01 : 0x00;
+
+    for (int64_t row = 0; row < num_rows; ++row, out += row_width) {
+      uint8_t* p = out;
+      if (nullable) {
+        if (array.IsNull(row)) {
+          // Zero the value bytes so that ties between nulls are broken by
+          // the following sort keys
+          *p = null_byte;
+          std::memset(p + 1, 0, width);
+          continue;
+        }
+        *p++ = valid_byte;
+      }
+      auto bits = static_cast<uint64_t>(static_cast<UnsignedCType>(array.GetView(row)));
+      if constexpr (is_signed_integer_type<Type>::value) {
+        bits ^= uint64_t{1} << (8 * width - 1);
+      }
+      if (descending) {
+        bits = ~bits;
+      }
+      for (int i = 0; i < width; ++i) {
+        p[i] = static_cast<uint8_t>(bits >> (8 * (width - 1 - i)));
+      }
+    }
+  }
+
+  // Stable LSD radix sort: counting-sort the indices on each byte of the
+  // packed keys, least significant byte first.
+  Status RadixSortIndices(const uint8_t* packed_keys, int32_t row_width,
+                          int64_t num_rows) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto temp_buffer,
+        AllocateBuffer(num_rows * sizeof(uint64_t), ctx_->memory_pool()));
+    uint64_t* temp = reinterpret_cast<uint64_t*>(temp_buffer->mutable_data());
+    uint64_t* in = indices_begin_;
+    uint64_t* out = temp;
+    for (int32_t pos = row_width - 1; pos >= 0; --pos) {
+      const uint8_t* column = packed_keys + pos;
+      int64_t counts[256] = {0};
+      for (int64_t i = 0; i < num_rows; ++i) {
+        ++counts[column[in[i] * row_width]];
+      }
+      // A byte position on which all rows agree (e.g. the high bytes of
+      // small values) does not change the order
+      if (*std::max_element(std::begin(counts), std::end(counts)) == num_rows) {
+        continue;
+      }
+      int64_t total = 0;
+      for (int bucket = 0; bucket < 256; ++bucket) {
+        const int64_t count = counts[bucket];
+        counts[bucket] = total;
+        total += count;
+      }
+      for (int64_t i = 0; i < num_rows; ++i) {
+        out[counts[column[in[i] * row_width]]++] = in[i];
+      }
+      std::swap(in, out);
+    }
+    if (in != indices_begin_) {
+      std::copy(in, in + num_rows, indices_begin_);
+    }
+    return Status::OK();
+  }
+
+  ExecContext* ctx_;
+  uint64_t* indices_begin_;
+  uint64_t* indices_end_;
+  std::vector<ResolvedSortKey> sort_keys_;
+  NullPlacement null_placement_;
+};
+
 // Sort a batch using a single sort and multiple-key comparisons.
 class MultipleKeyRecordBatchSorter : public TypeVisitor {
  public:
@@ -677,24 +865,38 @@ class TableSorter {
     }
     std::vector<NullPartitionResult> sorted(num_batches);
 
-    // First sort all individual batches
-    int64_t begin_offset = 0;
-    int64_t end_offset = 0;
+    std::vector<int64_t> batch_offsets(num_batches + 1);
+    batch_offsets[0] = 0;
+    for (int64_t i = 0; i < num_batches; ++i) {
+      batch_offsets[i + 1] = batch_offsets[i] + batches_[i]->num_rows();
+    }
+    DCHECK_EQ(batch_offsets[num_batches], indices_end_ - indices_begin_);
+
+    // First sort all individual batches, in parallel if requested. Each task
+    // only touches its own slice of the indices.
+    auto* executor = ctx_->executor() != nullptr ? ctx_->executor()
+                                                 : ::arrow::internal::GetCpuThreadPool();
+    RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+        ctx_->use_threads() && num_batches > 1, static_cast<int>(num_batches),
+        [&](int i) -> Status {
+          const auto& batch = *batches_[i];
+          RadixRecordBatchSorter sorter(indices_begin_ + batch_offsets[i],
+                                        indices_begin_ + batch_offsets[i + 1], batch,
+                                        options_);
+          ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(batch_offsets[i]));
+          DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + batch_offsets[i]);
+          DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + batch_offsets[i + 1]);
+          DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(),
+                    batch.num_rows());
+          return Status::OK();
+        },
+        executor));
+
+    // XXX this is an upper bound on the true null count
     int64_t null_count = 0;
     for (int64_t i = 0; i < num_batches; ++i) {
-      const auto& batch = *batches_[i];
-      end_offset += batch.num_rows();
-      RadixRecordBatchSorter sorter(indices_begin_ + begin_offset,
-                                    indices_begin_ + end_offset, batch, options_);
-      ARROW_ASSIGN_OR_RAISE(sorted[i], sorter.Sort(begin_offset));
-      DCHECK_EQ(sorted[i].overall_begin(), indices_begin_ + begin_offset);
-      DCHECK_EQ(sorted[i].overall_end(), indices_begin_ + end_offset);
-      DCHECK_EQ(sorted[i].non_null_count() + sorted[i].null_count(), batch.num_rows());
-      begin_offset = end_offset;
-      // XXX this is an upper bound on the true null count
       null_count += sorted[i].null_count();
     }
-    DCHECK_EQ(end_offset, indices_end_ - indices_begin_);
 
     // Then merge them by pairs, recursively
     if (sorted.size() > 1) {
@@ -1025,7 +1227,11 @@ class SortIndicesMetaFunction : public MetaFunction {
     auto out_end = out_begin + length;
     std::iota(out_begin, out_end, 0);
 
-    if (n_sort_keys <= kMaxRadixSortKeys) {
+    if (PackedKeyRecordBatchSorter::CanSort(sort_keys)) {
+      PackedKeyRecordBatchSorter sorter(ctx, out_begin, out_end, std::move(sort_keys),
+                                        options);
+      ARROW_RETURN_NOT_OK(sorter.Sort());
+    } else if (n_sort_keys <= kMaxRadixSortKeys) {
       RadixRecordBatchSorter sorter(out_begin, out_end, std::move(sort_keys), options);
       ARROW_RETURN_NOT_OK(sorter.Sort());
     } else {
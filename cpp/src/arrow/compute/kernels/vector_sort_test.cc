@@ -1237,6 +1237,30 @@ TEST_F(TestRecordBatchSortIndices, Null) {
   AssertSortIndices(batch, options, "[3, 0, 5, 1, 4, 2, 6]");
 }
 
+TEST_F(TestRecordBatchSortIndices, SignedIntegers) {
+  // Exercises the packed-key radix sorter with negative values and nulls
+  auto schema = ::arrow::schema({
+      {field("a", int32())},
+      {field("b", int64())},
+  });
+  auto batch = RecordBatchFromJSON(schema,
+                                   R"([{"a": -5,   "b": 100},
+                                       {"a": 3,    "b": -1},
+                                       {"a": -5,   "b": null},
+                                       {"a": null, "b": -50},
+                                       {"a": 0,    "b": 7},
+                                       {"a": 3,    "b": 200},
+                                       {"a": -5,   "b": 100}
+                                       ])");
+  const std::vector<SortKey> sort_keys{SortKey("a", SortOrder::Ascending),
+                                       SortKey("b", SortOrder::Descending)};
+
+  SortOptions options(sort_keys, NullPlacement::AtEnd);
+  AssertSortIndices(batch, options, "[0, 6, 2, 4, 5, 1, 3]");
+  options.null_placement = NullPlacement::AtStart;
+  AssertSortIndices(batch, options, "[3, 2, 0, 6, 4, 5, 1]");
+}
+
 TEST_F(TestRecordBatchSortIndices, NaN) {
   auto schema = ::arrow::schema({
       {field("a", float32())},
@@ -289,6 +289,26 @@ int64_t SwissTable::num_groups_for_resize() const {
   }
 }
 
+int SwissTable::log_blocks_for_num_groups(int64_t num_groups) {
+  // Mirrors the thresholds in num_groups_for_resize(): hash tables with at
+  // most 2 ^ 9 blocks resize at 50% occupancy, larger ones at 75%.
+  constexpr int log_blocks_small_ = 9;
+  // Stop before block ids (hash >> (bits_hash_ - log_blocks)) run out of
+  // hash bits to select a block
+  constexpr int log_blocks_max_ = bits_hash_ - kLogSlotsPerBlock;
+  int log_blocks = 0;
+  while (log_blocks < log_blocks_max_) {
+    int64_t num_slots = num_slots_from_log_blocks(log_blocks);
+    int64_t num_groups_limit =
+        (log_blocks <= log_blocks_small_) ? num_slots / 2 : num_slots * 3 / 4;
+    if (num_groups_limit >= num_groups) {
+      break;
+    }
+    ++log_blocks;
+  }
+  return log_blocks;
+}
+
 uint32_t SwissTable::wrap_global_slot_id(uint32_t global_slot_id) const {
   uint32_t global_slot_id_mask =
       static_cast<uint32_t>((1ULL << (log_blocks_ + kLogSlotsPerBlock)) - 1ULL);
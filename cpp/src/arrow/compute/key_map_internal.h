@@ -54,6 +54,15 @@ class ARROW_EXPORT SwissTable {
   Status init(int64_t hardware_flags, MemoryPool* pool, int log_blocks = 0,
               bool no_hash_array = false);
 
+  /// \brief Smallest log_blocks that can hold the given number of groups
+  /// without triggering a resize.
+  ///
+  /// Useful for pre-sizing a table from a cardinality estimate (e.g. an NDV
+  /// sketch maintained by the caller), so that large builds skip the chain of
+  /// stop-the-world grow_double() rehashes.  Returns 0 (the default initial
+  /// size) when num_groups is not positive.
+  static int log_blocks_for_num_groups(int64_t num_groups);
+
   void cleanup();
 
   void early_filter(const int num_keys, const uint32_t* hashes,
@@ -18,6 +18,7 @@
 #include "arrow/compute/registry.h"
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -39,7 +40,34 @@ class FunctionRegistry::FunctionRegistryImpl {
       : parent_(parent) {}
   ~FunctionRegistryImpl() {}
 
+  void SetPendingRegistrations(FunctionRegistry* owner,
+                               std::function<void(FunctionRegistry*)> pending) {
+    pending_owner_ = owner;
+    pending_registrations_ = std::move(pending);
+    pending_done_.store(false, std::memory_order_release);
+  }
+
+  // Run deferred registrations, at most once.  Registries without pending
+  // registrations (every registry except the built-in one) pay a single
+  // predictable atomic load here.  Re-entrant calls made while the pending
+  // registrations run (e.g. the alias resolution inside AddAlias) return
+  // immediately.
+  void MaterializePendingRegistrations() const {
+    if (ARROW_PREDICT_TRUE(pending_done_.load(std::memory_order_acquire))) {
+      return;
+    }
+    std::lock_guard<std::recursive_mutex> guard(pending_lock_);
+    if (pending_done_.load(std::memory_order_relaxed) || pending_running_) {
+      return;
+    }
+    pending_running_ = true;
+    pending_registrations_(pending_owner_);
+    pending_running_ = false;
+    pending_done_.store(true, std::memory_order_release);
+  }
+
   Status CanAddFunction(std::shared_ptr<Function> function, bool allow_overwrite) {
+    MaterializePendingRegistrations();
     if (parent_ != NULLPTR) {
       RETURN_NOT_OK(parent_->CanAddFunction(function, allow_overwrite));
     }
@@ -47,6 +75,7 @@ class FunctionRegistry::FunctionRegistryImpl {
   }
 
   Status AddFunction(std::shared_ptr<Function> function, bool allow_overwrite) {
+    MaterializePendingRegistrations();
     if (parent_ != NULLPTR) {
       RETURN_NOT_OK(parent_->CanAddFunction(function, allow_overwrite));
     }
@@ -54,6 +83,7 @@ class FunctionRegistry::FunctionRegistryImpl {
   }
 
   Status CanAddAlias(const std::string& target_name, const std::string& source_name) {
+    MaterializePendingRegistrations();
     if (parent_ != NULLPTR) {
       RETURN_NOT_OK(parent_->CanAddFunctionName(target_name,
                                                 /*allow_overwrite=*/false));
@@ -62,6 +92,7 @@ class FunctionRegistry::FunctionRegistryImpl {
   }
 
   Status AddAlias(const std::string& target_name, const std::string& source_name) {
+    MaterializePendingRegistrations();
     if (parent_ != NULLPTR) {
       RETURN_NOT_OK(parent_->CanAddFunctionName(target_name,
                                                 /*allow_overwrite=*/false));
@@ -86,6 +117,7 @@ class FunctionRegistry::FunctionRegistryImpl {
   }
 
   Result<std::shared_ptr<Function>> GetFunction(const std::string& name) const {
+    MaterializePendingRegistrations();
     auto it = name_to_function_.find(name);
     if (it == name_to_function_.end()) {
       if (parent_ != NULLPTR) {
@@ -97,6 +129,7 @@ class FunctionRegistry::FunctionRegistryImpl {
   }
 
   std::vector<std::string> GetFunctionNames() const {
+    MaterializePendingRegistrations();
     std::vector<std::string> results;
     if (parent_ != NULLPTR) {
       results = parent_->GetFunctionNames();
@@ -110,6 +143,7 @@ class FunctionRegistry::FunctionRegistryImpl {
 
   Result<const FunctionOptionsType*> GetFunctionOptionsType(
       const std::string& name) const {
+    MaterializePendingRegistrations();
     auto it = name_to_options_type_.find(name);
     if (it == name_to_options_type_.end()) {
       if (parent_ != NULLPTR) {
@@ -121,6 +155,7 @@ class FunctionRegistry::FunctionRegistryImpl {
   }
 
   int num_functions() const {
+    MaterializePendingRegistrations();
     return (parent_ == NULLPTR ? 0 : parent_->num_functions()) +
            static_cast<int>(name_to_function_.size());
   }
@@ -212,6 +247,14 @@ class FunctionRegistry::FunctionRegistryImpl {
   std::unordered_map<std::string, const FunctionOptionsType*> name_to_options_type_;
 
   const Function* cast_function_;
+
+  // Deferred registrations (see SetPendingRegistrations).  pending_done_
+  // starts true so registries without deferred work skip the slow path.
+  FunctionRegistry* pending_owner_ = NULLPTR;
+  std::function<void(FunctionRegistry*)> pending_registrations_;
+  mutable std::atomic<bool> pending_done_{true};
+  mutable std::recursive_mutex pending_lock_;
+  mutable bool pending_running_ = false;
 };
 
 std::unique_ptr<FunctionRegistry> FunctionRegistry::Make() {
@@ -277,8 +320,15 @@ int FunctionRegistry::num_functions() const { return impl_->num_functions(); }
 
 const Function* FunctionRegistry::cast_function() const { return impl_->cast_function(); }
 
+void FunctionRegistry::SetPendingRegistrations(
+    std::function<void(FunctionRegistry*)> pending) {
+  impl_->SetPendingRegistrations(this, std::move(pending));
+}
+
 namespace internal {
 
+// The always-registered core: cast, hashing and selection kernels plus the
+// options types, which nearly every consumer needs
 static std::unique_ptr<FunctionRegistry> CreateBuiltInRegistry() {
   auto registry = FunctionRegistry::Make();
 
@@ -292,57 +342,67 @@ static std::unique_ptr<FunctionRegistry> CreateBuiltInRegistry() {
   RegisterVectorOptions(registry.get());
   RegisterAggregateOptions(registry.get());
 
+  return registry;
+}
+
+// The long tail of kernel registrations, deferred until the registry is
+// first consulted so that short-lived processes which never execute these
+// functions skip the registration cost entirely
+static void RegisterDeferredBuiltIns(FunctionRegistry* registry) {
+  ARROW_UNUSED(registry);
 #ifdef ARROW_COMPUTE
   // Register additional kernels
 
   // Scalar functions
-  RegisterScalarArithmetic(registry.get());
-  RegisterScalarBoolean(registry.get());
-  RegisterScalarComparison(registry.get());
-  RegisterScalarIfElse(registry.get());
-  RegisterScalarNested(registry.get());
-  RegisterScalarRandom(registry.get());  // Nullary
-  RegisterScalarRoundArithmetic(registry.get());
-  RegisterScalarSetLookup(registry.get());
-  RegisterScalarStringAscii(registry.get());
-  RegisterScalarStringUtf8(registry.get());
-  RegisterScalarTemporalBinary(registry.get());
-  RegisterScalarTemporalUnary(registry.get());
-  RegisterScalarValidity(registry.get());
+  RegisterScalarArithmetic(registry);
+  RegisterScalarBoolean(registry);
+  RegisterScalarComparison(registry);
+  RegisterScalarIfElse(registry);
+  RegisterScalarNested(registry);
+  RegisterScalarRandom(registry);  // Nullary
+  RegisterScalarRoundArithmetic(registry);
+  RegisterScalarSetLookup(registry);
+  RegisterScalarStringAscii(registry);
+  RegisterScalarStringUtf8(registry);
+  RegisterScalarTemporalBinary(registry);
+  RegisterScalarTemporalUnary(registry);
+  RegisterScalarValidity(registry);
 
   // Vector functions
-  RegisterVectorArraySort(registry.get());
-  RegisterVectorCumulativeSum(registry.get());
-  RegisterVectorNested(registry.get());
-  RegisterVectorRank(registry.get());
-  RegisterVectorReplace(registry.get());
-  RegisterVectorSelectK(registry.get());
-  RegisterVectorSort(registry.get());
-  RegisterVectorRunEndEncode(registry.get());
-  RegisterVectorRunEndDecode(registry.get());
-  RegisterVectorPairwise(registry.get());
-  RegisterVectorStatistics(registry.get());
-  RegisterVectorSwizzle(registry.get());
+  RegisterVectorArraySort(registry);
+  RegisterVectorCumulativeSum(registry);
+  RegisterVectorNested(registry);
+  RegisterVectorRank(registry);
+  RegisterVectorReplace(registry);
+  RegisterVectorSelectK(registry);
+  RegisterVectorSort(registry);
+  RegisterVectorRunEndEncode(registry);
+  RegisterVectorRunEndDecode(registry);
+  RegisterVectorPairwise(registry);
+  RegisterVectorStatistics(registry);
+  RegisterVectorSwizzle(registry);
 
   // Aggregate functions
-  RegisterHashAggregateBasic(registry.get());
-  RegisterHashAggregateNumeric(registry.get());
-  RegisterHashAggregatePivot(registry.get());
-  RegisterScalarAggregateBasic(registry.get());
-  RegisterScalarAggregateMode(registry.get());
-  RegisterScalarAggregatePivot(registry.get());
-  RegisterScalarAggregateQuantile(registry.get());
-  RegisterScalarAggregateTDigest(registry.get());
-  RegisterScalarAggregateVariance(registry.get());
+  RegisterHashAggregateBasic(registry);
+  RegisterHashAggregateNumeric(registry);
+  RegisterHashAggregatePivot(registry);
+  RegisterScalarAggregateBasic(registry);
+  RegisterScalarAggregateMode(registry);
+  RegisterScalarAggregatePivot(registry);
+  RegisterScalarAggregateQuantile(registry);
+  RegisterScalarAggregateTDigest(registry);
+  RegisterScalarAggregateVariance(registry);
 #endif
-
-  return registry;
 }
 
 }  // namespace internal
 
 FunctionRegistry* GetFunctionRegistry() {
-  static auto g_registry = internal::CreateBuiltInRegistry();
+  static auto g_registry = [] {
+    auto registry = internal::CreateBuiltInRegistry();
+    registry->SetPendingRegistrations(&internal::RegisterDeferredBuiltIns);
+    return registry;
+  }();
   return g_registry.get();
 }
 
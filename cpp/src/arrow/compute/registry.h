@@ -20,10 +20,12 @@
 
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "arrow/compute/type_fwd.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/visibility.h"
@@ -115,6 +117,14 @@ class ARROW_EXPORT FunctionRegistry {
  private:
   FunctionRegistry();
 
+  /// Install registrations that are deferred until the registry is first
+  /// looked up or enumerated.  Used by the built-in registry so that
+  /// creating it costs almost nothing at process startup; see
+  /// GetFunctionRegistry().
+  void SetPendingRegistrations(std::function<void(FunctionRegistry*)> pending);
+
+  friend FunctionRegistry* GetFunctionRegistry();
+
   // Use PIMPL pattern to not have std::unordered_map here
   class FunctionRegistryImpl;
   std::unique_ptr<FunctionRegistryImpl> impl_;
@@ -47,6 +47,17 @@ TEST(TestRegistry, CreateBuiltInRegistry) {
   ARROW_UNUSED(registry);
 }
 
+#ifdef ARROW_COMPUTE
+TEST(TestRegistry, DeferredBuiltIns) {
+  // Most built-in registrations are deferred until the global registry is
+  // first used; lookups and enumeration must observe them transparently.
+  FunctionRegistry* registry = GetFunctionRegistry();
+  ASSERT_OK_AND_ASSIGN(auto add, registry->GetFunction("add"));
+  ASSERT_EQ("add", add->name());
+  ASSERT_GT(registry->num_functions(), 0);
+}
+#endif
+
 TEST_P(TestRegistry, Basics) {
   auto registry_factory = std::get<0>(GetParam());
   auto registry_ = registry_factory();
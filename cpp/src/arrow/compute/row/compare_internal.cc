@@ -258,7 +258,13 @@ void KeyCompare::CompareVarBinaryColumnToRowHelper(
           rows_right + begin_right, &offset_within_row, &length_right);
     }
     begin_right += offset_within_row;
-    uint32_t length = std::min(length_left, length_right);
+    // Equal keys have equal lengths: mismatching lengths reject the pair
+    // without touching the string data at all
+    if (length_left != length_right) {
+      match_bytevector[i] = 0;
+      continue;
+    }
+    uint32_t length = length_left;
     const uint64_t* key_left_ptr =
         reinterpret_cast<const uint64_t*>(rows_left + begin_left);
     util::CheckAlignment<uint64_t>(rows_right + begin_right);
@@ -272,21 +278,26 @@ void KeyCompare::CompareVarBinaryColumnToRowHelper(
         uint64_t key_left = util::SafeLoad(key_left_ptr + j);
         uint64_t key_right = key_right_ptr[j];
         result_or |= key_left ^ key_right;
+        if (result_or != 0) {
+          // The first mismatching word settles the comparison; for long keys
+          // this prefix rejection skips reading the rest of the string
+          break;
+        }
+      }
+      if (result_or == 0) {
+        int32_t tail_length = length - j * 8;
+        uint64_t tail_mask = ~0ULL >> (64 - 8 * tail_length);
+        uint64_t key_left = 0;
+        // NOTE: UBSAN may falsely report "misaligned load" in `std::memcpy` on some
+        // platforms when using 64-bit pointers. Cast to an 8-bit pointer to work around
+        // this.
+        const uint8_t* src_bytes = reinterpret_cast<const uint8_t*>(key_left_ptr + j);
+        std::memcpy(&key_left, src_bytes, tail_length);
+        uint64_t key_right = key_right_ptr[j];
+        result_or |= tail_mask & (key_left ^ key_right);
       }
-      int32_t tail_length = length - j * 8;
-      uint64_t tail_mask = ~0ULL >> (64 - 8 * tail_length);
-      uint64_t key_left = 0;
-      // NOTE: UBSAN may falsely report "misaligned load" in `std::memcpy` on some
-      // platforms when using 64-bit pointers. Cast to an 8-bit pointer to work around
-      // this.
-      const uint8_t* src_bytes = reinterpret_cast<const uint8_t*>(key_left_ptr + j);
-      std::memcpy(&key_left, src_bytes, tail_length);
-      uint64_t key_right = key_right_ptr[j];
-      result_or |= tail_mask & (key_left ^ key_right);
     }
-    int result = result_or == 0 ? 0xff : 0;
-    result *= (length_left == length_right ? 1 : 0);
-    match_bytevector[i] = result;
+    match_bytevector[i] = result_or == 0 ? 0xff : 0;
   }
 }
 
@@ -23,8 +23,9 @@ namespace arrow {
 namespace compute {
 
 void RowTableEncoder::Init(const std::vector<KeyColumnMetadata>& cols, int row_alignment,
-                           int string_alignment) {
-  row_metadata_.FromColumnMetadataVector(cols, row_alignment, string_alignment);
+                           int string_alignment, uint32_t extra_state_bytes) {
+  row_metadata_.FromColumnMetadataVector(cols, row_alignment, string_alignment,
+                                         extra_state_bytes);
   uint32_t num_cols = row_metadata_.num_cols();
   uint32_t num_varbinary_cols = row_metadata_.num_varbinary_cols();
   batch_all_cols_.resize(num_cols);
@@ -47,7 +47,7 @@ namespace compute {
 class ARROW_EXPORT RowTableEncoder {
  public:
   void Init(const std::vector<KeyColumnMetadata>& cols, int row_alignment,
-            int string_alignment);
+            int string_alignment, uint32_t extra_state_bytes = 0);
 
   const RowTableMetadata& row_metadata() { return row_metadata_; }
   // GrouperFastImpl right now needs somewhat intrusive visibility into RowTableEncoder
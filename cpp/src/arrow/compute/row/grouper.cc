@@ -23,6 +23,7 @@
 #include <mutex>
 #include <type_traits>
 
+#include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_primitive.h"
 
 #include "arrow/compute/api_vector.h"
@@ -38,6 +39,7 @@
 #include "arrow/util/bitmap_ops.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/cpu_info.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/task_group.h"
 
@@ -333,12 +335,21 @@ Status CheckAndCapLengthForConsume(int64_t batch_length, int64_t consume_offset,
 enum class GrouperMode { kPopulate, kConsume, kLookup };
 
 struct GrouperImpl : public Grouper {
+  // Memo table mapping encoded keys to dense group ids.  This avoids both the
+  // per-row std::string allocation and the duplicate key storage that a
+  // std::unordered_map<std::string, uint32_t> based mapping would entail.
+  using KeyMemoTable = ::arrow::internal::BinaryMemoTable<BinaryBuilder>;
+
   static Result<std::unique_ptr<GrouperImpl>> Make(
-      const std::vector<TypeHolder>& key_types, ExecContext* ctx) {
+      const std::vector<TypeHolder>& key_types, ExecContext* ctx,
+      int64_t num_groups_hint = 0) {
     auto impl = std::make_unique<GrouperImpl>();
 
     impl->encoders_.resize(key_types.size());
     impl->ctx_ = ctx;
+    impl->num_groups_hint_ = num_groups_hint;
+    impl->map_ =
+        std::make_unique<KeyMemoTable>(ctx->memory_pool(), /*entries=*/num_groups_hint);
 
     for (size_t i = 0; i < key_types.size(); ++i) {
       // TODO(wesm): eliminate this probably unneeded shared_ptr copy
@@ -384,10 +395,8 @@ struct GrouperImpl : public Grouper {
   }
 
   Status Reset() override {
-    map_.clear();
-    offsets_.clear();
-    key_bytes_.clear();
-    num_groups_ = 0;
+    map_ =
+        std::make_unique<KeyMemoTable>(ctx_->memory_pool(), /*entries=*/num_groups_hint_);
     return Status::OK();
   }
 
@@ -404,39 +413,27 @@ struct GrouperImpl : public Grouper {
   }
 
   template <typename VisitGroupFunc, typename VisitUnknownGroupFunc>
-  void VisitKeys(int64_t length, const int32_t* key_offsets, const uint8_t* key_data,
-                 bool insert_new_keys, VisitGroupFunc&& visit_group,
-                 VisitUnknownGroupFunc&& visit_unknown_group) {
+  Status VisitKeys(int64_t length, const int32_t* key_offsets, const uint8_t* key_data,
+                   bool insert_new_keys, VisitGroupFunc&& visit_group,
+                   VisitUnknownGroupFunc&& visit_unknown_group) {
     for (int64_t i = 0; i < length; ++i) {
       const int32_t key_length = key_offsets[i + 1] - key_offsets[i];
       const uint8_t* key_ptr = key_data + key_offsets[i];
-      std::string key(reinterpret_cast<const char*>(key_ptr), key_length);
 
-      uint32_t group_id;
       if (insert_new_keys) {
-        const auto [it, inserted] = map_.emplace(std::move(key), num_groups_);
-        if (inserted) {
-          // New key: update offsets and key_bytes
-          ++num_groups_;
-          if (key_length > 0) {
-            const auto next_key_offset = static_cast<int32_t>(key_bytes_.size());
-            key_bytes_.resize(next_key_offset + key_length);
-            offsets_.push_back(next_key_offset + key_length);
-            memcpy(key_bytes_.data() + next_key_offset, key_ptr, key_length);
-          }
-        }
-        group_id = it->second;
+        int32_t group_id;
+        RETURN_NOT_OK(map_->GetOrInsert(key_ptr, key_length, &group_id));
+        visit_group(static_cast<uint32_t>(group_id));
       } else {
-        const auto it = map_.find(std::move(key));
-        if (it == map_.end()) {
-          // Key not found
+        const int32_t group_id = map_->Get(key_ptr, key_length);
+        if (group_id == ::arrow::internal::kKeyNotFound) {
           visit_unknown_group();
           continue;
         }
-        group_id = it->second;
+        visit_group(static_cast<uint32_t>(group_id));
       }
-      visit_group(group_id);
     }
+    return Status::OK();
   }
 
   Result<Datum> ConsumeImpl(const ExecSpan& batch, int64_t offset, int64_t length,
@@ -470,11 +467,11 @@ struct GrouperImpl : public Grouper {
     }
 
     if (mode == GrouperMode::kPopulate) {
-      VisitKeys(
+      RETURN_NOT_OK(VisitKeys(
           batch.length, offsets_batch.data(), key_bytes_batch.data(),
           /*insert_new_keys=*/true,
           /*visit_group=*/[](...) {},
-          /*visit_unknown_group=*/[] {});
+          /*visit_unknown_group=*/[] {}));
       return Datum();
     }
 
@@ -488,8 +485,10 @@ struct GrouperImpl : public Grouper {
       };
       auto visit_unknown_group = [] {};
 
-      VisitKeys(batch.length, offsets_batch.data(), key_bytes_batch.data(),
-                /*insert_new_keys=*/true, visit_group, visit_unknown_group);
+      RETURN_NOT_OK(VisitKeys(batch.length, offsets_batch.data(),
+                              key_bytes_batch.data(),
+                              /*insert_new_keys=*/true, visit_group,
+                              visit_unknown_group));
     } else {
       DCHECK_EQ(mode, GrouperMode::kLookup);
 
@@ -506,8 +505,10 @@ struct GrouperImpl : public Grouper {
         null_bitmap_builder.UnsafeAppend(false);
       };
 
-      VisitKeys(batch.length, offsets_batch.data(), key_bytes_batch.data(),
-                /*insert_new_keys=*/false, visit_group, visit_unknown_group);
+      RETURN_NOT_OK(VisitKeys(batch.length, offsets_batch.data(),
+                              key_bytes_batch.data(),
+                              /*insert_new_keys=*/false, visit_group,
+                              visit_unknown_group));
 
       ARROW_ASSIGN_OR_RAISE(null_bitmap, null_bitmap_builder.Finish());
     }
@@ -515,33 +516,35 @@ struct GrouperImpl : public Grouper {
     return Datum(UInt32Array(batch.length, std::move(group_ids), std::move(null_bitmap)));
   }
 
-  uint32_t num_groups() const override { return num_groups_; }
+  uint32_t num_groups() const override { return static_cast<uint32_t>(map_->size()); }
 
   Result<ExecBatch> GetUniques() override {
-    ExecBatch out({}, num_groups_);
+    const int32_t num_groups = map_->size();
+    ExecBatch out({}, num_groups);
 
-    std::vector<uint8_t*> key_buf_ptrs(num_groups_);
-    for (int64_t i = 0; i < num_groups_; ++i) {
-      key_buf_ptrs[i] = key_bytes_.data() + offsets_[i];
+    std::vector<int32_t> offsets(num_groups + 1);
+    map_->CopyOffsets(0, offsets.data());
+    std::vector<uint8_t> key_bytes(map_->values_size());
+    map_->CopyValues(0, key_bytes.data());
+
+    std::vector<uint8_t*> key_buf_ptrs(num_groups);
+    for (int32_t i = 0; i < num_groups; ++i) {
+      key_buf_ptrs[i] = key_bytes.data() + offsets[i];
     }
 
     out.values.resize(encoders_.size());
     for (size_t i = 0; i < encoders_.size(); ++i) {
-      ARROW_ASSIGN_OR_RAISE(
-          out.values[i],
-          encoders_[i]->Decode(key_buf_ptrs.data(), static_cast<int32_t>(num_groups_),
-                               ctx_->memory_pool()));
+      ARROW_ASSIGN_OR_RAISE(out.values[i],
+                            encoders_[i]->Decode(key_buf_ptrs.data(), num_groups,
+                                                 ctx_->memory_pool()));
     }
 
     return out;
   }
 
   ExecContext* ctx_;
-  // TODO We could use std::string_view since the keys are copied in key_bytes_.
-  std::unordered_map<std::string, uint32_t> map_;
-  std::vector<int32_t> offsets_ = {0};
-  std::vector<uint8_t> key_bytes_;
-  uint32_t num_groups_ = 0;
+  int64_t num_groups_hint_ = 0;
+  std::unique_ptr<KeyMemoTable> map_;
   std::vector<std::unique_ptr<internal::KeyEncoder>> encoders_;
 };
 
@@ -566,9 +569,11 @@ struct GrouperFastImpl : public Grouper {
   }
 
   static Result<std::unique_ptr<GrouperFastImpl>> Make(
-      const std::vector<TypeHolder>& keys, ExecContext* ctx) {
+      const std::vector<TypeHolder>& keys, ExecContext* ctx,
+      int64_t num_groups_hint = 0) {
     auto impl = std::make_unique<GrouperFastImpl>();
     impl->ctx_ = ctx;
+    impl->num_groups_hint_ = num_groups_hint;
 
     RETURN_NOT_OK(impl->temp_stack_.Init(ctx->memory_pool(), 64 * minibatch_size_max_));
     impl->encode_ctx_.hardware_flags =
@@ -624,7 +629,9 @@ struct GrouperFastImpl : public Grouper {
       return impl_ptr->rows_.AppendSelectionFrom(impl_ptr->rows_minibatch_, num_keys,
                                                  nullptr);
     };
-    RETURN_NOT_OK(impl->map_.init(impl->encode_ctx_.hardware_flags, ctx->memory_pool()));
+    RETURN_NOT_OK(
+        impl->map_.init(impl->encode_ctx_.hardware_flags, ctx->memory_pool(),
+                        SwissTable::log_blocks_for_num_groups(num_groups_hint)));
     impl->cols_.resize(num_columns);
     impl->minibatch_hashes_.resize(impl->minibatch_size_max_ +
                                    kPaddingForSIMD / sizeof(uint32_t));
@@ -637,7 +644,8 @@ struct GrouperFastImpl : public Grouper {
     rows_.Clean();
     rows_minibatch_.Clean();
     map_.cleanup();
-    RETURN_NOT_OK(map_.init(encode_ctx_.hardware_flags, ctx_->memory_pool()));
+    RETURN_NOT_OK(map_.init(encode_ctx_.hardware_flags, ctx_->memory_pool(),
+                            SwissTable::log_blocks_for_num_groups(num_groups_hint_)));
     // TODO: It is now assumed that the dictionaries_ are identical to the first batch
     // throughout the grouper's lifespan so no resetting is needed. But if we want to
     // support different dictionaries for different batches, we need to reset the
@@ -645,6 +653,33 @@ struct GrouperFastImpl : public Grouper {
     return Status::OK();
   }
 
+  bool ReserveInlineState(uint32_t state_bytes) override {
+    if (state_bytes == 0 || num_groups() > 0) {
+      return false;
+    }
+    if (!encoder_.row_metadata().is_fixed_length) {
+      // Variable-length keys place data after the fixed section of the row,
+      // leaving nowhere to co-locate state
+      return false;
+    }
+    // Rebuild the row schema with the state area appended and re-initialize
+    // the (still empty) row tables
+    encoder_.Init(col_metadata_,
+                  /* row_alignment = */ sizeof(uint64_t),
+                  /* string_alignment = */ sizeof(uint64_t), state_bytes);
+    if (!rows_.Init(ctx_->memory_pool(), encoder_.row_metadata()).ok()) {
+      return false;
+    }
+    if (!rows_minibatch_.Init(ctx_->memory_pool(), encoder_.row_metadata()).ok()) {
+      return false;
+    }
+    return true;
+  }
+
+  uint8_t* inline_group_state(uint32_t group_id) override {
+    return rows_.mutable_row_state(group_id);
+  }
+
   Status Populate(const ExecSpan& batch, int64_t offset, int64_t length) override {
     return ConsumeImpl(batch, offset, length, GrouperMode::kPopulate).status();
   }
@@ -934,6 +969,7 @@ struct GrouperFastImpl : public Grouper {
   int minibatch_size_;
 
   ExecContext* ctx_;
+  int64_t num_groups_hint_ = 0;
   arrow::util::TempVectorStack temp_stack_;
   LightContext encode_ctx_;
 
@@ -955,11 +991,12 @@ struct GrouperFastImpl : public Grouper {
 }  // namespace
 
 Result<std::unique_ptr<Grouper>> Grouper::Make(const std::vector<TypeHolder>& key_types,
-                                               ExecContext* ctx) {
+                                               ExecContext* ctx,
+                                               int64_t num_groups_hint) {
   if (GrouperFastImpl::CanUse(key_types)) {
-    return GrouperFastImpl::Make(key_types, ctx);
+    return GrouperFastImpl::Make(key_types, ctx, num_groups_hint);
   }
-  return GrouperImpl::Make(key_types, ctx);
+  return GrouperImpl::Make(key_types, ctx, num_groups_hint);
 }
 
 Result<std::shared_ptr<ListArray>> Grouper::ApplyGroupings(const ListArray& groupings,
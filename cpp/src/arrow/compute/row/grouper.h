@@ -23,6 +23,7 @@
 #include "arrow/compute/kernel.h"
 #include "arrow/datum.h"
 #include "arrow/result.h"
+#include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -106,13 +107,38 @@ class ARROW_EXPORT Grouper {
   virtual ~Grouper() = default;
 
   /// Construct a Grouper which receives the specified key types
+  ///
+  /// `num_groups_hint`, when positive, is an estimate of the number of
+  /// distinct keys that will be consumed (e.g. an NDV sketch from scan
+  /// statistics).  The grouper pre-sizes its hash table for it, avoiding
+  /// repeated full rehashes on high-cardinality inputs.
   static Result<std::unique_ptr<Grouper>> Make(const std::vector<TypeHolder>& key_types,
-                                               ExecContext* ctx = default_exec_context());
+                                               ExecContext* ctx = default_exec_context(),
+                                               int64_t num_groups_hint = 0);
 
   /// Reset all intermediate state, make the grouper logically as just `Make`ed.
   /// The underlying buffers, if any, may or may not be released though.
   virtual Status Reset() = 0;
 
+  /// \brief Reserve `state_bytes` of per-group state co-located with the
+  /// encoded key rows
+  ///
+  /// When supported, the state of a group lives in the same cache line(s) as
+  /// its key row, so fixed-size aggregate accumulators (sums, counts, mins,
+  /// maxes) can be updated without touching a second array per row.  Must be
+  /// called while the grouper is still empty.  Returns false if the grouper
+  /// cannot co-locate state (e.g. variable-length keys), in which case
+  /// callers keep their state in separate arrays as usual.
+  virtual bool ReserveInlineState(uint32_t state_bytes) { return false; }
+
+  /// \brief Mutable pointer to the inline state of a group
+  ///
+  /// State bytes of a newly created group are uninitialized: callers must
+  /// initialize them when a group id first appears.
+  ///
+  /// \pre ReserveInlineState() returned true and group_id < num_groups()
+  virtual uint8_t* inline_group_state(uint32_t group_id) { return NULLPTR; }
+
   /// Consume a batch of keys, producing the corresponding group ids as an integer array,
   /// over a slice defined by an offset and length, which defaults to the batch length.
   /// Currently only uint32 indices will be produced, eventually the bit width will only
@@ -84,6 +84,74 @@ TEST(Grouper, ResortedColumnsWithLargeNullRows) {
   }
 }
 
+TEST(Grouper, NumGroupsHint) {
+  // Pre-sizing from a cardinality hint must not change results, whether the
+  // hint is accurate, too small or too large
+  constexpr int64_t num_rows = 4096;
+  auto rng = random::RandomArrayGenerator(0x5487656);
+  auto i64_arr = rng.Int64(num_rows, 0, 1023, /*null_probability=*/0.1);
+  ExecBatch batch({i64_arr}, num_rows);
+  ExecSpan span(batch);
+
+  ASSERT_OK_AND_ASSIGN(auto reference_grouper, Grouper::Make(span.GetTypes()));
+  ASSERT_OK_AND_ASSIGN(Datum reference_ids, reference_grouper->Consume(span));
+
+  for (int64_t hint : {1LL, 1024LL, 1000000LL}) {
+    ASSERT_OK_AND_ASSIGN(auto grouper,
+                         Grouper::Make(span.GetTypes(), default_exec_context(), hint));
+    ASSERT_OK_AND_ASSIGN(Datum group_ids, grouper->Consume(span));
+    AssertDatumsEqual(reference_ids, group_ids);
+    ASSERT_EQ(grouper->num_groups(), reference_grouper->num_groups());
+    // Reset keeps the pre-sizing hint and the grouper stays usable
+    ASSERT_OK(grouper->Reset());
+    ASSERT_OK_AND_ASSIGN(group_ids, grouper->Consume(span));
+    AssertDatumsEqual(reference_ids, group_ids);
+  }
+}
+
+TEST(Grouper, InlineGroupState) {
+  // Fixed-width keys support co-located per-group state; group ids index it
+  auto keys = ArrayFromJSON(int64(), "[1, 2, 1, 3, 2, 1]");
+  ExecBatch batch({keys}, keys->length());
+  ExecSpan span(batch);
+
+  ASSERT_OK_AND_ASSIGN(auto grouper, Grouper::Make(span.GetTypes()));
+  if (!grouper->ReserveInlineState(sizeof(int64_t))) {
+    GTEST_SKIP() << "inline group state not supported by this grouper";
+  }
+  ASSERT_OK_AND_ASSIGN(Datum id_datum, grouper->Consume(span));
+
+  // Accumulate a per-group count inline, initializing state on first sight
+  const auto* group_ids = id_datum.array()->GetValues<uint32_t>(1);
+  uint32_t num_initialized = 0;
+  for (int64_t i = 0; i < keys->length(); ++i) {
+    const uint32_t g = group_ids[i];
+    auto* count = reinterpret_cast<int64_t*>(grouper->inline_group_state(g));
+    if (g >= num_initialized) {
+      *count = 0;
+      num_initialized = g + 1;
+    }
+    ++*count;
+  }
+  ASSERT_EQ(grouper->num_groups(), 3);
+  ASSERT_EQ(*reinterpret_cast<int64_t*>(grouper->inline_group_state(0)), 3);
+  ASSERT_EQ(*reinterpret_cast<int64_t*>(grouper->inline_group_state(1)), 2);
+  ASSERT_EQ(*reinterpret_cast<int64_t*>(grouper->inline_group_state(2)), 1);
+
+  // The keys decode unchanged with the state area present
+  ASSERT_OK_AND_ASSIGN(auto uniques, grouper->GetUniques());
+  AssertDatumsEqual(ArrayFromJSON(int64(), "[1, 2, 3]"), uniques[0]);
+
+  // Variable-length keys cannot co-locate state
+  ASSERT_OK_AND_ASSIGN(auto string_grouper, Grouper::Make({utf8()}));
+  ASSERT_FALSE(string_grouper->ReserveInlineState(sizeof(int64_t)));
+
+  // Reserving after keys were consumed is rejected
+  ASSERT_OK_AND_ASSIGN(auto late_grouper, Grouper::Make(span.GetTypes()));
+  ASSERT_OK(late_grouper->Populate(span));
+  ASSERT_FALSE(late_grouper->ReserveInlineState(sizeof(int64_t)));
+}
+
 // Reproduction of GH-43124: Provoke var length buffer size if a grouper produces zero
 // groups.
 TEST(Grouper, EmptyGroups) {
@@ -41,6 +41,9 @@ bool RowTableMetadata::is_compatible(const RowTableMetadata& other) const {
       string_alignment != other.string_alignment) {
     return false;
   }
+  if (extra_state_bytes != other.extra_state_bytes) {
+    return false;
+  }
   for (size_t i = 0; i < column_metadatas.size(); ++i) {
     if (column_metadatas[i].is_fixed_length !=
         other.column_metadatas[i].is_fixed_length) {
@@ -55,7 +58,7 @@ bool RowTableMetadata::is_compatible(const RowTableMetadata& other) const {
 
 void RowTableMetadata::FromColumnMetadataVector(
     const std::vector<KeyColumnMetadata>& cols, int in_row_alignment,
-    int in_string_alignment) {
+    int in_string_alignment, uint32_t in_extra_state_bytes) {
   column_metadatas.resize(cols.size());
   for (size_t i = 0; i < cols.size(); ++i) {
     column_metadatas[i] = cols[i];
@@ -153,6 +156,21 @@ void RowTableMetadata::FromColumnMetadataVector(
   }
 
   is_fixed_length = (num_varbinary_cols == 0);
+
+  // Reserve the optional caller-managed state area at the end of the row,
+  // aligned for direct use as integer accumulators.  Varying-length rows do
+  // not support it: their trailing bytes are variable-length data.
+  if (is_fixed_length && in_extra_state_bytes > 0) {
+    offset_within_row += RowTableMetadata::padding_for_alignment_within_row(
+        offset_within_row, in_row_alignment);
+    extra_state_offset = offset_within_row;
+    extra_state_bytes = in_extra_state_bytes;
+    offset_within_row += in_extra_state_bytes;
+  } else {
+    extra_state_offset = 0;
+    extra_state_bytes = 0;
+  }
+
   fixed_length =
       offset_within_row +
       RowTableMetadata::padding_for_alignment_within_row(
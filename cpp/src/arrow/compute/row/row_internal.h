@@ -56,6 +56,16 @@ struct ARROW_EXPORT RowTableMetadata {
   /// which should already be aligned.
   uint32_t varbinary_end_array_offset;
 
+  /// Offset within a row of the optional inline per-row state area.
+  /// Only used for fixed-length rows with extra_state_bytes > 0.
+  uint32_t extra_state_offset = 0;
+
+  /// Number of bytes per row reserved after the encoded key columns for
+  /// caller-managed fixed-size state (e.g. aggregate accumulators that are
+  /// updated in the same cache line as the key).  Zero when no state area was
+  /// requested; only supported for fixed-length rows.
+  uint32_t extra_state_bytes = 0;
+
   /// Fixed number of bytes per row that are used to encode null masks.
   /// Null masks indicate for a single row which of its columns are null.
   /// Nth bit in the sequence of bytes assigned to a row represents null
@@ -154,8 +164,13 @@ struct ARROW_EXPORT RowTableMetadata {
   uint32_t num_varbinary_cols() const;
 
   /// \brief Populate this instance to describe `cols` with the given alignment
+  ///
+  /// `in_extra_state_bytes`, when positive, reserves that many bytes of
+  /// caller-managed state at the end of each row.  The request is ignored for
+  /// varying-length rows.
   void FromColumnMetadataVector(const std::vector<KeyColumnMetadata>& cols,
-                                int in_row_alignment, int in_string_alignment);
+                                int in_row_alignment, int in_string_alignment,
+                                uint32_t in_extra_state_bytes = 0);
 
   /// \brief True if `other` has the same number of columns
   ///   and each column has the same width (two variable length
@@ -220,6 +235,19 @@ class ARROW_EXPORT RowTableImpl {
     return mutable_data(1) + static_cast<int64_t>(row_id) * metadata_.fixed_length;
   }
 
+  const uint8_t* row_state(uint32_t row_id) const {
+    ARROW_DCHECK(metadata_.is_fixed_length && metadata_.extra_state_bytes > 0);
+    return fixed_length_rows(row_id) + metadata_.extra_state_offset;
+  }
+  /// \brief Mutable pointer to the inline state area of a row
+  ///
+  /// The state bytes of newly appended rows are uninitialized; callers are
+  /// responsible for initializing them.
+  uint8_t* mutable_row_state(uint32_t row_id) {
+    ARROW_DCHECK(metadata_.is_fixed_length && metadata_.extra_state_bytes > 0);
+    return mutable_fixed_length_rows(row_id) + metadata_.extra_state_offset;
+  }
+
   const offset_type* offsets() const {
     ARROW_DCHECK(!metadata_.is_fixed_length);
     return reinterpret_cast<const offset_type*>(data(1));
@@ -247,8 +247,16 @@ class Lexer {
       }
       BulkWordType word;
       memcpy(&word, data, sizeof(BulkWordType));
-      if (bulk_filter_.Matches(word)) {
-        return data;
+      if constexpr (BulkFilterType::kHasPositions) {
+        const auto mask = bulk_filter_.MatchMask(word);
+        if (ARROW_PREDICT_FALSE(mask != 0)) {
+          // Jump right to the first special character
+          return data + BulkFilterType::FirstMatch(mask);
+        }
+      } else {
+        if (bulk_filter_.Matches(word)) {
+          return data;
+        }
       }
       // No special chars
       data += sizeof(BulkWordType);
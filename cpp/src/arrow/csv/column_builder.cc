@@ -241,6 +241,11 @@ class InferringColumnBuilder : public ConcreteColumnBuilder {
   InferStatus infer_status_;
   std::shared_ptr<Converter> converter_;
 
+  // Rows successfully converted with the current type, and whether the
+  // type was settled after ConvertOptions::inference_window_rows of them
+  int64_t converted_rows_ = 0;
+  bool type_settled_ = false;
+
   // The parsers corresponding to each chunk (for reconverting)
   std::vector<std::shared_ptr<BlockParser>> parsers_;
 };
@@ -274,9 +279,16 @@ Status InferringColumnBuilder::TryConvertChunk(int64_t chunk_index) {
     return Status::OK();
   }
 
-  if (maybe_array.ok() || !infer_status_.can_loosen_type()) {
+  const bool can_loosen_type = infer_status_.can_loosen_type() && !type_settled_;
+  if (maybe_array.ok() || !can_loosen_type) {
     // Conversion succeeded, or failed definitively
-    if (!infer_status_.can_loosen_type()) {
+    if (maybe_array.ok() && !type_settled_ && options_.inference_window_rows > 0) {
+      // Settle the type once enough rows converted with it, so later chunks
+      // are never reconverted and their parsers can be released eagerly
+      converted_rows_ += parser->num_rows();
+      type_settled_ = converted_rows_ >= options_.inference_window_rows;
+    }
+    if (!can_loosen_type || type_settled_) {
       // We won't try to reconvert anymore
       parsers_[chunk_index].reset();
     }
@@ -285,6 +297,7 @@ Status InferringColumnBuilder::TryConvertChunk(int64_t chunk_index) {
 
   // Conversion failed, try another type
   infer_status_.LoosenType(maybe_array.status());
+  converted_rows_ = 0;
   RETURN_NOT_OK(UpdateType());
 
   // Reconvert past finished chunks
@@ -351,6 +351,37 @@ TEST_F(InferringColumnBuilderTest, MultipleChunkInteger) {
       {ArrayFromJSON(int64(), "[null]"), ArrayFromJSON(int64(), "[null, 123, 456]")});
 }
 
+TEST_F(InferringColumnBuilderTest, InferenceWindowRows) {
+  auto options = ConvertOptions::Defaults();
+  options.inference_window_rows = 2;
+  auto tg = TaskGroup::MakeSerial();
+
+  // The type settles after two successfully converted rows; later chunks
+  // convert directly with the settled type
+  CheckInferred(tg, {{"123", "456"}, {"789"}}, options,
+                {ArrayFromJSON(int64(), "[123, 456]"), ArrayFromJSON(int64(), "[789]")});
+
+  // After the type has settled, a value that does not parse is an error
+  // instead of loosening the whole column to a wider type
+  tg = TaskGroup::MakeSerial();
+  std::shared_ptr<ColumnBuilder> builder;
+  ASSERT_OK_AND_ASSIGN(builder,
+                       ColumnBuilder::Make(default_memory_pool(), 0, options, tg));
+  for (const auto& chunk : ChunkData{{"123", "456"}, {"abc"}}) {
+    std::shared_ptr<BlockParser> parser;
+    MakeColumnParser(chunk, &parser);
+    builder->Append(parser);
+  }
+  ASSERT_RAISES(Invalid, builder->task_group()->Finish());
+
+  // Before the window fills, inference loosens as usual
+  options.inference_window_rows = 10;
+  tg = TaskGroup::MakeSerial();
+  CheckInferred(
+      tg, {{"123"}, {"abc"}}, options,
+      {ArrayFromJSON(utf8(), R"(["123"])"), ArrayFromJSON(utf8(), R"(["abc"])")});
+}
+
 TEST_F(InferringColumnBuilderTest, SingleChunkBoolean) {
   auto options = ConvertOptions::Defaults();
   auto tg = TaskGroup::MakeSerial();
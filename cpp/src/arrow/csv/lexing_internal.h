@@ -20,6 +20,7 @@
 #include <cstdint>
 
 #include "arrow/csv/options.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/simd.h"
 
 namespace arrow {
@@ -43,6 +44,10 @@ class SpecializedOptions {
 
 class BaseBloomFilter {
  public:
+  // Bloom filters can only tell whether a word *may* contain a special
+  // character, not where; callers must re-scan matched words bytewise.
+  static constexpr bool kHasPositions = false;
+
   explicit BaseBloomFilter(const ParseOptions& options) : filter_(MakeFilter(options)) {}
 
  protected:
@@ -121,39 +126,52 @@ class BloomFilter4B : public BaseBloomFilter {
 
 #if defined(ARROW_HAVE_SSE4_2)
 
-// SSE4.2 filter: 8 bytes at a time, using packed compare instruction
-
-// NOTE: on SVE, could use svmatch[_u8] for similar functionality.
+// SSE bitmap filter: 16 bytes at a time, using packed compares and a
+// movemask bitmap of special character positions.  Unlike the Bloom
+// filters above, a match pinpoints the first special character, so callers
+// can copy the plain prefix wholesale and resume the state machine right
+// at the delimiter/quote/newline instead of re-scanning the word bytewise.
+// This also makes the larger 16-byte word profitable, as frequent matches
+// in mid-sized cells no longer trigger bytewise re-scans.
 
 template <typename SpecializedOptions>
-class SSE42Filter {
+class SseBitmapFilter {
  public:
-  using WordType = uint64_t;
-
-  explicit SSE42Filter(const ParseOptions& options) : filter_(MakeFilter(options)) {}
-
-  bool Matches(WordType w) const {
-    // Look up every byte in `w` in the SIMD filter.
-    return _mm_cmpistrc(_mm_set1_epi64x(w), filter_,
-                        _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY);
+  struct WordType {
+    uint8_t bytes[16];
+  };
+
+  static constexpr bool kHasPositions = true;
+
+  explicit SseBitmapFilter(const ParseOptions& options)
+      : delim_(_mm_set1_epi8(options.delimiter)),
+        quote_(_mm_set1_epi8(SpecializedOptions::quoting ? options.quote_char : '\r')),
+        escape_(
+            _mm_set1_epi8(SpecializedOptions::escaping ? options.escape_char : '\r')) {}
+
+  // A bitmap with bit i set iff the i-th byte of `w` is a special character
+  // (zero if the word contains none).
+  uint32_t MatchMask(const WordType& w) const {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(w.bytes));
+    __m128i m = _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('\r')),
+                             _mm_cmpeq_epi8(v, _mm_set1_epi8('\n')));
+    m = _mm_or_si128(m, _mm_cmpeq_epi8(v, delim_));
+    if (SpecializedOptions::quoting) {
+      m = _mm_or_si128(m, _mm_cmpeq_epi8(v, quote_));
+    }
+    if (SpecializedOptions::escaping) {
+      m = _mm_or_si128(m, _mm_cmpeq_epi8(v, escape_));
+    }
+    return static_cast<uint32_t>(_mm_movemask_epi8(m));
   }
 
- protected:
-  using BulkFilterType = __m128i;
-
-  BulkFilterType MakeFilter(const ParseOptions& options) {
-    // Make a SIMD word of the characters we want to match
-    const char cr = '\r';
-    const char lf = '\n';
-    const char delim = options.delimiter;
-    const char quote = SpecializedOptions::quoting ? options.quote_char : cr;
-    const char escape = SpecializedOptions::escaping ? options.escape_char : cr;
-
-    return _mm_set_epi8(delim, quote, escape, lf, cr, cr, cr, cr, cr, cr, cr, cr, cr, cr,
-                        cr, cr);
-  }
+  bool Matches(const WordType& w) const { return MatchMask(w) != 0; }
 
-  const BulkFilterType filter_;
+  // Index of the first special character, given a non-zero MatchMask() result.
+  static int FirstMatch(uint32_t mask) { return bit_util::CountTrailingZeros(mask); }
+
+ private:
+  const __m128i delim_, quote_, escape_;
 };
 
 #elif defined(ARROW_HAVE_NEON)
@@ -169,12 +187,16 @@ class NeonFilter {
   // only 128-bit.
   using WordType = uint8x8_t;
 
+  static constexpr bool kHasPositions = true;
+
   explicit NeonFilter(const ParseOptions& options)
       : delim_(vdup_n_u8(options.delimiter)),
         quote_(vdup_n_u8(SpecializedOptions::quoting ? options.quote_char : '\n')),
         escape_(vdup_n_u8(SpecializedOptions::escaping ? options.escape_char : '\n')) {}
 
-  bool Matches(WordType w) const {
+  // A byte-mask with the i-th byte all-ones iff the i-th byte of `w` is a
+  // special character (zero if the word contains none).
+  uint64_t MatchMask(WordType w) const {
     uint8x8_t v;
     v = vceq_u8(w, vdup_n_u8('\r'));
     v = vorr_u8(v, vceq_u8(w, vdup_n_u8('\n')));
@@ -187,9 +209,14 @@ class NeonFilter {
     }
     uint64_t r;
     vst1_u64(&r, vreinterpret_u64_u8(v));
-    return r != 0;
+    return r;
   }
 
+  bool Matches(WordType w) const { return MatchMask(w) != 0; }
+
+  // Index of the first special character, given a non-zero MatchMask() result.
+  static int FirstMatch(uint64_t mask) { return bit_util::CountTrailingZeros(mask) >> 3; }
+
  private:
   const uint8x8_t delim_, quote_, escape_;
 };
@@ -197,9 +224,9 @@ class NeonFilter {
 #endif
 
 #if defined(ARROW_HAVE_SSE4_2) && (defined(__x86_64__) || defined(_M_X64))
-// (the SSE4.2 filter seems to crash on RTools with 32-bit MinGW)
+// (the SSE filter seems to crash on RTools with 32-bit MinGW)
 template <typename SpecializedOptions>
-using PreferredBulkFilterType = SSE42Filter<SpecializedOptions>;
+using PreferredBulkFilterType = SseBitmapFilter<SpecializedOptions>;
 #elif defined(ARROW_HAVE_NEON)
 template <typename SpecializedOptions>
 using PreferredBulkFilterType = NeonFilter<SpecializedOptions>;
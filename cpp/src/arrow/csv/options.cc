@@ -46,7 +46,13 @@ ConvertOptions ConvertOptions::Defaults() {
   return options;
 }
 
-Status ConvertOptions::Validate() const { return Status::OK(); }
+Status ConvertOptions::Validate() const {
+  if (ARROW_PREDICT_FALSE(inference_window_rows < 0)) {
+    return Status::Invalid("ConvertOptions: inference_window_rows cannot be negative: ",
+                           inference_window_rows);
+  }
+  return Status::OK();
+}
 
 ReadOptions ReadOptions::Defaults() { return ReadOptions(); }
 
@@ -67,6 +73,10 @@ Status ReadOptions::Validate() const {
         "ReadOptions: autogenerate_column_names cannot be true when column_names are "
         "provided");
   }
+  if (ARROW_PREDICT_FALSE(memory_budget < 0)) {
+    return Status::Invalid("ReadOptions: memory_budget cannot be negative: ",
+                           memory_budget);
+  }
   return Status::OK();
 }
 
@@ -107,6 +107,18 @@ struct ARROW_EXPORT ConvertOptions {
   /// Decimal point character for floating-point and decimal data
   char decimal_point = '.';
 
+  /// \brief Number of rows after which type inference is finalized
+  ///
+  /// When positive, a column whose inferred type has successfully converted
+  /// at least this many rows stops loosening its type: later values that do
+  /// not parse with the settled type raise an error instead of reconverting
+  /// the column with a wider type.  This bounds reconversion work and lets
+  /// parsed blocks be released as soon as they are converted, instead of
+  /// being retained for possible reconversion until end of file.
+  /// Zero (the default) infers over the whole file.
+  /// Columns with explicit entries in `column_types` are unaffected.
+  int64_t inference_window_rows = 0;
+
   // XXX Should we have a separate FilterOptions?
 
   /// If non-empty, indicates the names of columns from the CSV file that should
@@ -163,6 +175,18 @@ struct ARROW_EXPORT ReadOptions {
   /// If false, column names will be read from the first CSV row after `skip_rows`.
   bool autogenerate_column_names = false;
 
+  /// \brief Approximate cap on memory held in flight by the streaming reader.
+  ///
+  /// When positive, the number of raw input blocks buffered ahead of the
+  /// parser and the number of decoded record batches buffered ahead of the
+  /// consumer are both derived from this budget (in bytes) instead of the
+  /// CPU thread pool capacity, applying backpressure to the input stream
+  /// once the budget is reached.  Peak memory use then depends on this
+  /// value and `block_size` rather than on file shape and core count.
+  /// Zero (the default) keeps the readahead-based defaults.
+  /// Only used by StreamingReader.
+  int64_t memory_budget = 0;
+
   /// Create read options with default values
   static ReadOptions Defaults();
 
@@ -209,6 +233,15 @@ struct ARROW_EXPORT WriteOptions {
   /// \brief Quoting style
   QuotingStyle quoting_style = QuotingStyle::Needed;
 
+  /// \brief Whether to use the global CPU thread pool to format batches
+  ///
+  /// When enabled, successive batches of `batch_size` rows are stringified
+  /// concurrently into per-batch buffers, which are then flushed to the
+  /// output stream in order with a single vectored write per record batch
+  /// or table. The written bytes are identical to the serial path; peak
+  /// memory use grows with the number of batches formatted concurrently.
+  bool use_threads = false;
+
   /// Create write options with default values
   static WriteOptions Defaults();
 
@@ -20,7 +20,9 @@
 #include <algorithm>
 #include <cstdio>
 #include <limits>
+#include <mutex>
 #include <utility>
+#include <vector>
 
 #include "arrow/csv/lexing_internal.h"
 #include "arrow/memory_pool.h"
@@ -59,19 +61,100 @@ Status MismatchingColumns(const InvalidRow& row) {
 
 inline bool IsControlChar(uint8_t c) { return c < ' '; }
 
+// Recycles parser scratch buffers across blocks.  The parsed-data and
+// value-desc buffers escape into the DataBatch and are only released once
+// the converters are done with a block; routing that release back here lets
+// a steady-state reader parse block after block without hitting the
+// allocator.  Only buffers from the default memory pool are retained, since
+// the free list outlives any caller-provided pool.
+class ScratchBufferRecycler {
+ public:
+  static constexpr int64_t kMaxRetainedBytes = 64 << 20;
+
+  static ScratchBufferRecycler* GetInstance() {
+    // Leaked so that buffers released during process teardown find it alive
+    static auto* instance = new ScratchBufferRecycler();
+    return instance;
+  }
+
+  Result<std::shared_ptr<ResizableBuffer>> Allocate(int64_t size, MemoryPool* pool) {
+    if (pool == default_memory_pool()) {
+      std::shared_ptr<ResizableBuffer> buffer;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // Smallest retained buffer with sufficient capacity (the list is tiny)
+        auto best = free_list_.end();
+        for (auto it = free_list_.begin(); it != free_list_.end(); ++it) {
+          if ((*it)->capacity() >= size &&
+              (best == free_list_.end() || (*it)->capacity() < (*best)->capacity())) {
+            best = it;
+          }
+        }
+        if (best != free_list_.end()) {
+          buffer = std::move(*best);
+          retained_bytes_ -= buffer->capacity();
+          free_list_.erase(best);
+        }
+      }
+      if (buffer) {
+        RETURN_NOT_OK(buffer->Resize(size, /*shrink_to_fit=*/false));
+        return buffer;
+      }
+    }
+    return AllocateResizableBuffer(size, pool);
+  }
+
+  // Hand out a finished scratch buffer, arranging for its memory to come
+  // back to the free list when the last reader of the block releases it.
+  static Result<std::shared_ptr<Buffer>> Finish(std::shared_ptr<ResizableBuffer> scratch,
+                                                int64_t size, MemoryPool* pool) {
+    if (pool == default_memory_pool()) {
+      return std::make_shared<RecyclableBuffer>(std::move(scratch), size);
+    }
+    RETURN_NOT_OK(scratch->Resize(size));
+    return std::move(scratch);
+  }
+
+ protected:
+  class RecyclableBuffer : public MutableBuffer {
+   public:
+    RecyclableBuffer(std::shared_ptr<ResizableBuffer> scratch, int64_t size)
+        : MutableBuffer(scratch->mutable_data(), size), scratch_(std::move(scratch)) {}
+
+    ~RecyclableBuffer() override { GetInstance()->Recycle(std::move(scratch_)); }
+
+   private:
+    std::shared_ptr<ResizableBuffer> scratch_;
+  };
+
+  void Recycle(std::shared_ptr<ResizableBuffer> buffer) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (retained_bytes_ + buffer->capacity() > kMaxRetainedBytes) {
+      return;
+    }
+    retained_bytes_ += buffer->capacity();
+    free_list_.push_back(std::move(buffer));
+  }
+
+  std::mutex mutex_;
+  std::vector<std::shared_ptr<ResizableBuffer>> free_list_;
+  int64_t retained_bytes_ = 0;
+};
+
 // A helper class allocating the buffer for parsed values and writing into it
 // without any further resizes, except at the end.
 class PresizedDataWriter {
  public:
   PresizedDataWriter(MemoryPool* pool, uint32_t size)
-      : parsed_size_(0), parsed_capacity_(size) {
-    parsed_buffer_ = *AllocateResizableBuffer(parsed_capacity_, pool);
+      : pool_(pool), parsed_size_(0), parsed_capacity_(size) {
+    parsed_buffer_ =
+        *ScratchBufferRecycler::GetInstance()->Allocate(parsed_capacity_, pool);
     parsed_ = parsed_buffer_->mutable_data();
   }
 
   void Finish(std::shared_ptr<Buffer>* out_parsed) {
-    ARROW_CHECK_OK(parsed_buffer_->Resize(parsed_size_));
-    *out_parsed = parsed_buffer_;
+    *out_parsed = *ScratchBufferRecycler::Finish(std::move(parsed_buffer_),
+                                                 parsed_size_, pool_);
   }
 
   void BeginLine() { saved_parsed_size_ = parsed_size_; }
@@ -88,12 +171,19 @@ class PresizedDataWriter {
     parsed_size_ += sizeof(w);
   }
 
+  void PushFieldBytes(const char* data, int64_t length) {
+    DCHECK_GE(parsed_capacity_ - parsed_size_, length);
+    memcpy(parsed_ + parsed_size_, data, length);
+    parsed_size_ += length;
+  }
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
   int64_t size() { return parsed_size_; }
 
  protected:
+  MemoryPool* pool_;
   std::shared_ptr<ResizableBuffer> parsed_buffer_;
   uint8_t* parsed_;
   int64_t parsed_size_;
@@ -127,8 +217,8 @@ class ValueDescWriter {
   }
 
   Result<std::shared_ptr<Buffer>> Finish() {
-    RETURN_NOT_OK(values_buffer_->Resize(values_size_ * sizeof(*values_)));
-    return std::move(values_buffer_);
+    return ScratchBufferRecycler::Finish(std::move(values_buffer_),
+                                         values_size_ * sizeof(*values_), pool_);
   }
 
   const Status& status() const { return status_; }
@@ -144,14 +234,19 @@ class ValueDescWriter {
 
  protected:
   ValueDescWriter(MemoryPool* pool, int64_t values_capacity)
-      : values_size_(0), values_capacity_(values_capacity), status_(Status::OK()) {
-    status_ &= AllocateResizableBuffer(values_capacity_ * sizeof(*values_), pool)
+      : pool_(pool),
+        values_size_(0),
+        values_capacity_(values_capacity),
+        status_(Status::OK()) {
+    status_ &= ScratchBufferRecycler::GetInstance()
+                   ->Allocate(values_capacity_ * sizeof(*values_), pool)
                    .Value(&values_buffer_);
     if (status_.ok()) {
       values_ = reinterpret_cast<ParsedValueDesc*>(values_buffer_->mutable_data());
     }
   }
 
+  MemoryPool* pool_;
   std::shared_ptr<ResizableBuffer> values_buffer_;
   ParsedValueDesc* values_;
   int64_t values_size_;
@@ -479,8 +574,19 @@ class BlockParserImpl {
       }
       WordType word;
       memcpy(&word, data, sizeof(WordType));
-      if (bulk_filter.Matches(word)) {
-        return data;
+      if constexpr (SpecializedBulkFilter::kHasPositions) {
+        const auto mask = bulk_filter.MatchMask(word);
+        if (ARROW_PREDICT_FALSE(mask != 0)) {
+          // Copy the plain prefix wholesale and resume the state machine
+          // right at the first special character.
+          const int pos = SpecializedBulkFilter::FirstMatch(mask);
+          data_writer->PushFieldBytes(data, pos);
+          return data + pos;
+        }
+      } else {
+        if (bulk_filter.Matches(word)) {
+          return data;
+        }
       }
       // No special chars
       data_writer->PushFieldWord(word);
@@ -264,6 +264,24 @@ TEST(BlockParser, Basics) {
   }
 }
 
+TEST(BlockParser, ScratchBufferReuse) {
+  // Parsed data held by earlier parsers must stay intact while later parsers
+  // pick up their recycled scratch buffers
+  auto csv1 = MakeCSVData({"ab,cd\n", "ef,gh\n"});
+  auto csv2 = MakeCSVData({"ij,kl\n", "mn,op\n"});
+  BlockParser parser1(ParseOptions::Defaults());
+  AssertParseOk(parser1, csv1);
+  {
+    // Releasing this parser returns its scratch buffers to the recycler
+    BlockParser parser2(ParseOptions::Defaults());
+    AssertParseOk(parser2, csv1);
+  }
+  BlockParser parser3(ParseOptions::Defaults());
+  AssertParseOk(parser3, csv2);
+  AssertColumnsEq(parser3, {{"ij", "mn"}, {"kl", "op"}});
+  AssertColumnsEq(parser1, {{"ab", "ef"}, {"cd", "gh"}});
+}
+
 TEST(BlockParser, EmptyHeader) {
   // Cannot infer number of columns
   uint32_t out_size;
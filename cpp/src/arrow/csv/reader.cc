@@ -17,11 +17,13 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <sstream>
 #include <string>
@@ -839,15 +841,33 @@ class StreamingReaderImpl : public ReaderMixin,
     ARROW_ASSIGN_OR_RAISE(auto istream_it,
                           io::MakeInputStreamIterator(input_, read_options_.block_size));
 
-    // TODO Consider exposing readahead as a read option (ARROW-12090)
-    ARROW_ASSIGN_OR_RAISE(auto bg_it, MakeBackgroundGenerator(std::move(istream_it),
-                                                              io_context_.executor()));
+    int max_readahead = cpu_executor->GetCapacity();
+
+    AsyncGenerator<std::shared_ptr<Buffer>> bg_it;
+    if (read_options_.memory_budget > 0) {
+      // Split the budget between raw input blocks buffered ahead of the
+      // parser and decoded batches buffered ahead of the consumer.  The
+      // background generator stops pulling from the input stream once its
+      // queue is full, bounding peak memory regardless of file shape.
+      const int budget_blocks = static_cast<int>(std::min<int64_t>(
+          std::numeric_limits<int>::max(),
+          std::max<int64_t>(1, read_options_.memory_budget /
+                                   (2 * read_options_.block_size))));
+      ARROW_ASSIGN_OR_RAISE(
+          bg_it, MakeBackgroundGenerator(std::move(istream_it), io_context_.executor(),
+                                         /*max_q=*/budget_blocks,
+                                         /*q_restart=*/std::max(1, budget_blocks / 2)));
+      max_readahead = std::min(max_readahead, budget_blocks);
+    } else {
+      // TODO Consider exposing readahead as a read option (ARROW-12090)
+      ARROW_ASSIGN_OR_RAISE(bg_it, MakeBackgroundGenerator(std::move(istream_it),
+                                                           io_context_.executor()));
+    }
 
     auto transferred_it = MakeTransferredGenerator(bg_it, cpu_executor);
 
     auto buffer_generator = CSVBufferIterator::MakeAsync(std::move(transferred_it));
 
-    int max_readahead = cpu_executor->GetCapacity();
     auto self = shared_from_this();
 
     return buffer_generator().Then([self, buffer_generator, max_readahead](
@@ -1141,6 +1161,132 @@ Future<std::shared_ptr<StreamingReader>> MakeStreamingReader(
   });
 }
 
+/////////////////////////////////////////////////////////////////////////
+// Multiple-input streaming reader implementation
+
+// Reads a sequence of inputs as one stream of record batches, in input order.
+// Readers for upcoming inputs are opened ahead of consumption, so their
+// parse and conversion tasks run on the CPU executor while the current
+// input drains; many small inputs then keep the executor as busy as the
+// blocks of a single large input would.
+class ConcatenatingStreamingReader
+    : public csv::StreamingReader,
+      public std::enable_shared_from_this<ConcatenatingStreamingReader> {
+ public:
+  ConcatenatingStreamingReader(std::shared_ptr<csv::StreamingReader> first,
+                               AsyncGenerator<std::shared_ptr<csv::StreamingReader>> rest)
+      : schema_(first->schema()), current_(std::move(first)), rest_(std::move(rest)) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  int64_t bytes_read() const override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return bytes_read_finished_ + (current_ ? current_->bytes_read() : 0);
+  }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    auto next_fut = ReadNextAsync();
+    auto next_result = next_fut.result();
+    return std::move(next_result).Value(batch);
+  }
+
+  Future<std::shared_ptr<RecordBatch>> ReadNextAsync() override {
+    std::shared_ptr<csv::StreamingReader> current;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      current = current_;
+    }
+    if (!current) {
+      // All inputs exhausted
+      return Future<std::shared_ptr<RecordBatch>>::MakeFinished(nullptr);
+    }
+    auto self = shared_from_this();
+    return current->ReadNextAsync().Then(
+        [self](const std::shared_ptr<RecordBatch>& batch)
+            -> Future<std::shared_ptr<RecordBatch>> {
+          if (batch) {
+            return batch;
+          }
+          return self->AdvanceInput();
+        });
+  }
+
+ protected:
+  Future<std::shared_ptr<RecordBatch>> AdvanceInput() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      bytes_read_finished_ += current_->bytes_read();
+      current_.reset();
+    }
+    auto self = shared_from_this();
+    return rest_().Then([self](const std::shared_ptr<csv::StreamingReader>& next)
+                            -> Future<std::shared_ptr<RecordBatch>> {
+      if (!next) {
+        return std::shared_ptr<RecordBatch>();
+      }
+      if (!next->schema()->Equals(*self->schema_)) {
+        return Status::Invalid("CSV inputs must have matching schemas: expected ",
+                               self->schema_->ToString(), " but got ",
+                               next->schema()->ToString());
+      }
+      {
+        std::lock_guard<std::mutex> lock(self->mutex_);
+        self->current_ = next;
+      }
+      return self->ReadNextAsync();
+    });
+  }
+
+  const std::shared_ptr<Schema> schema_;
+  mutable std::mutex mutex_;
+  std::shared_ptr<csv::StreamingReader> current_;
+  AsyncGenerator<std::shared_ptr<csv::StreamingReader>> rest_;
+  int64_t bytes_read_finished_ = 0;
+};
+
+Future<std::shared_ptr<StreamingReader>> MakeConcatenatedStreamingReader(
+    io::IOContext io_context, std::vector<std::shared_ptr<io::InputStream>> inputs,
+    Executor* cpu_executor, const ReadOptions& read_options,
+    const ParseOptions& parse_options, const ConvertOptions& convert_options) {
+  if (inputs.empty()) {
+    return Status::Invalid("Need at least one CSV input");
+  }
+  auto first_fut = MakeStreamingReader(io_context, std::move(inputs.front()),
+                                       cpu_executor, read_options, parse_options,
+                                       convert_options);
+  std::vector<std::shared_ptr<io::InputStream>> rest(
+      std::make_move_iterator(inputs.begin() + 1), std::make_move_iterator(inputs.end()));
+  return first_fut.Then(
+      [=, rest = std::move(rest)](const std::shared_ptr<StreamingReader>& first) mutable
+      -> Future<std::shared_ptr<StreamingReader>> {
+        if (rest.empty()) {
+          return first;
+        }
+        // Pin the types inferred from the first input, so the other inputs
+        // share its inference result instead of redoing (and possibly
+        // diverging on) their own.  Explicit user-provided types win.
+        auto pinned_options = convert_options;
+        for (const auto& field : first->schema()->fields()) {
+          pinned_options.column_types.emplace(field->name(), field->type());
+        }
+        std::function<Future<std::shared_ptr<StreamingReader>>(
+            const std::shared_ptr<io::InputStream>&)>
+            open_one = [=](const std::shared_ptr<io::InputStream>& input) {
+              return MakeStreamingReader(io_context, input, cpu_executor, read_options,
+                                         parse_options, pinned_options);
+            };
+        auto reader_gen =
+            MakeMappedGenerator(MakeVectorGenerator(std::move(rest)), std::move(open_one));
+        // Opening a reader starts parsing its first blocks, so reading ahead
+        // here is what schedules blocks from several inputs concurrently.
+        auto readahead_gen = MakeReadaheadGenerator(std::move(reader_gen),
+                                                    cpu_executor->GetCapacity());
+        return std::static_pointer_cast<StreamingReader>(
+            std::make_shared<ConcatenatingStreamingReader>(first,
+                                                           std::move(readahead_gen)));
+      });
+}
+
 /////////////////////////////////////////////////////////////////////////
 // Row count implementation
 
@@ -1237,6 +1383,27 @@ Future<std::shared_ptr<StreamingReader>> StreamingReader::MakeAsync(
                              parse_options, convert_options);
 }
 
+Future<std::shared_ptr<StreamingReader>> StreamingReader::MakeAsync(
+    io::IOContext io_context, std::vector<std::shared_ptr<io::InputStream>> inputs,
+    Executor* cpu_executor, const ReadOptions& read_options,
+    const ParseOptions& parse_options, const ConvertOptions& convert_options) {
+  return MakeConcatenatedStreamingReader(io_context, std::move(inputs), cpu_executor,
+                                         read_options, parse_options, convert_options);
+}
+
+Result<std::shared_ptr<StreamingReader>> StreamingReader::Make(
+    io::IOContext io_context, std::vector<std::shared_ptr<io::InputStream>> inputs,
+    const ReadOptions& read_options, const ParseOptions& parse_options,
+    const ConvertOptions& convert_options) {
+  auto cpu_executor = arrow::internal::GetCpuThreadPool();
+  auto reader_fut =
+      MakeConcatenatedStreamingReader(io_context, std::move(inputs), cpu_executor,
+                                      read_options, parse_options, convert_options);
+  auto reader_result = reader_fut.result();
+  ARROW_ASSIGN_OR_RAISE(auto reader, reader_result);
+  return reader;
+}
+
 Future<int64_t> CountRowsAsync(io::IOContext io_context,
                                std::shared_ptr<io::InputStream> input,
                                Executor* cpu_executor, const ReadOptions& read_options,
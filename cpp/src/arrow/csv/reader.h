@@ -18,6 +18,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "arrow/csv/options.h"  // IWYU pragma: keep
 #include "arrow/io/interfaces.h"
@@ -98,6 +99,27 @@ class ARROW_EXPORT StreamingReader : public RecordBatchReader {
   static Result<std::shared_ptr<StreamingReader>> Make(
       io::IOContext io_context, std::shared_ptr<io::InputStream> input,
       const ReadOptions&, const ParseOptions&, const ConvertOptions&);
+
+  /// \brief Create a StreamingReader over several inputs
+  ///
+  /// Batches are returned in input order.  The schema is inferred from the
+  /// first input and its column types are pinned for the remaining inputs,
+  /// which must all yield the same schema.  Readers for upcoming inputs are
+  /// opened ahead of consumption, scheduling their parse and conversion work
+  /// on the CPU executor concurrently with the input currently being read;
+  /// this keeps the executor saturated when the inputs are many small files.
+  static Future<std::shared_ptr<StreamingReader>> MakeAsync(
+      io::IOContext io_context, std::vector<std::shared_ptr<io::InputStream>> inputs,
+      arrow::internal::Executor* cpu_executor, const ReadOptions&, const ParseOptions&,
+      const ConvertOptions&);
+
+  /// \brief Create a StreamingReader over several inputs
+  ///
+  /// Synchronous version of the multiple-input MakeAsync, using the global
+  /// CPU thread pool.
+  static Result<std::shared_ptr<StreamingReader>> Make(
+      io::IOContext io_context, std::vector<std::shared_ptr<io::InputStream>> inputs,
+      const ReadOptions&, const ParseOptions&, const ConvertOptions&);
 };
 
 /// \brief Count the logical rows of data in a CSV file (i.e. the
@@ -401,6 +401,81 @@ TEST(StreamingReaderTests, BytesRead) {
   }
 }
 
+TEST(StreamingReaderTests, MemoryBudget) {
+  auto table_buffer =
+      std::make_shared<Buffer>("a,b,c\n123,456,789\n101,112,131\n415,161,718\n");
+
+  // A tight budget only throttles readahead; the decoded data is unchanged
+  auto input = std::make_shared<io::BufferReader>(table_buffer);
+  auto read_options = ReadOptions::Defaults();
+  read_options.block_size = 20;
+  read_options.memory_budget = 40;  // One raw block in flight
+  ASSERT_OK_AND_ASSIGN(
+      auto streaming_reader,
+      StreamingReader::Make(io::default_io_context(), input, read_options,
+                            ParseOptions::Defaults(), ConvertOptions::Defaults()));
+  std::shared_ptr<RecordBatch> batch;
+  int64_t num_rows = 0;
+  while (true) {
+    ASSERT_OK(streaming_reader->ReadNext(&batch));
+    if (!batch) break;
+    num_rows += batch->num_rows();
+  }
+  ASSERT_EQ(3, num_rows);
+
+  // A negative budget is rejected
+  read_options.memory_budget = -1;
+  ASSERT_RAISES(Invalid, read_options.Validate());
+}
+
+TEST(StreamingReaderTests, MultipleInputs) {
+  auto read_options = ReadOptions::Defaults();
+  read_options.block_size = 20;
+
+  // Batches come back in input order, with the schema inferred from the
+  // first input pinned for the others
+  std::vector<std::shared_ptr<io::InputStream>> inputs = {
+      std::make_shared<io::BufferReader>(std::make_shared<Buffer>("a,b\n1,2\n3,4\n")),
+      std::make_shared<io::BufferReader>(std::make_shared<Buffer>("a,b\n5,6\n")),
+      std::make_shared<io::BufferReader>(std::make_shared<Buffer>("a,b\n7,8\n9,10\n"))};
+  ASSERT_OK_AND_ASSIGN(
+      auto streaming_reader,
+      StreamingReader::Make(io::default_io_context(), inputs, read_options,
+                            ParseOptions::Defaults(), ConvertOptions::Defaults()));
+  std::shared_ptr<RecordBatch> batch;
+  RecordBatchVector batches;
+  while (true) {
+    ASSERT_OK(streaming_reader->ReadNext(&batch));
+    if (!batch) break;
+    ASSERT_TRUE(batch->schema()->Equals(*streaming_reader->schema()));
+    batches.push_back(batch);
+  }
+  ASSERT_OK_AND_ASSIGN(auto table,
+                       Table::FromRecordBatches(streaming_reader->schema(), batches));
+  auto expected = TableFromJSON(streaming_reader->schema(),
+                                {"[[1, 2], [3, 4], [5, 6], [7, 8], [9, 10]]"});
+  AssertTablesEqual(*expected, *table);
+  ASSERT_EQ(33, streaming_reader->bytes_read());
+
+  // Mismatching schemas surface as an error
+  inputs = {std::make_shared<io::BufferReader>(std::make_shared<Buffer>("a,b\n1,2\n")),
+            std::make_shared<io::BufferReader>(std::make_shared<Buffer>("a,c\n3,4\n"))};
+  ASSERT_OK_AND_ASSIGN(
+      streaming_reader,
+      StreamingReader::Make(io::default_io_context(), inputs, read_options,
+                            ParseOptions::Defaults(), ConvertOptions::Defaults()));
+  ASSERT_OK(streaming_reader->ReadNext(&batch));
+  ASSERT_NE(batch.get(), nullptr);
+  ASSERT_RAISES(Invalid, streaming_reader->ReadNext(&batch));
+
+  // At least one input is required
+  ASSERT_RAISES(Invalid, StreamingReader::Make(
+                             io::default_io_context(),
+                             std::vector<std::shared_ptr<io::InputStream>>{},
+                             read_options, ParseOptions::Defaults(),
+                             ConvertOptions::Defaults()));
+}
+
 TEST(StreamingReaderTests, SkipMultipleEmptyBlocksAtStart) {
   ASSERT_OK_AND_ASSIGN(auto thread_pool, internal::ThreadPool::Make(1));
   auto table_buffer = std::make_shared<Buffer>(
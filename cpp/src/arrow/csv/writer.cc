@@ -23,7 +23,9 @@
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/stl_allocator.h"
+#include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/visit_data_inline.h"
 #include "arrow/visit_type_inline.h"
@@ -489,6 +491,69 @@ Result<std::unique_ptr<ColumnPopulator>> MakePopulator(
                        pool);
 }
 
+Result<std::vector<std::unique_ptr<ColumnPopulator>>> MakeColumnPopulators(
+    const Schema& schema, const WriteOptions& options,
+    const std::shared_ptr<Buffer>& null_string) {
+  std::vector<std::unique_ptr<ColumnPopulator>> populators(schema.num_fields());
+  const std::string delimiter(1, options.delimiter);
+  for (int col = 0; col < schema.num_fields(); col++) {
+    const std::string& end_chars = col < schema.num_fields() - 1 ? delimiter : options.eol;
+    ARROW_ASSIGN_OR_RAISE(
+        populators[col],
+        MakePopulator(*schema.field(col), end_chars, options.delimiter, null_string,
+                      options.quoting_style, options.io_context.pool()));
+  }
+  return populators;
+}
+
+using OffsetsVector = std::vector<int64_t, arrow::stl::allocator<int64_t>>;
+
+// Stringify `batch` into `data_buffer` using the given populators.
+// `offsets` is scratch space reused across calls.
+Status FormatBatch(const RecordBatch& batch,
+                   const std::vector<std::unique_ptr<ColumnPopulator>>& populators,
+                   const WriteOptions& options, OffsetsVector* offsets_ptr,
+                   ResizableBuffer* data_buffer) {
+  if (batch.num_rows() == 0) {
+    return Status::OK();
+  }
+  OffsetsVector& offsets = *offsets_ptr;
+  offsets.resize(batch.num_rows());
+  std::fill(offsets.begin(), offsets.end(), 0);
+
+  // Calculate relative offsets for each row (excluding delimiters)
+  for (int32_t col = 0; col < static_cast<int32_t>(populators.size()); col++) {
+    RETURN_NOT_OK(populators[col]->UpdateRowLengths(*batch.column(col), offsets.data()));
+  }
+  // Calculate cumulative offsets for each row (including delimiters).
+  // - before conversion: offsets[i] = length of i-th row
+  // - after conversion:  offsets[i] = offset to the starting of i-th row buffer
+  //   - offsets[0] = 0
+  //   - offsets[i] = offsets[i-1] + len(i-1-th row) + len(delimiters)
+  // Delimiters: ',' * (num_columns - 1) + eol
+  const int32_t delimiters_length =
+      static_cast<int32_t>(batch.num_columns() - 1 + options.eol.size());
+  int64_t last_row_length = offsets[0] + delimiters_length;
+  offsets[0] = 0;
+  for (size_t row = 1; row < offsets.size(); ++row) {
+    const int64_t this_row_length = offsets[row] + delimiters_length;
+    offsets[row] = offsets[row - 1] + last_row_length;
+    last_row_length = this_row_length;
+  }
+  // Resize the target buffer to required size. We assume batch to batch sizes
+  // should be pretty close so don't shrink the buffer to avoid allocation churn.
+  RETURN_NOT_OK(
+      data_buffer->Resize(offsets.back() + last_row_length, /*shrink_to_fit=*/false));
+
+  // Use the offsets to populate contents.
+  for (auto& populator : populators) {
+    RETURN_NOT_OK(populator->PopulateRows(
+        reinterpret_cast<char*>(data_buffer->mutable_data()), offsets.data()));
+  }
+  DCHECK_EQ(data_buffer->size(), offsets.back());
+  return Status::OK();
+}
+
 class CSVWriterImpl : public ipc::RecordBatchWriter {
  public:
   static Result<std::shared_ptr<CSVWriterImpl>> Make(
@@ -505,18 +570,12 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     memcpy(null_string->mutable_data(), options.null_string.data(),
            options.null_string.length());
 
-    std::vector<std::unique_ptr<ColumnPopulator>> populators(schema->num_fields());
-    std::string delimiter(1, options.delimiter);
-    for (int col = 0; col < schema->num_fields(); col++) {
-      const std::string& end_chars =
-          col < schema->num_fields() - 1 ? delimiter : options.eol;
-      ARROW_ASSIGN_OR_RAISE(
-          populators[col],
-          MakePopulator(*schema->field(col), end_chars, options.delimiter, null_string,
-                        options.quoting_style, options.io_context.pool()));
-    }
-    auto writer = std::make_shared<CSVWriterImpl>(
-        sink, std::move(owned_sink), std::move(schema), std::move(populators), options);
+    std::vector<std::unique_ptr<ColumnPopulator>> populators;
+    ARROW_ASSIGN_OR_RAISE(populators,
+                          MakeColumnPopulators(*schema, options, null_string));
+    auto writer =
+        std::make_shared<CSVWriterImpl>(sink, std::move(owned_sink), std::move(schema),
+                                        std::move(populators), null_string, options);
     RETURN_NOT_OK(writer->PrepareForContentsWrite());
     if (options.include_header) {
       RETURN_NOT_OK(writer->WriteHeader());
@@ -526,6 +585,17 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
 
   Status WriteRecordBatch(const RecordBatch& batch) override {
     RecordBatchIterator iterator = RecordBatchSliceIterator(batch, options_.batch_size);
+    if (options_.use_threads) {
+      RecordBatchVector wave;
+      for (auto maybe_slice : iterator) {
+        ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> slice, maybe_slice);
+        wave.push_back(std::move(slice));
+        if (static_cast<int>(wave.size()) >= FormatWaveSize()) {
+          RETURN_NOT_OK(FormatAndWriteWave(&wave));
+        }
+      }
+      return FormatAndWriteWave(&wave);
+    }
     for (auto maybe_slice : iterator) {
       ARROW_ASSIGN_OR_RAISE(std::shared_ptr<RecordBatch> slice, maybe_slice);
       RETURN_NOT_OK(TranslateMinimalBatch(*slice));
@@ -540,6 +610,17 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
     reader.set_chunksize(max_chunksize > 0 ? max_chunksize : options_.batch_size);
     std::shared_ptr<RecordBatch> batch;
     RETURN_NOT_OK(reader.ReadNext(&batch));
+    if (options_.use_threads) {
+      RecordBatchVector wave;
+      while (batch != nullptr) {
+        wave.push_back(std::move(batch));
+        if (static_cast<int>(wave.size()) >= FormatWaveSize()) {
+          RETURN_NOT_OK(FormatAndWriteWave(&wave));
+        }
+        RETURN_NOT_OK(reader.ReadNext(&batch));
+      }
+      return FormatAndWriteWave(&wave);
+    }
     while (batch != nullptr) {
       RETURN_NOT_OK(TranslateMinimalBatch(*batch));
       RETURN_NOT_OK(sink_->Write(data_buffer_));
@@ -557,11 +638,12 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
   CSVWriterImpl(io::OutputStream* sink, std::shared_ptr<io::OutputStream> owned_sink,
                 std::shared_ptr<Schema> schema,
                 std::vector<std::unique_ptr<ColumnPopulator>> populators,
-                const WriteOptions& options)
+                std::shared_ptr<Buffer> null_string, const WriteOptions& options)
       : sink_(sink),
         owned_sink_(std::move(owned_sink)),
         column_populators_(std::move(populators)),
         offsets_(0, 0, ::arrow::stl::allocator<char*>(options.io_context.pool())),
+        null_string_(std::move(null_string)),
         schema_(std::move(schema)),
         options_(options) {}
 
@@ -610,44 +692,55 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
   }
 
   Status TranslateMinimalBatch(const RecordBatch& batch) {
-    if (batch.num_rows() == 0) {
-      return Status::OK();
-    }
-    offsets_.resize(batch.num_rows());
-    std::fill(offsets_.begin(), offsets_.end(), 0);
+    return FormatBatch(batch, column_populators_, options_, &offsets_,
+                       data_buffer_.get());
+  }
 
-    // Calculate relative offsets for each row (excluding delimiters)
-    for (int32_t col = 0; col < static_cast<int32_t>(column_populators_.size()); col++) {
-      RETURN_NOT_OK(
-          column_populators_[col]->UpdateRowLengths(*batch.column(col), offsets_.data()));
-    }
-    // Calculate cumulative offsets for each row (including delimiters).
-    // - before conversion: offsets_[i] = length of i-th row
-    // - after conversion:  offsets_[i] = offset to the starting of i-th row buffer
-    //   - offsets_[0] = 0
-    //   - offsets_[i] = offsets_[i-1] + len(i-1-th row) + len(delimiters)
-    // Delimiters: ',' * (num_columns - 1) + eol
-    const int32_t delimiters_length =
-        static_cast<int32_t>(batch.num_columns() - 1 + options_.eol.size());
-    int64_t last_row_length = offsets_[0] + delimiters_length;
-    offsets_[0] = 0;
-    for (size_t row = 1; row < offsets_.size(); ++row) {
-      const int64_t this_row_length = offsets_[row] + delimiters_length;
-      offsets_[row] = offsets_[row - 1] + last_row_length;
-      last_row_length = this_row_length;
+  int FormatWaveSize() const {
+    // Cap the number of batches formatted concurrently so that peak memory
+    // use stays proportional to the thread pool capacity
+    return std::max(1, ::arrow::internal::GetCpuThreadPool()->GetCapacity());
+  }
+
+  // Stringify the accumulated batches concurrently into per-batch buffers,
+  // then flush them to the sink in order with a single vectored write.
+  Status FormatAndWriteWave(RecordBatchVector* wave) {
+    auto* pool = ::arrow::internal::GetCpuThreadPool();
+    std::vector<Future<std::shared_ptr<Buffer>>> futures;
+    futures.reserve(wave->size());
+    for (const auto& batch : *wave) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto future,
+          pool->Submit([this, batch]() -> Result<std::shared_ptr<Buffer>> {
+            ARROW_ASSIGN_OR_RAISE(auto populators,
+                                  MakeColumnPopulators(*schema_, options_, null_string_));
+            OffsetsVector offsets(0, 0,
+                                  ::arrow::stl::allocator<int64_t>(
+                                      options_.io_context.pool()));
+            ARROW_ASSIGN_OR_RAISE(
+                auto buffer, AllocateResizableBuffer(0, options_.io_context.pool()));
+            RETURN_NOT_OK(
+                FormatBatch(*batch, populators, options_, &offsets, buffer.get()));
+            return std::shared_ptr<Buffer>(std::move(buffer));
+          }));
+      futures.push_back(std::move(future));
     }
-    // Resize the target buffer to required size. We assume batch to batch sizes
-    // should be pretty close so don't shrink the buffer to avoid allocation churn.
-    RETURN_NOT_OK(
-        data_buffer_->Resize(offsets_.back() + last_row_length, /*shrink_to_fit=*/false));
-
-    // Use the offsets to populate contents.
-    for (auto& populator : column_populators_) {
-      RETURN_NOT_OK(populator->PopulateRows(
-          reinterpret_cast<char*>(data_buffer_->mutable_data()), offsets_.data()));
+    std::vector<std::shared_ptr<Buffer>> buffers;
+    buffers.reserve(futures.size());
+    Status status;
+    for (auto& future : futures) {
+      auto maybe_buffer = future.result();
+      if (maybe_buffer.ok()) {
+        buffers.push_back(*std::move(maybe_buffer));
+      } else {
+        // Keep waiting on the remaining tasks (they reference `this`)
+        status &= maybe_buffer.status();
+      }
     }
-    DCHECK_EQ(data_buffer_->size(), offsets_.back());
-    return Status::OK();
+    RETURN_NOT_OK(status);
+    stats_.num_record_batches += static_cast<int64_t>(wave->size());
+    wave->clear();
+    return sink_->WriteV(buffers);
   }
 
   static constexpr int64_t kColumnSizeGuess = 8;
@@ -656,6 +749,7 @@ class CSVWriterImpl : public ipc::RecordBatchWriter {
   std::vector<std::unique_ptr<ColumnPopulator>> column_populators_;
   std::vector<int64_t, arrow::stl::allocator<int64_t>> offsets_;
   std::shared_ptr<ResizableBuffer> data_buffer_;
+  const std::shared_ptr<Buffer> null_string_;
   const std::shared_ptr<Schema> schema_;
   const WriteOptions options_;
   ipc::WriteStats stats_;
@@ -351,6 +351,13 @@ TEST_P(TestWriteCSV, TestWrite) {
     // The writer should work identically.
     ASSERT_OK_AND_ASSIGN(csv, ToCsvStringUsingWriter(*table, options));
     EXPECT_EQ(csv, GetParam().expected_output);
+
+    // Parallel formatting shouldn't change the output.
+    options.use_threads = true;
+    ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*record_batch, options));
+    EXPECT_EQ(csv, GetParam().expected_output);
+    ASSERT_OK_AND_ASSIGN(csv, ToCsvString(*table, options));
+    EXPECT_EQ(csv, GetParam().expected_output);
   }
 }
 
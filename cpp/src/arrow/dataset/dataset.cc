@@ -106,14 +106,21 @@ InMemoryFragment::InMemoryFragment(RecordBatchVector record_batches,
 Result<RecordBatchGenerator> InMemoryFragment::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& options) {
   struct State {
-    State(std::shared_ptr<InMemoryFragment> fragment, int64_t batch_size)
+    State(std::shared_ptr<InMemoryFragment> fragment, int64_t batch_size,
+          bool preserve_batches)
         : fragment(std::move(fragment)),
           batch_index(0),
           offset(0),
-          batch_size(batch_size) {}
+          batch_size(batch_size),
+          preserve_batches(preserve_batches) {}
 
     std::shared_ptr<RecordBatch> Next() {
       const auto& next_parent = fragment->record_batches_[batch_index];
+      if (preserve_batches) {
+        auto next = next_parent;
+        batch_index++;
+        return next;
+      }
       if (offset < next_parent->num_rows()) {
         auto next = next_parent->Slice(offset, batch_size);
         offset += batch_size;
@@ -130,11 +137,14 @@ Result<RecordBatchGenerator> InMemoryFragment::ScanBatchesAsync(
     std::size_t batch_index;
     int64_t offset;
     int64_t batch_size;
+    bool preserve_batches;
   };
 
   struct Generator {
-    Generator(std::shared_ptr<InMemoryFragment> fragment, int64_t batch_size)
-        : state(std::make_shared<State>(std::move(fragment), batch_size)) {}
+    Generator(std::shared_ptr<InMemoryFragment> fragment, int64_t batch_size,
+              bool preserve_batches)
+        : state(std::make_shared<State>(std::move(fragment), batch_size,
+                                        preserve_batches)) {}
 
     Future<std::shared_ptr<RecordBatch>> operator()() {
       while (!state->Finished()) {
@@ -148,8 +158,14 @@ Result<RecordBatchGenerator> InMemoryFragment::ScanBatchesAsync(
 
     std::shared_ptr<State> state;
   };
-  return Generator(checked_pointer_cast<InMemoryFragment>(shared_from_this()),
-                   options->batch_size);
+  RecordBatchGenerator generator =
+      Generator(checked_pointer_cast<InMemoryFragment>(shared_from_this()),
+                options->batch_size, options->preserve_fragment_batches);
+  if (options->pushdown_projection) {
+    return MakeProjectedBatchGenerator(std::move(generator), options,
+                                       partition_expression_);
+  }
+  return generator;
 }
 
 Future<std::optional<int64_t>> InMemoryFragment::CountRows(
@@ -27,6 +27,7 @@
 #include <vector>
 
 #include "arrow/compute/expression.h"
+#include "arrow/compute/ordering.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/dataset/visibility.h"
 #include "arrow/util/async_generator_fwd.h"
@@ -392,6 +393,17 @@ class ARROW_DS_EXPORT Dataset : public std::enable_shared_from_this<Dataset> {
   /// \brief Rules used by this dataset to handle schema evolution
   DatasetEvolutionStrategy* evolution_strategy() { return evolution_strategy_.get(); }
 
+  /// \brief The declared ordering of the rows within each fragment
+  ///
+  /// Unordered by default.  Datasets whose fragments were written sorted
+  /// (e.g. by a timestamp column) can declare that ordering so an
+  /// order-preserving scan can merge fragment streams instead of re-sorting.
+  /// The declaration is trusted, not verified against the data.
+  const compute::Ordering& ordering() const { return ordering_; }
+
+  /// \brief Declare the ordering of the rows within each fragment
+  void set_ordering(compute::Ordering ordering) { ordering_ = std::move(ordering); }
+
   virtual ~Dataset() = default;
 
  protected:
@@ -415,6 +427,7 @@ class ARROW_DS_EXPORT Dataset : public std::enable_shared_from_this<Dataset> {
 
   std::shared_ptr<Schema> schema_;
   compute::Expression partition_expression_ = compute::literal(true);
+  compute::Ordering ordering_ = compute::Ordering::Unordered();
   std::unique_ptr<DatasetEvolutionStrategy> evolution_strategy_ =
       MakeBasicDatasetEvolutionStrategy();
 };
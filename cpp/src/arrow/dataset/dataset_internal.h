@@ -133,6 +133,16 @@ class FragmentDataset : public Dataset {
   AsyncGenerator<std::shared_ptr<Fragment>> fragment_gen_;
 };
 
+/// \brief Wrap a fragment's batch generator so each decoded batch is filtered
+/// and projected before it is emitted (see ScanOptions::pushdown_projection).
+///
+/// The scan options must carry a bound projection and a projected schema;
+/// emitted batches match the projected schema.  The partition expression is
+/// used to simplify the filter and to materialize partition columns.
+Result<RecordBatchGenerator> MakeProjectedBatchGenerator(
+    RecordBatchGenerator gen, const std::shared_ptr<ScanOptions>& options,
+    compute::Expression partition_expression);
+
 // Given a record batch generator, creates a new generator that slices
 // batches so individual batches have at most batch_size rows. The
 // resulting generator is async-reentrant, but does not forward
@@ -156,5 +166,17 @@ inline RecordBatchGenerator MakeChunkedBatchGenerator(RecordBatchGenerator gen,
       });
 }
 
+// Applies MakeChunkedBatchGenerator unless the scan declared that its
+// consumers accept arbitrary batch sizes, in which case batches are
+// forwarded as-is (ScanOptions::preserve_fragment_batches).
+inline RecordBatchGenerator MaybeChunkBatchGenerator(RecordBatchGenerator gen,
+                                                     int64_t batch_size,
+                                                     bool preserve_fragment_batches) {
+  if (preserve_fragment_batches) {
+    return gen;
+  }
+  return MakeChunkedBatchGenerator(std::move(gen), batch_size);
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -284,7 +284,7 @@ class DatasetWriterDirectoryQueue {
       bool* will_open_file) const {
     DCHECK_GT(batch->num_rows(), 0);
     uint64_t rows_available = std::numeric_limits<uint64_t>::max();
-    *will_open_file = rows_written_ == 0;
+    *will_open_file = latest_open_file_ == nullptr;
     if (write_options_.max_rows_per_file > 0) {
       rows_available = write_options_.max_rows_per_file - rows_written_;
     }
@@ -305,9 +305,29 @@ class DatasetWriterDirectoryQueue {
     if (!latest_open_file_) {
       ARROW_RETURN_NOT_OK(OpenFileQueue(current_filename_));
     }
+    if (!staged_batches_.empty()) {
+      ARROW_RETURN_NOT_OK(FlushStagedToOpenFile());
+    }
     return latest_open_file_->Push(batch);
   }
 
+  /// True if `num_rows` more rows can be buffered without paying for a file
+  /// handle yet.  Small partitions accumulate rows until there is at least a
+  /// row group's worth, so a high-cardinality write doesn't thrash
+  /// max_open_files with tiny files.
+  bool CanStageBeforeOpen(uint64_t num_rows) const {
+    return latest_open_file_ == nullptr && !writer_state_->StagingFull() &&
+           staged_rows_before_open_ + num_rows < write_options_.min_rows_per_group;
+  }
+
+  Status StageBeforeOpen(std::shared_ptr<RecordBatch> batch) {
+    rows_written_ += batch->num_rows();
+    staged_rows_before_open_ += batch->num_rows();
+    writer_state_->staged_rows_count += batch->num_rows();
+    staged_batches_.push_back(std::move(batch));
+    return Status::OK();
+  }
+
   Result<std::string> GetNextFilename() {
     std::optional<std::string> basename;
     if (write_options_.basename_template_functor == nullptr) {
@@ -348,8 +368,11 @@ class DatasetWriterDirectoryQueue {
       writer_state_->open_files_throttle.Release(1);
       return Status::OK();
     };
-    latest_open_file_tasks_ = util::MakeThrottledAsyncTaskGroup(
-        scheduler_, 1, /*queue=*/nullptr, std::move(file_finish_task));
+    util::AsyncTaskScopeOptions file_scope_options;
+    file_scope_options.max_concurrent_cost = 1;
+    file_scope_options.finish_callback = std::move(file_finish_task);
+    latest_open_file_tasks_ =
+        util::AsyncTaskScope::Make(scheduler_, std::move(file_scope_options));
     if (init_future_.is_valid()) {
       latest_open_file_tasks_->AddSimpleTask(
           [init_future = init_future_]() { return init_future; },
@@ -361,6 +384,19 @@ class DatasetWriterDirectoryQueue {
 
   uint64_t rows_written() const { return rows_written_; }
 
+  bool has_open_file() const { return latest_open_file_ != nullptr; }
+
+  /// True if finishing this queue will have to open a file (and therefore
+  /// needs an open-file slot) because rows were buffered but never flushed.
+  bool RequiresOpenFileSlotToFinish() const {
+    return latest_open_file_ == nullptr && !staged_batches_.empty();
+  }
+
+  uint64_t last_write_index() const { return last_write_index_; }
+  void set_last_write_index(uint64_t last_write_index) {
+    last_write_index_ = last_write_index;
+  }
+
   void PrepareDirectory() {
     if (directory_.empty() || !write_options_.create_dir) {
       return;
@@ -412,6 +448,12 @@ class DatasetWriterDirectoryQueue {
   }
 
   Status Finish() {
+    if (!staged_batches_.empty()) {
+      if (!latest_open_file_) {
+        ARROW_RETURN_NOT_OK(OpenFileQueue(current_filename_));
+      }
+      ARROW_RETURN_NOT_OK(FlushStagedToOpenFile());
+    }
     if (latest_open_file_) {
       ARROW_RETURN_NOT_OK(latest_open_file_->Finish());
       latest_open_file_tasks_.reset();
@@ -422,6 +464,17 @@ class DatasetWriterDirectoryQueue {
   }
 
  private:
+  Status FlushStagedToOpenFile() {
+    // The file queue re-counts whatever it keeps staged for row group sizing
+    writer_state_->staged_rows_count -= staged_rows_before_open_;
+    staged_rows_before_open_ = 0;
+    while (!staged_batches_.empty()) {
+      ARROW_RETURN_NOT_OK(latest_open_file_->Push(std::move(staged_batches_.front())));
+      staged_batches_.pop_front();
+    }
+    return Status::OK();
+  }
+
   util::AsyncTaskScheduler* scheduler_ = nullptr;
   std::string directory_;
   std::string prefix_;
@@ -433,8 +486,13 @@ class DatasetWriterDirectoryQueue {
   std::unordered_set<std::string> used_filenames_;
   DatasetWriterFileQueue* latest_open_file_ = nullptr;
   std::unique_ptr<util::ThrottledAsyncTaskScheduler> latest_open_file_tasks_;
+  // Batches buffered for this directory before its file is opened.  The rows
+  // hold in-flight permits but no file handle.
+  std::deque<std::shared_ptr<RecordBatch>> staged_batches_;
+  uint64_t staged_rows_before_open_ = 0;
   uint64_t rows_written_ = 0;
   uint32_t file_counter_ = 0;
+  uint64_t last_write_index_ = 0;
 };
 
 Status ValidateBasenameTemplate(std::string_view basename_template) {
@@ -513,12 +571,15 @@ class DatasetWriter::DatasetWriterImpl {
                     std::function<void()> resume_callback,
                     std::function<void()> finish_callback, uint64_t max_rows_queued)
       : scheduler_(scheduler),
-        write_tasks_(util::MakeThrottledAsyncTaskGroup(
-            scheduler_, /*max_concurrent_cost=*/1, /*queue=*/nullptr,
-            [finish_callback = std::move(finish_callback)] {
-              finish_callback();
-              return Status::OK();
-            })),
+        write_tasks_([&, finish_callback = std::move(finish_callback)]() mutable {
+          util::AsyncTaskScopeOptions options;
+          options.max_concurrent_cost = 1;
+          options.finish_callback = [finish_callback = std::move(finish_callback)] {
+            finish_callback();
+            return Status::OK();
+          };
+          return util::AsyncTaskScope::Make(scheduler_, std::move(options));
+        }()),
         write_options_(std::move(write_options)),
         writer_state_(max_rows_queued, write_options_.max_open_files,
                       CalculateMaxRowsStaged(max_rows_queued)),
@@ -582,12 +643,20 @@ class DatasetWriter::DatasetWriterImpl {
   void Finish() {
     write_tasks_->AddSimpleTask(
         [this]() -> Result<Future<>> {
+          // Directories that only buffered rows still need to open a file and
+          // must wait for open-file slots like everybody else; everything
+          // already open just finalizes.  The per-file finish tasks run
+          // concurrently on the scheduler either way.
+          auto pending_opens = std::make_shared<
+              std::deque<std::shared_ptr<DatasetWriterDirectoryQueue>>>();
           for (const auto& directory_queue : directory_queues_) {
-            ARROW_RETURN_NOT_OK(directory_queue.second->Finish());
+            if (directory_queue.second->RequiresOpenFileSlotToFinish()) {
+              pending_opens->push_back(directory_queue.second);
+            } else {
+              ARROW_RETURN_NOT_OK(directory_queue.second->Finish());
+            }
           }
-          // This task is purely synchronous but we add it to write_tasks_ for the
-          // throttling task group benefits.
-          return Future<>::MakeFinished();
+          return FinishPendingOpens(std::move(pending_opens));
         },
         "DatasetWriter::FinishAll"sv);
     // Reset write_tasks_ to signal that we are done adding tasks, this will allow
@@ -597,20 +666,44 @@ class DatasetWriter::DatasetWriterImpl {
   }
 
  protected:
-  Status TryCloseLargestFile() {
-    std::shared_ptr<DatasetWriterDirectoryQueue> largest = nullptr;
-    uint64_t largest_num_rows = 0;
+  // Flush the buffered-only directories one at a time as open-file slots free
+  // up.  The slots are released by the finish tasks of earlier files, which
+  // run concurrently, so this chain drains at the speed of file finalization.
+  Future<> FinishPendingOpens(
+      std::shared_ptr<std::deque<std::shared_ptr<DatasetWriterDirectoryQueue>>>
+          pending_opens) {
+    while (!pending_opens->empty()) {
+      Future<> slot_available = writer_state_.open_files_throttle.Acquire(1);
+      if (!slot_available.is_finished()) {
+        return slot_available.Then([this, pending_opens]() mutable {
+          return FinishPendingOpens(std::move(pending_opens));
+        });
+      }
+      std::shared_ptr<DatasetWriterDirectoryQueue> next =
+          std::move(pending_opens->front());
+      pending_opens->pop_front();
+      RETURN_NOT_OK(next->Finish());
+    }
+    return Future<>::MakeFinished();
+  }
+
+  Status TryCloseLruFile() {
+    // Recycle the handle of the file written to least recently; hot
+    // partitions keep their handles while cold ones give theirs up
+    std::shared_ptr<DatasetWriterDirectoryQueue> lru = nullptr;
+    uint64_t lru_index = std::numeric_limits<uint64_t>::max();
     for (auto& dir_queue : directory_queues_) {
-      if (dir_queue.second->rows_written() > largest_num_rows) {
-        largest_num_rows = dir_queue.second->rows_written();
-        largest = dir_queue.second;
+      if (dir_queue.second->has_open_file() &&
+          dir_queue.second->last_write_index() < lru_index) {
+        lru_index = dir_queue.second->last_write_index();
+        lru = dir_queue.second;
       }
     }
-    if (largest == nullptr) {
-      // GH-38011: If all written files has written 0 rows, we should not close any file
+    if (lru == nullptr) {
+      // GH-38011: If no file is actually open there is nothing to close
       return Status::OK();
     }
-    return largest->FinishCurrentFile();
+    return lru->FinishCurrentFile();
   }
 
   Future<> DoWriteRecordBatch(std::shared_ptr<RecordBatch> batch,
@@ -648,12 +741,19 @@ class DatasetWriter::DatasetWriterImpl {
         EVENT_ON_CURRENT_SPAN("DatasetWriter::Backpressure::TooManyRowsQueued");
         break;
       }
+      if (!remainder && dir_queue->CanStageBeforeOpen(next_chunk->num_rows())) {
+        // Buffer the rows instead of opening a file; the handle is only paid
+        // for once a row group's worth of data has accumulated (or at Finish)
+        RETURN_NOT_OK(dir_queue->StageBeforeOpen(std::move(next_chunk)));
+        dir_queue->set_last_write_index(write_counter_++);
+        return Future<>::MakeFinished();
+      }
       if (will_open_file) {
         backpressure = writer_state_.open_files_throttle.Acquire(1);
         if (!backpressure.is_finished()) {
           EVENT_ON_CURRENT_SPAN("DatasetWriter::Backpressure::TooManyOpenFiles");
           writer_state_.rows_in_flight_throttle.Release(next_chunk->num_rows());
-          RETURN_NOT_OK(TryCloseLargestFile());
+          RETURN_NOT_OK(TryCloseLruFile());
           break;
         }
       }
@@ -667,6 +767,7 @@ class DatasetWriter::DatasetWriterImpl {
         writer_state_.rows_in_flight_throttle.Release(next_chunk->num_rows());
         return s;
       }
+      dir_queue->set_last_write_index(write_counter_++);
       batch = std::move(remainder);
       if (batch) {
         RETURN_NOT_OK(dir_queue->FinishCurrentFile());
@@ -693,6 +794,9 @@ class DatasetWriter::DatasetWriterImpl {
       directory_queues_;
   std::mutex mutex_;
   bool paused_ = false;
+  // Monotonic counter stamping directory queues on each write, used to pick
+  // the least recently used file when open-file slots run out
+  uint64_t write_counter_ = 0;
   Status err_;
 };
 
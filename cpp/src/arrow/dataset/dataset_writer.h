@@ -37,6 +37,12 @@ constexpr uint64_t kDefaultDatasetWriterMaxRowsQueued = 8 * 1024 * 1024;
 /// Writers may be closed and reopened (and a new file created) based on the dataset
 /// write options (for example, max_rows_per_file or max_open_files)
 ///
+/// When min_rows_per_group is set, rows for a partition are buffered in memory until
+/// there is at least a row group's worth before a file is opened for it, and when
+/// max_open_files is exceeded the least recently written file is closed.  Together
+/// these keep high-cardinality partitioned writes from thrashing file open/close
+/// cycles.
+///
 /// The dataset writer enforces its own back pressure based on the # of rows (as opposed
 /// to # of batches which is how it is typically enforced elsewhere) and # of files.
 class ARROW_DS_EXPORT DatasetWriter {
@@ -403,6 +403,58 @@ TEST_F(DatasetWriterTestFixture, MinAndMaxRowGroup) {
   AssertCreatedData({{"testdir/chunk-0.arrow", 0, 60, 6}});
 }
 
+TEST_F(DatasetWriterTestFixture, BufferSmallPartitionsBeforeOpen) {
+  // Rows for a partition are buffered until there is a row group's worth, so
+  // many small partitions can be written with only a few open-file slots and
+  // without closing and reopening files.
+  write_options_.min_rows_per_group = 10;
+  write_options_.max_open_files = 2;
+  auto dataset_writer = MakeDatasetWriter();
+  std::vector<ExpectedFile> expected_files;
+  for (int i = 0; i < 4; i++) {
+    expected_files.push_back({"testdir/" + std::to_string(i) + "/chunk-0.arrow",
+                              static_cast<uint64_t>(i * 10), 10, 1});
+    dataset_writer->WriteRecordBatch(MakeBatch(5), std::to_string(i));
+    dataset_writer->WriteRecordBatch(MakeBatch(5), std::to_string(i));
+  }
+  EndWriterChecked(dataset_writer.get());
+  AssertCreatedData(expected_files);
+}
+
+TEST_F(DatasetWriterTestFixture, BufferedPartitionsFlushedAtFinish) {
+  // Partitions that never accumulate a full row group still get their file,
+  // written out when the dataset writer finishes.
+  write_options_.min_rows_per_group = 10;
+  write_options_.max_open_files = 2;
+  auto dataset_writer = MakeDatasetWriter();
+  std::vector<ExpectedFile> expected_files;
+  for (int i = 0; i < 5; i++) {
+    expected_files.push_back({"testdir/" + std::to_string(i) + "/chunk-0.arrow",
+                              static_cast<uint64_t>(i * 4), 4, 1});
+    dataset_writer->WriteRecordBatch(MakeBatch(4), std::to_string(i));
+  }
+  EndWriterChecked(dataset_writer.get());
+  AssertCreatedData(expected_files);
+}
+
+TEST_F(DatasetWriterTestFixture, CloseLeastRecentlyUsedFile) {
+  // When open-file slots run out the least recently written file is closed;
+  // returning to that partition later starts a new file.
+  write_options_.max_open_files = 2;
+  auto dataset_writer = MakeDatasetWriter();
+  dataset_writer->WriteRecordBatch(MakeBatch(10), "0");
+  dataset_writer->WriteRecordBatch(MakeBatch(10), "1");
+  // Opening "2" must recycle the handle of "0", the least recently written
+  dataset_writer->WriteRecordBatch(MakeBatch(10), "2");
+  // Returning to "0" recycles "1" and opens a second file
+  dataset_writer->WriteRecordBatch(MakeBatch(10), "0");
+  EndWriterChecked(dataset_writer.get());
+  AssertCreatedData({{"testdir/0/chunk-0.arrow", 0, 10, 1},
+                     {"testdir/1/chunk-0.arrow", 10, 10, 1},
+                     {"testdir/2/chunk-0.arrow", 20, 10, 1},
+                     {"testdir/0/chunk-1.arrow", 30, 10, 1}});
+}
+
 TEST_F(DatasetWriterTestFixture, MinRowGroupBackpressure) {
   // This tests the case where we end up queuing too much data because we're waiting for
   // enough data to form a min row group and we fill up the dataset writer (it should
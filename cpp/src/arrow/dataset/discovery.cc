@@ -169,6 +169,60 @@ bool StartsWithAnyOf(const std::string& path, const std::vector<std::string>& pr
   });
 }
 
+// Refresh a previous discovery snapshot by re-listing only the prefixes the
+// caller knows to have changed.  Entries of the snapshot outside the changed
+// prefixes are reused verbatim, so a refresh of a large tree only pays for
+// the churned subtrees.
+Result<std::vector<fs::FileInfo>> ReconcileSnapshot(
+    fs::FileSystem& filesystem, const fs::FileSelector& selector,
+    const FileSystemFactoryOptions& options) {
+  // Anchor relative prefixes at the selector's base directory
+  std::vector<std::string> prefixes;
+  prefixes.reserve(options.changed_prefixes.size());
+  for (const auto& prefix : options.changed_prefixes) {
+    std::string absolute =
+        fs::internal::IsAncestorOf(selector.base_dir, prefix) || selector.base_dir.empty()
+            ? prefix
+            : fs::internal::ConcatAbstractPath(selector.base_dir, prefix);
+    ARROW_ASSIGN_OR_RAISE(absolute, filesystem.NormalizePath(std::move(absolute)));
+    prefixes.push_back(std::move(absolute));
+  }
+
+  auto in_changed_prefix = [&](const std::string& path) {
+    return std::any_of(prefixes.begin(), prefixes.end(), [&](const std::string& prefix) {
+      return path == prefix || fs::internal::IsAncestorOf(prefix, path);
+    });
+  };
+
+  // Keep every snapshot entry that cannot have changed
+  std::vector<fs::FileInfo> files;
+  files.reserve(options.previous_snapshot.size());
+  for (const fs::FileInfo& info : options.previous_snapshot) {
+    if (!in_changed_prefix(info.path())) {
+      files.push_back(info);
+    }
+  }
+
+  // Re-list the changed subtrees; a vanished prefix simply contributes nothing
+  for (const std::string& prefix : prefixes) {
+    ARROW_ASSIGN_OR_RAISE(fs::FileInfo prefix_info, filesystem.GetFileInfo(prefix));
+    if (prefix_info.IsFile()) {
+      files.push_back(std::move(prefix_info));
+      continue;
+    }
+    if (prefix_info.type() == fs::FileType::NotFound) {
+      continue;
+    }
+    fs::FileSelector sub_selector = selector;
+    sub_selector.base_dir = prefix;
+    ARROW_ASSIGN_OR_RAISE(std::vector<fs::FileInfo> changed,
+                          filesystem.GetFileInfo(sub_selector));
+    files.insert(files.end(), std::make_move_iterator(changed.begin()),
+                 std::make_move_iterator(changed.end()));
+  }
+  return files;
+}
+
 Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
     std::shared_ptr<fs::FileSystem> filesystem, fs::FileSelector selector,
     std::shared_ptr<FileFormat> format, FileSystemFactoryOptions options) {
@@ -180,7 +234,12 @@ Result<std::shared_ptr<DatasetFactory>> FileSystemDatasetFactory::Make(
   }
 
   ARROW_ASSIGN_OR_RAISE(selector.base_dir, filesystem->NormalizePath(selector.base_dir));
-  ARROW_ASSIGN_OR_RAISE(auto files, filesystem->GetFileInfo(selector));
+  std::vector<fs::FileInfo> files;
+  if (options.previous_snapshot.empty()) {
+    ARROW_ASSIGN_OR_RAISE(files, filesystem->GetFileInfo(selector));
+  } else {
+    ARROW_ASSIGN_OR_RAISE(files, ReconcileSnapshot(*filesystem, selector, options));
+  }
 
   // Filter out anything that's not a file or that's explicitly ignored
   Status st;
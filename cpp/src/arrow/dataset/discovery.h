@@ -196,6 +196,28 @@ struct FileSystemFactoryOptions {
       ".",
       "_",
   };
+
+  /// \brief File infos from a previous discovery of the same tree
+  ///
+  /// When non-empty, selector-based discovery becomes incremental: only the
+  /// paths in changed_prefixes are re-listed and every snapshot entry outside
+  /// of those prefixes is reused without touching the filesystem.  A snapshot
+  /// can be rebuilt from an existing dataset via the fragments' file infos
+  /// (FileSource::file_info).
+  ///
+  /// The caller is responsible for supplying a complete set of changed
+  /// prefixes (e.g. from an S3 inventory diff or a local file watcher);
+  /// changes outside of them go unnoticed until the next full discovery.
+  ///
+  /// Ignored when discovering from an explicit file list.
+  std::vector<fs::FileInfo> previous_snapshot;
+
+  /// \brief Paths whose subtrees changed since previous_snapshot was taken
+  ///
+  /// Entries may be absolute or relative to the selector's base directory.
+  /// Each prefix is re-listed recursively; a prefix naming a file is stat'ed
+  /// directly.  Only consulted when previous_snapshot is non-empty.
+  std::vector<std::string> changed_prefixes;
 };
 
 /// \brief FileSystemDatasetFactory creates a Dataset from a vector of
@@ -179,6 +179,25 @@ TEST_F(FileSystemDatasetFactoryTest, Selector) {
   AssertFinishWithPaths({"A/a", "A/A/a"});
 }
 
+TEST_F(FileSystemDatasetFactoryTest, IncrementalDiscovery) {
+  selector_.base_dir = "A";
+  selector_.recursive = true;
+
+  // The snapshot reflects a previous discovery; since then "A/B" gained a
+  // file, "A/C" was removed entirely and "A/a" is untouched.
+  factory_options_.previous_snapshot = {fs::File("A/a"), fs::File("A/B/old"),
+                                        fs::File("A/C/gone")};
+  factory_options_.changed_prefixes = {"B", "A/C"};
+  MakeFactory({fs::File("A/a"), fs::File("A/B/old"), fs::File("A/B/new")});
+  AssertFinishWithPaths({"A/B/new", "A/B/old", "A/a"});
+
+  // A changed prefix naming a file is stat'ed directly
+  factory_options_.previous_snapshot = {fs::File("A/a"), fs::File("A/b")};
+  factory_options_.changed_prefixes = {"b"};
+  MakeFactory({fs::File("A/a"), fs::File("A/b")});
+  AssertFinishWithPaths({"A/a", "A/b"});
+}
+
 TEST_F(FileSystemDatasetFactoryTest, ExplicitPartition) {
   selector_.base_dir = "a=ignored/base";
   auto part_field = field("a", int32());
@@ -22,6 +22,7 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <sstream>
 #include <unordered_map>
 #include <variant>
 #include <vector>
@@ -30,6 +31,8 @@
 #include "arrow/acero/query_context.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/api_scalar.h"
+#include "arrow/compute/cast.h"
+#include "arrow/compute/expression_internal.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/dataset_writer.h"
 #include "arrow/dataset/forest_internal.h"
@@ -41,6 +44,7 @@
 #include "arrow/io/compressed.h"
 #include "arrow/io/interfaces.h"
 #include "arrow/io/memory.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/iterator.h"
@@ -184,10 +188,114 @@ Result<std::shared_ptr<Schema>> FileFragment::ReadPhysicalSchemaImpl() {
   return format_->Inspect(source_);
 }
 
+namespace {
+
+// Identify a (fragment, scan shape) pair for the fragment result cache.  Only
+// path-backed sources have a stable identity; everything else is not cached.
+std::optional<std::string> FragmentCacheKey(const FileSource& source,
+                                            const ScanOptions& options) {
+  if (source.filesystem() == nullptr) {
+    return std::nullopt;
+  }
+  const fs::FileInfo& file_info = source.file_info();
+  std::stringstream key;
+  key << file_info.path() << '|' << file_info.size() << '|'
+      << file_info.mtime().time_since_epoch().count() << '|' << options.batch_size
+      << '|' << options.pushdown_projection << '|' << options.filter.ToString() << '|'
+      << options.projection.ToString();
+  return key.str();
+}
+
+// Pass batches through unchanged while collecting them; once the source is
+// exhausted, the complete fragment result is offered to the cache.  A scan
+// that stops early never inserts a partial result.
+struct CachingGenerator {
+  struct State {
+    RecordBatchGenerator source;
+    std::shared_ptr<FragmentResultCache> cache;
+    std::string key;
+    RecordBatchVector batches;
+  };
+
+  Future<std::shared_ptr<RecordBatch>> operator()() {
+    auto state = state_;
+    return state->source().Then(
+        [state](const std::shared_ptr<RecordBatch>& batch)
+            -> std::shared_ptr<RecordBatch> {
+          if (IsIterationEnd(batch)) {
+            state->cache->Insert(state->key, std::move(state->batches));
+          } else {
+            state->batches.push_back(batch);
+          }
+          return batch;
+        });
+  }
+
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace
+
+std::pair<compute::Expression, compute::Expression> SplitFilterForOffload(
+    const compute::Expression& filter, const ScanOffloadProvider& provider) {
+  std::vector<compute::Expression> members;
+  const auto* filter_call = filter.call();
+  if (filter_call != nullptr && filter_call->function_name == "and_kleene") {
+    members = compute::FlattenedAssociativeChain(filter).fringe;
+  } else {
+    members = {filter};
+  }
+
+  std::vector<compute::Expression> offloadable, local;
+  for (auto& member : members) {
+    if (provider.CanOffloadPredicate(member)) {
+      offloadable.push_back(std::move(member));
+    } else {
+      local.push_back(std::move(member));
+    }
+  }
+  return {compute::and_(std::move(offloadable)), compute::and_(std::move(local))};
+}
+
 Result<RecordBatchGenerator> FileFragment::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& options) {
   auto self = std::dynamic_pointer_cast<FileFragment>(shared_from_this());
-  return format_->ScanBatchesAsync(options, self);
+  std::optional<std::string> key;
+  if (options->fragment_cache) {
+    key = FragmentCacheKey(source_, *options);
+    if (key.has_value()) {
+      if (auto cached = options->fragment_cache->Get(*key)) {
+        return MakeVectorGenerator(std::move(*cached));
+      }
+    }
+  }
+  RecordBatchGenerator generator;
+  if (format_->scan_offload_provider != nullptr &&
+      options->filter != compute::literal(true)) {
+    auto split = SplitFilterForOffload(options->filter, *format_->scan_offload_provider);
+    if (split.first != compute::literal(true)) {
+      // At least part of the filter can run remotely; the scanner re-applies
+      // the full filter locally so the residual part needs no special handling
+      ARROW_ASSIGN_OR_RAISE(generator, format_->scan_offload_provider->ScanOffloaded(
+                                           options, self, std::move(split.first)));
+    }
+  }
+  if (!generator) {
+    ARROW_ASSIGN_OR_RAISE(generator, format_->ScanBatchesAsync(options, self));
+  }
+  if (options->pushdown_projection) {
+    // Filter and project before the readahead queues (and before the cache,
+    // so cached results are the smaller projected batches).
+    ARROW_ASSIGN_OR_RAISE(
+        generator, MakeProjectedBatchGenerator(std::move(generator), options,
+                                               partition_expression_));
+  }
+  if (key.has_value()) {
+    auto state = std::make_shared<CachingGenerator::State>(CachingGenerator::State{
+        std::move(generator), options->fragment_cache, std::move(*key), {}});
+    return CachingGenerator{std::move(state)};
+  }
+  return generator;
 }
 
 Future<std::shared_ptr<InspectedFragment>> FileFragment::InspectFragment(
@@ -232,6 +340,46 @@ struct FileSystemDataset::FragmentSubtrees {
   std::vector<std::variant<int, compute::Expression>> fragments_and_subtrees;
 };
 
+// Hash index over the scalar equalities in the fragments' partition
+// expressions.  For a predicate pinning a partition field to a value this
+// narrows fragment selection to the matching fragments (plus any fragments
+// that don't pin that field at all) without walking every fragment.
+struct FileSystemDataset::PartitionIndex {
+  struct FieldIndex {
+    // Fragment indices keyed by the canonical string of the partition value
+    std::unordered_map<std::string, std::vector<int>> by_value;
+    // Fragments whose guarantee doesn't pin this field to a single value.
+    // These can match any predicate value and are always candidates.
+    std::vector<int> unconstrained;
+  };
+
+  // Keyed by FieldRef::ToString() of the partition field
+  std::unordered_map<std::string, FieldIndex> fields;
+};
+
+namespace {
+
+// Canonicalize a partition value for use as an index key by casting it to the
+// dataset schema's type for the field.  Returns nullopt if the value cannot
+// be canonicalized; such values are never indexed.
+std::optional<std::string> PartitionValueKey(const Datum& value, const FieldRef& ref,
+                                             const Schema& schema) {
+  if (!value.is_scalar()) {
+    return std::nullopt;
+  }
+  auto maybe_field = ref.GetOne(schema);
+  if (!maybe_field.ok()) {
+    return std::nullopt;
+  }
+  auto maybe_casted = compute::Cast(value, (*maybe_field)->type());
+  if (!maybe_casted.ok()) {
+    return std::nullopt;
+  }
+  return maybe_casted->scalar()->ToString();
+}
+
+}  // namespace
+
 Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Make(
     std::shared_ptr<Schema> schema, compute::Expression root_partition,
     std::shared_ptr<FileFormat> format, std::shared_ptr<fs::FileSystem> filesystem,
@@ -244,6 +392,7 @@ Result<std::shared_ptr<FileSystemDataset>> FileSystemDataset::Make(
   out->fragments_ = std::move(fragments);
   out->partitioning_ = std::move(partitioning);
   out->SetupSubtreePruning();
+  out->SetupPartitionIndex();
   return out;
 }
 
@@ -304,6 +453,44 @@ void FileSystemDataset::SetupSubtreePruning() {
       Forest(static_cast<int>(encoded.size()), SubtreeImpl::IsAncestor{encoded});
 }
 
+void FileSystemDataset::SetupPartitionIndex() {
+  partition_index_ = std::make_shared<PartitionIndex>();
+
+  // First pass: canonicalize each fragment's scalar equalities and collect
+  // the universe of indexed fields.
+  std::vector<std::unordered_map<std::string, std::string>> fragment_values(
+      fragments_.size());
+  for (size_t i = 0; i < fragments_.size(); ++i) {
+    auto maybe_known = compute::ExtractKnownFieldValues(
+        fragments_[i]->partition_expression());
+    if (!maybe_known.ok()) {
+      continue;
+    }
+    for (const auto& [ref, value] : maybe_known->map) {
+      std::optional<std::string> key = PartitionValueKey(value, ref, *schema_);
+      if (key.has_value()) {
+        fragment_values[i].emplace(ref.ToString(), std::move(*key));
+      }
+    }
+    for (const auto& [field, key] : fragment_values[i]) {
+      partition_index_->fields.try_emplace(field);
+    }
+  }
+
+  // Second pass: every fragment either pins an indexed field to one value or
+  // must remain a candidate for any predicate value of that field.
+  for (auto& [field, field_index] : partition_index_->fields) {
+    for (size_t i = 0; i < fragments_.size(); ++i) {
+      auto it = fragment_values[i].find(field);
+      if (it == fragment_values[i].end()) {
+        field_index.unconstrained.push_back(static_cast<int>(i));
+      } else {
+        field_index.by_value[it->second].push_back(static_cast<int>(i));
+      }
+    }
+  }
+}
+
 Result<FragmentIterator> FileSystemDataset::GetFragmentsImpl(
     compute::Expression predicate) {
   if (predicate == compute::literal(true)) {
@@ -311,6 +498,12 @@ Result<FragmentIterator> FileSystemDataset::GetFragmentsImpl(
     return MakeVectorIterator(FragmentVector(fragments_.begin(), fragments_.end()));
   }
 
+  ARROW_ASSIGN_OR_RAISE(std::optional<FragmentVector> indexed,
+                        GetFragmentsFromPartitionIndex(predicate));
+  if (indexed.has_value()) {
+    return MakeVectorIterator(std::move(*indexed));
+  }
+
   std::vector<int> fragment_indices;
 
   std::vector<compute::Expression> predicates{predicate};
@@ -345,6 +538,71 @@ Result<FragmentIterator> FileSystemDataset::GetFragmentsImpl(
   return MakeVectorIterator(std::move(fragments));
 }
 
+Result<std::optional<FragmentVector>> FileSystemDataset::GetFragmentsFromPartitionIndex(
+    const compute::Expression& predicate) {
+  if (partition_index_ == nullptr || partition_index_->fields.empty()) {
+    return std::nullopt;
+  }
+  ARROW_ASSIGN_OR_RAISE(compute::KnownFieldValues known,
+                        compute::ExtractKnownFieldValues(predicate));
+
+  // Collect the candidate lists for every indexed field the predicate pins
+  std::vector<const std::vector<int>*> candidate_lists;
+  int num_indexed_fields = 0;
+  for (const auto& [ref, value] : known.map) {
+    auto field_it = partition_index_->fields.find(ref.ToString());
+    if (field_it == partition_index_->fields.end()) {
+      continue;
+    }
+    std::optional<std::string> key = PartitionValueKey(value, ref, *schema_);
+    if (!key.has_value()) {
+      continue;
+    }
+    ++num_indexed_fields;
+    auto value_it = field_it->second.by_value.find(*key);
+    if (value_it != field_it->second.by_value.end()) {
+      candidate_lists.push_back(&value_it->second);
+    }
+    candidate_lists.push_back(&field_it->second.unconstrained);
+  }
+  if (num_indexed_fields == 0) {
+    // Predicate doesn't pin any indexed field; use the subtree forest
+    return std::nullopt;
+  }
+
+  // A fragment is a candidate if every pinned field either matches its value
+  // or leaves it unconstrained.  The candidate lists of one field are
+  // disjoint, so this is an intersection across fields.
+  std::unordered_map<int, int> candidate_counts;
+  for (const std::vector<int>* list : candidate_lists) {
+    for (int fragment_index : *list) {
+      ++candidate_counts[fragment_index];
+    }
+  }
+  std::vector<int> fragment_indices;
+  for (const auto& [fragment_index, count] : candidate_counts) {
+    if (count == num_indexed_fields) {
+      fragment_indices.push_back(fragment_index);
+    }
+  }
+  std::sort(fragment_indices.begin(), fragment_indices.end());
+
+  // The index only covers scalar equalities; any residual clauses are checked
+  // against each candidate's full guarantee, so this stays exact.
+  FragmentVector fragments;
+  fragments.reserve(fragment_indices.size());
+  for (int fragment_index : fragment_indices) {
+    ARROW_ASSIGN_OR_RAISE(
+        compute::Expression simplified,
+        SimplifyWithGuarantee(predicate,
+                              fragments_[fragment_index]->partition_expression()));
+    if (simplified.IsSatisfiable()) {
+      fragments.push_back(fragments_[fragment_index]);
+    }
+  }
+  return std::move(fragments);
+}
+
 Status FileWriter::Write(RecordBatchReader* batches) {
   while (true) {
     ARROW_ASSIGN_OR_RAISE(auto batch, batches->Next());
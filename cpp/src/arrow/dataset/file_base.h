@@ -110,6 +110,9 @@ class ARROW_DS_EXPORT FileSource : public util::EqualityComparable<FileSource> {
   /// \brief Return the filesystem, if any. Otherwise returns nullptr
   const std::shared_ptr<fs::FileSystem>& filesystem() const { return filesystem_; }
 
+  /// \brief Return the file info. Only valid when the file source wraps a path.
+  const fs::FileInfo& file_info() const { return file_info_; }
+
   /// \brief Return the buffer containing the file, if any. Otherwise returns nullptr
   const std::shared_ptr<Buffer>& buffer() const { return buffer_; }
 
@@ -143,6 +146,55 @@ class ARROW_DS_EXPORT FileSource : public util::EqualityComparable<FileSource> {
   Compression::type compression_ = Compression::UNCOMPRESSED;
 };
 
+/// \brief Interface for storage backends that can execute parts of a scan
+/// remotely, before the data crosses the network to the client
+///
+/// A provider advertises which conjunction members of a scan filter it can
+/// evaluate and whether it can restrict the materialized columns.  Offloaded
+/// predicates are best-effort, exactly like format-level pushdown: the
+/// scanner re-applies the full filter locally, so a provider may return rows
+/// its predicate would reject.
+class ARROW_DS_EXPORT ScanOffloadProvider {
+ public:
+  virtual ~ScanOffloadProvider() = default;
+
+  /// \brief A name identifying the backend, for debugging
+  virtual std::string name() const = 0;
+
+  /// \brief Report whether `expr` can be evaluated remotely
+  ///
+  /// Called once per conjunction member of the scan filter; members the
+  /// provider declines remain in the local filter.
+  virtual bool CanOffloadPredicate(const compute::Expression& expr) const = 0;
+
+  /// \brief Report whether the backend can materialize only requested columns
+  ///
+  /// When true, the provider should consult ScanOptions::MaterializedFields()
+  /// and omit all other columns from the returned batches.
+  virtual bool CanOffloadProjection() const { return false; }
+
+  /// \brief Scan a fragment remotely
+  ///
+  /// \param[in] options the scan options; batch size and (when projection
+  /// offload is supported) the materialized columns are taken from here
+  /// \param[in] fragment the fragment to scan
+  /// \param[in] predicate the offloadable part of the scan filter, i.e. the
+  /// conjunction of the members accepted by CanOffloadPredicate()
+  virtual Result<RecordBatchGenerator> ScanOffloaded(
+      const std::shared_ptr<ScanOptions>& options,
+      const std::shared_ptr<FileFragment>& fragment, compute::Expression predicate) = 0;
+};
+
+/// \brief Split a scan filter into remotely-evaluable and local parts
+///
+/// Each conjunction member of `filter` goes to the first (offloadable) side
+/// if the provider accepts it and to the second (local) side otherwise.  The
+/// conjunction of the two results is equivalent to `filter`; either side may
+/// be `literal(true)` when empty.
+ARROW_DS_EXPORT std::pair<compute::Expression, compute::Expression>
+SplitFilterForOffload(const compute::Expression& filter,
+                      const ScanOffloadProvider& provider);
+
 /// \brief Base class for file format implementation
 class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileFormat> {
  public:
@@ -151,6 +203,13 @@ class ARROW_DS_EXPORT FileFormat : public std::enable_shared_from_this<FileForma
   /// The options here can be overridden at scan time.
   std::shared_ptr<FragmentScanOptions> default_fragment_scan_options;
 
+  /// A storage backend able to execute parts of a scan remotely.
+  ///
+  /// When set, FileFragment::ScanBatchesAsync routes the scan through the
+  /// provider whenever at least one conjunction member of the scan filter
+  /// can be evaluated remotely; otherwise the format scans locally as usual.
+  std::shared_ptr<ScanOffloadProvider> scan_offload_provider;
+
   virtual ~FileFormat() = default;
 
   /// \brief The name identifying the kind of file format
@@ -309,6 +368,7 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
 
  protected:
   struct FragmentSubtrees;
+  struct PartitionIndex;
 
   explicit FileSystemDataset(std::shared_ptr<Schema> schema)
       : Dataset(std::move(schema)) {}
@@ -319,7 +379,13 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
 
   Result<FragmentIterator> GetFragmentsImpl(compute::Expression predicate) override;
 
+  /// Select fragments through the partition value index, or nullopt if the
+  /// predicate doesn't pin any indexed partition field.
+  Result<std::optional<FragmentVector>> GetFragmentsFromPartitionIndex(
+      const compute::Expression& predicate);
+
   void SetupSubtreePruning();
+  void SetupPartitionIndex();
 
   std::shared_ptr<FileFormat> format_;
   std::shared_ptr<fs::FileSystem> filesystem_;
@@ -327,6 +393,7 @@ class ARROW_DS_EXPORT FileSystemDataset : public Dataset {
   std::shared_ptr<Partitioning> partitioning_;
 
   std::shared_ptr<FragmentSubtrees> subtrees_;
+  std::shared_ptr<PartitionIndex> partition_index_;
 };
 
 /// \brief Options for writing a file of this format.
@@ -19,8 +19,10 @@
 
 #include <algorithm>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
 
@@ -53,6 +55,45 @@ using internal::SerialExecutor;
 
 namespace dataset {
 
+class CsvFileFormat::InferenceCache {
+ public:
+  using ColumnNames = std::unordered_set<std::string>;
+
+  std::shared_ptr<const ColumnNames> Get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = column_names_.find(key);
+    return it == column_names_.end() ? nullptr : it->second;
+  }
+
+  void Insert(const std::string& key, std::shared_ptr<const ColumnNames> names) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    column_names_.emplace(key, std::move(names));
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<const ColumnNames>> column_names_;
+};
+
+namespace {
+
+// Keys cover every option that influences the inferred column names; compare
+// CsvFileFormat::Equals for the parse options that matter.
+std::string InferenceCacheKey(const std::string& path,
+                              const csv::ReadOptions& read_options,
+                              const csv::ParseOptions& parse_options) {
+  std::stringstream ss;
+  ss << path << '|' << read_options.skip_rows << '|'
+     << read_options.autogenerate_column_names << '|' << parse_options.delimiter << '|'
+     << parse_options.quoting << '|' << parse_options.quote_char << '|'
+     << parse_options.double_quote << '|' << parse_options.escaping << '|'
+     << parse_options.escape_char << '|' << parse_options.newlines_in_values << '|'
+     << parse_options.ignore_empty_lines;
+  return ss.str();
+}
+
+}  // namespace
+
 struct CsvInspectedFragment : public InspectedFragment {
   CsvInspectedFragment(std::vector<std::string> column_names,
                        std::shared_ptr<io::InputStream> input_stream, int64_t num_bytes)
@@ -213,15 +254,11 @@ Result<std::unordered_set<std::string>> GetColumnNames(
 
 static inline Result<csv::ConvertOptions> GetConvertOptions(
     const CsvFileFormat& format, const ScanOptions* scan_options,
-    const std::string_view first_block) {
+    const std::unordered_set<std::string>& column_names) {
   ARROW_ASSIGN_OR_RAISE(
       auto csv_scan_options,
       GetFragmentScanOptions<CsvFragmentScanOptions>(
           kCsvTypeName, scan_options, format.default_fragment_scan_options));
-  ARROW_ASSIGN_OR_RAISE(
-      auto column_names,
-      GetColumnNames(csv_scan_options->read_options, format.parse_options, first_block,
-                     scan_options ? scan_options->pool : default_memory_pool()));
 
   auto convert_options = csv_scan_options->convert_options;
 
@@ -296,16 +333,38 @@ static inline Future<std::shared_ptr<csv::StreamingReader>> OpenReaderAsync(
       input, io::BufferedInputStream::Create(reader_options.block_size,
                                              default_memory_pool(), std::move(input)));
 
+  // Column name inference parses the first block of the file; for
+  // filesystem-backed sources, reuse a previous scan's result when we have one
+  // for this path and set of options.
+  std::string inference_key;
+  std::shared_ptr<const CsvFileFormat::InferenceCache::ColumnNames> column_names;
+  if (source.filesystem() != nullptr) {
+    inference_key = InferenceCacheKey(path, reader_options, format.parse_options);
+    column_names = format.inference_cache()->Get(inference_key);
+  }
+
   // Grab the first block and use it to determine the schema and create a reader.  The
   // input->Peek call blocks so we run the whole thing on the I/O thread pool.
   auto reader_fut = DeferNotOk(input->io_context().executor()->Submit(
       [=]() -> Future<std::shared_ptr<csv::StreamingReader>> {
-        ARROW_ASSIGN_OR_RAISE(auto first_block, input->Peek(reader_options.block_size));
         const auto& parse_options = format.parse_options;
+        auto names = column_names;
+        if (names == nullptr) {
+          ARROW_ASSIGN_OR_RAISE(auto first_block, input->Peek(reader_options.block_size));
+          ARROW_ASSIGN_OR_RAISE(
+              auto inferred,
+              GetColumnNames(reader_options, parse_options, first_block,
+                             scan_options ? scan_options->pool : default_memory_pool()));
+          names = std::make_shared<const CsvFileFormat::InferenceCache::ColumnNames>(
+              std::move(inferred));
+          if (!inference_key.empty()) {
+            format.inference_cache()->Insert(inference_key, names);
+          }
+        }
         ARROW_ASSIGN_OR_RAISE(
             auto convert_options,
             GetConvertOptions(format, scan_options ? scan_options.get() : nullptr,
-                              first_block));
+                              *names));
         return csv::StreamingReader::MakeAsync(io::default_io_context(), std::move(input),
                                                cpu_executor, reader_options,
                                                parse_options, convert_options);
@@ -338,17 +397,21 @@ static inline Result<std::shared_ptr<csv::StreamingReader>> OpenReader(
 }
 
 static RecordBatchGenerator GeneratorFromReader(
-    const Future<std::shared_ptr<csv::StreamingReader>>& reader, int64_t batch_size) {
+    const Future<std::shared_ptr<csv::StreamingReader>>& reader, int64_t batch_size,
+    bool preserve_fragment_batches) {
   auto gen_fut = reader.Then(
-      [batch_size](
+      [batch_size, preserve_fragment_batches](
           const std::shared_ptr<csv::StreamingReader>& reader) -> RecordBatchGenerator {
         auto batch_gen = [reader]() { return reader->ReadNextAsync(); };
-        return MakeChunkedBatchGenerator(std::move(batch_gen), batch_size);
+        return MaybeChunkBatchGenerator(std::move(batch_gen), batch_size,
+                                        preserve_fragment_batches);
       });
   return MakeFromFuture(std::move(gen_fut));
 }
 
-CsvFileFormat::CsvFileFormat() : FileFormat(std::make_shared<CsvFragmentScanOptions>()) {}
+CsvFileFormat::CsvFileFormat()
+    : FileFormat(std::make_shared<CsvFragmentScanOptions>()),
+      inference_cache_(std::make_shared<InferenceCache>()) {}
 
 bool CsvFileFormat::Equals(const FileFormat& format) const {
   if (type_name() != format.type_name()) return false;
@@ -383,12 +446,41 @@ Result<RecordBatchGenerator> CsvFileFormat::ScanBatchesAsync(
   auto source = file->source();
   auto reader_fut =
       OpenReaderAsync(source, *this, scan_options, ::arrow::internal::GetCpuThreadPool());
-  auto generator = GeneratorFromReader(std::move(reader_fut), scan_options->batch_size);
+  auto generator = GeneratorFromReader(std::move(reader_fut), scan_options->batch_size,
+                                       scan_options->preserve_fragment_batches);
   WRAP_ASYNC_GENERATOR_WITH_CHILD_SPAN(
       generator, "arrow::dataset::CsvFileFormat::ScanBatchesAsync::Next");
   return generator;
 }
 
+Result<std::shared_ptr<csv::StreamingReader>> CsvFileFormat::MakeMultiFileReader(
+    const std::vector<FileSource>& sources,
+    const std::shared_ptr<ScanOptions>& options) const {
+  if (sources.empty()) {
+    return Status::Invalid("Need at least one CSV file source");
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      auto fragment_scan_options,
+      GetFragmentScanOptions<CsvFragmentScanOptions>(kCsvTypeName, options.get(),
+                                                     default_fragment_scan_options));
+  ARROW_ASSIGN_OR_RAISE(auto read_options, GetReadOptions(*this, options));
+  std::vector<std::shared_ptr<io::InputStream>> inputs;
+  inputs.reserve(sources.size());
+  for (const auto& source : sources) {
+    ARROW_ASSIGN_OR_RAISE(auto input, source.OpenCompressed());
+    if (fragment_scan_options->stream_transform_func) {
+      ARROW_ASSIGN_OR_RAISE(input, fragment_scan_options->stream_transform_func(input));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        input, io::BufferedInputStream::Create(read_options.block_size,
+                                               default_memory_pool(), std::move(input)));
+    inputs.push_back(std::move(input));
+  }
+  return csv::StreamingReader::Make(io::default_io_context(), std::move(inputs),
+                                    read_options, parse_options,
+                                    fragment_scan_options->convert_options);
+}
+
 Future<std::optional<int64_t>> CsvFileFormat::CountRows(
     const std::shared_ptr<FileFragment>& file, compute::Expression predicate,
     const std::shared_ptr<ScanOptions>& options) {
@@ -19,6 +19,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/csv/options.h"
 #include "arrow/dataset/dataset.h"
@@ -73,12 +74,39 @@ class ARROW_DS_EXPORT CsvFileFormat : public FileFormat {
       const std::shared_ptr<FileFragment>& file, compute::Expression predicate,
       const std::shared_ptr<ScanOptions>& options) override;
 
+  /// \brief Open several file sources as a single streaming reader
+  ///
+  /// The schema is inferred from the first source and pinned for the others,
+  /// which must all yield the same schema.  Readers for upcoming sources are
+  /// opened ahead of consumption so that parse blocks from many small files
+  /// are scheduled onto the CPU thread pool concurrently.  All sources are
+  /// opened eagerly; prefer a Scanner for file counts that would exhaust
+  /// file descriptors.
+  Result<std::shared_ptr<csv::StreamingReader>> MakeMultiFileReader(
+      const std::vector<FileSource>& sources,
+      const std::shared_ptr<ScanOptions>& options = nullptr) const;
+
   Result<std::shared_ptr<FileWriter>> MakeWriter(
       std::shared_ptr<io::OutputStream> destination, std::shared_ptr<Schema> schema,
       std::shared_ptr<FileWriteOptions> options,
       fs::FileLocator destination_locator) const override;
 
   std::shared_ptr<FileWriteOptions> DefaultWriteOptions() override;
+
+  /// \brief Per-file inference results cached across scans.
+  ///
+  /// Inferring column names requires parsing the first block of the file.
+  /// Fragments of this format cache the result here on first scan, keyed by
+  /// path and the options that influence inference, so repeated scans of the
+  /// same file skip that work.  The cache lives as long as the format
+  /// instance; re-discovering a dataset starts from a fresh cache.
+  class InferenceCache;
+  const std::shared_ptr<InferenceCache>& inference_cache() const {
+    return inference_cache_;
+  }
+
+ private:
+  std::shared_ptr<InferenceCache> inference_cache_;
 };
 
 /// \brief Per-scan options for CSV fragments
@@ -192,6 +192,29 @@ N/A
   ASSERT_EQ(row_count, 4);
 }
 
+TEST_P(TestCsvFileFormat, RepeatedScansReuseInference) {
+  // Filesystem-backed sources cache the first scan's column name inference on
+  // the format; repeated scans of the same fragment serve from that cache.
+  ASSERT_OK_AND_ASSIGN(auto fs, fs::internal::MockFileSystem::Make(fs::kNoTime, {}));
+  ASSERT_OK_AND_ASSIGN(auto stream, fs->OpenOutputStream("test.csv"));
+  ASSERT_OK(stream->Write("f64\n1.0\n2.5\n"));
+  ASSERT_OK(stream->Close());
+  ASSERT_OK_AND_ASSIGN(auto info, fs->GetFileInfo("test.csv"));
+  FileSource source(info, fs);
+
+  SetSchema({field("f64", float64())});
+  auto fragment = MakeFragment(source);
+
+  for (int scan = 0; scan < 2; ++scan) {
+    int64_t row_count = 0;
+    for (auto maybe_batch : Batches(fragment)) {
+      ASSERT_OK_AND_ASSIGN(auto batch, maybe_batch);
+      row_count += batch->num_rows();
+    }
+    ASSERT_EQ(row_count, 2);
+  }
+}
+
 TEST_P(TestCsvFileFormat, CustomConvertOptions) {
   auto source = GetFileSource(R"(str
 foo
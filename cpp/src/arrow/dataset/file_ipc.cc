@@ -19,22 +19,40 @@
 
 #include <algorithm>
 #include <memory>
+#include <sstream>
 #include <utility>
 #include <vector>
 
+#include "arrow/array/util.h"
+#include "arrow/compute/api_aggregate.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/path_util.h"
+#include "arrow/io/memory.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/table.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/async_generator.h"
+#include "arrow/util/async_util.h"
+#include "arrow/util/base64.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
+#include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/string.h"
 #include "arrow/util/tracing_internal.h"
 
 namespace arrow {
 
+using namespace std::string_view_literals;  // NOLINT
+
+using internal::checked_cast;
 using internal::checked_pointer_cast;
+using internal::ToChars;
 
 namespace dataset {
 
@@ -124,6 +142,144 @@ static inline Result<ipc::IpcReadOptions> GetReadOptions(
   return options;
 }
 
+namespace {
+
+// Footer metadata key holding per-record-batch statistics, encoded as a
+// base64 IPC stream with one row per record batch in the file
+constexpr char kBatchStatisticsKey[] = "ARROW:experimental:batch_statistics";
+
+// Fixed-width, orderable and free of NaN complications
+bool IsStatisticsEligible(const DataType& type) {
+  return is_integer(type.id()) || is_temporal(type.id()) ||
+         type.id() == Type::DURATION || type.id() == Type::BOOL;
+}
+
+// Produce a single-row batch holding min/max/null_count for every eligible
+// column of `batch`.  Statistics fields are named "<column index>:min" and
+// so on; null min/max means "no information" (e.g. an all-null column).
+// Returns nullptr when no column is eligible.
+Result<std::shared_ptr<RecordBatch>> ComputeBatchStatistics(const RecordBatch& batch) {
+  FieldVector fields;
+  ArrayVector columns;
+  for (int i = 0; i < batch.num_columns(); ++i) {
+    const auto& field = batch.schema()->field(i);
+    if (!IsStatisticsEligible(*field->type())) continue;
+
+    ARROW_ASSIGN_OR_RAISE(Datum min_max, compute::MinMax(batch.column(i)));
+    const auto& min_max_scalar = checked_cast<const StructScalar&>(*min_max.scalar());
+
+    auto prefix = std::to_string(i);
+    fields.push_back(arrow::field(prefix + ":min", field->type()));
+    fields.push_back(arrow::field(prefix + ":max", field->type()));
+    fields.push_back(arrow::field(prefix + ":null_count", int64()));
+    for (const auto& scalar : min_max_scalar.value) {
+      ARROW_ASSIGN_OR_RAISE(auto array, MakeArrayFromScalar(*scalar, 1));
+      columns.push_back(std::move(array));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto null_count_array,
+        MakeArrayFromScalar(Int64Scalar(batch.column(i)->null_count()), 1));
+    columns.push_back(std::move(null_count_array));
+  }
+  if (fields.empty()) return nullptr;
+  return RecordBatch::Make(schema(std::move(fields)), 1, std::move(columns));
+}
+
+Result<std::string> SerializeBatchStatistics(const RecordBatchVector& rows) {
+  ARROW_ASSIGN_OR_RAISE(auto table, Table::FromRecordBatches(rows));
+  ARROW_ASSIGN_OR_RAISE(auto combined, table->CombineChunksToBatch());
+  ARROW_ASSIGN_OR_RAISE(auto sink, io::BufferOutputStream::Create());
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeStreamWriter(sink, combined->schema()));
+  RETURN_NOT_OK(writer->WriteRecordBatch(*combined));
+  RETURN_NOT_OK(writer->Close());
+  ARROW_ASSIGN_OR_RAISE(auto buffer, sink->Finish());
+  return util::base64_encode(std::string_view(
+      reinterpret_cast<const char*>(buffer->data()), static_cast<size_t>(buffer->size())));
+}
+
+// Decode footer statistics and return the indices of the record batches the
+// filter might match.  Returns std::nullopt when the statistics are absent,
+// malformed or stale (wrong row count), in which case all batches are read.
+Result<std::optional<std::vector<int64_t>>> SelectBatchesWithStatistics(
+    const ipc::RecordBatchFileReader& reader, const ScanOptions& scan_options) {
+  if (scan_options.filter == compute::literal(true)) {
+    return std::nullopt;
+  }
+  auto file_metadata = reader.metadata();
+  if (file_metadata == nullptr || !file_metadata->Contains(kBatchStatisticsKey)) {
+    return std::nullopt;
+  }
+  ARROW_ASSIGN_OR_RAISE(auto encoded, file_metadata->Get(kBatchStatisticsKey));
+  auto input = std::make_shared<io::BufferReader>(
+      Buffer::FromString(util::base64_decode(encoded)));
+  ARROW_ASSIGN_OR_RAISE(auto stats_reader, ipc::RecordBatchStreamReader::Open(input));
+  ARROW_ASSIGN_OR_RAISE(auto stats_table, stats_reader->ToTable());
+  ARROW_ASSIGN_OR_RAISE(auto stats, stats_table->CombineChunksToBatch());
+  if (stats->num_rows() != reader.num_record_batches()) {
+    return std::nullopt;
+  }
+
+  // Map each statistics triple back to the column it describes
+  struct ColumnStatistics {
+    compute::Expression field_expr;
+    std::shared_ptr<Array> min, max, null_count;
+  };
+  std::vector<ColumnStatistics> column_statistics;
+  const auto& file_schema = *reader.schema();
+  for (int i = 0; i + 2 < stats->num_columns(); i += 3) {
+    const auto& name = stats->schema()->field(i)->name();
+    auto colon = name.find(':');
+    if (colon == std::string::npos) return std::nullopt;
+    int column_index = 0;
+    try {
+      column_index = std::stoi(name.substr(0, colon));
+    } catch (const std::exception&) {
+      return std::nullopt;
+    }
+    if (column_index < 0 || column_index >= file_schema.num_fields()) {
+      return std::nullopt;
+    }
+    column_statistics.push_back(
+        {compute::field_ref(file_schema.field(column_index)->name()),
+         stats->column(i), stats->column(i + 1), stats->column(i + 2)});
+  }
+
+  std::vector<int64_t> selected;
+  for (int batch_index = 0; batch_index < reader.num_record_batches(); ++batch_index) {
+    std::vector<compute::Expression> guarantees;
+    for (const auto& stat : column_statistics) {
+      ARROW_ASSIGN_OR_RAISE(auto min, stat.min->GetScalar(batch_index));
+      ARROW_ASSIGN_OR_RAISE(auto max, stat.max->GetScalar(batch_index));
+      if (!min->is_valid || !max->is_valid) continue;
+
+      auto in_range =
+          compute::and_(compute::greater_equal(stat.field_expr, compute::literal(min)),
+                        compute::less_equal(stat.field_expr, compute::literal(max)));
+      ARROW_ASSIGN_OR_RAISE(auto null_count, stat.null_count->GetScalar(batch_index));
+      if (null_count->is_valid &&
+          checked_cast<const Int64Scalar&>(*null_count).value > 0) {
+        in_range =
+            compute::or_(std::move(in_range), compute::is_null(stat.field_expr));
+      }
+      guarantees.push_back(std::move(in_range));
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        auto simplified,
+        compute::SimplifyWithGuarantee(scan_options.filter,
+                                       compute::and_(std::move(guarantees))));
+    if (simplified.IsSatisfiable()) {
+      selected.push_back(batch_index);
+    }
+  }
+  if (static_cast<int>(selected.size()) == reader.num_record_batches()) {
+    // Nothing can be skipped; let the caller use the regular read path
+    return std::nullopt;
+  }
+  return selected;
+}
+
+}  // namespace
+
 IpcFileFormat::IpcFileFormat() : FileFormat(std::make_shared<IpcFragmentScanOptions>()) {}
 
 Result<bool> IpcFileFormat::IsSupported(const FileSource& source) const {
@@ -153,6 +309,23 @@ Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
   auto default_fragment_scan_options = this->default_fragment_scan_options;
   auto open_generator = [=](const std::shared_ptr<ipc::RecordBatchFileReader>& reader)
       -> Result<RecordBatchGenerator> {
+    ARROW_ASSIGN_OR_RAISE(auto selected, SelectBatchesWithStatistics(*reader, *options));
+    if (selected.has_value()) {
+      // Footer statistics proved some batches cannot match the filter; read
+      // only the surviving ones
+      auto read_batch = [reader, options](const int64_t& i) {
+        return DeferNotOk(options->io_context.executor()->Submit(
+            [reader, i] { return reader->ReadRecordBatch(static_cast<int>(i)); }));
+      };
+      auto generator =
+          MakeMappedGenerator(MakeVectorGenerator(std::move(*selected)), read_batch);
+      if (readahead_level > 0) {
+        generator = MakeReadaheadGenerator(std::move(generator), readahead_level);
+      }
+      return MaybeChunkBatchGenerator(std::move(generator), options->batch_size,
+                                      options->preserve_fragment_batches);
+    }
+
     ARROW_ASSIGN_OR_RAISE(
         auto ipc_scan_options,
         GetFragmentScanOptions<IpcFragmentScanOptions>(kIpcTypeName, options.get(),
@@ -172,10 +345,12 @@ Result<RecordBatchGenerator> IpcFileFormat::ScanBatchesAsync(
     WRAP_ASYNC_GENERATOR_WITH_CHILD_SPAN(
         generator, "arrow::dataset::IpcFileFormat::ScanBatchesAsync::Next");
     if (readahead_level == 0) {
-      return MakeChunkedBatchGenerator(std::move(generator), options->batch_size);
+      return MaybeChunkBatchGenerator(std::move(generator), options->batch_size,
+                                      options->preserve_fragment_batches);
     }
     auto batch_generator = MakeReadaheadGenerator(std::move(generator), readahead_level);
-    return MakeChunkedBatchGenerator(std::move(batch_generator), options->batch_size);
+    return MaybeChunkBatchGenerator(std::move(batch_generator), options->batch_size,
+                                    options->preserve_fragment_batches);
   };
   return MakeFromFuture(open_reader.Then(reopen_reader).Then(open_generator));
 }
@@ -217,31 +392,225 @@ Result<std::shared_ptr<FileWriter>> IpcFileFormat::MakeWriter(
 
   auto ipc_options = checked_pointer_cast<IpcFileWriteOptions>(options);
 
-  ARROW_ASSIGN_OR_RAISE(auto writer,
-                        ipc::MakeFileWriter(destination, schema, *ipc_options->options,
-                                            ipc_options->metadata));
+  // When statistics are requested, hand the IPC writer a mutable metadata
+  // instance that we keep: the statistics key is appended to it just before
+  // the writer serializes the footer
+  std::shared_ptr<KeyValueMetadata> footer_metadata;
+  auto metadata = ipc_options->metadata;
+  if (ipc_options->emit_batch_statistics) {
+    footer_metadata = metadata ? metadata->Copy() : std::make_shared<KeyValueMetadata>();
+    metadata = footer_metadata;
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto writer, ipc::MakeFileWriter(destination, schema,
+                                                         *ipc_options->options, metadata));
 
-  return std::shared_ptr<FileWriter>(
-      new IpcFileWriter(std::move(destination), std::move(writer), std::move(schema),
-                        std::move(ipc_options), std::move(destination_locator)));
+  return std::shared_ptr<FileWriter>(new IpcFileWriter(
+      std::move(destination), std::move(writer), std::move(schema),
+      std::move(ipc_options), std::move(destination_locator), std::move(footer_metadata)));
 }
 
 IpcFileWriter::IpcFileWriter(std::shared_ptr<io::OutputStream> destination,
                              std::shared_ptr<ipc::RecordBatchWriter> writer,
                              std::shared_ptr<Schema> schema,
                              std::shared_ptr<IpcFileWriteOptions> options,
-                             fs::FileLocator destination_locator)
+                             fs::FileLocator destination_locator,
+                             std::shared_ptr<KeyValueMetadata> footer_metadata)
     : FileWriter(std::move(schema), std::move(options), std::move(destination),
                  std::move(destination_locator)),
-      batch_writer_(std::move(writer)) {}
+      batch_writer_(std::move(writer)),
+      footer_metadata_(std::move(footer_metadata)) {}
 
 Status IpcFileWriter::Write(const std::shared_ptr<RecordBatch>& batch) {
+  if (footer_metadata_ != nullptr) {
+    ARROW_ASSIGN_OR_RAISE(auto statistics, ComputeBatchStatistics(*batch));
+    if (statistics == nullptr) {
+      // No eligible columns; stop collecting
+      footer_metadata_ = nullptr;
+      batch_statistics_.clear();
+    } else {
+      batch_statistics_.push_back(std::move(statistics));
+    }
+  }
   return batch_writer_->WriteRecordBatch(*batch);
 }
 
 Future<> IpcFileWriter::FinishInternal() {
   return DeferNotOk(destination_locator_.filesystem->io_context().executor()->Submit(
-      [this]() { return batch_writer_->Close(); }));
+      [this]() -> Status {
+        if (footer_metadata_ != nullptr && !batch_statistics_.empty()) {
+          ARROW_ASSIGN_OR_RAISE(auto encoded,
+                                SerializeBatchStatistics(batch_statistics_));
+          footer_metadata_->Append(kBatchStatisticsKey, std::move(encoded));
+        }
+        return batch_writer_->Close();
+      }));
+}
+
+struct ShardedIpcFileWriter::Shard {
+  std::string path;
+  std::shared_ptr<io::OutputStream> stream;
+  std::shared_ptr<ipc::RecordBatchWriter> writer;
+  std::unique_ptr<util::ThrottledAsyncTaskScheduler> tasks;
+  int64_t batches_written = 0;
+  int64_t rows_written = 0;
+};
+
+ShardedIpcFileWriter::ShardedIpcFileWriter(std::shared_ptr<fs::FileSystem> filesystem,
+                                           std::string base_dir,
+                                           std::shared_ptr<Schema> schema)
+    : filesystem_(std::move(filesystem)),
+      base_dir_(std::move(base_dir)),
+      schema_(std::move(schema)) {}
+
+ShardedIpcFileWriter::~ShardedIpcFileWriter() = default;
+
+Result<std::shared_ptr<ShardedIpcFileWriter>> ShardedIpcFileWriter::Make(
+    std::shared_ptr<fs::FileSystem> filesystem, std::string base_dir,
+    std::string basename_template, int num_shards, std::shared_ptr<Schema> schema,
+    std::shared_ptr<IpcFileWriteOptions> options) {
+  if (num_shards <= 0) {
+    return Status::Invalid("ShardedIpcFileWriter requires a positive shard count");
+  }
+  if (basename_template.find("{i}") == std::string::npos) {
+    return Status::Invalid("basename_template did not contain '{i}'");
+  }
+  if (options == nullptr) {
+    options =
+        checked_pointer_cast<IpcFileWriteOptions>(IpcFileFormat().DefaultWriteOptions());
+  }
+  RETURN_NOT_OK(filesystem->CreateDir(base_dir));
+
+  std::shared_ptr<ShardedIpcFileWriter> writer(
+      new ShardedIpcFileWriter(std::move(filesystem), std::move(base_dir), schema));
+  writer->finish_signal_ = Future<>::Make();
+  writer->scheduler_finished_ =
+      util::AsyncTaskScheduler::Make([&](util::AsyncTaskScheduler* scheduler) {
+        writer->scheduler_ = scheduler;
+        // Keep the scheduler alive until Finish() completes the signal
+        scheduler->AddSimpleTask(
+            [writer]() -> Result<Future<>> { return writer->finish_signal_; },
+            "ShardedIpcFileWriter::Running"sv);
+        return Status::OK();
+      });
+
+  auto ipc_options =
+      options->options ? *options->options : ipc::IpcWriteOptions::Defaults();
+  Status open_status = [&]() -> Status {
+    for (int i = 0; i < num_shards; ++i) {
+      auto basename = ::arrow::internal::Replace(basename_template, "{i}", ToChars(i));
+      auto shard = std::make_unique<Shard>();
+      shard->path = fs::internal::ConcatAbstractPath(writer->base_dir_, *basename);
+      ARROW_ASSIGN_OR_RAISE(shard->stream,
+                            writer->filesystem_->OpenOutputStream(shard->path));
+      ARROW_ASSIGN_OR_RAISE(shard->writer, ipc::MakeFileWriter(shard->stream, schema,
+                                                               ipc_options,
+                                                               options->metadata));
+      shard->tasks = util::MakeThrottledAsyncTaskGroup(
+          writer->scheduler_, /*max_concurrent_cost=*/1, /*queue=*/nullptr,
+          /*finish_callback=*/[] { return Status::OK(); });
+      writer->shard_paths_.push_back(shard->path);
+      writer->shards_.push_back(std::move(shard));
+    }
+    return Status::OK();
+  }();
+  if (!open_status.ok()) {
+    // Release the scheduler's hold so it (and the writer) can shut down
+    writer->finish_signal_.MarkFinished(Status::OK());
+    return open_status;
+  }
+  return writer;
+}
+
+Status ShardedIpcFileWriter::Write(const std::shared_ptr<RecordBatch>& batch) {
+  if (finish_started_) {
+    return Status::Invalid("Write() called on a finished ShardedIpcFileWriter");
+  }
+  Shard* shard = shards_[next_shard_].get();
+  next_shard_ = (next_shard_ + 1) % shards_.size();
+  shard->batches_written++;
+  shard->rows_written += batch->num_rows();
+  auto self = shared_from_this();
+  shard->tasks->AddSimpleTask(
+      [self, shard, batch]() -> Result<Future<>> {
+        return DeferNotOk(
+            self->filesystem_->io_context().executor()->Submit([shard, batch]() {
+              return shard->writer->WriteRecordBatch(*batch);
+            }));
+      },
+      "ShardedIpcFileWriter::WriteBatch"sv);
+  return Status::OK();
+}
+
+Future<> ShardedIpcFileWriter::Finish() {
+  if (finish_started_) {
+    return scheduler_finished_;
+  }
+  finish_started_ = true;
+  auto self = shared_from_this();
+  std::vector<Future<>> closed;
+  closed.reserve(shards_.size());
+  for (auto& shard_ptr : shards_) {
+    Shard* shard = shard_ptr.get();
+    Future<> shard_closed = Future<>::Make();
+    shard->tasks->AddSimpleTask(
+        [self, shard, shard_closed]() mutable -> Result<Future<>> {
+          auto fut =
+              DeferNotOk(self->filesystem_->io_context().executor()->Submit([shard]() {
+                RETURN_NOT_OK(shard->writer->Close());
+                return shard->stream->Close();
+              }));
+          fut.AddCallback([shard_closed](const Status& status) mutable {
+            shard_closed.MarkFinished(status);
+          });
+          return fut;
+        },
+        "ShardedIpcFileWriter::CloseShard"sv);
+    closed.push_back(std::move(shard_closed));
+  }
+  AllComplete(std::move(closed)).AddCallback([self](const Status& status) {
+    if (!status.ok()) {
+      self->finish_signal_.MarkFinished(status);
+      return;
+    }
+    self->scheduler_->AddSimpleTask(
+        [self]() -> Result<Future<>> {
+          auto fut = DeferNotOk(self->filesystem_->io_context().executor()->Submit(
+              [self]() { return self->WriteManifest(); }));
+          fut.AddCallback([self](const Status& manifest_status) {
+            self->finish_signal_.MarkFinished(manifest_status);
+          });
+          return fut;
+        },
+        "ShardedIpcFileWriter::WriteManifest"sv);
+  });
+  return scheduler_finished_;
+}
+
+Status ShardedIpcFileWriter::WriteManifest() {
+  auto escape = [](const std::string& s) {
+    std::string out;
+    for (char c : s) {
+      if (c == '"' || c == '\\') out.push_back('\\');
+      out.push_back(c);
+    }
+    return out;
+  };
+  std::ostringstream json;
+  json << "{\"shards\": [";
+  for (size_t i = 0; i < shards_.size(); ++i) {
+    if (i > 0) json << ", ";
+    json << "{\"path\": \"" << escape(shards_[i]->path)
+         << "\", \"batches\": " << shards_[i]->batches_written
+         << ", \"rows\": " << shards_[i]->rows_written << "}";
+  }
+  json << "]}";
+  ARROW_ASSIGN_OR_RAISE(
+      auto stream, filesystem_->OpenOutputStream(
+                       fs::internal::ConcatAbstractPath(base_dir_, "manifest.json")));
+  std::string body = json.str();
+  RETURN_NOT_OK(stream->Write(body.data(), static_cast<int64_t>(body.size())));
+  return stream->Close();
 }
 
 }  // namespace dataset
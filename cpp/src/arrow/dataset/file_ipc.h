@@ -21,6 +21,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/type_fwd.h"
@@ -28,8 +29,15 @@
 #include "arrow/io/type_fwd.h"
 #include "arrow/ipc/type_fwd.h"
 #include "arrow/result.h"
+#include "arrow/util/future.h"
 
 namespace arrow {
+
+namespace util {
+class AsyncTaskScheduler;
+class ThrottledAsyncTaskScheduler;
+}  // namespace util
+
 namespace dataset {
 
 /// \addtogroup dataset-file-formats
@@ -91,6 +99,13 @@ class ARROW_DS_EXPORT IpcFileWriteOptions : public FileWriteOptions {
   /// custom_metadata written to the file's footer
   std::shared_ptr<const KeyValueMetadata> metadata;
 
+  /// Compute per-record-batch min/max statistics while writing and embed
+  /// them in the footer's custom metadata.  Scans of the resulting file can
+  /// then skip record batches whose statistics are incompatible with the
+  /// scan filter, like Parquet row group pruning.  Only fixed-width
+  /// non-floating-point columns contribute statistics.  Off by default.
+  bool emit_batch_statistics = false;
+
  protected:
   explicit IpcFileWriteOptions(std::shared_ptr<FileFormat> format)
       : FileWriteOptions(std::move(format)) {}
@@ -107,16 +122,79 @@ class ARROW_DS_EXPORT IpcFileWriter : public FileWriter {
                 std::shared_ptr<ipc::RecordBatchWriter> writer,
                 std::shared_ptr<Schema> schema,
                 std::shared_ptr<IpcFileWriteOptions> options,
-                fs::FileLocator destination_locator);
+                fs::FileLocator destination_locator,
+                std::shared_ptr<KeyValueMetadata> footer_metadata);
 
   Future<> FinishInternal() override;
 
   std::shared_ptr<io::OutputStream> destination_;
   std::shared_ptr<ipc::RecordBatchWriter> batch_writer_;
+  /// Mutable footer metadata, shared with batch_writer_, that receives the
+  /// serialized statistics before the footer is written.  Null when
+  /// statistics are disabled.
+  std::shared_ptr<KeyValueMetadata> footer_metadata_;
+  /// One single-row statistics batch per written record batch
+  RecordBatchVector batch_statistics_;
 
   friend class IpcFileFormat;
 };
 
+/// \brief Write record batches round-robin across several IPC files
+///
+/// Batches are distributed over `num_shards` files and written concurrently,
+/// one sequential task chain per shard, so exports are no longer bound by the
+/// bandwidth of a single file.  Finish() closes every shard and then writes a
+/// small JSON manifest (`manifest.json` in the output directory) listing the
+/// shard paths together with their batch and row counts, for downstream
+/// parallel consumers.
+///
+/// Write() is not thread-safe; like ipc::RecordBatchWriter it is expected to
+/// be fed from a single producer.
+class ARROW_DS_EXPORT ShardedIpcFileWriter
+    : public std::enable_shared_from_this<ShardedIpcFileWriter> {
+ public:
+  ~ShardedIpcFileWriter();
+
+  /// \brief Open `num_shards` output files under `base_dir`
+  ///
+  /// `basename_template` must contain the token "{i}", which is replaced by
+  /// the shard index.  `options` defaults to IpcFileFormat's default write
+  /// options.
+  static Result<std::shared_ptr<ShardedIpcFileWriter>> Make(
+      std::shared_ptr<fs::FileSystem> filesystem, std::string base_dir,
+      std::string basename_template, int num_shards, std::shared_ptr<Schema> schema,
+      std::shared_ptr<IpcFileWriteOptions> options = NULLPTR);
+
+  /// \brief Queue a batch for writing to the next shard in round-robin order
+  Status Write(const std::shared_ptr<RecordBatch>& batch);
+
+  /// \brief Close all shards, write the manifest, and return a future that
+  /// completes when every queued write has finished
+  Future<> Finish();
+
+  /// \brief The paths of the shard files, in shard order
+  const std::vector<std::string>& shard_paths() const { return shard_paths_; }
+
+ private:
+  struct Shard;
+
+  ShardedIpcFileWriter(std::shared_ptr<fs::FileSystem> filesystem, std::string base_dir,
+                       std::shared_ptr<Schema> schema);
+
+  Status WriteManifest();
+
+  std::shared_ptr<fs::FileSystem> filesystem_;
+  std::string base_dir_;
+  std::shared_ptr<Schema> schema_;
+  std::vector<std::unique_ptr<Shard>> shards_;
+  std::vector<std::string> shard_paths_;
+  size_t next_shard_ = 0;
+  bool finish_started_ = false;
+  util::AsyncTaskScheduler* scheduler_ = NULLPTR;
+  Future<> finish_signal_;
+  Future<> scheduler_finished_;
+};
+
 /// @}
 
 }  // namespace dataset
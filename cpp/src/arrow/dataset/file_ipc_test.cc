@@ -83,6 +83,86 @@ TEST_F(TestIpcFileFormat, WriteRecordBatchReaderCustomOptions) {
             ipc_options->metadata->sorted_pairs());
 }
 
+TEST_F(TestIpcFileFormat, BatchStatisticsPruning) {
+  auto sch = schema({field("i64", int64())});
+  auto batch1 = RecordBatchFromJSON(sch, "[[1], [2], [3]]");
+  auto batch2 = RecordBatchFromJSON(sch, "[[100], [101], [102]]");
+
+  auto ipc_options =
+      checked_pointer_cast<IpcFileWriteOptions>(format_->DefaultWriteOptions());
+  ipc_options->emit_batch_statistics = true;
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto fs, fs::internal::MockFileSystem::Make(fs::kNoTime, {}));
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       format_->MakeWriter(sink, sch, ipc_options, {fs, "<buffer>"}));
+  ASSERT_OK(writer->Write(batch1));
+  ASSERT_OK(writer->Write(batch2));
+  ASSERT_FINISHES_OK(writer->Finish());
+  ASSERT_OK_AND_ASSIGN(auto written, sink->Finish());
+
+  // The footer carries the statistics under the experimental key
+  ASSERT_OK_AND_ASSIGN(auto ipc_reader, ipc::RecordBatchFileReader::Open(
+                                            std::make_shared<io::BufferReader>(written)));
+  ASSERT_NE(ipc_reader->metadata(), nullptr);
+  ASSERT_TRUE(ipc_reader->metadata()->Contains("ARROW:experimental:batch_statistics"));
+
+  // A filter incompatible with the first batch's min/max prunes that batch
+  auto fragment = MakeFragment(FileSource(written));
+  auto options = std::make_shared<ScanOptions>();
+  ASSERT_OK_AND_ASSIGN(options->filter,
+                       greater(field_ref("i64"), literal(int64_t{50})).Bind(*sch));
+  ASSERT_OK_AND_ASSIGN(auto generator, fragment->ScanBatchesAsync(options));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(generator));
+  ASSERT_EQ(1u, batches.size());
+  AssertBatchesEqual(*batch2, *batches[0]);
+
+  // A filter both batches can match reads the whole file
+  ASSERT_OK_AND_ASSIGN(options->filter,
+                       greater(field_ref("i64"), literal(int64_t{0})).Bind(*sch));
+  ASSERT_OK_AND_ASSIGN(generator, fragment->ScanBatchesAsync(options));
+  ASSERT_FINISHES_OK_AND_ASSIGN(batches, CollectAsyncGenerator(generator));
+  ASSERT_EQ(2u, batches.size());
+}
+
+TEST_F(TestIpcFileFormat, ShardedWrite) {
+  auto sch = schema({field("i64", int64())});
+  RecordBatchVector batches = {RecordBatchFromJSON(sch, "[[0]]"),
+                               RecordBatchFromJSON(sch, "[[1], [10]]"),
+                               RecordBatchFromJSON(sch, "[[2]]"),
+                               RecordBatchFromJSON(sch, "[[3], [30]]")};
+
+  ASSERT_OK_AND_ASSIGN(auto fs, fs::internal::MockFileSystem::Make(fs::kNoTime, {}));
+  ASSERT_OK_AND_ASSIGN(auto writer,
+                       ShardedIpcFileWriter::Make(fs, "/exported", "part-{i}.arrow",
+                                                  /*num_shards=*/2, sch));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->Write(batch));
+  }
+  ASSERT_FINISHES_OK(writer->Finish());
+
+  // Round-robin: even batches land in shard 0, odd batches in shard 1
+  ASSERT_EQ(2u, writer->shard_paths().size());
+  for (size_t shard = 0; shard < 2; ++shard) {
+    ASSERT_OK_AND_ASSIGN(auto file,
+                         fs->OpenInputFile(writer->shard_paths()[shard]));
+    ASSERT_OK_AND_ASSIGN(auto reader, ipc::RecordBatchFileReader::Open(file));
+    ASSERT_EQ(2, reader->num_record_batches());
+    for (int i = 0; i < 2; ++i) {
+      ASSERT_OK_AND_ASSIGN(auto batch, reader->ReadRecordBatch(i));
+      AssertBatchesEqual(*batches[2 * i + shard], *batch);
+    }
+  }
+
+  // The manifest lists every shard
+  ASSERT_OK_AND_ASSIGN(auto manifest, fs->OpenInputStream("/exported/manifest.json"));
+  ASSERT_OK_AND_ASSIGN(auto manifest_body, manifest->Read(1024));
+  auto manifest_json = manifest_body->ToString();
+  for (const auto& path : writer->shard_paths()) {
+    ASSERT_NE(std::string::npos, manifest_json.find(path));
+  }
+}
+
 TEST_F(TestIpcFileFormat, InspectFailureWithRelevantError) {
   TestInspectFailureWithRelevantError(StatusCode::Invalid, "IPC");
 }
@@ -18,6 +18,9 @@
 #include "arrow/dataset/file_json.h"
 
 #include <algorithm>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -49,6 +52,24 @@ using internal::Executor;
 
 namespace dataset {
 
+class JsonFileFormat::InferenceCache {
+ public:
+  std::shared_ptr<Schema> Get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = schemas_.find(key);
+    return it == schemas_.end() ? nullptr : it->second;
+  }
+
+  void Insert(const std::string& key, std::shared_ptr<Schema> schema) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    schemas_.emplace(key, std::move(schema));
+  }
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<Schema>> schemas_;
+};
+
 namespace {
 
 using ReaderPtr = std::shared_ptr<json::StreamingReader>;
@@ -282,16 +303,35 @@ Result<Future<ReaderPtr>> DoOpenReader(
       io::BufferedInputStream::Create(state->read_options.block_size,
                                       default_memory_pool(), std::move(state->stream)));
 
+  // Schema inference parses the first block of the file; for filesystem-backed
+  // sources, reuse a previous scan's result when we have one for this path.
+  std::string inference_key;
+  std::shared_ptr<Schema> cached_schema;
+  if (source.filesystem() != nullptr && scan_options && scan_options->dataset_schema) {
+    std::stringstream ss;
+    ss << source.path() << '|' << state->read_options.block_size << '|'
+       << state->parse_options.newlines_in_values;
+    inference_key = ss.str();
+    cached_schema = format.inference_cache()->Get(inference_key);
+  }
+
   auto maybe_future = state->stream->io_context().executor()->Submit(
-      [state = std::move(state)]() -> Future<ReaderPtr> {
+      [state = std::move(state), inference_key = std::move(inference_key),
+       physical_schema = std::move(cached_schema),
+       cache = format.inference_cache()]() mutable -> Future<ReaderPtr> {
         if (state->scan_options && state->scan_options->dataset_schema) {
-          // Inspect the first block before anything else, so we can derive an explicit
-          // schema for the reader based on the dataset schema.
-          ARROW_ASSIGN_OR_RAISE(auto first_block,
-                                state->stream->Peek(state->read_options.block_size));
-          ARROW_ASSIGN_OR_RAISE(auto physical_schema,
-                                ParseToSchema(first_block, state->parse_options,
-                                              state->scan_options->pool));
+          if (physical_schema == nullptr) {
+            // Inspect the first block before anything else, so we can derive an explicit
+            // schema for the reader based on the dataset schema.
+            ARROW_ASSIGN_OR_RAISE(auto first_block,
+                                  state->stream->Peek(state->read_options.block_size));
+            ARROW_ASSIGN_OR_RAISE(physical_schema,
+                                  ParseToSchema(first_block, state->parse_options,
+                                                state->scan_options->pool));
+            if (!inference_key.empty()) {
+              cache->Insert(inference_key, physical_schema);
+            }
+          }
           ARROW_ASSIGN_OR_RAISE(state->parse_options.explicit_schema,
                                 GetPartialSchema(*state->scan_options, *physical_schema));
           state->parse_options.unexpected_field_behavior =
@@ -360,7 +400,8 @@ Result<std::shared_ptr<InspectedFragment>> DoInspectFragment(
 }  // namespace
 
 JsonFileFormat::JsonFileFormat()
-    : FileFormat(std::make_shared<JsonFragmentScanOptions>()) {}
+    : FileFormat(std::make_shared<JsonFragmentScanOptions>()),
+      inference_cache_(std::make_shared<InferenceCache>()) {}
 
 bool JsonFileFormat::Equals(const FileFormat& other) const {
   return type_name() == other.type_name();
@@ -380,7 +421,8 @@ Result<RecordBatchGenerator> JsonFileFormat::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& scan_options,
     const std::shared_ptr<FileFragment>& file) const {
   ARROW_ASSIGN_OR_RAISE(auto gen, MakeBatchGenerator(*this, scan_options, file));
-  return MakeChunkedBatchGenerator(std::move(gen), scan_options->batch_size);
+  return MaybeChunkBatchGenerator(std::move(gen), scan_options->batch_size,
+                                  scan_options->preserve_fragment_batches);
 }
 
 Future<std::optional<int64_t>> JsonFileFormat::CountRows(
@@ -78,6 +78,21 @@ class ARROW_DS_EXPORT JsonFileFormat : public FileFormat {
   }
 
   std::shared_ptr<FileWriteOptions> DefaultWriteOptions() override { return NULLPTR; }
+
+  /// \brief Per-file inference results cached across scans.
+  ///
+  /// Deriving an explicit reader schema parses the first block of the file.
+  /// The inferred physical schema is cached here on first scan, keyed by
+  /// path, so repeated scans of the same file skip that work.  The cache
+  /// lives as long as the format instance; re-discovering a dataset starts
+  /// from a fresh cache.
+  class InferenceCache;
+  const std::shared_ptr<InferenceCache>& inference_cache() const {
+    return inference_cache_;
+  }
+
+ private:
+  std::shared_ptr<InferenceCache> inference_cache_;
 };
 
 /// \brief Per-scan options for JSON fragments
@@ -23,6 +23,8 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/io/interfaces.h"
+#include "arrow/util/async_generator.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
@@ -58,87 +60,52 @@ Result<std::unique_ptr<arrow::adapters::orc::ORCFileReader>> OpenORCReader(
   return reader;
 }
 
-/// \brief A ScanTask backed by an ORC file.
-class OrcScanTask {
- public:
-  OrcScanTask(std::shared_ptr<FileFragment> fragment,
-              std::shared_ptr<ScanOptions> options)
-      : fragment_(std::move(fragment)), options_(std::move(options)) {}
-
-  Result<RecordBatchIterator> Execute() {
-    struct Impl {
-      static Result<RecordBatchIterator> Make(const FileSource& source,
-                                              const FileFormat& format,
-                                              const ScanOptions& scan_options) {
-        ARROW_ASSIGN_OR_RAISE(
-            auto reader,
-            OpenORCReader(source, std::make_shared<ScanOptions>(scan_options)));
-
-        auto materialized_fields = scan_options.MaterializedFields();
-        // filter out virtual columns
-        std::vector<std::string> included_fields;
-        ARROW_ASSIGN_OR_RAISE(auto schema, reader->ReadSchema());
-        for (const auto& ref : materialized_fields) {
-          ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*schema));
-          if (match.indices().empty()) continue;
-
-          included_fields.push_back(schema->field(match.indices()[0])->name());
-        }
-
-        std::shared_ptr<RecordBatchReader> record_batch_reader;
-        ARROW_ASSIGN_OR_RAISE(
-            record_batch_reader,
-            reader->GetRecordBatchReader(scan_options.batch_size, included_fields));
-
-        return RecordBatchIterator(Impl{std::move(record_batch_reader)});
-      }
-
-      Result<std::shared_ptr<RecordBatch>> Next() {
-        std::shared_ptr<RecordBatch> batch;
-        RETURN_NOT_OK(record_batch_reader_->ReadNext(&batch));
-        return batch;
-      }
-
-      std::shared_ptr<RecordBatchReader> record_batch_reader_;
-    };
-
-    return Impl::Make(fragment_->source(),
-                      *checked_pointer_cast<FileFragment>(fragment_)->format(),
-                      *options_);
-  }
-
- private:
-  std::shared_ptr<FileFragment> fragment_;
-  std::shared_ptr<ScanOptions> options_;
+/// \brief What a scan needs to know about an ORC file before decoding it
+struct OrcScanPlan {
+  /// The projected column names (empty means all columns)
+  std::vector<std::string> included_fields;
+  /// The stripe indices to decode, in file order
+  std::vector<int64_t> stripes;
 };
 
-class OrcScanTaskIterator {
- public:
-  static Result<Iterator<std::shared_ptr<OrcScanTask>>> Make(
-      std::shared_ptr<ScanOptions> options, std::shared_ptr<FileFragment> fragment) {
-    return Iterator<std::shared_ptr<OrcScanTask>>(
-        OrcScanTaskIterator(std::move(options), std::move(fragment)));
+Result<std::shared_ptr<OrcScanPlan>> PlanORCScan(
+    const FileSource& source, const std::shared_ptr<ScanOptions>& options) {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  auto reader = arrow::adapters::orc::ORCFileReader::Open(input, options->pool);
+  if (!reader.ok()) {
+    auto status = reader.status();
+    return status.WithMessage("Could not open ORC input source '", source.path(),
+                              "': ", status.message());
   }
 
-  Result<std::shared_ptr<OrcScanTask>> Next() {
-    if (once_) {
-      // Iteration is done.
-      return nullptr;
-    }
+  auto materialized_fields = options->MaterializedFields();
+  // filter out virtual columns
+  std::vector<std::string> included_fields;
+  ARROW_ASSIGN_OR_RAISE(auto schema, (*reader)->ReadSchema());
+  for (const auto& ref : materialized_fields) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*schema));
+    if (match.indices().empty()) continue;
 
-    once_ = true;
-    return std::make_shared<OrcScanTask>(fragment_, options_);
+    included_fields.push_back(schema->field(match.indices()[0])->name());
   }
 
- private:
-  OrcScanTaskIterator(std::shared_ptr<ScanOptions> options,
-                      std::shared_ptr<FileFragment> fragment)
-      : options_(std::move(options)), fragment_(std::move(fragment)) {}
+  const int64_t num_stripes = (*reader)->NumberOfStripes();
+  std::vector<int64_t> stripes;
+  std::vector<io::ReadRange> stripe_ranges;
+  stripes.reserve(static_cast<size_t>(num_stripes));
+  stripe_ranges.reserve(static_cast<size_t>(num_stripes));
+  for (int64_t i = 0; i < num_stripes; ++i) {
+    auto info = (*reader)->GetStripeInformation(i);
+    stripes.push_back(i);
+    stripe_ranges.push_back({info.offset, info.length});
+  }
+  // Hint the input about the upcoming stripe reads so the filesystem can
+  // coalesce and prefetch them before the decode tasks ask for the bytes
+  RETURN_NOT_OK(input->WillNeed(stripe_ranges));
 
-  bool once_ = false;
-  std::shared_ptr<ScanOptions> options_;
-  std::shared_ptr<FileFragment> fragment_;
-};
+  return std::make_shared<OrcScanPlan>(
+      OrcScanPlan{std::move(included_fields), std::move(stripes)});
+}
 
 }  // namespace
 
@@ -157,45 +124,40 @@ Result<std::shared_ptr<Schema>> OrcFileFormat::Inspect(const FileSource& source)
 Result<RecordBatchGenerator> OrcFileFormat::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& options,
     const std::shared_ptr<FileFragment>& file) const {
-  // TODO investigate "true" async version
-  // (https://issues.apache.org/jira/browse/ARROW-13795)
-  ARROW_ASSIGN_OR_RAISE(auto task_iter, OrcScanTaskIterator::Make(options, file));
-  struct IterState {
-    Iterator<std::shared_ptr<OrcScanTask>> iter;
-    RecordBatchIterator curr_iter;
-    bool first;
-    ::arrow::internal::Executor* io_executor;
-  };
-  struct {
-    Future<std::shared_ptr<RecordBatch>> operator()() {
-      auto state = state_;
-      return ::arrow::DeferNotOk(
-          state->io_executor->Submit([state]() -> Result<std::shared_ptr<RecordBatch>> {
-            if (state->first) {
-              ARROW_ASSIGN_OR_RAISE(auto task, state->iter.Next());
-              ARROW_ASSIGN_OR_RAISE(state->curr_iter, task->Execute());
-              state->first = false;
+  auto source = file->source();
+  auto io_executor = options->io_context.executor();
+
+  // Open the file once up front to learn the stripe layout and the projected
+  // columns, prefetching the stripe byte ranges as a side effect
+  auto plan_fut = DeferNotOk(io_executor->Submit(
+      [source, options]() { return PlanORCScan(source, options); }));
+
+  auto open_generator = [source, options](const std::shared_ptr<OrcScanPlan>& plan)
+      -> Result<RecordBatchGenerator> {
+    // One decode task per stripe.  ORCFileReader is stateful, so every task
+    // opens its own reader against the (now prefetched) source; readahead
+    // keeps several stripe decodes in flight at once.
+    auto read_stripe =
+        [source, options, plan](const int64_t& stripe)
+        -> Future<std::shared_ptr<RecordBatch>> {
+      return DeferNotOk(options->io_context.executor()->Submit(
+          [source, options, plan, stripe]() -> Result<std::shared_ptr<RecordBatch>> {
+            ARROW_ASSIGN_OR_RAISE(auto reader, OpenORCReader(source, options));
+            if (plan->included_fields.empty()) {
+              return reader->ReadStripe(stripe);
             }
-            while (!IsIterationEnd(state->curr_iter)) {
-              ARROW_ASSIGN_OR_RAISE(auto next_batch, state->curr_iter.Next());
-              if (IsIterationEnd(next_batch)) {
-                ARROW_ASSIGN_OR_RAISE(auto task, state->iter.Next());
-                if (IsIterationEnd(task)) {
-                  state->curr_iter = IterationEnd<RecordBatchIterator>();
-                } else {
-                  ARROW_ASSIGN_OR_RAISE(state->curr_iter, task->Execute());
-                }
-              } else {
-                return next_batch;
-              }
-            }
-            return IterationEnd<std::shared_ptr<RecordBatch>>();
+            return reader->ReadStripe(stripe, plan->included_fields);
           }));
+    };
+    auto generator = MakeMappedGenerator(
+        MakeVectorGenerator(std::vector<int64_t>(plan->stripes)), read_stripe);
+    if (options->batch_readahead > 0) {
+      generator = MakeReadaheadGenerator(std::move(generator), options->batch_readahead);
     }
-    std::shared_ptr<IterState> state_;
-  } iter_to_gen{std::shared_ptr<IterState>(
-      new IterState{std::move(task_iter), {}, true, options->io_context.executor()})};
-  return iter_to_gen;
+    return MaybeChunkBatchGenerator(std::move(generator), options->batch_size,
+                                    options->preserve_fragment_batches);
+  };
+  return MakeFromFuture(plan_fut.Then(std::move(open_generator)));
 }
 
 Future<std::optional<int64_t>> OrcFileFormat::CountRows(
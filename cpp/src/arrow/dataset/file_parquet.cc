@@ -17,8 +17,12 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <mutex>
+#include <numeric>
+#include <optional>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -26,11 +30,15 @@
 
 #include "arrow/compute/cast.h"
 #include "arrow/compute/exec.h"
+#include "arrow/compute/expression_internal.h"
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/parquet_encryption_config.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_util.h"
+#include "arrow/scalar.h"
 #include "arrow/table.h"
+#include "arrow/util/cache_internal.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/future.h"
 #include "arrow/util/iterator.h"
@@ -40,10 +48,13 @@
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/bloom_filter_reader.h"
 #include "parquet/encryption/crypto_factory.h"
 #include "parquet/encryption/encryption.h"
 #include "parquet/encryption/kms_client.h"
 #include "parquet/file_reader.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/statistics.h"
 
@@ -470,6 +481,52 @@ Result<std::shared_ptr<Schema>> ParquetFileFormat::Inspect(
   return schema;
 }
 
+namespace {
+
+// Process-wide cache of parsed Parquet footers. The key identifies the file's
+// current contents (path, size and modification time), so a rewritten file gets
+// a fresh entry and the stale footer ages out of the LRU.
+constexpr int32_t kFooterCacheCapacity = 128;
+
+struct FooterCache {
+  std::mutex mutex;
+  ::arrow::internal::LruCache<std::string, std::shared_ptr<parquet::FileMetaData>> cache{
+      kFooterCacheCapacity};
+};
+
+FooterCache& GetFooterCache() {
+  static FooterCache footer_cache;
+  return footer_cache;
+}
+
+// Compute a cache key for the source, or nullopt if the source cannot be
+// cached (no filesystem, or the filesystem doesn't report a modification time
+// we could use to detect rewritten files).
+std::optional<std::string> FooterCacheKey(const FileSource& source) {
+  if (source.filesystem() == nullptr) return std::nullopt;
+  auto maybe_info = source.filesystem()->GetFileInfo(source.path());
+  if (!maybe_info.ok() || !maybe_info->IsFile() || maybe_info->mtime() == fs::kNoTime) {
+    return std::nullopt;
+  }
+  return source.path() + '\0' + std::to_string(maybe_info->size()) + '\0' +
+         std::to_string(maybe_info->mtime().time_since_epoch().count());
+}
+
+std::shared_ptr<parquet::FileMetaData> LookupCachedFooter(const std::string& key) {
+  auto& footer_cache = GetFooterCache();
+  std::lock_guard<std::mutex> lock(footer_cache.mutex);
+  auto* found = footer_cache.cache.Find(key);
+  return found ? *found : nullptr;
+}
+
+void StoreCachedFooter(std::string key, std::shared_ptr<parquet::FileMetaData> metadata) {
+  auto& footer_cache = GetFooterCache();
+  std::lock_guard<std::mutex> lock(footer_cache.mutex);
+  footer_cache.cache.Replace(std::move(key), std::move(metadata));
+}
+
+}  // namespace
+
 Result<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader(
     const FileSource& source, const std::shared_ptr<ScanOptions>& options) const {
   return GetReader(source, options, /*metadata=*/nullptr);
@@ -484,13 +541,22 @@ Result<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
                                                          default_fragment_scan_options));
   auto properties =
       MakeReaderProperties(*this, parquet_scan_options.get(), "", nullptr, options->pool);
+  std::shared_ptr<parquet::FileMetaData> cached_metadata = metadata;
+  std::optional<std::string> footer_cache_key;
+  if (parquet_scan_options->cache_metadata && cached_metadata == nullptr) {
+    footer_cache_key = FooterCacheKey(source);
+    if (footer_cache_key) {
+      cached_metadata = LookupCachedFooter(*footer_cache_key);
+      if (cached_metadata != nullptr) footer_cache_key.reset();
+    }
+  }
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   // `parquet::ParquetFileReader::Open` will not wrap the exception as status,
   // so using `open_parquet_file` to wrap it.
   auto open_parquet_file = [&]() -> Result<std::unique_ptr<parquet::ParquetFileReader>> {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
     auto reader = parquet::ParquetFileReader::Open(std::move(input),
-                                                   std::move(properties), metadata);
+                                                   std::move(properties), cached_metadata);
     return reader;
     END_PARQUET_CATCH_EXCEPTIONS
   };
@@ -500,6 +566,9 @@ Result<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
     return WrapSourceError(reader_opt.status(), source.path());
   }
   auto reader = std::move(reader_opt).ValueOrDie();
+  if (footer_cache_key) {
+    StoreCachedFooter(std::move(*footer_cache_key), reader->metadata());
+  }
 
   std::shared_ptr<parquet::FileMetaData> reader_metadata = reader->metadata();
   auto arrow_properties =
@@ -527,15 +596,29 @@ Future<std::shared_ptr<parquet::arrow::FileReader>> ParquetFileFormat::GetReader
                                          source.filesystem(), options->pool);
   auto self = checked_pointer_cast<const ParquetFileFormat>(shared_from_this());
 
+  std::shared_ptr<parquet::FileMetaData> cached_metadata = metadata;
+  std::optional<std::string> footer_cache_key;
+  if (parquet_scan_options->cache_metadata && cached_metadata == nullptr) {
+    footer_cache_key = FooterCacheKey(source);
+    if (footer_cache_key) {
+      cached_metadata = LookupCachedFooter(*footer_cache_key);
+      if (cached_metadata != nullptr) footer_cache_key.reset();
+    }
+  }
+
   return source.OpenAsync().Then(
       [self = self, properties = std::move(properties), source = source,
-       options = options, metadata = metadata,
+       options = options, metadata = std::move(cached_metadata),
+       footer_cache_key = std::move(footer_cache_key),
        parquet_scan_options = parquet_scan_options](
           const std::shared_ptr<io::RandomAccessFile>& input) mutable {
         return parquet::ParquetFileReader::OpenAsync(input, properties, metadata)
             .Then(
                 [=](const std::unique_ptr<parquet::ParquetFileReader>& reader) mutable
                 -> Result<std::shared_ptr<parquet::arrow::FileReader>> {
+                  if (footer_cache_key) {
+                    StoreCachedFooter(std::move(*footer_cache_key), reader->metadata());
+                  }
                   auto arrow_properties = MakeArrowReaderProperties(
                       *self, *reader->metadata(), *options, *parquet_scan_options);
 
@@ -602,6 +685,55 @@ struct SlicingGenerator {
   std::shared_ptr<State> state;
 };
 
+namespace {
+
+// The row groups a fragment's scan starts from, before any pruning
+std::vector<int> FragmentRowGroupIds(const ParquetFileFragment& fragment,
+                                     const parquet::FileMetaData& metadata) {
+  std::vector<int> ids = fragment.row_groups();
+  if (ids.empty()) {
+    ids.resize(metadata.num_row_groups());
+    std::iota(ids.begin(), ids.end(), 0);
+  }
+  return ids;
+}
+
+// Record the net effect of row group pruning for one fragment, including the
+// compressed bytes the scan will not have to read
+void RecordRowGroupPruning(const ParquetFileFragment& fragment,
+                           const parquet::FileMetaData& metadata,
+                           const std::vector<int>& kept, ScanMetrics* metrics) {
+  std::vector<int> considered = FragmentRowGroupIds(fragment, metadata);
+  metrics->row_groups_considered += static_cast<int64_t>(considered.size());
+  metrics->row_groups_pruned += static_cast<int64_t>(considered.size() - kept.size());
+  std::unordered_set<int> kept_set(kept.begin(), kept.end());
+  for (int row_group : considered) {
+    if (kept_set.find(row_group) == kept_set.end()) {
+      metrics->bytes_skipped += metadata.RowGroup(row_group)->total_compressed_size();
+    }
+  }
+}
+
+// Time each pull on the decoded-batch generator.  Pulls block on both IO and
+// decode, so the accumulated total approximates time spent producing batches.
+RecordBatchGenerator MakeDecodeTimingGenerator(RecordBatchGenerator source,
+                                               std::shared_ptr<ScanMetrics> metrics) {
+  return [source = std::move(source), metrics = std::move(metrics)]() {
+    auto start = std::chrono::steady_clock::now();
+    return source().Then([metrics, start](const std::shared_ptr<RecordBatch>& batch) {
+      metrics->decode_wait_ns += std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                     std::chrono::steady_clock::now() - start)
+                                     .count();
+      if (!IsIterationEnd(batch)) {
+        metrics->batches_decoded += 1;
+      }
+      return batch;
+    });
+  };
+}
+
+}  // namespace
+
 Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
     const std::shared_ptr<ScanOptions>& options,
     const std::shared_ptr<FileFragment>& file) const {
@@ -615,7 +747,13 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
   if (parquet_fragment->metadata() != nullptr) {
     ARROW_ASSIGN_OR_RAISE(row_groups, parquet_fragment->FilterRowGroups(options->filter));
     pre_filtered = true;
-    if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    if (row_groups.empty()) {
+      if (options->metrics) {
+        RecordRowGroupPruning(*parquet_fragment, *parquet_fragment->metadata(),
+                              row_groups, options->metrics.get());
+      }
+      return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+    }
   }
   // Open the reader and pay the real IO cost.
   auto make_generator =
@@ -624,11 +762,22 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
       -> Result<RecordBatchGenerator> {
     // Ensure that parquet_fragment has FileMetaData
     RETURN_NOT_OK(parquet_fragment->EnsureCompleteMetadata(reader.get()));
+    // Record the cumulative outcome of every pruning stage below (pre-filter
+    // included, since the considered set is the fragment's full selection)
+    auto record_pruning = [&] {
+      if (options->metrics) {
+        RecordRowGroupPruning(*parquet_fragment, *parquet_fragment->metadata(),
+                              row_groups, options->metrics.get());
+      }
+    };
     if (!pre_filtered) {
       // row groups were not already filtered; do this now
       ARROW_ASSIGN_OR_RAISE(row_groups,
                             parquet_fragment->FilterRowGroups(options->filter));
-      if (row_groups.empty()) return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+      if (row_groups.empty()) {
+        record_pruning();
+        return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+      }
     }
     ARROW_ASSIGN_OR_RAISE(auto column_projection,
                           InferColumnProjection(*reader, *options));
@@ -636,14 +785,46 @@ Result<RecordBatchGenerator> ParquetFileFormat::ScanBatchesAsync(
         auto parquet_scan_options,
         GetFragmentScanOptions<ParquetFragmentScanOptions>(
             kParquetTypeName, options.get(), default_fragment_scan_options));
+    if (parquet_scan_options->page_index_pruning &&
+        options->filter != compute::literal(true)) {
+      // Now that the reader is open, the page index (if written) can prune row
+      // groups whose chunk-level statistics were too coarse to exclude.
+      ARROW_ASSIGN_OR_RAISE(
+          row_groups, parquet_fragment->FilterRowGroupsWithPageIndex(
+                          reader->parquet_reader(), options->filter, row_groups));
+      if (row_groups.empty()) {
+        record_pruning();
+        return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+      }
+    }
+    if (parquet_scan_options->bloom_filter_pruning &&
+        options->filter != compute::literal(true)) {
+      // Columns the filter pins to a single value can consult the bloom
+      // filters (if written) before any data pages are read.
+      ARROW_ASSIGN_OR_RAISE(
+          row_groups, parquet_fragment->FilterRowGroupsWithBloomFilter(
+                          reader->parquet_reader(), options->filter, row_groups));
+      if (row_groups.empty()) {
+        record_pruning();
+        return MakeEmptyGenerator<std::shared_ptr<RecordBatch>>();
+      }
+    }
+    record_pruning();
     int batch_readahead = options->batch_readahead;
     int64_t rows_to_readahead = batch_readahead * options->batch_size;
     ARROW_ASSIGN_OR_RAISE(auto generator,
                           reader->GetRecordBatchGenerator(
                               reader, row_groups, column_projection,
                               ::arrow::internal::GetCpuThreadPool(), rows_to_readahead));
-    RecordBatchGenerator sliced =
-        SlicingGenerator(std::move(generator), options->batch_size);
+    if (options->metrics) {
+      generator = MakeDecodeTimingGenerator(std::move(generator), options->metrics);
+    }
+    RecordBatchGenerator sliced;
+    if (options->preserve_fragment_batches) {
+      sliced = std::move(generator);
+    } else {
+      sliced = SlicingGenerator(std::move(generator), options->batch_size);
+    }
     if (batch_readahead == 0) {
       return sliced;
     }
@@ -923,6 +1104,337 @@ Result<std::vector<int>> ParquetFileFragment::FilterRowGroups(
   return row_groups;
 }
 
+namespace {
+
+// An upper bound on the number of row slices tested per row group, to bound
+// planning cost for files with very many small pages.
+constexpr size_t kMaxPageIndexSlices = 4096;
+
+// Express the page-level statistics of the ColumnIndex as an expression, like
+// ColumnChunkStatisticsAsExpression does for chunk-level statistics.
+std::optional<compute::Expression> PageStatisticsAsExpression(
+    const FieldRef& field_ref, const Field& field, const parquet::ColumnDescriptor* descr,
+    const parquet::ColumnIndex& column_index, size_t page) {
+  if (column_index.null_pages()[page]) {
+    return is_null(compute::field_ref(field_ref));
+  }
+
+  const bool has_null_counts = column_index.has_null_counts();
+  const int64_t null_count = has_null_counts ? column_index.null_counts()[page] : 0;
+  // num_values is not tracked by the ColumnIndex; pass a non-zero placeholder
+  // since only the null count matters for the expression of a non-null page.
+  std::shared_ptr<parquet::Statistics> statistics = parquet::Statistics::Make(
+      descr, column_index.encoded_min_values()[page],
+      column_index.encoded_max_values()[page], /*num_values=*/1, null_count,
+      /*distinct_count=*/0, /*has_min_max=*/true,
+      /*has_null_count=*/has_null_counts, /*has_distinct_count=*/false);
+  if (statistics == nullptr) {
+    return std::nullopt;
+  }
+  return ParquetFileFragment::EvaluateStatisticsAsExpression(field, field_ref,
+                                                             *statistics);
+}
+
+}  // namespace
+
+Result<std::vector<int>> ParquetFileFragment::FilterRowGroupsWithPageIndex(
+    parquet::ParquetFileReader* reader, compute::Expression predicate,
+    std::vector<int> row_groups) {
+  auto lock = physical_schema_mutex_.Lock();
+
+  DCHECK_NE(metadata_, nullptr);
+  ARROW_ASSIGN_OR_RAISE(
+      predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+  if (!predicate.IsSatisfiable()) {
+    return std::vector<int>{};
+  }
+
+  // Resolve the leaf columns referenced by the predicate, as TestRowGroups does.
+  std::vector<std::pair<FieldRef, const SchemaField*>> referenced_leaves;
+  for (const FieldRef& ref : FieldsInExpression(predicate)) {
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema_));
+
+    if (match.empty()) continue;
+    const SchemaField* schema_field = &manifest_->schema_fields[match[0]];
+
+    for (size_t i = 1; i < match.indices().size(); ++i) {
+      if (schema_field->field->type()->id() != Type::STRUCT) {
+        return Status::Invalid("nested paths only supported for structs");
+      }
+      schema_field = &schema_field->children[match[i]];
+    }
+
+    if (!schema_field->is_leaf()) continue;
+    referenced_leaves.emplace_back(ref, schema_field);
+  }
+  if (referenced_leaves.empty()) {
+    return row_groups;
+  }
+
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  std::shared_ptr<parquet::PageIndexReader> page_index_reader =
+      reader->GetPageIndexReader();
+  if (page_index_reader == nullptr) {
+    return row_groups;
+  }
+
+  std::vector<int> kept_row_groups;
+  for (int row_group : row_groups) {
+    auto row_group_index_reader = page_index_reader->RowGroup(row_group);
+    if (row_group_index_reader == nullptr) {
+      // No page index for this row group; cannot prune
+      kept_row_groups.push_back(row_group);
+      continue;
+    }
+
+    // Page boundaries (as row offsets within the row group) and lazily built
+    // per-page guarantees of each referenced column.
+    struct ColumnPages {
+      const FieldRef* ref;
+      const SchemaField* schema_field;
+      std::shared_ptr<parquet::ColumnIndex> column_index;
+      std::vector<int64_t> first_rows;
+      std::vector<std::optional<compute::Expression>> page_expressions;
+    };
+    std::vector<ColumnPages> columns;
+    // Rows where some referenced column starts a new page. Testing the
+    // predicate once per such slice aligns pages across columns: within a
+    // slice every column stays on a single page.
+    std::vector<int64_t> slice_starts = {0};
+    for (const auto& [ref, schema_field] : referenced_leaves) {
+      auto column_index = row_group_index_reader->GetColumnIndex(schema_field->column_index);
+      auto offset_index = row_group_index_reader->GetOffsetIndex(schema_field->column_index);
+      if (column_index == nullptr || offset_index == nullptr) continue;
+      const auto& page_locations = offset_index->page_locations();
+      if (page_locations.empty() ||
+          column_index->null_pages().size() != page_locations.size()) {
+        continue;
+      }
+      ColumnPages column{&ref, schema_field, std::move(column_index), {}, {}};
+      column.first_rows.reserve(page_locations.size());
+      for (const auto& page_location : page_locations) {
+        column.first_rows.push_back(page_location.first_row_index);
+        slice_starts.push_back(page_location.first_row_index);
+      }
+      column.page_expressions.resize(page_locations.size());
+      columns.push_back(std::move(column));
+    }
+    std::sort(slice_starts.begin(), slice_starts.end());
+    slice_starts.erase(std::unique(slice_starts.begin(), slice_starts.end()),
+                       slice_starts.end());
+    if (columns.empty() || slice_starts.size() > kMaxPageIndexSlices) {
+      kept_row_groups.push_back(row_group);
+      continue;
+    }
+
+    bool satisfiable = false;
+    for (int64_t slice_start : slice_starts) {
+      compute::Expression guarantee = compute::literal(true);
+      for (ColumnPages& column : columns) {
+        auto it = std::upper_bound(column.first_rows.begin(), column.first_rows.end(),
+                                   slice_start);
+        if (it == column.first_rows.begin()) continue;
+        const size_t page = static_cast<size_t>(it - column.first_rows.begin()) - 1;
+        std::optional<compute::Expression>& page_expression =
+            column.page_expressions[page];
+        if (!page_expression.has_value()) {
+          auto maybe_minmax = PageStatisticsAsExpression(
+              *column.ref, *column.schema_field->field,
+              metadata_->schema()->Column(column.schema_field->column_index),
+              *column.column_index, page);
+          if (maybe_minmax) {
+            ARROW_ASSIGN_OR_RAISE(page_expression,
+                                  maybe_minmax->Bind(*physical_schema_));
+          } else {
+            // Statistics of this page are unusable; it guarantees nothing
+            page_expression = compute::literal(true);
+          }
+        }
+        FoldingAnd(&guarantee, *page_expression);
+      }
+      ARROW_ASSIGN_OR_RAISE(auto simplified,
+                            SimplifyWithGuarantee(predicate, guarantee));
+      if (simplified.IsSatisfiable()) {
+        satisfiable = true;
+        break;
+      }
+    }
+    if (satisfiable) {
+      kept_row_groups.push_back(row_group);
+    }
+  }
+  return kept_row_groups;
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
+namespace {
+
+// Hash an Arrow scalar from the scan predicate the way the bloom filter hashes
+// values of the column's physical type. Returns nullopt when the scalar does
+// not map onto the physical type unambiguously, in which case the bloom filter
+// cannot be consulted.
+std::optional<uint64_t> BloomFilterHash(const parquet::BloomFilter& bloom_filter,
+                                        const parquet::ColumnDescriptor* descr,
+                                        const Scalar& value) {
+  if (!value.is_valid) return std::nullopt;
+  switch (descr->physical_type()) {
+    case parquet::Type::INT32:
+      switch (value.type->id()) {
+        case Type::INT8:
+          return bloom_filter.Hash(
+              static_cast<int32_t>(checked_cast<const Int8Scalar&>(value).value));
+        case Type::UINT8:
+          return bloom_filter.Hash(
+              static_cast<int32_t>(checked_cast<const UInt8Scalar&>(value).value));
+        case Type::INT16:
+          return bloom_filter.Hash(
+              static_cast<int32_t>(checked_cast<const Int16Scalar&>(value).value));
+        case Type::UINT16:
+          return bloom_filter.Hash(
+              static_cast<int32_t>(checked_cast<const UInt16Scalar&>(value).value));
+        case Type::INT32:
+          return bloom_filter.Hash(checked_cast<const Int32Scalar&>(value).value);
+        case Type::UINT32:
+          return bloom_filter.Hash(
+              static_cast<int32_t>(checked_cast<const UInt32Scalar&>(value).value));
+        case Type::DATE32:
+          return bloom_filter.Hash(checked_cast<const Date32Scalar&>(value).value);
+        case Type::TIME32:
+          return bloom_filter.Hash(checked_cast<const Time32Scalar&>(value).value);
+        default:
+          return std::nullopt;
+      }
+    case parquet::Type::INT64:
+      switch (value.type->id()) {
+        case Type::INT64:
+          return bloom_filter.Hash(checked_cast<const Int64Scalar&>(value).value);
+        case Type::UINT64:
+          return bloom_filter.Hash(
+              static_cast<int64_t>(checked_cast<const UInt64Scalar&>(value).value));
+        case Type::TIMESTAMP:
+          return bloom_filter.Hash(checked_cast<const TimestampScalar&>(value).value);
+        case Type::TIME64:
+          return bloom_filter.Hash(checked_cast<const Time64Scalar&>(value).value);
+        case Type::DURATION:
+          return bloom_filter.Hash(checked_cast<const DurationScalar&>(value).value);
+        default:
+          return std::nullopt;
+      }
+    case parquet::Type::FLOAT:
+      if (value.type->id() == Type::FLOAT) {
+        return bloom_filter.Hash(checked_cast<const FloatScalar&>(value).value);
+      }
+      return std::nullopt;
+    case parquet::Type::DOUBLE:
+      if (value.type->id() == Type::DOUBLE) {
+        return bloom_filter.Hash(checked_cast<const DoubleScalar&>(value).value);
+      }
+      return std::nullopt;
+    case parquet::Type::BYTE_ARRAY:
+      if (is_base_binary_like(value.type->id())) {
+        const auto& buffer = checked_cast<const BaseBinaryScalar&>(value).value;
+        parquet::ByteArray byte_array(static_cast<uint32_t>(buffer->size()),
+                                      buffer->data());
+        return bloom_filter.Hash(&byte_array);
+      }
+      return std::nullopt;
+    case parquet::Type::FIXED_LEN_BYTE_ARRAY:
+      if (value.type->id() == Type::FIXED_SIZE_BINARY) {
+        const auto& buffer = checked_cast<const FixedSizeBinaryScalar&>(value).value;
+        if (buffer->size() != descr->type_length()) return std::nullopt;
+        parquet::FLBA flba(buffer->data());
+        return bloom_filter.Hash(&flba, descr->type_length());
+      }
+      return std::nullopt;
+    default:
+      return std::nullopt;
+  }
+}
+
+}  // namespace
+
+Result<std::vector<int>> ParquetFileFragment::FilterRowGroupsWithBloomFilter(
+    parquet::ParquetFileReader* reader, compute::Expression predicate,
+    std::vector<int> row_groups) {
+  auto lock = physical_schema_mutex_.Lock();
+
+  DCHECK_NE(metadata_, nullptr);
+  if (metadata_->is_encryption_algorithm_set()) {
+    // Reading encrypted bloom filters is not supported yet
+    return row_groups;
+  }
+  ARROW_ASSIGN_OR_RAISE(
+      predicate, SimplifyWithGuarantee(std::move(predicate), partition_expression_));
+  if (!predicate.IsSatisfiable()) {
+    return std::vector<int>{};
+  }
+
+  // Values the predicate requires specific columns to take; only such
+  // equalities can be tested against a bloom filter.
+  ARROW_ASSIGN_OR_RAISE(auto known_values, compute::ExtractKnownFieldValues(predicate));
+
+  struct ColumnValue {
+    const SchemaField* schema_field;
+    const Scalar* value;
+  };
+  std::vector<ColumnValue> column_values;
+  std::vector<int32_t> column_indices;
+  for (const auto& [ref, datum] : known_values.map) {
+    if (!datum.is_scalar() || !datum.scalar()->is_valid) continue;
+
+    ARROW_ASSIGN_OR_RAISE(auto match, ref.FindOneOrNone(*physical_schema_));
+    if (match.empty()) continue;
+    const SchemaField* schema_field = &manifest_->schema_fields[match[0]];
+    for (size_t i = 1; i < match.indices().size(); ++i) {
+      if (schema_field->field->type()->id() != Type::STRUCT) {
+        return Status::Invalid("nested paths only supported for structs");
+      }
+      schema_field = &schema_field->children[match[i]];
+    }
+    if (!schema_field->is_leaf()) continue;
+
+    column_values.push_back(ColumnValue{schema_field, datum.scalar().get()});
+    column_indices.push_back(schema_field->column_index);
+  }
+  if (column_values.empty()) {
+    return row_groups;
+  }
+
+  BEGIN_PARQUET_CATCH_EXCEPTIONS
+  auto& bloom_filter_reader = reader->GetBloomFilterReader();
+  // Fetch all needed bloom filters in one coalesced I/O pass.
+  bloom_filter_reader.WillNeed(std::vector<int32_t>(row_groups.begin(), row_groups.end()),
+                               column_indices);
+
+  std::vector<int> kept_row_groups;
+  for (int row_group : row_groups) {
+    auto row_group_reader = bloom_filter_reader.RowGroup(row_group);
+    if (row_group_reader == nullptr) {
+      kept_row_groups.push_back(row_group);
+      continue;
+    }
+    bool satisfiable = true;
+    for (const ColumnValue& column_value : column_values) {
+      auto bloom_filter =
+          row_group_reader->GetColumnBloomFilter(column_value.schema_field->column_index);
+      if (bloom_filter == nullptr) continue;
+      auto hash = BloomFilterHash(
+          *bloom_filter, metadata_->schema()->Column(column_value.schema_field->column_index),
+          *column_value.value);
+      if (hash.has_value() && !bloom_filter->FindHash(*hash)) {
+        // The required value is definitely absent from this row group
+        satisfiable = false;
+        break;
+      }
+    }
+    if (satisfiable) {
+      kept_row_groups.push_back(row_group);
+    }
+  }
+  return kept_row_groups;
+  END_PARQUET_CATCH_EXCEPTIONS
+}
+
 Result<std::vector<compute::Expression>> ParquetFileFragment::TestRowGroups(
     compute::Expression predicate) {
   auto lock = physical_schema_mutex_.Lock();
@@ -206,6 +206,20 @@ class ARROW_DS_EXPORT ParquetFileFragment : public FileFragment {
   Result<std::vector<int>> FilterRowGroups(compute::Expression predicate);
   /// Simplify the predicate against the statistics of each row group.
   Result<std::vector<compute::Expression>> TestRowGroups(compute::Expression predicate);
+  /// Return the subset of `row_groups` which the file's page index (if present)
+  /// cannot prove to be entirely excluded by the predicate. Evaluates per-page
+  /// min/max statistics from the ColumnIndex with rows aligned across columns
+  /// via the OffsetIndex, which can exclude row groups whose chunk-level
+  /// statistics are too coarse (e.g. multi-modal or sorted-by-another-key data).
+  Result<std::vector<int>> FilterRowGroupsWithPageIndex(
+      parquet::ParquetFileReader* reader, compute::Expression predicate,
+      std::vector<int> row_groups);
+  /// Return the subset of `row_groups` whose bloom filters (if written) do not
+  /// rule out the values that the predicate requires specific columns to take.
+  /// All needed bloom filters are fetched in one coalesced I/O pass.
+  Result<std::vector<int>> FilterRowGroupsWithBloomFilter(
+      parquet::ParquetFileReader* reader, compute::Expression predicate,
+      std::vector<int> row_groups);
   /// Try to count rows matching the predicate using metadata. Expects
   /// metadata to be present, and expects the predicate to have been
   /// simplified against the partition expression already.
@@ -247,6 +261,20 @@ class ARROW_DS_EXPORT ParquetFragmentScanOptions : public FragmentScanOptions {
   std::shared_ptr<parquet::ArrowReaderProperties> arrow_reader_properties;
   /// A configuration structure that provides decryption properties for a dataset
   std::shared_ptr<ParquetDecryptionConfig> parquet_decryption_config = NULLPTR;
+  /// If enabled, row groups whose pages cannot satisfy the scan filter are
+  /// pruned using the file's page index (ColumnIndex/OffsetIndex), when one is
+  /// present. This is in addition to the row group statistics based pruning.
+  bool page_index_pruning = true;
+  /// If enabled, row groups whose bloom filters rule out a value the scan
+  /// filter requires a column to take (an equality predicate) are pruned
+  /// before any data pages are read, when bloom filters are present.
+  bool bloom_filter_pruning = true;
+  /// EXPERIMENTAL: If enabled, parsed file metadata (the Parquet footer) is
+  /// kept in a process-wide LRU cache keyed by file path, size and modification
+  /// time, so that repeated scans of the same files skip reading and parsing
+  /// the footer. Only sources backed by a filesystem that reports a valid
+  /// modification time participate.
+  bool cache_metadata = false;
 };
 
 class ARROW_DS_EXPORT ParquetFileWriteOptions : public FileWriteOptions {
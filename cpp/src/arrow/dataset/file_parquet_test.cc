@@ -17,6 +17,7 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <chrono>
 #include <memory>
 #include <thread>
 #include <utility>
@@ -305,6 +306,53 @@ TEST_F(TestParquetFileFormat, CountRowsPredicatePushdown) {
   }
 }
 
+TEST_F(TestParquetFileFormat, PredicatePushdownPageIndex) {
+  // A single row group whose pages hold disjoint value ranges: the chunk-level
+  // statistics cannot exclude values falling between the pages, but the page
+  // index can.
+  constexpr int64_t kRowsPerPage = 100;
+  auto test_schema = schema({field("x", int64())});
+  std::string json = "[";
+  for (int64_t i = 0; i < 2 * kRowsPerPage; ++i) {
+    if (i > 0) json += ",";
+    json += (i < kRowsPerPage) ? "0" : "1000";
+  }
+  json += "]";
+  auto table =
+      Table::Make(test_schema, {ArrayFromJSON(int64(), json)}, 2 * kRowsPerPage);
+
+  auto sink = CreateOutputStream();
+  auto properties = WriterProperties::Builder()
+                        .enable_write_page_index()
+                        ->data_pagesize(1) /* write a page per batch */
+                        ->write_batch_size(kRowsPerPage)
+                        ->build();
+  ASSERT_OK(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                       /*chunk_size=*/2 * kRowsPerPage, properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(FileSource{buffer}));
+  SetSchema(test_schema->fields());
+
+  // The chunk statistics ([0, 1000]) retain the row group but the page
+  // statistics ([0, 0] and [1000, 1000]) exclude it.
+  SetFilter(equal(field_ref("x"), literal<int64_t>(500)));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+
+  // Satisfiable filters keep the row group (no post-filtering at this level)
+  SetFilter(equal(field_ref("x"), literal<int64_t>(1000)));
+  CountRowsAndBatchesInScan(fragment, 2 * kRowsPerPage, 1);
+  SetFilter(literal(true));
+  CountRowsAndBatchesInScan(fragment, 2 * kRowsPerPage, 1);
+
+  // Page index pruning can be disabled via the fragment scan options
+  auto parquet_options = std::make_shared<ParquetFragmentScanOptions>();
+  parquet_options->page_index_pruning = false;
+  opts_->fragment_scan_options = parquet_options;
+  SetFilter(equal(field_ref("x"), literal<int64_t>(500)));
+  CountRowsAndBatchesInScan(fragment, 2 * kRowsPerPage, 1);
+}
+
 TEST_F(TestParquetFileFormat, CachedMetadata) {
   // Create a test file
   auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
@@ -363,6 +411,56 @@ TEST_F(TestParquetFileFormat, CachedMetadata) {
   ASSERT_NE(nullptr, pq_fragment->metadata());
 }
 
+TEST_F(TestParquetFileFormat, FooterMetadataCache) {
+  // The footer cache key requires a valid mtime, so give the mock filesystem a
+  // real creation time.
+  auto mtime = fs::TimePoint(
+      std::chrono::duration_cast<fs::TimePoint::duration>(std::chrono::seconds(42)));
+  auto mock_fs = std::make_shared<fs::internal::MockFileSystem>(mtime);
+  std::shared_ptr<Schema> test_schema = schema({field("x", int32())});
+  std::shared_ptr<RecordBatch> batch = RecordBatchFromJSON(test_schema, "[[0]]");
+  ASSERT_OK_AND_ASSIGN(std::shared_ptr<io::OutputStream> out_stream,
+                       mock_fs->OpenOutputStream("/footer_cache.parquet"));
+  ASSERT_OK_AND_ASSIGN(
+      std::shared_ptr<FileWriter> writer,
+      format_->MakeWriter(out_stream, test_schema, format_->DefaultWriteOptions(),
+                          {mock_fs, "/footer_cache.parquet"}));
+  ASSERT_OK(writer->Write(batch));
+  ASSERT_FINISHES_OK(writer->Finish());
+
+  auto scan_fresh_fragment = [&](bool cache_metadata) {
+    FileSource source("/footer_cache.parquet", mock_fs);
+    EXPECT_OK_AND_ASSIGN(auto fragment,
+                         format_->MakeFragment(std::move(source), literal(true)));
+    auto options = std::make_shared<ScanOptions>();
+    options->filter = literal(true);
+    EXPECT_OK_AND_ASSIGN(
+        auto projection_descr,
+        ProjectionDescr::FromNames({"x"}, *test_schema, options->add_augmented_fields));
+    options->projected_schema = projection_descr.schema;
+    options->projection = projection_descr.expression;
+    auto parquet_options = std::make_shared<ParquetFragmentScanOptions>();
+    parquet_options->cache_metadata = cache_metadata;
+    options->fragment_scan_options = parquet_options;
+    EXPECT_OK_AND_ASSIGN(auto generator, fragment->ScanBatchesAsync(options));
+    EXPECT_FINISHES_OK_AND_ASSIGN(auto batches,
+                                  CollectAsyncGenerator(std::move(generator)));
+    EXPECT_EQ(batches.size(), 1);
+    return checked_cast<ParquetFileFragment*>(fragment.get())->metadata();
+  };
+
+  // Two fresh fragments with caching enabled share the parsed footer.
+  auto first = scan_fresh_fragment(/*cache_metadata=*/true);
+  ASSERT_NE(nullptr, first);
+  auto second = scan_fresh_fragment(/*cache_metadata=*/true);
+  ASSERT_EQ(first.get(), second.get());
+
+  // With caching disabled (the default) the footer is parsed again.
+  auto third = scan_fresh_fragment(/*cache_metadata=*/false);
+  ASSERT_NE(nullptr, third);
+  ASSERT_NE(first.get(), third.get());
+}
+
 TEST_F(TestParquetFileFormat, MultithreadedScan) {
   constexpr int64_t kNumRowGroups = 16;
 
@@ -621,6 +719,45 @@ TEST_P(TestParquetFileFormatScan, PredicatePushdown) {
                             kNumRowGroups - 5);
 }
 
+TEST_P(TestParquetFileFormatScan, ScanMetrics) {
+  constexpr int64_t kNumRowGroups = 16;
+  constexpr int64_t kTotalNumRows = kNumRowGroups * (kNumRowGroups + 1) / 2;
+
+  auto reader = ArithmeticDatasetFixture::GetRecordBatchReader(kNumRowGroups);
+  auto source = GetFileSource(reader.get());
+
+  SetSchema(reader->schema()->fields());
+  ASSERT_OK_AND_ASSIGN(auto fragment, format_->MakeFragment(*source));
+
+  // An unfiltered scan prunes nothing and decodes every row group
+  opts_->metrics = std::make_shared<ScanMetrics>();
+  SetFilter(literal(true));
+  CountRowsAndBatchesInScan(fragment, kTotalNumRows, kNumRowGroups);
+  EXPECT_EQ(opts_->metrics->row_groups_considered, kNumRowGroups);
+  EXPECT_EQ(opts_->metrics->row_groups_pruned, 0);
+  EXPECT_EQ(opts_->metrics->bytes_skipped, 0);
+  EXPECT_EQ(opts_->metrics->batches_decoded, kNumRowGroups);
+  EXPECT_GT(opts_->metrics->decode_wait_ns, 0);
+
+  // Statistics prune all but one row group and the skipped bytes are counted
+  opts_->metrics = std::make_shared<ScanMetrics>();
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(2)));
+  CountRowsAndBatchesInScan(fragment, 2, 1);
+  EXPECT_EQ(opts_->metrics->row_groups_considered, kNumRowGroups);
+  EXPECT_EQ(opts_->metrics->row_groups_pruned, kNumRowGroups - 1);
+  EXPECT_GT(opts_->metrics->bytes_skipped, 0);
+  EXPECT_EQ(opts_->metrics->batches_decoded, 1);
+  EXPECT_NE(opts_->metrics->ToString().find("row_groups_pruned=15"), std::string::npos);
+
+  // A filter matching nothing prunes everything before any IO
+  opts_->metrics = std::make_shared<ScanMetrics>();
+  SetFilter(equal(field_ref("i64"), literal<int64_t>(-1)));
+  CountRowsAndBatchesInScan(fragment, 0, 0);
+  EXPECT_EQ(opts_->metrics->row_groups_considered, kNumRowGroups);
+  EXPECT_EQ(opts_->metrics->row_groups_pruned, kNumRowGroups);
+  EXPECT_EQ(opts_->metrics->batches_decoded, 0);
+}
+
 TEST_P(TestParquetFileFormatScan, PredicatePushdownRowGroupFragments) {
   constexpr int64_t kNumRowGroups = 16;
 
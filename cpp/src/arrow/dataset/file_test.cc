@@ -137,6 +137,65 @@ TEST(FileFormat, ScanAsync) {
   }
 }
 
+// Accepts only equality predicates and returns a single pre-filtered batch so
+// tests can tell which scan path produced the output.
+class MockOffloadProvider : public ScanOffloadProvider {
+ public:
+  std::string name() const override { return "mock_offload"; }
+
+  bool CanOffloadPredicate(const cp::Expression& expr) const override {
+    return expr.call() != nullptr && expr.call()->function_name == "equal";
+  }
+
+  Result<RecordBatchGenerator> ScanOffloaded(
+      const std::shared_ptr<ScanOptions>& options,
+      const std::shared_ptr<FileFragment>& fragment,
+      cp::Expression predicate) override {
+    ++num_scans;
+    last_predicate = std::move(predicate);
+    auto sch = schema({field("i32", int32())});
+    RecordBatchVector batches = {ConstantArrayGenerator::Zeroes(kRowsPerBatch, sch)};
+    return MakeVectorGenerator(std::move(batches));
+  }
+
+  int num_scans = 0;
+  cp::Expression last_predicate;
+};
+
+TEST(FileFormat, ScanOffload) {
+  auto format = std::make_shared<MockFileFormat>();
+  auto provider = std::make_shared<MockOffloadProvider>();
+  format->scan_offload_provider = provider;
+
+  auto offloadable = cp::equal(cp::field_ref("i32"), cp::literal(0));
+  auto local = cp::greater(cp::field_ref("i32"), cp::literal(-1));
+
+  // Only the accepted conjunction member goes to the provider
+  auto split = SplitFilterForOffload(cp::and_(offloadable, local), *provider);
+  EXPECT_EQ(split.first, offloadable);
+  EXPECT_EQ(split.second, local);
+
+  auto sch = schema({field("i32", int32())});
+  ASSERT_OK_AND_ASSIGN(
+      auto fragment,
+      format->MakeFragment(FileSource(std::make_shared<Buffer>("mock")), sch));
+
+  auto scan_options = std::make_shared<ScanOptions>();
+  scan_options->filter = cp::and_(offloadable, local);
+  ASSERT_OK_AND_ASSIGN(auto batch_gen, fragment->ScanBatchesAsync(scan_options));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(batch_gen));
+  ASSERT_EQ(1, static_cast<int>(batches.size()));
+  ASSERT_EQ(1, provider->num_scans);
+  EXPECT_EQ(provider->last_predicate, offloadable);
+
+  // A filter with no offloadable member falls back to the local format scan
+  scan_options->filter = local;
+  ASSERT_OK_AND_ASSIGN(batch_gen, fragment->ScanBatchesAsync(scan_options));
+  ASSERT_FINISHES_OK_AND_ASSIGN(batches, CollectAsyncGenerator(batch_gen));
+  ASSERT_EQ(kNumBatches, static_cast<int>(batches.size()));
+  ASSERT_EQ(1, provider->num_scans);
+}
+
 TEST_F(TestFileSystemDataset, Basic) {
   MakeDataset({});
   AssertFragmentsAreFromPath(*dataset_->GetFragments(), {});
@@ -268,6 +327,45 @@ TEST_F(TestFileSystemDataset, TreePartitionPruning) {
                              franklins);
 }
 
+TEST_F(TestFileSystemDataset, PartitionIndexPruning) {
+  // Equality predicates are answered by the partition value index; fragments
+  // that don't pin the queried field must stay candidates.
+  std::vector<fs::FileInfo> files = {fs::File("x=1/a"), fs::File("x=1/b"),
+                                     fs::File("x=2/c"), fs::File("unpartitioned")};
+  std::vector<compute::Expression> partitions = {
+      and_(equal(field_ref("x"), literal(1)), equal(field_ref("y"), literal(10))),
+      and_(equal(field_ref("x"), literal(1)), equal(field_ref("y"), literal(20))),
+      equal(field_ref("x"), literal(2)),
+      // No equality on x or y; must match any value of either
+      greater(field_ref("y"), literal(0)),
+  };
+  MakeDataset(files, literal(true), partitions,
+              schema({field("x", int32()), field("y", int32())}));
+
+  auto GetFragments = [&](compute::Expression filter) {
+    return *dataset_->GetFragments(*filter.Bind(*dataset_->schema()));
+  };
+
+  AssertFragmentsAreFromPath(GetFragments(equal(field_ref("x"), literal(1))),
+                             {"x=1/a", "x=1/b", "unpartitioned"});
+  AssertFragmentsAreFromPath(GetFragments(equal(field_ref("x"), literal(2))),
+                             {"x=2/c", "unpartitioned"});
+  AssertFragmentsAreFromPath(GetFragments(equal(field_ref("x"), literal(3))),
+                             {"unpartitioned"});
+  // Intersection across indexed fields
+  AssertFragmentsAreFromPath(GetFragments(and_(equal(field_ref("x"), literal(1)),
+                                               equal(field_ref("y"), literal(20)))),
+                             {"x=1/b", "unpartitioned"});
+  // Residual non-equality clauses are still applied to each candidate
+  AssertFragmentsAreFromPath(GetFragments(and_(equal(field_ref("x"), literal(1)),
+                                               greater(field_ref("y"), literal(15)))),
+                             {"x=1/b", "unpartitioned"});
+  // A predicate value of a different numeric type still matches
+  AssertFragmentsAreFromPath(
+      GetFragments(equal(field_ref("x"), literal(int64_t{2}))),
+      {"x=2/c", "unpartitioned"});
+}
+
 TEST_F(TestFileSystemDataset, FragmentPartitions) {
   auto root_partition = equal(field_ref("country"), literal("US"));
   std::vector<fs::FileInfo> regions = {
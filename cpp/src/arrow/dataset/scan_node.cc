@@ -20,15 +20,19 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "arrow/acero/bloom_filter.h"
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/query_context.h"
 #include "arrow/acero/util.h"
 #include "arrow/compute/expression.h"
 #include "arrow/compute/expression_internal.h"
+#include "arrow/dataset/file_base.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -120,7 +124,9 @@ Future<AsyncGenerator<std::shared_ptr<Fragment>>> GetFragments(
 /// fragments.  On destruction we continue consuming the fragments until they complete
 /// (which should be fairly quick since we cancelled the fragment).  This ensures the
 /// I/O work is completely finished before the node is destroyed.
-class ScanNode : public acero::ExecNode, public acero::TracedNode {
+class ScanNode : public acero::ExecNode,
+                 public acero::TracedNode,
+                 public acero::BloomFilterSink {
  public:
   ScanNode(acero::ExecPlan* plan, ScanV2Options options,
            std::shared_ptr<Schema> output_schema)
@@ -145,6 +151,14 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
           "Batch readahead may not be less than 0.  Set to 0 to disable readahead");
     }
 
+    for (const auto& [fs_type, bytes_readahead] : options.per_filesystem_bytes_readahead) {
+      if (bytes_readahead < 0) {
+        return Status::Invalid("Per-filesystem byte readahead for '", fs_type,
+                               "' may not be less than 0.  Set to 0 to disable "
+                               "readahead");
+      }
+    }
+
     if (!normalized.filter.is_valid()) {
       normalized.filter = compute::literal(true);
     }
@@ -263,8 +277,9 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
               batch, node_->options_.columns, *scan_->scan_request.fragment_selection));
       compute::ExecBatch with_known_values = AddKnownValues(std::move(evolved_batch));
       node_->plan_->query_context()->ScheduleTask(
-          [node = node_, output_batch = std::move(with_known_values)] {
-            return node->output_->InputReceived(node, output_batch);
+          [node = node_, output_batch = std::move(with_known_values)]() mutable {
+            ARROW_RETURN_NOT_OK(node->ApplyBloomFilters(&output_batch));
+            return node->output_->InputReceived(node, std::move(output_batch));
           },
           "ScanNode::ProcessMorsel");
       return Status::OK();
@@ -381,7 +396,7 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
       };
 
       std::unique_ptr<util::AsyncTaskGroup> scan_tasks = util::AsyncTaskGroup::Make(
-          node->batches_throttle_.get(),
+          node->BatchesThrottleForFragment(*fragment),
           StateHolder{list_and_scan_done, std::move(scan_state)});
       for (int i = 0; i < fragment_scanner->NumBatches(); i++) {
         node->num_batches_.fetch_add(1);
@@ -440,6 +455,11 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
     NoteStartProducing(ToStringExtra());
     batches_throttle_ = util::ThrottledAsyncTaskScheduler::Make(
         plan_->query_context()->async_scheduler(), options_.target_bytes_readahead + 1);
+    for (const auto& [fs_type, bytes_readahead] :
+         options_.per_filesystem_bytes_readahead) {
+      filesystem_throttles_[fs_type] = util::ThrottledAsyncTaskScheduler::Make(
+          plan_->query_context()->async_scheduler(), bytes_readahead + 1);
+    }
     plan_->query_context()->async_scheduler()->AddSimpleTask(
         [this] {
           return GetFragments(options_.dataset.get(), options_.filter)
@@ -461,10 +481,68 @@ class ScanNode : public acero::ExecNode, public acero::TracedNode {
 
   Status StopProducingImpl() override { return Status::OK(); }
 
+  void ReceiveBloomFilter(std::unique_ptr<acero::BlockedBloomFilter> filter,
+                          std::vector<int> column_map) override {
+    std::lock_guard<std::mutex> lk(bloom_filters_mutex_);
+    bloom_filters_.push_back(std::move(filter));
+    bloom_filter_maps_.push_back(std::move(column_map));
+  }
+
  private:
+  // Drop rows rejected by any Bloom filter received from a downstream hash
+  // join.  Filters can arrive at any time; batches emitted before a filter
+  // arrives are filtered by the join itself.
+  Status ApplyBloomFilters(compute::ExecBatch* batch) {
+    std::vector<std::pair<const acero::BlockedBloomFilter*, std::vector<int>>> filters;
+    {
+      std::lock_guard<std::mutex> lk(bloom_filters_mutex_);
+      if (bloom_filters_.empty()) {
+        return Status::OK();
+      }
+      filters.reserve(bloom_filters_.size());
+      for (size_t i = 0; i < bloom_filters_.size(); ++i) {
+        filters.emplace_back(bloom_filters_[i].get(), bloom_filter_maps_[i]);
+      }
+    }
+    for (const auto& [filter, column_map] : filters) {
+      RETURN_NOT_OK(acero::FilterBatchWithBloomFilter(
+          plan_->query_context()->exec_context(),
+          plan_->query_context()->cpu_info()->hardware_flags(), *filter, column_map,
+          batch));
+    }
+    return Status::OK();
+  }
+
+  // Pick the in-flight-bytes throttle that governs a fragment's scan tasks.
+  // Fragments on a filesystem with a per-filesystem readahead override get a
+  // dedicated throttle so tiers with very different bandwidth don't share a
+  // single byte budget; everything else shares the global throttle.
+  util::ThrottledAsyncTaskScheduler* BatchesThrottleForFragment(
+      const Fragment& fragment) {
+    if (!filesystem_throttles_.empty()) {
+      if (const auto* file_fragment = dynamic_cast<const FileFragment*>(&fragment)) {
+        const auto& filesystem = file_fragment->source().filesystem();
+        if (filesystem) {
+          auto it = filesystem_throttles_.find(filesystem->type_name());
+          if (it != filesystem_throttles_.end()) {
+            return it->second.get();
+          }
+        }
+      }
+    }
+    return batches_throttle_.get();
+  }
+
   ScanV2Options options_;
   std::atomic<int> num_batches_{0};
   std::shared_ptr<util::ThrottledAsyncTaskScheduler> batches_throttle_;
+  // Keyed by filesystem type name; created at StartProducing from
+  // ScanV2Options::per_filesystem_bytes_readahead.
+  std::unordered_map<std::string, std::shared_ptr<util::ThrottledAsyncTaskScheduler>>
+      filesystem_throttles_;
+  std::mutex bloom_filters_mutex_;
+  std::vector<std::unique_ptr<acero::BlockedBloomFilter>> bloom_filters_;
+  std::vector<std::vector<int>> bloom_filter_maps_;
 };
 
 }  // namespace
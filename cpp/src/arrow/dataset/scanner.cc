@@ -19,15 +19,18 @@
 
 #include <algorithm>
 #include <condition_variable>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <numeric>
 #include <set>
 #include <sstream>
+#include <unordered_map>
 
 #include "arrow/acero/exec_plan.h"
 #include "arrow/acero/options.h"
 #include "arrow/acero/query_context.h"
+#include "arrow/array/array_nested.h"
 #include "arrow/array/array_primitive.h"
 #include "arrow/array/util.h"
 #include "arrow/compute/api_aggregate.h"
@@ -40,6 +43,7 @@
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/util/async_generator.h"
+#include "arrow/util/byte_size.h"
 #include "arrow/util/config.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging_internal.h"
@@ -59,6 +63,83 @@ namespace dataset {
 
 using FragmentGenerator = std::function<Future<std::shared_ptr<Fragment>>()>;
 
+namespace {
+
+class FragmentResultCacheImpl : public FragmentResultCache {
+ public:
+  explicit FragmentResultCacheImpl(int64_t max_cached_bytes)
+      : max_cached_bytes_(max_cached_bytes) {}
+
+  std::optional<RecordBatchVector> Get(const std::string& key) override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      return std::nullopt;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second);
+    return it->second->batches;
+  }
+
+  void Insert(const std::string& key, RecordBatchVector batches) override {
+    int64_t bytes = 0;
+    for (const auto& batch : batches) {
+      bytes += util::TotalBufferSize(*batch);
+    }
+    if (bytes > max_cached_bytes_) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      lru_.splice(lru_.begin(), lru_, it->second);
+      return;
+    }
+    lru_.push_front(Entry{key, std::move(batches), bytes});
+    entries_[key] = lru_.begin();
+    cached_bytes_ += bytes;
+    while (cached_bytes_ > max_cached_bytes_) {
+      cached_bytes_ -= lru_.back().bytes;
+      entries_.erase(lru_.back().key);
+      lru_.pop_back();
+    }
+  }
+
+  int64_t cached_bytes() const override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cached_bytes_;
+  }
+
+ private:
+  struct Entry {
+    std::string key;
+    RecordBatchVector batches;
+    int64_t bytes;
+  };
+
+  mutable std::mutex mutex_;
+  // Most recently used entries at the front
+  std::list<Entry> lru_;
+  std::unordered_map<std::string, std::list<Entry>::iterator> entries_;
+  const int64_t max_cached_bytes_;
+  int64_t cached_bytes_ = 0;
+};
+
+}  // namespace
+
+std::shared_ptr<FragmentResultCache> FragmentResultCache::Make(int64_t max_cached_bytes) {
+  return std::make_shared<FragmentResultCacheImpl>(max_cached_bytes);
+}
+
+std::string ScanMetrics::ToString() const {
+  std::stringstream ss;
+  ss << "row_groups_considered=" << row_groups_considered.load()
+     << " row_groups_pruned=" << row_groups_pruned.load()
+     << " bytes_skipped=" << bytes_skipped.load()
+     << " batches_decoded=" << batches_decoded.load()
+     << " decode_wait_ns=" << decode_wait_ns.load();
+  return ss.str();
+}
+
 std::vector<FieldRef> ScanOptions::MaterializedFields() const {
   std::vector<FieldRef> fields;
 
@@ -253,6 +334,75 @@ Status NormalizeScanOptions(const std::shared_ptr<ScanOptions>& scan_options,
 
 }  // namespace
 
+Result<RecordBatchGenerator> MakeProjectedBatchGenerator(
+    RecordBatchGenerator gen, const std::shared_ptr<ScanOptions>& options,
+    compute::Expression partition_expression) {
+  if (options->dataset_schema == nullptr || options->projected_schema == nullptr ||
+      !options->projection.IsBound()) {
+    return Status::Invalid(
+        "Projection pushdown requires normalized scan options with a bound projection");
+  }
+  // The scan plan's filter node sees batches simplified by each fragment's
+  // guarantee; do the same simplification here so partition clauses don't
+  // execute per batch.
+  ARROW_ASSIGN_OR_RAISE(
+      compute::Expression filter,
+      compute::SimplifyWithGuarantee(options->filter, partition_expression));
+  // The stored projection may have been bound against the projected schema;
+  // rebind it against the dataset schema the exec batches are built from.
+  ARROW_ASSIGN_OR_RAISE(compute::Expression projection,
+                        options->projection.Bind(*options->dataset_schema));
+  auto map_batch = [options, filter, projection, partition_expression](
+                       const std::shared_ptr<RecordBatch>& in)
+      -> Result<std::shared_ptr<RecordBatch>> {
+    compute::ExecContext exec_context(options->pool);
+    std::shared_ptr<RecordBatch> batch = in;
+    // Evaluate what's left of the filter first so computed projection columns
+    // are only materialized for surviving rows.
+    if (filter != compute::literal(true)) {
+      ARROW_ASSIGN_OR_RAISE(compute::ExecBatch filter_input,
+                            compute::MakeExecBatch(*options->dataset_schema, batch,
+                                                   partition_expression));
+      ARROW_ASSIGN_OR_RAISE(
+          Datum mask,
+          compute::ExecuteScalarExpression(filter, filter_input, &exec_context));
+      if (mask.is_scalar()) {
+        const auto& mask_scalar = mask.scalar_as<BooleanScalar>();
+        if (!mask_scalar.is_valid || !mask_scalar.value) {
+          batch = batch->Slice(0, 0);
+        }
+      } else {
+        ARROW_ASSIGN_OR_RAISE(
+            Datum filtered, compute::Filter(batch, mask,
+                                            compute::FilterOptions::Defaults(),
+                                            &exec_context));
+        batch = filtered.record_batch();
+      }
+    }
+    ARROW_ASSIGN_OR_RAISE(
+        compute::ExecBatch project_input,
+        compute::MakeExecBatch(*options->dataset_schema, batch, partition_expression));
+    ARROW_ASSIGN_OR_RAISE(Datum projected,
+                          compute::ExecuteScalarExpression(projection, project_input,
+                                                           &exec_context));
+    compute::ExecBatch projected_batch({}, batch->num_rows());
+    if (projected.is_scalar()) {
+      const auto& struct_scalar = checked_cast<const StructScalar&>(*projected.scalar());
+      for (const auto& value : struct_scalar.value) {
+        projected_batch.values.emplace_back(value);
+      }
+    } else {
+      const auto& struct_array =
+          checked_cast<const StructArray&>(*projected.make_array());
+      for (const auto& column : struct_array.fields()) {
+        projected_batch.values.emplace_back(column);
+      }
+    }
+    return projected_batch.ToRecordBatch(options->projected_schema, options->pool);
+  };
+  return MakeMappedGenerator(std::move(gen), std::move(map_batch));
+}
+
 namespace {
 
 class AsyncScanner : public Scanner, public std::enable_shared_from_this<AsyncScanner> {
@@ -449,12 +599,22 @@ Result<EnumeratedRecordBatchGenerator> AsyncScanner::ScanBatchesUnorderedAsync(
   auto names = checked_cast<const compute::MakeStructOptions*>(
                    scan_options_->projection.call()->options.get())
                    ->field_names;
+  compute::Expression plan_filter = scan_options_->filter;
+  if (scan_options_->pushdown_projection) {
+    // The fragments have already filtered and projected each batch; the plan
+    // only needs to pass the projected columns through.
+    plan_filter = compute::literal(true);
+    exprs.clear();
+    for (const auto& name : names) {
+      exprs.push_back(compute::field_ref(name));
+    }
+  }
 
   RETURN_NOT_OK(
       acero::Declaration::Sequence(
           {
               {"scan", ScanNodeOptions{dataset_, scan_options_, sequence_fragments}},
-              {"filter", acero::FilterNodeOptions{scan_options_->filter}},
+              {"filter", acero::FilterNodeOptions{std::move(plan_filter)}},
               {"augmented_project",
                acero::ProjectNodeOptions{std::move(exprs), std::move(names)}},
               {"sink", acero::SinkNodeOptions{&sink_gen, /*schema=*/nullptr,
@@ -488,12 +648,18 @@ Result<EnumeratedRecordBatchGenerator> AsyncScanner::ScanBatchesUnorderedAsync(
         return ToEnumeratedRecordBatch(batch, *options, *shared_fragments);
       });
 
-  return [mapped_gen = std::move(mapped_gen), plan = std::move(plan),
+  return [mapped_gen = std::move(mapped_gen), plan = std::move(plan), options,
           stop_producing = std::move(stop_producing)] {
     auto next = mapped_gen();
-    return next.Then([plan](const EnumeratedRecordBatch& value) {
+    return next.Then([plan, options](const EnumeratedRecordBatch& value) {
       if (IsIterationEnd(value)) {
-        return plan->finished().Then([value] { return value; });
+        return plan->finished().Then([value, options] {
+          if (options->metrics) {
+            EVENT_ON_CURRENT_SPAN("Scanner::ScanMetrics",
+                                  {{"metrics", options->metrics->ToString()}});
+          }
+          return value;
+        });
       }
       return Future<EnumeratedRecordBatch>::MakeFinished(value);
     });
@@ -946,6 +1112,11 @@ Status ScannerBuilder::CacheMetadata(bool cache_metadata) {
   return Status::OK();
 }
 
+Status ScannerBuilder::PushdownProjection(bool pushdown_projection) {
+  scan_options_->pushdown_projection = pushdown_projection;
+  return Status::OK();
+}
+
 Status ScannerBuilder::BatchSize(int64_t batch_size) {
   if (batch_size <= 0) {
     return Status::Invalid("BatchSize must be greater than 0, got ", batch_size);
@@ -954,6 +1125,11 @@ Status ScannerBuilder::BatchSize(int64_t batch_size) {
   return Status::OK();
 }
 
+Status ScannerBuilder::PreserveFragmentBatches(bool preserve_fragment_batches) {
+  scan_options_->preserve_fragment_batches = preserve_fragment_batches;
+  return Status::OK();
+}
+
 Status ScannerBuilder::BatchReadahead(int32_t batch_readahead) {
   if (batch_readahead < 0) {
     return Status::Invalid("BatchReadahead must be greater than or equal 0, got ",
@@ -1003,6 +1179,83 @@ Result<std::shared_ptr<Scanner>> ScannerBuilder::Finish() {
 
 namespace {
 
+// Build one ordered source per fragment and k-way merge them so rows come
+// out in the dataset's declared order while fragments are still read in
+// parallel.  Each fragment's batches are concatenated sequentially, which
+// preserves the in-file order the ordering declaration promises.
+Result<acero::ExecNode*> MakeOrderedScanNode(acero::ExecPlan* plan,
+                                             const std::shared_ptr<Dataset>& dataset,
+                                             const std::shared_ptr<ScanOptions>& scan_options,
+                                             std::vector<std::shared_ptr<Fragment>> fragments) {
+  const compute::Ordering& ordering = dataset->ordering();
+  if (ordering.is_unordered() || ordering.is_implicit()) {
+    return Status::Invalid(
+        "An order-preserving scan requires the dataset to declare an explicit "
+        "ordering");
+  }
+
+  auto fields = scan_options->pushdown_projection
+                    ? scan_options->projected_schema->fields()
+                    : scan_options->dataset_schema->fields();
+  if (scan_options->add_augmented_fields) {
+    for (const auto& aug_field : kAugmentedFields) {
+      fields.push_back(aug_field);
+    }
+  }
+  std::shared_ptr<Schema> output_schema = schema(std::move(fields));
+
+  std::vector<acero::ExecNode*> fragment_sources;
+  fragment_sources.reserve(fragments.size());
+  for (size_t i = 0; i < fragments.size(); ++i) {
+    auto fragment_gen =
+        MakeVectorGenerator(std::vector<std::shared_ptr<Fragment>>{fragments[i]});
+    ARROW_ASSIGN_OR_RAISE(auto batch_gen_gen,
+                          FragmentsToBatches(std::move(fragment_gen), scan_options));
+    auto batch_gen = MakeConcatenatedGenerator(std::move(batch_gen_gen));
+    const int fragment_index = static_cast<int>(i);
+    auto gen = MakeMappedGenerator(
+        std::move(batch_gen),
+        [scan_options, fragment_index](const EnumeratedRecordBatch& partial)
+            -> Result<std::optional<compute::ExecBatch>> {
+          auto guarantee = partial.fragment.value->partition_expression();
+          const auto& mapped_schema = scan_options->pushdown_projection
+                                          ? scan_options->projected_schema
+                                          : scan_options->dataset_schema;
+          ARROW_ASSIGN_OR_RAISE(
+              std::optional<compute::ExecBatch> batch,
+              compute::MakeExecBatch(*mapped_schema, partial.record_batch.value,
+                                     guarantee));
+          // tag rows with fragment- and batch-of-origin; the fragment index
+          // of the per-fragment enumeration is always 0 so use the real one
+          batch->values.emplace_back(fragment_index);
+          batch->values.emplace_back(partial.record_batch.index);
+          batch->values.emplace_back(partial.record_batch.last);
+          batch->values.emplace_back(partial.fragment.value->ToString());
+          return batch;
+        });
+    ARROW_ASSIGN_OR_RAISE(
+        acero::ExecNode * source,
+        acero::MakeExecNode("source", plan, {},
+                            acero::SourceNodeOptions{output_schema, std::move(gen),
+                                                     ordering}));
+    fragment_sources.push_back(source);
+  }
+
+  if (fragment_sources.empty()) {
+    // No fragment survived pruning; an empty source is trivially ordered
+    return acero::MakeExecNode(
+        "source", plan, {},
+        acero::SourceNodeOptions{
+            std::move(output_schema),
+            MakeEmptyGenerator<std::optional<compute::ExecBatch>>(), ordering});
+  }
+  if (fragment_sources.size() == 1) {
+    return fragment_sources[0];
+  }
+  return acero::MakeExecNode("sorted_merge", plan, std::move(fragment_sources),
+                             acero::OrderByNodeOptions{ordering});
+}
+
 Result<acero::ExecNode*> MakeScanNode(acero::ExecPlan* plan,
                                       std::vector<acero::ExecNode*> inputs,
                                       const acero::ExecNodeOptions& options) {
@@ -1017,6 +1270,16 @@ Result<acero::ExecNode*> MakeScanNode(acero::ExecPlan* plan,
   // using a generator for speculative forward compatibility with async fragment discovery
   ARROW_ASSIGN_OR_RAISE(auto fragments_it, dataset->GetFragments(scan_options->filter));
   ARROW_ASSIGN_OR_RAISE(auto fragments_vec, fragments_it.ToVector());
+
+  if (scan_node_options.preserve_dataset_ordering) {
+    if (require_sequenced_output || implicit_ordering) {
+      return Status::Invalid(
+          "preserve_dataset_ordering cannot be combined with "
+          "require_sequenced_output or implicit_ordering");
+    }
+    return MakeOrderedScanNode(plan, dataset, scan_options, std::move(fragments_vec));
+  }
+
   auto fragment_gen = MakeVectorGenerator(std::move(fragments_vec));
 
   ARROW_ASSIGN_OR_RAISE(auto batch_gen_gen,
@@ -1058,10 +1321,15 @@ Result<acero::ExecNode*> MakeScanNode(acero::ExecPlan* plan,
         // letting them coast through the rest of the plan.
         auto guarantee = partial.fragment.value->partition_expression();
 
+        // Under projection pushdown the fragments emit already-projected
+        // batches, so they are mapped against the projected schema.
+        const auto& mapped_schema = scan_options->pushdown_projection
+                                        ? scan_options->projected_schema
+                                        : scan_options->dataset_schema;
         ARROW_ASSIGN_OR_RAISE(
             std::optional<compute::ExecBatch> batch,
-            compute::MakeExecBatch(*scan_options->dataset_schema,
-                                   partial.record_batch.value, guarantee));
+            compute::MakeExecBatch(*mapped_schema, partial.record_batch.value,
+                                   guarantee));
 
         // tag rows with fragment- and batch-of-origin
         batch->values.emplace_back(partial.fragment.index);
@@ -1073,7 +1341,9 @@ Result<acero::ExecNode*> MakeScanNode(acero::ExecPlan* plan,
 
   auto ordering = implicit_ordering ? Ordering::Implicit() : Ordering::Unordered();
 
-  auto fields = scan_options->dataset_schema->fields();
+  auto fields = scan_options->pushdown_projection
+                    ? scan_options->projected_schema->fields()
+                    : scan_options->dataset_schema->fields();
   if (scan_options->add_augmented_fields) {
     for (const auto& aug_field : kAugmentedFields) {
       fields.push_back(aug_field);
@@ -19,9 +19,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -53,6 +56,63 @@ constexpr int32_t kDefaultBatchReadahead = 16;
 constexpr int32_t kDefaultFragmentReadahead = 4;
 constexpr int32_t kDefaultBytesReadahead = 1 << 25;  // 32MiB
 
+/// \brief An opt-in, memory-budgeted cache of decoded batches keyed by
+/// fragment identity and scan shape.
+///
+/// Workloads that re-scan the same fragments with the same projection and
+/// filter (e.g. dashboard refreshes) can attach a shared cache to
+/// ScanOptions::fragment_cache.  A cache hit serves the decoded batches of a
+/// whole fragment without touching the file or the decoder; the cached
+/// batches are shared, so serving a hit is zero-copy.
+///
+/// Entries are keyed by the fragment's path, size and modification time plus
+/// a fingerprint of the scan's filter, projection and batch size, so a
+/// modified file or a different scan shape never produces a stale hit.
+/// Least-recently-used entries are evicted once the total cached bytes would
+/// exceed the budget.  The cache is safe to share between concurrent scans.
+class ARROW_DS_EXPORT FragmentResultCache {
+ public:
+  virtual ~FragmentResultCache() = default;
+
+  /// \brief Create a cache holding at most max_cached_bytes of decoded batches
+  static std::shared_ptr<FragmentResultCache> Make(int64_t max_cached_bytes);
+
+  /// \brief Return the cached batches for key, or nullopt on a miss
+  virtual std::optional<RecordBatchVector> Get(const std::string& key) = 0;
+
+  /// \brief Cache the batches of a fully scanned fragment under key
+  ///
+  /// Entries larger than the cache budget are silently dropped.  Inserting an
+  /// existing key refreshes its recency but keeps the original batches.
+  virtual void Insert(const std::string& key, RecordBatchVector batches) = 0;
+
+  /// \brief Total decoded bytes currently held by the cache
+  virtual int64_t cached_bytes() const = 0;
+};
+
+/// \brief Counters accumulated over the course of a single scan.
+///
+/// Attach an instance to ScanOptions::metrics to find out why a scan was slow
+/// (or fast): how much data pruning skipped, how many batches were decoded
+/// and how long the scan waited on them.  Formats that don't support a
+/// counter simply leave it at zero.
+struct ARROW_DS_EXPORT ScanMetrics {
+  /// Row groups (or equivalent format units) a fragment's scan looked at
+  std::atomic<int64_t> row_groups_considered{0};
+  /// Row groups skipped by statistics, page index or bloom filter pruning
+  std::atomic<int64_t> row_groups_pruned{0};
+  /// Compressed bytes that pruning avoided reading
+  std::atomic<int64_t> bytes_skipped{0};
+  /// Decoded batches emitted by fragments
+  std::atomic<int64_t> batches_decoded{0};
+  /// Wall clock nanoseconds the scan spent waiting for decoded batches;
+  /// this covers both IO and decode since pulls block on both
+  std::atomic<int64_t> decode_wait_ns{0};
+
+  /// \brief Render the counters on one line, e.g. for a log record or span event
+  std::string ToString() const;
+};
+
 /// Scan-specific options, which can be changed between scans of the same dataset.
 struct ARROW_DS_EXPORT ScanOptions {
   /// A row filter (which will be pushed down to partitioning/reading if supported).
@@ -99,6 +159,22 @@ struct ARROW_DS_EXPORT ScanOptions {
   /// A pool from which materialized and scanned arrays will be allocated.
   MemoryPool* pool = arrow::default_memory_pool();
 
+  /// \brief If set, decoded fragment results are cached in (and served from)
+  /// this cache.
+  ///
+  /// Only fragments backed by a filesystem path have a stable identity and
+  /// participate; in-memory and custom sources are always decoded.
+  std::shared_ptr<FragmentResultCache> fragment_cache;
+
+  /// \brief Counters describing what happened during the scan
+  ///
+  /// Attach an instance to have formats and the scan plumbing record pruning
+  /// and decode statistics as they go.  Counters are atomic and only ever
+  /// incremented, so they may be inspected while the scan is still running.
+  /// When set, the scanner also emits the rendered counters as an event on
+  /// the active tracing span once the scan plan finishes.
+  std::shared_ptr<ScanMetrics> metrics;
+
   /// IOContext for any IO tasks
   ///
   /// Note: The IOContext executor will be ignored if use_threads is set to false
@@ -122,6 +198,31 @@ struct ARROW_DS_EXPORT ScanOptions {
   /// lessen memory use.
   bool cache_metadata = true;
 
+  /// If true, the filter and projection are evaluated against each batch as
+  /// soon as it is decoded, inside the fragment scan.
+  ///
+  /// Computed projections (substrings, casts, arithmetic) normally run in the
+  /// scan plan, after decoded batches have crossed the readahead queues.  When
+  /// the projection shrinks wide input columns to small outputs, evaluating it
+  /// per decoded batch keeps the readahead queues holding only the bytes the
+  /// query ultimately needs.  The scan plan then skips its own filter and
+  /// re-projection.
+  ///
+  /// File-based and in-memory fragments support this; custom Fragment
+  /// implementations that don't consult this flag are unaffected and continue
+  /// to be filtered and projected by the plan.
+  bool pushdown_projection = false;
+
+  /// If true, fragments forward their decoded batches as-is instead of
+  /// re-slicing them to batch_size.
+  ///
+  /// Batch sizes then follow the source's layout (e.g. parquet row group
+  /// size) and batches never span fragment boundaries.  Declare this only
+  /// when every consumer of the scan accepts arbitrary batch sizes; it
+  /// removes the per-batch slicing work the fixed batch size otherwise
+  /// causes.
+  bool preserve_fragment_batches = false;
+
   /// Fragment-specific scan options.
   std::shared_ptr<FragmentScanOptions> fragment_scan_options;
 
@@ -246,6 +347,20 @@ struct ARROW_DS_EXPORT ScanV2Options : public acero::ExecNodeOptions {
   /// total readahead will still be 32MiB and NOT 20 * 32MiB.
   int32_t target_bytes_readahead = kDefaultBytesReadahead;
 
+  /// \brief Per-filesystem overrides for target_bytes_readahead
+  ///
+  /// Keys are filesystem type names (e.g. "local", "s3").  Batches read from a
+  /// fragment whose data lives on a matching filesystem count against a dedicated
+  /// readahead budget of the given size instead of the global one.  This keeps a
+  /// scan over a dataset that mixes device classes (e.g. local NVMe and an object
+  /// store) from letting the slow tier's in-flight reads crowd out the fast tier,
+  /// or vice versa: each tier is admitted up to its own in-flight byte target.
+  ///
+  /// Fragments that are not file-based, or whose filesystem type has no entry
+  /// here, fall back to target_bytes_readahead.  Values follow the same
+  /// semantics as target_bytes_readahead (0 reads one batch at a time).
+  std::unordered_map<std::string, int32_t> per_filesystem_bytes_readahead;
+
   /// \brief Number of fragments to read ahead
   ///
   /// Higher readahead will potentially lead to more efficient I/O but will lead
@@ -530,6 +645,14 @@ class ARROW_DS_EXPORT ScannerBuilder {
   /// lessen memory use.
   Status CacheMetadata(bool cache_metadata = true);
 
+  /// \brief Indicate if the filter and projection should be evaluated inside
+  ///        the fragment scan, per decoded batch.
+  ///
+  /// See ScanOptions::pushdown_projection.  This shrinks the bytes held in
+  /// readahead queues when the projection computes small outputs from wide
+  /// input columns.
+  Status PushdownProjection(bool pushdown_projection = true);
+
   /// \brief Set the maximum number of rows per RecordBatch.
   ///
   /// \param[in] batch_size the maximum number of rows.
@@ -538,6 +661,12 @@ class ARROW_DS_EXPORT ScannerBuilder {
   /// This option provides a control limiting the memory owned by any RecordBatch.
   Status BatchSize(int64_t batch_size);
 
+  /// \brief Forward fragment batches as-is instead of re-slicing to BatchSize.
+  ///
+  /// See ScanOptions::preserve_fragment_batches.  Only declare this when
+  /// every consumer of the scan accepts arbitrary batch sizes.
+  Status PreserveFragmentBatches(bool preserve_fragment_batches = true);
+
   /// \brief Set the number of batches to read ahead within a fragment.
   ///
   /// \param[in] batch_readahead How many batches to read ahead within a fragment
@@ -588,21 +717,29 @@ class ARROW_DS_EXPORT ScannerBuilder {
 ///
 /// Yielded batches will be augmented with fragment/batch indices when
 /// implicit_ordering=true to enable stable ordering for simple ExecPlans.
+///
+/// When preserve_dataset_ordering=true the dataset must declare an explicit
+/// ordering (see Dataset::ordering); fragment streams are then read in
+/// parallel and k-way merged so the node emits rows in the declared order
+/// without a sort.
 class ARROW_DS_EXPORT ScanNodeOptions : public acero::ExecNodeOptions {
  public:
   explicit ScanNodeOptions(std::shared_ptr<Dataset> dataset,
                            std::shared_ptr<ScanOptions> scan_options,
                            bool require_sequenced_output = false,
-                           bool implicit_ordering = false)
+                           bool implicit_ordering = false,
+                           bool preserve_dataset_ordering = false)
       : dataset(std::move(dataset)),
         scan_options(std::move(scan_options)),
         require_sequenced_output(require_sequenced_output),
-        implicit_ordering(implicit_ordering) {}
+        implicit_ordering(implicit_ordering),
+        preserve_dataset_ordering(preserve_dataset_ordering) {}
 
   std::shared_ptr<Dataset> dataset;
   std::shared_ptr<ScanOptions> scan_options;
   bool require_sequenced_output;
   bool implicit_ordering;
+  bool preserve_dataset_ordering;
 };
 
 /// @}
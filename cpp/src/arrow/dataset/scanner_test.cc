@@ -663,6 +663,58 @@ TEST(TestNewScanner, Backpressure) {
                            ::arrow::internal::GetCpuThreadPool());
 }
 
+TEST(FragmentResultCache, BudgetedEviction) {
+  std::shared_ptr<RecordBatch> batch = MakeTestBatch(0);
+  int64_t batch_bytes = util::TotalBufferSize(*batch);
+
+  auto cache = FragmentResultCache::Make(/*max_cached_bytes=*/2 * batch_bytes);
+  ASSERT_FALSE(cache->Get("a").has_value());
+
+  cache->Insert("a", {batch});
+  cache->Insert("b", {batch});
+  ASSERT_EQ(2 * batch_bytes, cache->cached_bytes());
+
+  // Hits are served as the original shared batches (zero-copy)
+  auto hit = cache->Get("a");
+  ASSERT_TRUE(hit.has_value());
+  ASSERT_EQ(1, hit->size());
+  ASSERT_EQ(batch.get(), (*hit)[0].get());
+
+  // "a" was just used, so inserting "c" evicts "b"
+  cache->Insert("c", {batch});
+  ASSERT_EQ(2 * batch_bytes, cache->cached_bytes());
+  ASSERT_TRUE(cache->Get("a").has_value());
+  ASSERT_FALSE(cache->Get("b").has_value());
+  ASSERT_TRUE(cache->Get("c").has_value());
+
+  // Entries larger than the whole budget are dropped outright
+  cache->Insert("d", {batch, batch, batch});
+  ASSERT_FALSE(cache->Get("d").has_value());
+  ASSERT_EQ(2 * batch_bytes, cache->cached_bytes());
+}
+
+TEST(TestNewScanner, PerFilesystemReadahead) {
+  constexpr int kNumFragments = 2;
+  constexpr int kNumBatchesPerFragment = 2;
+  internal::Initialize();
+  std::shared_ptr<MockDataset> test_dataset =
+      MakeTestDataset(kNumFragments, kNumBatchesPerFragment);
+  test_dataset->DeliverBatchesInOrder(false);
+
+  // Mock fragments are not file-based so the override cannot match; the scan
+  // must fall back to the global byte readahead and still produce all batches.
+  ScanV2Options options(test_dataset);
+  options.columns = ScanV2Options::AllColumns(*test_dataset->schema());
+  options.per_filesystem_bytes_readahead = {{"s3", 1024 * 1024}};
+  ASSERT_OK_AND_ASSIGN(std::vector<std::shared_ptr<RecordBatch>> batches,
+                       acero::DeclarationToBatches({"scan2", options}));
+  ASSERT_EQ(kNumFragments * kNumBatchesPerFragment, batches.size());
+
+  // Negative overrides are rejected like a negative global readahead
+  options.per_filesystem_bytes_readahead = {{"local", -1}};
+  ASSERT_RAISES(Invalid, acero::DeclarationToBatches({"scan2", options}));
+}
+
 TEST(TestNewScanner, NestedRead) {
   // This tests the case where the file format does not support
   // handling nested reads (e.g. JSON) and so the scanner must
@@ -2491,6 +2543,82 @@ TEST(ScanNode, Trivial) {
   ASSERT_THAT(plan.Run(), Finishes(ResultWith(UnorderedElementsAreArray(expected))));
 }
 
+TEST(ScanNode, PreserveDatasetOrdering) {
+  auto test_schema = schema({field("a", int32())});
+  RecordBatchVector batches = {
+      RecordBatchFromJSON(test_schema, R"([{"a": 1}, {"a": 3}, {"a": 5}])"),
+      RecordBatchFromJSON(test_schema, R"([{"a": 2}, {"a": 4}, {"a": 6}])"),
+  };
+  auto dataset = std::make_shared<InMemoryDataset>(test_schema, batches);
+
+  auto options = std::make_shared<ScanOptions>();
+  options->projection = Materialize({"a"}, /*include_aug_fields=*/true);
+
+  // The dataset has not declared an ordering
+  acero::Declaration scan{"scan",
+                          ScanNodeOptions{dataset, options,
+                                          /*require_sequenced_output=*/false,
+                                          /*implicit_ordering=*/false,
+                                          /*preserve_dataset_ordering=*/true}};
+  ASSERT_RAISES(Invalid, acero::DeclarationToTable(scan));
+
+  // With a declared ordering the fragment streams are merged in order
+  dataset->set_ordering(compute::Ordering({compute::SortKey("a")}));
+  ASSERT_OK_AND_ASSIGN(auto table, acero::DeclarationToTable(scan));
+  ASSERT_OK_AND_ASSIGN(auto combined, table->CombineChunks());
+  AssertArraysEqual(*ArrayFromJSON(int32(), "[1, 2, 3, 4, 5, 6]"),
+                    *combined->GetColumnByName("a")->chunk(0));
+}
+
+TEST(TestScannerPushdownProjection, FilterAndComputedProjection) {
+  auto test_schema = schema({field("a", int32()), field("b", int32())});
+  RecordBatchVector batches = {RecordBatchFromJSON(
+      test_schema,
+      R"([{"a": 1, "b": 10}, {"a": 2, "b": 20}, {"a": 3, "b": 30}, {"a": 4, "b": 40}])")};
+  auto dataset = std::make_shared<InMemoryDataset>(test_schema, batches);
+
+  ASSERT_OK_AND_ASSIGN(auto builder, dataset->NewScan());
+  ASSERT_OK(builder->Project({call("add", {field_ref("a"), literal(1)})},
+                             {"a_plus_one"}));
+  ASSERT_OK(builder->Filter(greater(field_ref("a"), literal(1))));
+  ASSERT_OK(builder->PushdownProjection());
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder->Finish());
+
+  // The fragment emits already-filtered, already-projected batches; the plan
+  // passes them through untouched.
+  ASSERT_OK_AND_ASSIGN(auto actual, scanner->ToTable());
+  auto expected_schema = schema({field("a_plus_one", int32())});
+  ASSERT_OK_AND_ASSIGN(
+      auto expected,
+      Table::FromRecordBatches({RecordBatchFromJSON(
+          expected_schema,
+          R"([{"a_plus_one": 3}, {"a_plus_one": 4}, {"a_plus_one": 5}])")}));
+  AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+}
+
+TEST(TestScannerPreserveFragmentBatches, ForwardsBatchesWhole) {
+  auto test_schema = schema({field("a", int32())});
+  auto batch = ConstantArrayGenerator::Zeroes(100, test_schema);
+  auto fragment =
+      std::make_shared<InMemoryFragment>(RecordBatchVector{batch, batch});
+
+  auto options = std::make_shared<ScanOptions>();
+  options->dataset_schema = test_schema;
+  options->batch_size = 16;
+  ASSERT_OK_AND_ASSIGN(auto gen, fragment->ScanBatchesAsync(options));
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto batches, CollectAsyncGenerator(gen));
+  // ceil(100 / 16) slices per source batch
+  ASSERT_EQ(batches.size(), 14);
+
+  options->preserve_fragment_batches = true;
+  ASSERT_OK_AND_ASSIGN(gen, fragment->ScanBatchesAsync(options));
+  ASSERT_FINISHES_OK_AND_ASSIGN(batches, CollectAsyncGenerator(gen));
+  ASSERT_EQ(batches.size(), 2);
+  // The source batches are forwarded untouched, not re-sliced copies.
+  ASSERT_EQ(batches[0].get(), batch.get());
+  ASSERT_EQ(batches[0]->num_rows(), 100);
+}
+
 TEST(ScanNode, FilteredOnVirtualColumn) {
   TestPlan plan;
 
@@ -21,13 +21,17 @@
 #include <mutex>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/io/memory.h"
+#include "arrow/io/util_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 
@@ -298,6 +302,155 @@ std::shared_ptr<MemoryManager> CPUDevice::default_memory_manager() {
 
 namespace {
 
+// A single buffer scheduled for migration, with the future resolved once
+// its device-resident copy is available.
+struct MigrationRequest {
+  std::shared_ptr<Buffer> source;
+  Future<std::shared_ptr<Buffer>> completion;
+};
+
+// Copy one buffer to the destination and resolve its future.
+void RunSingleTransfer(MigrationRequest request,
+                       const std::shared_ptr<MemoryManager>& to) {
+  request.completion.MarkFinished(MemoryManager::CopyBuffer(request.source, to));
+}
+
+// Pack a group of small CPU-resident buffers into one staging buffer, issue a
+// single copy to the destination and resolve each future with a slice of the
+// migrated batch.
+void RunCoalescedTransfer(std::vector<MigrationRequest> group,
+                          const std::shared_ptr<MemoryManager>& to) {
+  int64_t total_size = 0;
+  for (const auto& request : group) {
+    total_size += bit_util::RoundUpToMultipleOf64(request.source->size());
+  }
+  auto maybe_staging = AllocateBuffer(total_size);
+  if (!maybe_staging.ok()) {
+    for (auto& request : group) {
+      request.completion.MarkFinished(maybe_staging.status());
+    }
+    return;
+  }
+  std::shared_ptr<Buffer> staging = *std::move(maybe_staging);
+  int64_t offset = 0;
+  for (const auto& request : group) {
+    if (request.source->size() > 0) {
+      memcpy(staging->mutable_data() + offset, request.source->data(),
+             static_cast<size_t>(request.source->size()));
+    }
+    offset += bit_util::RoundUpToMultipleOf64(request.source->size());
+  }
+  auto maybe_batch = MemoryManager::CopyBuffer(staging, to);
+  if (!maybe_batch.ok()) {
+    for (auto& request : group) {
+      request.completion.MarkFinished(maybe_batch.status());
+    }
+    return;
+  }
+  offset = 0;
+  for (auto& request : group) {
+    request.completion.MarkFinished(
+        SliceBuffer(*maybe_batch, offset, request.source->size()));
+    offset += bit_util::RoundUpToMultipleOf64(request.source->size());
+  }
+}
+
+}  // namespace
+
+Result<std::shared_ptr<BufferMigrationQueue>> BufferMigrationQueue::Make(
+    std::shared_ptr<MemoryManager> to, BufferMigrationOptions options) {
+  if (to == nullptr) {
+    return Status::Invalid("Null destination MemoryManager for BufferMigrationQueue");
+  }
+  if (options.coalesce_threshold <= 0 || options.max_batch_bytes <= 0) {
+    return Status::Invalid("BufferMigrationOptions sizes must be positive");
+  }
+  if (options.coalesce_threshold > options.max_batch_bytes) {
+    return Status::Invalid(
+        "BufferMigrationOptions::coalesce_threshold must not exceed max_batch_bytes");
+  }
+  if (options.executor == nullptr) {
+    options.executor = io::internal::GetIOThreadPool();
+  }
+  return std::shared_ptr<BufferMigrationQueue>(
+      new BufferMigrationQueue(std::move(to), options));
+}
+
+BufferMigrationQueue::BufferMigrationQueue(std::shared_ptr<MemoryManager> to,
+                                           BufferMigrationOptions options)
+    : to_(std::move(to)), options_(options) {}
+
+Future<std::shared_ptr<Buffer>> BufferMigrationQueue::Prefetch(
+    std::shared_ptr<Buffer> buffer) {
+  auto futures = Prefetch(std::vector<std::shared_ptr<Buffer>>{std::move(buffer)});
+  return std::move(futures[0]);
+}
+
+std::vector<Future<std::shared_ptr<Buffer>>> BufferMigrationQueue::Prefetch(
+    std::vector<std::shared_ptr<Buffer>> buffers) {
+  std::vector<Future<std::shared_ptr<Buffer>>> futures;
+  futures.reserve(buffers.size());
+
+  std::vector<MigrationRequest> group;
+  int64_t group_bytes = 0;
+  auto flush_group = [&]() {
+    if (group.empty()) {
+      return;
+    }
+    std::vector<Future<std::shared_ptr<Buffer>>> group_futures;
+    group_futures.reserve(group.size());
+    for (const auto& request : group) {
+      group_futures.push_back(request.completion);
+    }
+    auto to = to_;
+    Status st = options_.executor->Spawn([batch = std::move(group), to]() mutable {
+      RunCoalescedTransfer(std::move(batch), to);
+    });
+    if (!st.ok()) {
+      // The task was never accepted, so resolve the futures ourselves
+      for (auto& completion : group_futures) {
+        completion.MarkFinished(st);
+      }
+    }
+    group.clear();
+    group_bytes = 0;
+  };
+
+  for (auto& buffer : buffers) {
+    auto completion = Future<std::shared_ptr<Buffer>>::Make();
+    futures.push_back(completion);
+    if (buffer == nullptr) {
+      completion.MarkFinished(Status::Invalid("Null buffer passed to Prefetch"));
+      continue;
+    }
+    MigrationRequest request{std::move(buffer), std::move(completion)};
+    if (request.source->is_cpu() &&
+        request.source->size() < options_.coalesce_threshold) {
+      if (group_bytes + bit_util::RoundUpToMultipleOf64(request.source->size()) >
+          options_.max_batch_bytes) {
+        flush_group();
+      }
+      group_bytes += bit_util::RoundUpToMultipleOf64(request.source->size());
+      group.push_back(std::move(request));
+    } else {
+      // Large or device-resident buffers are transferred individually
+      flush_group();
+      auto single_future = request.completion;
+      auto to = to_;
+      Status st = options_.executor->Spawn([single = std::move(request), to]() mutable {
+        RunSingleTransfer(std::move(single), to);
+      });
+      if (!st.ok()) {
+        single_future.MarkFinished(st);
+      }
+    }
+  }
+  flush_group();
+  return futures;
+}
+
+namespace {
+
 class DeviceMapperRegistryImpl {
  public:
   DeviceMapperRegistryImpl() {}
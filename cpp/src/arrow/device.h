@@ -21,13 +21,16 @@
 #include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "arrow/io/type_fwd.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/type_fwd.h"
 #include "arrow/util/compare.h"
+#include "arrow/util/future.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/type_fwd.h"
 #include "arrow/util/visibility.h"
 
 namespace arrow {
@@ -351,6 +354,64 @@ class ARROW_EXPORT CPUMemoryManager : public MemoryManager {
 ARROW_EXPORT
 std::shared_ptr<MemoryManager> default_cpu_memory_manager();
 
+/// \brief EXPERIMENTAL: Options for BufferMigrationQueue
+struct ARROW_EXPORT BufferMigrationOptions {
+  /// \brief Maximum size for a buffer to be coalesced with its neighbors
+  ///
+  /// Consecutive CPU-resident buffers smaller than this are packed into a
+  /// single staging buffer and migrated with one device copy, amortizing
+  /// per-transfer latency.  Larger (or non-CPU) buffers are copied
+  /// individually.
+  int64_t coalesce_threshold = 1024 * 1024;
+  /// \brief Maximum number of bytes staged into a single coalesced transfer
+  int64_t max_batch_bytes = 16 * 1024 * 1024;
+  /// \brief Executor on which transfers are run
+  ///
+  /// If null, the global IO thread pool is used.
+  ::arrow::internal::Executor* executor = NULLPTR;
+};
+
+/// \brief EXPERIMENTAL: An asynchronous queue migrating buffers to a device
+///
+/// Each Prefetch() call schedules a copy of the given buffer(s) to the
+/// destination MemoryManager on a background executor and returns a future
+/// per buffer, resolved with the device-resident copy once the transfer
+/// completes.  Within one Prefetch() call, consecutive small CPU-resident
+/// buffers are coalesced into batched transfers (see BufferMigrationOptions),
+/// so callers can overlap host-to-device copies with compute.
+///
+/// The returned futures keep the queue alive as needed; the queue itself
+/// holds no background state beyond in-flight transfers and may be destroyed
+/// while transfers are still pending.
+class ARROW_EXPORT BufferMigrationQueue {
+ public:
+  /// \brief Create a migration queue copying buffers to the given MemoryManager
+  static Result<std::shared_ptr<BufferMigrationQueue>> Make(
+      std::shared_ptr<MemoryManager> to, BufferMigrationOptions options = {});
+
+  /// \brief Schedule an asynchronous copy of a single buffer to the destination
+  Future<std::shared_ptr<Buffer>> Prefetch(std::shared_ptr<Buffer> buffer);
+
+  /// \brief Schedule asynchronous copies of a list of buffers to the destination
+  ///
+  /// The i-th returned future resolves with the migrated copy of the i-th
+  /// input buffer.  Consecutive small CPU-resident buffers are coalesced
+  /// into a single transfer; their futures then resolve with slices of one
+  /// device-resident batch buffer.
+  std::vector<Future<std::shared_ptr<Buffer>>> Prefetch(
+      std::vector<std::shared_ptr<Buffer>> buffers);
+
+  /// \brief The destination MemoryManager buffers are migrated to
+  const std::shared_ptr<MemoryManager>& destination() const { return to_; }
+
+ private:
+  BufferMigrationQueue(std::shared_ptr<MemoryManager> to,
+                       BufferMigrationOptions options);
+
+  std::shared_ptr<MemoryManager> to_;
+  BufferMigrationOptions options_;
+};
+
 using DeviceMapper =
     std::function<Result<std::shared_ptr<MemoryManager>>(int64_t device_id)>;
 
@@ -87,6 +87,16 @@ class ARROW_EXPORT ExtensionType : public DataType {
   /// \return the serialized representation
   virtual std::string Serialize() const = 0;
 
+  /// \brief Whether compute kernel dispatch may see through this type to its
+  /// storage type
+  ///
+  /// When true, a compute function that has no kernel for this extension type
+  /// executes directly against the storage data (zero-copy).  If the result
+  /// has the storage type, it is re-wrapped as this extension type so the
+  /// extension metadata is preserved.  Override to return true for types
+  /// whose values behave exactly like their storage values.
+  virtual bool AllowStorageDispatch() const { return false; }
+
   /// \brief Wrap the given storage array as an extension array
   static std::shared_ptr<Array> WrapArray(const std::shared_ptr<DataType>& ext_type,
                                           const std::shared_ptr<Array>& storage);
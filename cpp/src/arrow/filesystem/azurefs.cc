@@ -253,6 +253,8 @@ bool AzureOptions::Equals(const AzureOptions& other) const {
                       dfs_storage_scheme == other.dfs_storage_scheme &&
                       default_metadata == other.default_metadata &&
                       account_name == other.account_name &&
+                      download_stripe_size == other.download_stripe_size &&
+                      max_download_concurrency == other.max_download_concurrency &&
                       credential_kind_ == other.credential_kind_;
   if (!equals) {
     return false;
@@ -759,10 +761,12 @@ class ObjectInputFile final : public io::RandomAccessFile {
  public:
   ObjectInputFile(std::shared_ptr<Blobs::BlobClient> blob_client,
                   const io::IOContext& io_context, AzureLocation location,
-                  int64_t size = kNoSize)
+                  const AzureOptions& options, int64_t size = kNoSize)
       : blob_client_(std::move(blob_client)),
         io_context_(io_context),
         location_(std::move(location)),
+        download_stripe_size_(options.download_stripe_size),
+        max_download_concurrency_(options.max_download_concurrency),
         content_length_(size) {}
 
   Status Init() {
@@ -860,6 +864,18 @@ class ObjectInputFile final : public io::RandomAccessFile {
     Http::HttpRange range{position, nbytes};
     Storage::Blobs::DownloadBlobToOptions download_options;
     download_options.Range = range;
+    if (download_stripe_size_ > 0 && max_download_concurrency_ > 1 &&
+        nbytes > download_stripe_size_) {
+      // Stripe large reads over several concurrent connections; the SDK
+      // downloads stripe-sized chunks in parallel and reassembles them
+      // directly into `out`.
+      download_options.TransferOptions.InitialChunkSize = download_stripe_size_;
+      download_options.TransferOptions.ChunkSize = download_stripe_size_;
+      download_options.TransferOptions.Concurrency = static_cast<int32_t>(
+          std::min<int64_t>(max_download_concurrency_,
+                            (nbytes + download_stripe_size_ - 1) /
+                                download_stripe_size_));
+    }
     try {
       return blob_client_
           ->DownloadTo(reinterpret_cast<uint8_t*>(out), nbytes, download_options)
@@ -906,6 +922,8 @@ class ObjectInputFile final : public io::RandomAccessFile {
   std::shared_ptr<Blobs::BlobClient> blob_client_;
   const io::IOContext io_context_;
   AzureLocation location_;
+  const int64_t download_stripe_size_;
+  const int32_t max_download_concurrency_;
 
   bool closed_ = false;
   int64_t pos_ = 0;
@@ -2164,7 +2182,7 @@ class AzureFileSystem::Impl {
         GetBlobClient(location.container, location.path));
 
     auto ptr = std::make_shared<ObjectInputFile>(blob_client, fs->io_context(),
-                                                 std::move(location));
+                                                 std::move(location), fs->options());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -2183,7 +2201,8 @@ class AzureFileSystem::Impl {
         GetBlobClient(location.container, location.path));
 
     auto ptr = std::make_shared<ObjectInputFile>(blob_client, fs->io_context(),
-                                                 std::move(location), info.size());
+                                                 std::move(location), fs->options(),
+                                                 info.size());
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -111,6 +111,17 @@ struct ARROW_EXPORT AzureOptions {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// \brief Stripe size (in bytes) for parallel downloads.
+  ///
+  /// ReadAt() calls larger than one stripe are downloaded as stripe-sized
+  /// chunks on concurrent connections and reassembled into the caller's
+  /// buffer.  The number of connections grows with the read size, up to
+  /// max_download_concurrency.  Set to 0 to disable parallel downloads.
+  int64_t download_stripe_size = 16 * 1024 * 1024;
+
+  /// \brief Maximum number of concurrent connections for a parallel download.
+  int32_t max_download_concurrency = 8;
+
  private:
   enum class CredentialKind {
     kDefault,
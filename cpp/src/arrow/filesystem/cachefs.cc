@@ -0,0 +1,556 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/filesystem/cachefs.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <list>
+#include <mutex>
+#include <sstream>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/result.h"
+#include "arrow/util/crc32.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+
+using internal::PlatformFilename;
+
+namespace fs {
+
+namespace {
+
+// Each cached block is stored as one file:
+//   "ARBC" magic | CRC32 of data (4) | key length (4) | data length (8) |
+//   key bytes | data bytes
+// The full block key is stored and verified so that block-file name (hash)
+// collisions degrade into cache misses rather than wrong data.  The header
+// uses native endianness; cache files are not meant to move between machines.
+constexpr char kBlockMagic[4] = {'A', 'R', 'B', 'C'};
+constexpr int64_t kBlockHeaderSize = 4 + 4 + 4 + 8;
+
+std::string BlockKey(const std::string& path, int64_t file_size, int64_t block_index) {
+  std::string key = path;
+  key += '\0';
+  key += std::to_string(file_size);
+  key += '\0';
+  key += std::to_string(block_index);
+  return key;
+}
+
+Status BlockValidationError(const std::string& file_path) {
+  return Status::IOError("Cached block file '", file_path, "' failed validation");
+}
+
+Result<std::shared_ptr<Buffer>> ReadBlockFile(const std::string& file_path,
+                                              const std::string& expected_key) {
+  ARROW_ASSIGN_OR_RAISE(auto file, io::ReadableFile::Open(file_path));
+  ARROW_ASSIGN_OR_RAISE(const int64_t file_size, file->GetSize());
+  if (file_size < kBlockHeaderSize) {
+    return BlockValidationError(file_path);
+  }
+  ARROW_ASSIGN_OR_RAISE(auto contents, file->Read(file_size));
+  RETURN_NOT_OK(file->Close());
+  if (contents->size() != file_size) {
+    return BlockValidationError(file_path);
+  }
+
+  const uint8_t* header = contents->data();
+  uint32_t crc, key_length;
+  int64_t data_length;
+  if (memcmp(header, kBlockMagic, sizeof(kBlockMagic)) != 0) {
+    return BlockValidationError(file_path);
+  }
+  memcpy(&crc, header + 4, sizeof(crc));
+  memcpy(&key_length, header + 8, sizeof(key_length));
+  memcpy(&data_length, header + 12, sizeof(data_length));
+  if (data_length < 0 ||
+      file_size != kBlockHeaderSize + static_cast<int64_t>(key_length) + data_length) {
+    return BlockValidationError(file_path);
+  }
+  const std::string_view key(reinterpret_cast<const char*>(header + kBlockHeaderSize),
+                             key_length);
+  if (key != expected_key) {
+    // Block-file name collision with another key
+    return BlockValidationError(file_path);
+  }
+  const uint8_t* data = header + kBlockHeaderSize + key_length;
+  if (::arrow::internal::crc32(0, data, static_cast<size_t>(data_length)) != crc) {
+    return BlockValidationError(file_path);
+  }
+  return SliceBuffer(std::move(contents), kBlockHeaderSize + key_length, data_length);
+}
+
+Status WriteBlockFile(const std::string& file_path, const std::string& key,
+                      const Buffer& data) {
+  // Write to a unique temporary name, then rename into place so that readers
+  // never observe a partially written block.
+  static std::atomic<int64_t> counter{0};
+  const std::string tmp_path = file_path + ".tmp" + std::to_string(++counter);
+
+  uint8_t header[kBlockHeaderSize];
+  const auto crc =
+      ::arrow::internal::crc32(0, data.data(), static_cast<size_t>(data.size()));
+  const auto key_length = static_cast<uint32_t>(key.length());
+  const int64_t data_length = data.size();
+  memcpy(header, kBlockMagic, sizeof(kBlockMagic));
+  memcpy(header + 4, &crc, sizeof(crc));
+  memcpy(header + 8, &key_length, sizeof(key_length));
+  memcpy(header + 12, &data_length, sizeof(data_length));
+
+  ARROW_ASSIGN_OR_RAISE(auto out, io::FileOutputStream::Open(tmp_path));
+  RETURN_NOT_OK(out->Write(header, kBlockHeaderSize));
+  RETURN_NOT_OK(out->Write(key.data(), key_length));
+  RETURN_NOT_OK(out->Write(data.data(), data_length));
+  RETURN_NOT_OK(out->Close());
+  if (std::rename(tmp_path.c_str(), file_path.c_str()) != 0) {
+    return ::arrow::internal::IOErrorFromErrno(
+        errno, "Failed renaming cached block file to '", file_path, "'");
+  }
+  return Status::OK();
+}
+
+void DeleteBlockFile(const std::string& file_path) {
+  // Best-effort: a leftover file is only wasted space
+  auto maybe_name = PlatformFilename::FromString(file_path);
+  if (maybe_name.ok()) {
+    ARROW_UNUSED(::arrow::internal::DeleteFile(*maybe_name, /*allow_not_found=*/true));
+  }
+}
+
+}  // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// Block cache implementation
+
+class BlockCachingFileSystem::Impl {
+ public:
+  explicit Impl(BlockCacheOptions options) : options_(std::move(options)) {}
+
+  Status Init() {
+    if (options_.cache_dir.empty()) {
+      return Status::Invalid("BlockCacheOptions::cache_dir must not be empty");
+    }
+    if (options_.block_size <= 0) {
+      return Status::Invalid("BlockCacheOptions::block_size must be positive");
+    }
+    if (options_.max_cache_bytes < options_.block_size) {
+      return Status::Invalid(
+          "BlockCacheOptions::max_cache_bytes must hold at least one block");
+    }
+    ARROW_ASSIGN_OR_RAISE(auto dir, PlatformFilename::FromString(options_.cache_dir));
+    return ::arrow::internal::CreateDir(dir).status();
+  }
+
+  const BlockCacheOptions& options() const { return options_; }
+
+  int64_t cached_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return total_bytes_;
+  }
+
+  using FetchFn = std::function<Result<std::shared_ptr<Buffer>>()>;
+
+  // Return the cached block for `key`, fetching (and caching) it if absent.
+  // Blocks failing CRC or key validation are discarded and re-fetched.
+  Result<std::shared_ptr<Buffer>> GetOrFetch(const std::string& key,
+                                             const FetchFn& fetch) {
+    std::string file_path;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const auto it = entries_.find(key);
+      if (it != entries_.end()) {
+        lru_.splice(lru_.begin(), lru_, it->second.lru_it);
+        file_path = it->second.file_path;
+      }
+    }
+    if (!file_path.empty()) {
+      auto maybe_block = ReadBlockFile(file_path, key);
+      if (maybe_block.ok()) {
+        return maybe_block;
+      }
+      Remove(key);
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto block, fetch());
+    // Caching is best-effort: a failure to persist the block (e.g. disk
+    // full) must not fail the read itself.
+    const std::string block_path = BlockFilePath(key);
+    if (WriteBlockFile(block_path, key, *block).ok()) {
+      Insert(key, block_path, block->size());
+    }
+    return block;
+  }
+
+  // Drop all blocks cached for the given file
+  void InvalidateFile(const std::string& path) { InvalidatePrefix(path + '\0'); }
+
+  // Drop all blocks cached for files under the given directory
+  void InvalidateDir(const std::string& path) {
+    if (path.empty()) {
+      InvalidatePrefix("");
+    } else {
+      InvalidatePrefix(path + '/');
+    }
+  }
+
+ private:
+  struct Entry {
+    std::string file_path;
+    int64_t data_length;
+    std::list<std::string>::iterator lru_it;
+  };
+
+  std::string BlockFilePath(const std::string& key) const {
+    // Collisions are tolerated: the key stored in the block header is
+    // verified on every read.
+    std::ostringstream ss;
+    ss << options_.cache_dir << "/" << std::hex << std::hash<std::string>{}(key)
+       << ".block";
+    return ss.str();
+  }
+
+  void Insert(const std::string& key, const std::string& block_path,
+              int64_t data_length) {
+    std::vector<std::string> doomed;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const auto it = entries_.find(key);
+      if (it != entries_.end()) {
+        // Re-inserted after concurrent invalidation of the same key
+        total_bytes_ -= it->second.data_length;
+        lru_.erase(it->second.lru_it);
+        entries_.erase(it);
+      }
+      lru_.push_front(key);
+      entries_[key] = Entry{block_path, data_length, lru_.begin()};
+      total_bytes_ += data_length;
+      while (total_bytes_ > options_.max_cache_bytes && lru_.size() > 1) {
+        const auto doomed_it = entries_.find(lru_.back());
+        doomed.push_back(doomed_it->second.file_path);
+        total_bytes_ -= doomed_it->second.data_length;
+        entries_.erase(doomed_it);
+        lru_.pop_back();
+      }
+    }
+    for (const auto& file_path : doomed) {
+      DeleteBlockFile(file_path);
+    }
+  }
+
+  void Remove(const std::string& key) {
+    std::string file_path;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      const auto it = entries_.find(key);
+      if (it == entries_.end()) {
+        return;
+      }
+      file_path = it->second.file_path;
+      total_bytes_ -= it->second.data_length;
+      lru_.erase(it->second.lru_it);
+      entries_.erase(it);
+    }
+    DeleteBlockFile(file_path);
+  }
+
+  void InvalidatePrefix(const std::string& prefix) {
+    std::vector<std::string> doomed;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->first.compare(0, prefix.length(), prefix) == 0) {
+          doomed.push_back(it->second.file_path);
+          total_bytes_ -= it->second.data_length;
+          lru_.erase(it->second.lru_it);
+          it = entries_.erase(it);
+        } else {
+          ++it;
+        }
+      }
+    }
+    for (const auto& file_path : doomed) {
+      DeleteBlockFile(file_path);
+    }
+  }
+
+  const BlockCacheOptions options_;
+
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+  // Keys ordered from most to least recently used
+  std::list<std::string> lru_;
+  int64_t total_bytes_ = 0;
+};
+
+namespace {
+
+// A RandomAccessFile serving reads from cached fixed-size blocks
+class CachingInputFile : public io::RandomAccessFile {
+ public:
+  CachingInputFile(std::shared_ptr<io::RandomAccessFile> base, std::string path,
+                   int64_t size, MemoryPool* pool,
+                   std::shared_ptr<BlockCachingFileSystem::Impl> cache)
+      : base_(std::move(base)),
+        path_(std::move(path)),
+        size_(size),
+        pool_(pool),
+        cache_(std::move(cache)) {}
+
+  Status Close() override {
+    closed_ = true;
+    return base_->Close();
+  }
+
+  bool closed() const override { return closed_; }
+
+  Status CheckClosed() const {
+    if (closed_) {
+      return Status::Invalid("Operation on closed stream");
+    }
+    return Status::OK();
+  }
+
+  Result<int64_t> Tell() const override {
+    RETURN_NOT_OK(CheckClosed());
+    return pos_;
+  }
+
+  Result<int64_t> GetSize() override {
+    RETURN_NOT_OK(CheckClosed());
+    return size_;
+  }
+
+  Status Seek(int64_t position) override {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0) {
+      return Status::Invalid("Cannot seek to negative position");
+    }
+    if (position > size_) {
+      return Status::IOError("Cannot seek past end of file");
+    }
+    pos_ = position;
+    return Status::OK();
+  }
+
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
+    RETURN_NOT_OK(CheckClosed());
+    if (position < 0) {
+      return Status::Invalid("Cannot read from negative position");
+    }
+    nbytes = std::min(nbytes, std::max<int64_t>(0, size_ - position));
+
+    const int64_t block_size = cache_->options().block_size;
+    auto* dest = reinterpret_cast<uint8_t*>(out);
+    int64_t remaining = nbytes;
+    int64_t offset = position;
+    while (remaining > 0) {
+      const int64_t block_index = offset / block_size;
+      const int64_t block_start = block_index * block_size;
+      const int64_t block_length = std::min(block_size, size_ - block_start);
+      const auto fetch = [&]() -> Result<std::shared_ptr<Buffer>> {
+        ARROW_ASSIGN_OR_RAISE(auto block, base_->ReadAt(block_start, block_length));
+        if (block->size() != block_length) {
+          return Status::IOError("Short read from '", path_, "': expected ",
+                                 block_length, " bytes at offset ", block_start,
+                                 ", got ", block->size());
+        }
+        return block;
+      };
+      ARROW_ASSIGN_OR_RAISE(auto block,
+                            cache_->GetOrFetch(BlockKey(path_, size_, block_index),
+                                               fetch));
+      const int64_t in_block_offset = offset - block_start;
+      const int64_t to_copy = std::min(remaining, block_length - in_block_offset);
+      memcpy(dest, block->data() + in_block_offset, static_cast<size_t>(to_copy));
+      dest += to_copy;
+      offset += to_copy;
+      remaining -= to_copy;
+    }
+    return nbytes;
+  }
+
+  Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
+    RETURN_NOT_OK(CheckClosed());
+    nbytes = std::min(nbytes, std::max<int64_t>(0, size_ - position));
+    ARROW_ASSIGN_OR_RAISE(auto buf, AllocateResizableBuffer(nbytes, pool_));
+    if (nbytes > 0) {
+      ARROW_ASSIGN_OR_RAISE(const int64_t bytes_read,
+                            ReadAt(position, nbytes, buf->mutable_data()));
+      RETURN_NOT_OK(buf->Resize(bytes_read));
+    }
+    return std::shared_ptr<Buffer>(std::move(buf));
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) override {
+    ARROW_ASSIGN_OR_RAISE(const int64_t bytes_read, ReadAt(pos_, nbytes, out));
+    pos_ += bytes_read;
+    return bytes_read;
+  }
+
+  Result<std::shared_ptr<Buffer>> Read(int64_t nbytes) override {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, ReadAt(pos_, nbytes));
+    pos_ += buffer->size();
+    return buffer;
+  }
+
+ private:
+  std::shared_ptr<io::RandomAccessFile> base_;
+  const std::string path_;
+  const int64_t size_;
+  MemoryPool* pool_;
+  std::shared_ptr<BlockCachingFileSystem::Impl> cache_;
+  bool closed_ = false;
+  int64_t pos_ = 0;
+};
+
+}  // namespace
+
+//////////////////////////////////////////////////////////////////////////
+// BlockCachingFileSystem implementation
+
+BlockCacheOptions BlockCacheOptions::Defaults(std::string cache_dir) {
+  BlockCacheOptions options;
+  options.cache_dir = std::move(cache_dir);
+  return options;
+}
+
+BlockCachingFileSystem::BlockCachingFileSystem(std::shared_ptr<FileSystem> base_fs,
+                                               BlockCacheOptions options)
+    : FileSystem(base_fs->io_context()),
+      base_fs_(std::move(base_fs)),
+      impl_(std::make_shared<Impl>(std::move(options))) {}
+
+BlockCachingFileSystem::~BlockCachingFileSystem() = default;
+
+Result<std::shared_ptr<BlockCachingFileSystem>> BlockCachingFileSystem::Make(
+    std::shared_ptr<FileSystem> base_fs, BlockCacheOptions options) {
+  auto ptr = std::shared_ptr<BlockCachingFileSystem>(
+      new BlockCachingFileSystem(std::move(base_fs), std::move(options)));
+  RETURN_NOT_OK(ptr->impl_->Init());
+  return ptr;
+}
+
+bool BlockCachingFileSystem::Equals(const FileSystem& other) const {
+  return this == &other;
+}
+
+Result<std::string> BlockCachingFileSystem::PathFromUri(
+    const std::string& uri_string) const {
+  return base_fs_->PathFromUri(uri_string);
+}
+
+int64_t BlockCachingFileSystem::cached_bytes() const { return impl_->cached_bytes(); }
+
+Result<FileInfo> BlockCachingFileSystem::GetFileInfo(const std::string& path) {
+  return base_fs_->GetFileInfo(path);
+}
+
+Result<FileInfoVector> BlockCachingFileSystem::GetFileInfo(const FileSelector& select) {
+  return base_fs_->GetFileInfo(select);
+}
+
+Status BlockCachingFileSystem::CreateDir(const std::string& path, bool recursive) {
+  return base_fs_->CreateDir(path, recursive);
+}
+
+Status BlockCachingFileSystem::DeleteDir(const std::string& path) {
+  impl_->InvalidateDir(path);
+  return base_fs_->DeleteDir(path);
+}
+
+Status BlockCachingFileSystem::DeleteDirContents(const std::string& path,
+                                                 bool missing_dir_ok) {
+  impl_->InvalidateDir(path);
+  return base_fs_->DeleteDirContents(path, missing_dir_ok);
+}
+
+Status BlockCachingFileSystem::DeleteRootDirContents() {
+  impl_->InvalidateDir("");
+  return base_fs_->DeleteRootDirContents();
+}
+
+Status BlockCachingFileSystem::DeleteFile(const std::string& path) {
+  impl_->InvalidateFile(path);
+  return base_fs_->DeleteFile(path);
+}
+
+Status BlockCachingFileSystem::Move(const std::string& src, const std::string& dest) {
+  impl_->InvalidateFile(src);
+  impl_->InvalidateFile(dest);
+  return base_fs_->Move(src, dest);
+}
+
+Status BlockCachingFileSystem::CopyFile(const std::string& src, const std::string& dest) {
+  impl_->InvalidateFile(dest);
+  return base_fs_->CopyFile(src, dest);
+}
+
+Result<std::shared_ptr<io::InputStream>> BlockCachingFileSystem::OpenInputStream(
+    const std::string& path) {
+  return OpenInputFile(path);
+}
+
+Result<std::shared_ptr<io::InputStream>> BlockCachingFileSystem::OpenInputStream(
+    const FileInfo& info) {
+  return OpenInputFile(info);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> BlockCachingFileSystem::OpenInputFile(
+    const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto file, base_fs_->OpenInputFile(path));
+  ARROW_ASSIGN_OR_RAISE(const int64_t size, file->GetSize());
+  return std::make_shared<CachingInputFile>(std::move(file), path, size,
+                                            io_context().pool(), impl_);
+}
+
+Result<std::shared_ptr<io::RandomAccessFile>> BlockCachingFileSystem::OpenInputFile(
+    const FileInfo& info) {
+  ARROW_ASSIGN_OR_RAISE(auto file, base_fs_->OpenInputFile(info));
+  int64_t size = info.size();
+  if (size < 0) {
+    ARROW_ASSIGN_OR_RAISE(size, file->GetSize());
+  }
+  return std::make_shared<CachingInputFile>(std::move(file), info.path(), size,
+                                            io_context().pool(), impl_);
+}
+
+Result<std::shared_ptr<io::OutputStream>> BlockCachingFileSystem::OpenOutputStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  impl_->InvalidateFile(path);
+  return base_fs_->OpenOutputStream(path, metadata);
+}
+
+Result<std::shared_ptr<io::OutputStream>> BlockCachingFileSystem::OpenAppendStream(
+    const std::string& path, const std::shared_ptr<const KeyValueMetadata>& metadata) {
+  impl_->InvalidateFile(path);
+  return base_fs_->OpenAppendStream(path, metadata);
+}
+
+}  // namespace fs
+}  // namespace arrow
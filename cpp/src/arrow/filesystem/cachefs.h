@@ -0,0 +1,132 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace fs {
+
+/// \brief Options for BlockCachingFileSystem.
+struct ARROW_EXPORT BlockCacheOptions {
+  /// \brief Directory on the local filesystem holding cached blocks.
+  ///
+  /// The directory is created if it does not exist.  It should live on fast
+  /// local storage (e.g. NVMe) and not be shared between concurrently running
+  /// processes.
+  std::string cache_dir;
+
+  /// \brief Size in bytes of the fixed-size cache blocks.
+  ///
+  /// Reads are rounded out to block boundaries before hitting the base
+  /// filesystem, so this also acts as a read-amplification bound.
+  int64_t block_size = 4 * 1024 * 1024;
+
+  /// \brief Maximum total size in bytes of cached block data.
+  ///
+  /// Once exceeded, the least recently used blocks are evicted.
+  int64_t max_cache_bytes = 1024 * 1024 * 1024;
+
+  static BlockCacheOptions Defaults(std::string cache_dir);
+};
+
+/// \brief A FileSystem implementation that caches fixed-size blocks of
+/// another (typically remote) filesystem's files on local storage.
+///
+/// Reads through OpenInputFile and OpenInputStream are served from cached
+/// blocks when possible, so repeated dataset scans run at local-disk speed
+/// instead of re-fetching from the base filesystem.  Each block is stored as
+/// one file under BlockCacheOptions::cache_dir together with a CRC32 of its
+/// contents; blocks that fail validation are discarded and transparently
+/// re-fetched.  Blocks are evicted in least-recently-used order once
+/// BlockCacheOptions::max_cache_bytes is exceeded.
+///
+/// Cached blocks are keyed by file path and size.  Files mutated through
+/// this filesystem are invalidated automatically; mutations performed behind
+/// its back (through the base filesystem directly, or by another process)
+/// are only detected when they change the file size.
+///
+/// All other operations delegate to the base filesystem.
+class ARROW_EXPORT BlockCachingFileSystem : public FileSystem {
+ public:
+  ~BlockCachingFileSystem() override;
+
+  static Result<std::shared_ptr<BlockCachingFileSystem>> Make(
+      std::shared_ptr<FileSystem> base_fs, BlockCacheOptions options);
+
+  std::string type_name() const override { return "block-cache"; }
+  bool Equals(const FileSystem& other) const override;
+  Result<std::string> PathFromUri(const std::string& uri_string) const override;
+
+  /// Total size in bytes of the blocks currently cached
+  int64_t cached_bytes() const;
+
+  /// \cond FALSE
+  using FileSystem::CreateDir;
+  using FileSystem::DeleteDirContents;
+  using FileSystem::GetFileInfo;
+  using FileSystem::OpenAppendStream;
+  using FileSystem::OpenOutputStream;
+  /// \endcond
+
+  Result<FileInfo> GetFileInfo(const std::string& path) override;
+  Result<FileInfoVector> GetFileInfo(const FileSelector& select) override;
+
+  Status CreateDir(const std::string& path, bool recursive) override;
+
+  Status DeleteDir(const std::string& path) override;
+  Status DeleteDirContents(const std::string& path, bool missing_dir_ok) override;
+  Status DeleteRootDirContents() override;
+
+  Status DeleteFile(const std::string& path) override;
+
+  Status Move(const std::string& src, const std::string& dest) override;
+
+  Status CopyFile(const std::string& src, const std::string& dest) override;
+
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::InputStream>> OpenInputStream(const FileInfo& info) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const std::string& path) override;
+  Result<std::shared_ptr<io::RandomAccessFile>> OpenInputFile(
+      const FileInfo& info) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenOutputStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata) override;
+  Result<std::shared_ptr<io::OutputStream>> OpenAppendStream(
+      const std::string& path,
+      const std::shared_ptr<const KeyValueMetadata>& metadata) override;
+
+  class Impl;
+
+ protected:
+  BlockCachingFileSystem(std::shared_ptr<FileSystem> base_fs, BlockCacheOptions options);
+
+  std::shared_ptr<FileSystem> base_fs_;
+  std::shared_ptr<Impl> impl_;
+};
+
+}  // namespace fs
+}  // namespace arrow
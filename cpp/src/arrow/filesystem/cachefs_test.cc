@@ -0,0 +1,197 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/filesystem/cachefs.h"
+#include "arrow/filesystem/localfs.h"
+#include "arrow/io/file.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/io_util.h"
+
+namespace arrow {
+namespace fs {
+
+using arrow::internal::TemporaryDir;
+
+class TestBlockCachingFileSystem : public ::testing::Test {
+ public:
+  void SetUp() override {
+    ASSERT_OK_AND_ASSIGN(tmp_dir_, TemporaryDir::Make("cachefs-test-"));
+    local_fs_ = std::make_shared<LocalFileSystem>();
+
+    options_ = BlockCacheOptions::Defaults(PathOf("cache"));
+    options_.block_size = 8;
+    options_.max_cache_bytes = 1024;
+  }
+
+  std::string PathOf(const std::string& name) {
+    return tmp_dir_->path().ToString() + "/" + name;
+  }
+
+  void MakeFileSystem() { ASSERT_OK_AND_ASSIGN(fs_, BlockCachingFileSystem::Make(local_fs_, options_)); }
+
+  void WriteFile(const std::string& path, const std::string& data) {
+    ASSERT_OK_AND_ASSIGN(auto out, local_fs_->OpenOutputStream(path));
+    ASSERT_OK(out->Write(data.data(), static_cast<int64_t>(data.length())));
+    ASSERT_OK(out->Close());
+  }
+
+ protected:
+  std::unique_ptr<TemporaryDir> tmp_dir_;
+  std::shared_ptr<LocalFileSystem> local_fs_;
+  BlockCacheOptions options_;
+  std::shared_ptr<BlockCachingFileSystem> fs_;
+};
+
+TEST_F(TestBlockCachingFileSystem, MakeErrors) {
+  options_.cache_dir = "";
+  ASSERT_RAISES(Invalid, BlockCachingFileSystem::Make(local_fs_, options_));
+  options_ = BlockCacheOptions::Defaults(PathOf("cache"));
+  options_.block_size = 0;
+  ASSERT_RAISES(Invalid, BlockCachingFileSystem::Make(local_fs_, options_));
+  options_.block_size = 8;
+  options_.max_cache_bytes = 4;
+  ASSERT_RAISES(Invalid, BlockCachingFileSystem::Make(local_fs_, options_));
+}
+
+TEST_F(TestBlockCachingFileSystem, ReadAt) {
+  MakeFileSystem();
+  const std::string data = "abcdefghijklmnopqrstuvwxyz";
+  WriteFile(PathOf("data"), data);
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(PathOf("data")));
+  ASSERT_OK_AND_EQ(26, file->GetSize());
+
+  // Within a block, straddling blocks, until EOF, past EOF, zero-length
+  std::shared_ptr<Buffer> buf;
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(2, 4));
+  AssertBufferEqual(*buf, "cdef");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(6, 12));
+  AssertBufferEqual(*buf, "ghijklmnopqr");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(24, 10));
+  AssertBufferEqual(*buf, "yz");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(26, 10));
+  AssertBufferEqual(*buf, "");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(5, 0));
+  AssertBufferEqual(*buf, "");
+  ASSERT_RAISES(Invalid, file->ReadAt(-1, 3));
+
+  // Sequential reads with Seek/Tell
+  ASSERT_OK(file->Seek(23));
+  ASSERT_OK_AND_ASSIGN(buf, file->Read(10));
+  AssertBufferEqual(*buf, "xyz");
+  ASSERT_OK_AND_EQ(26, file->Tell());
+  ASSERT_RAISES(IOError, file->Seek(27));
+
+  // All four blocks ended up cached
+  ASSERT_EQ(fs_->cached_bytes(), 26);
+}
+
+TEST_F(TestBlockCachingFileSystem, RepeatedReadsHitCache) {
+  MakeFileSystem();
+  const std::string data = "abcdefghijklmnopqrstuvwxyz";
+  WriteFile(PathOf("data"), data);
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(PathOf("data")));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 26));
+  AssertBufferEqual(*buf, data);
+
+  // Change the file contents behind the cache's back, keeping the size;
+  // reads are served from the cached blocks and still see the old contents.
+  WriteFile(PathOf("data"), "ABCDEFGHIJKLMNOPQRSTUVWXYZ");
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 26));
+  AssertBufferEqual(*buf, data);
+  ASSERT_OK_AND_ASSIGN(auto file2, fs_->OpenInputFile(PathOf("data")));
+  ASSERT_OK_AND_ASSIGN(buf, file2->ReadAt(10, 6));
+  AssertBufferEqual(*buf, "klmnop");
+}
+
+TEST_F(TestBlockCachingFileSystem, CorruptedBlockIsRefetched) {
+  MakeFileSystem();
+  const std::string data = "abcdefghijklmnopqrstuvwxyz";
+  WriteFile(PathOf("data"), data);
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(PathOf("data")));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 26));
+  AssertBufferEqual(*buf, data);
+
+  // Flip a byte in every cached block file
+  FileSelector select;
+  select.base_dir = PathOf("cache");
+  ASSERT_OK_AND_ASSIGN(auto block_infos, local_fs_->GetFileInfo(select));
+  ASSERT_EQ(block_infos.size(), 4);
+  for (const auto& info : block_infos) {
+    ASSERT_OK_AND_ASSIGN(auto block_file,
+                         io::MemoryMappedFile::Open(info.path(), io::FileMode::READWRITE));
+    ASSERT_OK(block_file->Seek(info.size() - 1));
+    const char byte = 'x';
+    ASSERT_OK(block_file->Write(&byte, 1));
+    ASSERT_OK(block_file->Close());
+  }
+
+  // CRC validation fails, blocks are transparently re-fetched
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 26));
+  AssertBufferEqual(*buf, data);
+  ASSERT_EQ(fs_->cached_bytes(), 26);
+}
+
+TEST_F(TestBlockCachingFileSystem, LruEviction) {
+  options_.max_cache_bytes = 16;  // Two blocks
+  MakeFileSystem();
+  const std::string data = "abcdefghijklmnopqrstuvwxyz";
+  WriteFile(PathOf("data"), data);
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(PathOf("data")));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 26));
+  AssertBufferEqual(*buf, data);
+  ASSERT_LE(fs_->cached_bytes(), 16);
+
+  // Evicted blocks are re-fetched on demand
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 8));
+  AssertBufferEqual(*buf, "abcdefgh");
+}
+
+TEST_F(TestBlockCachingFileSystem, MutationsInvalidate) {
+  MakeFileSystem();
+  WriteFile(PathOf("data"), "abcdefghijklmnopqrstuvwxyz");
+
+  ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(PathOf("data")));
+  ASSERT_OK_AND_ASSIGN(auto buf, file->ReadAt(0, 26));
+  ASSERT_GT(fs_->cached_bytes(), 0);
+
+  // Writing through the caching filesystem drops the file's blocks
+  ASSERT_OK_AND_ASSIGN(auto out, fs_->OpenOutputStream(PathOf("data")));
+  ASSERT_OK(out->Write("0123456789", 10));
+  ASSERT_OK(out->Close());
+  ASSERT_EQ(fs_->cached_bytes(), 0);
+
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile(PathOf("data")));
+  ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(0, 20));
+  AssertBufferEqual(*buf, "0123456789");
+
+  // So does deleting it
+  ASSERT_OK(fs_->DeleteFile(PathOf("data")));
+  ASSERT_EQ(fs_->cached_bytes(), 0);
+}
+
+}  // namespace fs
+}  // namespace arrow
@@ -177,6 +177,11 @@ FileInfoGenerator FileSystem::GetFileInfoGenerator(const FileSelector& select) {
   return MakeSingleFutureGenerator(std::move(fut));
 }
 
+FileInfoGenerator FileSystem::GetFileInfoGenerator(
+    const std::vector<std::string>& paths) {
+  return MakeSingleFutureGenerator(GetFileInfoAsync(paths));
+}
+
 Status FileSystem::DeleteFiles(const std::vector<std::string>& paths) {
   Status st = Status::OK();
   for (const auto& path : paths) {
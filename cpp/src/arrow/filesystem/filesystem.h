@@ -233,6 +233,18 @@ class ARROW_EXPORT FileSystem
   /// the returned future to complete before calling the generator again.
   virtual FileInfoGenerator GetFileInfoGenerator(const FileSelector& select);
 
+  /// Streaming async version of GetFileInfo for an explicit list of paths
+  ///
+  /// Infos are yielded in the order of the given paths, possibly split in
+  /// several batches.  The default implementation emits a single batch once
+  /// all paths are resolved; filesystems with batched metadata endpoints can
+  /// start feeding consumers (e.g. dataset discovery) while later paths are
+  /// still being resolved.
+  ///
+  /// The returned generator is not async-reentrant, i.e. you need to wait for
+  /// the returned future to complete before calling the generator again.
+  virtual FileInfoGenerator GetFileInfoGenerator(const std::vector<std::string>& paths);
+
   /// Create a directory and subdirectories.
   ///
   /// This function succeeds if the directory already exists.
@@ -404,6 +416,7 @@ class ARROW_EXPORT SubTreeFileSystem : public FileSystem {
   using FileSystem::CreateDir;
   using FileSystem::DeleteDirContents;
   using FileSystem::GetFileInfo;
+  using FileSystem::GetFileInfoGenerator;
   using FileSystem::OpenAppendStream;
   using FileSystem::OpenOutputStream;
   /// \endcond
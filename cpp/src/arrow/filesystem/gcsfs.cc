@@ -19,7 +19,10 @@
 
 #include <google/cloud/storage/client.h>
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <thread>
+#include <unordered_map>
 
 #include "arrow/buffer.h"
 #include "arrow/filesystem/gcsfs_internal.h"
@@ -242,8 +245,12 @@ using InputStreamFactory = std::function<Result<std::shared_ptr<GcsInputStream>>
 
 class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
  public:
-  GcsRandomAccessFile(InputStreamFactory factory, gcs::ObjectMetadata metadata)
-      : factory_(std::move(factory)), metadata_(std::move(metadata)) {}
+  GcsRandomAccessFile(InputStreamFactory factory, gcs::ObjectMetadata metadata,
+                      const GcsOptions& options)
+      : factory_(std::move(factory)),
+        metadata_(std::move(metadata)),
+        stripe_size_(options.download_stripe_size),
+        max_stripe_connections_(options.max_download_stripe_connections) {}
   ~GcsRandomAccessFile() override = default;
 
   //@{
@@ -291,6 +298,10 @@ class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
   Result<int64_t> GetSize() override { return metadata_.size(); }
   Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) override {
     if (closed()) return Status::Invalid("Cannot read from closed file");
+    const int64_t striped_nbytes = StripedReadSize(position, nbytes);
+    if (striped_nbytes > 0) {
+      return StripedReadAt(position, striped_nbytes, out);
+    }
     std::shared_ptr<io::InputStream> stream;
     ARROW_ASSIGN_OR_RAISE(stream, factory_(gcs::Generation(metadata_.generation()),
                                            gcs::ReadRange(position, position + nbytes),
@@ -299,6 +310,15 @@ class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
   }
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
     if (closed()) return Status::Invalid("Cannot read from closed file");
+    const int64_t striped_nbytes = StripedReadSize(position, nbytes);
+    if (striped_nbytes > 0) {
+      ARROW_ASSIGN_OR_RAISE(auto buffer, arrow::AllocateResizableBuffer(striped_nbytes));
+      ARROW_ASSIGN_OR_RAISE(
+          int64_t nread,
+          StripedReadAt(position, striped_nbytes, buffer->mutable_data()));
+      RETURN_NOT_OK(buffer->Resize(nread, true));
+      return std::shared_ptr<Buffer>(std::move(buffer));
+    }
     std::shared_ptr<io::InputStream> stream;
     ARROW_ASSIGN_OR_RAISE(stream, factory_(gcs::Generation(metadata_.generation()),
                                            gcs::ReadRange(position, position + nbytes),
@@ -317,6 +337,70 @@ class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
   }
 
  private:
+  // Return the number of bytes a striped download should cover, or 0 if the
+  // read should use a single connection.  Striping requires knowing how many
+  // bytes are actually available, so the request is clamped to the object size.
+  int64_t StripedReadSize(int64_t position, int64_t nbytes) const {
+    if (stripe_size_ <= 0 || max_stripe_connections_ <= 1) return 0;
+    const auto size = static_cast<int64_t>(metadata_.size());
+    const int64_t available = std::min(nbytes, std::max<int64_t>(size - position, 0));
+    return available > stripe_size_ ? available : 0;
+  }
+
+  // Download [position, position + nbytes) as stripe-sized range requests on
+  // concurrent connections, gsutil-style, each writing directly into its slice
+  // of `out`.
+  Result<int64_t> StripedReadAt(int64_t position, int64_t nbytes, void* out) {
+    const int64_t num_stripes = (nbytes + stripe_size_ - 1) / stripe_size_;
+    const int num_connections =
+        static_cast<int>(std::min<int64_t>(max_stripe_connections_, num_stripes));
+
+    std::vector<int64_t> stripe_nread(num_stripes, 0);
+    std::vector<Status> statuses(num_connections);
+    std::atomic<int64_t> next_stripe{0};
+    auto worker = [&](int connection) {
+      while (true) {
+        const int64_t stripe = next_stripe.fetch_add(1);
+        if (stripe >= num_stripes) return;
+        const int64_t offset = stripe * stripe_size_;
+        const int64_t length = std::min(stripe_size_, nbytes - offset);
+        auto result = [&]() -> Result<int64_t> {
+          ARROW_ASSIGN_OR_RAISE(
+              auto stream,
+              factory_(gcs::Generation(metadata_.generation()),
+                       gcs::ReadRange(position + offset, position + offset + length),
+                       gcs::ReadFromOffset()));
+          return stream->Read(length, static_cast<uint8_t*>(out) + offset);
+        }();
+        if (!result.ok()) {
+          statuses[connection] = result.status();
+          return;
+        }
+        stripe_nread[stripe] = *result;
+      }
+    };
+    std::vector<std::thread> connections;
+    connections.reserve(num_connections);
+    for (int i = 0; i < num_connections; ++i) {
+      connections.emplace_back(worker, i);
+    }
+    for (auto& connection : connections) {
+      connection.join();
+    }
+    for (const auto& status : statuses) {
+      RETURN_NOT_OK(status);
+    }
+    // Only the bytes up to the first short stripe are contiguous
+    int64_t total_nread = 0;
+    for (int64_t stripe = 0; stripe < num_stripes; ++stripe) {
+      total_nread += stripe_nread[stripe];
+      if (stripe_nread[stripe] < std::min(stripe_size_, nbytes - stripe * stripe_size_)) {
+        break;
+      }
+    }
+    return total_nread;
+  }
+
   Status InitializeStream() const {
     if (!stream_) {
       ARROW_ASSIGN_OR_RAISE(stream_, factory_(gcs::Generation(metadata_.generation()),
@@ -326,6 +410,8 @@ class GcsRandomAccessFile : public arrow::io::RandomAccessFile {
   }
   InputStreamFactory factory_;
   gcs::ObjectMetadata metadata_;
+  const int64_t stripe_size_;
+  const int max_stripe_connections_;
   std::shared_ptr<GcsInputStream> mutable stream_;
 };
 
@@ -410,6 +496,81 @@ class GcsFileSystem::Impl {
     return Status::IOError("No such file or directory '", select.base_dir, "'");
   }
 
+  Result<FileInfoVector> GetFileInfo(const std::vector<std::string>& paths) {
+    // Group the requested paths by bucket and parent directory and resolve
+    // each group with a single prefix listing instead of one GetObjectMetadata
+    // call per path.  Scattered paths, buckets, and anything the listing
+    // cannot settle (e.g. directories following a different marker
+    // convention) fall back to the single-path probe.
+    constexpr size_t kMinBatchListSize = 2;
+
+    FileInfoVector results(paths.size());
+    std::vector<GcsPath> gcs_paths(paths.size());
+    std::vector<size_t> singles;
+    std::unordered_map<std::string, std::vector<size_t>> groups;
+    for (size_t i = 0; i < paths.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(gcs_paths[i], GcsPath::FromString(paths[i]));
+      if (gcs_paths[i].object.empty()) {
+        singles.push_back(i);
+        continue;
+      }
+      const auto slash = gcs_paths[i].object.find_last_of('/');
+      const std::string parent = (slash == std::string::npos)
+                                     ? std::string()
+                                     : gcs_paths[i].object.substr(0, slash);
+      groups[gcs_paths[i].bucket + '/' + parent].push_back(i);
+    }
+
+    for (const auto& [parent, indices] : groups) {
+      if (indices.size() < kMinBatchListSize) {
+        singles.insert(singles.end(), indices.begin(), indices.end());
+        continue;
+      }
+      const std::string& bucket = gcs_paths[indices.front()].bucket;
+      // Window the listing to the longest common prefix of the group, so
+      // that stat-ing "part-*" objects skips unrelated siblings
+      std::string prefix = gcs_paths[indices.front()].object;
+      std::unordered_map<std::string, size_t> pending;
+      for (size_t i : indices) {
+        const std::string& object = gcs_paths[i].object;
+        size_t common = 0;
+        while (common < prefix.size() && common < object.size() &&
+               prefix[common] == object[common]) {
+          ++common;
+        }
+        prefix.resize(common);
+        pending.emplace(object, i);
+      }
+      for (auto const& o :
+           client_.ListObjects(bucket, gcs::Prefix(prefix), gcs::Delimiter("/"),
+                               gcs::IncludeTrailingDelimiter(true))) {
+        if (!o.ok()) {
+          if (o.status().code() == google::cloud::StatusCode::kNotFound) {
+            // Nonexistent bucket; the fallback below reports NotFound
+            break;
+          }
+          return internal::ToArrowStatus(o.status());
+        }
+        // A marker object "<name>/" resolves the directory "<name>"
+        auto it = pending.find(std::string(internal::RemoveTrailingSlash(o->name())));
+        if (it != pending.end()) {
+          results[it->second] =
+              ToFileInfo(internal::ConcatAbstractPath(o->bucket(), o->name()), *o,
+                         /*normalize_directories=*/true);
+          pending.erase(it);
+        }
+      }
+      for (const auto& [object, i] : pending) {
+        singles.push_back(i);
+      }
+    }
+
+    for (size_t i : singles) {
+      ARROW_ASSIGN_OR_RAISE(results[i], GetFileInfo(gcs_paths[i]));
+    }
+    return results;
+  }
+
   // GCS does not have directories or folders. But folders can be emulated (with some
   // limitations) using marker objects.  That and listing with prefixes creates the
   // illusion of folders.
@@ -708,7 +869,9 @@ bool GcsOptions::Equals(const GcsOptions& other) const {
          endpoint_override == other.endpoint_override && scheme == other.scheme &&
          default_bucket_location == other.default_bucket_location &&
          retry_limit_seconds == other.retry_limit_seconds &&
-         project_id == other.project_id;
+         project_id == other.project_id &&
+         download_stripe_size == other.download_stripe_size &&
+         max_download_stripe_connections == other.max_download_stripe_connections;
 }
 
 GcsOptions GcsOptions::Defaults() {
@@ -854,6 +1017,10 @@ Result<FileInfo> GcsFileSystem::GetFileInfo(const std::string& path) {
   return impl_->GetFileInfo(p);
 }
 
+Result<FileInfoVector> GcsFileSystem::GetFileInfo(const std::vector<std::string>& paths) {
+  return impl_->GetFileInfo(paths);
+}
+
 Result<FileInfoVector> GcsFileSystem::GetFileInfo(const FileSelector& select) {
   return impl_->GetFileInfo(select);
 }
@@ -929,7 +1096,8 @@ Result<std::shared_ptr<io::RandomAccessFile>> GcsFileSystem::OpenInputFile(
   };
 
   return std::make_shared<GcsRandomAccessFile>(std::move(open_stream),
-                                               *std::move(metadata));
+                                               *std::move(metadata),
+                                               impl_->options());
 }
 
 Result<std::shared_ptr<io::RandomAccessFile>> GcsFileSystem::OpenInputFile(
@@ -947,7 +1115,8 @@ Result<std::shared_ptr<io::RandomAccessFile>> GcsFileSystem::OpenInputFile(
     return impl->OpenInputStream(p, g, range, offset);
   };
   return std::make_shared<GcsRandomAccessFile>(std::move(open_stream),
-                                               *std::move(metadata));
+                                               *std::move(metadata),
+                                               impl_->options());
 }
 
 Result<std::shared_ptr<io::OutputStream>> GcsFileSystem::OpenOutputStream(
@@ -90,6 +90,18 @@ struct ARROW_EXPORT GcsOptions {
   /// that create new buckets need a project id.
   std::optional<std::string> project_id;
 
+  /// \brief Stripe size (in bytes) for striped downloads.
+  ///
+  /// ReadAt() calls larger than one stripe are split into stripe-sized range
+  /// requests issued on concurrent connections and reassembled into the
+  /// caller's buffer, similar to gsutil sliced downloads.  The number of
+  /// connections grows with the read size, up to
+  /// max_download_stripe_connections.  Set to 0 to disable striped downloads.
+  int64_t download_stripe_size = 16 * 1024 * 1024;
+
+  /// \brief Maximum number of concurrent connections for a striped download.
+  int max_download_stripe_connections = 8;
+
   bool Equals(const GcsOptions& other) const;
 
   /// \brief Initialize with Google Default Credentials
@@ -193,6 +205,9 @@ class ARROW_EXPORT GcsFileSystem : public FileSystem {
   Result<std::string> PathFromUri(const std::string& uri_string) const override;
 
   Result<FileInfo> GetFileInfo(const std::string& path) override;
+  /// Batched variant: paths sharing a parent directory are resolved with a
+  /// single prefix listing instead of one GetObjectMetadata call per path.
+  Result<FileInfoVector> GetFileInfo(const std::vector<std::string>& paths) override;
   Result<FileInfoVector> GetFileInfo(const FileSelector& select) override;
 
   Status CreateDir(const std::string& path, bool recursive) override;
@@ -1301,6 +1301,46 @@ TEST_F(GcsIntegrationTest, OpenInputFileMixedReadVsReadAt) {
   }
 }
 
+TEST_F(GcsIntegrationTest, OpenInputFileStripedReadAt) {
+  // Use a tiny stripe size so even a modest object exercises the striped
+  // download path, including a short trailing stripe.
+  auto options = TestGcsOptions();
+  options.download_stripe_size = 1024;
+  options.max_download_stripe_connections = 4;
+  ASSERT_OK_AND_ASSIGN(auto fs, GcsFileSystem::Make(options));
+
+  auto constexpr kLineWidth = 100;
+  auto constexpr kLineCount = 128;
+  std::string contents;
+  for (int lineno = 0; lineno != kLineCount; ++lineno) {
+    contents += RandomLine(lineno + 1, kLineWidth);
+  }
+
+  const auto path = PreexistingBucketPath() + "OpenInputFileStripedReadAt/object-name";
+  std::shared_ptr<io::OutputStream> output;
+  ASSERT_OK_AND_ASSIGN(output, fs->OpenOutputStream(path, {}));
+  ASSERT_OK(output->Write(contents.data(), contents.size()));
+  ASSERT_OK(output->Close());
+
+  std::shared_ptr<io::RandomAccessFile> file;
+  ASSERT_OK_AND_ASSIGN(file, fs->OpenInputFile(path));
+
+  // Whole-object read, striped over several connections
+  std::string buffer(contents.size(), '\0');
+  ASSERT_OK_AND_ASSIGN(auto size, file->ReadAt(0, buffer.size(), buffer.data()));
+  EXPECT_EQ(size, static_cast<int64_t>(contents.size()));
+  EXPECT_EQ(buffer, contents);
+
+  // Striped read at an offset, truncated by the end of the object
+  const auto position = static_cast<int64_t>(contents.size()) - 3000;
+  ASSERT_OK_AND_ASSIGN(auto b, file->ReadAt(position, 100 * 1024));
+  EXPECT_EQ(b->ToString(), contents.substr(position));
+
+  // Small reads keep using a single connection
+  ASSERT_OK_AND_ASSIGN(b, file->ReadAt(kLineWidth, kLineWidth));
+  EXPECT_EQ(b->ToString(), contents.substr(kLineWidth, kLineWidth));
+}
+
 TEST_F(GcsIntegrationTest, OpenInputFileRandomSeek) {
   ASSERT_OK_AND_ASSIGN(auto fs, GcsFileSystem::Make(TestGcsOptions()));
 
@@ -20,6 +20,7 @@
 
 #include "benchmark/benchmark.h"
 
+#include "arrow/buffer.h"
 #include "arrow/filesystem/localfs.h"
 #include "arrow/io/file.h"
 #include "arrow/status.h"
@@ -131,6 +132,70 @@ BENCHMARK_REGISTER_F(LocalFSFixture, AsyncFileDiscovery)
     ->UseRealTime()
     ->Unit(benchmark::kMillisecond);
 
+/// Set up a single large file for benchmarking asynchronous random reads.
+class LocalFSReadFixture : public benchmark::Fixture {
+ public:
+  void SetUp(const benchmark::State& state) override {
+    ASSERT_OK_AND_ASSIGN(tmp_dir_, TemporaryDir::Make("localfs-read-test-"));
+    fs_ = std::make_unique<LocalFileSystem>(LocalFileSystemOptions::Defaults());
+
+    ASSERT_OK_AND_ASSIGN(auto path, tmp_dir_->path().Join("data"));
+    path_ = path.ToString();
+    ASSERT_OK_AND_ASSIGN(auto out, io::FileOutputStream::Open(path_));
+    std::vector<uint8_t> block(1 << 20, 0xa5);
+    for (int64_t i = 0; i < kFileSizeMi; ++i) {
+      ASSERT_OK(out->Write(block.data(), static_cast<int64_t>(block.size())));
+    }
+    ASSERT_OK(out->Close());
+  }
+
+ protected:
+  static constexpr int64_t kFileSizeMi = 64;
+  static constexpr int64_t kReadSize = 64 * 1024;
+
+  std::unique_ptr<TemporaryDir> tmp_dir_;
+  std::unique_ptr<LocalFileSystem> fs_;
+  std::string path_;
+};
+
+/// Benchmark random ReadAsync throughput at various queue depths.
+///
+/// On Linux, ReadableFile::ReadAsync submits reads to a shared io_uring so
+/// outstanding reads cost no executor thread each; elsewhere every in-flight
+/// read occupies an IO thread pool slot.
+BENCHMARK_DEFINE_F(LocalFSReadFixture, AsyncRandomReads)
+(benchmark::State& st) {
+  const auto queue_depth = static_cast<int64_t>(st.range(0));
+  const int64_t num_reads = kFileSizeMi * (1 << 20) / kReadSize;
+  int64_t total_bytes = 0;
+
+  for (auto _ : st) {
+    ASSERT_OK_AND_ASSIGN(auto file, fs_->OpenInputFile(path_));
+    for (int64_t i = 0; i < num_reads;) {
+      // Issue up to queue_depth reads, striding the file in a fixed
+      // pseudo-random order, then drain them.
+      std::vector<Future<std::shared_ptr<Buffer>>> futures;
+      for (int64_t q = 0; q < queue_depth && i < num_reads; ++q, ++i) {
+        const int64_t offset = (i * 29 % num_reads) * kReadSize;
+        futures.push_back(file->ReadAsync(offset, kReadSize));
+      }
+      for (auto& fut : futures) {
+        ASSERT_FINISHES_OK_AND_ASSIGN(auto buffer, fut);
+        total_bytes += buffer->size();
+      }
+    }
+    ASSERT_OK(file->Close());
+  }
+  st.SetBytesProcessed(total_bytes);
+}
+BENCHMARK_REGISTER_F(LocalFSReadFixture, AsyncRandomReads)
+    ->ArgNames({"queue_depth"})
+    ->Args({1})
+    ->Args({16})
+    ->Args({256})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
 }  // namespace fs
 
 }  // namespace arrow
@@ -51,6 +51,7 @@
 #include <aws/core/client/DefaultRetryStrategy.h>
 #include <aws/core/client/RetryStrategy.h>
 #include <aws/core/http/HttpResponse.h>
+#include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/Outcome.h>
 #include <aws/core/utils/logging/ConsoleLogSystem.h>
 #include <aws/core/utils/stream/PreallocatedStreamBuf.h>
@@ -451,6 +452,10 @@ bool S3Options::Equals(const S3Options& other) const {
           proxy_options.Equals(other.proxy_options) &&
           credentials_kind == other.credentials_kind &&
           background_writes == other.background_writes &&
+          background_writes_part_limit == other.background_writes_part_limit &&
+          upload_checksums == other.upload_checksums &&
+          hedge_reads == other.hedge_reads &&
+          hedge_latency_quantile == other.hedge_latency_quantile &&
           allow_delayed_open == other.allow_delayed_open &&
           allow_bucket_creation == other.allow_bucket_creation &&
           allow_bucket_deletion == other.allow_bucket_deletion &&
@@ -1456,17 +1461,79 @@ bool IsDirectory(std::string_view key, const S3Model::HeadObjectResult& result)
   return false;
 }
 
+// Shared state for hedged range reads (see S3Options::hedge_reads): a sliding
+// window of recent read latencies from which the adaptive hedging threshold
+// is derived, plus activity counters.  One instance is shared by all files
+// opened through a given S3FileSystem.
+class HedgingContext {
+ public:
+  explicit HedgingContext(double latency_quantile)
+      : latency_quantile_(std::clamp(latency_quantile, 0.5, 0.999)) {}
+
+  // Return the delay in seconds after which an outstanding read should be
+  // hedged, or nullopt while too few latencies have been observed.
+  std::optional<double> HedgeDelay() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (static_cast<int64_t>(latencies_.size()) < kMinSamples) {
+      return std::nullopt;
+    }
+    std::vector<double> sorted = latencies_;
+    const auto quantile_it =
+        sorted.begin() +
+        static_cast<ptrdiff_t>(latency_quantile_ * static_cast<double>(sorted.size() - 1));
+    std::nth_element(sorted.begin(), quantile_it, sorted.end());
+    return *quantile_it;
+  }
+
+  void RecordLatency(double seconds) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (static_cast<int64_t>(latencies_.size()) < kWindowSize) {
+      latencies_.push_back(seconds);
+    } else {
+      latencies_[next_slot_] = seconds;
+      next_slot_ = (next_slot_ + 1) % kWindowSize;
+    }
+  }
+
+  void RecordRead() { ++reads_total_; }
+  void RecordHedge() { ++reads_hedged_; }
+  void RecordHedgeWin() { ++hedges_won_; }
+
+  S3HedgeMetrics metrics() const {
+    S3HedgeMetrics metrics;
+    metrics.reads_total = reads_total_.load();
+    metrics.reads_hedged = reads_hedged_.load();
+    metrics.hedges_won = hedges_won_.load();
+    return metrics;
+  }
+
+ private:
+  // Don't hedge until the latency estimate has a usable tail
+  static constexpr int64_t kMinSamples = 16;
+  static constexpr int64_t kWindowSize = 256;
+
+  const double latency_quantile_;
+  std::mutex mutex_;
+  std::vector<double> latencies_;
+  size_t next_slot_ = 0;
+  std::atomic<int64_t> reads_total_{0};
+  std::atomic<int64_t> reads_hedged_{0};
+  std::atomic<int64_t> hedges_won_{0};
+};
+
 // A RandomAccessFile that reads from a S3 object
 class ObjectInputFile final : public io::RandomAccessFile {
  public:
   ObjectInputFile(std::shared_ptr<S3ClientHolder> holder, const io::IOContext& io_context,
                   const S3Path& path, int64_t size = kNoSize,
-                  const std::string& sse_customer_key = "")
+                  const std::string& sse_customer_key = "",
+                  std::shared_ptr<HedgingContext> hedging = nullptr)
       : holder_(std::move(holder)),
         io_context_(io_context),
         path_(path),
         content_length_(size),
-        sse_customer_key_(sse_customer_key) {}
+        sse_customer_key_(sse_customer_key),
+        hedging_(std::move(hedging)) {}
 
   Status Init() {
     // Issue a HEAD Object to get the content-length and ensure any
@@ -1562,6 +1629,13 @@ class ObjectInputFile final : public io::RandomAccessFile {
       return 0;
     }
 
+    if (hedging_ != nullptr) {
+      return HedgedReadAt(position, nbytes, out);
+    }
+    return DoReadAt(position, nbytes, out);
+  }
+
+  Result<int64_t> DoReadAt(int64_t position, int64_t nbytes, void* out) {
     // Read the desired range of bytes
     ARROW_ASSIGN_OR_RAISE(auto client_lock, holder_->Lock());
     ARROW_ASSIGN_OR_RAISE(S3Model::GetObjectResult result,
@@ -1575,6 +1649,96 @@ class ObjectInputFile final : public io::RandomAccessFile {
     return stream.gcount();
   }
 
+  // Issue the read on a dedicated thread; if it is still outstanding past the
+  // adaptive latency threshold, issue a duplicate request and take whichever
+  // response arrives first.  The AWS SDK offers no way to cancel a
+  // synchronous GetObject, so the losing request runs to completion in the
+  // background and its response is dropped; each attempt therefore reads
+  // into its own buffer, which costs hedged reads one extra copy into `out`.
+  //
+  // Dedicated threads (rather than the IO executor) are used on purpose:
+  // ReadAt is typically already running on an IO executor thread, and waiting
+  // there for a task submitted to the same executor can deadlock a saturated
+  // pool.  The number of extra threads is bounded by the read concurrency.
+  Result<int64_t> HedgedReadAt(int64_t position, int64_t nbytes, void* out) {
+    hedging_->RecordRead();
+
+    struct Attempt {
+      std::unique_ptr<Buffer> buffer;
+      int64_t bytes_read;
+    };
+    struct State {
+      std::mutex mutex;
+      std::condition_variable cv;
+      int pending = 0;
+      bool done = false;
+      bool won_by_hedge = false;
+      Result<Attempt> result = Status::UnknownError("Hedged read never completed");
+    };
+    auto state = std::make_shared<State>();
+
+    auto launch = [&](bool is_hedge) {
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->done) {
+          return;
+        }
+        state->pending++;
+      }
+      std::thread([state, is_hedge, holder = holder_, path = path_,
+                   sse_customer_key = sse_customer_key_, pool = io_context_.pool(),
+                   position, nbytes]() {
+        auto attempt = [&]() -> Result<Attempt> {
+          ARROW_ASSIGN_OR_RAISE(auto buf, AllocateBuffer(nbytes, pool));
+          ARROW_ASSIGN_OR_RAISE(auto client_lock, holder->Lock());
+          ARROW_ASSIGN_OR_RAISE(
+              S3Model::GetObjectResult result,
+              GetObjectRange(client_lock.get(), path, sse_customer_key, position, nbytes,
+                             buf->mutable_data()));
+          auto& stream = result.GetBody();
+          stream.ignore(nbytes);
+          return Attempt{std::move(buf), stream.gcount()};
+        }();
+        std::lock_guard<std::mutex> lock(state->mutex);
+        state->pending--;
+        // The first success wins; an error only wins once no other attempt
+        // might still succeed.
+        if (!state->done && (attempt.ok() || state->pending == 0)) {
+          state->result = std::move(attempt);
+          state->won_by_hedge = is_hedge;
+          state->done = true;
+          state->cv.notify_one();
+        }
+      }).detach();
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    launch(/*is_hedge=*/false);
+
+    std::unique_lock<std::mutex> lock(state->mutex);
+    const std::optional<double> delay = hedging_->HedgeDelay();
+    if (delay.has_value()) {
+      state->cv.wait_for(lock, std::chrono::duration<double>(*delay),
+                         [&]() { return state->done; });
+      if (!state->done) {
+        hedging_->RecordHedge();
+        lock.unlock();
+        launch(/*is_hedge=*/true);
+        lock.lock();
+      }
+    }
+    state->cv.wait(lock, [&]() { return state->done; });
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    hedging_->RecordLatency(elapsed.count());
+    if (state->won_by_hedge) {
+      hedging_->RecordHedgeWin();
+    }
+    ARROW_ASSIGN_OR_RAISE(Attempt attempt, std::move(state->result));
+    memcpy(out, attempt.buffer->data(), static_cast<size_t>(attempt.bytes_read));
+    return attempt.bytes_read;
+  }
+
   Result<std::shared_ptr<Buffer>> ReadAt(int64_t position, int64_t nbytes) override {
     RETURN_NOT_OK(CheckClosed());
     RETURN_NOT_OK(CheckPosition(position, "read"));
@@ -1615,6 +1779,7 @@ class ObjectInputFile final : public io::RandomAccessFile {
   int64_t content_length_ = kNoSize;
   std::shared_ptr<const KeyValueMetadata> metadata_;
   std::string sse_customer_key_;
+  std::shared_ptr<HedgingContext> hedging_;
 };
 
 // Upload size per part. While AWS and Minio support different sizes for each
@@ -1651,6 +1816,8 @@ class ObjectOutputStream final : public io::OutputStream {
         metadata_(metadata),
         default_metadata_(options.default_metadata),
         background_writes_(options.background_writes),
+        background_writes_part_limit_(options.background_writes_part_limit),
+        upload_checksums_(options.upload_checksums),
         allow_delayed_open_(options.allow_delayed_open),
         sse_customer_key_(options.sse_customer_key) {}
 
@@ -1993,6 +2160,13 @@ class ObjectOutputStream final : public io::OutputStream {
     req.SetContentLength(nbytes);
     RETURN_NOT_OK(SetSSECustomerKey(&req, sse_customer_key_));
 
+    if (upload_checksums_ && nbytes != 0) {
+      // Let the server verify the payload of each part
+      StringViewStream checksum_stream(data, nbytes);
+      req.SetContentMD5(Aws::Utils::HashingUtils::Base64Encode(
+          Aws::Utils::HashingUtils::CalculateMD5(checksum_stream)));
+    }
+
     if (!background_writes_) {
       // GH-45304: avoid setting a body stream if length is 0.
       // This workaround can be removed once we require AWS SDK 1.11.489 or later.
@@ -2020,6 +2194,13 @@ class ObjectOutputStream final : public io::OutputStream {
 
       {
         std::unique_lock<std::mutex> lock(upload_state_->mutex);
+        if (background_writes_part_limit_ > 0) {
+          // Bound the number of parts buffered in memory: wait until an
+          // upload slot frees up before launching another background write.
+          upload_state_->upload_slot_freed.wait(lock, [&]() {
+            return upload_state_->uploads_in_progress < background_writes_part_limit_;
+          });
+        }
         if (upload_state_->uploads_in_progress++ == 0) {
           upload_state_->pending_uploads_completed = Future<>::Make();
         }
@@ -2157,7 +2338,9 @@ class ObjectOutputStream final : public io::OutputStream {
     }
 
     // Notify completion
-    if (--state->uploads_in_progress == 0) {
+    const bool all_done = (--state->uploads_in_progress == 0);
+    state->upload_slot_freed.notify_one();
+    if (all_done) {
       // GH-41862: avoid potential deadlock if the Future's callback is called
       // with the mutex taken.
       auto fut = state->pending_uploads_completed;
@@ -2192,6 +2375,8 @@ class ObjectOutputStream final : public io::OutputStream {
   const std::shared_ptr<const KeyValueMetadata> metadata_;
   const std::shared_ptr<const KeyValueMetadata> default_metadata_;
   const bool background_writes_;
+  const int32_t background_writes_part_limit_;
+  const bool upload_checksums_;
   const bool allow_delayed_open_;
 
   Aws::String multipart_upload_id_;
@@ -2208,6 +2393,8 @@ class ObjectOutputStream final : public io::OutputStream {
     // Only populated for multi-part uploads.
     Aws::Vector<S3Model::CompletedPart> completed_parts;
     int64_t uploads_in_progress = 0;
+    // Signalled when an upload finishes and a background write slot frees up.
+    std::condition_variable upload_slot_freed;
     Status status;
     Future<> pending_uploads_completed = Future<>::MakeFinished(Status::OK());
   };
@@ -2244,18 +2431,28 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
   io::IOContext io_context_;
   std::shared_ptr<S3ClientHolder> holder_;
   std::optional<S3Backend> backend_;
+  // Non-null iff options().hedge_reads is enabled
+  std::shared_ptr<HedgingContext> hedging_;
 
   static constexpr int32_t kListObjectsMaxKeys = 1000;
   // At most 1000 keys per multiple-delete request
   static constexpr int32_t kMultipleDeleteMaxKeys = 1000;
 
   explicit Impl(S3Options options, io::IOContext io_context)
-      : builder_(std::move(options)), io_context_(io_context) {}
+      : builder_(std::move(options)), io_context_(io_context) {
+    if (this->options().hedge_reads) {
+      hedging_ = std::make_shared<HedgingContext>(this->options().hedge_latency_quantile);
+    }
+  }
 
   Status Init() { return builder_.BuildClient(io_context_).Value(&holder_); }
 
   const S3Options& options() const { return builder_.options(); }
 
+  S3HedgeMetrics hedge_metrics() const {
+    return hedging_ ? hedging_->metrics() : S3HedgeMetrics{};
+  }
+
   std::string region() const {
     return std::string(FromAwsString(builder_.config().region));
   }
@@ -2478,6 +2675,95 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
         "ListObjectsV2", outcome.GetError());
   }
 
+  // Resolve several keys sharing a parent directory with prefix-windowed
+  // ListObjectsV2 calls (up to 1000 keys each) instead of one HeadObject call
+  // per key.  `indices` designates the paths to resolve; the matching slots
+  // of `results` are filled in (their path is assumed to be set already).
+  Status GetFileInfoBatchList(const std::vector<S3Path>& s3_paths,
+                              const std::vector<size_t>& indices,
+                              std::vector<FileInfo>* results) {
+    const std::string& bucket = s3_paths[indices.front()].bucket;
+    // Window the listing to the longest common prefix of the requested keys,
+    // so that stat-ing "part-*" files skips unrelated siblings
+    std::string prefix = s3_paths[indices.front()].key;
+    std::string last_key;
+    std::unordered_map<std::string, size_t> pending;
+    for (size_t i : indices) {
+      const std::string& key = s3_paths[i].key;
+      size_t common = 0;
+      while (common < prefix.size() && common < key.size() &&
+             prefix[common] == key[common]) {
+        ++common;
+      }
+      prefix.resize(common);
+      last_key = std::max(last_key, key);
+      pending.emplace(key, i);
+    }
+
+    bool truncated = true;
+    std::string continuation_token;
+    while (truncated && !pending.empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto client_lock, holder_->Lock());
+
+      S3Model::ListObjectsV2Request req;
+      req.SetBucket(ToAwsString(bucket));
+      if (!prefix.empty()) {
+        req.SetPrefix(ToAwsString(prefix));
+      }
+      req.SetDelimiter(Aws::String() + kSep);
+      req.SetMaxKeys(kListObjectsMaxKeys);
+      if (!continuation_token.empty()) {
+        req.SetContinuationToken(ToAwsString(continuation_token));
+      }
+      auto outcome = client_lock.Move()->ListObjectsV2(req);
+      if (!outcome.IsSuccess()) {
+        GetOrSetBackend(outcome.GetError());
+        if (IsNotFound(outcome.GetError())) {
+          // Nonexistent bucket: every pending key is missing
+          break;
+        }
+        return ErrorToStatus(
+            std::forward_as_tuple("When listing objects under key '", prefix,
+                                  "' in bucket '", bucket, "': "),
+            "ListObjectsV2", outcome.GetError());
+      }
+      const S3Model::ListObjectsV2Result& result = outcome.GetResult();
+      for (const auto& obj : result.GetContents()) {
+        auto it = pending.find(std::string(FromAwsString(obj.GetKey())));
+        if (it != pending.end()) {
+          FileObjectToInfo(obj, &(*results)[it->second]);
+          pending.erase(it);
+        }
+      }
+      for (const auto& child_prefix : result.GetCommonPrefixes()) {
+        // A common prefix "<key>/" means <key> is a (possibly empty) "directory"
+        const auto child =
+            internal::RemoveTrailingSlash(FromAwsString(child_prefix.GetPrefix()));
+        auto it = pending.find(std::string(child));
+        if (it != pending.end()) {
+          (*results)[it->second].set_type(FileType::Directory);
+          pending.erase(it);
+        }
+      }
+      truncated = result.GetIsTruncated();
+      if (truncated) {
+        continuation_token = std::string(FromAwsString(result.GetNextContinuationToken()));
+      }
+      // Listings are lexicographic: once past the largest requested key and
+      // its potential children, no further page can match
+      if (!result.GetContents().empty() &&
+          std::string(FromAwsString(result.GetContents().back().GetKey())) >
+              last_key + kSep) {
+        break;
+      }
+    }
+    // Everything the listing didn't cover does not exist
+    for (const auto& [key, i] : pending) {
+      (*results)[i].set_type(FileType::NotFound);
+    }
+    return Status::OK();
+  }
+
   static FileInfo MakeDirectoryInfo(std::string dirname) {
     FileInfo dir;
     dir.set_type(FileType::Directory);
@@ -3035,7 +3321,7 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
     RETURN_NOT_OK(CheckS3Initialized());
 
     auto ptr = std::make_shared<ObjectInputFile>(holder_, fs->io_context(), path, kNoSize,
-                                                 fs->options().sse_customer_key);
+                                                 fs->options().sse_customer_key, hedging_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -3055,8 +3341,9 @@ class S3FileSystem::Impl : public std::enable_shared_from_this<S3FileSystem::Imp
 
     RETURN_NOT_OK(CheckS3Initialized());
 
-    auto ptr = std::make_shared<ObjectInputFile>(
-        holder_, fs->io_context(), path, info.size(), fs->options().sse_customer_key);
+    auto ptr = std::make_shared<ObjectInputFile>(holder_, fs->io_context(), path,
+                                                 info.size(),
+                                                 fs->options().sse_customer_key, hedging_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -3122,6 +3409,8 @@ S3Options S3FileSystem::options() const { return impl_->options(); }
 
 std::string S3FileSystem::region() const { return impl_->region(); }
 
+S3HedgeMetrics S3FileSystem::hedge_metrics() const { return impl_->hedge_metrics(); }
+
 Result<FileInfo> S3FileSystem::GetFileInfo(const std::string& s) {
   ARROW_ASSIGN_OR_RAISE(auto client_lock, impl_->holder_->Lock());
 
@@ -3189,6 +3478,43 @@ Result<FileInfo> S3FileSystem::GetFileInfo(const std::string& s) {
   }
 }
 
+Result<FileInfoVector> S3FileSystem::GetFileInfo(const std::vector<std::string>& paths) {
+  // Minimum number of keys under one parent before a listing beats
+  // per-key HeadObject calls
+  constexpr size_t kMinBatchListSize = 2;
+
+  FileInfoVector results(paths.size());
+  std::vector<S3Path> s3_paths(paths.size());
+  std::vector<size_t> singles;
+  // Requested keys grouped by bucket and parent directory
+  std::unordered_map<std::string, std::vector<size_t>> groups;
+  for (size_t i = 0; i < paths.size(); ++i) {
+    ARROW_ASSIGN_OR_RAISE(s3_paths[i], S3Path::FromString(paths[i]));
+    results[i].set_path(paths[i]);
+    if (s3_paths[i].key.empty()) {
+      // Root or bucket lookups stay on the single-path code path
+      singles.push_back(i);
+      continue;
+    }
+    const auto slash = s3_paths[i].key.find_last_of(kSep);
+    const std::string parent =
+        (slash == std::string::npos) ? std::string() : s3_paths[i].key.substr(0, slash);
+    groups[s3_paths[i].bucket + kSep + parent].push_back(i);
+  }
+
+  for (const auto& [parent, indices] : groups) {
+    if (indices.size() < kMinBatchListSize) {
+      singles.insert(singles.end(), indices.begin(), indices.end());
+      continue;
+    }
+    RETURN_NOT_OK(impl_->GetFileInfoBatchList(s3_paths, indices, &results));
+  }
+  for (size_t i : singles) {
+    ARROW_ASSIGN_OR_RAISE(results[i], GetFileInfo(paths[i]));
+  }
+  return results;
+}
+
 Result<FileInfoVector> S3FileSystem::GetFileInfo(const FileSelector& select) {
   Future<std::vector<FileInfoVector>> file_infos_fut =
       CollectAsyncGenerator(GetFileInfoGenerator(select));
@@ -3205,6 +3531,27 @@ FileInfoGenerator S3FileSystem::GetFileInfoGenerator(const FileSelector& select)
   return impl_->GetFileInfoGenerator(select);
 }
 
+FileInfoGenerator S3FileSystem::GetFileInfoGenerator(
+    const std::vector<std::string>& paths) {
+  // Resolve the paths window by window on the IO executor, so that consumers
+  // (e.g. dataset discovery) start working while later windows are still
+  // being listed
+  constexpr size_t kPathsPerWindow = 1000;
+  std::vector<std::vector<std::string>> windows;
+  for (size_t start = 0; start < paths.size(); start += kPathsPerWindow) {
+    windows.emplace_back(paths.begin() + start,
+                         paths.begin() + std::min(paths.size(), start + kPathsPerWindow));
+  }
+  auto self = std::static_pointer_cast<S3FileSystem>(shared_from_this());
+  return MakeMappedGenerator(
+      MakeVectorGenerator(std::move(windows)),
+      [self](const std::vector<std::string>& window) -> Future<FileInfoVector> {
+        return DeferNotOk(SubmitIO(self->io_context(), [self, window]() {
+          return self->GetFileInfo(window);
+        }));
+      });
+}
+
 Status S3FileSystem::CreateDir(const std::string& s, bool recursive) {
   ARROW_ASSIGN_OR_RAISE(auto path, S3Path::FromString(s));
 
@@ -151,6 +151,39 @@ struct ARROW_EXPORT S3Options {
   /// Whether OutputStream writes will be issued in the background, without blocking.
   bool background_writes = true;
 
+  /// Maximum number of upload parts that may be in flight in the background
+  /// per output stream.
+  ///
+  /// Only relevant when `background_writes` is enabled. Each in-flight part
+  /// buffers up to 10 MB in memory, so this bounds the memory used by a
+  /// single output stream; once the limit is reached, Write() blocks until a
+  /// part finishes uploading. 0 means no limit.
+  int32_t background_writes_part_limit = 8;
+
+  /// Whether to attach a Content-MD5 checksum to each upload so the server
+  /// verifies the payload of every part.
+  bool upload_checksums = false;
+
+  /// Whether to hedge slow range reads with a duplicate request.
+  ///
+  /// S3 tail latencies (p99.9) can reach multiple seconds and stall whole
+  /// scans.  When enabled, a GetObject range request that has been outstanding
+  /// for longer than the `hedge_latency_quantile` of recently observed read
+  /// latencies is duplicated and the first response wins; the straggler's
+  /// response is discarded.  This bounds tail latency at the cost of a small
+  /// fraction of duplicate requests.
+  ///
+  /// Counters describing hedging activity are available through
+  /// S3FileSystem::hedge_metrics().
+  bool hedge_reads = false;
+
+  /// Latency quantile past which an outstanding read is hedged.
+  ///
+  /// Must be in (0, 1); with the default, roughly 5% of reads are duplicated.
+  /// The threshold adapts as read latencies are observed; until enough reads
+  /// have completed on this filesystem, no hedging takes place.
+  double hedge_latency_quantile = 0.95;
+
   /// Whether to allow creation of buckets
   ///
   /// When S3FileSystem creates new buckets, it does not pass any non-default settings.
@@ -286,6 +319,19 @@ struct ARROW_EXPORT S3Options {
                                    std::string* out_path = NULLPTR);
 };
 
+/// Counters describing hedged-read activity on a S3FileSystem.
+///
+/// All counters are cumulative since the filesystem was created.
+/// See S3Options::hedge_reads.
+struct ARROW_EXPORT S3HedgeMetrics {
+  /// Number of range reads issued (not counting duplicate requests)
+  int64_t reads_total = 0;
+  /// Number of reads that were hedged with a duplicate request
+  int64_t reads_hedged = 0;
+  /// Number of hedged reads where the duplicate response arrived first
+  int64_t hedges_won = 0;
+};
+
 /// S3-backed FileSystem implementation.
 ///
 /// Some implementation notes:
@@ -302,6 +348,11 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   /// Return the actual region this filesystem connects to
   std::string region() const;
 
+  /// Return counters describing hedged-read activity.
+  ///
+  /// All counters are zero unless S3Options::hedge_reads is enabled.
+  S3HedgeMetrics hedge_metrics() const;
+
   bool Equals(const FileSystem& other) const override;
   Result<std::string> PathFromUri(const std::string& uri_string) const override;
   Result<std::string> MakeUri(std::string path) const override;
@@ -316,9 +367,16 @@ class ARROW_EXPORT S3FileSystem : public FileSystem {
   /// \endcond
 
   Result<FileInfo> GetFileInfo(const std::string& path) override;
+  /// Batched variant: paths sharing a parent directory are resolved with
+  /// prefix-windowed ListObjectsV2 calls (up to 1000 keys per request)
+  /// instead of one HeadObject call per path.
+  Result<std::vector<FileInfo>> GetFileInfo(const std::vector<std::string>& paths) override;
   Result<std::vector<FileInfo>> GetFileInfo(const FileSelector& select) override;
 
   FileInfoGenerator GetFileInfoGenerator(const FileSelector& select) override;
+  /// Streaming variant of the batched GetFileInfo above, yielding infos
+  /// window by window as the listings complete.
+  FileInfoGenerator GetFileInfoGenerator(const std::vector<std::string>& paths) override;
 
   Status CreateDir(const std::string& path, bool recursive) override;
 
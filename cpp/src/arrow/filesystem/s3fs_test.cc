@@ -1356,6 +1356,34 @@ TEST_F(TestS3FS, OpenInputFile) {
   ASSERT_RAISES(IOError, file->Seek(10));
 }
 
+TEST_F(TestS3FS, OpenInputFileHedgedReads) {
+  options_.hedge_reads = true;
+  MakeFileSystem();
+
+  ASSERT_EQ(fs_->hedge_metrics().reads_total, 0);
+
+  std::shared_ptr<io::RandomAccessFile> file;
+  std::shared_ptr<Buffer> buf;
+  ASSERT_OK_AND_ASSIGN(file, fs_->OpenInputFile("bucket/somefile"));
+
+  // Results are as with regular reads; issue enough reads that the adaptive
+  // hedging threshold kicks in for the later ones.
+  for (int i = 0; i < 20; ++i) {
+    ASSERT_OK_AND_ASSIGN(buf, file->ReadAt(2, 5));
+    AssertBufferEqual(*buf, "me da");
+  }
+  char result[10];
+  ASSERT_OK_AND_EQ(4, file->ReadAt(5, 20, &result));
+  ASSERT_OK_AND_EQ(0, file->ReadAt(9, 0, &result));
+  ASSERT_RAISES(IOError, file->ReadAt(10, 20));
+
+  // Zero-length reads don't hit S3 and aren't counted
+  const auto metrics = fs_->hedge_metrics();
+  ASSERT_EQ(metrics.reads_total, 21);
+  ASSERT_LE(metrics.reads_hedged, metrics.reads_total);
+  ASSERT_LE(metrics.hedges_won, metrics.reads_hedged);
+}
+
 // Minio only allows Server Side Encryption on HTTPS client connections.
 #ifdef ENABLE_TLS_TESTS
 class TestS3FSHTTPS : public TestS3FS {
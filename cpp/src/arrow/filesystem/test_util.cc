@@ -691,8 +691,10 @@ void GenericFileSystemTest::TestGetFileInfoAsync(FileSystem* fs) {
   ASSERT_OK(fs->CreateDir("AB/CD"));
   CreateFile(fs, "AB/CD/ghi", "some data");
 
+  const std::vector<std::string> paths{"AB",    "AB/CD", "AB/zz",
+                                       "zz",    "XX/zz", "AB/CD/ghi"};
   std::vector<FileInfo> infos;
-  auto fut = fs->GetFileInfoAsync({"AB", "AB/CD", "AB/zz", "zz", "XX/zz", "AB/CD/ghi"});
+  auto fut = fs->GetFileInfoAsync(paths);
   ASSERT_FINISHES_OK_AND_ASSIGN(infos, fut);
 
   ASSERT_EQ(infos.size(), 6);
@@ -702,6 +704,14 @@ void GenericFileSystemTest::TestGetFileInfoAsync(FileSystem* fs) {
   AssertFileInfo(infos[3], "zz", FileType::NotFound);
   AssertFileInfo(infos[4], "XX/zz", FileType::NotFound);
   AssertFileInfo(infos[5], "AB/CD/ghi", FileType::File, 9);
+
+  // The streaming variant yields the same infos, possibly in several batches
+  infos.clear();
+  CollectFileInfoGenerator(fs->GetFileInfoGenerator(paths), &infos);
+  ASSERT_EQ(infos.size(), 6);
+  AssertFileInfo(infos[0], "AB", FileType::Directory);
+  AssertFileInfo(infos[2], "AB/zz", FileType::NotFound);
+  AssertFileInfo(infos[5], "AB/CD/ghi", FileType::File, 9);
 }
 
 void GenericFileSystemTest::TestGetFileInfoVector(FileSystem* fs) {
@@ -20,12 +20,18 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <utility>
 
 #include "arrow/buffer.h"
+#include "arrow/record_batch.h"
 #include "arrow/ipc/options.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
@@ -680,6 +686,235 @@ arrow::Result<std::unique_ptr<FlightStreamReader>> FlightClient::DoGet(
   return stream_reader;
 }
 
+namespace {
+
+/// A RecordBatchReader that pulls all endpoints of a FlightInfo through a
+/// pool of worker threads, buffering batches per endpoint.
+class ParallelDoGetReader : public RecordBatchReader {
+ public:
+  ParallelDoGetReader(FlightClient* client, FlightCallOptions call_options,
+                      std::shared_ptr<Schema> schema,
+                      std::vector<FlightEndpoint> endpoints,
+                      const FlightParallelReadOptions& parallel_options)
+      : client_(client),
+        call_options_(std::move(call_options)),
+        schema_(std::move(schema)),
+        endpoints_(std::move(endpoints)),
+        parallel_options_(parallel_options),
+        states_(endpoints_.size()) {}
+
+  ~ParallelDoGetReader() override { ARROW_WARN_NOT_OK(Close(), "Failed to close"); }
+
+  void Start() {
+    const size_t num_workers =
+        std::min(static_cast<size_t>(std::max(1, parallel_options_.max_parallelism)),
+                 endpoints_.size());
+    workers_.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+      workers_.emplace_back([this] { WorkerLoop(); });
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      if (stopped_) {
+        batch->reset();
+        return Status::Cancelled("Parallel read was closed");
+      }
+      if (parallel_options_.preserve_order) {
+        bool waiting = false;
+        while (current_endpoint_ < states_.size()) {
+          EndpointState& state = states_[current_endpoint_];
+          if (!state.batches.empty()) {
+            *batch = std::move(state.batches.front());
+            state.batches.pop_front();
+            state.consumed_any = true;
+            return Status::OK();
+          }
+          if (!state.status.ok()) return state.status;
+          if (!state.done) {
+            waiting = true;
+            break;
+          }
+          ++current_endpoint_;
+        }
+        if (!waiting && current_endpoint_ >= states_.size()) {
+          batch->reset();
+          return Status::OK();
+        }
+      } else {
+        size_t num_done = 0;
+        for (EndpointState& state : states_) {
+          if (!state.batches.empty()) {
+            *batch = std::move(state.batches.front());
+            state.batches.pop_front();
+            state.consumed_any = true;
+            return Status::OK();
+          }
+          if (!state.status.ok()) return state.status;
+          if (state.done) ++num_done;
+        }
+        if (num_done == states_.size()) {
+          batch->reset();
+          return Status::OK();
+        }
+      }
+      cv_.wait(lock);
+    }
+  }
+
+  Status Close() override {
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      stopped_ = true;
+      for (EndpointState& state : states_) {
+        if (state.reader) state.reader->Cancel();
+      }
+    }
+    cv_.notify_all();
+    for (std::thread& worker : workers_) {
+      if (worker.joinable()) worker.join();
+    }
+    workers_.clear();
+    return Status::OK();
+  }
+
+ private:
+  struct EndpointState {
+    std::deque<std::shared_ptr<RecordBatch>> batches;
+    std::shared_ptr<FlightStreamReader> reader;
+    Status status;
+    bool done = false;
+    bool consumed_any = false;
+  };
+
+  void WorkerLoop() {
+    while (true) {
+      const size_t index = next_endpoint_.fetch_add(1);
+      if (index >= endpoints_.size()) return;
+      {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (stopped_) return;
+      }
+      ProcessEndpoint(index);
+    }
+  }
+
+  void ProcessEndpoint(size_t index) {
+    EndpointState& state = states_[index];
+    for (int attempt = 0;; ++attempt) {
+      const Status status = FetchEndpoint(index);
+      bool retryable = false;
+      {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (status.ok()) {
+          state.done = true;
+        } else {
+          retryable = !stopped_ && !state.consumed_any &&
+                      attempt < parallel_options_.max_retries;
+          if (retryable) {
+            // Start the endpoint over; drop any buffered batches so the
+            // caller doesn't see duplicates.
+            state.batches.clear();
+          } else {
+            state.status = status;
+            state.done = true;
+          }
+        }
+      }
+      cv_.notify_all();
+      if (!retryable) return;
+      std::this_thread::sleep_for(parallel_options_.retry_backoff * (1 << attempt));
+    }
+  }
+
+  Status FetchEndpoint(size_t index) {
+    const FlightEndpoint& endpoint = endpoints_[index];
+    std::unique_ptr<FlightClient> owned_client;
+    FlightClient* client = client_;
+    if (!endpoint.locations.empty()) {
+      Status connect_status;
+      for (const Location& location : endpoint.locations) {
+        auto maybe_client = FlightClient::Connect(location);
+        if (maybe_client.ok()) {
+          owned_client = std::move(maybe_client).ValueOrDie();
+          client = owned_client.get();
+          connect_status = Status::OK();
+          break;
+        }
+        connect_status = maybe_client.status();
+      }
+      RETURN_NOT_OK(connect_status);
+    }
+    ARROW_ASSIGN_OR_RAISE(std::unique_ptr<FlightStreamReader> stream,
+                          client->DoGet(call_options_, endpoint.ticket));
+    std::shared_ptr<FlightStreamReader> reader = std::move(stream);
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      if (stopped_) return Status::Cancelled("Parallel read was closed");
+      states_[index].reader = reader;
+    }
+    Status status;
+    while (true) {
+      auto maybe_chunk = reader->Next();
+      if (!maybe_chunk.ok()) {
+        status = maybe_chunk.status();
+        break;
+      }
+      FlightStreamChunk chunk = std::move(maybe_chunk).ValueOrDie();
+      if (chunk.data == nullptr) break;
+      {
+        std::lock_guard<std::mutex> guard(mutex_);
+        if (stopped_) {
+          status = Status::Cancelled("Parallel read was closed");
+          break;
+        }
+        states_[index].batches.push_back(std::move(chunk.data));
+      }
+      cv_.notify_all();
+    }
+    {
+      std::lock_guard<std::mutex> guard(mutex_);
+      states_[index].reader.reset();
+    }
+    return status;
+  }
+
+  FlightClient* client_;
+  const FlightCallOptions call_options_;
+  const std::shared_ptr<Schema> schema_;
+  const std::vector<FlightEndpoint> endpoints_;
+  const FlightParallelReadOptions parallel_options_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<EndpointState> states_;
+  std::vector<std::thread> workers_;
+  std::atomic<size_t> next_endpoint_{0};
+  size_t current_endpoint_ = 0;
+  bool stopped_ = false;
+};
+
+}  // namespace
+
+arrow::Result<std::shared_ptr<RecordBatchReader>> FlightClient::DoGetAll(
+    const FlightCallOptions& options, const FlightInfo& info,
+    const FlightParallelReadOptions& parallel_options) {
+  RETURN_NOT_OK(CheckOpen());
+  if (info.endpoints().empty()) {
+    return Status::Invalid("FlightInfo has no endpoints");
+  }
+  ipc::DictionaryMemo memo;
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Schema> schema, info.GetSchema(&memo));
+  auto reader = std::make_shared<ParallelDoGetReader>(
+      this, options, std::move(schema), info.endpoints(), parallel_options);
+  reader->Start();
+  return reader;
+}
+
 arrow::Result<FlightClient::DoPutResult> FlightClient::DoPut(
     const FlightCallOptions& options, const FlightDescriptor& descriptor,
     const std::shared_ptr<Schema>& schema) {
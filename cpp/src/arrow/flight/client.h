@@ -126,6 +126,32 @@ struct ARROW_FLIGHT_EXPORT FlightClientOptions {
   static FlightClientOptions Defaults();
 };
 
+/// \brief Options for FlightClient::DoGetAll.
+struct ARROW_FLIGHT_EXPORT FlightParallelReadOptions {
+  /// \brief The maximum number of endpoints to fetch concurrently.
+  int max_parallelism = 4;
+
+  /// \brief The number of times to retry a failed endpoint before
+  ///     failing the read.
+  ///
+  /// An endpoint is only retried while none of its batches have been
+  /// returned to the caller; once a batch from an endpoint has been
+  /// consumed, a failure on that endpoint fails the read.
+  int max_retries = 0;
+
+  /// \brief The delay before the first retry of an endpoint. The
+  ///     delay doubles on each subsequent retry.
+  TimeoutDuration retry_backoff = std::chrono::milliseconds(100);
+
+  /// \brief If true, return batches grouped by endpoint, in the order
+  ///     the endpoints appear in the FlightInfo.
+  ///
+  /// Otherwise, batches are returned in arrival order across all
+  /// endpoints. Should generally be set when FlightInfo::ordered() is
+  /// true.
+  bool preserve_order = false;
+};
+
 /// \brief A RecordBatchReader exposing Flight metadata and cancel
 /// operations.
 class ARROW_FLIGHT_EXPORT FlightStreamReader : public MetadataRecordBatchReader {
@@ -339,6 +365,28 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket);
   }
 
+  /// \brief Fetch all endpoints of a flight concurrently and merge the
+  /// streams into a single RecordBatchReader.
+  ///
+  /// Endpoints that carry locations are fetched by connecting to the
+  /// first reachable location; endpoints without locations are fetched
+  /// from this client. The reader's schema is taken from the
+  /// FlightInfo. Closing the reader cancels any streams still in
+  /// flight. This client must outlive the returned reader.
+  ///
+  /// \param[in] options Per-RPC options, applied to every DoGet call
+  /// \param[in] info the flight whose endpoints to fetch
+  /// \param[in] parallel_options concurrency, retry and ordering options
+  /// \return Arrow result with the merged RecordBatchReader
+  arrow::Result<std::shared_ptr<RecordBatchReader>> DoGetAll(
+      const FlightCallOptions& options, const FlightInfo& info,
+      const FlightParallelReadOptions& parallel_options = FlightParallelReadOptions());
+  arrow::Result<std::shared_ptr<RecordBatchReader>> DoGetAll(
+      const FlightInfo& info,
+      const FlightParallelReadOptions& parallel_options = FlightParallelReadOptions()) {
+    return DoGetAll({}, info, parallel_options);
+  }
+
   /// \brief DoPut return value
   struct DoPutResult {
     /// \brief a writer to write record batches to
@@ -727,6 +727,40 @@ TEST(GrpcTransport, FlightDataDeserialize) {
 #endif
 }
 
+TEST(GrpcTransport, FlightDataDeserializeMultiSlice) {
+#ifndef _WIN32
+  pb::FlightData raw;
+  const std::string body(64, 'x');
+  raw.GetReflection()->MutableUnknownFields(&raw)->AddLengthDelimited(
+      pb::FlightData::kDataBodyFieldNumber, body);
+  auto serialized = raw.SerializeAsString();
+
+  // Split the message at various points so the body lands entirely within one
+  // slice (referenced without a copy) or spans two of them (copied); both
+  // paths must reassemble the same bytes.
+  for (size_t split : {static_cast<size_t>(1), static_cast<size_t>(2),
+                       serialized.size() / 2}) {
+    grpc_slice raw_slices[2] = {
+        grpc_slice_from_copied_buffer(serialized.data(), split),
+        grpc_slice_from_copied_buffer(serialized.data() + split,
+                                      serialized.size() - split)};
+    // gRPC requires that grpc_slice and grpc::Slice have the same representation
+    grpc::ByteBuffer buffer(reinterpret_cast<const grpc::Slice*>(raw_slices),
+                            /*nslices=*/2);
+
+    flight::internal::FlightData out;
+    auto status = flight::transport::grpc::FlightDataDeserialize(&buffer, &out);
+    ASSERT_TRUE(status.ok());
+    ASSERT_EQ(body, out.body->ToString());
+
+    grpc_slice_unref(raw_slices[0]);
+    grpc_slice_unref(raw_slices[1]);
+  }
+#else
+  GTEST_SKIP() << "Can't use Protobuf symbols on Windows";
+#endif
+}
+
 // ----------------------------------------------------------------------
 // Transport abstraction tests
 
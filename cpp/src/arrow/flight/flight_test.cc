@@ -1025,6 +1025,48 @@ TEST_F(TestFlightClient, GetSchema) {
   ASSERT_OK(schema_result->GetSchema(&dict_memo));
 }
 
+TEST_F(TestFlightClient, DoGetAll) {
+  RecordBatchVector expected_batches;
+  ASSERT_OK(ExampleIntBatches(&expected_batches));
+  auto descr = FlightDescriptor::Path({"examples", "ints"});
+
+  // Endpoints without locations are fetched through this client
+  FlightEndpoint endpoint{Ticket{"ticket-ints-1"}, {}, std::nullopt, {}};
+  FlightInfo info = MakeFlightInfo(*ExampleIntSchema(), descr, {endpoint, endpoint},
+                                   /*total_records=*/-1, /*total_bytes=*/-1,
+                                   /*ordered=*/true, /*app_metadata=*/"");
+
+  FlightParallelReadOptions parallel_options;
+  parallel_options.preserve_order = true;
+  ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetAll(info, parallel_options));
+  AssertSchemaEqual(*ExampleIntSchema(), *reader->schema());
+
+  // Both endpoints serve the same batches; ordered reassembly yields
+  // them back to back
+  std::shared_ptr<RecordBatch> batch;
+  const auto num_batches = static_cast<int>(expected_batches.size());
+  for (int i = 0; i < 2 * num_batches; ++i) {
+    ASSERT_OK(reader->ReadNext(&batch));
+    ASSERT_NE(nullptr, batch);
+    ASSERT_BATCHES_EQUAL(*expected_batches[i % num_batches], *batch);
+  }
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_EQ(nullptr, batch);
+  ASSERT_OK(reader->Close());
+}
+
+TEST_F(TestFlightClient, DoGetAllUnknownTicket) {
+  auto descr = FlightDescriptor::Path({"examples", "ints"});
+  FlightEndpoint endpoint{Ticket{"ticket-unknown"}, {}, std::nullopt, {}};
+  FlightInfo info = MakeFlightInfo(*ExampleIntSchema(), descr, {endpoint},
+                                   /*total_records=*/-1, /*total_bytes=*/-1,
+                                   /*ordered=*/false, /*app_metadata=*/"");
+
+  ASSERT_OK_AND_ASSIGN(auto reader, client_->DoGetAll(info));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_RAISES(NotImplemented, reader->ReadNext(&batch));
+}
+
 TEST_F(TestFlightClient, GetFlightInfoNotFound) {
   auto descr = FlightDescriptor::Path({"examples", "things"});
   // XXX Ideally should be Invalid (or KeyError), but gRPC doesn't support
@@ -37,6 +37,8 @@
 #include "arrow/flight/transport/grpc/grpc_server.h"
 #include "arrow/flight/transport_server.h"
 #include "arrow/flight/types.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/ipc/writer.h"
 #include "arrow/status.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
@@ -157,6 +159,8 @@ Status FlightServerBase::Init(const FlightServerOptions& options) {
   ARROW_ASSIGN_OR_RAISE(impl_->transport_,
                         internal::GetDefaultTransportRegistry()->MakeServer(
                             scheme, this, options.memory_manager));
+  impl_->transport_->SetIngestControls(options.max_concurrent_puts,
+                                       options.put_coalesce_bytes);
   return impl_->transport_->Init(options, *options.location.uri_);
 }
 
@@ -349,6 +353,74 @@ class RecordBatchStream::RecordBatchStreamImpl {
   int dictionary_index_ = 0;
 };
 
+// ----------------------------------------------------------------------
+// Implement RecordBatchFileStream
+
+class RecordBatchFileStream::RecordBatchFileStreamImpl {
+ public:
+  RecordBatchFileStreamImpl(std::shared_ptr<ipc::RecordBatchFileReader> reader,
+                            const ipc::IpcWriteOptions& options)
+      : reader_(std::move(reader)), mapper_(*reader_->schema()), ipc_options_(options) {}
+
+  std::shared_ptr<Schema> schema() { return reader_->schema(); }
+
+  Status GetSchemaPayload(FlightPayload* payload) {
+    return ipc::GetSchemaPayload(*reader_->schema(), ipc_options_, mapper_,
+                                 &payload->ipc_message);
+  }
+
+  Status Next(FlightPayload* payload) {
+    std::unique_ptr<ipc::Message> message;
+    if (dictionary_index_ < reader_->num_dictionaries()) {
+      ARROW_ASSIGN_OR_RAISE(message, reader_->ReadDictionaryMessage(dictionary_index_++));
+    } else if (batch_index_ < reader_->num_record_batches()) {
+      ARROW_ASSIGN_OR_RAISE(message, reader_->ReadRecordBatchMessage(batch_index_++));
+    } else {
+      // Signal that iteration is over
+      payload->ipc_message.metadata = nullptr;
+      return Status::OK();
+    }
+    payload->ipc_message.type = message->type();
+    payload->ipc_message.metadata = message->metadata();
+    payload->ipc_message.body_length = message->body_length();
+    if (message->body() != nullptr) {
+      payload->ipc_message.body_buffers.push_back(message->body());
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+  ipc::DictionaryFieldMapper mapper_;
+  ipc::IpcWriteOptions ipc_options_;
+
+  // Indices of the next dictionary and record batch messages to send
+  int dictionary_index_ = 0;
+  int batch_index_ = 0;
+};
+
+RecordBatchFileStream::RecordBatchFileStream(
+    std::shared_ptr<ipc::RecordBatchFileReader> reader,
+    const ipc::IpcWriteOptions& options) {
+  impl_.reset(new RecordBatchFileStreamImpl(std::move(reader), options));
+}
+
+RecordBatchFileStream::~RecordBatchFileStream() = default;
+
+std::shared_ptr<Schema> RecordBatchFileStream::schema() { return impl_->schema(); }
+
+arrow::Result<FlightPayload> RecordBatchFileStream::GetSchemaPayload() {
+  FlightPayload payload;
+  RETURN_NOT_OK(impl_->GetSchemaPayload(&payload));
+  return payload;
+}
+
+arrow::Result<FlightPayload> RecordBatchFileStream::Next() {
+  FlightPayload payload;
+  RETURN_NOT_OK(impl_->Next(&payload));
+  return payload;
+}
+
 FlightMetadataWriter::~FlightMetadataWriter() = default;
 
 FlightDataStream::~FlightDataStream() {}
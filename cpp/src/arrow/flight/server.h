@@ -85,6 +85,33 @@ class ARROW_FLIGHT_EXPORT RecordBatchStream : public FlightDataStream {
   std::unique_ptr<RecordBatchStreamImpl> impl_;
 };
 
+/// \brief A FlightDataStream that serves a stored Arrow IPC file
+/// without re-serializing it
+///
+/// Dictionary and record batch messages are relayed to the client
+/// exactly as stored in the file, skipping the decode to RecordBatch
+/// and re-encode that RecordBatchStream performs. Only the schema
+/// message is regenerated, using the default field-order dictionary id
+/// assignment (the assignment the C++ IPC file writer produces).
+class ARROW_FLIGHT_EXPORT RecordBatchFileStream : public FlightDataStream {
+ public:
+  /// \param[in] reader an open IPC file reader whose messages to serve
+  /// \param[in] options IPC options for writing the schema message
+  explicit RecordBatchFileStream(
+      std::shared_ptr<ipc::RecordBatchFileReader> reader,
+      const ipc::IpcWriteOptions& options = ipc::IpcWriteOptions::Defaults());
+  ~RecordBatchFileStream() override;
+
+  std::shared_ptr<Schema> schema() override;
+  arrow::Result<FlightPayload> GetSchemaPayload() override;
+
+  arrow::Result<FlightPayload> Next() override;
+
+ private:
+  class RecordBatchFileStreamImpl;
+  std::unique_ptr<RecordBatchFileStreamImpl> impl_;
+};
+
 /// \brief A reader for IPC payloads uploaded by a client. Also allows
 /// reading application-defined metadata via the Flight protocol.
 class ARROW_FLIGHT_EXPORT FlightMessageReader : public MetadataRecordBatchReader {
@@ -169,6 +196,23 @@ class ARROW_FLIGHT_EXPORT FlightServerOptions {
   /// \brief An optional memory manager to control where to allocate incoming data.
   std::shared_ptr<MemoryManager> memory_manager;
 
+  /// \brief Maximum number of DoPut streams served concurrently.
+  ///
+  /// Additional streams are rejected up front with a retriable
+  /// Unavailable status, shedding ingestion load before the server
+  /// runs out of memory. Zero (the default) means unlimited.
+  int max_concurrent_puts = 0;
+
+  /// \brief Coalesce consecutive small DoPut batches up to this many bytes.
+  ///
+  /// Clients flooding a server with tiny batches impose per-batch
+  /// overhead on the DoPut handler. When positive, consecutive batches
+  /// are concatenated until their combined buffer size reaches this
+  /// threshold before being handed to the handler; batches carrying
+  /// application metadata are never merged. Zero (the default)
+  /// disables coalescing.
+  int64_t put_coalesce_bytes = 0;
+
   /// \brief A Flight implementation-specific callback to customize
   /// transport-specific options.
   ///
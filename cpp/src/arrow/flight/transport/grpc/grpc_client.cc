@@ -804,6 +804,10 @@ class GrpcClientImpl : public internal::ClientTransport {
     // Setting this arg enables each client to open it's own TCP connection to server,
     // not sharing one single connection, which becomes bottleneck under high load.
     default_args[GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL] = 1;
+    // Advertise large HTTP/2 frames. The 16 KiB default forces
+    // excessive framing overhead when streaming record batch bodies
+    // over high-bandwidth links; gRPC clamps this to its allowed range.
+    default_args[GRPC_ARG_HTTP2_MAX_FRAME_SIZE] = 1 << 20;
 
     if (options.override_hostname != "") {
       args.SetSslTargetNameOverride(options.override_hostname);
@@ -19,9 +19,11 @@
 
 // todo cleanup includes
 
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -150,6 +152,99 @@ class GrpcBuffer : public MutableBuffer {
   grpc_slice slice_;
 };
 
+// A ZeroCopyInputStream that walks the slices of an uncompressed gRPC
+// ByteBuffer in place, so a multi-slice message can be parsed without first
+// being coalesced into one contiguous allocation.
+class SliceInputStream : public ::google::protobuf::io::ZeroCopyInputStream {
+ public:
+  SliceInputStream(const grpc_slice* slices, size_t slice_count)
+      : slices_(slices), slice_count_(slice_count) {}
+
+  bool Next(const void** data, int* size) override {
+    while (index_ < slice_count_) {
+      const grpc_slice& slice = slices_[index_];
+      const int64_t length = static_cast<int64_t>(GRPC_SLICE_LENGTH(slice));
+      if (offset_ < length) {
+        *data = GRPC_SLICE_START_PTR(slice) + offset_;
+        *size = static_cast<int>(length - offset_);
+        byte_count_ += length - offset_;
+        offset_ = length;
+        return true;
+      }
+      ++index_;
+      offset_ = 0;
+    }
+    return false;
+  }
+
+  void BackUp(int count) override {
+    offset_ -= count;
+    byte_count_ -= count;
+  }
+
+  bool Skip(int count) override {
+    while (count > 0 && index_ < slice_count_) {
+      const int64_t length = static_cast<int64_t>(GRPC_SLICE_LENGTH(slices_[index_]));
+      const int64_t skipped = std::min<int64_t>(count, length - offset_);
+      offset_ += skipped;
+      byte_count_ += skipped;
+      count -= static_cast<int>(skipped);
+      if (offset_ == length) {
+        ++index_;
+        offset_ = 0;
+      }
+    }
+    return count == 0;
+  }
+
+  int64_t ByteCount() const override { return byte_count_; }
+
+ private:
+  const grpc_slice* slices_;
+  size_t slice_count_;
+  size_t index_ = 0;
+  int64_t offset_ = 0;
+  int64_t byte_count_ = 0;
+};
+
+// Read a length-delimited field from a multi-slice message.  When the field
+// lies entirely within one refcounted slice it is referenced without a copy;
+// otherwise only the field's bytes are copied into a pooled buffer (unlike
+// grpc_byte_buffer_reader_readall, which would copy the entire message).
+bool ReadBytesAcrossSlices(const grpc_slice* slices, size_t slice_count,
+                           CodedInputStream* input, std::shared_ptr<Buffer>* out) {
+  uint32_t length;
+  if (!input->ReadVarint32(&length)) {
+    return false;
+  }
+  const int64_t position = input->CurrentPosition();
+  int64_t start = 0;
+  for (size_t i = 0; i < slice_count && start <= position; ++i) {
+    const int64_t slice_length = static_cast<int64_t>(GRPC_SLICE_LENGTH(slices[i]));
+    if (position + length <= start + slice_length) {
+      if (slices[i].refcount == nullptr) {
+        // Inlined slice: its bytes live in the slice struct itself and
+        // cannot be referenced, fall through to the copying path
+        break;
+      }
+      auto wrapped = std::make_shared<GrpcBuffer>(slices[i], /*incref=*/true);
+      *out = SliceBuffer(std::move(wrapped), position - start, length);
+      return input->Skip(static_cast<int>(length));
+    }
+    start += slice_length;
+  }
+  auto maybe_buffer = arrow::AllocateBuffer(static_cast<int64_t>(length));
+  if (!maybe_buffer.ok()) {
+    return false;
+  }
+  std::shared_ptr<Buffer> buffer = *std::move(maybe_buffer);
+  if (!input->ReadRaw(buffer->mutable_data(), static_cast<int>(length))) {
+    return false;
+  }
+  *out = std::move(buffer);
+  return true;
+}
+
 // Destructor callback for grpc::Slice
 static void ReleaseBuffer(void* buf_ptr) {
   delete reinterpret_cast<std::shared_ptr<Buffer>*>(buf_ptr);
@@ -326,30 +421,61 @@ static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
   out->metadata = nullptr;
   out->body = nullptr;
 
-  std::shared_ptr<arrow::Buffer> wrapped_buffer;
-  GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
+  // Multi-slice uncompressed messages are parsed in place across their
+  // slices; everything else goes through GrpcBuffer::Wrap, which coalesces
+  // the message into a single contiguous buffer when necessary.
+  auto grpc_buffer = *reinterpret_cast<grpc_byte_buffer**>(buffer);
+  const grpc_slice* slices = nullptr;
+  size_t slice_count = 0;
+  if ((grpc_buffer->type == GRPC_BB_RAW) &&
+      (grpc_buffer->data.raw.compression == GRPC_COMPRESS_NONE) &&
+      (grpc_buffer->data.raw.slice_buffer.count > 1)) {
+    slices = grpc_buffer->data.raw.slice_buffer.slices;
+    slice_count = grpc_buffer->data.raw.slice_buffer.count;
+  }
 
-  auto buffer_length = static_cast<int>(wrapped_buffer->size());
-  CodedInputStream pb_stream(wrapped_buffer->data(), buffer_length);
+  std::shared_ptr<arrow::Buffer> wrapped_buffer;
+  std::optional<SliceInputStream> slice_stream;
+  std::optional<CodedInputStream> pb_stream;
+  int buffer_length = 0;
+  if (slices != nullptr) {
+    int64_t total_length = 0;
+    for (size_t i = 0; i < slice_count; ++i) {
+      total_length += static_cast<int64_t>(GRPC_SLICE_LENGTH(slices[i]));
+    }
+    buffer_length = static_cast<int>(total_length);
+    slice_stream.emplace(slices, slice_count);
+    pb_stream.emplace(&*slice_stream);
+  } else {
+    GRPC_RETURN_NOT_OK(GrpcBuffer::Wrap(buffer, &wrapped_buffer));
+    buffer_length = static_cast<int>(wrapped_buffer->size());
+    pb_stream.emplace(wrapped_buffer->data(), buffer_length);
+  }
+  pb_stream->SetTotalBytesLimit(buffer_length);
 
-  pb_stream.SetTotalBytesLimit(buffer_length);
+  auto read_bytes = [&](std::shared_ptr<Buffer>* out_buffer) {
+    if (slices != nullptr) {
+      return ReadBytesAcrossSlices(slices, slice_count, &*pb_stream, out_buffer);
+    }
+    return ReadBytesZeroCopy(wrapped_buffer, &*pb_stream, out_buffer);
+  };
 
   // This is the bytes remaining when using CodedInputStream like this
-  while (pb_stream.BytesUntilTotalBytesLimit()) {
-    const uint32_t tag = pb_stream.ReadTag();
+  while (pb_stream->BytesUntilTotalBytesLimit()) {
+    const uint32_t tag = pb_stream->ReadTag();
     const int field_number = WireFormatLite::GetTagFieldNumber(tag);
     switch (field_number) {
       case pb::FlightData::kFlightDescriptorFieldNumber: {
         pb::FlightDescriptor pb_descriptor;
         uint32_t length;
-        if (!pb_stream.ReadVarint32(&length)) {
+        if (!pb_stream->ReadVarint32(&length)) {
           return {::grpc::StatusCode::INTERNAL,
                   "Unable to parse length of FlightDescriptor"};
         }
         // Can't use ParseFromCodedStream as this reads the entire
         // rest of the stream into the descriptor command field.
         std::string buffer;
-        pb_stream.ReadString(&buffer, length);
+        pb_stream->ReadString(&buffer, length);
         if (!pb_descriptor.ParseFromString(buffer)) {
           return {::grpc::StatusCode::INTERNAL, "Unable to parse FlightDescriptor"};
         }
@@ -359,24 +485,24 @@ static const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
         out->descriptor = std::make_unique<arrow::flight::FlightDescriptor>(descriptor);
       } break;
       case pb::FlightData::kDataHeaderFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->metadata)) {
+        if (!read_bytes(&out->metadata)) {
           return {::grpc::StatusCode::INTERNAL, "Unable to read FlightData metadata"};
         }
       } break;
       case pb::FlightData::kAppMetadataFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->app_metadata)) {
+        if (!read_bytes(&out->app_metadata)) {
           return {::grpc::StatusCode::INTERNAL,
                   "Unable to read FlightData application metadata"};
         }
       } break;
       case pb::FlightData::kDataBodyFieldNumber: {
-        if (!ReadBytesZeroCopy(wrapped_buffer, &pb_stream, &out->body)) {
+        if (!read_bytes(&out->body)) {
           return {::grpc::StatusCode::INTERNAL, "Unable to read FlightData body"};
         }
       } break;
       default: {
         // Unknown field. We should skip it for compatibility.
-        if (!WireFormatLite::SkipField(&pb_stream, tag)) {
+        if (!WireFormatLite::SkipField(&*pb_stream, tag)) {
           return {::grpc::StatusCode::INTERNAL,
                   "Could not skip unknown field tag in FlightData"};
         }
@@ -24,8 +24,10 @@
 #include "arrow/flight/server.h"
 #include "arrow/flight/types.h"
 #include "arrow/ipc/reader.h"
+#include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/status.h"
+#include "arrow/util/byte_size.h"
 
 namespace arrow {
 namespace flight {
@@ -78,9 +80,11 @@ class TransportIpcMessageReader : public ipc::MessageReader {
 class TransportMessageReader final : public FlightMessageReader {
  public:
   TransportMessageReader(ServerDataStream* stream,
-                         std::shared_ptr<MemoryManager> memory_manager)
+                         std::shared_ptr<MemoryManager> memory_manager,
+                         int64_t coalesce_bytes = 0)
       : peekable_reader_(new internal::PeekableFlightDataReader(stream)),
-        memory_manager_(std::move(memory_manager)) {}
+        memory_manager_(std::move(memory_manager)),
+        coalesce_bytes_(coalesce_bytes) {}
 
   Status Init() {
     // Peek the first message to get the descriptor.
@@ -133,10 +137,41 @@ class TransportMessageReader final : public FlightMessageReader {
     }
     RETURN_NOT_OK(batch_reader_->ReadNext(&out.data));
     out.app_metadata = std::move(app_metadata_);
+    if (out.data != nullptr && coalesce_bytes_ > 0) {
+      RETURN_NOT_OK(CoalesceBatches(&out));
+    }
     return out;
   }
 
  private:
+  /// Concatenate consecutive small batches before handing them to the
+  /// DoPut handler, so ingestion cost is paid per coalesced batch
+  /// rather than per tiny client write.
+  Status CoalesceBatches(FlightStreamChunk* out) {
+    int64_t total_bytes = arrow::util::TotalBufferSize(*out->data);
+    RecordBatchVector batches;
+    while (total_bytes < coalesce_bytes_) {
+      internal::FlightData* data = nullptr;
+      peekable_reader_->Peek(&data);
+      // Stop at end-of-stream, at metadata-only messages, and before
+      // any message carrying app_metadata so it stays attached to the
+      // right batch. Dictionary messages are consumed by ReadNext.
+      if (!data || !data->metadata || data->app_metadata) break;
+      std::shared_ptr<RecordBatch> next;
+      RETURN_NOT_OK(batch_reader_->ReadNext(&next));
+      if (!next) break;
+      if (batches.empty()) {
+        batches.push_back(out->data);
+      }
+      batches.push_back(std::move(next));
+      total_bytes += arrow::util::TotalBufferSize(*batches.back());
+    }
+    if (!batches.empty()) {
+      ARROW_ASSIGN_OR_RAISE(out->data, ConcatenateRecordBatches(batches));
+    }
+    return Status::OK();
+  }
+
   /// Ensure we are set up to read data.
   Status EnsureDataStarted() {
     if (!batch_reader_) {
@@ -158,6 +193,7 @@ class TransportMessageReader final : public FlightMessageReader {
   std::shared_ptr<MemoryManager> memory_manager_;
   std::shared_ptr<RecordBatchReader> batch_reader_;
   std::shared_ptr<Buffer> app_metadata_;
+  int64_t coalesce_bytes_;
 };
 
 // TODO(ARROW-10787): this should use the same writer/ipc trick as client
@@ -298,11 +334,26 @@ Status ServerTransport::DoGet(const ServerCallContext& context, const Ticket& ti
 
 Status ServerTransport::DoPut(const ServerCallContext& context,
                               ServerDataStream* stream) {
+  if (max_concurrent_puts_ > 0 &&
+      active_puts_.fetch_add(1, std::memory_order_acq_rel) >= max_concurrent_puts_) {
+    active_puts_.fetch_sub(1, std::memory_order_acq_rel);
+    return MakeFlightError(FlightStatusCode::Unavailable,
+                           "Concurrent DoPut limit reached, retry later");
+  }
+  auto decrement_puts = [this]() {
+    if (max_concurrent_puts_ > 0) {
+      active_puts_.fetch_sub(1, std::memory_order_acq_rel);
+    }
+  };
   std::unique_ptr<TransportMessageReader> reader(
-      new TransportMessageReader(stream, memory_manager_));
+      new TransportMessageReader(stream, memory_manager_, put_coalesce_bytes_));
   std::unique_ptr<FlightMetadataWriter> writer(new TransportMetadataWriter(stream));
-  RETURN_NOT_OK(reader->Init());
-  RETURN_NOT_OK(base_->DoPut(context, std::move(reader), std::move(writer)));
+  Status status = reader->Init();
+  if (status.ok()) {
+    status = base_->DoPut(context, std::move(reader), std::move(writer));
+  }
+  decrement_puts();
+  RETURN_NOT_OK(status);
   RETURN_NOT_OK(stream->WritesDone());
   return Status::OK();
 }
@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 
 #include "arrow/flight/transport.h"
@@ -123,9 +125,22 @@ class ARROW_FLIGHT_EXPORT ServerTransport {
   Status DoExchange(const ServerCallContext& context, ServerDataStream* stream);
   ///@}
 
+  /// \brief Configure DoPut admission control and batching.
+  ///
+  /// Called by FlightServerBase::Init before the transport starts
+  /// serving; see FlightServerOptions::max_concurrent_puts and
+  /// FlightServerOptions::put_coalesce_bytes.
+  void SetIngestControls(int max_concurrent_puts, int64_t put_coalesce_bytes) {
+    max_concurrent_puts_ = max_concurrent_puts;
+    put_coalesce_bytes_ = put_coalesce_bytes;
+  }
+
  protected:
   FlightServerBase* base_;
   std::shared_ptr<MemoryManager> memory_manager_;
+  int max_concurrent_puts_ = 0;
+  int64_t put_coalesce_bytes_ = 0;
+  std::atomic<int> active_puts_{0};
 };
 
 }  // namespace internal
@@ -18,17 +18,21 @@
 #include "arrow/io/buffered.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstring>
 #include <memory>
 #include <mutex>
 #include <string_view>
 #include <utility>
+#include <vector>
 
 #include "arrow/buffer.h"
 #include "arrow/io/util_internal.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace io {
@@ -97,10 +101,23 @@ class BufferedOutputStream::Impl : public BufferedBase {
   explicit Impl(std::shared_ptr<OutputStream> raw, MemoryPool* pool)
       : BufferedBase(pool), raw_(std::move(raw)) {}
 
+  Status EnableWriteBehind(::arrow::internal::Executor* executor, int num_buffers) {
+    std::lock_guard<std::mutex> guard(lock_);
+    flush_executor_ = executor;
+    num_buffers_ = num_buffers;
+    flush_state_ = std::make_shared<FlushState>();
+    // With flushes in flight the raw stream position cannot be consulted
+    // lazily, so cache it before any background activity.
+    ARROW_ASSIGN_OR_RAISE(raw_pos_, raw_->Tell());
+    DCHECK_GE(raw_pos_, 0);
+    return Status::OK();
+  }
+
   Status Close() {
     std::lock_guard<std::mutex> guard(lock_);
     if (is_open_) {
       Status st = FlushUnlocked();
+      st &= DrainUnlocked();
       is_open_ = false;
       RETURN_NOT_OK(raw_->Close());
       return st;
@@ -112,6 +129,8 @@ class BufferedOutputStream::Impl : public BufferedBase {
     std::lock_guard<std::mutex> guard(lock_);
     if (is_open_) {
       is_open_ = false;
+      // Let in-flight flushes finish before aborting the raw stream
+      ARROW_UNUSED(DrainUnlocked());
       return raw_->Abort();
     }
     return Status::OK();
@@ -123,7 +142,7 @@ class BufferedOutputStream::Impl : public BufferedBase {
       ARROW_ASSIGN_OR_RAISE(raw_pos_, raw_->Tell());
       DCHECK_GE(raw_pos_, 0);
     }
-    return raw_pos_ + buffer_pos_;
+    return raw_pos_ + bytes_submitted_ + buffer_pos_;
   }
 
   Status Write(const void* data, int64_t nbytes) { return DoWrite(data, nbytes); }
@@ -141,12 +160,24 @@ class BufferedOutputStream::Impl : public BufferedBase {
     if (nbytes == 0) {
       return Status::OK();
     }
+    if (flush_executor_ != nullptr && buffer_ == nullptr) {
+      // The previous buffer acquisition failed; retry (this reports the
+      // background flush error if the ring is poisoned)
+      RETURN_NOT_OK(AcquireBufferUnlocked());
+    }
     if (nbytes + buffer_pos_ >= buffer_size_) {
       RETURN_NOT_OK(FlushUnlocked());
       DCHECK_EQ(buffer_pos_, 0);
       if (nbytes >= buffer_size_) {
-        // Invalidate cached raw pos
-        raw_pos_ = -1;
+        if (flush_executor_ != nullptr) {
+          // Large writes bypass the ring; wait for queued flushes so the raw
+          // stream sees writes in order
+          RETURN_NOT_OK(DrainUnlocked());
+          bytes_submitted_ += nbytes;
+        } else {
+          // Invalidate cached raw pos
+          raw_pos_ = -1;
+        }
         // Direct write
         if (buffer) {
           return raw_->Write(buffer);
@@ -160,6 +191,9 @@ class BufferedOutputStream::Impl : public BufferedBase {
   }
 
   Status FlushUnlocked() {
+    if (flush_executor_ != nullptr) {
+      return SubmitBufferUnlocked();
+    }
     if (buffer_pos_ > 0) {
       // Invalidate cached raw pos
       raw_pos_ = -1;
@@ -171,12 +205,14 @@ class BufferedOutputStream::Impl : public BufferedBase {
 
   Status Flush() {
     std::lock_guard<std::mutex> guard(lock_);
-    return FlushUnlocked();
+    RETURN_NOT_OK(FlushUnlocked());
+    return DrainUnlocked();
   }
 
   Result<std::shared_ptr<OutputStream>> Detach() {
     std::lock_guard<std::mutex> guard(lock_);
     RETURN_NOT_OK(FlushUnlocked());
+    RETURN_NOT_OK(DrainUnlocked());
     is_open_ = false;
     return std::move(raw_);
   }
@@ -196,7 +232,100 @@ class BufferedOutputStream::Impl : public BufferedBase {
   std::shared_ptr<OutputStream> raw() const { return raw_; }
 
  private:
+  // State shared with the background flush tasks, which must not touch lock_
+  struct FlushState {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<std::shared_ptr<ResizableBuffer>> free_buffers;
+    Status status;  // first background flush error; sticky
+  };
+
+  // Hand the current buffer to the background flush chain and acquire a fresh
+  // one, blocking only if all buffers in the ring are in flight
+  Status SubmitBufferUnlocked() {
+    if (buffer_pos_ == 0) {
+      return Status::OK();
+    }
+    {
+      std::lock_guard<std::mutex> flush_guard(flush_state_->mutex);
+      RETURN_NOT_OK(flush_state_->status);
+    }
+    auto state = flush_state_;
+    auto raw = raw_;
+    auto full = std::move(buffer_);
+    const int64_t length = buffer_pos_;
+    bytes_submitted_ += length;
+    buffer_pos_ = 0;
+    buffer_data_ = nullptr;
+    auto write_task = [raw, full, length, state]() -> Status {
+      Status st = raw->Write(full->data(), length);
+      std::lock_guard<std::mutex> flush_guard(state->mutex);
+      if (!st.ok() && state->status.ok()) {
+        state->status = st;
+      }
+      state->free_buffers.push_back(full);
+      state->cv.notify_all();
+      return st;
+    };
+    last_flush_ = last_flush_.Then(
+        [executor = flush_executor_, write_task]() mutable -> Future<> {
+          return DeferNotOk(executor->Submit(std::move(write_task)));
+        },
+        [full, state](const Status& st) -> Future<> {
+          // An earlier flush failed and the chain is dead; just return the
+          // buffer to the ring so producers waiting on it wake up
+          std::lock_guard<std::mutex> flush_guard(state->mutex);
+          state->free_buffers.push_back(full);
+          state->cv.notify_all();
+          return Future<>::MakeFinished(st);
+        });
+    return AcquireBufferUnlocked();
+  }
+
+  Status AcquireBufferUnlocked() {
+    {
+      std::unique_lock<std::mutex> flush_guard(flush_state_->mutex);
+      if (!flush_state_->free_buffers.empty()) {
+        buffer_ = std::move(flush_state_->free_buffers.back());
+        flush_state_->free_buffers.pop_back();
+      } else if (allocated_buffers_ < num_buffers_) {
+        // Grow the ring lazily up to its configured depth
+        flush_guard.unlock();
+        ARROW_ASSIGN_OR_RAISE(buffer_, AllocateResizableBuffer(buffer_size_, pool_));
+        ++allocated_buffers_;
+      } else {
+        flush_state_->cv.wait(flush_guard, [this] {
+          return !flush_state_->free_buffers.empty() || !flush_state_->status.ok();
+        });
+        RETURN_NOT_OK(flush_state_->status);
+        buffer_ = std::move(flush_state_->free_buffers.back());
+        flush_state_->free_buffers.pop_back();
+      }
+    }
+    if (buffer_->size() != buffer_size_) {
+      RETURN_NOT_OK(buffer_->Resize(buffer_size_));
+    }
+    buffer_data_ = buffer_->mutable_data();
+    return Status::OK();
+  }
+
+  // Wait for all queued flushes to reach the raw stream
+  Status DrainUnlocked() {
+    if (flush_executor_ == nullptr) {
+      return Status::OK();
+    }
+    return last_flush_.status();
+  }
+
   std::shared_ptr<OutputStream> raw_;
+  // Write-behind state (see CreateWriteBehind); flush_executor_ is null for
+  // plain synchronous buffering
+  ::arrow::internal::Executor* flush_executor_ = nullptr;
+  int num_buffers_ = 1;
+  int allocated_buffers_ = 1;
+  int64_t bytes_submitted_ = 0;
+  Future<> last_flush_ = Future<>::MakeFinished(Status::OK());
+  std::shared_ptr<FlushState> flush_state_;
 };
 
 BufferedOutputStream::BufferedOutputStream(std::shared_ptr<OutputStream> raw,
@@ -212,6 +341,19 @@ Result<std::shared_ptr<BufferedOutputStream>> BufferedOutputStream::Create(
   return result;
 }
 
+Result<std::shared_ptr<BufferedOutputStream>> BufferedOutputStream::CreateWriteBehind(
+    int64_t buffer_size, int num_buffers, MemoryPool* pool,
+    std::shared_ptr<OutputStream> raw, const IOContext& io_context) {
+  if (num_buffers < 2) {
+    return Status::Invalid("Write-behind buffering requires at least 2 buffers");
+  }
+  auto result = std::shared_ptr<BufferedOutputStream>(
+      new BufferedOutputStream(std::move(raw), pool));
+  RETURN_NOT_OK(result->impl_->EnableWriteBehind(io_context.executor(), num_buffers));
+  RETURN_NOT_OK(result->SetBufferSize(buffer_size));
+  return result;
+}
+
 BufferedOutputStream::~BufferedOutputStream() { internal::CloseFromDestructor(this); }
 
 Status BufferedOutputStream::SetBufferSize(int64_t new_buffer_size) {
@@ -47,6 +47,26 @@ class ARROW_EXPORT BufferedOutputStream : public OutputStream {
   static Result<std::shared_ptr<BufferedOutputStream>> Create(
       int64_t buffer_size, MemoryPool* pool, std::shared_ptr<OutputStream> raw);
 
+  /// \brief Create a write-behind buffered output stream
+  ///
+  /// The stream writes into a ring of `num_buffers` pooled buffers; each
+  /// filled buffer is flushed to `raw`, in order, by a background task chain
+  /// on `io_context.executor()`.  Producers therefore only block when every
+  /// buffer is either being filled or in flight.  A failed background flush is
+  /// reported by a subsequent Write(), Flush() or Close().
+  ///
+  /// Unlike with Create(), the raw stream is written to from the background
+  /// executor and must support that.
+  /// \param[in] buffer_size the size of each write buffer
+  /// \param[in] num_buffers the number of buffers in the ring (at least 2)
+  /// \param[in] pool a MemoryPool to use for allocations
+  /// \param[in] raw another OutputStream
+  /// \param[in] io_context the IOContext whose executor flushes the buffers
+  /// \return the created BufferedOutputStream
+  static Result<std::shared_ptr<BufferedOutputStream>> CreateWriteBehind(
+      int64_t buffer_size, int num_buffers, MemoryPool* pool,
+      std::shared_ptr<OutputStream> raw, const IOContext& io_context);
+
   /// \brief Resize internal buffer
   /// \param[in] new_buffer_size the new buffer size
   /// \return Status
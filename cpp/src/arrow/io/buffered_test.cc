@@ -114,6 +114,18 @@ class TestBufferedOutputStream : public FileTestFixture<BufferedOutputStream> {
                                         buffer_size, default_memory_pool(), file));
   }
 
+  void OpenWriteBehind(int64_t buffer_size = kDefaultBufferSize, int num_buffers = 4) {
+    // So that any open file is closed
+    buffered_.reset();
+
+    ASSERT_OK_AND_ASSIGN(auto file, FileOutputStream::Open(path_, /*append=*/false));
+    fd_ = file->file_descriptor();
+    ASSERT_OK_AND_ASSIGN(
+        buffered_, BufferedOutputStream::CreateWriteBehind(
+                       buffer_size, num_buffers, default_memory_pool(), file,
+                       default_io_context()));
+  }
+
   void WriteChunkwise(const std::string& datastr, const std::valarray<int64_t>& sizes) {
     const char* data = datastr.data();
     const int64_t data_size = static_cast<int64_t>(datastr.size());
@@ -304,6 +316,80 @@ TEST_F(TestBufferedOutputStream, Tell) {
   AssertTell(0);
 }
 
+TEST_F(TestBufferedOutputStream, WriteBehindMixedWrites) {
+  OpenWriteBehind(/*buffer_size=*/4096, /*num_buffers=*/4);
+
+  // Mix of buffered writes, buffer-filling writes and large direct writes
+  const std::string data = GenerateRandomData(300000);
+  const std::valarray<int64_t> sizes = {1, 1, 2, 3, 70000};
+
+  WriteChunkwise(data, sizes);
+  ASSERT_OK(buffered_->Close());
+
+  AssertFileContents(path_, data);
+}
+
+TEST_F(TestBufferedOutputStream, WriteBehindTinyWrites) {
+  // A two-deep ring with a tiny buffer forces producers to wait for
+  // in-flight flushes
+  OpenWriteBehind(/*buffer_size=*/8, /*num_buffers=*/2);
+
+  const std::string data = GenerateRandomData(10000);
+  const std::valarray<int64_t> sizes = {1, 1, 2, 3, 5};
+
+  WriteChunkwise(data, sizes);
+  ASSERT_OK(buffered_->Close());
+
+  AssertFileContents(path_, data);
+}
+
+TEST_F(TestBufferedOutputStream, WriteBehindFlush) {
+  OpenWriteBehind();
+
+  const std::string datastr = "1234568790";
+  ASSERT_OK(buffered_->Write(datastr.data(), datastr.size()));
+  // Flush waits for the background chain, so the bytes must have hit the file
+  ASSERT_OK(buffered_->Flush());
+  AssertFileContents(path_, datastr);
+
+  ASSERT_OK(buffered_->Close());
+}
+
+TEST_F(TestBufferedOutputStream, WriteBehindTell) {
+  OpenWriteBehind(/*buffer_size=*/10, /*num_buffers=*/2);
+
+  AssertTell(0);
+  WriteChunkwise(std::string(100, 'x'), {1, 1, 2, 3, 5, 8});
+  AssertTell(100);
+  // Large direct write
+  WriteChunkwise(std::string(100000, 'x'), {60000});
+  AssertTell(100100);
+
+  ASSERT_OK(buffered_->Close());
+}
+
+TEST_F(TestBufferedOutputStream, WriteBehindDetach) {
+  OpenWriteBehind();
+
+  const std::string datastr = "1234568790";
+  ASSERT_OK(buffered_->Write(datastr.data(), datastr.size()));
+  ASSERT_OK_AND_ASSIGN(auto detached_stream, buffered_->Detach());
+
+  // Detach flushed and drained the ring but did not close the raw stream
+  ASSERT_TRUE(buffered_->closed());
+  ASSERT_FALSE(detached_stream->closed());
+  AssertFileContents(path_, datastr);
+
+  ASSERT_OK(detached_stream->Close());
+}
+
+TEST_F(TestBufferedOutputStream, WriteBehindInvalidNumBuffers) {
+  ASSERT_OK_AND_ASSIGN(auto file, FileOutputStream::Open(path_, /*append=*/false));
+  ASSERT_RAISES(Invalid, BufferedOutputStream::CreateWriteBehind(
+                             kDefaultBufferSize, /*num_buffers=*/1,
+                             default_memory_pool(), file, default_io_context()));
+}
+
 TEST_F(TestBufferedOutputStream, TruncatesFile) {
   OpenBuffered();
 
@@ -17,8 +17,11 @@
 
 #include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cmath>
 #include <mutex>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -130,6 +133,86 @@ CacheOptions CacheOptions::MakeFromNetworkMetrics(int64_t time_to_first_byte_mil
   return {hole_size_limit, range_size_limit, /*lazy=*/false, /*prefetch_limit=*/0};
 }
 
+void ReadProfile::RecordRead(int64_t nbytes, double duration_sec) {
+  if (nbytes <= 0 || duration_sec <= 0) {
+    return;
+  }
+  const auto x = static_cast<double>(nbytes);
+  const double y = duration_sec;
+  std::lock_guard<std::mutex> lock(mutex_);
+  // Halve the running sums periodically so old measurements are gradually
+  // forgotten and the fit tracks changing conditions.
+  constexpr double kDecayThreshold = 4096;
+  if (num_samples_ >= kDecayThreshold) {
+    num_samples_ *= 0.5;
+    sum_x_ *= 0.5;
+    sum_y_ *= 0.5;
+    sum_xx_ *= 0.5;
+    sum_xy_ *= 0.5;
+  }
+  num_samples_ += 1;
+  sum_x_ += x;
+  sum_y_ += y;
+  sum_xx_ += x * x;
+  sum_xy_ += x * y;
+}
+
+CacheOptions ReadProfile::Adapt(CacheOptions base) const {
+  double num_samples, sum_x, sum_y, sum_xx, sum_xy;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    num_samples = num_samples_;
+    sum_x = sum_x_;
+    sum_y = sum_y_;
+    sum_xx = sum_xx_;
+    sum_xy = sum_xy_;
+  }
+  if (num_samples < kMinSamples) {
+    return base;
+  }
+  // Least-squares fit of duration = TTFB + nbytes / BW
+  const double denom = num_samples * sum_xx - sum_x * sum_x;
+  if (denom <= 0) {
+    // All observed reads were the same size; latency and bandwidth cannot be
+    // told apart.
+    return base;
+  }
+  const double slope = (num_samples * sum_xy - sum_x * sum_y) / denom;
+  const double intercept = (sum_y - slope * sum_x) / num_samples;
+  if (slope <= 0 || intercept <= 0) {
+    // Noise dominates; don't extrapolate from a nonsensical fit.
+    return base;
+  }
+  const double transfer_bandwidth_bytes_per_sec = 1.0 / slope;
+  const double time_to_first_byte_sec = intercept;
+
+  // Same model as MakeFromNetworkMetrics: the hole size limit is the
+  // bandwidth-delay product, the range size limit targets the default
+  // bandwidth utilization fraction.
+  const auto hole_size_limit = std::max<int64_t>(
+      1, static_cast<int64_t>(
+             std::round(time_to_first_byte_sec * transfer_bandwidth_bytes_per_sec)));
+  constexpr double frac = CacheOptions::kDefaultIdealBandwidthUtilizationFrac;
+  const int64_t range_size_limit =
+      std::min(CacheOptions::kDefaultMaxIdealRequestSizeMib * 1024 * 1024,
+               static_cast<int64_t>(std::round(hole_size_limit * frac / (1 - frac))));
+  base.hole_size_limit = hole_size_limit;
+  base.range_size_limit = std::max(range_size_limit, hole_size_limit);
+  return base;
+}
+
+std::shared_ptr<ReadProfile> ReadProfile::ForKey(const std::string& key) {
+  static std::mutex registry_mutex;
+  static auto* registry =
+      new std::unordered_map<std::string, std::shared_ptr<ReadProfile>>();
+  std::lock_guard<std::mutex> lock(registry_mutex);
+  auto& profile = (*registry)[key];
+  if (profile == nullptr) {
+    profile = std::make_shared<ReadProfile>();
+  }
+  return profile;
+}
+
 namespace internal {
 
 struct RangeCacheEntry {
@@ -156,6 +239,25 @@ struct ReadRangeCache::Impl {
 
   virtual ~Impl() = default;
 
+  // Issue a read for the given range, reporting its size and duration to the
+  // read profile, if any
+  Future<std::shared_ptr<Buffer>> DoReadAsync(const ReadRange& range) {
+    if (!options.read_profile) {
+      return file->ReadAsync(ctx, range.offset, range.length);
+    }
+    const auto start = std::chrono::steady_clock::now();
+    auto fut = file->ReadAsync(ctx, range.offset, range.length);
+    fut.AddCallback([profile = options.read_profile, start, length = range.length](
+                        const Result<std::shared_ptr<Buffer>>& result) {
+      if (result.ok()) {
+        const std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+        profile->RecordRead(length, elapsed.count());
+      }
+    });
+    return fut;
+  }
+
   // Get the future corresponding to a range
   virtual Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) {
     return entry->future;
@@ -167,16 +269,20 @@ struct ReadRangeCache::Impl {
     std::vector<RangeCacheEntry> new_entries;
     new_entries.reserve(ranges.size());
     for (const auto& range : ranges) {
-      new_entries.emplace_back(range, file->ReadAsync(ctx, range.offset, range.length));
+      new_entries.emplace_back(range, DoReadAsync(range));
     }
     return new_entries;
   }
 
   // Add the given ranges to the cache, coalescing them where possible
   virtual Status Cache(std::vector<ReadRange> ranges) {
+    CacheOptions effective = options;
+    if (options.read_profile) {
+      effective = options.read_profile->Adapt(effective);
+    }
     ARROW_ASSIGN_OR_RAISE(
-        ranges, internal::CoalesceReadRanges(std::move(ranges), options.hole_size_limit,
-                                             options.range_size_limit));
+        ranges, internal::CoalesceReadRanges(std::move(ranges), effective.hole_size_limit,
+                                             effective.range_size_limit));
     std::vector<RangeCacheEntry> new_entries = MakeCacheEntries(ranges);
     // Add new entries, themselves ordered by offset
     if (entries.size() > 0) {
@@ -218,8 +324,7 @@ struct ReadRangeCache::Impl {
              next_it != entries.end() && num_prefetched < options.prefetch_limit;
              ++next_it) {
           if (!next_it->future.is_valid()) {
-            next_it->future =
-                file->ReadAsync(ctx, next_it->range.offset, next_it->range.length);
+            next_it->future = DoReadAsync(next_it->range);
           }
           ++num_prefetched;
         }
@@ -272,7 +377,7 @@ struct ReadRangeCache::LazyImpl : public ReadRangeCache::Impl {
   Future<std::shared_ptr<Buffer>> MaybeRead(RangeCacheEntry* entry) override {
     // Called by superclass Read()/WaitFor() so we have the lock
     if (!entry->future.is_valid()) {
-      entry->future = file->ReadAsync(ctx, entry->range.offset, entry->range.length);
+      entry->future = DoReadAsync(entry->range);
     }
     return entry->future;
   }
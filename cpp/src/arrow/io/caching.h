@@ -19,6 +19,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -30,6 +31,8 @@
 namespace arrow {
 namespace io {
 
+class ReadProfile;
+
 struct ARROW_EXPORT CacheOptions {
   static constexpr double kDefaultIdealBandwidthUtilizationFrac = 0.9;
   static constexpr int64_t kDefaultMaxIdealRequestSizeMib = 64;
@@ -51,11 +54,17 @@ struct ARROW_EXPORT CacheOptions {
   /// \brief The maximum number of ranges to be prefetched. This is only used
   ///   for lazy cache to asynchronously read some ranges after reading the target range.
   int64_t prefetch_limit = 0;
+  /// \brief If set, coalescing limits adapt at runtime to the latency and
+  ///   bandwidth observed through this profile (see ReadProfile);
+  ///   hole_size_limit and range_size_limit then only serve as defaults until
+  ///   enough reads have been measured.  Reads issued by a ReadRangeCache
+  ///   with this option feed the profile.
+  std::shared_ptr<ReadProfile> read_profile;
 
   bool operator==(const CacheOptions& other) const {
     return hole_size_limit == other.hole_size_limit &&
            range_size_limit == other.range_size_limit && lazy == other.lazy &&
-           prefetch_limit == other.prefetch_limit;
+           prefetch_limit == other.prefetch_limit && read_profile == other.read_profile;
   }
 
   /// \brief Construct CacheOptions from network storage metrics (e.g. S3).
@@ -82,6 +91,51 @@ struct ARROW_EXPORT CacheOptions {
   static CacheOptions LazyDefaults();
 };
 
+/// \brief Measured latency/bandwidth profile of a storage backend.
+///
+/// Accumulates the durations of completed reads and fits them against read
+/// size: the intercept of the fit estimates time-to-first-byte, the slope the
+/// inverse transfer bandwidth.  From these, Adapt() derives coalescing limits
+/// with the same model as CacheOptions::MakeFromNetworkMetrics, so tiny gaps
+/// are merged on high-latency stores (e.g. S3) but not on local NVMe, without
+/// tuning static limits fleet-wide.
+///
+/// A profile is typically shared per storage backend - see ForKey() - so that
+/// what one scan learns benefits the next.  All methods are thread-safe.
+class ARROW_EXPORT ReadProfile {
+ public:
+  /// Number of reads that must be observed before Adapt() deviates from the
+  /// caller-provided limits
+  static constexpr int64_t kMinSamples = 32;
+
+  /// \brief Record a completed read of nbytes that took duration_sec seconds.
+  void RecordRead(int64_t nbytes, double duration_sec);
+
+  /// \brief Derive coalescing limits from the measured metrics.
+  ///
+  /// Returns base with hole_size_limit and range_size_limit replaced by
+  /// limits computed from the estimated time-to-first-byte and bandwidth.
+  /// Returns base unchanged while fewer than kMinSamples reads have been
+  /// recorded or the measurements do not yield a usable fit.
+  CacheOptions Adapt(CacheOptions base) const;
+
+  /// \brief Return the shared profile for the given key, creating it on first use.
+  ///
+  /// Keys identify a storage backend; FileSystem::type_name() is a good
+  /// choice.  Profiles persist for the lifetime of the process.
+  static std::shared_ptr<ReadProfile> ForKey(const std::string& key);
+
+ private:
+  // Running sums for a least-squares fit of duration against read size.
+  // Halved periodically so the profile tracks changing conditions.
+  mutable std::mutex mutex_;
+  double num_samples_ = 0;
+  double sum_x_ = 0;
+  double sum_y_ = 0;
+  double sum_xx_ = 0;
+  double sum_xy_ = 0;
+};
+
 namespace internal {
 
 /// \brief A read cache designed to hide IO latencies when reading.
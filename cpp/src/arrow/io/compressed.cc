@@ -385,6 +385,51 @@ class CompressedInputStream::Impl {
     return true;
   }
 
+  // Decompress directly into the caller's buffer, bypassing the
+  // decompressed_ staging buffer.  Mirrors RefillDecompressed: returns
+  // whether there may be more data to read, and leaves data in
+  // decompressed_ only when the codec cannot make progress within the
+  // caller's remaining buffer.
+  Result<bool> DecompressInto(uint8_t* out, int64_t out_len, int64_t* bytes_written) {
+    if (compressed_ && compressed_->size() != 0) {
+      if (decompressor_->IsFinished()) {
+        // We just went over the end of a previous compressed stream.
+        RETURN_NOT_OK(decompressor_->Reset());
+        fresh_decompressor_ = true;
+      }
+      const int64_t input_len = compressed_->size() - compressed_pos_;
+      const uint8_t* input = compressed_->data() + compressed_pos_;
+      ARROW_ASSIGN_OR_RAISE(auto result,
+                            decompressor_->Decompress(input_len, input, out_len, out));
+      compressed_pos_ += result.bytes_read;
+      if (result.bytes_read > 0) {
+        fresh_decompressor_ = false;
+      }
+      *bytes_written += result.bytes_written;
+      if (result.bytes_written > 0 || result.bytes_read > 0) {
+        return true;
+      }
+      if (result.need_more_output && input_len > 0) {
+        // The caller's remaining buffer is too small for the decompressor to
+        // make progress; decompress into the growable internal buffer and
+        // serve from there.
+        RETURN_NOT_OK(DecompressData());
+        return true;
+      }
+      // No progress on the current compressed buffer: fall through and
+      // read more compressed data.
+    }
+    RETURN_NOT_OK(EnsureCompressedData());
+    if (compressed_buffer_available() == 0) {
+      // No more data to decompress
+      if (!fresh_decompressor_ && !decompressor_->IsFinished()) {
+        return Status::IOError("Truncated compressed stream");
+      }
+      return false;
+    }
+    return true;
+  }
+
   Result<int64_t> Read(int64_t nbytes, void* out) {
     auto* out_data = reinterpret_cast<uint8_t*>(out);
 
@@ -399,8 +444,17 @@ class CompressedInputStream::Impl {
       }
 
       // At this point, no more decompressed data remains, so we need to
-      // decompress more
-      ARROW_ASSIGN_OR_RAISE(decompressor_has_data, RefillDecompressed());
+      // decompress more.  Large remaining reads go directly into the
+      // caller's buffer, skipping the staging copy; for small ones the
+      // per-call codec overhead outweighs the saved copy, so they are
+      // served from the internal buffer.
+      if (nbytes - total_read >= kMinDirectDecompressSize) {
+        ARROW_ASSIGN_OR_RAISE(
+            decompressor_has_data,
+            DecompressInto(out_data + total_read, nbytes - total_read, &total_read));
+      } else {
+        ARROW_ASSIGN_OR_RAISE(decompressor_has_data, RefillDecompressed());
+      }
     }
 
     total_pos_ += total_read;
@@ -431,6 +485,8 @@ class CompressedInputStream::Impl {
   static const int64_t kChunkSize = 64 * 1024;
   // Decompress 1 MB at a time
   static const int64_t kDecompressSize = 1024 * 1024;
+  // Decompress directly into the caller's buffer from this read size on
+  static const int64_t kMinDirectDecompressSize = 64 * 1024;
 
   MemoryPool* pool_;
   std::shared_ptr<InputStream> raw_;
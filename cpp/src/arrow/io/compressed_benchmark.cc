@@ -170,7 +170,7 @@ static void CompressedInputStreamNonZeroCopyBufferReturnedByCallee(
                                  BufferReadMode::ReturnedByCallee>(state, kCompression);
 }
 
-#ifdef ARROW_WITH_LZ4
+#if defined(ARROW_WITH_LZ4) || defined(ARROW_WITH_ZSTD)
 static void CompressedInputArguments(::benchmark::internal::Benchmark* b) {
   b->ArgNames({"num_bytes", "batch_size"})
       ->Args({8 * 1024, 8 * 1024})
@@ -180,7 +180,9 @@ static void CompressedInputArguments(::benchmark::internal::Benchmark* b) {
       ->Args({1024 * 1024, 64 * 1024})
       ->Args({1024 * 1024, 1024 * 1024});
 }
+#endif
 
+#ifdef ARROW_WITH_LZ4
 // Benchmark LZ4 because it's lightweight, which makes benchmarking focused on the
 // overhead of the compression input stream.
 BENCHMARK_TEMPLATE(CompressedInputStreamZeroCopyBufferProvidedByCaller,
@@ -197,4 +199,21 @@ BENCHMARK_TEMPLATE(CompressedInputStreamNonZeroCopyBufferReturnedByCallee,
     ->Apply(CompressedInputArguments);
 #endif
 
+#ifdef ARROW_WITH_ZSTD
+// Also benchmark ZSTD, whose higher decompression cost shows how much of the
+// stream overhead is the staging copies rather than the codec itself.
+BENCHMARK_TEMPLATE(CompressedInputStreamZeroCopyBufferProvidedByCaller,
+                   Compression::ZSTD)
+    ->Apply(CompressedInputArguments);
+BENCHMARK_TEMPLATE(CompressedInputStreamNonZeroCopyBufferProvidedByCaller,
+                   Compression::ZSTD)
+    ->Apply(CompressedInputArguments);
+BENCHMARK_TEMPLATE(CompressedInputStreamZeroCopyBufferReturnedByCallee,
+                   Compression::ZSTD)
+    ->Apply(CompressedInputArguments);
+BENCHMARK_TEMPLATE(CompressedInputStreamNonZeroCopyBufferReturnedByCallee,
+                   Compression::ZSTD)
+    ->Apply(CompressedInputArguments);
+#endif
+
 }  // namespace arrow::io
@@ -182,6 +182,44 @@ TEST_P(CompressedInputStreamTest, RandomData) {
   CheckCompressedInputStream(codec.get(), data);
 }
 
+TEST_P(CompressedInputStreamTest, LargeSingleReads) {
+  // Reads of 64 KiB and more decompress directly into the caller's buffer,
+  // bypassing the internal staging buffer.
+  auto codec = MakeCodec();
+  auto data = MakeCompressibleData(COMPRESSIBLE_DATA_SIZE);
+  auto compressed = CompressDataOneShot(codec.get(), data);
+
+  {
+    // One oversized read returning the whole stream
+    auto buffer_reader = std::make_shared<BufferReader>(compressed);
+    ASSERT_OK_AND_ASSIGN(auto stream,
+                         CompressedInputStream::Make(codec.get(), buffer_reader));
+    ASSERT_OK_AND_ASSIGN(auto buf, stream->Read(static_cast<int64_t>(data.size()) + 1));
+    ASSERT_EQ(buf->size(), static_cast<int64_t>(data.size()));
+    ASSERT_EQ(memcmp(buf->data(), data.data(), data.size()), 0);
+    // EOF
+    ASSERT_OK_AND_ASSIGN(buf, stream->Read(1024));
+    ASSERT_EQ(buf->size(), 0);
+  }
+  {
+    // A small buffered read followed by large direct reads; the leftover
+    // buffered data must be served before direct decompression resumes.
+    auto buffer_reader = std::make_shared<BufferReader>(compressed);
+    ASSERT_OK_AND_ASSIGN(auto stream,
+                         CompressedInputStream::Make(codec.get(), buffer_reader));
+    std::vector<uint8_t> out(data.size());
+    ASSERT_OK_AND_ASSIGN(int64_t pos, stream->Read(1000, out.data()));
+    ASSERT_EQ(pos, 1000);
+    while (pos < static_cast<int64_t>(out.size())) {
+      ASSERT_OK_AND_ASSIGN(const int64_t nread,
+                           stream->Read(out.size() - pos, out.data() + pos));
+      ASSERT_GT(nread, 0);
+      pos += nread;
+    }
+    ASSERT_EQ(out, data);
+  }
+}
+
 TEST_P(CompressedInputStreamTest, TruncatedData) {
   auto codec = MakeCodec();
   auto data = MakeRandomData(10000);
@@ -27,10 +27,20 @@
 #  undef Free
 #else
 #  include <fcntl.h>
+#  include <limits.h>  // IWYU pragma: keep
 #  include <sys/mman.h>
+#  include <sys/uio.h>
 #  include <unistd.h>  // IWYU pragma: keep
 #endif
 
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#  define ARROW_HAVE_IO_URING
+#  include <linux/io_uring.h>
+#  include <sys/syscall.h>
+
+#  include <thread>
+#endif
+
 #include <algorithm>
 #include <atomic>
 #include <cerrno>
@@ -53,6 +63,7 @@
 #include "arrow/buffer.h"
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/future.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging_internal.h"
@@ -64,16 +75,30 @@ using internal::IOErrorFromErrno;
 
 namespace io {
 
+namespace {
+
+// Conservative direct I/O alignment for offsets, lengths and buffer
+// addresses: a multiple of the logical block size of common devices and
+// filesystems.
+constexpr int64_t kDirectIOAlignment = 4096;
+
+// Staging buffer size for direct-mode output streams
+constexpr int64_t kDirectIOStagingSize = 512 * 1024;
+
+}  // namespace
+
 class OSFile {
  public:
   // Note: only one of the Open* methods below may be called on a given instance
 
   Status OpenWritable(const std::string& path, bool truncate, bool append,
-                      bool write_only) {
+                      bool write_only, bool direct = false) {
     RETURN_NOT_OK(SetFileName(path));
 
-    ARROW_ASSIGN_OR_RAISE(fd_, ::arrow::internal::FileOpenWritable(file_name_, write_only,
-                                                                   truncate, append));
+    ARROW_ASSIGN_OR_RAISE(
+        fd_, ::arrow::internal::FileOpenWritable(file_name_, write_only, truncate, append,
+                                                 direct));
+    direct_io_ = direct;
     mode_ = write_only ? FileMode::WRITE : FileMode::READWRITE;
 
     if (!truncate) {
@@ -100,10 +125,12 @@ class OSFile {
     return Status::OK();
   }
 
-  Status OpenReadable(const std::string& path) {
+  Status OpenReadable(const std::string& path, bool direct = false) {
     RETURN_NOT_OK(SetFileName(path));
 
-    ARROW_ASSIGN_OR_RAISE(fd_, ::arrow::internal::FileOpenReadable(file_name_));
+    ARROW_ASSIGN_OR_RAISE(fd_,
+                          ::arrow::internal::FileOpenReadable(file_name_, direct));
+    direct_io_ = direct;
     ARROW_ASSIGN_OR_RAISE(size_, ::arrow::internal::FileGetSize(fd_.fd()));
 
     mode_ = FileMode::READ;
@@ -172,10 +199,64 @@ class OSFile {
                                         length);
   }
 
+  Status WriteV(const std::vector<std::shared_ptr<Buffer>>& data) {
+    RETURN_NOT_OK(CheckClosed());
+
+    std::lock_guard<std::mutex> guard(lock_);
+    RETURN_NOT_OK(CheckPositioned());
+#ifdef _WIN32
+    // No vectored write API is hooked up on Windows; write sequentially
+    for (const auto& buffer : data) {
+      if (buffer == nullptr || buffer->size() == 0) {
+        continue;
+      }
+      RETURN_NOT_OK(
+          ::arrow::internal::FileWrite(fd_.fd(), buffer->data(), buffer->size()));
+    }
+    return Status::OK();
+#else
+    std::vector<struct iovec> iov;
+    iov.reserve(data.size());
+    for (const auto& buffer : data) {
+      if (buffer == nullptr || buffer->size() == 0) {
+        continue;
+      }
+      iov.push_back({const_cast<uint8_t*>(buffer->data()),
+                     static_cast<size_t>(buffer->size())});
+    }
+    size_t pos = 0;
+    while (pos < iov.size()) {
+      const int iov_count = static_cast<int>(
+          std::min<size_t>(iov.size() - pos, static_cast<size_t>(IOV_MAX)));
+      const ssize_t written = ::writev(fd_.fd(), iov.data() + pos, iov_count);
+      if (written == -1) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return ::arrow::internal::IOErrorFromErrno(errno,
+                                                   "Error writing bytes to file");
+      }
+      // Skip fully written regions and trim a partially written one
+      int64_t remaining = written;
+      while (pos < iov.size() && remaining >= static_cast<int64_t>(iov[pos].iov_len)) {
+        remaining -= static_cast<int64_t>(iov[pos].iov_len);
+        ++pos;
+      }
+      if (remaining > 0) {
+        iov[pos].iov_base = static_cast<uint8_t*>(iov[pos].iov_base) + remaining;
+        iov[pos].iov_len -= static_cast<size_t>(remaining);
+      }
+    }
+    return Status::OK();
+#endif
+  }
+
   int fd() const { return fd_.fd(); }
 
   bool is_open() const { return !fd_.closed(); }
 
+  bool direct_io() const { return direct_io_; }
+
   int64_t size() const { return size_; }
 
   FileMode::type mode() const { return mode_; }
@@ -208,10 +289,202 @@ class OSFile {
   FileDescriptor fd_;
   FileMode::type mode_;
   int64_t size_{-1};
+  // Whether the file bypasses the OS page cache
+  bool direct_io_{false};
   // Whether ReadAt made the file position non-deterministic.
   std::atomic<bool> need_seeking_{false};
 };
 
+#ifdef ARROW_HAVE_IO_URING
+
+namespace {
+
+// A process-wide io_uring instance servicing ReadableFile::ReadAsync.
+//
+// Reads are submitted as SQEs and completed from a single reaper thread, so
+// thousands of outstanding reads occupy one thread and one ring rather than
+// one IO executor thread each.  The instance is created on first use and
+// leaked; the reaper thread never exits.
+class IoUringContext {
+ public:
+  // Matches the queue depth of typical NVMe submission queues
+  static constexpr uint32_t kQueueDepth = 256;
+
+  // Returns nullptr if the kernel lacks io_uring support (or forbids it)
+  static IoUringContext* GetInstance() {
+    static IoUringContext* instance = []() -> IoUringContext* {
+      auto* ctx = new IoUringContext();
+      if (!ctx->Init()) {
+        delete ctx;
+        return nullptr;
+      }
+      return ctx;
+    }();
+    return instance;
+  }
+
+  // Submit a read of [offset, offset + buffer->size()) into buffer, keeping
+  // file alive until completion.  Returns false if the ring is full or the
+  // submission is rejected, in which case the future is left untouched.
+  bool TrySubmitRead(std::shared_ptr<FileInterface> file, int fd,
+                     std::shared_ptr<ResizableBuffer> buffer, int64_t offset,
+                     Future<std::shared_ptr<Buffer>> future) {
+    auto op = std::make_unique<PendingRead>();
+    op->file = std::move(file);
+    op->fd = fd;
+    op->buffer = std::move(buffer);
+    op->offset = offset;
+    op->future = std::move(future);
+
+    std::lock_guard<std::mutex> guard(sq_mutex_);
+    if (in_flight_.load(std::memory_order_relaxed) >= kQueueDepth) {
+      return false;
+    }
+    const uint32_t tail = sq_tail_->load(std::memory_order_relaxed);
+    const uint32_t index = tail & sq_mask_;
+    io_uring_sqe* sqe = &sqes_[index];
+    std::memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = IORING_OP_READ;
+    sqe->fd = op->fd;
+    sqe->addr = reinterpret_cast<uintptr_t>(op->buffer->mutable_data());
+    sqe->len = static_cast<uint32_t>(op->buffer->size());
+    sqe->off = static_cast<uint64_t>(op->offset);
+    sqe->user_data = reinterpret_cast<uintptr_t>(op.get());
+    sq_array_[index] = index;
+    sq_tail_->store(tail + 1, std::memory_order_release);
+    if (syscall(__NR_io_uring_enter, ring_fd_, 1, 0, 0, nullptr, 0) < 0) {
+      // Nothing was consumed; withdraw the SQE and let the caller fall back
+      sq_tail_->store(tail, std::memory_order_release);
+      return false;
+    }
+    in_flight_.fetch_add(1, std::memory_order_relaxed);
+    op.release();  // ownership passes to the completion queue entry
+    return true;
+  }
+
+ private:
+  struct PendingRead {
+    std::shared_ptr<FileInterface> file;
+    int fd;
+    std::shared_ptr<ResizableBuffer> buffer;
+    int64_t offset;
+    Future<std::shared_ptr<Buffer>> future;
+  };
+
+  IoUringContext() = default;
+
+  bool Init() {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    ring_fd_ = static_cast<int>(syscall(__NR_io_uring_setup, kQueueDepth, &params));
+    if (ring_fd_ < 0) {
+      return false;
+    }
+    size_t sq_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+    size_t cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    if (params.features & IORING_FEAT_SINGLE_MMAP) {
+      sq_size = cq_size = std::max(sq_size, cq_size);
+    }
+    void* sq_ring = mmap(nullptr, sq_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+    if (sq_ring == MAP_FAILED) {
+      return false;
+    }
+    void* cq_ring = sq_ring;
+    if (!(params.features & IORING_FEAT_SINGLE_MMAP)) {
+      cq_ring = mmap(nullptr, cq_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+      if (cq_ring == MAP_FAILED) {
+        return false;
+      }
+    }
+    void* sqes = mmap(nullptr, params.sq_entries * sizeof(io_uring_sqe),
+                      PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring_fd_,
+                      IORING_OFF_SQES);
+    if (sqes == MAP_FAILED) {
+      return false;
+    }
+
+    auto* sq_base = static_cast<uint8_t*>(sq_ring);
+    sq_tail_ = reinterpret_cast<std::atomic<uint32_t>*>(sq_base + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<uint32_t*>(sq_base + params.sq_off.ring_mask);
+    sq_array_ = reinterpret_cast<uint32_t*>(sq_base + params.sq_off.array);
+    sqes_ = static_cast<io_uring_sqe*>(sqes);
+
+    auto* cq_base = static_cast<uint8_t*>(cq_ring);
+    cq_head_ = reinterpret_cast<std::atomic<uint32_t>*>(cq_base + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<std::atomic<uint32_t>*>(cq_base + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<uint32_t*>(cq_base + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe*>(cq_base + params.cq_off.cqes);
+
+    std::thread([this] { ReapCompletions(); }).detach();
+    return true;
+  }
+
+  void ReapCompletions() {
+    for (;;) {
+      const uint32_t head = cq_head_->load(std::memory_order_relaxed);
+      if (head == cq_tail_->load(std::memory_order_acquire)) {
+        syscall(__NR_io_uring_enter, ring_fd_, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+        continue;
+      }
+      const io_uring_cqe& cqe = cqes_[head & cq_mask_];
+      std::unique_ptr<PendingRead> op(
+          reinterpret_cast<PendingRead*>(static_cast<uintptr_t>(cqe.user_data)));
+      const int32_t res = cqe.res;
+      cq_head_->store(head + 1, std::memory_order_release);
+      in_flight_.fetch_sub(1, std::memory_order_relaxed);
+      CompleteRead(std::move(op), res);
+    }
+  }
+
+  void CompleteRead(std::unique_ptr<PendingRead> op, int32_t res) {
+    if (res < 0 && res != -EINTR && res != -EAGAIN) {
+      op->future.MarkFinished(IOErrorFromErrno(-res, "Error reading bytes from file"));
+      return;
+    }
+    int64_t bytes_read = res > 0 ? res : 0;
+    const int64_t nbytes = op->buffer->size();
+    if (res != 0 && bytes_read < nbytes) {
+      // Interrupted or short (but not at EOF); finish with a blocking read.
+      // Regular file reads rarely take this path.
+      auto result = ::arrow::internal::FileReadAt(
+          op->fd, op->buffer->mutable_data() + bytes_read, op->offset + bytes_read,
+          nbytes - bytes_read);
+      if (!result.ok()) {
+        op->future.MarkFinished(result.status());
+        return;
+      }
+      bytes_read += *result;
+    }
+    if (bytes_read < nbytes) {
+      Status st = op->buffer->Resize(bytes_read);
+      if (!st.ok()) {
+        op->future.MarkFinished(std::move(st));
+        return;
+      }
+      op->buffer->ZeroPadding();
+    }
+    op->future.MarkFinished(std::shared_ptr<Buffer>(std::move(op->buffer)));
+  }
+
+  int ring_fd_{-1};
+  std::mutex sq_mutex_;
+  std::atomic<uint32_t> in_flight_{0};
+  std::atomic<uint32_t>* sq_tail_{nullptr};
+  uint32_t sq_mask_{0};
+  uint32_t* sq_array_{nullptr};
+  io_uring_sqe* sqes_{nullptr};
+  std::atomic<uint32_t>* cq_head_{nullptr};
+  std::atomic<uint32_t>* cq_tail_{nullptr};
+  uint32_t cq_mask_{0};
+  io_uring_cqe* cqes_{nullptr};
+};
+
+}  // namespace
+
+#endif  // ARROW_HAVE_IO_URING
+
 // ----------------------------------------------------------------------
 // ReadableFile implementation
 
@@ -219,11 +492,36 @@ class ReadableFile::ReadableFileImpl : public OSFile {
  public:
   explicit ReadableFileImpl(MemoryPool* pool) : OSFile(), pool_(pool) {}
 
-  Status Open(const std::string& path) { return OpenReadable(path); }
+  Status Open(const std::string& path, bool direct = false) {
+    return OpenReadable(path, direct);
+  }
   Status Open(int fd) { return OpenReadable(fd); }
 
+  Result<int64_t> ReadAt(int64_t position, int64_t nbytes, void* out) {
+    if (!direct_io()) {
+      return OSFile::ReadAt(position, nbytes, out);
+    }
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(internal::ValidateRange(position, nbytes));
+    return DirectReadAt(position, nbytes, out);
+  }
+
+  Result<int64_t> Read(int64_t nbytes, void* out) {
+    if (!direct_io()) {
+      return OSFile::Read(nbytes, out);
+    }
+    // Route sequential reads through ReadAt() so that the alignment handling
+    // below applies, then restore the file position.
+    RETURN_NOT_OK(CheckClosed());
+    RETURN_NOT_OK(CheckPositioned());
+    ARROW_ASSIGN_OR_RAISE(int64_t position, Tell());
+    ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, DirectReadAt(position, nbytes, out));
+    RETURN_NOT_OK(Seek(position + bytes_read));
+    return bytes_read;
+  }
+
   Result<std::shared_ptr<Buffer>> ReadBuffer(int64_t nbytes) {
-    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateReadBuffer(nbytes));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, buffer->mutable_data()));
     if (bytes_read < nbytes) {
@@ -235,7 +533,7 @@ class ReadableFile::ReadableFileImpl : public OSFile {
   }
 
   Result<std::shared_ptr<Buffer>> ReadBufferAt(int64_t position, int64_t nbytes) {
-    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateResizableBuffer(nbytes, pool_));
+    ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateReadBuffer(nbytes));
 
     ARROW_ASSIGN_OR_RAISE(int64_t bytes_read,
                           ReadAt(position, nbytes, buffer->mutable_data()));
@@ -287,7 +585,61 @@ class ReadableFile::ReadableFileImpl : public OSFile {
     return Status::OK();
   }
 
+  MemoryPool* memory_pool() const { return pool_; }
+
  private:
+  // In direct I/O mode, read buffers are over-aligned so that whole-block
+  // reads into them can go straight to the device.
+  Result<std::unique_ptr<ResizableBuffer>> AllocateReadBuffer(int64_t nbytes) {
+    if (direct_io()) {
+      return AllocateResizableBuffer(nbytes, kDirectIOAlignment, pool_);
+    }
+    return AllocateResizableBuffer(nbytes, pool_);
+  }
+
+  Result<int64_t> DirectReadAt(int64_t position, int64_t nbytes, void* out) {
+    const auto addr = reinterpret_cast<uintptr_t>(out);
+    if (position % kDirectIOAlignment != 0 || addr % kDirectIOAlignment != 0) {
+      return BounceReadAt(position, nbytes, out);
+    }
+    // Aligned start: read the whole blocks directly into `out`, then serve
+    // any trailing partial block through the bounce buffer.
+    const int64_t head = nbytes - nbytes % kDirectIOAlignment;
+    int64_t total = 0;
+    if (head > 0) {
+      ARROW_ASSIGN_OR_RAISE(total, OSFile::ReadAt(position, head, out));
+      if (total < head) {
+        // Hit EOF in the aligned portion
+        return total;
+      }
+    }
+    if (nbytes > head) {
+      ARROW_ASSIGN_OR_RAISE(int64_t tail_read,
+                            BounceReadAt(position + head, nbytes - head,
+                                         static_cast<uint8_t*>(out) + head));
+      total += tail_read;
+    }
+    return total;
+  }
+
+  // Serve an unaligned request through an aligned covering read, since
+  // O_DIRECT requires the file offset, transfer length and buffer address to
+  // all be block-aligned.
+  Result<int64_t> BounceReadAt(int64_t position, int64_t nbytes, void* out) {
+    const int64_t aligned_start = position - position % kDirectIOAlignment;
+    const int64_t aligned_length =
+        bit_util::RoundUp(position + nbytes - aligned_start, kDirectIOAlignment);
+    ARROW_ASSIGN_OR_RAISE(auto bounce,
+                          AllocateBuffer(aligned_length, kDirectIOAlignment, pool_));
+    ARROW_ASSIGN_OR_RAISE(
+        int64_t bytes_read,
+        OSFile::ReadAt(aligned_start, aligned_length, bounce->mutable_data()));
+    const int64_t available = std::max<int64_t>(
+        0, std::min(nbytes, bytes_read - (position - aligned_start)));
+    memcpy(out, bounce->data() + (position - aligned_start), available);
+    return available;
+  }
+
   MemoryPool* pool_;
 };
 
@@ -308,6 +660,13 @@ Result<std::shared_ptr<ReadableFile>> ReadableFile::Open(int fd, MemoryPool* poo
   return file;
 }
 
+Result<std::shared_ptr<ReadableFile>> ReadableFile::OpenDirect(const std::string& path,
+                                                               MemoryPool* pool) {
+  auto file = std::shared_ptr<ReadableFile>(new ReadableFile(pool));
+  RETURN_NOT_OK(file->impl_->Open(path, /*direct=*/true));
+  return file;
+}
+
 Status ReadableFile::DoClose() { return impl_->Close(); }
 
 bool ReadableFile::closed() const { return !impl_->is_open(); }
@@ -316,6 +675,30 @@ Status ReadableFile::WillNeed(const std::vector<ReadRange>& ranges) {
   return impl_->WillNeed(ranges);
 }
 
+Future<std::shared_ptr<Buffer>> ReadableFile::ReadAsync(const IOContext& ctx,
+                                                        int64_t position,
+                                                        int64_t nbytes) {
+#ifdef ARROW_HAVE_IO_URING
+  auto* uring = IoUringContext::GetInstance();
+  // In direct I/O mode, alignment handling is needed; take the default path,
+  // which funnels into ReadAt()
+  if (uring != nullptr && !closed() && !impl_->direct_io() && position >= 0 &&
+      nbytes >= 0 && nbytes <= std::numeric_limits<int32_t>::max()) {
+    auto maybe_buffer = AllocateResizableBuffer(nbytes, impl_->memory_pool());
+    if (maybe_buffer.ok()) {
+      std::shared_ptr<ResizableBuffer> buffer = *std::move(maybe_buffer);
+      auto future = Future<std::shared_ptr<Buffer>>::Make();
+      if (uring->TrySubmitRead(shared_from_this(), impl_->fd(), std::move(buffer),
+                               position, future)) {
+        // Keep heavy continuations off the reaper thread
+        return ctx.executor()->Transfer(std::move(future));
+      }
+    }
+  }
+#endif
+  return RandomAccessFile::ReadAsync(ctx, position, nbytes);
+}
+
 Result<int64_t> ReadableFile::DoTell() const { return impl_->Tell(); }
 
 Result<int64_t> ReadableFile::DoRead(int64_t nbytes, void* out) {
@@ -350,6 +733,127 @@ class FileOutputStream::FileOutputStreamImpl : public OSFile {
     return OpenWritable(path, truncate, append, true /* write_only */);
   }
   Status Open(int fd) { return OpenWritable(fd); }
+
+  Status OpenDirect(const std::string& path, MemoryPool* pool) {
+    pool_ = pool;
+    RETURN_NOT_OK(OpenWritable(path, /*truncate=*/true, /*append=*/false,
+                               /*write_only=*/true, /*direct=*/true));
+    ARROW_ASSIGN_OR_RAISE(
+        staging_, AllocateResizableBuffer(kDirectIOStagingSize, kDirectIOAlignment,
+                                          pool_));
+    return Status::OK();
+  }
+
+  Result<int64_t> Tell() const {
+    if (!direct_io()) {
+      return OSFile::Tell();
+    }
+    RETURN_NOT_OK(CheckClosed());
+    return flushed_bytes_ + staging_length_;
+  }
+
+  Status Write(const void* data, int64_t nbytes) {
+    if (!direct_io()) {
+      return OSFile::Write(data, nbytes);
+    }
+    RETURN_NOT_OK(CheckClosed());
+    if (nbytes < 0) {
+      return Status::IOError("Length must be non-negative");
+    }
+    std::lock_guard<std::mutex> guard(lock_);
+    // Stage the data and write it out one full staging buffer at a time, so
+    // that device writes always meet the O_DIRECT alignment constraints
+    // regardless of how the caller slices its writes.
+    const auto* src = static_cast<const uint8_t*>(data);
+    while (nbytes > 0) {
+      const int64_t to_copy = std::min(nbytes, kDirectIOStagingSize - staging_length_);
+      memcpy(staging_->mutable_data() + staging_length_, src, to_copy);
+      staging_length_ += to_copy;
+      src += to_copy;
+      nbytes -= to_copy;
+      if (staging_length_ == kDirectIOStagingSize) {
+        RETURN_NOT_OK(WriteStagedBlocks());
+      }
+    }
+    return Status::OK();
+  }
+
+  Status WriteV(const std::vector<std::shared_ptr<Buffer>>& data) {
+    if (!direct_io()) {
+      return OSFile::WriteV(data);
+    }
+    // Everything is staged anyway, so there is nothing to gain from a
+    // vectored system call
+    for (const auto& buffer : data) {
+      if (buffer == nullptr || buffer->size() == 0) {
+        continue;
+      }
+      RETURN_NOT_OK(Write(buffer->data(), buffer->size()));
+    }
+    return Status::OK();
+  }
+
+  Status Flush() {
+    if (!direct_io()) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(CheckClosed());
+    std::lock_guard<std::mutex> guard(lock_);
+    return FlushStaged();
+  }
+
+  Status Close() {
+    if (direct_io() && is_open()) {
+      Status st;
+      {
+        std::lock_guard<std::mutex> guard(lock_);
+        st = FlushStaged();
+      }
+      st &= OSFile::Close();
+      return st;
+    }
+    return OSFile::Close();
+  }
+
+ private:
+  // Write the full blocks currently staged; an unaligned remainder stays
+  // staged for the next call.
+  Status WriteStagedBlocks() {
+    const int64_t full = staging_length_ - staging_length_ % kDirectIOAlignment;
+    if (full > 0) {
+      RETURN_NOT_OK(::arrow::internal::FileWrite(fd(), staging_->data(), full));
+      flushed_bytes_ += full;
+      staging_length_ -= full;
+      if (staging_length_ > 0) {
+        memmove(staging_->mutable_data(), staging_->data() + full, staging_length_);
+      }
+    }
+    return Status::OK();
+  }
+
+  // Flush everything staged.  A trailing partial block is written zero-padded
+  // and the file truncated to its logical size; the partial block stays
+  // staged so that a later Write() extends it by rewriting it in place.
+  Status FlushStaged() {
+    RETURN_NOT_OK(WriteStagedBlocks());
+    if (staging_length_ > 0) {
+      const int64_t padded = bit_util::RoundUp(staging_length_, kDirectIOAlignment);
+      memset(staging_->mutable_data() + staging_length_, 0, padded - staging_length_);
+      RETURN_NOT_OK(::arrow::internal::FileWrite(fd(), staging_->data(), padded));
+      RETURN_NOT_OK(
+          ::arrow::internal::FileTruncate(fd(), flushed_bytes_ + staging_length_));
+      // Rewind so that the padded block is rewritten when more data arrives
+      RETURN_NOT_OK(::arrow::internal::FileSeek(fd(), flushed_bytes_));
+    }
+    return Status::OK();
+  }
+
+  MemoryPool* pool_ = nullptr;
+  std::unique_ptr<ResizableBuffer> staging_;
+  int64_t staging_length_ = 0;
+  // Bytes durably written at aligned offsets, not counting a padded trailing
+  // block
+  int64_t flushed_bytes_ = 0;
 };
 
 FileOutputStream::FileOutputStream() { impl_.reset(new FileOutputStreamImpl()); }
@@ -369,6 +873,13 @@ Result<std::shared_ptr<FileOutputStream>> FileOutputStream::Open(int fd) {
   return stream;
 }
 
+Result<std::shared_ptr<FileOutputStream>> FileOutputStream::OpenDirect(
+    const std::string& path, MemoryPool* pool) {
+  auto stream = std::shared_ptr<FileOutputStream>(new FileOutputStream());
+  RETURN_NOT_OK(stream->impl_->OpenDirect(path, pool));
+  return stream;
+}
+
 Status FileOutputStream::Close() { return impl_->Close(); }
 
 bool FileOutputStream::closed() const { return !impl_->is_open(); }
@@ -379,6 +890,12 @@ Status FileOutputStream::Write(const void* data, int64_t length) {
   return impl_->Write(data, length);
 }
 
+Status FileOutputStream::WriteV(const std::vector<std::shared_ptr<Buffer>>& data) {
+  return impl_->WriteV(data);
+}
+
+Status FileOutputStream::Flush() { return impl_->Flush(); }
+
 int FileOutputStream::file_descriptor() const { return impl_->fd(); }
 
 // ----------------------------------------------------------------------
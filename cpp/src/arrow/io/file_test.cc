@@ -28,6 +28,7 @@
 #include <fstream>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <thread>
 #include <vector>
 
@@ -188,6 +189,19 @@ TEST_F(TestFileOutputStream, InvalidWrites) {
   ASSERT_RAISES(IOError, file_->Write(data, -1));
 }
 
+TEST_F(TestFileOutputStream, WriteV) {
+  OpenFile();
+
+  // Null and empty buffers are skipped
+  std::vector<std::shared_ptr<Buffer>> buffers = {
+      Buffer::FromString("test"), nullptr, Buffer::FromString(""),
+      Buffer::FromString("data")};
+  ASSERT_OK(file_->WriteV(buffers));
+  ASSERT_OK(file_->Close());
+
+  AssertFileContents(path_, "testdata");
+}
+
 TEST_F(TestFileOutputStream, Tell) {
   OpenFile();
 
@@ -227,6 +241,31 @@ TEST_F(TestFileOutputStream, Append) {
   AssertFileContents(path_, "testdata");
 }
 
+TEST_F(TestFileOutputStream, DirectIO) {
+  auto maybe_file = FileOutputStream::OpenDirect(path_);
+  if (!maybe_file.ok()) {
+    GTEST_SKIP() << "direct I/O unavailable here: " << maybe_file.status().ToString();
+  }
+  file_ = *std::move(maybe_file);
+
+  // Odd-sized writes exercise the aligned staging path
+  const std::string chunk = "0123456789abcdefghijklmnopqrstuvwxyz!";
+  std::string expected;
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_OK(file_->Write(chunk.data(), chunk.size()));
+    expected += chunk;
+  }
+  ASSERT_OK_AND_EQ(static_cast<int64_t>(expected.size()), file_->Tell());
+
+  // Flush() persists the trailing partial block; later writes extend it
+  ASSERT_OK(file_->Flush());
+  ASSERT_OK(file_->Write(chunk.data(), chunk.size()));
+  expected += chunk;
+  ASSERT_OK(file_->Close());
+
+  AssertFileContents(path_, expected);
+}
+
 // ----------------------------------------------------------------------
 // File input tests
 
@@ -377,6 +416,47 @@ TEST_F(TestReadableFile, ReadAt) {
   ASSERT_RAISES(Invalid, file_->ReadAt(0, 1));
 }
 
+TEST_F(TestReadableFile, DirectIO) {
+  // A few whole blocks plus an unaligned tail, so both the aligned and the
+  // bounce-buffer paths are exercised
+  const int64_t file_size = 3 * 4096 + 123;
+  std::string data;
+  for (int64_t i = 0; i < file_size; ++i) {
+    data += static_cast<char>('a' + i % 26);
+  }
+  std::ofstream stream(path_, std::ios::binary);
+  stream.write(data.data(), static_cast<std::streamsize>(data.size()));
+  stream.close();
+
+  auto maybe_file = ReadableFile::OpenDirect(path_);
+  if (!maybe_file.ok()) {
+    GTEST_SKIP() << "direct I/O unavailable here: " << maybe_file.status().ToString();
+  }
+  file_ = *std::move(maybe_file);
+  ASSERT_OK_AND_EQ(file_size, file_->GetSize());
+
+  // Whole-file read with an unaligned length
+  ASSERT_OK_AND_ASSIGN(auto buffer, file_->ReadAt(0, file_size));
+  AssertBufferEqual(*buffer, data);
+
+  // Unaligned position and length
+  ASSERT_OK_AND_ASSIGN(buffer, file_->ReadAt(4099, 1000));
+  AssertBufferEqual(*buffer, std::string_view(data).substr(4099, 1000));
+
+  // Reads truncated at EOF
+  ASSERT_OK_AND_ASSIGN(buffer, file_->ReadAt(file_size - 100, 1000));
+  AssertBufferEqual(*buffer, std::string_view(data).substr(file_size - 100));
+
+  // Sequential reads maintain the stream position
+  uint8_t bytes[100];
+  ASSERT_OK(file_->Seek(4000));
+  ASSERT_OK_AND_EQ(100, file_->Read(100, bytes));
+  ASSERT_EQ(0, std::memcmp(bytes, data.data() + 4000, 100));
+  ASSERT_OK_AND_EQ(4100, file_->Tell());
+
+  ASSERT_OK(file_->Close());
+}
+
 TEST_F(TestReadableFile, ReadAsync) {
   MakeTestFile();
   OpenFile();
@@ -39,6 +39,7 @@
 #include "arrow/util/io_util.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/metrics.h"
 #include "arrow/util/thread_pool.h"
 
 namespace arrow {
@@ -150,16 +151,22 @@ RandomAccessFile::~RandomAccessFile() = default;
 RandomAccessFile::RandomAccessFile() : interface_impl_(new Impl()) {}
 
 Result<int64_t> RandomAccessFile::ReadAt(int64_t position, int64_t nbytes, void* out) {
+  ARROW_METRIC_SCOPED_TIMER("arrow.io.read_at_nanos");
   std::lock_guard<std::mutex> lock(interface_impl_->lock_);
   RETURN_NOT_OK(Seek(position));
-  return Read(nbytes, out);
+  ARROW_ASSIGN_OR_RAISE(int64_t bytes_read, Read(nbytes, out));
+  ARROW_METRIC_COUNTER_ADD("arrow.io.bytes_read", bytes_read);
+  return bytes_read;
 }
 
 Result<std::shared_ptr<Buffer>> RandomAccessFile::ReadAt(int64_t position,
                                                          int64_t nbytes) {
+  ARROW_METRIC_SCOPED_TIMER("arrow.io.read_at_nanos");
   std::lock_guard<std::mutex> lock(interface_impl_->lock_);
   RETURN_NOT_OK(Seek(position));
-  return Read(nbytes);
+  ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Buffer> buffer, Read(nbytes));
+  ARROW_METRIC_COUNTER_ADD("arrow.io.bytes_read", buffer->size());
+  return buffer;
 }
 
 // Default ReadAsync() implementation: simply issue the read on the context's executor
@@ -203,6 +210,15 @@ Status Writable::Write(const std::shared_ptr<Buffer>& data) {
   return Write(data->data(), data->size());
 }
 
+Status Writable::WriteV(const std::vector<std::shared_ptr<Buffer>>& data) {
+  for (const auto& buffer : data) {
+    if (buffer != nullptr && buffer->size() > 0) {
+      RETURN_NOT_OK(Write(buffer));
+    }
+  }
+  return Status::OK();
+}
+
 Status Writable::Flush() { return Status::OK(); }
 
 // An InputStream that reads from a delimited range of a RandomAccessFile
@@ -168,6 +168,15 @@ class ARROW_EXPORT Writable {
   /// buffering is required.  See Write(const void*, int64_t) for details.
   virtual Status Write(const std::shared_ptr<Buffer>& data);
 
+  /// \brief Write data gathered from multiple buffers
+  ///
+  /// The default implementation writes each buffer in turn.  Streams backed
+  /// by an OS descriptor may override this with a vectored (writev-style)
+  /// write so the buffers are handed to the OS together rather than copied
+  /// into a staging buffer or written one by one.  Null buffers and empty
+  /// buffers are skipped.
+  virtual Status WriteV(const std::vector<std::shared_ptr<Buffer>>& data);
+
   /// \brief Flush buffered bytes, if any
   virtual Status Flush();
 
@@ -919,6 +919,70 @@ TEST(RangeReadCache, LazyWithPrefetching) {
   ASSERT_RAISES(Invalid, cache.Read({25, 2}));
 }
 
+TEST(RangeReadCache, AdaptiveCoalescing) {
+  std::string data = "abcdefghijklmnopqrstuvwxyz";
+
+  // Static limits would keep these ranges apart (holes are wider than 2 bytes)
+  CacheOptions options = CacheOptions::Defaults();
+  options.hole_size_limit = 2;
+  options.range_size_limit = 10;
+  options.read_profile = std::make_shared<ReadProfile>();
+
+  // Train the profile on a high-latency store: TTFB = 10 ms, BW = 100 MiB/s
+  constexpr double kBandwidth = 100.0 * 1024 * 1024;
+  for (int64_t i = 0; i < ReadProfile::kMinSamples; ++i) {
+    const int64_t nbytes = (i % 2 == 0) ? (1 << 20) : (8 << 20);
+    options.read_profile->RecordRead(nbytes, 0.01 + nbytes / kBandwidth);
+  }
+
+  auto file = std::make_shared<CountingBufferReader>(std::make_shared<Buffer>(data));
+  internal::ReadRangeCache cache(file, {}, options);
+
+  // The adapted hole size limit (the bandwidth-delay product, 1 MiB) now
+  // merges everything into a single read
+  ASSERT_OK(cache.Cache({{1, 2}, {8, 2}, {20, 2}}));
+  ASSERT_FINISHES_OK(cache.Wait());
+  ASSERT_EQ(1, file->read_count());
+
+  ASSERT_OK_AND_ASSIGN(auto buf, cache.Read({8, 2}));
+  AssertBufferEqual(*buf, "ij");
+}
+
+TEST(ReadProfile, Basics) {
+  ReadProfile profile;
+  const CacheOptions base = CacheOptions::Defaults();
+
+  // Not enough samples yet: the caller-provided limits are kept
+  ASSERT_EQ(base, profile.Adapt(base));
+
+  // TTFB = 10 ms, BW = 100 MiB/s, measured over two read sizes
+  constexpr double kBandwidth = 100.0 * 1024 * 1024;
+  for (int64_t i = 0; i < ReadProfile::kMinSamples; ++i) {
+    const int64_t nbytes = (i % 2 == 0) ? (1 << 20) : (8 << 20);
+    profile.RecordRead(nbytes, 0.01 + nbytes / kBandwidth);
+  }
+  const CacheOptions adapted = profile.Adapt(base);
+  // hole_size_limit = TTFB * BW = 1 MiB,
+  // range_size_limit = hole_size_limit * 0.9 / (1 - 0.9) = 9 MiB
+  ASSERT_EQ(1024 * 1024, adapted.hole_size_limit);
+  ASSERT_EQ(9 * 1024 * 1024, adapted.range_size_limit);
+
+  // Reads of a single size cannot separate latency from bandwidth
+  ReadProfile uniform;
+  for (int64_t i = 0; i < ReadProfile::kMinSamples; ++i) {
+    uniform.RecordRead(1 << 20, 0.01);
+  }
+  ASSERT_EQ(base, uniform.Adapt(base));
+}
+
+TEST(ReadProfile, ForKey) {
+  auto s3 = ReadProfile::ForKey("s3");
+  ASSERT_NE(s3, nullptr);
+  // Profiles are shared per key
+  ASSERT_EQ(s3, ReadProfile::ForKey("s3"));
+  ASSERT_NE(s3, ReadProfile::ForKey("local"));
+}
+
 TEST(CacheOptions, Basics) {
   auto check = [](const CacheOptions actual, const double expected_hole_size_limit_MiB,
                   const double expected_range_size_limit_MiB) -> void {
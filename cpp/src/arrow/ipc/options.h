@@ -19,6 +19,8 @@
 
 #include <cstdint>
 #include <optional>
+#include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "arrow/io/caching.h"
@@ -83,6 +85,17 @@ struct ARROW_EXPORT IpcWriteOptions {
   /// prior to 12.0.0.
   std::optional<double> min_space_savings;
 
+  /// \brief Names of columns to leave uncompressed when a codec is set
+  ///
+  /// The IPC format declares a single codec per record batch, but each body
+  /// buffer may individually be stored uncompressed. Columns known not to
+  /// compress well (for example high-entropy numeric data) can be listed here
+  /// to skip the compression work up front, instead of relying on
+  /// min_space_savings to discard the result after the fact. Only top-level
+  /// column names are matched; dictionary batch buffers are always
+  /// compressed. If no codec was supplied, this option is ignored.
+  std::unordered_set<std::string> uncompressed_columns;
+
   /// \brief Use global CPU thread pool to parallelize any computational tasks
   /// like compression
   bool use_threads = true;
@@ -128,6 +141,21 @@ struct ARROW_EXPORT IpcWriteOptions {
   static IpcWriteOptions Defaults();
 };
 
+/// \brief Degree of validation applied to incoming IPC record batches
+enum class IpcValidationLevel : char {
+  /// \brief Verify Flatbuffer metadata and check each buffer's offset,
+  /// length and alignment before it is mapped (the default)
+  kFull,
+  /// \brief Verify Flatbuffer metadata but skip per-buffer offset, length
+  /// and alignment checks when materializing ArrayData
+  kStructural,
+  /// \brief Skip both Flatbuffer re-verification and per-buffer checks
+  ///
+  /// Only safe when the producer is fully trusted (for example peers inside
+  /// a sealed cluster); malformed input may crash the process or worse.
+  kNone
+};
+
 /// \brief Options for reading Arrow IPC messages
 struct ARROW_EXPORT IpcReadOptions {
   /// \brief The maximum permitted schema nesting depth.
@@ -161,6 +189,25 @@ struct ARROW_EXPORT IpcReadOptions {
   /// RecordBatchStreamReader and StreamDecoder classes.
   bool ensure_native_endian = true;
 
+  /// \brief EXPERIMENTAL: Resolve repeated dictionaries from a process-wide cache
+  ///
+  /// Services commonly receive many streams carrying identical dictionaries.
+  /// When enabled, decoded dictionary batches are stored in a process-wide
+  /// cache keyed by a hash of the dictionary message bytes, and later
+  /// dictionary batches with the same bytes (including deltas) resolve to the
+  /// already-decoded arrays without any decode work.  Cached dictionaries are
+  /// shared between readers and must not be mutated.
+  bool use_dictionary_cache = false;
+
+  /// \brief How much validation to apply to record batch metadata and buffers
+  ///
+  /// Flatbuffer verification and per-buffer bounds checks are a measurable
+  /// fraction of deserialization cost for small messages.  Lower levels trade
+  /// safety against untrusted input for speed; see IpcValidationLevel for the
+  /// guarantees each level retains.  Stream framing (length prefixes and
+  /// message headers) is always checked.
+  IpcValidationLevel validation_level = IpcValidationLevel::kFull;
+
   /// \brief Options to control caching behavior when pre-buffering is requested
   ///
   /// The lazy property will always be reset to true to deliver the expected behavior
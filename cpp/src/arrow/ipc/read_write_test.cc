@@ -839,6 +839,44 @@ TEST_F(TestWriteRecordBatch, WriteWithCompressionAndMinSavings) {
   }
 }
 
+TEST_F(TestWriteRecordBatch, WriteWithCompressionUncompressedColumns) {
+  // Two identical compressible columns, one opted out of compression
+  auto batch =
+      RecordBatchFromJSON(schema({field("a", int64()), field("b", int64())}), R"([
+    {"a":0,"b":0},{"a":1,"b":1},{"a":2,"b":2},{"a":3,"b":3},{"a":4,"b":4},
+    {"a":5,"b":5},{"a":6,"b":6},{"a":7,"b":7},{"a":8,"b":8},{"a":9,"b":9}])");
+
+  auto prefixed_size = [](const Buffer& buffer) -> int64_t {
+    if (buffer.size() < int64_t(sizeof(int64_t))) return 0;
+    return bit_util::FromLittleEndian(util::SafeLoadAs<int64_t>(buffer.data()));
+  };
+  auto content_size = [](const Buffer& buffer) -> int64_t {
+    return buffer.size() - sizeof(int64_t);
+  };
+
+  for (auto codec : {Compression::LZ4_FRAME, Compression::ZSTD}) {
+    if (!util::Codec::IsAvailable(codec)) {
+      continue;
+    }
+
+    auto write_options = IpcWriteOptions::Defaults();
+    ASSERT_OK_AND_ASSIGN(write_options.codec, util::Codec::Create(codec));
+    write_options.uncompressed_columns = {"b"};
+
+    IpcPayload payload;
+    ASSERT_OK(GetRecordBatchPayload(*batch, write_options, &payload));
+    ASSERT_EQ(payload.body_buffers.size(), 4);
+    // Column "a" is compressed as usual...
+    ASSERT_GT(prefixed_size(*payload.body_buffers[1]), 0);
+    // ...while column "b" is stored raw with the uncompressed marker
+    ASSERT_EQ(prefixed_size(*payload.body_buffers[3]), -1);
+    ASSERT_EQ(content_size(*payload.body_buffers[3]),
+              batch->num_rows() * int64_t(sizeof(int64_t)));
+
+    CheckRoundtrip(*batch, write_options, IpcReadOptions::Defaults());
+  }
+}
+
 TEST_F(TestWriteRecordBatch, SliceTruncatesBinaryOffsets) {
   // ARROW-6046
   std::shared_ptr<Array> array;
@@ -1855,6 +1893,38 @@ TEST(TestDictionaryBatch, DictionaryDeltaWithUnknownId) {
   ASSERT_RAISES(KeyError, helper.ReadBatch(&out_batch));
 }
 
+TEST(TestDictionaryBatch, DictionaryCacheAcrossStreams) {
+  auto f0 = field("f0", dictionary(int8(), utf8()));
+  auto batch_schema = schema({f0});
+  auto dict = ArrayFromJSON(utf8(), R"(["foo", "bar", "baz"])");
+  auto indices = ArrayFromJSON(int8(), "[0, 1, 2, 0]");
+  auto column = std::make_shared<DictionaryArray>(f0->type(), indices, dict);
+  auto batch = RecordBatch::Make(batch_schema, 4, {column});
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create());
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeStreamWriter(sink, batch_schema));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  auto read_options = IpcReadOptions::Defaults();
+  read_options.use_dictionary_cache = true;
+
+  // Read the same stream twice through independent readers; the second read
+  // must resolve the dictionary from the process-wide cache.
+  ArrayVector dicts;
+  for (int i = 0; i < 2; ++i) {
+    io::BufferReader input(buffer);
+    ASSERT_OK_AND_ASSIGN(auto reader,
+                         RecordBatchStreamReader::Open(&input, read_options));
+    ASSERT_OK_AND_ASSIGN(auto out, reader->Next());
+    ASSERT_BATCHES_EQUAL(*batch, *out);
+    dicts.push_back(checked_cast<const DictionaryArray&>(*out->column(0)).dictionary());
+  }
+  // A cache hit reuses the decoded buffers rather than re-slicing the input.
+  ASSERT_EQ(dicts[0]->data()->buffers[2], dicts[1]->data()->buffers[2]);
+}
+
 TEST(TestDictionaryBatch, DictionaryReplacement) {
   std::shared_ptr<RecordBatch> in_batch;
   std::shared_ptr<RecordBatch> out_batch;
@@ -2090,6 +2160,101 @@ TEST_F(TestFileFormatGeneratorCoalesced, Errors) {
                              reader->GetRecordBatchGenerator(/*coalesce=*/true));
 }
 
+TEST(TestRecordBatchFileReader, OpenCheckpointed) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeIntRecordBatch(&batch));
+
+  ASSERT_OK_AND_ASSIGN(auto sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(auto writer, MakeFileWriter(sink, batch->schema()));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Checkpoint());
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Checkpoint());
+  // Simulate a crashed writer: a third batch is written but the file is
+  // truncated mid-message and never closed
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+  auto truncated = SliceBuffer(buffer, 0, buffer->size() - 17);
+
+  std::shared_ptr<io::RandomAccessFile> file =
+      std::make_shared<io::BufferReader>(truncated);
+  // The damaged file has no footer at its end
+  ASSERT_RAISES(Invalid, RecordBatchFileReader::Open(file));
+  // Recovery finds the second checkpoint
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::OpenCheckpointed(file));
+  ASSERT_EQ(2, reader->num_record_batches());
+  for (int i = 0; i < reader->num_record_batches(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto out, reader->ReadRecordBatch(i));
+    ASSERT_BATCHES_EQUAL(*batch, *out);
+  }
+
+  // A file closed normally after checkpointing is still a regular file
+  ASSERT_OK_AND_ASSIGN(sink, io::BufferOutputStream::Create(0));
+  ASSERT_OK_AND_ASSIGN(writer, MakeFileWriter(sink, batch->schema()));
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Checkpoint());
+  ASSERT_OK(writer->WriteRecordBatch(*batch));
+  ASSERT_OK(writer->Close());
+  ASSERT_OK_AND_ASSIGN(buffer, sink->Finish());
+
+  file = std::make_shared<io::BufferReader>(buffer);
+  ASSERT_OK_AND_ASSIGN(reader, RecordBatchFileReader::Open(file));
+  ASSERT_EQ(2, reader->num_record_batches());
+  ASSERT_OK_AND_ASSIGN(reader, RecordBatchFileReader::OpenCheckpointed(file));
+  ASSERT_EQ(2, reader->num_record_batches());
+}
+
+TEST(TestRecordBatchFileReader, ValidationLevels) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeDictionary(&batch));
+
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcWriteOptions::Defaults()));
+  ASSERT_OK(helper.WriteBatch(batch));
+  ASSERT_OK(helper.WriteBatch(batch));
+  ASSERT_OK(helper.Finish());
+
+  // Well-formed data reads identically at every validation level
+  for (auto level : {IpcValidationLevel::kFull, IpcValidationLevel::kStructural,
+                     IpcValidationLevel::kNone}) {
+    auto read_options = IpcReadOptions::Defaults();
+    read_options.validation_level = level;
+    RecordBatchVector out_batches;
+    ASSERT_OK(helper.ReadBatches(read_options, &out_batches));
+    ASSERT_EQ(2, out_batches.size());
+    for (const auto& out : out_batches) {
+      ASSERT_BATCHES_EQUAL(*batch, *out);
+    }
+  }
+}
+
+TEST(TestRecordBatchFileReader, ReadRawMessages) {
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(MakeDictionary(&batch));
+
+  FileWriterHelper helper;
+  ASSERT_OK(helper.Init(batch->schema(), IpcWriteOptions::Defaults()));
+  ASSERT_OK(helper.WriteBatch(batch));
+  ASSERT_OK(helper.Finish());
+
+  io::BufferReader buf_reader(helper.buffer_);
+  ASSERT_OK_AND_ASSIGN(auto reader, RecordBatchFileReader::Open(&buf_reader));
+
+  ASSERT_GT(reader->num_dictionaries(), 0);
+  for (int i = 0; i < reader->num_dictionaries(); ++i) {
+    ASSERT_OK_AND_ASSIGN(auto message, reader->ReadDictionaryMessage(i));
+    ASSERT_EQ(MessageType::DICTIONARY_BATCH, message->type());
+    ASSERT_NE(nullptr, message->metadata());
+    ASSERT_NE(nullptr, message->body());
+  }
+
+  ASSERT_EQ(1, reader->num_record_batches());
+  ASSERT_OK_AND_ASSIGN(auto message, reader->ReadRecordBatchMessage(0));
+  ASSERT_EQ(MessageType::RECORD_BATCH, message->type());
+  ASSERT_NE(nullptr, message->metadata());
+  ASSERT_EQ(message->body()->size(), message->body_length());
+}
+
 TEST(TestRecordBatchStreamReader, EmptyStreamWithDictionaries) {
   // ARROW-6006
   auto f0 = arrow::field("f0", arrow::dictionary(arrow::int8(), arrow::utf8()));
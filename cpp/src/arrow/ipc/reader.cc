@@ -21,6 +21,7 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <string>
 #include <type_traits>
@@ -52,9 +53,9 @@
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/endian.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging_internal.h"
-#include "arrow/util/parallel.h"
 #include "arrow/util/string.h"
 #include "arrow/util/thread_pool.h"
 #include "arrow/util/ubsan.h"
@@ -137,6 +138,17 @@ struct IpcReadContext {
   const bool swap_endian;
 };
 
+// Access the flatbuffer Message root in `metadata`, re-verifying the buffer
+// unless the read options opted out of validation for trusted input.
+Status GetMessageRoot(const Buffer& metadata, IpcValidationLevel validation_level,
+                      const flatbuf::Message** out) {
+  if (validation_level == IpcValidationLevel::kNone) {
+    *out = flatbuf::GetMessage(metadata.data());
+    return Status::OK();
+  }
+  return internal::VerifyMessage(metadata.data(), metadata.size(), out);
+}
+
 /// A collection of ranges to read and pointers to set to those ranges when they are
 /// available.  This allows the ArrayLoader to utilize a two pass cache-then-read
 /// strategy with a ReadRangeCache
@@ -171,7 +183,8 @@ class ArrayLoader {
         metadata_version_(metadata_version),
         file_(file),
         file_offset_(0),
-        max_recursion_depth_(options.max_recursion_depth) {}
+        max_recursion_depth_(options.max_recursion_depth),
+        validation_level_(options.validation_level) {}
 
   explicit ArrayLoader(const flatbuf::RecordBatch* metadata,
                        MetadataVersion metadata_version, const IpcReadOptions& options,
@@ -180,22 +193,25 @@ class ArrayLoader {
         metadata_version_(metadata_version),
         file_(nullptr),
         file_offset_(file_offset),
-        max_recursion_depth_(options.max_recursion_depth) {}
+        max_recursion_depth_(options.max_recursion_depth),
+        validation_level_(options.validation_level) {}
 
   Status ReadBuffer(int64_t offset, int64_t length, std::shared_ptr<Buffer>* out) {
     if (skip_io_) {
       return Status::OK();
     }
-    if (offset < 0) {
-      return Status::Invalid("Negative offset for reading buffer ", buffer_index_);
-    }
-    if (length < 0) {
-      return Status::Invalid("Negative length for reading buffer ", buffer_index_);
-    }
-    // This construct permits overriding GetBuffer at compile time
-    if (!bit_util::IsMultipleOf8(offset)) {
-      return Status::Invalid("Buffer ", buffer_index_,
-                             " did not start on 8-byte aligned offset: ", offset);
+    if (validation_level_ == IpcValidationLevel::kFull) {
+      if (offset < 0) {
+        return Status::Invalid("Negative offset for reading buffer ", buffer_index_);
+      }
+      if (length < 0) {
+        return Status::Invalid("Negative length for reading buffer ", buffer_index_);
+      }
+      // This construct permits overriding GetBuffer at compile time
+      if (!bit_util::IsMultipleOf8(offset)) {
+        return Status::Invalid("Buffer ", buffer_index_,
+                               " did not start on 8-byte aligned offset: ", offset);
+      }
     }
     if (file_) {
       return file_->ReadAt(offset, length).Value(out);
@@ -496,6 +512,7 @@ class ArrayLoader {
   io::RandomAccessFile* file_;
   int64_t file_offset_;
   int max_recursion_depth_;
+  IpcValidationLevel validation_level_;
   int buffer_index_ = 0;
   int field_index_ = 0;
   bool skip_io_ = false;
@@ -506,44 +523,6 @@ class ArrayLoader {
   ArrayData* out_ = nullptr;
 };
 
-Result<std::shared_ptr<Buffer>> DecompressBuffer(const std::shared_ptr<Buffer>& buf,
-                                                 const IpcReadOptions& options,
-                                                 util::Codec* codec) {
-  if (buf == nullptr || buf->size() == 0) {
-    return buf;
-  }
-
-  if (buf->size() < 8) {
-    return Status::Invalid(
-        "Likely corrupted message, compressed buffers "
-        "are larger than 8 bytes by construction");
-  }
-
-  const uint8_t* data = buf->data();
-  int64_t compressed_size = buf->size() - sizeof(int64_t);
-  int64_t uncompressed_size = bit_util::FromLittleEndian(util::SafeLoadAs<int64_t>(data));
-
-  if (uncompressed_size == -1) {
-    return SliceBuffer(buf, sizeof(int64_t), compressed_size);
-  }
-
-  ARROW_ASSIGN_OR_RAISE(auto uncompressed,
-                        AllocateBuffer(uncompressed_size, options.memory_pool));
-
-  ARROW_ASSIGN_OR_RAISE(
-      int64_t actual_decompressed,
-      codec->Decompress(compressed_size, data + sizeof(int64_t), uncompressed_size,
-                        uncompressed->mutable_data()));
-  if (actual_decompressed != uncompressed_size) {
-    return Status::Invalid("Failed to fully decompress buffer, expected ",
-                           uncompressed_size, " bytes but decompressed ",
-                           actual_decompressed);
-  }
-
-  // R build with openSUSE155 requires an explicit shared_ptr construction
-  return std::shared_ptr<Buffer>(std::move(uncompressed));
-}
-
 Status DecompressBuffers(Compression::type compression, const IpcReadOptions& options,
                          ArrayDataVector* fields) {
   struct BufferAccumulator {
@@ -572,12 +551,56 @@ Status DecompressBuffers(Compression::type compression, const IpcReadOptions& op
   std::unique_ptr<util::Codec> codec;
   ARROW_ASSIGN_OR_RAISE(codec, util::Codec::Create(compression));
 
-  return ::arrow::internal::OptionalParallelFor(
-      options.use_threads, static_cast<int>(buffers.size()), [&](int i) {
-        ARROW_ASSIGN_OR_RAISE(*buffers[i],
-                              DecompressBuffer(*buffers[i], options, codec.get()));
-        return Status::OK();
-      });
+  // Allocate the uncompressed buffers up front and hand all actually-compressed
+  // buffers to the codec as one batch of frames, decompressed concurrently on
+  // the CPU thread pool.  Buffers whose length prefix is -1 are stored
+  // uncompressed and only need slicing.
+  std::vector<util::Codec::DecompressFrame> frames;
+  std::vector<std::shared_ptr<Buffer>*> targets;
+  std::vector<std::shared_ptr<Buffer>> uncompressed;
+  for (auto* buffer : buffers) {
+    const auto& buf = *buffer;
+    if (buf == nullptr || buf->size() == 0) {
+      continue;
+    }
+    if (buf->size() < 8) {
+      return Status::Invalid(
+          "Likely corrupted message, compressed buffers "
+          "are larger than 8 bytes by construction");
+    }
+
+    const uint8_t* data = buf->data();
+    const int64_t compressed_size = buf->size() - sizeof(int64_t);
+    const int64_t uncompressed_size =
+        bit_util::FromLittleEndian(util::SafeLoadAs<int64_t>(data));
+
+    if (uncompressed_size == -1) {
+      *buffer = SliceBuffer(buf, sizeof(int64_t), compressed_size);
+      continue;
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto out,
+                          AllocateBuffer(uncompressed_size, options.memory_pool));
+    frames.push_back({compressed_size, data + sizeof(int64_t), uncompressed_size,
+                      out->mutable_data()});
+    targets.push_back(buffer);
+    // R build with openSUSE155 requires an explicit shared_ptr construction
+    uncompressed.push_back(std::shared_ptr<Buffer>(std::move(out)));
+  }
+
+  ARROW_ASSIGN_OR_RAISE(
+      auto actual_lengths,
+      codec->DecompressParallel(
+          frames, options.use_threads ? ::arrow::internal::GetCpuThreadPool() : nullptr));
+  for (size_t i = 0; i < frames.size(); ++i) {
+    if (actual_lengths[i] != frames[i].output_len) {
+      return Status::Invalid("Failed to fully decompress buffer, expected ",
+                             frames[i].output_len, " bytes but decompressed ",
+                             actual_lengths[i]);
+    }
+    *targets[i] = std::move(uncompressed[i]);
+  }
+  return Status::OK();
 }
 
 Result<std::shared_ptr<RecordBatch>> LoadRecordBatchSubset(
@@ -708,7 +731,7 @@ Result<RecordBatchWithMetadata> ReadRecordBatchInternal(
     const std::vector<bool>& inclusion_mask, IpcReadContext& context,
     io::RandomAccessFile* file) {
   const flatbuf::Message* message = nullptr;
-  RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
+  RETURN_NOT_OK(GetMessageRoot(metadata, context.options.validation_level, &message));
   auto batch = message->header_as_RecordBatch();
   if (batch == nullptr) {
     return Status::IOError(
@@ -803,10 +826,64 @@ Status UnpackSchemaMessage(const Message& message, const IpcReadOptions& options
                              out_schema, field_inclusion_mask, swap_endian);
 }
 
+// Process-wide cache of decoded dictionary bodies, consulted when
+// IpcReadOptions::use_dictionary_cache is enabled.  Entries are shared
+// between readers and must be treated as immutable.
+class DictionaryDataCache {
+ public:
+  static DictionaryDataCache* Instance() {
+    static DictionaryDataCache instance;
+    return &instance;
+  }
+
+  std::shared_ptr<ArrayData> Get(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    return it == entries_.end() ? nullptr : it->second;
+  }
+
+  void Insert(const std::string& key, std::shared_ptr<ArrayData> data) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.size() >= kMaxEntries && entries_.find(key) == entries_.end()) {
+      // Crude bound on memory consumption; dictionaries churning through a
+      // full cache simply evict an arbitrary entry.
+      entries_.erase(entries_.begin());
+    }
+    entries_[key] = std::move(data);
+  }
+
+ private:
+  static constexpr size_t kMaxEntries = 256;
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<ArrayData>> entries_;
+};
+
+// Returns an empty string if the dictionary is not cacheable (e.g. its value
+// type has no fingerprint).  The key covers everything that influences the
+// decoded result: the message bytes, the value type and the endian swap.
+std::string DictionaryCacheKey(const Buffer& metadata, const Buffer& body,
+                               const DataType& value_type, bool swap_endian) {
+  std::string key = value_type.fingerprint();
+  if (key.empty()) {
+    return key;
+  }
+  const uint64_t metadata_hash =
+      ::arrow::internal::ComputeStringHash<0>(metadata.data(), metadata.size());
+  const uint64_t body_hash =
+      ::arrow::internal::ComputeStringHash<0>(body.data(), body.size());
+  key += swap_endian ? "|1|" : "|0|";
+  key += ::arrow::internal::ToChars(metadata_hash);
+  key += '|';
+  key += ::arrow::internal::ToChars(body_hash);
+  return key;
+}
+
 Status ReadDictionary(const Buffer& metadata, const IpcReadContext& context,
-                      DictionaryKind* kind, io::RandomAccessFile* file) {
+                      DictionaryKind* kind, io::RandomAccessFile* file,
+                      const std::shared_ptr<Buffer>& body = nullptr) {
   const flatbuf::Message* message = nullptr;
-  RETURN_NOT_OK(internal::VerifyMessage(metadata.data(), metadata.size(), &message));
+  RETURN_NOT_OK(GetMessageRoot(metadata, context.options.validation_level, &message));
   const auto dictionary_batch = message->header_as_DictionaryBatch();
   if (dictionary_batch == nullptr) {
     return Status::IOError(
@@ -833,22 +910,39 @@ Status ReadDictionary(const Buffer& metadata, const IpcReadContext& context,
   // DictionaryMemo already prior to invoking this function
   ARROW_ASSIGN_OR_RAISE(auto value_type, context.dictionary_memo->GetDictionaryType(id));
 
-  // Load the dictionary data from the dictionary batch
-  ArrayLoader loader(batch_meta, internal::GetMetadataVersion(message->version()),
-                     context.options, file);
-  auto dict_data = std::make_shared<ArrayData>();
-  const Field dummy_field("", value_type);
-  RETURN_NOT_OK(loader.Load(&dummy_field, dict_data.get()));
-
-  if (compression != Compression::UNCOMPRESSED) {
-    ArrayDataVector dict_fields{dict_data};
-    RETURN_NOT_OK(DecompressBuffers(compression, context.options, &dict_fields));
+  // Repeated dictionaries with identical bytes resolve to the same decoded
+  // arrays when the process-wide cache is enabled.
+  std::string cache_key;
+  std::shared_ptr<ArrayData> dict_data;
+  if (context.options.use_dictionary_cache && body != nullptr) {
+    cache_key = DictionaryCacheKey(metadata, *body, *value_type, context.swap_endian);
+    if (!cache_key.empty()) {
+      dict_data = DictionaryDataCache::Instance()->Get(cache_key);
+    }
   }
 
-  // swap endian in dict_data if necessary (swap_endian == true)
-  if (context.swap_endian) {
-    ARROW_ASSIGN_OR_RAISE(dict_data, ::arrow::internal::SwapEndianArrayData(
-                                         dict_data, context.options.memory_pool));
+  if (dict_data == nullptr) {
+    // Load the dictionary data from the dictionary batch
+    ArrayLoader loader(batch_meta, internal::GetMetadataVersion(message->version()),
+                       context.options, file);
+    dict_data = std::make_shared<ArrayData>();
+    const Field dummy_field("", value_type);
+    RETURN_NOT_OK(loader.Load(&dummy_field, dict_data.get()));
+
+    if (compression != Compression::UNCOMPRESSED) {
+      ArrayDataVector dict_fields{dict_data};
+      RETURN_NOT_OK(DecompressBuffers(compression, context.options, &dict_fields));
+    }
+
+    // swap endian in dict_data if necessary (swap_endian == true)
+    if (context.swap_endian) {
+      ARROW_ASSIGN_OR_RAISE(dict_data, ::arrow::internal::SwapEndianArrayData(
+                                           dict_data, context.options.memory_pool));
+    }
+
+    if (!cache_key.empty()) {
+      DictionaryDataCache::Instance()->Insert(cache_key, dict_data);
+    }
   }
 
   if (dictionary_batch->isDelta()) {
@@ -871,7 +965,8 @@ Status ReadDictionary(const Message& message, const IpcReadContext& context,
   DCHECK_EQ(message.type(), MessageType::DICTIONARY_BATCH);
   CHECK_HAS_BODY(message);
   ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message.body()));
-  return ReadDictionary(*message.metadata(), context, kind, reader.get());
+  return ReadDictionary(*message.metadata(), context, kind, reader.get(),
+                        message.body());
 }
 
 }  // namespace
@@ -1307,6 +1402,18 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     return batch_with_metadata.batch;
   }
 
+  Result<std::unique_ptr<Message>> ReadRecordBatchMessage(int i) override {
+    DCHECK_GE(i, 0);
+    DCHECK_LT(i, num_record_batches());
+    return ReadMessageFromBlock(GetRecordBatchBlock(i));
+  }
+
+  Result<std::unique_ptr<Message>> ReadDictionaryMessage(int i) override {
+    DCHECK_GE(i, 0);
+    DCHECK_LT(i, num_dictionaries());
+    return ReadMessageFromBlock(GetDictionaryBlock(i));
+  }
+
   Result<RecordBatchWithMetadata> ReadRecordBatchWithCustomMetadata(int i) override {
     DCHECK_GE(i, 0);
     DCHECK_LT(i, num_record_batches());
@@ -1359,8 +1466,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
                             ReadMessageFromBlock(GetRecordBatchBlock(i)));
       auto metadata = outer_message->metadata();
       const flatbuf::Message* message = nullptr;
-      RETURN_NOT_OK(
-          internal::VerifyMessage(metadata->data(), metadata->size(), &message));
+      RETURN_NOT_OK(GetMessageRoot(*metadata, options_.validation_level, &message));
       auto batch = message->header_as_RecordBatch();
       if (batch == nullptr) {
         return Status::IOError(
@@ -1556,7 +1662,8 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
     CHECK_HAS_BODY(*message);
     ARROW_ASSIGN_OR_RAISE(auto reader, Buffer::GetReader(message->body()));
     DictionaryKind kind;
-    RETURN_NOT_OK(ReadDictionary(*message->metadata(), context, &kind, reader.get()));
+    RETURN_NOT_OK(ReadDictionary(*message->metadata(), context, &kind, reader.get(),
+                                 message->body()));
     if (kind == DictionaryKind::Replacement) {
       return Status::Invalid("Unsupported dictionary replacement in IPC file");
     } else if (kind == DictionaryKind::Delta) {
@@ -1651,8 +1758,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
       const std::shared_ptr<Message>& message) {
     const Buffer& metadata = *message->metadata();
     const flatbuf::Message* flatbuf_message = nullptr;
-    RETURN_NOT_OK(
-        internal::VerifyMessage(metadata.data(), metadata.size(), &flatbuf_message));
+    RETURN_NOT_OK(GetMessageRoot(metadata, options_.validation_level, &flatbuf_message));
     return flatbuf_message;
   }
 
@@ -1841,7 +1947,7 @@ class RecordBatchFileReaderImpl : public RecordBatchFileReader {
         });
   }
 
-  int num_dictionaries() const {
+  int num_dictionaries() const override {
     return static_cast<int>(internal::FlatBuffersVectorSize(footer_->dictionaries()));
   }
 
@@ -1905,6 +2011,40 @@ Result<std::shared_ptr<RecordBatchFileReader>> RecordBatchFileReader::Open(
   return result;
 }
 
+Result<std::shared_ptr<RecordBatchFileReader>> RecordBatchFileReader::OpenCheckpointed(
+    const std::shared_ptr<io::RandomAccessFile>& file, const IpcReadOptions& options) {
+  ARROW_ASSIGN_OR_RAISE(const int64_t file_size, file->GetSize());
+  const int64_t magic_size = static_cast<int64_t>(strlen(kArrowMagicBytes));
+  const std::string_view magic(kArrowMagicBytes, static_cast<size_t>(magic_size));
+
+  // Scan backwards in chunks for the most recent occurrence of the magic
+  // bytes that terminates a valid footer. Chunks overlap by the magic
+  // size so a candidate spanning a chunk boundary is not missed.
+  constexpr int64_t kScanChunkSize = 1 << 16;
+  int64_t chunk_end = file_size;
+  while (chunk_end >= magic_size) {
+    const int64_t chunk_start = std::max<int64_t>(0, chunk_end - kScanChunkSize);
+    const int64_t read_size =
+        std::min(file_size - chunk_start, chunk_end - chunk_start + magic_size - 1);
+    ARROW_ASSIGN_OR_RAISE(auto buffer, file->ReadAt(chunk_start, read_size));
+    const std::string_view data(reinterpret_cast<const char*>(buffer->data()),
+                                static_cast<size_t>(buffer->size()));
+    size_t pos = data.rfind(magic);
+    while (pos != std::string_view::npos) {
+      const int64_t footer_offset = chunk_start + static_cast<int64_t>(pos) + magic_size;
+      auto maybe_reader = Open(file, footer_offset, options);
+      if (maybe_reader.ok()) {
+        return maybe_reader;
+      }
+      if (pos == 0) break;
+      pos = data.rfind(magic, pos - 1);
+    }
+    if (chunk_start == 0) break;
+    chunk_end = chunk_start;
+  }
+  return Status::Invalid("File does not contain any valid Arrow file footer");
+}
+
 Future<std::shared_ptr<RecordBatchFileReader>> RecordBatchFileReader::OpenAsync(
     const std::shared_ptr<io::RandomAccessFile>& file, const IpcReadOptions& options) {
   ARROW_ASSIGN_OR_RAISE(int64_t footer_offset, file->GetSize());
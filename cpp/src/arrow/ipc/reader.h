@@ -170,12 +170,31 @@ class ARROW_EXPORT RecordBatchFileReader
       io::RandomAccessFile* file, int64_t footer_offset,
       const IpcReadOptions& options = IpcReadOptions::Defaults());
 
+  /// \brief Open a file that may contain data past its last valid footer
+  ///
+  /// Scans backwards from the end of the file for the most recent valid
+  /// footer and opens the file at that point. This recovers files whose
+  /// writer checkpointed periodically (see RecordBatchWriter::Checkpoint)
+  /// but crashed before Close, ignoring any partially written data after
+  /// the last checkpoint. For a complete Arrow file this is equivalent to
+  /// Open, just slower.
+  ///
+  /// \param[in] file the data source
+  /// \param[in] options options for IPC reading
+  /// \return the returned reader
+  static Result<std::shared_ptr<RecordBatchFileReader>> OpenCheckpointed(
+      const std::shared_ptr<io::RandomAccessFile>& file,
+      const IpcReadOptions& options = IpcReadOptions::Defaults());
+
   /// \brief The schema read from the file
   virtual std::shared_ptr<Schema> schema() const = 0;
 
   /// \brief Returns the number of record batches in the file
   virtual int num_record_batches() const = 0;
 
+  /// \brief Returns the number of dictionary messages in the file
+  virtual int num_dictionaries() const = 0;
+
   /// \brief Return the metadata version from the file metadata
   virtual MetadataVersion version() const = 0;
 
@@ -197,6 +216,23 @@ class ARROW_EXPORT RecordBatchFileReader
   /// \return a struct containing the read batch and its custom metadata
   virtual Result<RecordBatchWithMetadata> ReadRecordBatchWithCustomMetadata(int i) = 0;
 
+  /// \brief Read the raw IPC message for a particular record batch.
+  ///
+  /// The message is returned as stored in the file, without decoding it
+  /// to a RecordBatch. Does not copy memory if the input source supports
+  /// zero-copy. Useful for relaying stored IPC data without
+  /// re-serializing it.
+  ///
+  /// \param[in] i the index of the record batch message to return
+  /// \return the read message
+  virtual Result<std::unique_ptr<Message>> ReadRecordBatchMessage(int i) = 0;
+
+  /// \brief Read the raw IPC message for a particular dictionary batch.
+  ///
+  /// \param[in] i the index of the dictionary message to return
+  /// \return the read message
+  virtual Result<std::unique_ptr<Message>> ReadDictionaryMessage(int i) = 0;
+
   /// \brief Return current read statistics
   virtual ReadStats stats() const = 0;
 
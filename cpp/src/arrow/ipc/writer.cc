@@ -235,12 +235,29 @@ class RecordBatchSerializer {
     return Status::OK();
   }
 
+  Status PrefixWithUncompressedMarker(const Buffer& buffer,
+                                      std::shared_ptr<Buffer>* out) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto result, AllocateBuffer(buffer.size() + sizeof(int64_t),
+                                    options_.memory_pool));
+    // Size of -1 indicates to the reader that the body doesn't need to be decompressed
+    util::SafeStore(result->mutable_data(), bit_util::ToLittleEndian<int64_t>(-1));
+    std::memcpy(result->mutable_data() + sizeof(int64_t), buffer.data(),
+                static_cast<size_t>(buffer.size()));
+    *out = std::move(result);
+    return Status::OK();
+  }
+
   Status CompressBodyBuffers() {
     RETURN_NOT_OK(
         internal::CheckCompressionSupported(options_.codec->compression_type()));
 
     auto CompressOne = [&](size_t i) {
       if (out_->body_buffers[i]->size() > 0) {
+        if (i < skip_compression_.size() && skip_compression_[i]) {
+          return PrefixWithUncompressedMarker(*out_->body_buffers[i],
+                                              &out_->body_buffers[i]);
+        }
         RETURN_NOT_OK(CompressBuffer(*out_->body_buffers[i], options_.codec.get(),
                                      &out_->body_buffers[i]));
       }
@@ -256,11 +273,22 @@ class RecordBatchSerializer {
       field_nodes_.clear();
       buffer_meta_.clear();
       out_->body_buffers.clear();
+      skip_compression_.clear();
     }
 
+    const bool track_uncompressed_columns =
+        options_.codec != nullptr && !options_.uncompressed_columns.empty();
+
     // Perform depth-first traversal of the row-batch
     for (int i = 0; i < batch.num_columns(); ++i) {
       RETURN_NOT_OK(VisitArray(*batch.column(i)));
+      if (track_uncompressed_columns) {
+        // Mark the buffers this column contributed (including those of
+        // nested children) so CompressBodyBuffers can leave them raw
+        const bool skip =
+            options_.uncompressed_columns.count(batch.schema()->field(i)->name()) > 0;
+        skip_compression_.resize(out_->body_buffers.size(), skip);
+      }
     }
 
     // calculate initial body length using all buffer sizes
@@ -718,6 +746,10 @@ class RecordBatchSerializer {
   std::vector<internal::BufferMetadata> buffer_meta_;
   std::vector<int64_t> variadic_counts_;
 
+  // Per-body-buffer flags for columns opted out of compression via
+  // IpcWriteOptions::uncompressed_columns; empty when unused
+  std::vector<bool> skip_compression_;
+
   const IpcWriteOptions& options_;
   int64_t max_recursion_depth_;
   int64_t buffer_start_offset_;
@@ -759,7 +791,13 @@ Status WriteIpcPayload(const IpcPayload& payload, const IpcWriteOptions& options
   RETURN_NOT_OK(CheckAligned(dst));
 #endif
 
-  // Now write the buffers
+  // Now gather the body buffers (with their padding) and hand them to the
+  // sink in one call; streams backed by an OS descriptor submit them with a
+  // single vectored write instead of one write per buffer.
+  static const auto kPaddingBuffer =
+      std::make_shared<Buffer>(kPaddingBytes, sizeof(kPaddingBytes));
+  std::vector<std::shared_ptr<Buffer>> body;
+  body.reserve(payload.body_buffers.size());
   for (size_t i = 0; i < payload.body_buffers.size(); ++i) {
     const std::shared_ptr<Buffer>& buffer = payload.body_buffers[i];
     int64_t size = 0;
@@ -772,13 +810,14 @@ Status WriteIpcPayload(const IpcPayload& payload, const IpcWriteOptions& options
     }
 
     if (size > 0) {
-      RETURN_NOT_OK(dst->Write(buffer));
+      body.push_back(buffer);
     }
 
     if (padding > 0) {
-      RETURN_NOT_OK(dst->Write(kPaddingBytes, padding));
+      body.push_back(SliceBuffer(kPaddingBuffer, 0, padding));
     }
   }
+  RETURN_NOT_OK(dst->WriteV(body));
 
 #ifndef NDEBUG
   RETURN_NOT_OK(CheckAligned(dst));
@@ -1161,6 +1200,10 @@ Status RecordBatchWriter::WriteTable(const Table& table, int64_t max_chunksize)
 
 Status RecordBatchWriter::WriteTable(const Table& table) { return WriteTable(table, -1); }
 
+Status RecordBatchWriter::Checkpoint() {
+  return Status::NotImplemented("Checkpoint() is not supported by this writer");
+}
+
 // ----------------------------------------------------------------------
 // Payload writer implementation
 
@@ -1170,6 +1213,10 @@ IpcPayloadWriter::~IpcPayloadWriter() = default;
 
 Status IpcPayloadWriter::Start() { return Status::OK(); }
 
+Status IpcPayloadWriter::Checkpoint() {
+  return Status::NotImplemented("Checkpoint() is not supported by this payload writer");
+}
+
 class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
  public:
   // A RecordBatchWriter implementation that writes to a IpcPayloadWriter.
@@ -1236,6 +1283,14 @@ class ARROW_EXPORT IpcFormatWriter : public RecordBatchWriter {
     return Status::OK();
   }
 
+  Status Checkpoint() override {
+    if (closed_) {
+      return Status::Invalid("Destination already closed");
+    }
+    RETURN_NOT_OK(CheckStarted());
+    return payload_writer_->Checkpoint();
+  }
+
   Status Start() {
     started_ = true;
     RETURN_NOT_OK(payload_writer_->Start());
@@ -1489,6 +1544,25 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
     // Write 0 EOS message for compatibility with sequential readers
     RETURN_NOT_OK(WriteEOS());
 
+    return WriteFooterAndMagic();
+  }
+
+  Status Checkpoint() override {
+    // Write a valid footer covering all blocks so far, so the file is
+    // readable up to this point even if the writer never reaches Close.
+    // A later footer supersedes this one; readers opening the complete
+    // file never look at the checkpointed bytes.
+    RETURN_NOT_OK(WriteEOS());
+    RETURN_NOT_OK(WriteFooterAndMagic());
+    RETURN_NOT_OK(sink_->Flush());
+
+    // Realign so the next message starts on an 8-byte boundary
+    RETURN_NOT_OK(UpdatePosition());
+    return Align();
+  }
+
+ protected:
+  Status WriteFooterAndMagic() {
     // Write file footer
     RETURN_NOT_OK(UpdatePosition());
     int64_t initial_position = position_;
@@ -1509,8 +1583,6 @@ class PayloadFileWriter : public internal::IpcPayloadWriter, protected StreamBoo
     // Write magic bytes to end file
     return Write(kArrowMagicBytes, strlen(kArrowMagicBytes));
   }
-
- protected:
   std::shared_ptr<Schema> schema_;
   std::shared_ptr<const KeyValueMetadata> metadata_;
   std::vector<FileBlock> dictionaries_;
@@ -123,6 +123,21 @@ class ARROW_EXPORT RecordBatchWriter {
   /// \return Status
   virtual Status Close() = 0;
 
+  /// \brief Write a recovery checkpoint, if supported by the format
+  ///
+  /// For the IPC file format, writes a valid footer covering all record
+  /// batches written so far without closing the file, then continues
+  /// appending after it. If the writer crashes before Close, readers can
+  /// recover everything up to the last checkpoint with
+  /// RecordBatchFileReader::OpenCheckpointed. A file closed normally
+  /// after checkpointing remains a regular Arrow file; the superseded
+  /// footers are simply ignored.
+  ///
+  /// The default implementation returns NotImplemented.
+  ///
+  /// \return Status
+  virtual Status Checkpoint();
+
   /// \brief Return current write statistics
   virtual WriteStats stats() const = 0;
 };
@@ -431,6 +446,10 @@ class ARROW_EXPORT IpcPayloadWriter {
   virtual Status WritePayload(const IpcPayload& payload) = 0;
 
   virtual Status Close() = 0;
+
+  // Write a recovery checkpoint, if supported; the default
+  // implementation returns NotImplemented
+  virtual Status Checkpoint();
 };
 
 /// Create a new IPC payload stream writer from stream sink. User is
@@ -26,6 +26,7 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/json/converter.h"
+#include "arrow/json/options.h"
 #include "arrow/table.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging_internal.h"
@@ -42,7 +43,7 @@ namespace {
 Status MakeChunkedArrayBuilder(const std::shared_ptr<TaskGroup>& task_group,
                                MemoryPool* pool, const PromotionGraph* promotion_graph,
                                const std::shared_ptr<DataType>& type,
-                               bool allow_promotion,
+                               int32_t max_dict_cardinality, bool allow_promotion,
                                std::shared_ptr<ChunkedArrayBuilder>* out);
 
 class NonNestedChunkedArrayBuilder : public ChunkedArrayBuilder {
@@ -102,9 +103,11 @@ class InferringChunkedArrayBuilder
  public:
   InferringChunkedArrayBuilder(const std::shared_ptr<TaskGroup>& task_group,
                                const PromotionGraph* promotion_graph,
+                               int32_t max_dict_cardinality,
                                std::shared_ptr<Converter> converter)
       : NonNestedChunkedArrayBuilder(task_group, std::move(converter)),
-        promotion_graph_(promotion_graph) {}
+        promotion_graph_(promotion_graph),
+        max_dict_cardinality_(max_dict_cardinality) {}
 
   void Insert(int64_t block_index, const std::shared_ptr<Field>& unconverted_field,
               const std::shared_ptr<Array>& unconverted) override {
@@ -157,7 +160,8 @@ class InferringChunkedArrayBuilder
       // converter failed, no promotion available
       return st;
     }
-    RETURN_NOT_OK(MakeConverter(promoted_type, converter_->pool(), &converter_));
+    RETURN_NOT_OK(MakeConverter(promoted_type, converter_->pool(), max_dict_cardinality_,
+                                &converter_));
 
     size_t nchunks = chunks_.size();
     for (size_t i = 0; i < nchunks; ++i) {
@@ -185,6 +189,7 @@ class InferringChunkedArrayBuilder
   ArrayVector unconverted_;
   std::vector<std::shared_ptr<Field>> unconverted_fields_;
   const PromotionGraph* promotion_graph_;
+  int32_t max_dict_cardinality_;
 };
 
 class ChunkedListArrayBuilder : public ChunkedArrayBuilder {
@@ -277,10 +282,13 @@ class ChunkedStructArrayBuilder : public ChunkedArrayBuilder {
  public:
   ChunkedStructArrayBuilder(
       const std::shared_ptr<TaskGroup>& task_group, MemoryPool* pool,
-      const PromotionGraph* promotion_graph,
+      const PromotionGraph* promotion_graph, int32_t max_dict_cardinality,
       std::vector<std::pair<std::string, std::shared_ptr<ChunkedArrayBuilder>>>
           name_builders)
-      : ChunkedArrayBuilder(task_group), pool_(pool), promotion_graph_(promotion_graph) {
+      : ChunkedArrayBuilder(task_group),
+        pool_(pool),
+        promotion_graph_(promotion_graph),
+        max_dict_cardinality_(max_dict_cardinality) {
     for (auto&& name_builder : name_builders) {
       auto index = static_cast<int>(name_to_index_.size());
       name_to_index_.emplace(std::move(name_builder.first), index);
@@ -411,6 +419,7 @@ class ChunkedStructArrayBuilder : public ChunkedArrayBuilder {
 
         std::shared_ptr<ChunkedArrayBuilder> child_builder;
         RETURN_NOT_OK(MakeChunkedArrayBuilder(task_group_, pool_, promotion_graph_, type,
+                                              max_dict_cardinality_,
                                               /*allow_promotion=*/true, &child_builder));
         child_builders_.emplace_back(std::move(child_builder));
       }
@@ -429,6 +438,7 @@ class ChunkedStructArrayBuilder : public ChunkedArrayBuilder {
   std::mutex mutex_;
   MemoryPool* pool_;
   const PromotionGraph* promotion_graph_;
+  int32_t max_dict_cardinality_;
   std::unordered_map<std::string, int> name_to_index_;
   std::vector<std::shared_ptr<ChunkedArrayBuilder>> child_builders_;
   std::vector<std::vector<bool>> child_absent_;
@@ -439,7 +449,7 @@ class ChunkedStructArrayBuilder : public ChunkedArrayBuilder {
 Status MakeChunkedArrayBuilder(const std::shared_ptr<TaskGroup>& task_group,
                                MemoryPool* pool, const PromotionGraph* promotion_graph,
                                const std::shared_ptr<DataType>& type,
-                               bool allow_promotion,
+                               int32_t max_dict_cardinality, bool allow_promotion,
                                std::shared_ptr<ChunkedArrayBuilder>* out) {
   // If a promotion graph is provided, unexpected fields will be allowed - using the graph
   // recursively for itself and any child fields (via the `allow_promotion` parameter).
@@ -455,10 +465,12 @@ Status MakeChunkedArrayBuilder(const std::shared_ptr<TaskGroup>& task_group,
     for (const auto& f : type->fields()) {
       std::shared_ptr<ChunkedArrayBuilder> child_builder;
       RETURN_NOT_OK(MakeChunkedArrayBuilder(task_group, pool, promotion_graph, f->type(),
-                                            allow_promotion, &child_builder));
+                                            max_dict_cardinality, allow_promotion,
+                                            &child_builder));
       child_builders.emplace_back(f->name(), std::move(child_builder));
     }
     *out = std::make_shared<ChunkedStructArrayBuilder>(task_group, pool, promotion_graph,
+                                                       max_dict_cardinality,
                                                        std::move(child_builders));
     return Status::OK();
   }
@@ -466,8 +478,8 @@ Status MakeChunkedArrayBuilder(const std::shared_ptr<TaskGroup>& task_group,
     const auto& list_type = checked_cast<const ListType&>(*type);
     std::shared_ptr<ChunkedArrayBuilder> value_builder;
     RETURN_NOT_OK(MakeChunkedArrayBuilder(task_group, pool, promotion_graph,
-                                          list_type.value_type(), allow_promotion,
-                                          &value_builder));
+                                          list_type.value_type(), max_dict_cardinality,
+                                          allow_promotion, &value_builder));
     *out = std::make_shared<ChunkedListArrayBuilder>(
         task_group, pool, std::move(value_builder), list_type.value_field());
     return Status::OK();
@@ -475,10 +487,10 @@ Status MakeChunkedArrayBuilder(const std::shared_ptr<TaskGroup>& task_group,
 
   // Construct the "leaf" builder
   std::shared_ptr<Converter> converter;
-  RETURN_NOT_OK(MakeConverter(type, pool, &converter));
+  RETURN_NOT_OK(MakeConverter(type, pool, max_dict_cardinality, &converter));
   if (allow_promotion && promotion_graph) {
-    *out = std::make_shared<InferringChunkedArrayBuilder>(task_group, promotion_graph,
-                                                          std::move(converter));
+    *out = std::make_shared<InferringChunkedArrayBuilder>(
+        task_group, promotion_graph, max_dict_cardinality, std::move(converter));
   } else {
     *out = std::make_shared<TypedChunkedArrayBuilder>(task_group, std::move(converter));
   }
@@ -495,6 +507,16 @@ Status MakeChunkedArrayBuilder(const std::shared_ptr<TaskGroup>& task_group,
                                const std::shared_ptr<DataType>& type,
                                std::shared_ptr<ChunkedArrayBuilder>* out) {
   return MakeChunkedArrayBuilder(task_group, pool, promotion_graph, type,
+                                 ParseOptions::Defaults().auto_dict_max_cardinality, out);
+}
+
+Status MakeChunkedArrayBuilder(const std::shared_ptr<TaskGroup>& task_group,
+                               MemoryPool* pool, const PromotionGraph* promotion_graph,
+                               const std::shared_ptr<DataType>& type,
+                               int32_t max_dict_cardinality,
+                               std::shared_ptr<ChunkedArrayBuilder>* out) {
+  return MakeChunkedArrayBuilder(task_group, pool, promotion_graph, type,
+                                 max_dict_cardinality,
                                  /*allow_promotion=*/false, out);
 }
 
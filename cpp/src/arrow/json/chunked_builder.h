@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -64,5 +65,14 @@ ARROW_EXPORT Status MakeChunkedArrayBuilder(
     const PromotionGraph* promotion_graph, const std::shared_ptr<DataType>& type,
     std::shared_ptr<ChunkedArrayBuilder>* out);
 
+/// create a chunked builder
+///
+/// like the above, but conversion to dictionary-encoded strings fails (and may
+/// be promoted to dense strings) above max_dict_cardinality unique values
+ARROW_EXPORT Status MakeChunkedArrayBuilder(
+    const std::shared_ptr<arrow::internal::TaskGroup>& task_group, MemoryPool* pool,
+    const PromotionGraph* promotion_graph, const std::shared_ptr<DataType>& type,
+    int32_t max_dict_cardinality, std::shared_ptr<ChunkedArrayBuilder>* out);
+
 }  // namespace json
 }  // namespace arrow
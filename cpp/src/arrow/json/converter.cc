@@ -24,8 +24,10 @@
 #include "arrow/array.h"
 #include "arrow/array/builder_binary.h"
 #include "arrow/array/builder_decimal.h"
+#include "arrow/array/builder_dict.h"
 #include "arrow/array/builder_primitive.h"
 #include "arrow/array/builder_time.h"
+#include "arrow/json/options.h"
 #include "arrow/json/parser.h"
 #include "arrow/type.h"
 #include "arrow/util/checked_cast.h"
@@ -276,8 +278,50 @@ class BinaryConverter : public PrimitiveConverter {
   }
 };
 
+// converts to dictionary-encoded strings, failing (so that the converter may be
+// promoted to dense strings) when an array's cardinality exceeds max_cardinality
+class DictionaryConverter : public PrimitiveConverter {
+ public:
+  DictionaryConverter(MemoryPool* pool, const std::shared_ptr<DataType>& type,
+                      int32_t max_cardinality)
+      : PrimitiveConverter(pool, type), max_cardinality_(max_cardinality) {}
+
+  Status Convert(const std::shared_ptr<Array>& in, std::shared_ptr<Array>* out) override {
+    if (in->type_id() == Type::NA) {
+      return MakeArrayOfNull(out_type_, in->length(), pool_).Value(out);
+    }
+    const auto& dict_array = GetDictionaryArray(in);
+
+    StringDictionary32Builder builder(pool_);
+    RETURN_NOT_OK(builder.Resize(dict_array.indices()->length()));
+
+    auto visit_valid = [&](string_view value) {
+      RETURN_NOT_OK(builder.Append(value));
+      if (ARROW_PREDICT_FALSE(builder.dictionary_length() > max_cardinality_)) {
+        return GenericConversionError(*out_type_, ", cardinality exceeded ",
+                                      max_cardinality_);
+      }
+      return Status::OK();
+    };
+
+    auto visit_null = [&]() { return builder.AppendNull(); };
+
+    RETURN_NOT_OK(VisitDictionaryEntries(dict_array, visit_valid, visit_null));
+    return builder.Finish(out);
+  }
+
+ private:
+  int32_t max_cardinality_;
+};
+
 Status MakeConverter(const std::shared_ptr<DataType>& out_type, MemoryPool* pool,
                      std::shared_ptr<Converter>* out) {
+  return MakeConverter(out_type, pool,
+                       ParseOptions::Defaults().auto_dict_max_cardinality, out);
+}
+
+Status MakeConverter(const std::shared_ptr<DataType>& out_type, MemoryPool* pool,
+                     int32_t max_dict_cardinality, std::shared_ptr<Converter>* out) {
   switch (out_type->id()) {
 #define CONVERTER_CASE(TYPE_ID, CONVERTER_TYPE)              \
   case TYPE_ID:                                              \
@@ -310,6 +354,16 @@ Status MakeConverter(const std::shared_ptr<DataType>& out_type, MemoryPool* pool
     CONVERTER_CASE(Type::DECIMAL64, DecimalConverter<Decimal64Type>);
     CONVERTER_CASE(Type::DECIMAL128, DecimalConverter<Decimal128Type>);
     CONVERTER_CASE(Type::DECIMAL256, DecimalConverter<Decimal256Type>);
+    case Type::DICTIONARY: {
+      const auto& dict_type = checked_cast<const DictionaryType&>(*out_type);
+      if (dict_type.index_type()->id() != Type::INT32 ||
+          dict_type.value_type()->id() != Type::STRING) {
+        return Status::NotImplemented("JSON conversion to ", *out_type,
+                                      " is not supported");
+      }
+      *out = std::make_shared<DictionaryConverter>(pool, out_type, max_dict_cardinality);
+      break;
+    }
     default:
       return Status::NotImplemented("JSON conversion to ", *out_type,
                                     " is not supported");
@@ -318,64 +372,93 @@ Status MakeConverter(const std::shared_ptr<DataType>& out_type, MemoryPool* pool
   return Status::OK();
 }
 
-const PromotionGraph* GetPromotionGraph() {
-  static struct : PromotionGraph {
-    std::shared_ptr<Field> Null(const std::string& name) const override {
-      return field(name, null(), true, Kind::Tag(Kind::kNull));
-    }
+namespace {
 
-    std::shared_ptr<DataType> Infer(
-        const std::shared_ptr<Field>& unexpected_field) const override {
-      auto kind = Kind::FromTag(unexpected_field->metadata());
-      switch (kind) {
-        case Kind::kNull:
-          return null();
+struct DefaultPromotionGraph : PromotionGraph {
+  std::shared_ptr<Field> Null(const std::string& name) const override {
+    return field(name, null(), true, Kind::Tag(Kind::kNull));
+  }
 
-        case Kind::kBoolean:
-          return boolean();
+  std::shared_ptr<DataType> Infer(
+      const std::shared_ptr<Field>& unexpected_field) const override {
+    auto kind = Kind::FromTag(unexpected_field->metadata());
+    switch (kind) {
+      case Kind::kNull:
+        return null();
 
-        case Kind::kNumber:
-          return int64();
+      case Kind::kBoolean:
+        return boolean();
 
-        case Kind::kString:
-          return timestamp(TimeUnit::SECOND);
+      case Kind::kNumber:
+        return int64();
 
-        case Kind::kArray: {
-          const auto& type = checked_cast<const ListType&>(*unexpected_field->type());
-          auto value_field = type.value_field();
-          return list(value_field->WithType(Infer(value_field)));
-        }
-        case Kind::kObject: {
-          auto fields = unexpected_field->type()->fields();
-          for (auto& field : fields) {
-            field = field->WithType(Infer(field));
-          }
-          return struct_(std::move(fields));
+      case Kind::kString:
+        return timestamp(TimeUnit::SECOND);
+
+      case Kind::kArray: {
+        const auto& type = checked_cast<const ListType&>(*unexpected_field->type());
+        auto value_field = type.value_field();
+        return list(value_field->WithType(Infer(value_field)));
+      }
+      case Kind::kObject: {
+        auto fields = unexpected_field->type()->fields();
+        for (auto& field : fields) {
+          field = field->WithType(Infer(field));
         }
-        default:
-          return nullptr;
+        return struct_(std::move(fields));
       }
+      default:
+        return nullptr;
     }
+  }
 
-    std::shared_ptr<DataType> Promote(
-        const std::shared_ptr<DataType>& failed,
-        const std::shared_ptr<Field>& unexpected_field) const override {
-      switch (failed->id()) {
-        case Type::NA:
-          return Infer(unexpected_field);
+  std::shared_ptr<DataType> Promote(
+      const std::shared_ptr<DataType>& failed,
+      const std::shared_ptr<Field>& unexpected_field) const override {
+    switch (failed->id()) {
+      case Type::NA:
+        return Infer(unexpected_field);
 
-        case Type::TIMESTAMP:
-          return utf8();
+      case Type::TIMESTAMP:
+        return utf8();
 
-        case Type::INT64:
-          return float64();
+      case Type::INT64:
+        return float64();
 
-        default:
-          return nullptr;
-      }
+      default:
+        return nullptr;
     }
-  } impl;
+  }
+};
+
+// like the default graph, but string fields which fail to convert to timestamp
+// are dictionary-encoded before falling back to dense strings
+struct DictionaryPromotionGraph : DefaultPromotionGraph {
+  std::shared_ptr<DataType> Promote(
+      const std::shared_ptr<DataType>& failed,
+      const std::shared_ptr<Field>& unexpected_field) const override {
+    switch (failed->id()) {
+      case Type::TIMESTAMP:
+        return dictionary(int32(), utf8());
+
+      case Type::DICTIONARY:
+        return utf8();
+
+      default:
+        return DefaultPromotionGraph::Promote(failed, unexpected_field);
+    }
+  }
+};
+
+}  // namespace
+
+const PromotionGraph* GetPromotionGraph() {
+  static DefaultPromotionGraph impl;
+  return &impl;
+}
 
+const PromotionGraph* GetDictionaryPromotionGraph() {
+  static DictionaryPromotionGraph impl;
   return &impl;
 }
 
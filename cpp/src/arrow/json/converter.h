@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 
@@ -65,6 +66,15 @@ class ARROW_EXPORT Converter {
 ARROW_EXPORT Status MakeConverter(const std::shared_ptr<DataType>& out_type,
                                   MemoryPool* pool, std::shared_ptr<Converter>* out);
 
+/// \brief produce a single converter to the specified out_type
+///
+/// max_dict_cardinality bounds conversion to dictionary-encoded strings: if an
+/// array holds more unique values than this, conversion fails (and the
+/// converter may be promoted to one producing dense strings).
+ARROW_EXPORT Status MakeConverter(const std::shared_ptr<DataType>& out_type,
+                                  MemoryPool* pool, int32_t max_dict_cardinality,
+                                  std::shared_ptr<Converter>* out);
+
 class ARROW_EXPORT PromotionGraph {
  public:
   virtual ~PromotionGraph() = default;
@@ -90,5 +100,12 @@ class ARROW_EXPORT PromotionGraph {
 
 ARROW_EXPORT const PromotionGraph* GetPromotionGraph();
 
+/// \brief variant of GetPromotionGraph which dictionary-encodes inferred strings
+///
+/// Inferred string fields are converted to dictionary(int32(), utf8()) and only
+/// promoted to dense utf8 if conversion to dictionary fails, for example because
+/// an array's cardinality exceeds ParseOptions::auto_dict_max_cardinality.
+ARROW_EXPORT const PromotionGraph* GetDictionaryPromotionGraph();
+
 }  // namespace json
 }  // namespace arrow
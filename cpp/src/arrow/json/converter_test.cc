@@ -159,6 +159,59 @@ TEST(ConverterTest, StringAndLargeStringAndStringView) {
   }
 }
 
+TEST(ConverterTest, DictionaryString) {
+  auto dict_type = dictionary(int32(), utf8());
+
+  ParseOptions options;
+  options.explicit_schema = schema({field("", dict_type)});
+
+  std::string json_source = R"(
+    {"" : "a"}
+    {"" : "b c"}
+    {"" : null}
+    {"" : "a"}
+    {"" : "b c"}
+  )";
+
+  std::shared_ptr<StructArray> parse_array;
+  ASSERT_OK(ParseFromString(options, json_source, &parse_array));
+
+  // call to convert
+  ASSERT_OK_AND_ASSIGN(auto converted,
+                       Convert(dict_type, parse_array->GetFieldByName("")));
+
+  // assert equality
+  auto expected =
+      DictArrayFromJSON(dict_type, R"([0, 1, null, 0, 1])", R"(["a", "b c"])");
+
+  AssertArraysEqual(*expected, *converted);
+}
+
+TEST(ConverterTest, DictionaryStringCardinalityExceeded) {
+  auto dict_type = dictionary(int32(), utf8());
+
+  ParseOptions options;
+  options.explicit_schema = schema({field("", dict_type)});
+
+  std::string json_source = R"(
+    {"" : "a"}
+    {"" : "b"}
+    {"" : "c"}
+  )";
+
+  std::shared_ptr<StructArray> parse_array;
+  ASSERT_OK(ParseFromString(options, json_source, &parse_array));
+
+  std::shared_ptr<Converter> converter;
+  ASSERT_OK(MakeConverter(dict_type, default_memory_pool(), /*max_dict_cardinality=*/2,
+                          &converter));
+
+  std::shared_ptr<Array> converted;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(
+      Invalid, ::testing::HasSubstr("cardinality exceeded 2"),
+      converter->Convert(parse_array->GetFieldByName(""), &converted));
+}
+
 TEST(ConverterTest, Timestamp) {
   auto timestamp_type = timestamp(TimeUnit::SECOND);
 
@@ -53,6 +53,18 @@ struct ARROW_EXPORT ParseOptions {
   /// How JSON fields outside of explicit_schema (if given) are treated
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  /// Whether to try to dictionary-encode inferred string fields
+  ///
+  /// If enabled, fields inferred as strings (including leaf fields of nested
+  /// objects) are converted to dictionary(int32(), utf8()).  A field is
+  /// promoted to dense utf8 if any chunk's cardinality exceeds
+  /// auto_dict_max_cardinality.  This setting is ignored for fields covered
+  /// by explicit_schema; request a dictionary type there instead.
+  bool auto_dict_encode = false;
+
+  /// Maximum dictionary cardinality for auto_dict_encode (per chunk)
+  int32_t auto_dict_max_cardinality = 50;
+
   /// Create parsing options with default values
   static ParseOptions Defaults();
 };
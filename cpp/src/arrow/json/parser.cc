@@ -17,11 +17,13 @@
 
 #include "arrow/json/parser.h"
 
+#include <cstring>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <string_view>
 #include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -33,6 +35,7 @@
 
 #include "arrow/array.h"
 #include "arrow/array/builder_binary.h"
+#include "arrow/buffer.h"
 #include "arrow/buffer_builder.h"
 #include "arrow/type.h"
 #include "arrow/util/bitset_stack.h"
@@ -351,6 +354,12 @@ class RawArrayBuilder<Kind::kObject> {
   Status AppendNull(int64_t count) { return null_bitmap_builder_.Append(count, false); }
 
   int FindFieldIndex(std::string_view name) const {
+    // Cheaply reject keys which cannot match any known field before hashing
+    // their bytes; with a sparse explicit schema and unexpected fields
+    // ignored, most incoming keys are misses.
+    if (ARROW_PREDICT_FALSE(!MayMatchField(name))) {
+      return -1;
+    }
     auto it = name_to_index_.find(name);
     return it != name_to_index_.end() ? it->second : -1;
   }
@@ -392,6 +401,13 @@ class RawArrayBuilder<Kind::kObject> {
       index = num_fields();
       field_infos_.push_back(FieldInfo{name, builder});
       name_to_index_.emplace(name, index);
+      if (name.empty()) {
+        empty_name_field_ = true;
+      } else {
+        const auto first = static_cast<uint8_t>(name.front());
+        first_byte_filter_[first >> 6] |= uint64_t(1) << (first & 63);
+        name_length_filter_ |= uint64_t(1) << LengthBit(name.size());
+      }
     }
 
     return index;
@@ -438,10 +454,26 @@ class RawArrayBuilder<Kind::kObject> {
     BuilderPtr builder;
   };
 
+  static size_t LengthBit(size_t length) { return length < 63 ? length : 63; }
+
+  // An exact-negative filter over the first bytes and the lengths of all
+  // known field names: if either test fails, `name` is not a field.
+  bool MayMatchField(std::string_view name) const {
+    if (ARROW_PREDICT_FALSE(name.empty())) {
+      return empty_name_field_;
+    }
+    const auto first = static_cast<uint8_t>(name.front());
+    return ((first_byte_filter_[first >> 6] >> (first & 63)) & 1) != 0 &&
+           ((name_length_filter_ >> LengthBit(name.size())) & 1) != 0;
+  }
+
   BuildContext* context_;
 
   std::vector<FieldInfo> field_infos_;
   std::unordered_map<std::string_view, int> name_to_index_;
+  uint64_t first_byte_filter_[4] = {0, 0, 0, 0};
+  uint64_t name_length_filter_ = 0;
+  bool empty_name_field_ = false;
 
   TypedBufferBuilder<bool> null_bitmap_builder_;
 
@@ -764,9 +796,12 @@ class HandlerBase : public BlockParser,
  protected:
   template <typename Handler, typename Stream>
   Status DoParse(Handler& handler, Stream&& json, size_t json_size) {
-    constexpr auto parse_flags = rj::kParseIterativeFlag | rj::kParseNanAndInfFlag |
-                                 rj::kParseStopWhenDoneFlag |
-                                 rj::kParseNumbersAsStringsFlag;
+    constexpr unsigned parse_flags =
+        rj::kParseIterativeFlag | rj::kParseNanAndInfFlag | rj::kParseStopWhenDoneFlag |
+        rj::kParseNumbersAsStringsFlag |
+        (std::is_same<std::decay_t<Stream>, rj::InsituStringStream>::value
+             ? rj::kParseInsituFlag
+             : 0u);
 
     rj::Reader reader;
     // ensure that the loop can exit when the block too large.
@@ -796,9 +831,24 @@ class HandlerBase : public BlockParser,
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
-    rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
-    using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
-    return DoParse(handler, InputStream(ms), static_cast<size_t>(json->size()));
+    // Parse in situ from a null-terminated scratch copy of the block:
+    // scalar strings and object keys without escapes are then handed to the
+    // handler straight out of the buffer instead of being unescaped into the
+    // reader's internal stack first, and rapidjson's SIMD whitespace
+    // skipping applies.  The single memcpy is far cheaper than a copy per
+    // string value.
+    ARROW_ASSIGN_OR_RAISE(auto scratch, AllocateBuffer(json->size() + 1, pool_));
+    memcpy(scratch->mutable_data(), json->data(), static_cast<size_t>(json->size()));
+    scratch->mutable_data()[json->size()] = '\0';
+    char* data = reinterpret_cast<char*>(scratch->mutable_data());
+    auto size = static_cast<size_t>(json->size());
+    // EncodedInputStream previously skipped any UTF-8 byte order mark for us
+    if (size >= 3 && memcmp(data, "\xEF\xBB\xBF", 3) == 0) {
+      data += 3;
+      size -= 3;
+    }
+    rj::InsituStringStream ss(data);
+    return DoParse(handler, ss, size);
   }
 
   /// \defgroup handlerbase-append-methods append non-nested values
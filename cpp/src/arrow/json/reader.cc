@@ -101,7 +101,8 @@ class DecodeContext {
     }
     promotion_graph_ =
         parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
-            ? GetPromotionGraph()
+            ? (parse_options_.auto_dict_encode ? GetDictionaryPromotionGraph()
+                                               : GetPromotionGraph())
             : nullptr;
   }
 
@@ -278,9 +279,10 @@ class TableReaderImpl : public TableReader,
 
  private:
   Status MakeBuilder() {
-    return MakeChunkedArrayBuilder(task_group_, decode_context_.pool(),
-                                   decode_context_.promotion_graph(),
-                                   decode_context_.conversion_type(), &builder_);
+    return MakeChunkedArrayBuilder(
+        task_group_, decode_context_.pool(), decode_context_.promotion_graph(),
+        decode_context_.conversion_type(),
+        decode_context_.parse_options().auto_dict_max_cardinality, &builder_);
   }
 
   Status ParseAndInsert(const ChunkedBlock& block) {
@@ -310,9 +312,10 @@ class DecodingOperator {
                                                        context_->pool(), &num_bytes));
 
     std::shared_ptr<ChunkedArrayBuilder> builder;
-    RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), context_->pool(),
-                                          context_->promotion_graph(),
-                                          context_->conversion_type(), &builder));
+    RETURN_NOT_OK(MakeChunkedArrayBuilder(
+        TaskGroup::MakeSerial(), context_->pool(), context_->promotion_graph(),
+        context_->conversion_type(),
+        context_->parse_options().auto_dict_max_cardinality, &builder));
     builder->Insert(0, field("", unconverted->type()), unconverted);
 
     std::shared_ptr<ChunkedArray> chunked;
@@ -545,9 +548,10 @@ Result<std::shared_ptr<RecordBatch>> ParseOne(ParseOptions options,
   RETURN_NOT_OK(parser->Finish(&parsed));
 
   std::shared_ptr<ChunkedArrayBuilder> builder;
-  RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), context.pool(),
-                                        context.promotion_graph(),
-                                        context.conversion_type(), &builder));
+  RETURN_NOT_OK(MakeChunkedArrayBuilder(
+      TaskGroup::MakeSerial(), context.pool(), context.promotion_graph(),
+      context.conversion_type(), context.parse_options().auto_dict_max_cardinality,
+      &builder));
 
   builder->Insert(0, field("", context.conversion_type()), parsed);
   std::shared_ptr<ChunkedArray> converted_chunked;
@@ -125,6 +125,38 @@ TEST_P(ReaderTest, Basics) {
   AssertTablesEqual(*expected_table, *table_);
 }
 
+TEST_P(ReaderTest, BasicsAutoDictEncode) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  parse_options_.auto_dict_encode = true;
+  auto src = scalars_only_src();
+  SetUpReader(src);
+  ASSERT_OK_AND_ASSIGN(table_, reader_->Read());
+
+  auto schema = ::arrow::schema({field("hello", float64()), field("world", boolean()),
+                                 field("yo", dictionary(int32(), utf8()))});
+
+  auto expected_table = Table::Make(
+      schema, {
+                  ArrayFromJSON(schema->field(0)->type(), "[3.5, 3.25, 3.125, 0.0]"),
+                  ArrayFromJSON(schema->field(1)->type(), "[false, null, null, true]"),
+                  DictArrayFromJSON(schema->field(2)->type(), "[0, null, 1, null]",
+                                    "[\"thing\", \"\xe5\xbf\x8d\"]"),
+              });
+  AssertTablesEqual(*expected_table, *table_);
+}
+
+TEST_P(ReaderTest, AutoDictEncodeMaxCardinality) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  parse_options_.auto_dict_encode = true;
+  parse_options_.auto_dict_max_cardinality = 2;
+  SetUpReader("{\"yo\": \"a\"}\n{\"yo\": \"b\"}\n{\"yo\": \"c\"}\n");
+  ASSERT_OK_AND_ASSIGN(table_, reader_->Read());
+
+  auto expected_table = Table::Make(::arrow::schema({field("yo", utf8())}),
+                                    {ArrayFromJSON(utf8(), R"(["a", "b", "c"])")});
+  AssertTablesEqual(*expected_table, *table_);
+}
+
 TEST_P(ReaderTest, Nested) {
   parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
   auto src = nested_src();
@@ -49,6 +49,12 @@
 #  include <malloc.h>
 #endif
 
+#ifdef __linux__
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif
+
 #ifdef ARROW_MIMALLOC
 #  include <mimalloc.h>
 #endif
@@ -849,6 +855,924 @@ int64_t ProxyMemoryPool::num_allocations() const { return impl_->num_allocations
 
 std::string ProxyMemoryPool::backend_name() const { return impl_->backend_name(); }
 
+///////////////////////////////////////////////////////////////////////
+// ArenaMemoryPool implementation
+
+namespace {
+
+// A single-threaded bump allocator carving allocations out of slabs obtained
+// from a parent pool and handing them back wholesale on destruction.
+// See MemoryPool::CreateArena.
+class ArenaMemoryPool : public MemoryPool {
+ public:
+  ArenaMemoryPool(MemoryPool* parent, int64_t slab_size)
+      : parent_(parent), slab_size_(slab_size) {}
+
+  ~ArenaMemoryPool() override {
+    for (const auto& slab : slabs_) {
+      parent_->Free(slab.data, slab.size, slab.alignment);
+    }
+  }
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size == 0) {
+      *out = memory_pool::internal::kZeroSizeArea;
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(*out, Bump(size, alignment));
+    stats_.DidAllocateBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    uint8_t* previous = *ptr;
+    if (previous == memory_pool::internal::kZeroSizeArea) {
+      DCHECK_EQ(old_size, 0);
+      return Allocate(new_size, alignment, ptr);
+    }
+    if (new_size == 0) {
+      Free(previous, old_size, alignment);
+      *ptr = memory_pool::internal::kZeroSizeArea;
+      return Status::OK();
+    }
+    // The most recent allocation can grow or shrink in place
+    if (previous + old_size == ptr_ && previous + new_size <= end_) {
+      ptr_ = previous + new_size;
+      stats_.DidReallocateBytes(old_size, new_size);
+      return Status::OK();
+    }
+    if (new_size <= old_size) {
+      // Shrinking elsewhere: keep the allocation, the tail is simply wasted
+      stats_.DidReallocateBytes(old_size, new_size);
+      return Status::OK();
+    }
+    ARROW_ASSIGN_OR_RAISE(uint8_t* fresh, Bump(new_size, alignment));
+    memcpy(fresh, previous, static_cast<size_t>(old_size));
+    *ptr = fresh;
+    stats_.DidReallocateBytes(old_size, new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override {
+    if (buffer == memory_pool::internal::kZeroSizeArea) {
+      return;
+    }
+    // Only the most recent allocation can be rolled back; anything else is
+    // reclaimed wholesale on destruction
+    if (buffer + size == ptr_) {
+      ptr_ = buffer;
+    }
+    stats_.DidFreeBytes(size);
+  }
+
+  int64_t bytes_allocated() const override { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const override { return stats_.max_memory(); }
+
+  int64_t total_bytes_allocated() const override {
+    return stats_.total_bytes_allocated();
+  }
+
+  int64_t num_allocations() const override { return stats_.num_allocations(); }
+
+  std::string backend_name() const override { return "arena"; }
+
+ private:
+  struct Slab {
+    uint8_t* data;
+    int64_t size;
+    int64_t alignment;
+  };
+
+  Result<uint8_t*> Bump(int64_t size, int64_t alignment) {
+    int64_t padding = 0;
+    if (ptr_ != nullptr) {
+      const auto addr = reinterpret_cast<uintptr_t>(ptr_);
+      padding =
+          static_cast<int64_t>(-addr & (static_cast<uintptr_t>(alignment) - 1));
+    }
+    if (ptr_ == nullptr || end_ - ptr_ < padding + size) {
+      // Start a new slab; oversized requests get a dedicated one.  Slabs are
+      // allocated at least at the request's alignment, so no padding is
+      // needed at the slab start.
+      Slab slab;
+      slab.size = std::max(slab_size_, size);
+      slab.alignment = std::max(alignment, kDefaultBufferAlignment);
+      RETURN_NOT_OK(parent_->Allocate(slab.size, slab.alignment, &slab.data));
+      slabs_.push_back(slab);
+      ptr_ = slab.data;
+      end_ = slab.data + slab.size;
+      padding = 0;
+    }
+    uint8_t* out = ptr_ + padding;
+    ptr_ = out + size;
+    return out;
+  }
+
+  MemoryPool* parent_;
+  const int64_t slab_size_;
+  std::vector<Slab> slabs_;
+  uint8_t* ptr_ = nullptr;
+  uint8_t* end_ = nullptr;
+  internal::MemoryPoolStats stats_;
+};
+
+}  // namespace
+
+std::unique_ptr<MemoryPool> MemoryPool::CreateArena(int64_t slab_size) {
+  DCHECK_GT(slab_size, 0);
+  return std::make_unique<ArenaMemoryPool>(this, slab_size);
+}
+
+Result<std::unique_ptr<IsolatedMemoryPool>> MemoryPool::CreateIsolated(
+    int64_t dirty_decay_ms, int64_t muzzy_decay_ms) {
+  if (dirty_decay_ms < -1 || muzzy_decay_ms < -1) {
+    return Status::Invalid("decay times must be -1 (disabled) or non-negative");
+  }
+#ifdef ARROW_JEMALLOC
+  return memory_pool::internal::MakeJemallocIsolatedPool(dirty_decay_ms,
+                                                         muzzy_decay_ms);
+#else
+  return Status::NotImplemented("jemalloc support is not built");
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////
+// RecyclingMemoryPool implementation
+
+class RecyclingMemoryPool::RecyclingMemoryPoolImpl {
+ public:
+  // Power-of-two size classes from 64 bytes to 32 MiB; anything larger
+  // bypasses the cache.
+  static constexpr int64_t kMinClassSize = 64;
+  static constexpr int64_t kMaxClassSize = 32 * 1024 * 1024;
+  static constexpr int kMinClassShift = 6;
+  static constexpr int kNumClasses = 20;
+
+  RecyclingMemoryPoolImpl(MemoryPool* pool, int64_t max_cached_bytes)
+      : pool_(pool), max_cached_bytes_(max_cached_bytes), classes_(kNumClasses) {}
+
+  ~RecyclingMemoryPoolImpl() { ReleaseUnused(); }
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+    RETURN_NOT_OK(AllocateRaw(size, alignment, out));
+    stats_.DidAllocateBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    const bool old_recyclable = Recyclable(old_size, alignment);
+    const bool new_recyclable = Recyclable(new_size, alignment);
+    if (!old_recyclable && !new_recyclable) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, alignment, ptr));
+    } else if (old_recyclable && new_recyclable &&
+               ClassSize(old_size) == ClassSize(new_size)) {
+      // The block is already large enough for the target size class
+    } else {
+      uint8_t* fresh;
+      RETURN_NOT_OK(AllocateRaw(new_size, alignment, &fresh));
+      memcpy(fresh, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      FreeRaw(*ptr, old_size, alignment);
+      *ptr = fresh;
+    }
+    stats_.DidReallocateBytes(old_size, new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+    FreeRaw(buffer, size, alignment);
+    stats_.DidFreeBytes(size);
+  }
+
+  void ReleaseUnused() {
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      for (int i = 0; i < kNumClasses; ++i) {
+        const int64_t class_size = kMinClassSize << i;
+        for (uint8_t* buffer : classes_[i]) {
+          pool_->Free(buffer, class_size, kDefaultBufferAlignment);
+        }
+        classes_[i].clear();
+      }
+      cached_bytes_ = 0;
+    }
+    pool_->ReleaseUnused();
+  }
+
+  int64_t cached_bytes() const {
+    std::lock_guard<std::mutex> guard(lock_);
+    return cached_bytes_;
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t total_bytes_allocated() const { return stats_.total_bytes_allocated(); }
+
+  int64_t num_allocations() const { return stats_.num_allocations(); }
+
+  std::string backend_name() const { return "recycling"; }
+
+ private:
+  static bool Recyclable(int64_t size, int64_t alignment) {
+    return size > 0 && size <= kMaxClassSize && alignment == kDefaultBufferAlignment;
+  }
+
+  static int64_t ClassSize(int64_t size) {
+    return std::max(bit_util::NextPower2(size), kMinClassSize);
+  }
+
+  static int ClassIndex(int64_t class_size) {
+    return bit_util::CountTrailingZeros(static_cast<uint64_t>(class_size)) -
+           kMinClassShift;
+  }
+
+  Status AllocateRaw(int64_t size, int64_t alignment, uint8_t** out) {
+    if (!Recyclable(size, alignment)) {
+      return pool_->Allocate(size, alignment, out);
+    }
+    const int64_t class_size = ClassSize(size);
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      auto& free_list = classes_[ClassIndex(class_size)];
+      if (!free_list.empty()) {
+        *out = free_list.back();
+        free_list.pop_back();
+        cached_bytes_ -= class_size;
+        return Status::OK();
+      }
+    }
+    return pool_->Allocate(class_size, kDefaultBufferAlignment, out);
+  }
+
+  void FreeRaw(uint8_t* buffer, int64_t size, int64_t alignment) {
+    if (!Recyclable(size, alignment)) {
+      pool_->Free(buffer, size, alignment);
+      return;
+    }
+    const int64_t class_size = ClassSize(size);
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      if (cached_bytes_ + class_size <= max_cached_bytes_) {
+        classes_[ClassIndex(class_size)].push_back(buffer);
+        cached_bytes_ += class_size;
+        return;
+      }
+    }
+    pool_->Free(buffer, class_size, kDefaultBufferAlignment);
+  }
+
+  MemoryPool* pool_;
+  const int64_t max_cached_bytes_;
+  mutable std::mutex lock_;
+  // Per-class LIFO free lists, most recently freed blocks served first
+  std::vector<std::vector<uint8_t*>> classes_;
+  int64_t cached_bytes_ = 0;
+  internal::MemoryPoolStats stats_;
+};
+
+RecyclingMemoryPool::RecyclingMemoryPool(MemoryPool* pool, int64_t max_cached_bytes) {
+  impl_.reset(new RecyclingMemoryPoolImpl(pool, max_cached_bytes));
+}
+
+RecyclingMemoryPool::~RecyclingMemoryPool() = default;
+
+Status RecyclingMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  return impl_->Allocate(size, alignment, out);
+}
+
+Status RecyclingMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       int64_t alignment, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, alignment, ptr);
+}
+
+void RecyclingMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  impl_->Free(buffer, size, alignment);
+}
+
+void RecyclingMemoryPool::ReleaseUnused() { impl_->ReleaseUnused(); }
+
+int64_t RecyclingMemoryPool::cached_bytes() const { return impl_->cached_bytes(); }
+
+int64_t RecyclingMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t RecyclingMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t RecyclingMemoryPool::total_bytes_allocated() const {
+  return impl_->total_bytes_allocated();
+}
+
+int64_t RecyclingMemoryPool::num_allocations() const { return impl_->num_allocations(); }
+
+std::string RecyclingMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+///////////////////////////////////////////////////////////////////////
+// PlacementMemoryPool implementation
+
+namespace {
+
+#ifdef __linux__
+
+// NUMA memory policy constants from <numaif.h>, reproduced here so that we
+// don't require the libnuma development headers; the corresponding syscalls
+// are stable kernel ABI.
+constexpr int kMpolBind = 2;
+constexpr int kMpolInterleave = 3;
+constexpr unsigned long kMpolFNode = 1UL << 0;         // NOLINT runtime/int
+constexpr unsigned long kMpolFAddr = 1UL << 1;         // NOLINT runtime/int
+constexpr unsigned long kMpolFMemsAllowed = 1UL << 2;  // NOLINT runtime/int
+
+// We only support nodemasks of a single word, which covers any machine with
+// up to 64 NUMA nodes.
+constexpr unsigned long kMaxNodeBits = 8 * sizeof(unsigned long);  // NOLINT runtime/int
+
+Status MbindMemory(void* addr, size_t length, int mode,
+                   unsigned long nodemask) {  // NOLINT runtime/int
+  if (syscall(SYS_mbind, addr, length, mode, &nodemask, kMaxNodeBits + 1, 0UL) != 0) {
+    return ::arrow::internal::IOErrorFromErrno(errno, "mbind failed");
+  }
+  return Status::OK();
+}
+
+Result<unsigned long> AllowedNodeMask() {  // NOLINT runtime/int
+  unsigned long nodemask = 0;  // NOLINT runtime/int
+  if (syscall(SYS_get_mempolicy, nullptr, &nodemask, kMaxNodeBits, nullptr,
+              kMpolFMemsAllowed) != 0) {
+    return ::arrow::internal::IOErrorFromErrno(errno, "get_mempolicy failed");
+  }
+  return nodemask;
+}
+
+#endif  // __linux__
+
+}  // namespace
+
+class PlacementMemoryPool::PlacementMemoryPoolImpl {
+ public:
+  PlacementMemoryPoolImpl(MemoryPool* pool, const MemoryPlacementOptions& options,
+                          unsigned long nodemask)  // NOLINT runtime/int
+      : pool_(pool), options_(options), nodemask_(nodemask) {
+#ifdef __linux__
+    page_size_ = static_cast<int64_t>(sysconf(_SC_PAGESIZE));
+#endif
+  }
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+    RETURN_NOT_OK(AllocateRaw(size, alignment, out));
+    stats_.DidAllocateBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    const bool old_placed = UsesPlacement(old_size, alignment);
+    const bool new_placed = UsesPlacement(new_size, alignment);
+    if (!old_placed && !new_placed) {
+      RETURN_NOT_OK(pool_->Reallocate(old_size, new_size, alignment, ptr));
+    } else if (old_placed && new_placed &&
+               MappedLength(old_size) == MappedLength(new_size)) {
+      // The existing mapping already covers the new size
+    } else {
+      uint8_t* fresh;
+      RETURN_NOT_OK(AllocateRaw(new_size, alignment, &fresh));
+      memcpy(fresh, *ptr, static_cast<size_t>(std::min(old_size, new_size)));
+      FreeRaw(*ptr, old_size, alignment);
+      *ptr = fresh;
+    }
+    stats_.DidReallocateBytes(old_size, new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+    FreeRaw(buffer, size, alignment);
+    stats_.DidFreeBytes(size);
+  }
+
+  int64_t bytes_allocated() const { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const { return stats_.max_memory(); }
+
+  int64_t total_bytes_allocated() const { return stats_.total_bytes_allocated(); }
+
+  int64_t num_allocations() const { return stats_.num_allocations(); }
+
+  std::string backend_name() const { return "placement"; }
+
+ private:
+  bool UsesPlacement(int64_t size, int64_t alignment) const {
+#ifdef __linux__
+    // mmap'd regions are page-aligned, which satisfies any smaller alignment
+    return size >= options_.placement_threshold && alignment <= page_size_;
+#else
+    return false;
+#endif
+  }
+
+  size_t MappedLength(int64_t size) const {
+    return static_cast<size_t>(bit_util::RoundUp(size, page_size_));
+  }
+
+  Status AllocateRaw(int64_t size, int64_t alignment, uint8_t** out) {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (!UsesPlacement(size, alignment)) {
+      return pool_->Allocate(size, alignment, out);
+    }
+#ifdef __linux__
+    const size_t length = MappedLength(size);
+    void* addr = mmap(nullptr, length, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS, /*fd=*/-1, /*offset=*/0);
+    if (addr == MAP_FAILED) {
+      return Status::OutOfMemory("mmap of size ", size, " failed");
+    }
+    Status st;
+    switch (options_.placement) {
+      case MemoryPlacement::kInterleave:
+        st = MbindMemory(addr, length, kMpolInterleave, nodemask_);
+        break;
+      case MemoryPlacement::kBindNode:
+        st = MbindMemory(addr, length, kMpolBind, 1UL << options_.numa_node);
+        break;
+      case MemoryPlacement::kDefault:
+        break;
+    }
+    if (!st.ok()) {
+      munmap(addr, length);
+      return st;
+    }
+    if (options_.transparent_huge_pages) {
+      // Best effort: the kernel may have THP disabled entirely
+      madvise(addr, length, MADV_HUGEPAGE);
+    }
+    *out = static_cast<uint8_t*>(addr);
+    return Status::OK();
+#else
+    return Status::NotImplemented("Memory placement control is only supported on Linux");
+#endif
+  }
+
+  void FreeRaw(uint8_t* buffer, int64_t size, int64_t alignment) {
+    if (!UsesPlacement(size, alignment)) {
+      pool_->Free(buffer, size, alignment);
+      return;
+    }
+#ifdef __linux__
+    munmap(buffer, MappedLength(size));
+#endif
+  }
+
+  MemoryPool* pool_;
+  const MemoryPlacementOptions options_;
+  // Node mask for interleaved placement (all allowed nodes)
+  const unsigned long nodemask_;  // NOLINT runtime/int
+  int64_t page_size_ = 4096;
+  internal::MemoryPoolStats stats_;
+};
+
+Result<std::unique_ptr<PlacementMemoryPool>> PlacementMemoryPool::Make(
+    MemoryPool* pool, const MemoryPlacementOptions& options) {
+#ifdef __linux__
+  if (options.placement_threshold <= 0) {
+    return Status::Invalid("placement_threshold must be positive");
+  }
+  unsigned long nodemask = 0;  // NOLINT runtime/int
+  if (options.placement == MemoryPlacement::kBindNode) {
+    if (options.numa_node < 0 ||
+        static_cast<unsigned long>(options.numa_node) >= kMaxNodeBits) {
+      return Status::Invalid("Invalid NUMA node to bind to: ", options.numa_node);
+    }
+    ARROW_ASSIGN_OR_RAISE(const auto allowed, AllowedNodeMask());
+    if ((allowed & (1UL << options.numa_node)) == 0) {
+      return Status::Invalid("NUMA node ", options.numa_node, " is not available");
+    }
+  } else if (options.placement == MemoryPlacement::kInterleave) {
+    ARROW_ASSIGN_OR_RAISE(nodemask, AllowedNodeMask());
+  }
+  return std::unique_ptr<PlacementMemoryPool>(new PlacementMemoryPool(
+      std::make_unique<PlacementMemoryPoolImpl>(pool, options, nodemask)));
+#else
+  return Status::NotImplemented("Memory placement control is only supported on Linux");
+#endif
+}
+
+PlacementMemoryPool::PlacementMemoryPool(std::unique_ptr<PlacementMemoryPoolImpl> impl)
+    : impl_(std::move(impl)) {}
+
+PlacementMemoryPool::~PlacementMemoryPool() = default;
+
+Status PlacementMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  return impl_->Allocate(size, alignment, out);
+}
+
+Status PlacementMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       int64_t alignment, uint8_t** ptr) {
+  return impl_->Reallocate(old_size, new_size, alignment, ptr);
+}
+
+void PlacementMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  impl_->Free(buffer, size, alignment);
+}
+
+int64_t PlacementMemoryPool::bytes_allocated() const { return impl_->bytes_allocated(); }
+
+int64_t PlacementMemoryPool::max_memory() const { return impl_->max_memory(); }
+
+int64_t PlacementMemoryPool::total_bytes_allocated() const {
+  return impl_->total_bytes_allocated();
+}
+
+int64_t PlacementMemoryPool::num_allocations() const { return impl_->num_allocations(); }
+
+std::string PlacementMemoryPool::backend_name() const { return impl_->backend_name(); }
+
+Result<int> GetMemoryNode(const void* addr) {
+#ifdef __linux__
+  int node = -1;
+  if (syscall(SYS_get_mempolicy, &node, nullptr, 0UL, const_cast<void*>(addr),
+              kMpolFNode | kMpolFAddr) != 0) {
+    return ::arrow::internal::IOErrorFromErrno(errno, "get_mempolicy failed");
+  }
+  return node;
+#else
+  return Status::NotImplemented("NUMA introspection is only supported on Linux");
+#endif
+}
+
+///////////////////////////////////////////////////////////////////////
+// MemoryPressureMonitor implementation
+
+class MemoryPressureMonitor::MemoryPressureMonitorImpl {
+ public:
+  explicit MemoryPressureMonitorImpl(int64_t soft_limit_bytes)
+      : soft_limit_bytes_(soft_limit_bytes) {}
+
+  int64_t soft_limit_bytes() const {
+    return soft_limit_bytes_.load(std::memory_order_acquire);
+  }
+
+  void set_soft_limit_bytes(int64_t soft_limit_bytes) {
+    soft_limit_bytes_.store(soft_limit_bytes, std::memory_order_release);
+  }
+
+  int64_t bytes_allocated() const {
+    return bytes_allocated_.load(std::memory_order_acquire);
+  }
+
+  int64_t AddCallback(int64_t watermark_bytes, PressureCallback callback) {
+    std::lock_guard<std::mutex> guard(lock_);
+    const int64_t id = next_id_++;
+    callbacks_.push_back({id, watermark_bytes, /*armed=*/true, std::move(callback)});
+    RecomputeWatermarksUnlocked();
+    return id;
+  }
+
+  bool RemoveCallback(int64_t id) {
+    std::lock_guard<std::mutex> guard(lock_);
+    for (auto it = callbacks_.begin(); it != callbacks_.end(); ++it) {
+      if (it->id == id) {
+        callbacks_.erase(it);
+        RecomputeWatermarksUnlocked();
+        return true;
+      }
+    }
+    return false;
+  }
+
+  Status Reserve(int64_t size) {
+    const int64_t limit = soft_limit_bytes();
+    const int64_t allocated =
+        bytes_allocated_.fetch_add(size, std::memory_order_acq_rel) + size;
+    if (limit >= 0 && allocated > limit) {
+      bytes_allocated_.fetch_sub(size, std::memory_order_acq_rel);
+      return Status::OutOfMemory("allocation of size ", size,
+                                 " would exceed memory soft limit of ", limit,
+                                 " bytes (", allocated - size, " already allocated)");
+    }
+    // Cheap check on the hot path, the lock is only taken on a crossing
+    if (allocated >= lowest_armed_.load(std::memory_order_acquire)) {
+      FireCallbacks(allocated);
+    }
+    return Status::OK();
+  }
+
+  void Release(int64_t size) {
+    const int64_t allocated =
+        bytes_allocated_.fetch_sub(size, std::memory_order_acq_rel) - size;
+    if (allocated < highest_fired_.load(std::memory_order_acquire)) {
+      std::lock_guard<std::mutex> guard(lock_);
+      for (auto& callback : callbacks_) {
+        if (!callback.armed && allocated < callback.watermark) {
+          callback.armed = true;
+        }
+      }
+      RecomputeWatermarksUnlocked();
+    }
+  }
+
+ private:
+  struct Callback {
+    int64_t id;
+    int64_t watermark;
+    bool armed;
+    PressureCallback fn;
+  };
+
+  void FireCallbacks(int64_t allocated) {
+    std::vector<PressureCallback> to_fire;
+    {
+      std::lock_guard<std::mutex> guard(lock_);
+      for (auto& callback : callbacks_) {
+        if (callback.armed && allocated >= callback.watermark) {
+          callback.armed = false;
+          to_fire.push_back(callback.fn);
+        }
+      }
+      RecomputeWatermarksUnlocked();
+    }
+    // Fire outside the lock so that callbacks may add or remove callbacks
+    for (auto& fn : to_fire) {
+      fn(allocated);
+    }
+  }
+
+  void RecomputeWatermarksUnlocked() {
+    int64_t lowest_armed = std::numeric_limits<int64_t>::max();
+    int64_t highest_fired = std::numeric_limits<int64_t>::min();
+    for (const auto& callback : callbacks_) {
+      if (callback.armed) {
+        lowest_armed = std::min(lowest_armed, callback.watermark);
+      } else {
+        highest_fired = std::max(highest_fired, callback.watermark);
+      }
+    }
+    lowest_armed_.store(lowest_armed, std::memory_order_release);
+    highest_fired_.store(highest_fired, std::memory_order_release);
+  }
+
+  std::atomic<int64_t> soft_limit_bytes_;
+  std::atomic<int64_t> bytes_allocated_{0};
+  // Lowest watermark of an armed callback; crossing it requires taking the lock
+  std::atomic<int64_t> lowest_armed_{std::numeric_limits<int64_t>::max()};
+  // Highest watermark of a fired callback; falling below it re-arms
+  std::atomic<int64_t> highest_fired_{std::numeric_limits<int64_t>::min()};
+
+  std::mutex lock_;
+  std::vector<Callback> callbacks_;
+  int64_t next_id_ = 1;
+};
+
+MemoryPressureMonitor::MemoryPressureMonitor(int64_t soft_limit_bytes)
+    : impl_(new MemoryPressureMonitorImpl(soft_limit_bytes)) {}
+
+MemoryPressureMonitor::~MemoryPressureMonitor() = default;
+
+const std::shared_ptr<MemoryPressureMonitor>& MemoryPressureMonitor::Default() {
+  static auto monitor = std::make_shared<MemoryPressureMonitor>();
+  return monitor;
+}
+
+int64_t MemoryPressureMonitor::soft_limit_bytes() const {
+  return impl_->soft_limit_bytes();
+}
+
+void MemoryPressureMonitor::set_soft_limit_bytes(int64_t soft_limit_bytes) {
+  impl_->set_soft_limit_bytes(soft_limit_bytes);
+}
+
+int64_t MemoryPressureMonitor::bytes_allocated() const {
+  return impl_->bytes_allocated();
+}
+
+int64_t MemoryPressureMonitor::AddCallback(int64_t watermark_bytes,
+                                           PressureCallback callback) {
+  return impl_->AddCallback(watermark_bytes, std::move(callback));
+}
+
+bool MemoryPressureMonitor::RemoveCallback(int64_t id) {
+  return impl_->RemoveCallback(id);
+}
+
+Status MemoryPressureMonitor::Reserve(int64_t size) { return impl_->Reserve(size); }
+
+void MemoryPressureMonitor::Release(int64_t size) { impl_->Release(size); }
+
+///////////////////////////////////////////////////////////////////////
+// MonitoredMemoryPool implementation
+
+MonitoredMemoryPool::MonitoredMemoryPool(MemoryPool* pool, std::string subsystem_name,
+                                         std::shared_ptr<MemoryPressureMonitor> monitor)
+    : pool_(pool),
+      subsystem_name_(std::move(subsystem_name)),
+      monitor_(std::move(monitor)) {}
+
+MonitoredMemoryPool::~MonitoredMemoryPool() = default;
+
+Status MonitoredMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  if (size < 0) {
+    return Status::Invalid("negative malloc size");
+  }
+  RETURN_NOT_OK(monitor_->Reserve(size));
+  Status st = pool_->Allocate(size, alignment, out);
+  if (!st.ok()) {
+    monitor_->Release(size);
+    return st;
+  }
+  stats_.DidAllocateBytes(size);
+  return Status::OK();
+}
+
+Status MonitoredMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                       int64_t alignment, uint8_t** ptr) {
+  if (new_size < 0) {
+    return Status::Invalid("negative realloc size");
+  }
+  if (new_size > old_size) {
+    RETURN_NOT_OK(monitor_->Reserve(new_size - old_size));
+  }
+  Status st = pool_->Reallocate(old_size, new_size, alignment, ptr);
+  if (!st.ok()) {
+    if (new_size > old_size) {
+      monitor_->Release(new_size - old_size);
+    }
+    return st;
+  }
+  if (new_size < old_size) {
+    monitor_->Release(old_size - new_size);
+  }
+  stats_.DidReallocateBytes(old_size, new_size);
+  return Status::OK();
+}
+
+void MonitoredMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  pool_->Free(buffer, size, alignment);
+  monitor_->Release(size);
+  stats_.DidFreeBytes(size);
+}
+
+const std::string& MonitoredMemoryPool::subsystem_name() const {
+  return subsystem_name_;
+}
+
+const std::shared_ptr<MemoryPressureMonitor>& MonitoredMemoryPool::monitor() const {
+  return monitor_;
+}
+
+int64_t MonitoredMemoryPool::bytes_allocated() const {
+  return stats_.bytes_allocated();
+}
+
+int64_t MonitoredMemoryPool::max_memory() const { return stats_.max_memory(); }
+
+int64_t MonitoredMemoryPool::total_bytes_allocated() const {
+  return stats_.total_bytes_allocated();
+}
+
+int64_t MonitoredMemoryPool::num_allocations() const {
+  return stats_.num_allocations();
+}
+
+std::string MonitoredMemoryPool::backend_name() const {
+  return pool_->backend_name();
+}
+
+///////////////////////////////////////////////////////////////////////
+// QuotaMemoryPool implementation
+
+QuotaMemoryPool::QuotaMemoryPool(MemoryPool* pool,
+                                 std::shared_ptr<QuotaMemoryPool> parent,
+                                 int64_t hard_limit_bytes, int64_t soft_limit_bytes)
+    : pool_(pool),
+      parent_(std::move(parent)),
+      hard_limit_bytes_(hard_limit_bytes),
+      soft_limit_bytes_(soft_limit_bytes) {}
+
+QuotaMemoryPool::~QuotaMemoryPool() = default;
+
+std::shared_ptr<QuotaMemoryPool> QuotaMemoryPool::Make(MemoryPool* pool,
+                                                       int64_t hard_limit_bytes,
+                                                       int64_t soft_limit_bytes) {
+  return std::shared_ptr<QuotaMemoryPool>(
+      new QuotaMemoryPool(pool, /*parent=*/nullptr, hard_limit_bytes,
+                          soft_limit_bytes));
+}
+
+std::shared_ptr<QuotaMemoryPool> QuotaMemoryPool::MakeChild(int64_t hard_limit_bytes,
+                                                            int64_t soft_limit_bytes) {
+  return std::shared_ptr<QuotaMemoryPool>(new QuotaMemoryPool(
+      pool_, shared_from_this(), hard_limit_bytes, soft_limit_bytes));
+}
+
+Status QuotaMemoryPool::Reserve(int64_t size) {
+  const int64_t reserved = reserved_bytes_.fetch_add(size) + size;
+  if (hard_limit_bytes_ >= 0 && reserved > hard_limit_bytes_) {
+    reserved_bytes_.fetch_sub(size);
+    return Status::OutOfMemory("allocation of size ", size,
+                               " would exceed memory quota of ", hard_limit_bytes_,
+                               " bytes (", reserved - size, " already reserved)");
+  }
+  if (parent_) {
+    Status st = parent_->Reserve(size);
+    if (!st.ok()) {
+      reserved_bytes_.fetch_sub(size);
+      return st;
+    }
+  }
+  if (soft_limit_bytes_ >= 0 && reserved > soft_limit_bytes_ &&
+      !soft_limit_exceeded_.exchange(true)) {
+    // Best-effort reclamation; the allocation itself proceeds
+    pool_->ReleaseUnused();
+  }
+  return Status::OK();
+}
+
+void QuotaMemoryPool::Unreserve(int64_t size) {
+  const int64_t reserved = reserved_bytes_.fetch_sub(size) - size;
+  if (soft_limit_bytes_ >= 0 && reserved <= soft_limit_bytes_) {
+    soft_limit_exceeded_.store(false);
+  }
+  if (parent_) {
+    parent_->Unreserve(size);
+  }
+}
+
+Status QuotaMemoryPool::Allocate(int64_t size, int64_t alignment, uint8_t** out) {
+  if (size < 0) {
+    return Status::Invalid("negative malloc size");
+  }
+  RETURN_NOT_OK(Reserve(size));
+  Status st = pool_->Allocate(size, alignment, out);
+  if (!st.ok()) {
+    Unreserve(size);
+    return st;
+  }
+  stats_.DidAllocateBytes(size);
+  return Status::OK();
+}
+
+Status QuotaMemoryPool::Reallocate(int64_t old_size, int64_t new_size,
+                                   int64_t alignment, uint8_t** ptr) {
+  if (new_size < 0) {
+    return Status::Invalid("negative realloc size");
+  }
+  if (new_size > old_size) {
+    RETURN_NOT_OK(Reserve(new_size - old_size));
+  }
+  Status st = pool_->Reallocate(old_size, new_size, alignment, ptr);
+  if (!st.ok()) {
+    if (new_size > old_size) {
+      Unreserve(new_size - old_size);
+    }
+    return st;
+  }
+  if (new_size < old_size) {
+    Unreserve(old_size - new_size);
+  }
+  stats_.DidReallocateBytes(old_size, new_size);
+  return Status::OK();
+}
+
+void QuotaMemoryPool::Free(uint8_t* buffer, int64_t size, int64_t alignment) {
+  pool_->Free(buffer, size, alignment);
+  Unreserve(size);
+  stats_.DidFreeBytes(size);
+}
+
+void QuotaMemoryPool::ReleaseUnused() { pool_->ReleaseUnused(); }
+
+int64_t QuotaMemoryPool::hard_limit_bytes() const { return hard_limit_bytes_; }
+
+int64_t QuotaMemoryPool::soft_limit_bytes() const { return soft_limit_bytes_; }
+
+int64_t QuotaMemoryPool::reserved_bytes() const { return reserved_bytes_.load(); }
+
+int64_t QuotaMemoryPool::bytes_allocated() const { return stats_.bytes_allocated(); }
+
+int64_t QuotaMemoryPool::max_memory() const { return stats_.max_memory(); }
+
+int64_t QuotaMemoryPool::total_bytes_allocated() const {
+  return stats_.total_bytes_allocated();
+}
+
+int64_t QuotaMemoryPool::num_allocations() const { return stats_.num_allocations(); }
+
+std::string QuotaMemoryPool::backend_name() const { return pool_->backend_name(); }
+
 std::vector<std::string> SupportedMemoryBackendNames() {
   std::vector<std::string> supported;
   for (const auto backend : SupportedBackends()) {
@@ -101,6 +101,8 @@ class alignas(64) MemoryPoolStats {
 
 }  // namespace internal
 
+class IsolatedMemoryPool;
+
 /// Base class for memory allocation on the CPU.
 ///
 /// Besides tracking the number of allocated bytes, the allocator also should
@@ -112,6 +114,32 @@ class ARROW_EXPORT MemoryPool {
   /// \brief EXPERIMENTAL. Create a new instance of the default MemoryPool
   static std::unique_ptr<MemoryPool> CreateDefault();
 
+  /// \brief EXPERIMENTAL. Create a scoped bump-allocation arena backed by
+  /// this pool.
+  ///
+  /// The returned pool carves allocations out of slabs of `slab_size` bytes
+  /// obtained from this pool, and hands the slabs back wholesale when it is
+  /// destroyed.  Allocation is a pointer bump with no synchronization, which
+  /// makes the arena suited to short-lived scratch such as kernel
+  /// intermediates; Free() only reclaims the most recent allocation, so
+  /// long-lived arenas grow monotonically and should stay scoped to a batch
+  /// or task.  Unlike regular pools, the returned arena is NOT thread-safe,
+  /// and it must not outlive this pool.
+  /// \param[in] slab_size granularity of the allocations made in this pool
+  std::unique_ptr<MemoryPool> CreateArena(int64_t slab_size = 1024 * 1024);
+
+  /// \brief EXPERIMENTAL. Create a MemoryPool backed by a dedicated jemalloc
+  /// arena.
+  ///
+  /// Allocations from the returned pool never mix with other pools' memory,
+  /// so a long-running fragmenting workload (e.g. a large ETL plan) cannot
+  /// pollute the heap seen by latency-sensitive consumers.  Destroying the
+  /// pool destroys the arena and returns its pages to the operating system.
+  ///
+  /// Returns NotImplemented if jemalloc support is not built.
+  static Result<std::unique_ptr<IsolatedMemoryPool>> CreateIsolated(
+      int64_t dirty_decay_ms = 1000, int64_t muzzy_decay_ms = 1000);
+
   /// Allocate a new memory region of at least size bytes.
   ///
   /// The allocated region shall be 64-byte aligned.
@@ -245,6 +273,327 @@ class ARROW_EXPORT ProxyMemoryPool : public MemoryPool {
   std::unique_ptr<ProxyMemoryPoolImpl> impl_;
 };
 
+/// \brief A memory pool that recycles freed allocations per size class.
+///
+/// Allocations with the default 64-byte alignment are rounded up to a
+/// power-of-two size class; freed blocks are cached per class (up to
+/// `max_cached_bytes` in total) and served back on later allocations of the
+/// same class instead of going through the backing allocator.  This is an
+/// opt-in layer meant for streaming readers that allocate and free
+/// identical-sized buffers at a high rate: pass an instance to e.g.
+/// AllocateResizableBuffer or a RecordBatchStreamReader to enable it.
+///
+/// Statistics report logical (requested) bytes; cached blocks remain counted
+/// against the backing pool until ReleaseUnused() or destruction returns them.
+/// Oversized or non-default-aligned allocations bypass the cache.
+class ARROW_EXPORT RecyclingMemoryPool : public MemoryPool {
+ public:
+  explicit RecyclingMemoryPool(MemoryPool* pool,
+                               int64_t max_cached_bytes = 64 * 1024 * 1024);
+  ~RecyclingMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+
+  /// Hand all cached blocks back to the backing pool.
+  void ReleaseUnused() override;
+
+  /// The number of bytes currently held in the recycling cache.
+  int64_t cached_bytes() const;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+ private:
+  class RecyclingMemoryPoolImpl;
+  std::unique_ptr<RecyclingMemoryPoolImpl> impl_;
+};
+
+/// \brief EXPERIMENTAL: A MemoryPool isolated in its own jemalloc arena
+///
+/// Created through MemoryPool::CreateIsolated().  On top of the regular
+/// MemoryPool interface, it exposes per-arena page decay tuning and access to
+/// the arena's own jemalloc statistics.
+class ARROW_EXPORT IsolatedMemoryPool : public MemoryPool {
+ public:
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  /// \brief Set dirty / muzzy page decay times for this pool's arena
+  ///
+  /// See the dirty_decay_ms and muzzy_decay_ms options in jemalloc for a
+  /// description of what these do; unlike jemalloc_set_decay_ms(), only this
+  /// pool's arena is affected.
+  virtual Status SetDecayMs(int64_t dirty_decay_ms, int64_t muzzy_decay_ms) = 0;
+
+  /// \brief Read a statistic of this pool's arena from jemalloc's mallctl
+  ///
+  /// The name is relative to the arena, e.g. "small.allocated" reads
+  /// "stats.arenas.<i>.small.allocated".
+  virtual Result<int64_t> GetArenaStat(const char* name) const = 0;
+
+ protected:
+  IsolatedMemoryPool() = default;
+};
+
+/// \brief Page placement policy applied by PlacementMemoryPool
+enum class MemoryPlacement {
+  /// Leave placement to the OS first-touch policy
+  kDefault,
+  /// Interleave pages round-robin across all allowed NUMA nodes
+  kInterleave,
+  /// Bind pages to a single NUMA node
+  kBindNode,
+};
+
+/// \brief Options for PlacementMemoryPool::Make
+struct ARROW_EXPORT MemoryPlacementOptions {
+  /// NUMA placement for allocations at or above `placement_threshold`
+  MemoryPlacement placement = MemoryPlacement::kDefault;
+  /// The node to bind to; required when `placement` is kBindNode
+  int numa_node = -1;
+  /// Whether to request transparent huge pages (madvise(MADV_HUGEPAGE))
+  /// for allocations at or above `placement_threshold`
+  bool transparent_huge_pages = true;
+  /// Minimum allocation size for which placement control kicks in;
+  /// smaller allocations are delegated to the backing pool untouched
+  int64_t placement_threshold = 2 * 1024 * 1024;
+};
+
+/// \brief A memory pool applying NUMA and huge-page placement policies.
+///
+/// Allocations at or above the configured threshold are mapped directly
+/// (bypassing the backing allocator) so that their pages can be interleaved
+/// across NUMA nodes or bound to a given node, and optionally backed by
+/// transparent huge pages to cut TLB misses on large scans and joins.
+/// Smaller allocations are delegated to the backing pool.
+///
+/// Only supported on Linux; Make returns NotImplemented elsewhere.  The node
+/// actually backing a buffer can be queried with GetMemoryNode.
+class ARROW_EXPORT PlacementMemoryPool : public MemoryPool {
+ public:
+  static Result<std::unique_ptr<PlacementMemoryPool>> Make(
+      MemoryPool* pool, const MemoryPlacementOptions& options = {});
+
+  ~PlacementMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+ private:
+  class PlacementMemoryPoolImpl;
+  explicit PlacementMemoryPool(std::unique_ptr<PlacementMemoryPoolImpl> impl);
+  std::unique_ptr<PlacementMemoryPoolImpl> impl_;
+};
+
+/// \brief Return the NUMA node backing the page at the given address.
+///
+/// This lets a scheduler match compute to data, e.g. for buffers allocated
+/// through a PlacementMemoryPool bound to a node.  Returns NotImplemented on
+/// platforms without NUMA introspection.
+ARROW_EXPORT Result<int> GetMemoryNode(const void* addr);
+
+/// \brief Watermark-based memory pressure coordination across pools.
+///
+/// A monitor aggregates the usage of the MonitoredMemoryPool instances
+/// attached to it and fires registered callbacks when usage rises past their
+/// watermarks, so subsystems can react (shrink readahead, evict caches,
+/// throttle readers) before the allocator fails.  A callback fires once per
+/// crossing and is re-armed when usage falls back below its watermark.  An
+/// optional soft limit makes further allocations from attached pools fail
+/// with OutOfMemory instead of growing without bound.
+///
+/// Callbacks run on the allocating thread and must not allocate from an
+/// attached pool.
+class ARROW_EXPORT MemoryPressureMonitor {
+ public:
+  using PressureCallback = std::function<void(int64_t bytes_allocated)>;
+
+  /// \param soft_limit_bytes allocation ceiling across attached pools,
+  ///   or -1 for no limit
+  explicit MemoryPressureMonitor(int64_t soft_limit_bytes = -1);
+  ~MemoryPressureMonitor();
+
+  /// \brief A process-wide monitor for coordinating unrelated subsystems
+  static const std::shared_ptr<MemoryPressureMonitor>& Default();
+
+  int64_t soft_limit_bytes() const;
+  void set_soft_limit_bytes(int64_t soft_limit_bytes);
+
+  /// The current usage aggregated across attached pools
+  int64_t bytes_allocated() const;
+
+  /// \brief Register a callback fired when usage rises past the watermark
+  /// \return an id usable with RemoveCallback
+  int64_t AddCallback(int64_t watermark_bytes, PressureCallback callback);
+  /// \brief Unregister a callback, returns false if the id is unknown
+  bool RemoveCallback(int64_t id);
+
+  /// \brief Account for an allocation of `size` bytes, firing callbacks
+  ///
+  /// Fails with OutOfMemory when the soft limit would be exceeded.
+  /// Called by MonitoredMemoryPool; only useful directly for subsystems
+  /// tracking memory that does not come from a MemoryPool.
+  Status Reserve(int64_t size);
+  /// \brief Account for a deallocation of `size` bytes, re-arming callbacks
+  void Release(int64_t size);
+
+ private:
+  class MemoryPressureMonitorImpl;
+  std::unique_ptr<MemoryPressureMonitorImpl> impl_;
+};
+
+/// \brief A memory pool reporting its usage to a MemoryPressureMonitor.
+///
+/// Tracks the number of bytes and high-water mark allocated through it for
+/// the given subsystem (like ProxyMemoryPool), while enforcing the monitor's
+/// soft limit and triggering its pressure callbacks.  Actual allocation is
+/// delegated to the backing pool.
+class ARROW_EXPORT MonitoredMemoryPool : public MemoryPool {
+ public:
+  MonitoredMemoryPool(
+      MemoryPool* pool, std::string subsystem_name,
+      std::shared_ptr<MemoryPressureMonitor> monitor = MemoryPressureMonitor::Default());
+  ~MonitoredMemoryPool() override;
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+
+  /// The subsystem name this pool reports under
+  const std::string& subsystem_name() const;
+  const std::shared_ptr<MemoryPressureMonitor>& monitor() const;
+
+  int64_t bytes_allocated() const override;
+
+  /// The high-water mark of this subsystem's allocations
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+ private:
+  MemoryPool* pool_;
+  std::string subsystem_name_;
+  std::shared_ptr<MemoryPressureMonitor> monitor_;
+  internal::MemoryPoolStats stats_;
+};
+
+/// \brief EXPERIMENTAL: A memory pool enforcing hierarchical quotas
+///
+/// Quota pools form a tree: a root created with Make() and children created
+/// with MakeChild(), each with its own hard and soft limit.  An allocation
+/// counts against the quota of the pool it is made from and of every
+/// ancestor; it fails with OutOfMemory (never aborts) as soon as any level
+/// would exceed its hard limit.  Crossing a soft limit triggers a
+/// best-effort ReleaseUnused() on the backing pool and otherwise degrades
+/// gracefully.
+///
+/// In a multi-tenant process, give each tenant a child pool and pass it to
+/// everything that accepts a MemoryPool (compute::ExecContext,
+/// ipc::IpcReadOptions, the csv/json readers, ...): one tenant hitting its
+/// quota then fails its own queries with a Status instead of starving the
+/// process.  Parents must outlive their children; this is enforced by
+/// shared ownership.
+class ARROW_EXPORT QuotaMemoryPool : public MemoryPool,
+                                     public std::enable_shared_from_this<QuotaMemoryPool> {
+ public:
+  ~QuotaMemoryPool() override;
+
+  /// \brief Create a root quota pool delegating allocation to `pool`
+  ///
+  /// Limits are in bytes; -1 means unlimited.  The backing pool must outlive
+  /// the returned pool and all of its descendants.
+  static std::shared_ptr<QuotaMemoryPool> Make(MemoryPool* pool,
+                                               int64_t hard_limit_bytes = -1,
+                                               int64_t soft_limit_bytes = -1);
+
+  /// \brief Create a child pool whose usage also counts against this pool
+  std::shared_ptr<QuotaMemoryPool> MakeChild(int64_t hard_limit_bytes = -1,
+                                             int64_t soft_limit_bytes = -1);
+
+  using MemoryPool::Allocate;
+  using MemoryPool::Free;
+  using MemoryPool::Reallocate;
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override;
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override;
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override;
+
+  void ReleaseUnused() override;
+
+  int64_t hard_limit_bytes() const;
+  int64_t soft_limit_bytes() const;
+
+  /// \brief The bytes currently counted against this pool's quota,
+  /// including allocations made from descendant pools
+  int64_t reserved_bytes() const;
+
+  int64_t bytes_allocated() const override;
+
+  int64_t max_memory() const override;
+
+  int64_t total_bytes_allocated() const override;
+
+  int64_t num_allocations() const override;
+
+  std::string backend_name() const override;
+
+ private:
+  QuotaMemoryPool(MemoryPool* pool, std::shared_ptr<QuotaMemoryPool> parent,
+                  int64_t hard_limit_bytes, int64_t soft_limit_bytes);
+
+  Status Reserve(int64_t size);
+  void Unreserve(int64_t size);
+
+  MemoryPool* pool_;
+  std::shared_ptr<QuotaMemoryPool> parent_;
+  const int64_t hard_limit_bytes_;
+  const int64_t soft_limit_bytes_;
+  std::atomic<int64_t> reserved_bytes_{0};
+  std::atomic<bool> soft_limit_exceeded_{false};
+  internal::MemoryPoolStats stats_;
+};
+
 /// \brief Return a process-wide memory pool based on the system allocator.
 ARROW_EXPORT MemoryPool* system_memory_pool();
 
@@ -47,6 +47,10 @@ class JemallocAllocator {
   static void PrintStats();
 };
 
+// Create an IsolatedMemoryPool backed by a freshly created jemalloc arena.
+Result<std::unique_ptr<IsolatedMemoryPool>> MakeJemallocIsolatedPool(
+    int64_t dirty_decay_ms, int64_t muzzy_decay_ms);
+
 #endif  // defined(ARROW_JEMALLOC)
 
 }  // namespace internal
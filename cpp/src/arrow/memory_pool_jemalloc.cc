@@ -135,6 +135,165 @@ void JemallocAllocator::PrintStats() {
   malloc_stats_print(nullptr, nullptr, /*opts=*/"");
 }
 
+namespace {
+
+// A MemoryPool whose allocations are served from a dedicated jemalloc arena.
+// The thread cache is bypassed so no memory is shared with other arenas.
+class JemallocArenaPool : public IsolatedMemoryPool {
+ public:
+  explicit JemallocArenaPool(unsigned arena_index)
+      : arena_index_(arena_index),
+        flags_(MALLOCX_ARENA(arena_index) | MALLOCX_TCACHE_NONE) {}
+
+  ~JemallocArenaPool() override {
+    const std::string ctl = ArenaCtlName("destroy");
+    mallctl(ctl.c_str(), nullptr, nullptr, nullptr, 0);
+  }
+
+  Status Allocate(int64_t size, int64_t alignment, uint8_t** out) override {
+    if (size < 0) {
+      return Status::Invalid("negative malloc size");
+    }
+    if (size == 0) {
+      *out = kZeroSizeArea;
+    } else {
+      *out = reinterpret_cast<uint8_t*>(
+          mallocx(static_cast<size_t>(size),
+                  MALLOCX_ALIGN(static_cast<size_t>(alignment)) | flags_));
+      if (*out == NULL) {
+        return Status::OutOfMemory("malloc of size ", size, " failed");
+      }
+    }
+    stats_.DidAllocateBytes(size);
+    return Status::OK();
+  }
+
+  Status Reallocate(int64_t old_size, int64_t new_size, int64_t alignment,
+                    uint8_t** ptr) override {
+    if (new_size < 0) {
+      return Status::Invalid("negative realloc size");
+    }
+    uint8_t* previous_ptr = *ptr;
+    if (previous_ptr == kZeroSizeArea) {
+      DCHECK_EQ(old_size, 0);
+      RETURN_NOT_OK(Allocate(new_size, alignment, ptr));
+      // Allocate() already updated the stats
+      return Status::OK();
+    }
+    if (new_size == 0) {
+      sdallocx(previous_ptr, static_cast<size_t>(old_size),
+               MALLOCX_ALIGN(static_cast<size_t>(alignment)) | flags_);
+      *ptr = kZeroSizeArea;
+    } else {
+      *ptr = reinterpret_cast<uint8_t*>(
+          rallocx(*ptr, static_cast<size_t>(new_size),
+                  MALLOCX_ALIGN(static_cast<size_t>(alignment)) | flags_));
+      if (*ptr == NULL) {
+        *ptr = previous_ptr;
+        return Status::OutOfMemory("realloc of size ", new_size, " failed");
+      }
+    }
+    stats_.DidReallocateBytes(old_size, new_size);
+    return Status::OK();
+  }
+
+  void Free(uint8_t* buffer, int64_t size, int64_t alignment) override {
+    if (buffer == kZeroSizeArea) {
+      DCHECK_EQ(size, 0);
+    } else {
+      sdallocx(buffer, static_cast<size_t>(size),
+               MALLOCX_ALIGN(static_cast<size_t>(alignment)) | flags_);
+    }
+    stats_.DidFreeBytes(size);
+  }
+
+  void ReleaseUnused() override {
+    const std::string ctl = ArenaCtlName("purge");
+    mallctl(ctl.c_str(), nullptr, nullptr, nullptr, 0);
+  }
+
+  Status SetDecayMs(int64_t dirty_decay_ms, int64_t muzzy_decay_ms) override {
+    RETURN_NOT_OK(WriteDecay("dirty_decay_ms", dirty_decay_ms));
+    return WriteDecay("muzzy_decay_ms", muzzy_decay_ms);
+  }
+
+  Result<int64_t> GetArenaStat(const char* name) const override {
+    // Refresh the statistics cached by mallctl
+    uint64_t epoch;
+    size_t sz = sizeof(epoch);
+    mallctl("epoch", &epoch, &sz, &epoch, sz);
+
+    const std::string ctl =
+        "stats.arenas." + std::to_string(arena_index_) + "." + name;
+    // Depending on the stat and platform, the value may be a uint64_t or a
+    // uint32_t. Try both, like jemalloc_get_stat().
+    {
+      uint64_t value = 0;
+      sz = sizeof(value);
+      int err = mallctl(ctl.c_str(), &value, &sz, nullptr, 0);
+      if (!err) {
+        return value;
+      }
+      if (err != EINVAL) {
+        return arrow::internal::IOErrorFromErrno(err, "Failed retrieving ", ctl);
+      }
+    }
+    uint32_t value = 0;
+    sz = sizeof(value);
+    int err = mallctl(ctl.c_str(), &value, &sz, nullptr, 0);
+    if (err) {
+      return arrow::internal::IOErrorFromErrno(err, "Failed retrieving ", ctl);
+    }
+    return value;
+  }
+
+  int64_t bytes_allocated() const override { return stats_.bytes_allocated(); }
+
+  int64_t max_memory() const override { return stats_.max_memory(); }
+
+  int64_t total_bytes_allocated() const override {
+    return stats_.total_bytes_allocated();
+  }
+
+  int64_t num_allocations() const override { return stats_.num_allocations(); }
+
+  std::string backend_name() const override { return "jemalloc"; }
+
+ private:
+  std::string ArenaCtlName(const char* suffix) const {
+    return "arena." + std::to_string(arena_index_) + "." + suffix;
+  }
+
+  Status WriteDecay(const char* which, int64_t decay_ms) {
+    ssize_t value = static_cast<ssize_t>(decay_ms);
+    const std::string ctl = ArenaCtlName(which);
+    int err = mallctl(ctl.c_str(), nullptr, nullptr, &value, sizeof(value));
+    if (err != 0) {
+      return arrow::internal::IOErrorFromErrno(err, "Failed setting ", ctl);
+    }
+    return Status::OK();
+  }
+
+  const unsigned arena_index_;
+  const int flags_;
+  arrow::internal::MemoryPoolStats stats_;
+};
+
+}  // namespace
+
+Result<std::unique_ptr<IsolatedMemoryPool>> MakeJemallocIsolatedPool(
+    int64_t dirty_decay_ms, int64_t muzzy_decay_ms) {
+  unsigned arena_index = 0;
+  size_t sz = sizeof(arena_index);
+  int err = mallctl("arenas.create", &arena_index, &sz, nullptr, 0);
+  if (err != 0) {
+    return arrow::internal::IOErrorFromErrno(err, "Failed creating jemalloc arena");
+  }
+  auto pool = std::make_unique<JemallocArenaPool>(arena_index);
+  RETURN_NOT_OK(pool->SetDecayMs(dirty_decay_ms, muzzy_decay_ms));
+  return pool;
+}
+
 }  // namespace internal
 
 }  // namespace memory_pool
@@ -181,6 +181,376 @@ TEST(ProxyMemoryPool, Logging) {
   ASSERT_EQ(0, pp.bytes_allocated());
 }
 
+TEST(ArenaMemoryPool, Basics) {
+  auto pool = MemoryPool::CreateDefault();
+  {
+    auto arena = pool->CreateArena();
+    ASSERT_EQ("arena", arena->backend_name());
+
+    uint8_t* data;
+    ASSERT_OK(arena->Allocate(100, &data));
+    ASSERT_NE(data, nullptr);
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % kDefaultBufferAlignment);
+    ASSERT_EQ(100, arena->bytes_allocated());
+
+    uint8_t* data2;
+    ASSERT_OK(arena->Allocate(50, &data2));
+    ASSERT_EQ(150, arena->bytes_allocated());
+    ASSERT_EQ(150, arena->max_memory());
+    ASSERT_EQ(2, arena->num_allocations());
+
+    // Both allocations came from a single slab obtained from the parent pool
+    ASSERT_EQ(1, pool->num_allocations());
+
+    arena->Free(data2, 50);
+    arena->Free(data, 100);
+    ASSERT_EQ(0, arena->bytes_allocated());
+    ASSERT_EQ(150, arena->total_bytes_allocated());
+
+    ASSERT_RAISES(Invalid, arena->Allocate(-1, &data));
+  }
+  // Slabs are handed back wholesale on destruction
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, ZeroSizeAllocations) {
+  auto pool = MemoryPool::CreateDefault();
+  auto arena = pool->CreateArena();
+
+  uint8_t* data;
+  ASSERT_OK(arena->Allocate(0, &data));
+  ASSERT_NE(data, nullptr);
+  ASSERT_OK(arena->Reallocate(0, 100, &data));
+  ASSERT_OK(arena->Reallocate(100, 0, &data));
+  arena->Free(data, 0);
+  ASSERT_EQ(0, arena->bytes_allocated());
+}
+
+TEST(ArenaMemoryPool, Alignment) {
+  auto pool = MemoryPool::CreateDefault();
+  auto arena = pool->CreateArena();
+
+  for (int64_t alignment : {64, 128, 256, 512}) {
+    uint8_t* data;
+    ASSERT_OK(arena->Allocate(13, alignment, &data));
+    ASSERT_EQ(0, reinterpret_cast<uintptr_t>(data) % alignment);
+    arena->Free(data, 13, alignment);
+  }
+}
+
+TEST(ArenaMemoryPool, ReallocateTopInPlace) {
+  auto pool = MemoryPool::CreateDefault();
+  auto arena = pool->CreateArena();
+
+  uint8_t* data;
+  ASSERT_OK(arena->Allocate(100, &data));
+  data[99] = 42;
+  // The most recent allocation grows in place
+  uint8_t* grown = data;
+  ASSERT_OK(arena->Reallocate(100, 200, &grown));
+  ASSERT_EQ(data, grown);
+  ASSERT_EQ(42, grown[99]);
+  ASSERT_EQ(200, arena->bytes_allocated());
+
+  // An older allocation moves when grown and its contents are preserved
+  uint8_t* data2;
+  ASSERT_OK(arena->Allocate(64, &data2));
+  ASSERT_OK(arena->Reallocate(200, 300, &grown));
+  ASSERT_NE(data, grown);
+  ASSERT_EQ(42, grown[99]);
+
+  // Shrinking never moves
+  uint8_t* shrunk = grown;
+  ASSERT_OK(arena->Reallocate(300, 10, &shrunk));
+  ASSERT_EQ(grown, shrunk);
+}
+
+TEST(ArenaMemoryPool, LargeAllocations) {
+  auto pool = MemoryPool::CreateDefault();
+  auto arena = pool->CreateArena(/*slab_size=*/1024);
+
+  // Requests larger than the slab size get a dedicated slab
+  uint8_t* data;
+  ASSERT_OK(arena->Allocate(10000, &data));
+  ASSERT_EQ(10000, arena->bytes_allocated());
+  ASSERT_GE(pool->bytes_allocated(), 10000);
+
+  // Smaller allocations keep working afterwards
+  uint8_t* data2;
+  ASSERT_OK(arena->Allocate(100, &data2));
+  arena->Free(data2, 100);
+  arena->Free(data, 10000);
+  ASSERT_EQ(0, arena->bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, RecyclesFreedBlocks) {
+  auto pool = MemoryPool::CreateDefault();
+  RecyclingMemoryPool rp(pool.get());
+  ASSERT_EQ("recycling", rp.backend_name());
+
+  uint8_t* data;
+  ASSERT_OK(rp.Allocate(1000, &data));
+  const int64_t parent_allocations = pool->num_allocations();
+  rp.Free(data, 1000);
+  // The block stays cached rather than going back to the backing pool
+  ASSERT_GT(rp.cached_bytes(), 0);
+  ASSERT_EQ(0, rp.bytes_allocated());
+
+  // A same-class allocation is served from the cache
+  uint8_t* data2;
+  ASSERT_OK(rp.Allocate(900, &data2));
+  ASSERT_EQ(data, data2);
+  ASSERT_EQ(parent_allocations, pool->num_allocations());
+  ASSERT_EQ(900, rp.bytes_allocated());
+  rp.Free(data2, 900);
+
+  rp.ReleaseUnused();
+  ASSERT_EQ(0, rp.cached_bytes());
+  ASSERT_EQ(0, pool->bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, BoundedCache) {
+  auto pool = MemoryPool::CreateDefault();
+  RecyclingMemoryPool rp(pool.get(), /*max_cached_bytes=*/4096);
+
+  uint8_t* data1;
+  uint8_t* data2;
+  ASSERT_OK(rp.Allocate(4096, &data1));
+  ASSERT_OK(rp.Allocate(4096, &data2));
+  rp.Free(data1, 4096);
+  rp.Free(data2, 4096);
+  // Only one block fits in the cache, the other went back to the backing pool
+  ASSERT_EQ(4096, rp.cached_bytes());
+  ASSERT_EQ(4096, pool->bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, Reallocate) {
+  auto pool = MemoryPool::CreateDefault();
+  RecyclingMemoryPool rp(pool.get());
+
+  uint8_t* data;
+  ASSERT_OK(rp.Allocate(1000, &data));
+  data[999] = 42;
+  // Growing within the same size class keeps the block
+  uint8_t* grown = data;
+  ASSERT_OK(rp.Reallocate(1000, 1024, &grown));
+  ASSERT_EQ(data, grown);
+  ASSERT_EQ(1024, rp.bytes_allocated());
+  // Growing past the class moves the data and caches the old block
+  ASSERT_OK(rp.Reallocate(1024, 5000, &grown));
+  ASSERT_EQ(42, grown[999]);
+  ASSERT_GT(rp.cached_bytes(), 0);
+  rp.Free(grown, 5000);
+  ASSERT_EQ(0, rp.bytes_allocated());
+}
+
+TEST(RecyclingMemoryPool, BypassesCache) {
+  auto pool = MemoryPool::CreateDefault();
+  RecyclingMemoryPool rp(pool.get());
+
+  // Oversized and non-default-aligned allocations go straight to the backing
+  // pool and are not cached on free
+  uint8_t* big;
+  ASSERT_OK(rp.Allocate(64 * 1024 * 1024, &big));
+  rp.Free(big, 64 * 1024 * 1024);
+  uint8_t* aligned;
+  ASSERT_OK(rp.Allocate(1000, /*alignment=*/512, &aligned));
+  ASSERT_EQ(0, reinterpret_cast<uintptr_t>(aligned) % 512);
+  rp.Free(aligned, 1000, /*alignment=*/512);
+  ASSERT_EQ(0, rp.cached_bytes());
+  ASSERT_EQ(0, pool->bytes_allocated());
+
+  // Zero-size allocations are likewise passed through
+  uint8_t* zero;
+  ASSERT_OK(rp.Allocate(0, &zero));
+  ASSERT_NE(zero, nullptr);
+  rp.Free(zero, 0);
+}
+
+TEST(PlacementMemoryPool, HugePageAllocations) {
+  auto pool = MemoryPool::CreateDefault();
+  MemoryPlacementOptions options;
+  options.placement_threshold = 1024 * 1024;
+  auto maybe_placed = PlacementMemoryPool::Make(pool.get(), options);
+  if (!maybe_placed.ok()) {
+    GTEST_SKIP() << "memory placement not supported: " << maybe_placed.status();
+  }
+  auto placed = std::move(maybe_placed).ValueOrDie();
+  ASSERT_EQ("placement", placed->backend_name());
+
+  // Above the threshold: mapped directly, not through the backing pool
+  uint8_t* data;
+  ASSERT_OK(placed->Allocate(4 * 1024 * 1024, &data));
+  data[0] = 42;
+  ASSERT_EQ(4 * 1024 * 1024, placed->bytes_allocated());
+  ASSERT_EQ(0, pool->bytes_allocated());
+  ASSERT_OK_AND_ASSIGN(int node, GetMemoryNode(data));
+  ASSERT_GE(node, 0);
+  placed->Free(data, 4 * 1024 * 1024);
+  ASSERT_EQ(0, placed->bytes_allocated());
+
+  // Below the threshold: delegated to the backing pool
+  ASSERT_OK(placed->Allocate(1024, &data));
+  ASSERT_EQ(1024, pool->bytes_allocated());
+  placed->Free(data, 1024);
+}
+
+TEST(PlacementMemoryPool, Interleave) {
+  auto pool = MemoryPool::CreateDefault();
+  MemoryPlacementOptions options;
+  options.placement = MemoryPlacement::kInterleave;
+  options.placement_threshold = 1024 * 1024;
+  auto maybe_placed = PlacementMemoryPool::Make(pool.get(), options);
+  if (!maybe_placed.ok()) {
+    GTEST_SKIP() << "memory placement not supported: " << maybe_placed.status();
+  }
+  auto placed = std::move(maybe_placed).ValueOrDie();
+
+  uint8_t* data;
+  ASSERT_OK(placed->Allocate(2 * 1024 * 1024, &data));
+  memset(data, 0, 2 * 1024 * 1024);
+  placed->Free(data, 2 * 1024 * 1024);
+}
+
+TEST(PlacementMemoryPool, InvalidOptions) {
+  auto pool = MemoryPool::CreateDefault();
+  MemoryPlacementOptions options;
+  options.placement = MemoryPlacement::kBindNode;
+  options.numa_node = -1;
+  auto maybe_placed = PlacementMemoryPool::Make(pool.get(), options);
+  if (maybe_placed.status().IsNotImplemented()) {
+    GTEST_SKIP() << "memory placement not supported";
+  }
+  ASSERT_RAISES(Invalid, maybe_placed);
+}
+
+TEST(MemoryPressureMonitor, WatermarkCallbacks) {
+  auto pool = MemoryPool::CreateDefault();
+  auto monitor = std::make_shared<MemoryPressureMonitor>();
+  MonitoredMemoryPool mp(pool.get(), "test", monitor);
+
+  int fired = 0;
+  int64_t id = monitor->AddCallback(1000, [&fired](int64_t) { ++fired; });
+
+  uint8_t* data;
+  ASSERT_OK(mp.Allocate(500, &data));
+  ASSERT_EQ(0, fired);
+  uint8_t* data2;
+  ASSERT_OK(mp.Allocate(600, &data2));
+  ASSERT_EQ(1, fired);
+  // The callback only fires once per crossing
+  uint8_t* data3;
+  ASSERT_OK(mp.Allocate(100, &data3));
+  ASSERT_EQ(1, fired);
+  // ... and is re-armed once usage falls below the watermark
+  mp.Free(data2, 600);
+  mp.Free(data3, 100);
+  ASSERT_OK(mp.Allocate(600, &data2));
+  ASSERT_EQ(2, fired);
+  mp.Free(data2, 600);
+  mp.Free(data, 500);
+
+  ASSERT_TRUE(monitor->RemoveCallback(id));
+  ASSERT_FALSE(monitor->RemoveCallback(id));
+}
+
+TEST(MemoryPressureMonitor, SoftLimit) {
+  auto pool = MemoryPool::CreateDefault();
+  auto monitor = std::make_shared<MemoryPressureMonitor>(/*soft_limit_bytes=*/1024);
+  MonitoredMemoryPool mp(pool.get(), "test", monitor);
+
+  uint8_t* data;
+  ASSERT_OK(mp.Allocate(1000, &data));
+  uint8_t* data2;
+  ASSERT_RAISES(OutOfMemory, mp.Allocate(100, &data2));
+  // A failed allocation does not leak accounting
+  ASSERT_EQ(1000, monitor->bytes_allocated());
+  mp.Free(data, 1000);
+  ASSERT_EQ(0, monitor->bytes_allocated());
+}
+
+TEST(MonitoredMemoryPool, SubsystemAccounting) {
+  auto pool = MemoryPool::CreateDefault();
+  auto monitor = std::make_shared<MemoryPressureMonitor>();
+  MonitoredMemoryPool readers(pool.get(), "readers", monitor);
+  MonitoredMemoryPool caches(pool.get(), "caches", monitor);
+  ASSERT_EQ("readers", readers.subsystem_name());
+
+  uint8_t* data;
+  ASSERT_OK(readers.Allocate(300, &data));
+  uint8_t* data2;
+  ASSERT_OK(caches.Allocate(200, &data2));
+  // Usage is coordinated across subsystems but high-water marks are per pool
+  ASSERT_EQ(500, monitor->bytes_allocated());
+  ASSERT_EQ(300, readers.max_memory());
+  ASSERT_EQ(200, caches.max_memory());
+
+  ASSERT_OK(readers.Reallocate(300, 600, &data));
+  ASSERT_EQ(800, monitor->bytes_allocated());
+  readers.Free(data, 600);
+  caches.Free(data2, 200);
+  ASSERT_EQ(0, monitor->bytes_allocated());
+  ASSERT_EQ(600, readers.max_memory());
+}
+
+TEST(QuotaMemoryPool, HierarchicalLimits) {
+  auto root = QuotaMemoryPool::Make(default_memory_pool(), /*hard_limit_bytes=*/1000);
+  auto tenant_a = root->MakeChild(/*hard_limit_bytes=*/600);
+  auto tenant_b = root->MakeChild(/*hard_limit_bytes=*/600);
+
+  uint8_t* a1;
+  ASSERT_OK(tenant_a->Allocate(500, &a1));
+  ASSERT_EQ(tenant_a->bytes_allocated(), 500);
+  ASSERT_EQ(root->reserved_bytes(), 500);
+
+  // The child's own limit applies...
+  uint8_t* data;
+  ASSERT_RAISES(OutOfMemory, tenant_a->Allocate(200, &data));
+
+  // ... and so does the limit shared with the sibling tenant
+  uint8_t* b1;
+  ASSERT_OK(tenant_b->Allocate(400, &b1));
+  ASSERT_RAISES(OutOfMemory, tenant_b->Allocate(200, &data));
+
+  // Failed reservations leave no residue at any level
+  ASSERT_EQ(root->reserved_bytes(), 900);
+  ASSERT_EQ(tenant_a->reserved_bytes(), 500);
+  ASSERT_EQ(tenant_b->reserved_bytes(), 400);
+
+  // Freeing one tenant's memory lets the other proceed
+  tenant_a->Free(a1, 500);
+  ASSERT_OK(tenant_b->Allocate(200, &data));
+  tenant_b->Free(b1, 400);
+  tenant_b->Free(data, 200);
+  ASSERT_EQ(root->reserved_bytes(), 0);
+}
+
+TEST(QuotaMemoryPool, Reallocate) {
+  auto root = QuotaMemoryPool::Make(default_memory_pool(), /*hard_limit_bytes=*/1000);
+
+  uint8_t* data;
+  ASSERT_OK(root->Allocate(400, &data));
+  ASSERT_OK(root->Reallocate(400, 800, &data));
+  ASSERT_EQ(root->reserved_bytes(), 800);
+  ASSERT_RAISES(OutOfMemory, root->Reallocate(800, 1200, &data));
+  ASSERT_OK(root->Reallocate(800, 100, &data));
+  ASSERT_EQ(root->reserved_bytes(), 100);
+  root->Free(data, 100);
+  ASSERT_EQ(root->bytes_allocated(), 0);
+  ASSERT_EQ(root->max_memory(), 800);
+}
+
+TEST(QuotaMemoryPool, SoftLimit) {
+  auto root = QuotaMemoryPool::Make(default_memory_pool(), /*hard_limit_bytes=*/-1,
+                                    /*soft_limit_bytes=*/100);
+
+  // Crossing the soft limit only triggers best-effort reclamation
+  uint8_t* data;
+  ASSERT_OK(root->Allocate(500, &data));
+  ASSERT_EQ(root->reserved_bytes(), 500);
+  root->Free(data, 500);
+}
+
 TEST(Jemalloc, SetDirtyPageDecayMillis) {
   // ARROW-6910
 #ifdef ARROW_JEMALLOC
@@ -190,6 +560,38 @@ TEST(Jemalloc, SetDirtyPageDecayMillis) {
 #endif
 }
 
+TEST(Jemalloc, IsolatedMemoryPool) {
+  ASSERT_RAISES(Invalid, MemoryPool::CreateIsolated(/*dirty_decay_ms=*/-2));
+#ifdef ARROW_JEMALLOC
+  ASSERT_OK_AND_ASSIGN(auto pool, MemoryPool::CreateIsolated());
+  ASSERT_EQ("jemalloc", pool->backend_name());
+
+  uint8_t* data;
+  ASSERT_OK(pool->Allocate(1024, &data));
+  ASSERT_EQ(pool->bytes_allocated(), 1024);
+  data[0] = 0;
+  data[1023] = 0;
+
+  // Statistics are per arena: only this pool's allocations are counted
+  ASSERT_OK_AND_ASSIGN(int64_t small_allocated, pool->GetArenaStat("small.allocated"));
+  ASSERT_GE(small_allocated, 1024);
+
+  // A second isolated pool starts from a pristine arena
+  ASSERT_OK_AND_ASSIGN(auto other, MemoryPool::CreateIsolated());
+  ASSERT_OK_AND_ASSIGN(int64_t other_allocated, other->GetArenaStat("small.allocated"));
+  ASSERT_EQ(other_allocated, 0);
+
+  // Decay tuning only affects this pool's arena
+  ASSERT_OK(pool->SetDecayMs(/*dirty_decay_ms=*/0, /*muzzy_decay_ms=*/0));
+
+  pool->Free(data, 1024);
+  ASSERT_EQ(pool->bytes_allocated(), 0);
+  pool->ReleaseUnused();
+#else
+  ASSERT_RAISES(NotImplemented, MemoryPool::CreateIsolated());
+#endif
+}
+
 TEST(Jemalloc, GetAllocationStats) {
 #ifdef ARROW_JEMALLOC
   uint8_t* data;
@@ -144,6 +144,9 @@ class ArrayPrinter : public PrettyPrinter {
     // indentation itself.
     int window = is_container ? options_.container_window : options_.window;
     for (int64_t i = 0; i < array.length(); ++i) {
+      if (ARROW_PREDICT_FALSE(!sink_->good())) {
+        break;
+      }
       const bool is_last = (i == array.length() - 1);
       // check if `length == 2 * window + 1` to eliminate ellipsis for only one element
       if ((array.length() != 2 * window + 1) && (i >= window) &&
@@ -421,6 +424,68 @@ Status ArrayPrinter::WriteValidityBitmap(const Array& array) {
   }
 }
 
+// A streambuf that forwards up to a byte budget to the wrapped streambuf and
+// discards everything past it.  Once the budget is exhausted it reports write
+// failures, putting the owning stream into a failed state so that the
+// printing loops below stop formatting values early.
+class BudgetedStreamBuf : public std::streambuf {
+ public:
+  BudgetedStreamBuf(std::streambuf* wrapped, int64_t budget)
+      : wrapped_(wrapped), remaining_(budget) {}
+
+  bool truncated() const { return truncated_; }
+
+ protected:
+  int_type overflow(int_type ch) override {
+    if (ch == traits_type::eof()) {
+      return traits_type::not_eof(ch);
+    }
+    if (remaining_ <= 0) {
+      truncated_ = true;
+      return traits_type::eof();
+    }
+    --remaining_;
+    return wrapped_->sputc(traits_type::to_char_type(ch));
+  }
+
+  std::streamsize xsputn(const char* s, std::streamsize n) override {
+    if (remaining_ <= 0) {
+      truncated_ = true;
+      return 0;
+    }
+    const auto to_write = std::min<std::streamsize>(n, remaining_);
+    const auto written = wrapped_->sputn(s, to_write);
+    remaining_ -= written;
+    if (written < n) {
+      truncated_ = true;
+      return 0;
+    }
+    return n;
+  }
+
+ private:
+  std::streambuf* wrapped_;
+  int64_t remaining_;
+  bool truncated_ = false;
+};
+
+// Run a printing function against a budget-limited view of `sink`, appending
+// a truncation marker if the budget was exhausted
+template <typename PrintFunction>
+Status PrintWithBudget(const PrettyPrintOptions& options, std::ostream* sink,
+                       PrintFunction&& print) {
+  BudgetedStreamBuf buf(sink->rdbuf(), options.max_output_bytes);
+  std::ostream budgeted_sink(&buf);
+  PrettyPrintOptions inner_options = options;
+  inner_options.max_output_bytes = -1;
+  RETURN_NOT_OK(print(inner_options, &budgeted_sink));
+  if (buf.truncated()) {
+    (*sink) << "\n... (output truncated after " << options.max_output_bytes
+            << " bytes)\n";
+  }
+  return Status::OK();
+}
+
 }  // namespace
 
 Status PrettyPrint(const Array& arr, int indent, std::ostream* sink) {
@@ -432,6 +497,12 @@ Status PrettyPrint(const Array& arr, int indent, std::ostream* sink) {
 
 Status PrettyPrint(const Array& arr, const PrettyPrintOptions& options,
                    std::ostream* sink) {
+  if (options.max_output_bytes >= 0) {
+    return PrintWithBudget(options, sink,
+                           [&](const PrettyPrintOptions& inner, std::ostream* out) {
+                             return PrettyPrint(arr, inner, out);
+                           });
+  }
   ArrayPrinter printer(options, sink);
   return printer.Print(arr);
 }
@@ -446,6 +517,12 @@ Status PrettyPrint(const Array& arr, const PrettyPrintOptions& options,
 
 Status PrettyPrint(const ChunkedArray& chunked_arr, const PrettyPrintOptions& options,
                    std::ostream* sink) {
+  if (options.max_output_bytes >= 0) {
+    return PrintWithBudget(options, sink,
+                           [&](const PrettyPrintOptions& inner, std::ostream* out) {
+                             return PrettyPrint(chunked_arr, inner, out);
+                           });
+  }
   int num_chunks = chunked_arr.num_chunks();
   int indent = options.indent;
   int window = options.container_window;
@@ -462,6 +539,9 @@ Status PrettyPrint(const ChunkedArray& chunked_arr, const PrettyPrintOptions& op
   }
   bool skip_element_delimiter = true;
   for (int i = 0; i < num_chunks; ++i) {
+    if (ARROW_PREDICT_FALSE(!sink->good())) {
+      break;
+    }
     if (skip_element_delimiter) {
       skip_element_delimiter = false;
     } else {
@@ -521,7 +601,16 @@ Status PrettyPrint(const RecordBatch& batch, int indent, std::ostream* sink) {
 
 Status PrettyPrint(const RecordBatch& batch, const PrettyPrintOptions& options,
                    std::ostream* sink) {
+  if (options.max_output_bytes >= 0) {
+    return PrintWithBudget(options, sink,
+                           [&](const PrettyPrintOptions& inner, std::ostream* out) {
+                             return PrettyPrint(batch, inner, out);
+                           });
+  }
   for (int i = 0; i < batch.num_columns(); ++i) {
+    if (ARROW_PREDICT_FALSE(!sink->good())) {
+      break;
+    }
     const std::string& name = batch.column_name(i);
     PrettyPrintOptions column_options = options;
     column_options.indent += 2;
@@ -536,6 +625,12 @@ Status PrettyPrint(const RecordBatch& batch, const PrettyPrintOptions& options,
 
 Status PrettyPrint(const Table& table, const PrettyPrintOptions& options,
                    std::ostream* sink) {
+  if (options.max_output_bytes >= 0) {
+    return PrintWithBudget(options, sink,
+                           [&](const PrettyPrintOptions& inner, std::ostream* out) {
+                             return PrettyPrint(table, inner, out);
+                           });
+  }
   RETURN_NOT_OK(PrettyPrint(*table.schema(), options, sink));
   (*sink) << "\n";
   (*sink) << "----\n";
@@ -543,6 +638,11 @@ Status PrettyPrint(const Table& table, const PrettyPrintOptions& options,
   PrettyPrintOptions column_options = options;
   column_options.indent += 2;
   for (int i = 0; i < table.num_columns(); ++i) {
+    if (ARROW_PREDICT_FALSE(!sink->good())) {
+      // The sink stopped accepting output (e.g. the diagnostic byte budget
+      // was exhausted): stop formatting columns
+      break;
+    }
     for (int j = 0; j < options.indent; ++j) {
       (*sink) << " ";
     }
@@ -93,6 +93,13 @@ struct ARROW_EXPORT PrettyPrintOptions {
   /// 80 character width
   bool truncate_metadata = true;
 
+  /// Cap on the total number of formatted bytes emitted, or -1 for no limit
+  ///
+  /// When the budget is exhausted, printing stops early and a truncation
+  /// marker is appended, bounding the cost of printing large tables in
+  /// diagnostic contexts.
+  int64_t max_output_bytes = -1;
+
   /// If true, display field metadata when pretty-printing a Schema
   bool show_field_metadata = true;
 
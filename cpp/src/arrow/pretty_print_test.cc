@@ -1317,6 +1317,30 @@ column:
   CheckStream(*table, {0}, expected);
 }
 
+TEST_F(TestPrettyPrint, TableMaxOutputBytes) {
+  auto int_field = field("column", int32());
+  auto array = ArrayFromJSON(int_field->type(), "[0, 1, null, 3, null]");
+  auto column = std::make_shared<ChunkedArray>(ArrayVector({array}));
+  auto table = Table::Make(schema({int_field}), {column});
+
+  PrettyPrintOptions options{0};
+  options.max_output_bytes = 64;
+
+  std::ostringstream sink;
+  ASSERT_OK(PrettyPrint(*table, options, &sink));
+  const std::string output = sink.str();
+  // Budget plus the truncation marker bounds the output size
+  ASSERT_LE(output.size(), static_cast<size_t>(options.max_output_bytes) + 64);
+  ASSERT_NE(output.find("output truncated"), std::string::npos);
+
+  // A generous budget leaves the output untouched
+  std::ostringstream unbudgeted_sink, full_sink;
+  options.max_output_bytes = 1 << 20;
+  ASSERT_OK(PrettyPrint(*table, options, &full_sink));
+  ASSERT_OK(PrettyPrint(*table, PrettyPrintOptions{0}, &unbudgeted_sink));
+  ASSERT_EQ(full_sink.str(), unbudgeted_sink.str());
+}
+
 TEST_F(TestPrettyPrint, SchemaWithDictionary) {
   std::vector<bool> is_valid = {true, true, false, true, true, true};
 
@@ -182,16 +182,7 @@ class SimpleRecordBatch : public RecordBatch {
                              sync_event_);
   }
 
-  std::shared_ptr<RecordBatch> Slice(int64_t offset, int64_t length) const override {
-    std::vector<std::shared_ptr<ArrayData>> arrays;
-    arrays.reserve(num_columns());
-    for (const auto& field : columns_) {
-      arrays.emplace_back(field->Slice(offset, length));
-    }
-    int64_t num_rows = std::min(num_rows_ - offset, length);
-    return std::make_shared<SimpleRecordBatch>(schema_, num_rows, std::move(arrays),
-                                               device_type_, sync_event_);
-  }
+  std::shared_ptr<RecordBatch> Slice(int64_t offset, int64_t length) const override;
 
   Status Validate() const override {
     if (static_cast<int>(columns_.size()) != schema_->num_fields()) {
@@ -218,6 +209,118 @@ class SimpleRecordBatch : public RecordBatch {
   std::shared_ptr<Device::SyncEvent> sync_event_;
 };
 
+/// \class SlicedRecordBatch
+/// \brief A flyweight view over a window of another record batch
+///
+/// Slicing only records the (offset, length) window and shares the parent's
+/// columns; per-column sliced ArrayData is derived lazily (and cached) when a
+/// column is actually accessed, so Slice itself is O(1) in the number of
+/// columns.
+class SlicedRecordBatch : public RecordBatch {
+ public:
+  SlicedRecordBatch(std::shared_ptr<const RecordBatch> parent, int64_t offset,
+                    int64_t num_rows)
+      : RecordBatch(parent->schema(), num_rows),
+        parent_(std::move(parent)),
+        offset_(offset) {
+    sliced_columns_.resize(schema_->num_fields());
+    boxed_columns_.resize(schema_->num_fields());
+  }
+
+  const std::vector<std::shared_ptr<Array>>& columns() const override {
+    for (int i = 0; i < num_columns(); ++i) {
+      // Force all columns to be boxed
+      column(i);
+    }
+    return boxed_columns_;
+  }
+
+  std::shared_ptr<Array> column(int i) const override {
+    std::shared_ptr<Array> result = std::atomic_load(&boxed_columns_[i]);
+    if (!result) {
+      auto new_array = MakeArray(column_data(i));
+      // See the note on concurrent boxing in SimpleRecordBatch::column (GH-45371)
+      if (std::atomic_compare_exchange_strong(&boxed_columns_[i], &result, new_array)) {
+        return new_array;
+      }
+    }
+    return result;
+  }
+
+  std::shared_ptr<ArrayData> column_data(int i) const override {
+    std::shared_ptr<ArrayData> result = std::atomic_load(&sliced_columns_[i]);
+    if (!result) {
+      auto sliced = parent_->column_data(i)->Slice(offset_, num_rows_);
+      if (std::atomic_compare_exchange_strong(&sliced_columns_[i], &result, sliced)) {
+        return sliced;
+      }
+    }
+    return result;
+  }
+
+  const ArrayDataVector& column_data() const override {
+    for (int i = 0; i < num_columns(); ++i) {
+      // Force all column slices to be derived
+      column_data(i);
+    }
+    return sliced_columns_;
+  }
+
+  Result<std::shared_ptr<RecordBatch>> AddColumn(
+      int i, const std::shared_ptr<Field>& field,
+      const std::shared_ptr<Array>& column) const override {
+    return Materialize()->AddColumn(i, field, column);
+  }
+
+  Result<std::shared_ptr<RecordBatch>> SetColumn(
+      int i, const std::shared_ptr<Field>& field,
+      const std::shared_ptr<Array>& column) const override {
+    return Materialize()->SetColumn(i, field, column);
+  }
+
+  Result<std::shared_ptr<RecordBatch>> RemoveColumn(int i) const override {
+    return Materialize()->RemoveColumn(i);
+  }
+
+  std::shared_ptr<RecordBatch> ReplaceSchemaMetadata(
+      const std::shared_ptr<const KeyValueMetadata>& metadata) const override {
+    return std::make_shared<SlicedRecordBatch>(parent_->ReplaceSchemaMetadata(metadata),
+                                               offset_, num_rows_);
+  }
+
+  std::shared_ptr<RecordBatch> Slice(int64_t offset, int64_t length) const override {
+    // Re-slice the parent directly to keep view chains flat
+    const int64_t num_rows = std::min(num_rows_ - offset, length);
+    return std::make_shared<SlicedRecordBatch>(parent_, offset_ + offset, num_rows);
+  }
+
+  const std::shared_ptr<Device::SyncEvent>& GetSyncEvent() const override {
+    return parent_->GetSyncEvent();
+  }
+
+  DeviceAllocationType device_type() const override { return parent_->device_type(); }
+
+ private:
+  // An eager batch with this view's columns, for delegating schema mutations
+  std::shared_ptr<RecordBatch> Materialize() const {
+    return RecordBatch::Make(schema_, num_rows_, column_data(), device_type(),
+                             GetSyncEvent());
+  }
+
+  std::shared_ptr<const RecordBatch> parent_;
+  int64_t offset_;
+
+  // Lazily derived column slices and boxed arrays
+  mutable ArrayDataVector sliced_columns_;
+  mutable std::vector<std::shared_ptr<Array>> boxed_columns_;
+};
+
+std::shared_ptr<RecordBatch> SimpleRecordBatch::Slice(int64_t offset,
+                                                      int64_t length) const {
+  const int64_t num_rows = std::min(num_rows_ - offset, length);
+  return std::make_shared<SlicedRecordBatch>(shared_from_this(), offset, num_rows);
+}
+
 RecordBatch::RecordBatch(std::shared_ptr<Schema> schema, int64_t num_rows)
     : schema_(std::move(schema)), num_rows_(num_rows) {}
 
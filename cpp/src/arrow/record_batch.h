@@ -38,7 +38,7 @@ namespace arrow {
 ///
 /// A record batch is table-like data structure that is semantically a sequence
 /// of fields, each a contiguous Arrow array
-class ARROW_EXPORT RecordBatch {
+class ARROW_EXPORT RecordBatch : public std::enable_shared_from_this<RecordBatch> {
  public:
   virtual ~RecordBatch() = default;
 
@@ -235,6 +235,12 @@ class ARROW_EXPORT RecordBatch {
   virtual std::shared_ptr<RecordBatch> Slice(int64_t offset) const;
 
   /// \brief Slice each of the arrays in the record batch
+  ///
+  /// The returned batch is a flyweight view sharing this batch's columns:
+  /// per-column sliced array data is only derived (and then cached) when a
+  /// column is actually accessed, so slicing itself is O(1) in the number of
+  /// columns.
+  ///
   /// \param[in] offset the starting offset to slice
   /// \param[in] length the number of elements to slice from offset
   /// \return new record batch
@@ -203,6 +203,22 @@ TEST_F(TestRecordBatch, Slice) {
   // ArrayData::null_count to kUnknownNullCount
   ASSERT_EQ(batch_slice->column(2)->data()->null_count, 0);
   ASSERT_EQ(batch_slice2->column(2)->data()->null_count, 0);
+
+  // Slices are flyweight views; check that a slice of a slice resolves
+  // against the original batch and that schema mutations still work
+  auto batch_slice3 = batch_slice2->Slice(1, 3);
+  ASSERT_EQ(3, batch_slice3->num_rows());
+  for (int i = 0; i < batch->num_columns(); ++i) {
+    ASSERT_EQ(2, batch_slice3->column(i)->offset());
+    ASSERT_EQ(3, batch_slice3->column(i)->length());
+  }
+  ASSERT_BATCHES_EQUAL(*batch->Slice(2, 3), *batch_slice3);
+
+  auto f3 = field("f3", int8());
+  auto a3 = ArrayFromJSON(int8(), "[7, 8, 9]");
+  ASSERT_OK_AND_ASSIGN(auto with_column, batch_slice3->AddColumn(3, f3, a3));
+  ASSERT_EQ(4, with_column->num_columns());
+  ASSERT_OK(with_column->ValidateFull());
 }
 
 TEST_F(TestRecordBatch, AddColumn) {
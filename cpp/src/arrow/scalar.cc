@@ -997,6 +997,53 @@ std::shared_ptr<Scalar> MakeNullScalar(std::shared_ptr<DataType> type) {
   return MakeNullImpl{std::move(type), nullptr}.Finish();
 }
 
+namespace internal {
+
+std::shared_ptr<Scalar> GetCachedNullScalar(const std::shared_ptr<DataType>& type) {
+  // Only cache for types whose DataType instances are singletons, so the
+  // cached scalar carries the canonical type pointer.  The returned scalars
+  // are shared and must never be mutated, hence the dedicated factory:
+  // MakeNullScalar callers are allowed to flip is_valid on the result.
+#define CACHED_NULL_SCALAR_CASE(TYPE_ID, FACTORY) \
+  case Type::TYPE_ID: {                           \
+    static const auto kCached##TYPE_ID =          \
+        std::shared_ptr<Scalar>(MakeNullScalar(FACTORY())); \
+    return kCached##TYPE_ID;                      \
+  }
+  switch (type->id()) {
+    CACHED_NULL_SCALAR_CASE(NA, null)
+    CACHED_NULL_SCALAR_CASE(BOOL, boolean)
+    CACHED_NULL_SCALAR_CASE(UINT8, uint8)
+    CACHED_NULL_SCALAR_CASE(INT8, int8)
+    CACHED_NULL_SCALAR_CASE(UINT16, uint16)
+    CACHED_NULL_SCALAR_CASE(INT16, int16)
+    CACHED_NULL_SCALAR_CASE(UINT32, uint32)
+    CACHED_NULL_SCALAR_CASE(INT32, int32)
+    CACHED_NULL_SCALAR_CASE(UINT64, uint64)
+    CACHED_NULL_SCALAR_CASE(INT64, int64)
+    CACHED_NULL_SCALAR_CASE(HALF_FLOAT, float16)
+    CACHED_NULL_SCALAR_CASE(FLOAT, float32)
+    CACHED_NULL_SCALAR_CASE(DOUBLE, float64)
+    CACHED_NULL_SCALAR_CASE(DATE32, date32)
+    CACHED_NULL_SCALAR_CASE(DATE64, date64)
+    CACHED_NULL_SCALAR_CASE(STRING, utf8)
+    CACHED_NULL_SCALAR_CASE(BINARY, binary)
+    CACHED_NULL_SCALAR_CASE(LARGE_STRING, large_utf8)
+    CACHED_NULL_SCALAR_CASE(LARGE_BINARY, large_binary)
+    default:
+      return MakeNullScalar(type);
+  }
+#undef CACHED_NULL_SCALAR_CASE
+}
+
+std::shared_ptr<Scalar> GetCachedBooleanScalar(bool value) {
+  static const auto kTrue = std::make_shared<BooleanScalar>(true);
+  static const auto kFalse = std::make_shared<BooleanScalar>(false);
+  return value ? kTrue : kFalse;
+}
+
+}  // namespace internal
+
 std::string Scalar::ToString() const {
   if (!this->is_valid) {
     return "null";
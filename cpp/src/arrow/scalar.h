@@ -911,6 +911,20 @@ inline Status CheckBufferLength(...) { return Status::OK(); }
 ARROW_EXPORT Status CheckBufferLength(const FixedSizeBinaryType* t,
                                       const std::shared_ptr<Buffer>* b);
 
+/// \brief Return an interned null scalar for the given type
+///
+/// For non-parametric types the same immutable instance is returned on every
+/// call, avoiding a heap allocation per scalar; for other types this falls
+/// back to MakeNullScalar.  The returned scalar is shared: callers must not
+/// mutate it.
+ARROW_EXPORT std::shared_ptr<Scalar> GetCachedNullScalar(
+    const std::shared_ptr<DataType>& type);
+
+/// \brief Return an interned valid boolean scalar
+///
+/// The returned scalar is shared: callers must not mutate it.
+ARROW_EXPORT std::shared_ptr<Scalar> GetCachedBooleanScalar(bool value);
+
 }  // namespace internal
 
 template <typename ValueRef>
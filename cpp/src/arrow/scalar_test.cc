@@ -89,6 +89,31 @@ TEST(TestNullScalar, Basics) {
   ASSERT_OK(first->ValidateFull());
 }
 
+TEST(TestScalar, GetCachedNullScalar) {
+  // Non-parametric types are interned: every call returns the same instance
+  for (auto ty : {null(), boolean(), int32(), float64(), utf8(), large_binary()}) {
+    auto scalar = internal::GetCachedNullScalar(ty);
+    ASSERT_OK(scalar->ValidateFull());
+    AssertTypeEqual(*ty, *scalar->type);
+    ASSERT_FALSE(scalar->is_valid);
+    ASSERT_EQ(scalar.get(), internal::GetCachedNullScalar(ty).get());
+  }
+  // Parametric types fall back to a fresh scalar per call
+  auto ts = timestamp(TimeUnit::MICRO);
+  auto scalar = internal::GetCachedNullScalar(ts);
+  AssertTypeEqual(*ts, *scalar->type);
+  ASSERT_NE(scalar.get(), internal::GetCachedNullScalar(ts).get());
+}
+
+TEST(TestScalar, GetCachedBooleanScalar) {
+  auto scalar_true = internal::GetCachedBooleanScalar(true);
+  auto scalar_false = internal::GetCachedBooleanScalar(false);
+  ASSERT_TRUE(checked_cast<const BooleanScalar&>(*scalar_true).value);
+  ASSERT_FALSE(checked_cast<const BooleanScalar&>(*scalar_false).value);
+  ASSERT_EQ(scalar_true.get(), internal::GetCachedBooleanScalar(true).get());
+  ASSERT_EQ(scalar_false.get(), internal::GetCachedBooleanScalar(false).get());
+}
+
 TEST(TestNullScalar, ValidateErrors) {
   NullScalar scalar;
   scalar.is_valid = true;
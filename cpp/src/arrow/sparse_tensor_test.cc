@@ -29,6 +29,7 @@
 #include <gtest/gtest.h>
 
 #include "arrow/sparse_tensor.h"
+#include "arrow/tensor/linalg.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
@@ -1676,4 +1677,97 @@ TEST(TestSparseCSFMatrixForUInt64Index, Make) {
   ASSERT_RAISES(Invalid, SparseCSFTensor::Make(dense_tensor, uint64()));
 }
 
+//-----------------------------------------------------------------------------
+// Sparse CSR x dense multiplication and COO -> CSR conversion
+
+TEST(TestSparseCSRMatrixMultiplyDense, MatrixVector) {
+  float dense_values[3][4] = {{1, 0, 2, 0}, {0, 0, 0, 0}, {0, 3, 0, 4}};
+  Tensor dense_tensor(float32(), Buffer::Wrap(dense_values, sizeof(dense_values)),
+                      {3, 4});
+  ASSERT_OK_AND_ASSIGN(auto csr, SparseCSRMatrix::Make(dense_tensor, int64()));
+
+  float vector_values[4] = {1, 2, 3, 4};
+  Tensor vector(float32(), Buffer::Wrap(vector_values, sizeof(vector_values)), {4});
+
+  for (const bool use_threads : {false, true}) {
+    ASSERT_OK_AND_ASSIGN(auto result,
+                         SparseCSRMatrixMultiplyDense(*csr, vector, use_threads));
+    ASSERT_EQ(std::vector<int64_t>({3}), result->shape());
+    ASSERT_EQ(7, result->Value<FloatType>({0}));
+    ASSERT_EQ(0, result->Value<FloatType>({1}));
+    ASSERT_EQ(22, result->Value<FloatType>({2}));
+  }
+}
+
+TEST(TestSparseCSRMatrixMultiplyDense, MatrixMatrix) {
+  double dense_values[3][4] = {{1, 0, 2, 0}, {0, 0, 0, 0}, {0, 3, 0, 4}};
+  Tensor dense_tensor(float64(), Buffer::Wrap(dense_values, sizeof(dense_values)),
+                      {3, 4});
+  ASSERT_OK_AND_ASSIGN(auto csr, SparseCSRMatrix::Make(dense_tensor, int32()));
+
+  double matrix_values[4][2] = {{1, 5}, {2, 6}, {3, 7}, {4, 8}};
+  Tensor matrix(float64(), Buffer::Wrap(matrix_values, sizeof(matrix_values)), {4, 2});
+
+  for (const bool use_threads : {false, true}) {
+    ASSERT_OK_AND_ASSIGN(auto result,
+                         SparseCSRMatrixMultiplyDense(*csr, matrix, use_threads));
+    ASSERT_EQ(std::vector<int64_t>({3, 2}), result->shape());
+    ASSERT_EQ(7, (result->Value<DoubleType>({0, 0})));
+    ASSERT_EQ(19, (result->Value<DoubleType>({0, 1})));
+    ASSERT_EQ(0, (result->Value<DoubleType>({1, 0})));
+    ASSERT_EQ(0, (result->Value<DoubleType>({1, 1})));
+    ASSERT_EQ(22, (result->Value<DoubleType>({2, 0})));
+    ASSERT_EQ(50, (result->Value<DoubleType>({2, 1})));
+  }
+}
+
+TEST(TestSparseCSRMatrixMultiplyDense, InvalidArguments) {
+  float dense_values[3][4] = {{1, 0, 2, 0}, {0, 0, 0, 0}, {0, 3, 0, 4}};
+  Tensor dense_tensor(float32(), Buffer::Wrap(dense_values, sizeof(dense_values)),
+                      {3, 4});
+  ASSERT_OK_AND_ASSIGN(auto csr, SparseCSRMatrix::Make(dense_tensor, int64()));
+
+  // wrong value type
+  double wrong_type_values[4] = {1, 2, 3, 4};
+  Tensor wrong_type(float64(), Buffer::Wrap(wrong_type_values, sizeof(wrong_type_values)),
+                    {4});
+  ASSERT_RAISES(Invalid, SparseCSRMatrixMultiplyDense(*csr, wrong_type));
+
+  // wrong shape
+  float wrong_shape_values[3] = {1, 2, 3};
+  Tensor wrong_shape(float32(),
+                     Buffer::Wrap(wrong_shape_values, sizeof(wrong_shape_values)), {3});
+  ASSERT_RAISES(Invalid, SparseCSRMatrixMultiplyDense(*csr, wrong_shape));
+}
+
+TEST(TestSparseCSRMatrixFromCOO, EquivalentToDirectConversion) {
+  // First and last rows are empty to exercise the indptr boundary filling
+  float dense_values[4][5] = {
+      {0, 0, 0, 0, 0}, {1, 0, 2, 0, 3}, {0, 4, 0, 0, 0}, {0, 0, 0, 0, 0}};
+  Tensor dense_tensor(float32(), Buffer::Wrap(dense_values, sizeof(dense_values)),
+                      {4, 5});
+
+  for (const auto& index_type : {int32(), int64()}) {
+    ASSERT_OK_AND_ASSIGN(auto coo, SparseCOOTensor::Make(dense_tensor, index_type));
+    ASSERT_OK_AND_ASSIGN(auto expected, SparseCSRMatrix::Make(dense_tensor, index_type));
+
+    for (const bool use_threads : {false, true}) {
+      ASSERT_OK_AND_ASSIGN(auto csr, SparseCSRMatrixFromCOO(*coo, use_threads));
+      ASSERT_TRUE(csr->Equals(*expected));
+    }
+  }
+}
+
+TEST(TestSparseCSRMatrixFromCOO, EmptyMatrix) {
+  float dense_values[2][3] = {{0, 0, 0}, {0, 0, 0}};
+  Tensor dense_tensor(float32(), Buffer::Wrap(dense_values, sizeof(dense_values)),
+                      {2, 3});
+  ASSERT_OK_AND_ASSIGN(auto coo, SparseCOOTensor::Make(dense_tensor, int64()));
+
+  ASSERT_OK_AND_ASSIGN(auto csr, SparseCSRMatrixFromCOO(*coo));
+  ASSERT_EQ(0, csr->non_zero_length());
+  ASSERT_OK_AND_ASSIGN(auto roundtripped, csr->ToTensor());
+  ASSERT_TRUE(roundtripped->Equals(dense_tensor));
+}
+
 }  // namespace arrow
@@ -40,6 +40,7 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/vector.h"
 
 namespace arrow {
@@ -390,7 +391,11 @@ Result<std::shared_ptr<Table>> Table::SelectColumns(
 
 std::string Table::ToString() const {
   std::stringstream ss;
-  ARROW_CHECK_OK(PrettyPrint(*this, 0, &ss));
+  PrettyPrintOptions options;
+  // ToString is meant for diagnostics, so its output is byte-budgeted:
+  // stringifying a very large table must never degenerate into a full scan
+  options.max_output_bytes = 64 * 1024;
+  ARROW_CHECK_OK(PrettyPrint(*this, options, &ss));
   return ss.str();
 }
 
@@ -553,41 +558,88 @@ bool Table::Equals(const Table& other, bool check_metadata) const {
   return true;
 }
 
+namespace {
+
+// Combine the chunks of a column into chunks of at most max_chunk_size rows
+// (unlimited if <= 0).  Binary-like columns are additionally kept below
+// kBinaryMemoryLimit character data per chunk to avoid offset overflow
+// (ARROW-5744).
+Result<std::shared_ptr<ChunkedArray>> CombineColumnChunks(const ChunkedArray& col,
+                                                          int64_t max_chunk_size,
+                                                          MemoryPool* pool) {
+  const bool is_binary = is_binary_like(col.type()->id());
+
+  // Slice chunks longer than max_chunk_size without copying
+  ArrayVector chunks;
+  for (const auto& chunk : col.chunks()) {
+    if (max_chunk_size > 0 && chunk->length() > max_chunk_size) {
+      for (int64_t offset = 0; offset < chunk->length(); offset += max_chunk_size) {
+        chunks.push_back(chunk->Slice(offset, max_chunk_size));
+      }
+    } else {
+      chunks.push_back(chunk);
+    }
+  }
+
+  // Greedily group consecutive chunks and concatenate each group; Concatenate
+  // pre-sizes the output buffers exactly from the summed input buffer sizes
+  ArrayVector combined;
+  ArrayVector group;
+  int64_t group_rows = 0;
+  int64_t group_data_length = 0;
+  auto flush_group = [&]() -> Status {
+    if (group.size() == 1) {
+      combined.push_back(std::move(group.front()));
+    } else if (!group.empty()) {
+      ARROW_ASSIGN_OR_RAISE(auto chunk, Concatenate(group, pool));
+      combined.push_back(std::move(chunk));
+    }
+    group.clear();
+    group_rows = 0;
+    group_data_length = 0;
+    return Status::OK();
+  };
+  for (auto& chunk : chunks) {
+    const int64_t data_length =
+        is_binary ? checked_cast<const BinaryArray&>(*chunk).total_values_length() : 0;
+    if (!group.empty() &&
+        ((max_chunk_size > 0 && group_rows + chunk->length() > max_chunk_size) ||
+         (is_binary && group_data_length + data_length >= kBinaryMemoryLimit))) {
+      RETURN_NOT_OK(flush_group());
+    }
+    group_rows += chunk->length();
+    group_data_length += data_length;
+    group.push_back(std::move(chunk));
+  }
+  RETURN_NOT_OK(flush_group());
+  return std::make_shared<ChunkedArray>(std::move(combined), col.type());
+}
+
+}  // namespace
+
 Result<std::shared_ptr<Table>> Table::CombineChunks(MemoryPool* pool) const {
+  return CombineChunks(CombineChunksOptions::Defaults(), pool);
+}
+
+Result<std::shared_ptr<Table>> Table::CombineChunks(const CombineChunksOptions& options,
+                                                    MemoryPool* pool) const {
   const int ncolumns = num_columns();
+  const int64_t max_chunk_size = options.max_chunk_size;
   std::vector<std::shared_ptr<ChunkedArray>> compacted_columns(ncolumns);
-  for (int i = 0; i < ncolumns; ++i) {
+  auto combine_column = [&](int i) -> Status {
     const auto& col = column(i);
-    if (col->num_chunks() <= 1) {
+    const bool needs_slicing = max_chunk_size > 0 && col->num_chunks() == 1 &&
+                               col->chunk(0)->length() > max_chunk_size;
+    if (col->num_chunks() <= 1 && !needs_slicing) {
       compacted_columns[i] = col;
-      continue;
+      return Status::OK();
     }
-
-    if (is_binary_like(col->type()->id())) {
-      // ARROW-5744 Allow binary columns to be combined into multiple chunks to avoid
-      // buffer overflow
-      ArrayVector chunks;
-      int chunk_i = 0;
-      while (chunk_i < col->num_chunks()) {
-        ArrayVector safe_chunks;
-        int64_t data_length = 0;
-        for (; chunk_i < col->num_chunks(); ++chunk_i) {
-          const auto& chunk = col->chunk(chunk_i);
-          data_length += checked_cast<const BinaryArray&>(*chunk).total_values_length();
-          if (data_length >= kBinaryMemoryLimit) {
-            break;
-          }
-          safe_chunks.push_back(chunk);
-        }
-        chunks.emplace_back();
-        ARROW_ASSIGN_OR_RAISE(chunks.back(), Concatenate(safe_chunks, pool));
-      }
-      compacted_columns[i] = std::make_shared<ChunkedArray>(std::move(chunks));
-    } else {
-      ARROW_ASSIGN_OR_RAISE(auto compacted, Concatenate(col->chunks(), pool));
-      compacted_columns[i] = std::make_shared<ChunkedArray>(compacted);
-    }
-  }
+    ARROW_ASSIGN_OR_RAISE(compacted_columns[i],
+                          CombineColumnChunks(*col, max_chunk_size, pool));
+    return Status::OK();
+  };
+  RETURN_NOT_OK(
+      internal::OptionalParallelFor(options.use_threads, ncolumns, combine_column));
   return Table::Make(schema(), std::move(compacted_columns), num_rows_);
 }
 
@@ -37,6 +37,22 @@ class ChunkedArray;
 class KeyValueMetadata;
 class MemoryPool;
 
+/// \brief Controls the behavior of Table::CombineChunks().
+struct ARROW_EXPORT CombineChunksOptions {
+  /// The maximum number of rows in each combined chunk.
+  ///
+  /// Input chunks are concatenated into right-sized output chunks of at most
+  /// this many rows; input chunks already longer than this are sliced without
+  /// copying.  A value <= 0 (the default) means unlimited, i.e. each column is
+  /// combined into a single chunk where possible.
+  int64_t max_chunk_size = -1;
+
+  /// Whether to combine columns in parallel on the CPU thread pool
+  bool use_threads = false;
+
+  static CombineChunksOptions Defaults() { return {}; }
+};
+
 /// \class Table
 /// \brief Logical table as sequence of chunked arrays
 class ARROW_EXPORT Table {
@@ -218,6 +234,14 @@ class ARROW_EXPORT Table {
   Result<std::shared_ptr<Table>> CombineChunks(
       MemoryPool* pool = default_memory_pool()) const;
 
+  /// \brief Make a new table by combining the chunks this table has,
+  /// with finer control over output chunk sizing and parallelism
+  ///
+  /// \param[in] options options controlling chunk sizing and parallelism
+  /// \param[in] pool The pool for buffer allocations
+  Result<std::shared_ptr<Table>> CombineChunks(
+      const CombineChunksOptions& options, MemoryPool* pool = default_memory_pool()) const;
+
   /// \brief Make a new record batch by combining the chunks this table has.
   ///
   /// All the underlying chunks in the ChunkedArray of each column are
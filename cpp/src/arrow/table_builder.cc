@@ -17,6 +17,7 @@
 
 #include "arrow/table_builder.h"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -80,6 +81,7 @@ Result<std::shared_ptr<RecordBatch>> RecordBatchBuilder::Flush(bool reset_builde
       RecordBatch::Make(std::move(schema), length, std::move(fields));
 
   if (reset_builders) {
+    last_flush_length_ = length;
     ARROW_RETURN_NOT_OK(InitBuilders());
   }
 
@@ -104,8 +106,11 @@ Status RecordBatchBuilder::CreateBuilders() {
 }
 
 Status RecordBatchBuilder::InitBuilders() {
+  // Reserve the previous batch length in one go so that steady-state
+  // ingestion of similarly-sized batches performs no incremental re-growth
+  const int64_t capacity = std::max(initial_capacity_, last_flush_length_);
   for (int i = 0; i < this->num_fields(); ++i) {
-    RETURN_NOT_OK(raw_field_builders_[i]->Reserve(initial_capacity_));
+    RETURN_NOT_OK(raw_field_builders_[i]->Reserve(capacity));
   }
   return Status::OK();
 }
@@ -67,6 +67,12 @@ class ARROW_EXPORT RecordBatchBuilder {
   }
 
   /// \brief Finish current batch and optionally reset
+  ///
+  /// When resetting, the new builders are reserved up front to the length of
+  /// the batch just flushed (or the initial capacity, whichever is larger),
+  /// so that steady-state ingestion of similarly-sized batches does not
+  /// re-grow the same buffers on every cycle.
+  ///
   /// \param[in] reset_builders the resulting RecordBatch
   /// \return the resulting RecordBatch
   Result<std::shared_ptr<RecordBatch>> Flush(bool reset_builders);
@@ -98,6 +104,9 @@ class ARROW_EXPORT RecordBatchBuilder {
 
   std::shared_ptr<Schema> schema_;
   int64_t initial_capacity_;
+  // Length of the most recently flushed batch, used to size the reserved
+  // capacity of reset builders
+  int64_t last_flush_length_ = 0;
   MemoryPool* pool_;
 
   std::vector<std::unique_ptr<ArrayBuilder>> field_builders_;
@@ -137,6 +137,28 @@ TEST_F(TestRecordBatchBuilder, Basics) {
   ASSERT_EQ(4096, builder->initial_capacity());
 }
 
+TEST_F(TestRecordBatchBuilder, CapacityRetainedAcrossFlush) {
+  auto schema = ::arrow::schema({field("f0", int32())});
+
+  std::unique_ptr<RecordBatchBuilder> builder;
+  ASSERT_OK_AND_ASSIGN(builder,
+                       RecordBatchBuilder::Make(schema, pool_, /*initial_capacity=*/8));
+
+  const int64_t kBatchLength = 1000;
+  auto* b0 = builder->GetFieldAs<Int32Builder>(0);
+  for (int64_t i = 0; i < kBatchLength; ++i) {
+    ASSERT_OK(b0->Append(static_cast<int32_t>(i)));
+  }
+
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK_AND_ASSIGN(batch, builder->Flush());
+  ASSERT_EQ(kBatchLength, batch->num_rows());
+
+  // The reset builders should be pre-sized to the previous batch length so
+  // appending another batch of the same size performs no re-growth
+  ASSERT_GE(builder->GetField(0)->capacity(), kBatchLength);
+}
+
 TEST_F(TestRecordBatchBuilder, InvalidFieldLength) {
   auto schema = ExampleSchema1();
 
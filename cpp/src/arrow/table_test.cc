@@ -292,6 +292,52 @@ TEST_F(TestTable, CombineChunks) {
   }
 }
 
+TEST_F(TestTable, CombineChunksWithMaxChunkSize) {
+  MakeExample1(10);
+  auto batch1 = RecordBatch::Make(schema_, 10, arrays_);
+
+  MakeExample1(15);
+  auto batch2 = RecordBatch::Make(schema_, 15, arrays_);
+
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches({batch1, batch2}));
+
+  CombineChunksOptions options;
+  options.max_chunk_size = 8;
+  ASSERT_OK_AND_ASSIGN(auto compacted, table->CombineChunks(options));
+
+  EXPECT_TRUE(compacted->Equals(*table));
+  for (int i = 0; i < compacted->num_columns(); ++i) {
+    for (const auto& chunk : compacted->column(i)->chunks()) {
+      EXPECT_LE(chunk->length(), 8);
+    }
+  }
+
+  // A single chunk longer than the limit is sliced without copying
+  ASSERT_OK_AND_ASSIGN(auto single, Table::FromRecordBatches({batch2}));
+  ASSERT_OK_AND_ASSIGN(compacted, single->CombineChunks(options));
+  EXPECT_TRUE(compacted->Equals(*single));
+  EXPECT_EQ(2, compacted->column(0)->num_chunks());
+}
+
+TEST_F(TestTable, CombineChunksParallel) {
+  MakeExample1(10);
+  auto batch1 = RecordBatch::Make(schema_, 10, arrays_);
+
+  MakeExample1(15);
+  auto batch2 = RecordBatch::Make(schema_, 15, arrays_);
+
+  ASSERT_OK_AND_ASSIGN(auto table, Table::FromRecordBatches({batch1, batch2}));
+
+  CombineChunksOptions options;
+  options.use_threads = true;
+  ASSERT_OK_AND_ASSIGN(auto compacted, table->CombineChunks(options));
+
+  EXPECT_TRUE(compacted->Equals(*table));
+  for (int i = 0; i < compacted->num_columns(); ++i) {
+    EXPECT_EQ(1, compacted->column(i)->num_chunks());
+  }
+}
+
 TEST_F(TestTable, LARGE_MEMORY_TEST(CombineChunksStringColumn)) {
   schema_ = schema({field("str", utf8())});
   arrays_ = {nullptr};
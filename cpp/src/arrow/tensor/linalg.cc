@@ -0,0 +1,467 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/tensor/linalg.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/parallel.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace {
+
+// Minimum amount of work per task, so that thread dispatch overhead doesn't
+// dominate on small inputs.
+constexpr int64_t kMinRowsPerTask = 256;
+constexpr int64_t kMinNonZerosPerTask = 4096;
+
+int NumTasks(int64_t num_items, int64_t min_items_per_task, bool use_threads) {
+  if (!use_threads) {
+    return 1;
+  }
+  const int64_t capacity = internal::GetCpuThreadPool()->GetCapacity();
+  const int64_t max_tasks =
+      std::max<int64_t>(1, bit_util::CeilDiv(num_items, min_items_per_task));
+  return static_cast<int>(std::min(max_tasks, capacity));
+}
+
+// ----------------------------------------------------------------------
+// Sparse CSR x dense multiplication
+
+// Multiply the rows [row_begin, row_end) of a CSR matrix with a row-major
+// dense matrix of 'num_dense_cols' columns.  The inner loop runs over a
+// contiguous dense row on both sides, so it vectorizes without gathers;
+// the rank-1 case keeps its accumulator in a register instead.
+template <typename ValueCType, typename IndptrCType, typename IndexCType>
+void SparseDenseMultiplyBlock(const IndptrCType* indptr, const IndexCType* indices,
+                              const ValueCType* values, const ValueCType* dense,
+                              int64_t num_dense_cols, int64_t row_begin, int64_t row_end,
+                              ValueCType* out) {
+  if (num_dense_cols == 1) {
+    for (int64_t row = row_begin; row < row_end; ++row) {
+      ValueCType sum = 0;
+      for (auto j = indptr[row]; j < indptr[row + 1]; ++j) {
+        sum += values[j] * dense[indices[j]];
+      }
+      out[row] = sum;
+    }
+    return;
+  }
+  for (int64_t row = row_begin; row < row_end; ++row) {
+    ValueCType* out_row = out + row * num_dense_cols;
+    std::fill(out_row, out_row + num_dense_cols, static_cast<ValueCType>(0));
+    for (auto j = indptr[row]; j < indptr[row + 1]; ++j) {
+      const ValueCType v = values[j];
+      const ValueCType* dense_row =
+          dense + static_cast<int64_t>(indices[j]) * num_dense_cols;
+      for (int64_t k = 0; k < num_dense_cols; ++k) {
+        out_row[k] += v * dense_row[k];
+      }
+    }
+  }
+}
+
+struct SparseDenseMultiplyData {
+  const uint8_t* indptr;
+  const uint8_t* indices;
+  const uint8_t* values;
+  const uint8_t* dense;
+  uint8_t* out;
+  int64_t num_rows;
+  int64_t num_dense_cols;
+};
+
+template <typename ValueCType, typename IndptrCType, typename IndexCType>
+Status RunSparseDenseMultiply(const SparseDenseMultiplyData& data, bool use_threads) {
+  const auto* indptr = reinterpret_cast<const IndptrCType*>(data.indptr);
+  const auto* indices = reinterpret_cast<const IndexCType*>(data.indices);
+  const auto* values = reinterpret_cast<const ValueCType*>(data.values);
+  const auto* dense = reinterpret_cast<const ValueCType*>(data.dense);
+  auto* out = reinterpret_cast<ValueCType*>(data.out);
+
+  const int num_tasks = NumTasks(data.num_rows, kMinRowsPerTask, use_threads);
+  const int64_t rows_per_task = bit_util::CeilDiv(data.num_rows, int64_t{num_tasks});
+  return internal::OptionalParallelFor(
+      use_threads, num_tasks, [&](int task_id) -> Status {
+        const int64_t row_begin = task_id * rows_per_task;
+        const int64_t row_end = std::min(row_begin + rows_per_task, data.num_rows);
+        SparseDenseMultiplyBlock(indptr, indices, values, dense, data.num_dense_cols,
+                                 row_begin, row_end, out);
+        return Status::OK();
+      });
+}
+
+template <typename ValueCType, typename IndptrCType>
+Status DispatchMultiplyIndices(Type::type indices_id,
+                               const SparseDenseMultiplyData& data, bool use_threads) {
+  switch (indices_id) {
+    case Type::INT32:
+      return RunSparseDenseMultiply<ValueCType, IndptrCType, int32_t>(data, use_threads);
+    case Type::INT64:
+      return RunSparseDenseMultiply<ValueCType, IndptrCType, int64_t>(data, use_threads);
+    default:
+      return Status::NotImplemented(
+          "Unsupported CSR indices type for sparse-dense multiplication");
+  }
+}
+
+template <typename ValueCType>
+Status DispatchMultiplyIndptr(Type::type indptr_id, Type::type indices_id,
+                              const SparseDenseMultiplyData& data, bool use_threads) {
+  switch (indptr_id) {
+    case Type::INT32:
+      return DispatchMultiplyIndices<ValueCType, int32_t>(indices_id, data, use_threads);
+    case Type::INT64:
+      return DispatchMultiplyIndices<ValueCType, int64_t>(indices_id, data, use_threads);
+    default:
+      return Status::NotImplemented(
+          "Unsupported CSR indptr type for sparse-dense multiplication");
+  }
+}
+
+Status DispatchMultiply(Type::type value_id, Type::type indptr_id, Type::type indices_id,
+                        const SparseDenseMultiplyData& data, bool use_threads) {
+  switch (value_id) {
+    case Type::FLOAT:
+      return DispatchMultiplyIndptr<float>(indptr_id, indices_id, data, use_threads);
+    case Type::DOUBLE:
+      return DispatchMultiplyIndptr<double>(indptr_id, indices_id, data, use_threads);
+    default:
+      return Status::NotImplemented(
+          "Unsupported value type for sparse-dense multiplication");
+  }
+}
+
+// ----------------------------------------------------------------------
+// Parallel COO -> CSR conversion
+
+// The COO index is canonical (sorted by row, then column), so each task can
+// scan a slice of the coordinates independently: whenever the row number
+// jumps from 'prev' to 'cur' at position i, rows (prev, cur] start at i.
+// Column indices are extracted into a contiguous buffer in the same pass.
+template <typename IndexCType>
+Status BuildCSRFromCanonicalCOO(const Tensor& coords, int64_t num_rows,
+                                uint8_t* indptr_buffer, uint8_t* indices_buffer,
+                                bool use_threads) {
+  const int64_t non_zero_length = coords.shape()[0];
+  const int64_t row_stride = coords.strides()[0];
+  const int64_t col_stride = coords.strides()[1];
+  const uint8_t* coords_data = coords.raw_data();
+  auto coord = [&](int64_t i, int64_t dim) -> IndexCType {
+    return *reinterpret_cast<const IndexCType*>(coords_data + i * row_stride +
+                                                dim * col_stride);
+  };
+
+  auto* indptr = reinterpret_cast<IndexCType*>(indptr_buffer);
+  auto* indices = reinterpret_cast<IndexCType*>(indices_buffer);
+
+  const int num_tasks = NumTasks(non_zero_length, kMinNonZerosPerTask, use_threads);
+  const int64_t items_per_task =
+      bit_util::CeilDiv(non_zero_length, int64_t{num_tasks});
+  RETURN_NOT_OK(internal::OptionalParallelFor(
+      use_threads, num_tasks, [&](int task_id) -> Status {
+        const int64_t begin = task_id * items_per_task;
+        const int64_t end = std::min(begin + items_per_task, non_zero_length);
+        int64_t prev_row = (begin == 0) ? -1 : static_cast<int64_t>(coord(begin - 1, 0));
+        for (int64_t i = begin; i < end; ++i) {
+          const auto cur_row = static_cast<int64_t>(coord(i, 0));
+          for (int64_t row = prev_row + 1; row <= cur_row; ++row) {
+            indptr[row] = static_cast<IndexCType>(i);
+          }
+          prev_row = cur_row;
+          indices[i] = coord(i, 1);
+        }
+        return Status::OK();
+      }));
+
+  // Rows below the last populated one (all of them, if there are no
+  // non-zeros) end at non_zero_length.
+  const int64_t last_row =
+      (non_zero_length == 0) ? -1 : static_cast<int64_t>(coord(non_zero_length - 1, 0));
+  for (int64_t row = last_row + 1; row <= num_rows; ++row) {
+    indptr[row] = static_cast<IndexCType>(non_zero_length);
+  }
+  return Status::OK();
+}
+
+// ----------------------------------------------------------------------
+// Strided copy and cache-blocked transpose
+
+// Tile edge for the blocked two-dimensional kernel.  A 32 x 32 tile of
+// 8-byte elements is 8 KiB on each side, well within L1.
+constexpr int64_t kTransposeBlockSize = 32;
+
+// Copy a range of rows of an arbitrarily strided two-dimensional tensor
+// into a contiguous row-major destination, one cache-sized tile at a time.
+// With a column-major source this is the classic blocked transpose: every
+// tile is read and written once while it is resident.
+template <typename T>
+void CopyStrided2DBlock(const uint8_t* src, int64_t row_stride, int64_t col_stride,
+                        int64_t num_cols, int64_t row_begin, int64_t row_end, T* out) {
+  for (int64_t ib = row_begin; ib < row_end; ib += kTransposeBlockSize) {
+    const int64_t i_end = std::min(ib + kTransposeBlockSize, row_end);
+    for (int64_t jb = 0; jb < num_cols; jb += kTransposeBlockSize) {
+      const int64_t j_end = std::min(jb + kTransposeBlockSize, num_cols);
+      for (int64_t i = ib; i < i_end; ++i) {
+        const uint8_t* src_row = src + i * row_stride;
+        T* out_row = out + i * num_cols;
+        for (int64_t j = jb; j < j_end; ++j) {
+          out_row[j] = *reinterpret_cast<const T*>(src_row + j * col_stride);
+        }
+      }
+    }
+  }
+}
+
+template <typename T>
+Status CopyStrided2D(const Tensor& tensor, bool use_threads, uint8_t* out) {
+  const int64_t num_rows = tensor.shape()[0];
+  const int64_t num_cols = tensor.shape()[1];
+  const int64_t row_stride = tensor.strides()[0];
+  const int64_t col_stride = tensor.strides()[1];
+  const uint8_t* src = tensor.raw_data();
+  auto* out_values = reinterpret_cast<T*>(out);
+
+  const int num_tasks = NumTasks(num_rows, kTransposeBlockSize * 8, use_threads);
+  // align task boundaries with tile boundaries
+  const int64_t rows_per_task =
+      bit_util::CeilDiv(bit_util::CeilDiv(num_rows, kTransposeBlockSize),
+                        int64_t{num_tasks}) *
+      kTransposeBlockSize;
+  return internal::OptionalParallelFor(
+      use_threads, num_tasks, [&](int task_id) -> Status {
+        const int64_t row_begin = task_id * rows_per_task;
+        const int64_t row_end = std::min(row_begin + rows_per_task, num_rows);
+        if (row_begin < row_end) {
+          CopyStrided2DBlock(src, row_stride, col_stride, num_cols, row_begin, row_end,
+                             out_values);
+        }
+        return Status::OK();
+      });
+}
+
+// Generic strided copy for tensors of any rank: walk the index space in
+// row-major order with an odometer, copying one element at a time.
+void CopyStridedGeneric(const Tensor& tensor, int64_t elsize, uint8_t* out) {
+  const int ndim = tensor.ndim();
+  const auto& shape = tensor.shape();
+  const auto& strides = tensor.strides();
+  std::vector<int64_t> index(ndim, 0);
+  const uint8_t* src = tensor.raw_data();
+  int64_t src_offset = 0;
+  for (int64_t i = 0; i < tensor.size(); ++i) {
+    std::memcpy(out, src + src_offset, elsize);
+    out += elsize;
+    for (int dim = ndim - 1; dim >= 0; --dim) {
+      src_offset += strides[dim];
+      if (++index[dim] < shape[dim]) {
+        break;
+      }
+      src_offset -= shape[dim] * strides[dim];
+      index[dim] = 0;
+    }
+  }
+}
+
+Result<std::shared_ptr<Buffer>> CopyToRowMajorBuffer(const Tensor& tensor,
+                                                     bool use_threads,
+                                                     MemoryPool* pool) {
+  const int64_t elsize =
+      checked_cast<const FixedWidthType&>(*tensor.type()).bit_width() / 8;
+  ARROW_ASSIGN_OR_RAISE(auto buffer, AllocateBuffer(tensor.size() * elsize, pool));
+
+  if (tensor.ndim() == 2) {
+    switch (elsize) {
+      case 1:
+        RETURN_NOT_OK(CopyStrided2D<uint8_t>(tensor, use_threads,
+                                             buffer->mutable_data()));
+        return std::shared_ptr<Buffer>(std::move(buffer));
+      case 2:
+        RETURN_NOT_OK(CopyStrided2D<uint16_t>(tensor, use_threads,
+                                              buffer->mutable_data()));
+        return std::shared_ptr<Buffer>(std::move(buffer));
+      case 4:
+        RETURN_NOT_OK(CopyStrided2D<uint32_t>(tensor, use_threads,
+                                              buffer->mutable_data()));
+        return std::shared_ptr<Buffer>(std::move(buffer));
+      case 8:
+        RETURN_NOT_OK(CopyStrided2D<uint64_t>(tensor, use_threads,
+                                              buffer->mutable_data()));
+        return std::shared_ptr<Buffer>(std::move(buffer));
+      default:
+        break;
+    }
+  }
+  CopyStridedGeneric(tensor, elsize, buffer->mutable_data());
+  return std::shared_ptr<Buffer>(std::move(buffer));
+}
+
+std::vector<int64_t> ColumnMajorStrides(const Tensor& tensor) {
+  const int64_t elsize =
+      checked_cast<const FixedWidthType&>(*tensor.type()).bit_width() / 8;
+  std::vector<int64_t> strides(tensor.ndim());
+  int64_t stride = elsize;
+  for (int i = 0; i < tensor.ndim(); ++i) {
+    strides[i] = stride;
+    stride *= tensor.shape()[i];
+  }
+  return strides;
+}
+
+}  // namespace
+
+Result<std::shared_ptr<Tensor>> TensorToRowMajor(const Tensor& tensor, bool use_threads,
+                                                 MemoryPool* pool) {
+  if (tensor.is_row_major() && tensor.is_contiguous()) {
+    return Tensor::Make(tensor.type(), tensor.data(), tensor.shape(), {},
+                        tensor.dim_names());
+  }
+  ARROW_ASSIGN_OR_RAISE(auto buffer, CopyToRowMajorBuffer(tensor, use_threads, pool));
+  return Tensor::Make(tensor.type(), std::move(buffer), tensor.shape(), {},
+                      tensor.dim_names());
+}
+
+Result<std::shared_ptr<Tensor>> TensorToColumnMajor(const Tensor& tensor,
+                                                    bool use_threads, MemoryPool* pool) {
+  if (tensor.is_column_major() && tensor.is_contiguous()) {
+    return Tensor::Make(tensor.type(), tensor.data(), tensor.shape(), tensor.strides(),
+                        tensor.dim_names());
+  }
+  // A column-major tensor is a row-major materialization of the transposed
+  // view, so reuse the blocked row-major kernel on reversed shape/strides.
+  std::vector<int64_t> reversed_shape(tensor.shape().rbegin(), tensor.shape().rend());
+  std::vector<int64_t> reversed_strides(tensor.strides().rbegin(),
+                                        tensor.strides().rend());
+  Tensor transposed_view(tensor.type(), tensor.data(), reversed_shape, reversed_strides);
+  ARROW_ASSIGN_OR_RAISE(auto buffer,
+                        CopyToRowMajorBuffer(transposed_view, use_threads, pool));
+  return Tensor::Make(tensor.type(), std::move(buffer), tensor.shape(),
+                      ColumnMajorStrides(tensor), tensor.dim_names());
+}
+
+Result<std::shared_ptr<Tensor>> SparseCSRMatrixMultiplyDense(const SparseCSRMatrix& left,
+                                                             const Tensor& right,
+                                                             bool use_threads,
+                                                             MemoryPool* pool) {
+  if (right.ndim() != 1 && right.ndim() != 2) {
+    return Status::Invalid("Dense operand must have rank 1 or 2, got rank ",
+                           right.ndim());
+  }
+  if (!right.is_row_major() || !right.is_contiguous()) {
+    return Status::Invalid("Dense operand must be a contiguous row-major tensor");
+  }
+  if (!left.type()->Equals(*right.type())) {
+    return Status::Invalid("Value type mismatch: sparse operand has type ",
+                           left.type()->ToString(), ", dense operand has type ",
+                           right.type()->ToString());
+  }
+  if (left.shape()[1] != right.shape()[0]) {
+    return Status::Invalid("Shape mismatch: sparse operand has ", left.shape()[1],
+                           " columns, dense operand has ", right.shape()[0], " rows");
+  }
+
+  const auto& sparse_index = checked_cast<const SparseCSRIndex&>(*left.sparse_index());
+  const int64_t num_rows = left.shape()[0];
+  const int64_t num_dense_cols = (right.ndim() == 2) ? right.shape()[1] : 1;
+
+  const auto& value_type = checked_cast<const FixedWidthType&>(*left.type());
+  const int64_t out_length = num_rows * num_dense_cols;
+  ARROW_ASSIGN_OR_RAISE(auto out_buffer,
+                        AllocateBuffer(out_length * (value_type.bit_width() / 8), pool));
+
+  SparseDenseMultiplyData data;
+  data.indptr = sparse_index.indptr()->raw_data();
+  data.indices = sparse_index.indices()->raw_data();
+  data.values = left.raw_data();
+  data.dense = right.raw_data();
+  data.out = out_buffer->mutable_data();
+  data.num_rows = num_rows;
+  data.num_dense_cols = num_dense_cols;
+
+  RETURN_NOT_OK(DispatchMultiply(left.type()->id(), sparse_index.indptr()->type()->id(),
+                                 sparse_index.indices()->type()->id(), data,
+                                 use_threads));
+
+  std::vector<int64_t> out_shape =
+      (right.ndim() == 2) ? std::vector<int64_t>{num_rows, num_dense_cols}
+                          : std::vector<int64_t>{num_rows};
+  return std::make_shared<Tensor>(left.type(), std::move(out_buffer), out_shape);
+}
+
+Result<std::shared_ptr<SparseCSRMatrix>> SparseCSRMatrixFromCOO(
+    const SparseCOOTensor& coo, bool use_threads, MemoryPool* pool) {
+  if (coo.ndim() != 2) {
+    return Status::Invalid("COO tensor must be two-dimensional to convert to CSR, got ",
+                           coo.ndim(), " dimensions");
+  }
+  const auto& coo_index = checked_cast<const SparseCOOIndex&>(*coo.sparse_index());
+  if (!coo_index.is_canonical()) {
+    return Status::NotImplemented(
+        "Only canonical COO indices are supported for conversion to CSR");
+  }
+
+  const auto& coords = *coo_index.indices();
+  const auto index_type = coords.type();
+  const int64_t non_zero_length = coords.shape()[0];
+  const int64_t num_rows = coo.shape()[0];
+  const int64_t elsize = checked_cast<const FixedWidthType&>(*index_type).bit_width() / 8;
+
+  ARROW_ASSIGN_OR_RAISE(auto indptr_buffer,
+                        AllocateBuffer((num_rows + 1) * elsize, pool));
+  ARROW_ASSIGN_OR_RAISE(auto indices_buffer,
+                        AllocateBuffer(non_zero_length * elsize, pool));
+
+  switch (index_type->id()) {
+    case Type::INT32:
+      RETURN_NOT_OK(BuildCSRFromCanonicalCOO<int32_t>(coords, num_rows,
+                                                      indptr_buffer->mutable_data(),
+                                                      indices_buffer->mutable_data(),
+                                                      use_threads));
+      break;
+    case Type::INT64:
+      RETURN_NOT_OK(BuildCSRFromCanonicalCOO<int64_t>(coords, num_rows,
+                                                      indptr_buffer->mutable_data(),
+                                                      indices_buffer->mutable_data(),
+                                                      use_threads));
+      break;
+    default:
+      return Status::NotImplemented("Unsupported COO index type for conversion to CSR: ",
+                                    index_type->ToString());
+  }
+
+  // The canonical COO ordering is the CSR ordering, so the value buffer is
+  // shared with the input without reordering.
+  ARROW_ASSIGN_OR_RAISE(
+      auto csr_index,
+      SparseCSRIndex::Make(index_type, coo.shape(), non_zero_length,
+                           std::move(indptr_buffer), std::move(indices_buffer)));
+  return SparseCSRMatrix::Make(csr_index, coo.type(), coo.data(), coo.shape(),
+                               coo.dim_names());
+}
+
+}  // namespace arrow
@@ -0,0 +1,77 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/sparse_tensor.h"  // IWYU pragma: export
+
+#include <memory>
+
+namespace arrow {
+
+/// \brief EXPERIMENTAL: Multiply a sparse CSR matrix with a dense vector or matrix.
+///
+/// 'right' must be a contiguous row-major tensor of rank 1 (matrix-vector
+/// product) or rank 2 (matrix-matrix product) with the same value type as
+/// 'left', and its first dimension must match the number of columns of
+/// 'left'.  The returned tensor is row-major, with shape {M} for a rank-1
+/// input and {M, K} for a rank-2 input.
+///
+/// When 'use_threads' is true, row blocks are processed in parallel on the
+/// global CPU thread pool.  float32, float64 values and int32, int64 indices
+/// are supported.
+ARROW_EXPORT
+Result<std::shared_ptr<Tensor>> SparseCSRMatrixMultiplyDense(
+    const SparseCSRMatrix& left, const Tensor& right, bool use_threads = true,
+    MemoryPool* pool = default_memory_pool());
+
+/// \brief EXPERIMENTAL: Convert a canonical COO sparse tensor to a CSR matrix.
+///
+/// The COO tensor must be two-dimensional and have a canonical (sorted,
+/// duplicate-free) index, so the value buffer can be shared with the result
+/// without reordering.  When 'use_threads' is true, the indptr construction
+/// and the column index extraction run in parallel on the global CPU thread
+/// pool.
+ARROW_EXPORT
+Result<std::shared_ptr<SparseCSRMatrix>> SparseCSRMatrixFromCOO(
+    const SparseCOOTensor& coo, bool use_threads = true,
+    MemoryPool* pool = default_memory_pool());
+
+/// \brief EXPERIMENTAL: Materialize a tensor into contiguous row-major layout.
+///
+/// Strided views (e.g. slices) are compacted and column-major tensors are
+/// transposed with a cache-blocked kernel; two-dimensional inputs are
+/// processed in parallel tiles on the global CPU thread pool when
+/// 'use_threads' is true.  If the input is already contiguous row-major, it
+/// is returned without copying the data.
+ARROW_EXPORT
+Result<std::shared_ptr<Tensor>> TensorToRowMajor(const Tensor& tensor,
+                                                 bool use_threads = true,
+                                                 MemoryPool* pool = default_memory_pool());
+
+/// \brief EXPERIMENTAL: Materialize a tensor into contiguous column-major
+/// (Fortran-like) layout.
+///
+/// The counterpart of TensorToRowMajor, typically used to hand row-major
+/// tensors to column-major BLAS routines.  If the input is already
+/// contiguous column-major, it is returned without copying the data.
+ARROW_EXPORT
+Result<std::shared_ptr<Tensor>> TensorToColumnMajor(
+    const Tensor& tensor, bool use_threads = true,
+    MemoryPool* pool = default_memory_pool());
+
+}  // namespace arrow
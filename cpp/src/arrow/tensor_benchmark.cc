@@ -15,9 +15,13 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <numeric>
+
 #include "benchmark/benchmark.h"
 
+#include "arrow/buffer.h"
 #include "arrow/record_batch.h"
+#include "arrow/tensor/linalg.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/type.h"
@@ -65,4 +69,126 @@ BENCHMARK_TEMPLATE(BatchToTensorSimple, Int16Type)->Apply(SetArgs);
 BENCHMARK_TEMPLATE(BatchToTensorSimple, Int32Type)->Apply(SetArgs);
 BENCHMARK_TEMPLATE(BatchToTensorSimple, Int64Type)->Apply(SetArgs);
 
+// Build a num_rows x num_cols dense tensor where roughly one value in
+// 'sparsity' is non-zero, in a fixed pseudo-random pattern.
+template <typename ValueType>
+static std::shared_ptr<Tensor> MakeSparseDenseTensor(int64_t num_rows, int64_t num_cols,
+                                                     int64_t sparsity) {
+  using CType = typename ValueType::c_type;
+  std::vector<CType> values(num_rows * num_cols, CType{});
+  uint64_t seed = 42;
+  for (int64_t i = 0; i < num_rows * num_cols; i += sparsity) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    values[i] = static_cast<CType>(seed % 100) + 1;
+  }
+  auto buffer = Buffer::FromVector(std::move(values));
+  return *Tensor::Make(TypeTraits<ValueType>::type_singleton(), std::move(buffer),
+                       {num_rows, num_cols});
+}
+
+template <typename ValueType>
+static void SparseCSRMatrixVectorMultiply(benchmark::State& state) {
+  using CType = typename ValueType::c_type;
+  const int64_t num_rows = state.range(0);
+  const int64_t num_cols = 512;
+  const int64_t sparsity = 100;  // 99% sparse
+
+  auto dense = MakeSparseDenseTensor<ValueType>(num_rows, num_cols, sparsity);
+  ASSERT_OK_AND_ASSIGN(auto csr, SparseCSRMatrix::Make(*dense, int32()));
+
+  auto vector_buffer =
+      Buffer::FromVector(std::vector<CType>(num_cols, static_cast<CType>(1)));
+  ASSERT_OK_AND_ASSIGN(auto vector,
+                       Tensor::Make(TypeTraits<ValueType>::type_singleton(),
+                                    std::move(vector_buffer), {num_cols}));
+
+  for (auto _ : state) {
+    ASSERT_OK_AND_ASSIGN(auto result,
+                         SparseCSRMatrixMultiplyDense(*csr, *vector,
+                                                      /*use_threads=*/true));
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * csr->non_zero_length());
+}
+
+template <typename ValueType>
+static void SparseCSRMatrixMatrixMultiply(benchmark::State& state) {
+  using CType = typename ValueType::c_type;
+  const int64_t num_rows = state.range(0);
+  const int64_t num_cols = 512;
+  const int64_t num_dense_cols = 16;
+  const int64_t sparsity = 100;  // 99% sparse
+
+  auto dense = MakeSparseDenseTensor<ValueType>(num_rows, num_cols, sparsity);
+  ASSERT_OK_AND_ASSIGN(auto csr, SparseCSRMatrix::Make(*dense, int32()));
+
+  auto matrix_buffer = Buffer::FromVector(
+      std::vector<CType>(num_cols * num_dense_cols, static_cast<CType>(1)));
+  ASSERT_OK_AND_ASSIGN(auto matrix,
+                       Tensor::Make(TypeTraits<ValueType>::type_singleton(),
+                                    std::move(matrix_buffer), {num_cols, num_dense_cols}));
+
+  for (auto _ : state) {
+    ASSERT_OK_AND_ASSIGN(auto result,
+                         SparseCSRMatrixMultiplyDense(*csr, *matrix,
+                                                      /*use_threads=*/true));
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * csr->non_zero_length() * num_dense_cols);
+}
+
+template <typename ValueType>
+static void SparseCOOToCSRConversion(benchmark::State& state) {
+  const int64_t num_rows = state.range(0);
+  const int64_t num_cols = 512;
+  const int64_t sparsity = 100;  // 99% sparse
+
+  auto dense = MakeSparseDenseTensor<ValueType>(num_rows, num_cols, sparsity);
+  ASSERT_OK_AND_ASSIGN(auto coo, SparseCOOTensor::Make(*dense, int32()));
+
+  for (auto _ : state) {
+    ASSERT_OK_AND_ASSIGN(auto csr, SparseCSRMatrixFromCOO(*coo, /*use_threads=*/true));
+    benchmark::DoNotOptimize(csr);
+  }
+  state.SetItemsProcessed(state.iterations() * coo->non_zero_length());
+}
+
+template <typename ValueType>
+static void TensorColumnMajorToRowMajor(benchmark::State& state) {
+  using CType = typename ValueType::c_type;
+  const int64_t num_rows = state.range(0);
+  const int64_t num_cols = 512;
+
+  std::vector<CType> values(num_rows * num_cols);
+  std::iota(values.begin(), values.end(), static_cast<CType>(0));
+  auto buffer = Buffer::FromVector(std::move(values));
+  const int64_t elsize = sizeof(CType);
+  ASSERT_OK_AND_ASSIGN(auto tensor,
+                       Tensor::Make(TypeTraits<ValueType>::type_singleton(),
+                                    std::move(buffer), {num_rows, num_cols},
+                                    {elsize, elsize * num_rows}));
+
+  for (auto _ : state) {
+    ASSERT_OK_AND_ASSIGN(auto result, TensorToRowMajor(*tensor, /*use_threads=*/true));
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetBytesProcessed(state.iterations() * num_rows * num_cols * elsize);
+}
+
+void SetSparseArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t num_rows : {1024, 16384}) {
+    bench->Args({num_rows});
+    bench->ArgNames({"num_rows"});
+  }
+}
+
+BENCHMARK_TEMPLATE(SparseCSRMatrixVectorMultiply, FloatType)->Apply(SetSparseArgs);
+BENCHMARK_TEMPLATE(SparseCSRMatrixVectorMultiply, DoubleType)->Apply(SetSparseArgs);
+BENCHMARK_TEMPLATE(SparseCSRMatrixMatrixMultiply, FloatType)->Apply(SetSparseArgs);
+BENCHMARK_TEMPLATE(SparseCSRMatrixMatrixMultiply, DoubleType)->Apply(SetSparseArgs);
+BENCHMARK_TEMPLATE(SparseCOOToCSRConversion, FloatType)->Apply(SetSparseArgs);
+BENCHMARK_TEMPLATE(SparseCOOToCSRConversion, DoubleType)->Apply(SetSparseArgs);
+BENCHMARK_TEMPLATE(TensorColumnMajorToRowMajor, FloatType)->Apply(SetSparseArgs);
+BENCHMARK_TEMPLATE(TensorColumnMajorToRowMajor, DoubleType)->Apply(SetSparseArgs);
+
 }  // namespace arrow
@@ -19,6 +19,7 @@
 
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <utility>
@@ -29,6 +30,7 @@
 
 #include "arrow/buffer.h"
 #include "arrow/tensor.h"
+#include "arrow/tensor/linalg.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/type.h"
 
@@ -752,4 +754,86 @@ TEST(TestNumericTensor, ElementAccessWithNonContiguousStrides) {
   ASSERT_EQ(11.1f, t_f32.Value({2, 2}));
 }
 
+TEST(TestTensorLayoutConversion, ColumnMajorToRowMajor) {
+  // 2 x 3 matrix {{1, 2, 3}, {4, 5, 6}} in column-major order
+  std::vector<int32_t> values = {1, 4, 2, 5, 3, 6};
+  const int64_t i32_size = sizeof(int32_t);
+  Tensor t(int32(), Buffer::Wrap(values), {2, 3}, {i32_size, i32_size * 2});
+  ASSERT_TRUE(t.is_column_major());
+
+  for (const bool use_threads : {false, true}) {
+    ASSERT_OK_AND_ASSIGN(auto result, TensorToRowMajor(t, use_threads));
+    ASSERT_TRUE(result->is_row_major());
+    ASSERT_TRUE(result->is_contiguous());
+    std::vector<int32_t> expected = {1, 2, 3, 4, 5, 6};
+    ASSERT_EQ(0, std::memcmp(result->raw_data(), expected.data(),
+                             expected.size() * i32_size));
+  }
+}
+
+TEST(TestTensorLayoutConversion, RowMajorToColumnMajor) {
+  std::vector<double> values = {1, 2, 3, 4, 5, 6};
+  Tensor t(float64(), Buffer::Wrap(values), {2, 3});
+  ASSERT_TRUE(t.is_row_major());
+
+  ASSERT_OK_AND_ASSIGN(auto result, TensorToColumnMajor(t));
+  ASSERT_TRUE(result->is_column_major());
+  ASSERT_TRUE(result->is_contiguous());
+  std::vector<double> expected = {1, 4, 2, 5, 3, 6};
+  ASSERT_EQ(0, std::memcmp(result->raw_data(), expected.data(),
+                           expected.size() * sizeof(double)));
+  // element access agrees with the source
+  ASSERT_EQ(t.Value<DoubleType>({1, 2}), result->Value<DoubleType>({1, 2}));
+}
+
+TEST(TestTensorLayoutConversion, AlreadyInTargetLayoutIsZeroCopy) {
+  std::vector<int64_t> values = {1, 2, 3, 4, 5, 6};
+  Tensor row_major(int64(), Buffer::Wrap(values), {2, 3});
+
+  ASSERT_OK_AND_ASSIGN(auto result, TensorToRowMajor(row_major));
+  ASSERT_EQ(row_major.raw_data(), result->raw_data());
+
+  const int64_t i64_size = sizeof(int64_t);
+  Tensor column_major(int64(), Buffer::Wrap(values), {2, 3},
+                      {i64_size, i64_size * 2});
+  ASSERT_OK_AND_ASSIGN(result, TensorToColumnMajor(column_major));
+  ASSERT_EQ(column_major.raw_data(), result->raw_data());
+}
+
+TEST(TestTensorLayoutConversion, CompactStridedSlice) {
+  // 3 x 4 row-major matrix; view every other column through strides
+  std::vector<int16_t> values = {1, 2,  3,  4,  //
+                                 5, 6,  7,  8,  //
+                                 9, 10, 11, 12};
+  const int64_t i16_size = sizeof(int16_t);
+  Tensor view(int16(), Buffer::Wrap(values), {3, 2}, {i16_size * 4, i16_size * 2});
+  ASSERT_FALSE(view.is_contiguous());
+
+  ASSERT_OK_AND_ASSIGN(auto result, TensorToRowMajor(view));
+  ASSERT_TRUE(result->is_row_major());
+  std::vector<int16_t> expected = {1, 3, 5, 7, 9, 11};
+  ASSERT_EQ(0, std::memcmp(result->raw_data(), expected.data(),
+                           expected.size() * i16_size));
+}
+
+TEST(TestTensorLayoutConversion, ThreeDimensional) {
+  // 2 x 2 x 2 column-major tensor
+  std::vector<float> values = {1, 5, 3, 7, 2, 6, 4, 8};
+  const int64_t f32_size = sizeof(float);
+  Tensor t(float32(), Buffer::Wrap(values), {2, 2, 2},
+           {f32_size, f32_size * 2, f32_size * 4});
+  ASSERT_TRUE(t.is_column_major());
+
+  ASSERT_OK_AND_ASSIGN(auto result, TensorToRowMajor(t));
+  ASSERT_TRUE(result->is_row_major());
+  std::vector<float> expected = {1, 2, 3, 4, 5, 6, 7, 8};
+  ASSERT_EQ(0, std::memcmp(result->raw_data(), expected.data(),
+                           expected.size() * f32_size));
+
+  // converting back restores the original buffer contents
+  ASSERT_OK_AND_ASSIGN(auto back, TensorToColumnMajor(*result));
+  ASSERT_EQ(0, std::memcmp(back->raw_data(), values.data(),
+                           values.size() * f32_size));
+}
+
 }  // namespace arrow
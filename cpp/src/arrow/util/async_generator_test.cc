@@ -33,6 +33,7 @@
 #include "arrow/util/async_generator.h"
 #include "arrow/util/async_util.h"
 #include "arrow/util/config.h"
+#include "arrow/util/coroutine.h"
 #include "arrow/util/test_common.h"
 #include "arrow/util/vector.h"
 
@@ -1962,4 +1963,56 @@ TEST(DefaultIfEmptyGenerator, Basics) {
       actual, CollectAsyncGenerator(MakeDefaultIfEmptyGenerator(gen, TestInt(42))));
   EXPECT_EQ(std::vector<TestInt>{42}, actual);
 }
+
+#ifdef ARROW_HAVE_COROUTINES
+
+namespace {
+
+CoGenerator<TestInt> CoroCountTo(int n) {
+  for (int i = 1; i <= n; i++) {
+    co_yield TestInt(i);
+  }
+}
+
+CoGenerator<TestInt> CoroYieldThenAwait(Future<TestInt> future) {
+  co_yield TestInt(1);
+  co_yield co_await std::move(future);
+  co_yield TestInt(3);
+}
+
+}  // namespace
+
+TEST(CoGeneratorTest, Basic) {
+  AsyncGenerator<TestInt> gen = CoroCountTo(3);
+  ASSERT_FINISHES_OK_AND_ASSIGN(auto results, CollectAsyncGenerator(gen));
+  EXPECT_EQ(std::vector<TestInt>({1, 2, 3}), results);
+  // Exhausted generators keep returning the end token
+  ASSERT_FINISHES_OK_AND_EQ(IterationTraits<TestInt>::End(), gen());
+}
+
+TEST(CoGeneratorTest, AwaitBetweenYields) {
+  auto source = Future<TestInt>::Make();
+  AsyncGenerator<TestInt> gen = CoroYieldThenAwait(source);
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(1), gen());
+  auto next = gen();
+  ASSERT_FALSE(next.is_finished());
+  source.MarkFinished(TestInt(2));
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(2), next);
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(3), gen());
+  ASSERT_FINISHES_OK_AND_EQ(IterationTraits<TestInt>::End(), gen());
+}
+
+TEST(CoGeneratorTest, AwaitedError) {
+  auto source = Future<TestInt>::Make();
+  AsyncGenerator<TestInt> gen = CoroYieldThenAwait(source);
+  ASSERT_FINISHES_OK_AND_EQ(TestInt(1), gen());
+  auto next = gen();
+  source.MarkFinished(Status::Invalid("XYZ"));
+  ASSERT_FINISHES_AND_RAISES(Invalid, next);
+  // An error exhausts the generator
+  ASSERT_FINISHES_OK_AND_EQ(IterationTraits<TestInt>::End(), gen());
+}
+
+#endif  // ARROW_HAVE_COROUTINES
+
 }  // namespace arrow
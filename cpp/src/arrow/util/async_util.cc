@@ -22,10 +22,12 @@
 #include "arrow/util/string.h"
 #include "arrow/util/tracing_internal.h"
 
+#include <chrono>
 #include <condition_variable>
 #include <list>
 #include <memory>
 #include <mutex>
+#include <optional>
 
 using namespace std::string_view_literals;  // NOLINT
 
@@ -529,5 +531,100 @@ std::unique_ptr<ThrottledAsyncTaskScheduler> MakeThrottledAsyncTaskGroup(
                                                    std::move(task_group));
 }
 
+class AsyncTaskScopeImpl : public AsyncTaskScope {
+ public:
+  AsyncTaskScopeImpl(AsyncTaskScheduler* target, AsyncTaskScopeOptions options)
+      : deadline_(options.deadline) {
+    AsyncTaskScheduler* inner = target;
+    if (options.max_concurrent_cost > 0) {
+      throttled_ = ThrottledAsyncTaskScheduler::Make(target, options.max_concurrent_cost,
+                                                     std::move(options.queue));
+      inner = throttled_.get();
+    }
+    FnOnce<Status()> finish_cb = options.finish_callback
+                                     ? std::move(options.finish_callback)
+                                     : FnOnce<Status()>([] { return Status::OK(); });
+    task_group_ = AsyncTaskGroup::Make(inner, std::move(finish_cb));
+  }
+
+  bool AddTask(std::unique_ptr<Task> task) override {
+    if (deadline_ && std::chrono::steady_clock::now() >= *deadline_) {
+      Status timeout = Status::Cancelled("Task '", task->name(),
+                                         "' added after the scope's deadline passed");
+      stop_source_.RequestStop(timeout);
+      // Report the timeout as a failing task so the enclosing scheduler aborts
+      task_group_->AddSimpleTask(
+          [timeout = std::move(timeout)]() -> Result<Future<>> { return timeout; },
+          "AsyncTaskScope::DeadlineExceeded"sv);
+      return false;
+    }
+    // Wrap the task so failures stop the scope's token, giving in-flight and
+    // child-scope work prompt notice of the abort
+    struct WrapperTask : public Task {
+      WrapperTask(std::unique_ptr<Task> target, StopSource stop_source)
+          : target(std::move(target)), stop_source(std::move(stop_source)) {}
+      Result<Future<>> operator()() override {
+        Result<Future<>> maybe_fut = (*target)();
+        if (!maybe_fut.ok()) {
+          stop_source.RequestStop(maybe_fut.status());
+          return maybe_fut;
+        }
+        return maybe_fut->Then(
+            [] {}, [stop_source = stop_source](const Status& st) mutable -> Status {
+              stop_source.RequestStop(st);
+              return st;
+            });
+      }
+      int cost() const override { return target->cost(); }
+      std::string_view name() const override { return target->name(); }
+      std::unique_ptr<Task> target;
+      StopSource stop_source;
+    };
+    return task_group_->AddTask(
+        std::make_unique<WrapperTask>(std::move(task), stop_source_));
+  }
+
+  StopToken stop_token() const override { return stop_source_.token(); }
+
+  std::unique_ptr<AsyncTaskScope> MakeChildScope(AsyncTaskScopeOptions options) override {
+    // Inherit the tighter of the parent's and the child's deadline
+    if (deadline_ && (!options.deadline || *deadline_ < *options.deadline)) {
+      options.deadline = deadline_;
+    }
+    auto child = std::make_unique<AsyncTaskScopeImpl>(task_group_.get(),
+                                                      std::move(options));
+    // Stop the child promptly when this scope fails.  The callback only
+    // captures the child's stop source, so it remains safe if it fires while
+    // the child is being destroyed; the handle unregisters it afterwards.
+    child->parent_link_ = stop_source_.token().SetCallback(
+        [child_source = child->stop_source_](const Status& st) mutable {
+          child_source.RequestStop(st);
+        });
+    return child;
+  }
+
+  void Pause() override {
+    if (throttled_) throttled_->Pause();
+  }
+  void Resume() override {
+    if (throttled_) throttled_->Resume();
+  }
+  std::size_t QueueSize() override { return throttled_ ? throttled_->QueueSize() : 0; }
+  const util::tracing::Span& span() const override { return task_group_->span(); }
+
+ private:
+  std::optional<std::chrono::steady_clock::time_point> deadline_;
+  mutable StopSource stop_source_;
+  StopCallbackHandle parent_link_;
+  // Note: declared after the throttle so the task group is destroyed first
+  std::shared_ptr<ThrottledAsyncTaskScheduler> throttled_;
+  std::unique_ptr<AsyncTaskGroup> task_group_;
+};
+
+std::unique_ptr<AsyncTaskScope> AsyncTaskScope::Make(AsyncTaskScheduler* target,
+                                                     AsyncTaskScopeOptions options) {
+  return std::make_unique<AsyncTaskScopeImpl>(target, std::move(options));
+}
+
 }  // namespace util
 }  // namespace arrow
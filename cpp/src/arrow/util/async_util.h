@@ -18,9 +18,11 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <functional>
 #include <list>
 #include <memory>
+#include <optional>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -375,6 +377,68 @@ ARROW_EXPORT std::unique_ptr<ThrottledAsyncTaskScheduler> MakeThrottledAsyncTask
     std::unique_ptr<ThrottledAsyncTaskScheduler::Queue> queue,
     FnOnce<Status()> finish_callback);
 
+/// Options describing an AsyncTaskScope
+struct AsyncTaskScopeOptions {
+  /// The maximum total task cost allowed to run at any one time
+  ///
+  /// A value <= 0 leaves the scope unthrottled.
+  int max_concurrent_cost = 0;
+  /// The queue to use when tasks cannot be submitted (FIFO by default)
+  ///
+  /// Only meaningful when the scope is throttled.
+  std::unique_ptr<ThrottledAsyncTaskScheduler::Queue> queue;
+  /// An optional deadline for the scope
+  ///
+  /// Tasks added after the deadline has passed will fail with Status::Cancelled,
+  /// aborting the scope (and its enclosing scheduler).  Child scopes inherit the
+  /// tighter of their own and their parent's deadline.
+  std::optional<std::chrono::steady_clock::time_point> deadline;
+  /// A callback run after the scope is destroyed and all its tasks have finished
+  FnOnce<Status()> finish_callback;
+};
+
+/// A structured-concurrency scope over an AsyncTaskScheduler
+///
+/// Composing nested fan-out hierarchies (e.g. scan/decode/write) out of throttled
+/// views and task groups requires repeating the same careful wiring every time:
+/// a throttle must outlive its task group, failures should promptly stop sibling
+/// and child work, and per-stage limits must nest correctly.  A scope bundles
+/// that wiring:
+///
+///  * tasks added to the scope are joined like an AsyncTaskGroup (the finish
+///    callback runs once the scope is destroyed and all its tasks finished)
+///  * an optional per-scope throttle limits concurrent cost
+///  * a failing task stops the scope's stop token, which child scopes inherit,
+///    so in-flight work can notice the abort promptly (via StopToken::Poll or
+///    StopToken::SetCallback) instead of running to completion
+///  * an optional deadline fails tasks added after it has passed
+///
+/// Like AsyncTaskGroup, destroying the scope does not block; it only marks the
+/// scope as done accepting tasks.
+class ARROW_EXPORT AsyncTaskScope : public ThrottledAsyncTaskScheduler {
+ public:
+  /// A token that is stopped when a task in this scope (or an enclosing scope)
+  /// fails, or when the scope's deadline has passed
+  ///
+  /// Long-running tasks should poll this token (or register a callback on it)
+  /// to abort promptly on scope failure.
+  virtual StopToken stop_token() const = 0;
+
+  /// Create a child scope
+  ///
+  /// The child submits its tasks through this scope (inheriting its throttle)
+  /// and is stopped automatically when this scope fails.
+  virtual std::unique_ptr<AsyncTaskScope> MakeChildScope(
+      AsyncTaskScopeOptions options) = 0;
+
+  /// Create a scope submitting tasks to `target`
+  ///
+  /// The caller must keep the returned scope alive for as long as they plan to
+  /// add tasks to it and destroy it to trigger the finish callback.
+  static std::unique_ptr<AsyncTaskScope> Make(AsyncTaskScheduler* target,
+                                              AsyncTaskScopeOptions options);
+};
+
 // Defined down here to avoid circular dependency between AsyncTaskScheduler and
 // AsyncTaskGroup
 template <typename T>
@@ -294,6 +294,97 @@ TEST(AsyncTaskScheduler, TaskGroupFinishCallbackFails) {
   ASSERT_FINISHES_AND_RAISES(Invalid, finished);
 }
 
+TEST(AsyncTaskScheduler, ScopeBasics) {
+  Future<> task = Future<>::Make();
+  bool finish_callback_ran = false;
+  Future<> finished = AsyncTaskScheduler::Make([&](AsyncTaskScheduler* scheduler) {
+    AsyncTaskScopeOptions options;
+    options.finish_callback = [&] {
+      finish_callback_ran = true;
+      return Status::OK();
+    };
+    std::unique_ptr<AsyncTaskScope> scope =
+        AsyncTaskScope::Make(scheduler, std::move(options));
+    EXPECT_TRUE(scope->AddSimpleTask([&]() { return task; }, kDummyName));
+    EXPECT_FALSE(scope->stop_token().IsStopRequested());
+    return Status::OK();
+  });
+  ASSERT_FALSE(finish_callback_ran);
+  AssertNotFinished(finished);
+  task.MarkFinished();
+  ASSERT_FINISHES_OK(finished);
+  ASSERT_TRUE(finish_callback_ran);
+}
+
+TEST(AsyncTaskScheduler, ScopeFailureStopsChildScope) {
+  Future<> failing_task = Future<>::Make();
+  Future<> slow_task = Future<>::Make();
+  std::unique_ptr<AsyncTaskScope> scope;
+  std::unique_ptr<AsyncTaskScope> child;
+  Future<> finished = AsyncTaskScheduler::Make([&](AsyncTaskScheduler* scheduler) {
+    scope = AsyncTaskScope::Make(scheduler, {});
+    child = scope->MakeChildScope({});
+    EXPECT_TRUE(scope->AddSimpleTask([&]() { return failing_task; }, kDummyName));
+    EXPECT_TRUE(child->AddSimpleTask([&]() { return slow_task; }, kDummyName));
+    return Status::OK();
+  });
+  ASSERT_FALSE(child->stop_token().IsStopRequested());
+  // A failing task in the parent scope promptly stops the child's token even
+  // though the child's task is still in flight
+  failing_task.MarkFinished(Status::Invalid("XYZ"));
+  ASSERT_TRUE(child->stop_token().IsStopRequested());
+  ASSERT_RAISES(Invalid, child->stop_token().Poll());
+  slow_task.MarkFinished();
+  child.reset();
+  scope.reset();
+  ASSERT_FINISHES_AND_RAISES(Invalid, finished);
+}
+
+TEST(AsyncTaskScheduler, ScopeDeadline) {
+  bool task_ran = false;
+  Future<> finished = AsyncTaskScheduler::Make([&](AsyncTaskScheduler* scheduler) {
+    AsyncTaskScopeOptions options;
+    options.deadline = std::chrono::steady_clock::now() - std::chrono::seconds(1);
+    std::unique_ptr<AsyncTaskScope> scope =
+        AsyncTaskScope::Make(scheduler, std::move(options));
+    EXPECT_FALSE(scope->AddSimpleTask(
+        [&]() {
+          task_ran = true;
+          return Future<>::MakeFinished();
+        },
+        kDummyName));
+    EXPECT_TRUE(scope->stop_token().IsStopRequested());
+    return Status::OK();
+  });
+  ASSERT_FINISHES_AND_RAISES(Cancelled, finished);
+  ASSERT_FALSE(task_ran);
+}
+
+TEST(AsyncTaskScheduler, ScopeThrottle) {
+  Future<> task_one = Future<>::Make();
+  bool second_submitted = false;
+  std::unique_ptr<AsyncTaskScope> scope;
+  Future<> finished = AsyncTaskScheduler::Make([&](AsyncTaskScheduler* scheduler) {
+    AsyncTaskScopeOptions options;
+    options.max_concurrent_cost = 1;
+    scope = AsyncTaskScope::Make(scheduler, std::move(options));
+    EXPECT_TRUE(scope->AddSimpleTask([&]() { return task_one; }, kDummyName));
+    EXPECT_TRUE(scope->AddSimpleTask(
+        [&]() {
+          second_submitted = true;
+          return Future<>::MakeFinished();
+        },
+        kDummyName));
+    EXPECT_EQ(scope->QueueSize(), 1);
+    EXPECT_FALSE(second_submitted);
+    return Status::OK();
+  });
+  task_one.MarkFinished();
+  ASSERT_TRUE(second_submitted);
+  scope.reset();
+  ASSERT_FINISHES_OK(finished);
+}
+
 #ifndef ARROW_VALGRIND
 TEST(AsyncTaskScheduler, FailingTaskStress) {
   // Test many tasks failing at the same time
@@ -625,17 +625,13 @@ inline void MultiplyUnsignedArray(const std::array<uint64_t, N>& lh,
 }  // namespace
 
 BasicDecimal128& BasicDecimal128::operator*=(const BasicDecimal128& right) {
-  // Since the max value of BasicDecimal128 is supposed to be 1e38 - 1 and the
-  // min the negation taking the absolute values here should always be safe.
-  const bool negate = Sign() != right.Sign();
-  BasicDecimal128 x = BasicDecimal128::Abs(*this);
-  BasicDecimal128 y = BasicDecimal128::Abs(right);
-  uint128_t r(x);
-  r *= uint128_t{y};
+  // The low 128 bits of the product of the two's complement representations
+  // are the two's complement representation of the product, so the signs need
+  // no separate handling. Keeping the multiply branch-free lets the compiler
+  // overlap several elements of a kernel loop.
+  uint128_t r(*this);
+  r *= uint128_t{right};
   *this = BasicDecimal128(static_cast<int64_t>(r.hi()), r.lo());
-  if (negate) {
-    Negate();
-  }
   return *this;
 }
 
@@ -1259,18 +1255,12 @@ BasicDecimal256& BasicDecimal256::operator>>=(uint32_t bits) {
 }
 
 BasicDecimal256& BasicDecimal256::operator*=(const BasicDecimal256& right) {
-  // Since the max value of BasicDecimal256 is supposed to be 1e76 - 1 and the
-  // min the negation taking the absolute values here should always be safe.
-  const bool negate = Sign() != right.Sign();
-  BasicDecimal256 x = BasicDecimal256::Abs(*this);
-  BasicDecimal256 y = BasicDecimal256::Abs(right);
-
+  // As for BasicDecimal128, the product truncated to 256 bits is the two's
+  // complement representation of the product, so the signs need no separate
+  // handling.
   std::array<uint64_t, 4> res{0, 0, 0, 0};
-  MultiplyUnsignedArray<4>(x.array_, y.array_, &res);
+  MultiplyUnsignedArray<4>(array_, right.array_, &res);
   array_ = res;
-  if (negate) {
-    Negate();
-  }
   return *this;
 }
 
@@ -1438,6 +1438,35 @@ TEST_F(BitmapOp, AndNot) {
   TestUnaligned(op, left, right, result);
 }
 
+TEST_F(BitmapOp, RandomAnd) {
+  // Long bitmaps exercise the word-at-a-time paths, including the
+  // shift-normalization fast path for byte-aligned outputs
+  const int kBitCount = 1000;
+  uint8_t buffer[kBitCount * 2] = {0};
+
+  random_bytes(kBitCount * 2, 0, buffer);
+
+  std::vector<int> left(kBitCount);
+  std::vector<int> right(kBitCount);
+  std::vector<int> result(kBitCount);
+
+  for (int i = 0; i < kBitCount; ++i) {
+    left[i] = buffer[i] & 1;
+    right[i] = buffer[i + kBitCount] & 1;
+    result[i] = left[i] & right[i];
+  }
+
+  BitmapAndOp op;
+  for (int i = 0; i < 3; ++i) {
+    TestAligned(op, left, right, result);
+    TestUnaligned(op, left, right, result);
+
+    left.resize(left.size() * 5 / 11);
+    right.resize(left.size());
+    result.resize(left.size());
+  }
+}
+
 TEST_F(BitmapOp, RandomXor) {
   const int kBitCount = 1000;
   uint8_t buffer[kBitCount * 2] = {0};
@@ -1498,6 +1527,30 @@ TEST(BitUtilTests, TestCountSetBits) {
   }
 }
 
+TEST(BitUtilTests, TestCountSetBitsBatch) {
+  const int kBufferSize = 1000;
+  alignas(8) uint8_t buffer[kBufferSize] = {0};
+  const int buffer_bits = kBufferSize * 8;
+
+  random_bytes(kBufferSize, 0, buffer);
+
+  // A mix of offsets, lengths and null bitmaps
+  std::vector<internal::BitmapRange> ranges = {
+      {buffer, 0, buffer_bits},   {buffer, 12, 345},  {nullptr, 0, 100},
+      {buffer, 63, 1},            {buffer + 1, 7, buffer_bits - 200},
+      {buffer, 0, 0},             {buffer, 128, buffer_bits - 128}};
+  std::vector<int64_t> counts(ranges.size());
+  internal::CountSetBitsBatch(ranges.data(), static_cast<int64_t>(ranges.size()),
+                              counts.data());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const int64_t expected =
+        ranges[i].data == nullptr
+            ? 0
+            : SlowCountBits(ranges[i].data, ranges[i].offset, ranges[i].length);
+    ASSERT_EQ(expected, counts[i]) << "range " << i;
+  }
+}
+
 TEST(BitUtilTests, TestSetBitsTo) {
   using bit_util::SetBitsTo;
   for (const auto fill_byte_int : {0x00, 0xff}) {
@@ -118,6 +118,28 @@ Result<std::shared_ptr<Buffer>> ReverseBitmap(MemoryPool* pool, const uint8_t* b
 ARROW_EXPORT
 int64_t CountSetBits(const uint8_t* data, int64_t bit_offset, int64_t length);
 
+/// A bitmap range for batched bit counting
+struct BitmapRange {
+  /// The bitmap data, may be null (counted as 0)
+  const uint8_t* data;
+  /// A bitwise offset into the bitmap
+  int64_t offset;
+  /// The number of bits to inspect, relative to the offset
+  int64_t length;
+};
+
+/// Compute CountSetBits() over several bitmaps in one pass
+///
+/// While one bitmap is being counted, the start of the next one is
+/// prefetched, which hides memory latency when many cold bitmaps are
+/// counted back to back (e.g. the null counts of a wide record batch).
+///
+/// \param[in] ranges the bitmap ranges to count
+/// \param[in] num_ranges the number of entries in `ranges`
+/// \param[out] counts the number of set bits in each range, in range order
+ARROW_EXPORT
+void CountSetBitsBatch(const BitmapRange* ranges, int64_t num_ranges, int64_t* counts);
+
 /// Compute the number of 1's in the result of an "and" (&) of two bitmaps
 ///
 /// \param[in] left_bitmap a packed LSB-ordered bitmap as a byte array
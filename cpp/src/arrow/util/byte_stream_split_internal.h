@@ -379,11 +379,184 @@ void ByteStreamSplitEncodeAvx2(const uint8_t* raw_values, int width,
 }
 #endif  // ARROW_HAVE_AVX2
 
+#if defined(ARROW_HAVE_AVX512)
+// Interleave the 128-bit lanes of four vectors:
+//   out[l] = {in[0].lane[l], in[1].lane[l], in[2].lane[l], in[3].lane[l]}
+// using 64-bit cross-lane permutes (AVX-512F only, no VBMI required).
+inline void InterleaveLanesAvx512(const __m512i* in, __m512i* out) {
+  const __m512i kLanePairLo = _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11);
+  const __m512i kLanePairHi = _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15);
+  const __m512i kHalvesLo = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+  const __m512i kHalvesHi = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+
+  const __m512i t0 = _mm512_permutex2var_epi64(in[0], kLanePairLo, in[1]);
+  const __m512i t1 = _mm512_permutex2var_epi64(in[2], kLanePairLo, in[3]);
+  const __m512i t2 = _mm512_permutex2var_epi64(in[0], kLanePairHi, in[1]);
+  const __m512i t3 = _mm512_permutex2var_epi64(in[2], kLanePairHi, in[3]);
+  out[0] = _mm512_permutex2var_epi64(t0, kHalvesLo, t1);
+  out[1] = _mm512_permutex2var_epi64(t0, kHalvesHi, t1);
+  out[2] = _mm512_permutex2var_epi64(t2, kHalvesLo, t3);
+  out[3] = _mm512_permutex2var_epi64(t2, kHalvesHi, t3);
+}
+
+template <int kNumStreams>
+void ByteStreamSplitDecodeAvx512(const uint8_t* data, int width, int64_t num_values,
+                                 int64_t stride, uint8_t* out) {
+  assert(width == kNumStreams);
+  static_assert(kNumStreams == 4 || kNumStreams == 8, "Invalid number of streams.");
+  constexpr int kNumStreamsLog2 = (kNumStreams == 8 ? 3 : 2);
+  constexpr int64_t kBlockSize = sizeof(__m512i) * kNumStreams;
+
+  const int64_t size = num_values * kNumStreams;
+  if (size < kBlockSize)  // Back to AVX2 for small size
+    return ByteStreamSplitDecodeAvx2<kNumStreams>(data, width, num_values, stride, out);
+  const int64_t num_blocks = size / kBlockSize;
+
+  // First handle suffix.
+  const int64_t num_processed_elements = (num_blocks * kBlockSize) / kNumStreams;
+  for (int64_t i = num_processed_elements; i < num_values; ++i) {
+    uint8_t gathered_byte_data[kNumStreams];
+    for (int b = 0; b < kNumStreams; ++b) {
+      const int64_t byte_index = b * stride + i;
+      gathered_byte_data[b] = data[byte_index];
+    }
+    memcpy(out + i * kNumStreams, gathered_byte_data, kNumStreams);
+  }
+
+  // Processed hierarchically using unpack intrinsics as in the AVX2 path.
+  // The unpacks work within 128-bit lanes, so after the unpack stages the
+  // 16-byte output groups are correct per lane but scattered across vectors:
+  // output vector m is made of one lane of each of four stage vectors, which
+  // InterleaveLanesAvx512 reassembles.
+  __m512i stage[kNumStreamsLog2 + 1][kNumStreams];
+  __m512i final_result[kNumStreams];
+  constexpr int kNumStreamsHalf = kNumStreams / 2;
+
+  for (int64_t i = 0; i < num_blocks; ++i) {
+    for (int j = 0; j < kNumStreams; ++j) {
+      stage[0][j] = _mm512_loadu_si512(
+          reinterpret_cast<const __m512i*>(&data[i * sizeof(__m512i) + j * stride]));
+    }
+
+    for (int step = 0; step < kNumStreamsLog2; ++step) {
+      for (int j = 0; j < kNumStreamsHalf; ++j) {
+        stage[step + 1][j * 2] =
+            _mm512_unpacklo_epi8(stage[step][j], stage[step][kNumStreamsHalf + j]);
+        stage[step + 1][j * 2 + 1] =
+            _mm512_unpackhi_epi8(stage[step][j], stage[step][kNumStreamsHalf + j]);
+      }
+    }
+
+    if constexpr (kNumStreams == 8) {
+      // path for double: lane l of stage vectors 0-3 forms output vector 2l,
+      // lane l of stage vectors 4-7 forms output vector 2l+1
+      __m512i lanes_low[4];
+      __m512i lanes_high[4];
+      InterleaveLanesAvx512(&stage[kNumStreamsLog2][0], lanes_low);
+      InterleaveLanesAvx512(&stage[kNumStreamsLog2][4], lanes_high);
+      for (int l = 0; l < 4; ++l) {
+        final_result[l * 2] = lanes_low[l];
+        final_result[l * 2 + 1] = lanes_high[l];
+      }
+    } else {
+      // path for float: lane l of the four stage vectors forms output vector l
+      InterleaveLanesAvx512(&stage[kNumStreamsLog2][0], final_result);
+    }
+
+    for (int j = 0; j < kNumStreams; ++j) {
+      _mm512_storeu_si512(
+          reinterpret_cast<__m512i*>(out + (i * kNumStreams + j) * sizeof(__m512i)),
+          final_result[j]);
+    }
+  }
+}
+
+template <int kNumStreams>
+void ByteStreamSplitEncodeAvx512(const uint8_t* raw_values, int width,
+                                 const int64_t num_values,
+                                 uint8_t* output_buffer_raw) {
+  assert(width == kNumStreams);
+  static_assert(kNumStreams == 4 || kNumStreams == 8, "Invalid number of streams.");
+
+  if constexpr (kNumStreams == 8) {  // Back to AVX2, currently no path for double.
+    return ByteStreamSplitEncodeAvx2<kNumStreams>(raw_values, width, num_values,
+                                                  output_buffer_raw);
+  } else {
+    constexpr int64_t kBlockSize = sizeof(__m512i) * kNumStreams;
+
+    const int64_t size = num_values * kNumStreams;
+    if (size < kBlockSize)  // Back to AVX2 for small size
+      return ByteStreamSplitEncodeAvx2<kNumStreams>(raw_values, width, num_values,
+                                                    output_buffer_raw);
+    const int64_t num_blocks = size / kBlockSize;
+
+    // First handle suffix.
+    const int64_t num_processed_elements = (num_blocks * kBlockSize) / kNumStreams;
+    for (int64_t i = num_processed_elements; i < num_values; ++i) {
+      for (int j = 0; j < kNumStreams; ++j) {
+        const uint8_t byte_in_value = raw_values[i * kNumStreams + j];
+        output_buffer_raw[j * num_values + i] = byte_in_value;
+      }
+    }
+
+    // Path for float.
+    // 1. Group the bytes of each stream within every 128-bit lane with a
+    //    per-lane byte shuffle: lane dword s then holds the stream-s bytes of
+    //    the lane's four values.
+    // 2. Gather the dwords of each stream across vectors with two rounds of
+    //    32-bit cross-lane permutes.
+    const __m512i kByteGroupMask = _mm512_broadcast_i32x4(
+        _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15));
+    // Streams 0 and 1 of a vector pair, in value order
+    const __m512i kStreamsEven = _mm512_setr_epi32(0, 4, 8, 12, 16, 20, 24, 28,  //
+                                                   1, 5, 9, 13, 17, 21, 25, 29);
+    // Streams 2 and 3 of a vector pair, in value order
+    const __m512i kStreamsOdd = _mm512_setr_epi32(2, 6, 10, 14, 18, 22, 26, 30,  //
+                                                  3, 7, 11, 15, 19, 23, 27, 31);
+    const __m512i kHalvesLo = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,  //
+                                                16, 17, 18, 19, 20, 21, 22, 23);
+    const __m512i kHalvesHi = _mm512_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15,  //
+                                                24, 25, 26, 27, 28, 29, 30, 31);
+
+    for (int64_t i = 0; i < num_blocks; ++i) {
+      __m512i grouped[kNumStreams];
+      for (int j = 0; j < kNumStreams; ++j) {
+        const __m512i loaded = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(
+            &raw_values[(i * kNumStreams + j) * sizeof(__m512i)]));
+        grouped[j] = _mm512_shuffle_epi8(loaded, kByteGroupMask);
+      }
+
+      const __m512i even01 = _mm512_permutex2var_epi32(grouped[0], kStreamsEven,
+                                                       grouped[1]);
+      const __m512i even23 = _mm512_permutex2var_epi32(grouped[2], kStreamsEven,
+                                                       grouped[3]);
+      const __m512i odd01 = _mm512_permutex2var_epi32(grouped[0], kStreamsOdd,
+                                                      grouped[1]);
+      const __m512i odd23 = _mm512_permutex2var_epi32(grouped[2], kStreamsOdd,
+                                                      grouped[3]);
+
+      const __m512i stream0 = _mm512_permutex2var_epi32(even01, kHalvesLo, even23);
+      const __m512i stream1 = _mm512_permutex2var_epi32(even01, kHalvesHi, even23);
+      const __m512i stream2 = _mm512_permutex2var_epi32(odd01, kHalvesLo, odd23);
+      const __m512i stream3 = _mm512_permutex2var_epi32(odd01, kHalvesHi, odd23);
+
+      uint8_t* out = output_buffer_raw + i * sizeof(__m512i);
+      _mm512_storeu_si512(reinterpret_cast<__m512i*>(out), stream0);
+      _mm512_storeu_si512(reinterpret_cast<__m512i*>(out + num_values), stream1);
+      _mm512_storeu_si512(reinterpret_cast<__m512i*>(out + num_values * 2), stream2);
+      _mm512_storeu_si512(reinterpret_cast<__m512i*>(out + num_values * 3), stream3);
+    }
+  }
+}
+#endif  // ARROW_HAVE_AVX512
+
 #if defined(ARROW_HAVE_SIMD_SPLIT)
 template <int kNumStreams>
 void inline ByteStreamSplitDecodeSimd(const uint8_t* data, int width, int64_t num_values,
                                       int64_t stride, uint8_t* out) {
-#  if defined(ARROW_HAVE_AVX2)
+#  if defined(ARROW_HAVE_AVX512)
+  return ByteStreamSplitDecodeAvx512<kNumStreams>(data, width, num_values, stride, out);
+#  elif defined(ARROW_HAVE_AVX2)
   return ByteStreamSplitDecodeAvx2<kNumStreams>(data, width, num_values, stride, out);
 #  elif defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_NEON)
   return ByteStreamSplitDecodeSimd128<kNumStreams>(data, width, num_values, stride, out);
@@ -396,7 +569,10 @@ template <int kNumStreams>
 void inline ByteStreamSplitEncodeSimd(const uint8_t* raw_values, int width,
                                       const int64_t num_values,
                                       uint8_t* output_buffer_raw) {
-#  if defined(ARROW_HAVE_AVX2)
+#  if defined(ARROW_HAVE_AVX512)
+  return ByteStreamSplitEncodeAvx512<kNumStreams>(raw_values, width, num_values,
+                                                  output_buffer_raw);
+#  elif defined(ARROW_HAVE_AVX2)
   return ByteStreamSplitEncodeAvx2<kNumStreams>(raw_values, width, num_values,
                                                 output_buffer_raw);
 #  elif defined(ARROW_HAVE_SSE4_2) || defined(ARROW_HAVE_NEON)
@@ -45,9 +45,19 @@ using internal::SignalHandler;
 // NOTE: We care mainly about the making the common case (not cancelled) fast.
 
 struct StopSourceImpl {
+  using Callback = std::pair<uint64_t, std::function<void(const Status&)>>;
+
   std::atomic<int> requested_{0};  // will be -1 or signal number if requested
   std::mutex mutex_;
   Status cancel_error_;
+  std::vector<Callback> callbacks_;
+  uint64_t next_callback_id_ = 1;
+
+  // Steal the registered callbacks; caller should invoke them without
+  // holding `mutex_`.
+  std::vector<Callback> TakeCallbacksUnlocked() {
+    return std::exchange(callbacks_, {});
+  }
 };
 
 StopSource::StopSource() : impl_(std::make_shared<StopSourceImpl>()) {}
@@ -57,11 +67,21 @@ StopSource::~StopSource() = default;
 void StopSource::RequestStop() { RequestStop(Status::Cancelled("Operation cancelled")); }
 
 void StopSource::RequestStop(Status st) {
-  std::lock_guard<std::mutex> lock(impl_->mutex_);
-  DCHECK(!st.ok());
-  if (!impl_->requested_) {
+  std::vector<StopSourceImpl::Callback> callbacks;
+  Status error;
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    DCHECK(!st.ok());
+    if (impl_->requested_) {
+      return;
+    }
     impl_->requested_ = -1;
     impl_->cancel_error_ = std::move(st);
+    callbacks = impl_->TakeCallbacksUnlocked();
+    error = impl_->cancel_error_;
+  }
+  for (auto& callback : callbacks) {
+    std::move(callback.second)(error);
   }
 }
 
@@ -93,15 +113,84 @@ Status StopToken::Poll() const {
     return Status::OK();
   }
 
-  std::lock_guard<std::mutex> lock(impl_->mutex_);
-  if (impl_->cancel_error_.ok()) {
-    auto signum = impl_->requested_.load();
-    DCHECK_GT(signum, 0);
-    impl_->cancel_error_ = internal::CancelledFromSignal(signum, "Operation cancelled");
+  std::vector<StopSourceImpl::Callback> callbacks;
+  Status error;
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    if (impl_->cancel_error_.ok()) {
+      auto signum = impl_->requested_.load();
+      DCHECK_GT(signum, 0);
+      impl_->cancel_error_ = internal::CancelledFromSignal(signum, "Operation cancelled");
+    }
+    // A stop requested from a signal handler couldn't invoke callbacks in an
+    // async-signal-safe way; deliver them from here instead.
+    callbacks = impl_->TakeCallbacksUnlocked();
+    error = impl_->cancel_error_;
+  }
+  for (auto& callback : callbacks) {
+    std::move(callback.second)(error);
+  }
+  return error;
+}
+
+StopCallbackHandle StopToken::SetCallback(
+    std::function<void(const Status&)> callback) const {
+  if (!impl_) {
+    return {};
+  }
+  Status error;
+  {
+    std::lock_guard<std::mutex> lock(impl_->mutex_);
+    if (!impl_->requested_.load()) {
+      const uint64_t id = impl_->next_callback_id_++;
+      impl_->callbacks_.emplace_back(id, std::move(callback));
+      return StopCallbackHandle(impl_, id);
+    }
+    if (impl_->cancel_error_.ok()) {
+      auto signum = impl_->requested_.load();
+      DCHECK_GT(signum, 0);
+      impl_->cancel_error_ = internal::CancelledFromSignal(signum, "Operation cancelled");
+    }
+    error = impl_->cancel_error_;
   }
-  return impl_->cancel_error_;
+  // Already stopped: invoke in place, nothing to unregister
+  std::move(callback)(error);
+  return {};
 }
 
+StopCallbackHandle::StopCallbackHandle(std::shared_ptr<StopSourceImpl> impl, uint64_t id)
+    : impl_(std::move(impl)), id_(id) {}
+
+StopCallbackHandle::StopCallbackHandle(StopCallbackHandle&& other)
+    : impl_(std::move(other.impl_)), id_(std::exchange(other.id_, 0)) {}
+
+namespace {
+
+void UnregisterStopCallback(StopSourceImpl* impl, uint64_t id) {
+  if (impl == nullptr) {
+    return;
+  }
+  std::lock_guard<std::mutex> lock(impl->mutex_);
+  auto& callbacks = impl->callbacks_;
+  for (auto it = callbacks.begin(); it != callbacks.end(); ++it) {
+    if (it->first == id) {
+      callbacks.erase(it);
+      break;
+    }
+  }
+}
+
+}  // namespace
+
+StopCallbackHandle& StopCallbackHandle::operator=(StopCallbackHandle&& other) {
+  UnregisterStopCallback(impl_.get(), id_);
+  impl_ = std::move(other.impl_);
+  id_ = std::exchange(other.id_, 0);
+  return *this;
+}
+
+StopCallbackHandle::~StopCallbackHandle() { UnregisterStopCallback(impl_.get(), id_); }
+
 namespace {
 
 struct SignalStopState : public std::enable_shared_from_this<SignalStopState> {
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -54,6 +55,30 @@ class ARROW_EXPORT StopSource {
   std::shared_ptr<StopSourceImpl> impl_;
 };
 
+/// EXPERIMENTAL: RAII registration of a stop callback
+///
+/// Returned by StopToken::SetCallback().  The callback stays registered
+/// until this handle is destroyed (or until it fires, whichever comes
+/// first).  A default-constructed handle is empty and unregisters nothing.
+class ARROW_EXPORT StopCallbackHandle {
+ public:
+  StopCallbackHandle() = default;
+  ~StopCallbackHandle();
+
+  StopCallbackHandle(StopCallbackHandle&&);
+  StopCallbackHandle& operator=(StopCallbackHandle&&);
+
+ protected:
+  friend class StopToken;
+  StopCallbackHandle(std::shared_ptr<StopSourceImpl> impl, uint64_t id);
+
+  std::shared_ptr<StopSourceImpl> impl_;
+  uint64_t id_ = 0;
+
+ private:
+  ARROW_DISALLOW_COPY_AND_ASSIGN(StopCallbackHandle);
+};
+
 /// EXPERIMENTAL
 class ARROW_EXPORT StopToken {
  public:
@@ -80,6 +105,26 @@ class ARROW_EXPORT StopToken {
   Status Poll() const;
   bool IsStopRequested() const;
 
+  /// \brief Register a callback invoked as soon as a stop is requested.
+  ///
+  /// Polling only reacts to cancellation at the producer's convenience;
+  /// a long-running operation such as a network transfer can keep consuming
+  /// resources long after the consumer gave up.  A stop callback lets such
+  /// operations abort promptly: it is invoked exactly once with the cancel
+  /// error, on the thread calling StopSource::RequestStop() (or immediately
+  /// on this thread if a stop was already requested).  Callbacks should be
+  /// fast, must not throw, and must not call back into this API.
+  ///
+  /// Stops requested from a signal handler
+  /// (StopSource::RequestStopFromSignal) cannot invoke callbacks right away,
+  /// as doing so would not be async-signal-safe; they are invoked on the
+  /// next Poll() or SetCallback() call instead.
+  ///
+  /// The callback is unregistered when the returned handle is destroyed.
+  ///
+  /// This method is thread-safe.
+  StopCallbackHandle SetCallback(std::function<void(const Status&)> callback) const;
+
  protected:
   std::shared_ptr<StopSourceImpl> impl_;
 };
@@ -123,6 +123,69 @@ TEST_F(CancelTest, SourceVanishes) {
   }
 }
 
+TEST_F(CancelTest, StopCallback) {
+  StopSource source;
+  StopToken token = source.token();
+  int called = 0;
+  Status received;
+  StopCallbackHandle handle = token.SetCallback([&](const Status& st) {
+    received = st;
+    ++called;
+  });
+  ASSERT_EQ(called, 0);
+
+  source.RequestStop(Status::IOError("Operation cancelled"));
+  ASSERT_EQ(called, 1);
+  ASSERT_RAISES(IOError, received);
+
+  // The callback fires at most once
+  source.RequestStop();
+  ARROW_UNUSED(token.Poll());
+  ASSERT_EQ(called, 1);
+}
+
+TEST_F(CancelTest, StopCallbackAlreadyStopped) {
+  StopSource source;
+  source.RequestStop();
+  int called = 0;
+  // Invoked immediately since a stop was already requested
+  StopCallbackHandle handle = source.token().SetCallback([&](const Status& st) {
+    ASSERT_RAISES(Cancelled, st);
+    ++called;
+  });
+  ASSERT_EQ(called, 1);
+}
+
+TEST_F(CancelTest, StopCallbackUnregister) {
+  StopSource source;
+  StopToken token = source.token();
+  int called = 0;
+  { StopCallbackHandle handle = token.SetCallback([&](const Status&) { ++called; }); }
+  source.RequestStop();
+  ASSERT_EQ(called, 0);
+}
+
+TEST_F(CancelTest, StopCallbackUnstoppable) {
+  int called = 0;
+  StopCallbackHandle handle =
+      StopToken::Unstoppable().SetCallback([&](const Status&) { ++called; });
+  ASSERT_EQ(called, 0);
+}
+
+TEST_F(CancelTest, StopCallbackFromSignalDeferred) {
+  StopSource source;
+  StopToken token = source.token();
+  int called = 0;
+  StopCallbackHandle handle = token.SetCallback([&](const Status&) { ++called; });
+  source.RequestStopFromSignal(SIGINT);
+  // Invoking callbacks wouldn't be async-signal-safe, so the stop request
+  // is only noticed here...
+  ASSERT_EQ(called, 0);
+  // ... and the callback is delivered on the next Poll()
+  ASSERT_RAISES(Cancelled, token.Poll());
+  ASSERT_EQ(called, 1);
+}
+
 static void noop_signal_handler(int signum) {
   internal::ReinstateSignalHandler(signum, &noop_signal_handler);
 }
@@ -17,15 +17,20 @@
 
 #include "arrow/util/compression.h"
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
 #include "arrow/util/compression_internal.h"
 #include "arrow/util/config.h"
+#include "arrow/util/future.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace util {
@@ -40,12 +45,169 @@ Status CheckSupportsCompressionLevel(Compression::type type) {
   return Status::OK();
 }
 
+// Codec wrapper that watches the achieved compression ratio and falls back
+// to the fastest level when the data barely shrinks.  One window of input
+// (1 MiB) is accounted at a time; after an incompressible window, the next
+// windows are compressed with the fast codec, and the configured level is
+// retried every 16 windows so that a change in the data mix is noticed.
+class AdaptiveLevelCodec : public Codec {
+ public:
+  AdaptiveLevelCodec(std::unique_ptr<Codec> configured, std::unique_ptr<Codec> fast)
+      : configured_(std::move(configured)), fast_(std::move(fast)) {}
+
+  Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
+                           int64_t output_buffer_len, uint8_t* output_buffer) override {
+    Codec* codec = PickCodec();
+    ARROW_ASSIGN_OR_RAISE(int64_t output_len, codec->Compress(input_len, input,
+                                                              output_buffer_len,
+                                                              output_buffer));
+    RecordWindow(input_len, output_len);
+    return output_len;
+  }
+
+  Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
+                             int64_t output_buffer_len, uint8_t* output_buffer) override {
+    return configured_->Decompress(input_len, input, output_buffer_len, output_buffer);
+  }
+
+  int64_t MaxCompressedLen(int64_t input_len, const uint8_t* input) override {
+    return configured_->MaxCompressedLen(input_len, input);
+  }
+
+  Result<int64_t> FindFrameCompressedSize(int64_t input_len,
+                                          const uint8_t* input) override {
+    return configured_->FindFrameCompressedSize(input_len, input);
+  }
+
+  Result<std::shared_ptr<Compressor>> MakeCompressor() override {
+    // A stream cannot change level once started; use the level current now
+    return PickCodec()->MakeCompressor();
+  }
+
+  Result<std::shared_ptr<Decompressor>> MakeDecompressor() override {
+    return configured_->MakeDecompressor();
+  }
+
+  Compression::type compression_type() const override {
+    return configured_->compression_type();
+  }
+  int minimum_compression_level() const override {
+    return configured_->minimum_compression_level();
+  }
+  int maximum_compression_level() const override {
+    return configured_->maximum_compression_level();
+  }
+  int default_compression_level() const override {
+    return configured_->default_compression_level();
+  }
+  int compression_level() const override { return configured_->compression_level(); }
+
+ private:
+  static constexpr int64_t kWindowBytes = 1 << 20;
+  // A window shrinking by less than ~5% is considered incompressible
+  static constexpr int64_t kIncompressibleNumerator = 243;  // 243/256 ~= 0.95
+  static constexpr int64_t kProbeEveryWindows = 16;
+
+  Codec* PickCodec() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!fast_mode_) return configured_.get();
+    // In fast mode, periodically probe with the configured level
+    return (window_index_ % kProbeEveryWindows == 0) ? configured_.get() : fast_.get();
+  }
+
+  void RecordWindow(int64_t input_len, int64_t output_len) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    window_in_ += input_len;
+    window_out_ += output_len;
+    if (window_in_ < kWindowBytes) return;
+    const bool incompressible =
+        window_out_ * 256 > window_in_ * kIncompressibleNumerator;
+    // Only mode-defining windows (configured-level output) may switch modes
+    if (!fast_mode_ || window_index_ % kProbeEveryWindows == 0) {
+      fast_mode_ = incompressible;
+    }
+    window_in_ = 0;
+    window_out_ = 0;
+    ++window_index_;
+  }
+
+  std::unique_ptr<Codec> configured_;
+  std::unique_ptr<Codec> fast_;
+  std::mutex mutex_;
+  int64_t window_in_ = 0;
+  int64_t window_out_ = 0;
+  int64_t window_index_ = 0;
+  bool fast_mode_ = false;
+};
+
 }  // namespace
 
 int Codec::UseDefaultCompressionLevel() { return kUseDefaultCompressionLevel; }
 
 Status Codec::Init() { return Status::OK(); }
 
+Result<std::vector<int64_t>> Codec::DecompressParallel(
+    const std::vector<DecompressFrame>& frames, ::arrow::internal::Executor* executor) {
+  std::vector<int64_t> lengths(frames.size());
+  if (executor == nullptr || frames.size() <= 1) {
+    for (size_t i = 0; i < frames.size(); ++i) {
+      ARROW_ASSIGN_OR_RAISE(
+          lengths[i], Decompress(frames[i].input_len, frames[i].input,
+                                 frames[i].output_len, frames[i].output));
+    }
+    return lengths;
+  }
+
+  std::vector<Future<int64_t>> futures;
+  futures.reserve(frames.size());
+  for (const auto& frame : frames) {
+    ARROW_ASSIGN_OR_RAISE(
+        auto future, executor->Submit([this, frame]() -> Result<int64_t> {
+          ARROW_ASSIGN_OR_RAISE(
+              auto codec, Codec::Create(compression_type(), compression_level()));
+          return codec->Decompress(frame.input_len, frame.input, frame.output_len,
+                                   frame.output);
+        }));
+    futures.push_back(std::move(future));
+  }
+  // Wait for all tasks even if one fails, since they write into caller-owned
+  // buffers that may not outlive this call.
+  Status st;
+  for (size_t i = 0; i < futures.size(); ++i) {
+    const auto& result = futures[i].result();
+    if (result.ok()) {
+      lengths[i] = *result;
+    } else {
+      st &= result.status();
+    }
+  }
+  RETURN_NOT_OK(st);
+  return lengths;
+}
+
+Result<int64_t> Codec::FindFrameCompressedSize(int64_t, const uint8_t*) {
+  return Status::NotImplemented("Codec '", name(),
+                                "' does not support frame size detection");
+}
+
+Result<std::vector<int64_t>> Codec::FindFrameBoundaries(int64_t input_len,
+                                                        const uint8_t* input) {
+  std::vector<int64_t> offsets;
+  int64_t pos = 0;
+  while (pos < input_len) {
+    ARROW_ASSIGN_OR_RAISE(int64_t frame_len,
+                          FindFrameCompressedSize(input_len - pos, input + pos));
+    if (frame_len <= 0 || frame_len > input_len - pos) {
+      return Status::IOError("Compressed frame at offset ", pos,
+                             " overruns input (frame size ", frame_len, ", remaining ",
+                             input_len - pos, " bytes)");
+    }
+    offsets.push_back(pos);
+    pos += frame_len;
+  }
+  return offsets;
+}
+
 const std::string& Codec::GetCodecAsString(Compression::type t) {
   static const std::string uncompressed = "uncompressed", snappy = "snappy",
                            gzip = "gzip", lzo = "lzo", brotli = "brotli",
@@ -190,21 +352,27 @@ Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
       codec = internal::MakeLz4RawCodec(compression_level);
 #endif
       break;
-    case Compression::LZ4_FRAME:
+    case Compression::LZ4_FRAME: {
 #ifdef ARROW_WITH_LZ4
-      codec = internal::MakeLz4FrameCodec(compression_level);
+      auto opt = dynamic_cast<const Lz4CodecOptions*>(&codec_options);
+      codec = internal::MakeLz4FrameCodec(
+          compression_level, opt ? opt->dictionary : std::vector<uint8_t>{});
 #endif
       break;
+    }
     case Compression::LZ4_HADOOP:
 #ifdef ARROW_WITH_LZ4
       codec = internal::MakeLz4HadoopRawCodec();
 #endif
       break;
-    case Compression::ZSTD:
+    case Compression::ZSTD: {
 #ifdef ARROW_WITH_ZSTD
-      codec = internal::MakeZSTDCodec(compression_level);
+      auto opt = dynamic_cast<const ZstdCodecOptions*>(&codec_options);
+      codec = internal::MakeZSTDCodec(compression_level,
+                                      opt ? opt->dictionary : std::vector<uint8_t>{});
 #endif
       break;
+    }
     case Compression::BZ2:
 #ifdef ARROW_WITH_BZ2
       codec = internal::MakeBZ2Codec(compression_level);
@@ -225,6 +393,38 @@ Result<std::unique_ptr<Codec>> Codec::Create(Compression::type codec_type,
   return Codec::Create(codec_type, CodecOptions{compression_level});
 }
 
+Result<std::unique_ptr<Codec>> Codec::CreateAdaptive(Compression::type codec_type,
+                                                     const CodecOptions& codec_options) {
+  ARROW_ASSIGN_OR_RAISE(auto configured, Create(codec_type, codec_options));
+  if (configured == nullptr || !SupportsCompressionLevel(codec_type)) {
+    // Nothing to adapt
+    return configured;
+  }
+  // "Fast" means the smallest supported level, but not the negative ZSTD
+  // levels which trade too much ratio away
+  const int fast_level = std::max(configured->minimum_compression_level(), 1);
+  if (configured->compression_level() <= fast_level) {
+    return configured;
+  }
+  // Duplicate the codec options with the fast level, preserving any
+  // codec-specific settings (e.g. a preset dictionary)
+  std::unique_ptr<CodecOptions> fast_options;
+  if (auto opt = dynamic_cast<const ZstdCodecOptions*>(&codec_options)) {
+    fast_options = std::make_unique<ZstdCodecOptions>(*opt);
+  } else if (auto opt = dynamic_cast<const Lz4CodecOptions*>(&codec_options)) {
+    fast_options = std::make_unique<Lz4CodecOptions>(*opt);
+  } else if (auto opt = dynamic_cast<const GZipCodecOptions*>(&codec_options)) {
+    fast_options = std::make_unique<GZipCodecOptions>(*opt);
+  } else if (auto opt = dynamic_cast<const BrotliCodecOptions*>(&codec_options)) {
+    fast_options = std::make_unique<BrotliCodecOptions>(*opt);
+  } else {
+    fast_options = std::make_unique<CodecOptions>(codec_options);
+  }
+  fast_options->compression_level = fast_level;
+  ARROW_ASSIGN_OR_RAISE(auto fast, Create(codec_type, *fast_options));
+  return std::make_unique<AdaptiveLevelCodec>(std::move(configured), std::move(fast));
+}
+
 bool Codec::IsAvailable(Compression::type codec_type) {
   switch (codec_type) {
     case Compression::UNCOMPRESSED:
@@ -22,6 +22,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -142,6 +143,35 @@ class ARROW_EXPORT BrotliCodecOptions : public CodecOptions {
   std::optional<int> window_bits;
 };
 
+// ----------------------------------------------------------------------
+// ZSTD codec options implementation
+
+class ARROW_EXPORT ZstdCodecOptions : public CodecOptions {
+ public:
+  /// \brief Optional preset dictionary
+  ///
+  /// When non-empty, the dictionary is loaded into every compressor and
+  /// decompressor created by the codec, so that many small streams can
+  /// share a dictionary trained on representative data.  Compressed output
+  /// can only be read back with the same dictionary.
+  std::vector<uint8_t> dictionary;
+};
+
+// ----------------------------------------------------------------------
+// LZ4 codec options implementation (LZ4 frame format)
+
+class ARROW_EXPORT Lz4CodecOptions : public CodecOptions {
+ public:
+  /// \brief Optional preset dictionary
+  ///
+  /// When non-empty, the dictionary is loaded into every compressor and
+  /// decompressor created by the codec, so that many small streams can
+  /// share a dictionary trained on representative data.  Compressed output
+  /// can only be read back with the same dictionary.  Only supported by
+  /// the LZ4 frame format codec.
+  std::vector<uint8_t> dictionary;
+};
+
 /// \brief Compression codec
 class ARROW_EXPORT Codec {
  public:
@@ -165,6 +195,19 @@ class ARROW_EXPORT Codec {
   static Result<std::unique_ptr<Codec>> Create(Compression::type codec,
                                                int compression_level);
 
+  /// \brief Create a codec that adapts its compression level to the data
+  ///
+  /// The returned codec behaves like Create(codec, codec_options), but
+  /// monitors the achieved compression ratio of one-shot compression: when
+  /// a window of input barely shrinks (e.g. already-compressed or encrypted
+  /// blobs), subsequent buffers are compressed at the codec's fastest level
+  /// to save CPU, and the configured level is periodically retried in case
+  /// the data mix changes.  Streaming compressors pick the level current at
+  /// their creation and keep it for the whole stream.  The compressed output
+  /// is fully standard and readable by any decompressor of the same format.
+  static Result<std::unique_ptr<Codec>> CreateAdaptive(
+      Compression::type codec, const CodecOptions& codec_options = CodecOptions{});
+
   /// \brief Return true if support for indicated codec has been enabled
   static bool IsAvailable(Compression::type codec);
 
@@ -204,6 +247,46 @@ class ARROW_EXPORT Codec {
                                      int64_t output_buffer_len,
                                      uint8_t* output_buffer) = 0;
 
+  /// \brief A single self-contained unit of work for DecompressParallel()
+  struct DecompressFrame {
+    int64_t input_len;
+    const uint8_t* input;
+    int64_t output_len;
+    uint8_t* output;
+  };
+
+  /// \brief Decompress several independent frames concurrently
+  ///
+  /// Each frame must be decompressible on its own with the one-shot
+  /// Decompress() function, and output_len must be the exact decompressed
+  /// length, as with Decompress().  The actual decompressed length of each
+  /// frame is returned, in frame order.
+  ///
+  /// If executor is null, the frames are decompressed serially on the calling
+  /// thread.  Otherwise one task per frame is spawned on the executor; since
+  /// one-shot decompression may be stateful depending on the codec (e.g. gzip),
+  /// each task decompresses using its own codec instance.
+  Result<std::vector<int64_t>> DecompressParallel(
+      const std::vector<DecompressFrame>& frames,
+      ::arrow::internal::Executor* executor);
+
+  /// \brief Return the compressed size of the frame starting at input
+  ///
+  /// This allows splitting a buffer of concatenated frames into individually
+  /// decompressible units, e.g. for DecompressParallel().  Only some codecs
+  /// (ZSTD, LZ4 frame format) can delimit frames without decompressing them;
+  /// others return NotImplemented.
+  virtual Result<int64_t> FindFrameCompressedSize(int64_t input_len,
+                                                  const uint8_t* input);
+
+  /// \brief Locate the frames in a buffer of concatenated frames
+  ///
+  /// Returns the byte offset at which each frame starts.  The input must
+  /// consist entirely of complete frames.  Implemented in terms of
+  /// FindFrameCompressedSize(), with the same codec support.
+  Result<std::vector<int64_t>> FindFrameBoundaries(int64_t input_len,
+                                                   const uint8_t* input);
+
   /// \brief One-shot compression function
   ///
   /// output_buffer_len must first have been computed using MaxCompressedLen().
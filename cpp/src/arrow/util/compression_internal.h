@@ -59,7 +59,8 @@ constexpr int kLz4DefaultCompressionLevel = 1;
 // Lz4 frame format codec.
 
 std::unique_ptr<Codec> MakeLz4FrameCodec(
-    int compression_level = kLz4DefaultCompressionLevel);
+    int compression_level = kLz4DefaultCompressionLevel,
+    std::vector<uint8_t> dictionary = {});
 
 // Lz4 "raw" format codec.
 std::unique_ptr<Codec> MakeLz4RawCodec(
@@ -74,7 +75,8 @@ std::unique_ptr<Codec> MakeLz4HadoopRawCodec();
 constexpr int kZSTDDefaultCompressionLevel = 1;
 
 std::unique_ptr<Codec> MakeZSTDCodec(
-    int compression_level = kZSTDDefaultCompressionLevel);
+    int compression_level = kZSTDDefaultCompressionLevel,
+    std::vector<uint8_t> dictionary = {});
 
 }  // namespace internal
 }  // namespace util
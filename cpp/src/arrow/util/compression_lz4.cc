@@ -20,6 +20,8 @@
 #include <cstdint>
 #include <cstring>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <lz4.h>
 #include <lz4frame.h>
@@ -37,6 +39,11 @@
 #  define LZ4F_HEADER_SIZE_MAX 19
 #endif
 
+// The LZ4F dictionary API (LZ4F_createCDict and friends) became stable in 1.9.0
+#if defined(LZ4_VERSION_NUMBER) && LZ4_VERSION_NUMBER >= 10900
+#  define ARROW_LZ4_HAS_FRAME_DICTIONARY 1
+#endif
+
 namespace arrow {
 namespace util {
 namespace internal {
@@ -61,12 +68,22 @@ static LZ4F_preferences_t PreferencesWithCompressionLevel(int compression_level)
   return prefs;
 }
 
+#ifdef ARROW_LZ4_HAS_FRAME_DICTIONARY
+struct LZ4CDictDeleter {
+  void operator()(LZ4F_CDict* cdict) { LZ4F_freeCDict(cdict); }
+};
+using LZ4CDictPtr = std::shared_ptr<LZ4F_CDict>;
+#else
+using LZ4CDictPtr = std::shared_ptr<void>;
+#endif
+
 // ----------------------------------------------------------------------
 // Lz4 frame decompressor implementation
 
 class LZ4Decompressor : public Decompressor {
  public:
-  LZ4Decompressor() {}
+  explicit LZ4Decompressor(std::shared_ptr<const std::vector<uint8_t>> dictionary = {})
+      : dictionary_(std::move(dictionary)) {}
 
   ~LZ4Decompressor() override {
     if (ctx_ != nullptr) {
@@ -110,8 +127,19 @@ class LZ4Decompressor : public Decompressor {
     size_t ret;
 
     DCHECK_NE(src, nullptr);
+#ifdef ARROW_LZ4_HAS_FRAME_DICTIONARY
+    if (dictionary_ && !dictionary_->empty()) {
+      ret = LZ4F_decompress_usingDict(ctx_, dst, &dst_capacity, src, &src_size,
+                                      dictionary_->data(), dictionary_->size(),
+                                      nullptr /* options */);
+    } else {
+      ret = LZ4F_decompress(ctx_, dst, &dst_capacity, src, &src_size,
+                            nullptr /* options */);
+    }
+#else
     ret =
         LZ4F_decompress(ctx_, dst, &dst_capacity, src, &src_size, nullptr /* options */);
+#endif
     if (LZ4F_isError(ret)) {
       return LZ4Error(ret, "LZ4 decompress failed: ");
     }
@@ -125,6 +153,7 @@ class LZ4Decompressor : public Decompressor {
 
  protected:
   LZ4F_decompressionContext_t ctx_ = nullptr;
+  std::shared_ptr<const std::vector<uint8_t>> dictionary_;
   bool finished_;
 };
 
@@ -133,7 +162,8 @@ class LZ4Decompressor : public Decompressor {
 
 class LZ4Compressor : public Compressor {
  public:
-  explicit LZ4Compressor(int compression_level) : compression_level_(compression_level) {}
+  explicit LZ4Compressor(int compression_level, LZ4CDictPtr cdict = {})
+      : compression_level_(compression_level), cdict_(std::move(cdict)) {}
 
   ~LZ4Compressor() override {
     if (ctx_ != nullptr) {
@@ -160,7 +190,7 @@ class LZ4Compressor : public Compressor {
       /* Output too small to write LZ4F header */               \
       return (output_too_small);                                \
     }                                                           \
-    ret = LZ4F_compressBegin(ctx_, dst, dst_capacity, &prefs_); \
+    ret = CompressBegin(dst, dst_capacity);                     \
     if (LZ4F_isError(ret)) {                                    \
       return LZ4Error(ret, "LZ4 compress begin failed: ");      \
     }                                                           \
@@ -242,9 +272,20 @@ class LZ4Compressor : public Compressor {
 #undef BEGIN_COMPRESS
 
  protected:
+  size_t CompressBegin(uint8_t* dst, size_t dst_capacity) {
+#ifdef ARROW_LZ4_HAS_FRAME_DICTIONARY
+    if (cdict_) {
+      return LZ4F_compressBegin_usingCDict(ctx_, dst, dst_capacity, cdict_.get(),
+                                           &prefs_);
+    }
+#endif
+    return LZ4F_compressBegin(ctx_, dst, dst_capacity, &prefs_);
+  }
+
   int compression_level_;
   LZ4F_compressionContext_t ctx_ = nullptr;
   LZ4F_preferences_t prefs_;
+  LZ4CDictPtr cdict_;
   bool first_time_;
 };
 
@@ -253,11 +294,30 @@ class LZ4Compressor : public Compressor {
 
 class Lz4FrameCodec : public Codec {
  public:
-  explicit Lz4FrameCodec(int compression_level)
+  explicit Lz4FrameCodec(int compression_level, std::vector<uint8_t> dictionary = {})
       : compression_level_(compression_level == kUseDefaultCompressionLevel
                                ? kLz4DefaultCompressionLevel
                                : compression_level),
-        prefs_(PreferencesWithCompressionLevel(compression_level_)) {}
+        prefs_(PreferencesWithCompressionLevel(compression_level_)),
+        dictionary_(std::make_shared<const std::vector<uint8_t>>(
+            std::move(dictionary))) {}
+
+  Status Init() override {
+    if (dictionary_->empty()) {
+      return Status::OK();
+    }
+#ifdef ARROW_LZ4_HAS_FRAME_DICTIONARY
+    cdict_ = LZ4CDictPtr(LZ4F_createCDict(dictionary_->data(), dictionary_->size()),
+                         LZ4CDictDeleter{});
+    if (cdict_ == nullptr) {
+      return Status::IOError("LZ4 dictionary digestion failed");
+    }
+    return Status::OK();
+#else
+    return Status::NotImplemented(
+        "LZ4 frame dictionaries require a LZ4 build >= 1.9.0");
+#endif
+  }
 
   int64_t MaxCompressedLen(int64_t input_len,
                            const uint8_t* ARROW_ARG_UNUSED(input)) override {
@@ -267,15 +327,95 @@ class Lz4FrameCodec : public Codec {
 
   Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer) override {
-    auto output_len =
+    size_t output_len;
+#ifdef ARROW_LZ4_HAS_FRAME_DICTIONARY
+    if (cdict_) {
+      LZ4F_compressionContext_t ctx = nullptr;
+      auto ret = LZ4F_createCompressionContext(&ctx, LZ4F_VERSION);
+      if (LZ4F_isError(ret)) {
+        return LZ4Error(ret, "LZ4 init failed: ");
+      }
+      output_len = LZ4F_compressFrame_usingCDict(
+          ctx, output_buffer, static_cast<size_t>(output_buffer_len), input,
+          static_cast<size_t>(input_len), cdict_.get(), &prefs_);
+      ARROW_UNUSED(LZ4F_freeCompressionContext(ctx));
+    } else {
+      output_len =
+          LZ4F_compressFrame(output_buffer, static_cast<size_t>(output_buffer_len),
+                             input, static_cast<size_t>(input_len), &prefs_);
+    }
+#else
+    output_len =
         LZ4F_compressFrame(output_buffer, static_cast<size_t>(output_buffer_len), input,
                            static_cast<size_t>(input_len), &prefs_);
+#endif
     if (LZ4F_isError(output_len)) {
       return LZ4Error(output_len, "Lz4 compression failure: ");
     }
     return static_cast<int64_t>(output_len);
   }
 
+  Result<int64_t> FindFrameCompressedSize(int64_t input_len,
+                                          const uint8_t* input) override {
+    // Walk the frame structure without decompressing: magic number, frame
+    // descriptor, then data blocks (each prefixed with its size) up to the
+    // end mark.  See the LZ4 frame format description.
+    constexpr uint32_t kLz4FrameMagic = 0x184D2204;
+    constexpr uint32_t kLz4SkippableFrameMagicMasked = 0x184D2A50;
+
+    auto truncated = []() {
+      return Status::IOError("Lz4 compressed input contains a truncated frame");
+    };
+
+    if (input_len < 4) {
+      return truncated();
+    }
+    const uint32_t magic = bit_util::FromLittleEndian(SafeLoadAs<uint32_t>(input));
+    if ((magic & 0xFFFFFFF0) == kLz4SkippableFrameMagicMasked) {
+      if (input_len < 8) {
+        return truncated();
+      }
+      const uint32_t skippable_len =
+          bit_util::FromLittleEndian(SafeLoadAs<uint32_t>(input + 4));
+      return 8 + static_cast<int64_t>(skippable_len);
+    }
+    if (magic != kLz4FrameMagic) {
+      return Status::IOError("Lz4 compressed input does not start with a frame");
+    }
+    if (input_len < 7) {
+      return truncated();
+    }
+    const uint8_t flg = input[4];
+    const bool content_checksum = (flg >> 2) & 1;
+    const bool content_size = (flg >> 3) & 1;
+    const bool block_checksum = (flg >> 4) & 1;
+    const bool dict_id = flg & 1;
+    // Magic + FLG + BD + optional fields + header checksum byte
+    int64_t pos = 4 + 2 + (content_size ? 8 : 0) + (dict_id ? 4 : 0) + 1;
+    while (true) {
+      if (input_len - pos < 4) {
+        return truncated();
+      }
+      const uint32_t block_header =
+          bit_util::FromLittleEndian(SafeLoadAs<uint32_t>(input + pos));
+      pos += 4;
+      const int64_t block_len = block_header & 0x7FFFFFFF;
+      if (block_len == 0) {
+        // End mark
+        break;
+      }
+      pos += block_len + (block_checksum ? 4 : 0);
+      if (pos > input_len) {
+        return truncated();
+      }
+    }
+    pos += content_checksum ? 4 : 0;
+    if (pos > input_len) {
+      return truncated();
+    }
+    return pos;
+  }
+
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override {
     ARROW_ASSIGN_OR_RAISE(auto decomp, MakeDecompressor());
@@ -304,13 +444,14 @@ class Lz4FrameCodec : public Codec {
   }
 
   Result<std::shared_ptr<Compressor>> MakeCompressor() override {
-    auto ptr = std::make_shared<LZ4Compressor>(compression_level_);
+    auto ptr = std::make_shared<LZ4Compressor>(compression_level_, cdict_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
 
   Result<std::shared_ptr<Decompressor>> MakeDecompressor() override {
-    auto ptr = std::make_shared<LZ4Decompressor>();
+    auto ptr = std::make_shared<LZ4Decompressor>(
+        dictionary_->empty() ? nullptr : dictionary_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -329,6 +470,9 @@ class Lz4FrameCodec : public Codec {
  protected:
   const int compression_level_;
   const LZ4F_preferences_t prefs_;
+  // Shared with the compressors and decompressors, which may outlive the codec
+  const std::shared_ptr<const std::vector<uint8_t>> dictionary_;
+  LZ4CDictPtr cdict_;
 };
 
 // ----------------------------------------------------------------------
@@ -529,8 +673,9 @@ class Lz4HadoopCodec : public Lz4Codec {
 
 }  // namespace
 
-std::unique_ptr<Codec> MakeLz4FrameCodec(int compression_level) {
-  return std::make_unique<Lz4FrameCodec>(compression_level);
+std::unique_ptr<Codec> MakeLz4FrameCodec(int compression_level,
+                                         std::vector<uint8_t> dictionary) {
+  return std::make_unique<Lz4FrameCodec>(compression_level, std::move(dictionary));
 }
 
 std::unique_ptr<Codec> MakeLz4HadoopRawCodec() {
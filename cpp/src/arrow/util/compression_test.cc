@@ -31,6 +31,7 @@
 #include "arrow/testing/util.h"
 #include "arrow/util/compression.h"
 #include "arrow/util/config.h"
+#include "arrow/util/thread_pool.h"
 
 namespace arrow {
 namespace util {
@@ -413,6 +414,92 @@ TEST(CodecTest, CodecRoundtripGzipMembers) {
   }
 }
 
+TEST_P(CodecTest, DecompressParallel) {
+  const auto compression = GetCompression();
+  if (compression == Compression::BZ2) {
+    GTEST_SKIP() << "BZ2 does not support one-shot compression";
+  }
+
+  auto codec = MakeCodec();
+
+  const int chunk_sizes[] = {0, 100, 10000, 100000};
+  std::vector<std::vector<uint8_t>> chunks;
+  std::vector<std::vector<uint8_t>> compressed_chunks;
+  for (int size : chunk_sizes) {
+    chunks.push_back(MakeCompressibleData(size));
+    const auto& chunk = chunks.back();
+    std::vector<uint8_t> compressed(codec->MaxCompressedLen(chunk.size(), chunk.data()));
+    ASSERT_OK_AND_ASSIGN(int64_t compressed_len,
+                         codec->Compress(chunk.size(), chunk.data(), compressed.size(),
+                                         compressed.data()));
+    compressed.resize(compressed_len);
+    compressed_chunks.push_back(std::move(compressed));
+  }
+
+  for (::arrow::internal::Executor* executor :
+       {static_cast<::arrow::internal::Executor*>(nullptr),
+        static_cast<::arrow::internal::Executor*>(
+            ::arrow::internal::GetCpuThreadPool())}) {
+    std::vector<std::vector<uint8_t>> decompressed(chunks.size());
+    std::vector<Codec::DecompressFrame> frames;
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      decompressed[i].resize(chunks[i].size());
+      frames.push_back({static_cast<int64_t>(compressed_chunks[i].size()),
+                        compressed_chunks[i].data(),
+                        static_cast<int64_t>(decompressed[i].size()),
+                        decompressed[i].data()});
+    }
+    ASSERT_OK_AND_ASSIGN(auto actual_lengths,
+                         codec->DecompressParallel(frames, executor));
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      ASSERT_EQ(actual_lengths[i], static_cast<int64_t>(chunks[i].size()));
+      ASSERT_EQ(chunks[i], decompressed[i]);
+    }
+  }
+}
+
+TEST_P(CodecTest, FindFrameBoundaries) {
+  const auto compression = GetCompression();
+  if (compression == Compression::BZ2) {
+    GTEST_SKIP() << "BZ2 does not support one-shot compression";
+  }
+
+  auto codec = MakeCodec();
+
+  const int chunk_sizes[] = {100, 10000, 100000};
+  std::vector<uint8_t> concatenated;
+  std::vector<int64_t> expected_offsets;
+  for (int size : chunk_sizes) {
+    auto chunk = MakeCompressibleData(size);
+    std::vector<uint8_t> compressed(codec->MaxCompressedLen(size, chunk.data()));
+    ASSERT_OK_AND_ASSIGN(
+        int64_t compressed_len,
+        codec->Compress(size, chunk.data(), compressed.size(), compressed.data()));
+    expected_offsets.push_back(static_cast<int64_t>(concatenated.size()));
+    concatenated.insert(concatenated.end(), compressed.data(),
+                        compressed.data() + compressed_len);
+  }
+
+  if (compression != Compression::ZSTD && compression != Compression::LZ4_FRAME) {
+    ASSERT_RAISES(NotImplemented, codec->FindFrameCompressedSize(concatenated.size(),
+                                                                 concatenated.data()));
+    return;
+  }
+
+  ASSERT_OK_AND_ASSIGN(
+      int64_t first_frame_len,
+      codec->FindFrameCompressedSize(concatenated.size(), concatenated.data()));
+  ASSERT_EQ(first_frame_len, expected_offsets[1]);
+
+  ASSERT_OK_AND_ASSIGN(auto offsets, codec->FindFrameBoundaries(concatenated.size(),
+                                                                concatenated.data()));
+  ASSERT_EQ(offsets, expected_offsets);
+
+  // A truncated trailing frame is detected
+  ASSERT_RAISES(IOError, codec->FindFrameBoundaries(concatenated.size() - 1,
+                                                    concatenated.data()));
+}
+
 TEST(TestCodecMisc, SpecifyCompressionLevel) {
   struct CombinationOption {
     Compression::type codec;
@@ -517,6 +604,69 @@ TEST(TestCodecMisc, SpecifyCodecOptionsBrotli) {
   }
 }
 
+TEST(TestCodecMisc, SpecifyCodecOptionsPresetDictionary) {
+  // Streams compressed with a preset dictionary must decompress with the
+  // same dictionary, on ZSTD and the LZ4 frame format
+  std::vector<uint8_t> data = MakeCompressibleData(10000);
+  std::vector<uint8_t> dictionary(data.begin(), data.begin() + 2000);
+
+  for (const auto compression : {Compression::ZSTD, Compression::LZ4_FRAME}) {
+    if (!Codec::IsAvailable(compression)) {
+      continue;
+    }
+    std::unique_ptr<Codec> c1, c2;
+    if (compression == Compression::ZSTD) {
+      auto codec_options = arrow::util::ZstdCodecOptions();
+      codec_options.dictionary = dictionary;
+      ASSERT_OK_AND_ASSIGN(c1, Codec::Create(compression, codec_options));
+      ASSERT_OK_AND_ASSIGN(c2, Codec::Create(compression, codec_options));
+    } else {
+      auto codec_options = arrow::util::Lz4CodecOptions();
+      codec_options.dictionary = dictionary;
+      auto maybe_c1 = Codec::Create(compression, codec_options);
+      if (maybe_c1.status().IsNotImplemented()) {
+        // LZ4 build too old for frame dictionaries
+        continue;
+      }
+      ASSERT_OK_AND_ASSIGN(c1, std::move(maybe_c1));
+      ASSERT_OK_AND_ASSIGN(c2, Codec::Create(compression, codec_options));
+    }
+    CheckCodecRoundtrip(c1, c2, data);
+    CheckStreamingRoundtrip(c1.get(), data);
+  }
+}
+
+TEST(TestCodecMisc, CreateAdaptive) {
+  for (const auto compression :
+       {Compression::ZSTD, Compression::GZIP, Compression::LZ4_FRAME}) {
+    if (!Codec::IsAvailable(compression)) {
+      continue;
+    }
+    ASSERT_OK_AND_ASSIGN(auto max_level, Codec::MaximumCompressionLevel(compression));
+    ASSERT_OK_AND_ASSIGN(auto codec,
+                         Codec::CreateAdaptive(compression, CodecOptions{max_level}));
+    ASSERT_EQ(codec->compression_type(), compression);
+    ASSERT_EQ(codec->compression_level(), max_level);
+    ASSERT_OK_AND_ASSIGN(auto plain, Codec::Create(compression));
+    // Feed incompressible data well past the adaptation window; every buffer
+    // must stay readable by a stock decompressor of the same format
+    std::vector<uint8_t> data = MakeRandomData(500000);
+    std::vector<uint8_t> compressed(codec->MaxCompressedLen(data.size(), data.data()));
+    std::vector<uint8_t> decompressed(data.size());
+    for (int i = 0; i < 8; ++i) {
+      ASSERT_OK_AND_ASSIGN(auto compressed_size,
+                           codec->Compress(data.size(), data.data(), compressed.size(),
+                                           compressed.data()));
+      ASSERT_OK_AND_ASSIGN(
+          auto decompressed_size,
+          plain->Decompress(compressed_size, compressed.data(), decompressed.size(),
+                            decompressed.data()));
+      ASSERT_EQ(static_cast<size_t>(decompressed_size), data.size());
+      ASSERT_EQ(decompressed, data);
+    }
+  }
+}
+
 TEST_P(CodecTest, MinMaxCompressionLevel) {
   auto type = GetCompression();
   ASSERT_OK_AND_ASSIGN(auto codec, Codec::Create(type));
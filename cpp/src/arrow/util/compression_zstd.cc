@@ -20,6 +20,8 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <zstd.h>
 
@@ -45,7 +47,8 @@ Status ZSTDError(size_t ret, const char* prefix_msg) {
 
 class ZSTDDecompressor : public Decompressor {
  public:
-  ZSTDDecompressor() : stream_(ZSTD_createDStream()) {}
+  explicit ZSTDDecompressor(std::shared_ptr<const std::vector<uint8_t>> dictionary = {})
+      : stream_(ZSTD_createDStream()), dictionary_(std::move(dictionary)) {}
 
   ~ZSTDDecompressor() override { ZSTD_freeDStream(stream_); }
 
@@ -54,9 +57,15 @@ class ZSTDDecompressor : public Decompressor {
     size_t ret = ZSTD_initDStream(stream_);
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
-    } else {
-      return Status::OK();
     }
+    if (dictionary_ && !dictionary_->empty()) {
+      // A ZSTD_DStream is a ZSTD_DCtx, so the advanced API applies
+      ret = ZSTD_DCtx_loadDictionary(stream_, dictionary_->data(), dictionary_->size());
+      if (ZSTD_isError(ret)) {
+        return ZSTDError(ret, "ZSTD dictionary load failed: ");
+      }
+    }
+    return Status::OK();
   }
 
   Result<DecompressResult> Decompress(int64_t input_len, const uint8_t* input,
@@ -88,6 +97,7 @@ class ZSTDDecompressor : public Decompressor {
 
  protected:
   ZSTD_DStream* stream_;
+  std::shared_ptr<const std::vector<uint8_t>> dictionary_;
   bool finished_;
 };
 
@@ -96,8 +106,11 @@ class ZSTDDecompressor : public Decompressor {
 
 class ZSTDCompressor : public Compressor {
  public:
-  explicit ZSTDCompressor(int compression_level)
-      : stream_(ZSTD_createCStream()), compression_level_(compression_level) {}
+  explicit ZSTDCompressor(int compression_level,
+                          std::shared_ptr<const std::vector<uint8_t>> dictionary = {})
+      : stream_(ZSTD_createCStream()),
+        compression_level_(compression_level),
+        dictionary_(std::move(dictionary)) {}
 
   ~ZSTDCompressor() override { ZSTD_freeCStream(stream_); }
 
@@ -105,9 +118,15 @@ class ZSTDCompressor : public Compressor {
     size_t ret = ZSTD_initCStream(stream_, compression_level_);
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD init failed: ");
-    } else {
-      return Status::OK();
     }
+    if (dictionary_ && !dictionary_->empty()) {
+      // A ZSTD_CStream is a ZSTD_CCtx, so the advanced API applies
+      ret = ZSTD_CCtx_loadDictionary(stream_, dictionary_->data(), dictionary_->size());
+      if (ZSTD_isError(ret)) {
+        return ZSTDError(ret, "ZSTD dictionary load failed: ");
+      }
+    }
+    return Status::OK();
   }
 
   Result<CompressResult> Compress(int64_t input_len, const uint8_t* input,
@@ -166,6 +185,7 @@ class ZSTDCompressor : public Compressor {
 
  private:
   int compression_level_;
+  std::shared_ptr<const std::vector<uint8_t>> dictionary_;
 };
 
 // ----------------------------------------------------------------------
@@ -173,10 +193,12 @@ class ZSTDCompressor : public Compressor {
 
 class ZSTDCodec : public Codec {
  public:
-  explicit ZSTDCodec(int compression_level)
+  explicit ZSTDCodec(int compression_level, std::vector<uint8_t> dictionary)
       : compression_level_(compression_level == kUseDefaultCompressionLevel
                                ? kZSTDDefaultCompressionLevel
-                               : compression_level) {}
+                               : compression_level),
+        dictionary_(std::make_shared<const std::vector<uint8_t>>(
+            std::move(dictionary))) {}
 
   Result<int64_t> Decompress(int64_t input_len, const uint8_t* input,
                              int64_t output_buffer_len, uint8_t* output_buffer) override {
@@ -188,8 +210,18 @@ class ZSTDCodec : public Codec {
       output_buffer = &empty_buffer;
     }
 
-    size_t ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len),
-                                 input, static_cast<size_t>(input_len));
+    size_t ret;
+    if (!dictionary_->empty()) {
+      ZSTD_DCtx* ctx = ZSTD_createDCtx();
+      ret = ZSTD_decompress_usingDict(ctx, output_buffer,
+                                      static_cast<size_t>(output_buffer_len), input,
+                                      static_cast<size_t>(input_len),
+                                      dictionary_->data(), dictionary_->size());
+      ZSTD_freeDCtx(ctx);
+    } else {
+      ret = ZSTD_decompress(output_buffer, static_cast<size_t>(output_buffer_len), input,
+                            static_cast<size_t>(input_len));
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD decompression failed: ");
     }
@@ -199,6 +231,15 @@ class ZSTDCodec : public Codec {
     return static_cast<int64_t>(ret);
   }
 
+  Result<int64_t> FindFrameCompressedSize(int64_t input_len,
+                                          const uint8_t* input) override {
+    size_t ret = ZSTD_findFrameCompressedSize(input, static_cast<size_t>(input_len));
+    if (ZSTD_isError(ret)) {
+      return ZSTDError(ret, "ZSTD frame size detection failed: ");
+    }
+    return static_cast<int64_t>(ret);
+  }
+
   int64_t MaxCompressedLen(int64_t input_len,
                            const uint8_t* ARROW_ARG_UNUSED(input)) override {
     DCHECK_GE(input_len, 0);
@@ -207,8 +248,18 @@ class ZSTDCodec : public Codec {
 
   Result<int64_t> Compress(int64_t input_len, const uint8_t* input,
                            int64_t output_buffer_len, uint8_t* output_buffer) override {
-    size_t ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len),
-                               input, static_cast<size_t>(input_len), compression_level_);
+    size_t ret;
+    if (!dictionary_->empty()) {
+      ZSTD_CCtx* ctx = ZSTD_createCCtx();
+      ret = ZSTD_compress_usingDict(ctx, output_buffer,
+                                    static_cast<size_t>(output_buffer_len), input,
+                                    static_cast<size_t>(input_len), dictionary_->data(),
+                                    dictionary_->size(), compression_level_);
+      ZSTD_freeCCtx(ctx);
+    } else {
+      ret = ZSTD_compress(output_buffer, static_cast<size_t>(output_buffer_len), input,
+                          static_cast<size_t>(input_len), compression_level_);
+    }
     if (ZSTD_isError(ret)) {
       return ZSTDError(ret, "ZSTD compression failed: ");
     }
@@ -216,13 +267,13 @@ class ZSTDCodec : public Codec {
   }
 
   Result<std::shared_ptr<Compressor>> MakeCompressor() override {
-    auto ptr = std::make_shared<ZSTDCompressor>(compression_level_);
+    auto ptr = std::make_shared<ZSTDCompressor>(compression_level_, dictionary_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
 
   Result<std::shared_ptr<Decompressor>> MakeDecompressor() override {
-    auto ptr = std::make_shared<ZSTDDecompressor>();
+    auto ptr = std::make_shared<ZSTDDecompressor>(dictionary_);
     RETURN_NOT_OK(ptr->Init());
     return ptr;
   }
@@ -236,12 +287,15 @@ class ZSTDCodec : public Codec {
 
  private:
   const int compression_level_;
+  // Shared with the compressors and decompressors, which may outlive the codec
+  const std::shared_ptr<const std::vector<uint8_t>> dictionary_;
 };
 
 }  // namespace
 
-std::unique_ptr<Codec> MakeZSTDCodec(int compression_level) {
-  return std::make_unique<ZSTDCodec>(compression_level);
+std::unique_ptr<Codec> MakeZSTDCodec(int compression_level,
+                                     std::vector<uint8_t> dictionary) {
+  return std::make_unique<ZSTDCodec>(compression_level, std::move(dictionary));
 }
 
 }  // namespace internal
@@ -0,0 +1,266 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// C++20 coroutine integration for Future and AsyncGenerator.
+//
+// When this header is compiled with coroutine support, a function returning
+// `Future<T>` may be written as a coroutine: `co_await` on a `Future<U>`
+// suspends until the future completes and produces the unwrapped value, and
+// `co_return` finishes the returned future.  A failed awaited future aborts
+// the coroutine and forwards the error to the returned future, mirroring the
+// short-circuiting of a callback chain written with Then(), so the coroutine
+// body only ever sees successful values.
+//
+// Similarly, `CoGenerator<T>` is the return type of a coroutine producing a
+// sequence of values with `co_yield`; it is copyable and callable with the
+// AsyncGenerator calling convention and converts implicitly to
+// `AsyncGenerator<T>`.
+//
+// Compared with equivalent callback chains, coroutines compile to a single
+// heap-allocated state machine instead of one type-erased continuation
+// allocation per step.
+//
+// This header degrades to a no-op under pre-C++20 toolchains; code using it
+// should test for the ARROW_HAVE_COROUTINES macro.
+
+#pragma once
+
+#if defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
+
+#  define ARROW_HAVE_COROUTINES 1
+
+#  include <coroutine>
+#  include <exception>
+#  include <memory>
+#  include <type_traits>
+#  include <utility>
+
+#  include "arrow/result.h"
+#  include "arrow/status.h"
+#  include "arrow/util/async_generator.h"
+#  include "arrow/util/future.h"
+
+namespace arrow {
+namespace internal {
+
+/// Awaiter produced for `co_await future` inside an Arrow coroutine.
+///
+/// On success the awaited value is returned from the co_await expression.  On
+/// failure the error status is handed to the enclosing coroutine's promise
+/// (see Abort() on the promise types below) and the coroutine body is never
+/// resumed.
+template <typename T>
+class FutureAwaiter {
+ public:
+  explicit FutureAwaiter(Future<T> future) : future_(std::move(future)) {}
+
+  bool await_ready() const noexcept {
+    return future_.is_finished() && future_.status().ok();
+  }
+
+  template <typename Promise>
+  void await_suspend(std::coroutine_handle<Promise> handle) {
+    future_.AddCallback([handle](const Result<T>& result) mutable {
+      if (result.ok()) {
+        handle.resume();
+      } else {
+        handle.promise().Abort(result.status(), handle);
+      }
+    });
+  }
+
+  auto await_resume() {
+    if constexpr (!std::is_same_v<T, internal::Empty>) {
+      // Errors were short-circuited in await_suspend, the result is a value
+      return future_.MoveResult().MoveValueUnsafe();
+    }
+  }
+
+ private:
+  Future<T> future_;
+};
+
+template <typename T>
+class FuturePromiseBase {
+ public:
+  Future<T> get_return_object() { return future_; }
+
+  std::suspend_never initial_suspend() const noexcept { return {}; }
+  std::suspend_never final_suspend() const noexcept { return {}; }
+
+  void unhandled_exception() {
+    try {
+      throw;
+    } catch (const std::exception& e) {
+      future_.MarkFinished(
+          Result<T>(Status::UnknownError("Unhandled exception in coroutine: ", e.what())));
+    } catch (...) {
+      future_.MarkFinished(Result<T>(Status::UnknownError("Unhandled exception in coroutine")));
+    }
+  }
+
+  template <typename U>
+  FutureAwaiter<U> await_transform(Future<U> future) {
+    return FutureAwaiter<U>(std::move(future));
+  }
+
+  // Called by FutureAwaiter when an awaited future fails: finish the
+  // coroutine's future with the error without resuming the body.
+  void Abort(Status status, std::coroutine_handle<> handle) {
+    // The future's shared state must outlive the frame this promise lives in
+    Future<T> future = future_;
+    handle.destroy();
+    future.MarkFinished(Result<T>(std::move(status)));
+  }
+
+ protected:
+  Future<T> future_ = Future<T>::Make();
+};
+
+template <typename T>
+class FuturePromise : public FuturePromiseBase<T> {
+ public:
+  void return_value(Result<T> result) { this->future_.MarkFinished(std::move(result)); }
+};
+
+template <>
+class FuturePromise<internal::Empty> : public FuturePromiseBase<internal::Empty> {
+ public:
+  // A Future<> coroutine must finish with an explicit `co_return status`
+  void return_value(Status status) { this->future_.MarkFinished(std::move(status)); }
+};
+
+}  // namespace internal
+
+/// \brief An AsyncGenerator written as a C++20 coroutine
+///
+/// CoGenerator is the return type of a coroutine that produces a sequence of
+/// values with `co_yield` and may `co_await` futures in between.  It follows
+/// the AsyncGenerator calling convention: each call pulls the next item, the
+/// generator must not be pulled again before the returned future completes,
+/// and the end of the sequence is signalled with IterationTraits<T>::End().
+/// An error from an awaited future (or `co_yield`-ing after one) fails the
+/// pending pull and exhausts the generator.
+///
+/// The object is cheaply copyable (copies share the coroutine frame) so that
+/// it can be stored in an AsyncGenerator<T>, to which it converts implicitly.
+template <typename T>
+class CoGenerator {
+ public:
+  class promise_type;
+
+ private:
+  using Handle = std::coroutine_handle<promise_type>;
+
+  struct Frame {
+    explicit Frame(Handle handle) : handle(handle) {}
+    ~Frame() {
+      if (handle) {
+        handle.destroy();
+      }
+    }
+    Handle handle;
+  };
+
+ public:
+  class promise_type {
+   public:
+    CoGenerator get_return_object() {
+      return CoGenerator(std::make_shared<Frame>(Handle::from_promise(*this)));
+    }
+
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    auto final_suspend() const noexcept { return FinalAwaiter{}; }
+
+    std::suspend_always yield_value(T value) {
+      current_.MarkFinished(std::move(value));
+      return {};
+    }
+
+    void return_void() {}
+
+    void unhandled_exception() {
+      try {
+        throw;
+      } catch (const std::exception& e) {
+        Abort(Status::UnknownError("Unhandled exception in coroutine: ", e.what()), {});
+      } catch (...) {
+        Abort(Status::UnknownError("Unhandled exception in coroutine"), {});
+      }
+    }
+
+    template <typename U>
+    internal::FutureAwaiter<U> await_transform(Future<U> future) {
+      return internal::FutureAwaiter<U>(std::move(future));
+    }
+
+    // Called by FutureAwaiter when an awaited future fails: fail the pending
+    // pull and exhaust the generator.  The suspended frame is destroyed later
+    // along with the generator object.
+    void Abort(Status status, std::coroutine_handle<>) {
+      exhausted_ = true;
+      current_.MarkFinished(Result<T>(std::move(status)));
+    }
+
+   private:
+    friend class CoGenerator;
+
+    struct FinalAwaiter {
+      bool await_ready() const noexcept { return false; }
+      void await_suspend(Handle handle) const noexcept {
+        // Signal end-of-stream to the pull that ran into co_return
+        promise_type& promise = handle.promise();
+        promise.exhausted_ = true;
+        if (promise.current_.is_valid() && !promise.current_.is_finished()) {
+          promise.current_.MarkFinished(IterationTraits<T>::End());
+        }
+      }
+      void await_resume() const noexcept {}
+    };
+
+    Future<T> current_;
+    bool exhausted_ = false;
+  };
+
+  /// Pull the next item from the generator
+  Future<T> operator()() {
+    promise_type& promise = frame_->handle.promise();
+    if (promise.exhausted_) {
+      return AsyncGeneratorEnd<T>();
+    }
+    promise.current_ = Future<T>::Make();
+    // Keep a handle to the pull before resuming: the coroutine may finish
+    // (and replace or complete current_) before resume() returns
+    Future<T> result = promise.current_;
+    frame_->handle.resume();
+    return result;
+  }
+
+ private:
+  explicit CoGenerator(std::shared_ptr<Frame> frame) : frame_(std::move(frame)) {}
+
+  std::shared_ptr<Frame> frame_;
+};
+
+}  // namespace arrow
+
+template <typename T, typename... Args>
+struct std::coroutine_traits<arrow::Future<T>, Args...> {
+  using promise_type = arrow::internal::FuturePromise<T>;
+};
+
+#endif  // defined(__cpp_impl_coroutine) && __has_include(<coroutine>)
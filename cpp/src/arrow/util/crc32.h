@@ -32,5 +32,16 @@ namespace internal {
 ARROW_EXPORT
 uint32_t crc32(uint32_t prev, const void* data, size_t length);
 
+/// \brief Compute the CRC32C (Castagnoli) checksum of the given data
+///
+/// This function computes CRC32C with the polynomial 0x1EDC6F41, as used
+/// in iSCSI, ext4 and others (note this is different from zlib's CRC32).
+/// On x86 with SSE4.2 and on ARMv8 with the CRC extension, the dedicated
+/// CRC32C instructions are used, with three interleaved streams to hide
+/// their latency.  To compute a running CRC32C, pass the previous value
+/// in `prev`, otherwise `prev` should be 0.
+ARROW_EXPORT
+uint32_t crc32c(uint32_t prev, const void* data, size_t length);
+
 }  // namespace internal
 }  // namespace arrow
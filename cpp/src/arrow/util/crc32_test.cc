@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
 #include <limits>
@@ -107,4 +108,57 @@ TEST(Crc32Test, matchesBoost32Type) {
   }
 }
 
+TEST(Crc32cTest, Basic) {
+  // use the string "123456789" in ASCII as test data (RFC 3720 B.4 test vector).
+  constexpr uint32_t TEST_CRC32C_RESULT = 0xE3069283;
+  constexpr size_t TEST_CRC32C_LENGTH = 9;
+  std::array<unsigned char, TEST_CRC32C_LENGTH> std_data = {0x31, 0x32, 0x33, 0x34, 0x35,
+                                                            0x36, 0x37, 0x38, 0x39};
+  size_t const std_data_len = sizeof(std_data) / sizeof(std_data[0]);
+  EXPECT_EQ(TEST_CRC32C_RESULT, internal::crc32c(0, &std_data[0], std_data_len));
+
+  for (size_t i = 1; i < std_data_len - 1; ++i) {
+    uint32_t crc1 = internal::crc32c(0, &std_data[0], i);
+    EXPECT_EQ(TEST_CRC32C_RESULT,
+              internal::crc32c(crc1, &std_data[i], std_data_len - i));
+  }
+}
+
+TEST(Crc32cTest, KnownVectors) {
+  // iSCSI test vectors from RFC 3720 B.4
+  std::vector<uint8_t> zeros(32, 0x00);
+  EXPECT_EQ(0x8A9136AAU, internal::crc32c(0, zeros.data(), zeros.size()));
+  std::vector<uint8_t> ones(32, 0xFF);
+  EXPECT_EQ(0x62A8AB43U, internal::crc32c(0, ones.data(), ones.size()));
+  std::vector<uint8_t> incrementing(32);
+  for (size_t i = 0; i < incrementing.size(); ++i) {
+    incrementing[i] = static_cast<uint8_t>(i);
+  }
+  EXPECT_EQ(0x46DD794EU, internal::crc32c(0, incrementing.data(), incrementing.size()));
+}
+
+TEST(Crc32cTest, IncrementalMatchesOneShot) {
+  // Exercise the interleaved bulk path (> 3 lanes) and check that chunked
+  // computation combines to the same checksum regardless of split points
+  const size_t BUFFER_SIZE = 64 * 1024;
+  std::vector<uint8_t> buffer(BUFFER_SIZE);
+  std::mt19937 gen(/*seed=*/42);
+  std::uniform_int_distribution<uint32_t> dist;
+  for (size_t i = 0; i < BUFFER_SIZE; ++i) {
+    buffer[i] = static_cast<uint8_t>(dist(gen));
+  }
+
+  const uint32_t expected = internal::crc32c(0, buffer.data(), BUFFER_SIZE);
+  for (size_t split : {size_t(1), size_t(7), size_t(4096), size_t(12289), size_t(30000)}) {
+    uint32_t crc = 0;
+    size_t offset = 0;
+    while (offset < BUFFER_SIZE) {
+      const size_t chunk = std::min(split, BUFFER_SIZE - offset);
+      crc = internal::crc32c(crc, &buffer[offset], chunk);
+      offset += chunk;
+    }
+    EXPECT_EQ(expected, crc) << "split = " << split;
+  }
+}
+
 }  // namespace arrow
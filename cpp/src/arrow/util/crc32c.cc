@@ -0,0 +1,233 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/crc32.h"
+
+#include <cstring>
+#include <utility>
+
+#include "arrow/util/cpu_info.h"
+#include "arrow/util/endian.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/ubsan.h"
+
+#if defined(__GNUC__) && defined(__x86_64__)
+#  define ARROW_CRC32C_SSE42_DISPATCH 1
+#  include <nmmintrin.h>
+#endif
+#if defined(__ARM_FEATURE_CRC32)
+#  define ARROW_CRC32C_ARMV8 1
+#  include <arm_acle.h>
+#endif
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+// Reflected CRC32C (Castagnoli) polynomial
+constexpr uint32_t kCrc32cPoly = 0x82F63B78;
+
+// Lane length for the interleaved hardware kernels.  Three lanes of this many
+// bytes are processed in parallel, then combined with the shift operator below.
+constexpr size_t kCrcLaneBytes = 4096;
+
+// ----------------------------------------------------------------------
+// GF(2) matrix utilities, used to build the operator that advances a CRC
+// over a fixed number of zero bytes (Adler-style combining of lanes that
+// were computed independently).
+
+uint32_t Gf2MatrixTimes(const uint32_t* matrix, uint32_t vector) {
+  uint32_t sum = 0;
+  while (vector != 0) {
+    if (vector & 1) {
+      sum ^= *matrix;
+    }
+    vector >>= 1;
+    ++matrix;
+  }
+  return sum;
+}
+
+void Gf2MatrixSquare(uint32_t* square, const uint32_t* matrix) {
+  for (int i = 0; i < 32; ++i) {
+    square[i] = Gf2MatrixTimes(matrix, matrix[i]);
+  }
+}
+
+// Per-byte lookup tables applying the "advance over kCrcLaneBytes zero
+// bytes" operator to a 32-bit CRC in four table probes
+struct Crc32cShiftTable {
+  uint32_t table[4][256];
+
+  Crc32cShiftTable() {
+    // Operator for one zero bit
+    uint32_t odd[32];
+    uint32_t even[32];
+    odd[0] = kCrc32cPoly;
+    for (int i = 1; i < 32; ++i) {
+      odd[i] = uint32_t{1} << (i - 1);
+    }
+    // Square until the operator advances over 8 * kCrcLaneBytes zero bits
+    uint32_t* current = odd;
+    uint32_t* next = even;
+    for (size_t bits = 1; bits < 8 * kCrcLaneBytes; bits <<= 1) {
+      Gf2MatrixSquare(next, current);
+      std::swap(current, next);
+    }
+    for (int k = 0; k < 4; ++k) {
+      for (uint32_t b = 0; b < 256; ++b) {
+        table[k][b] = Gf2MatrixTimes(current, b << (8 * k));
+      }
+    }
+  }
+
+  uint32_t Shift(uint32_t crc) const {
+    return table[0][crc & 0xFF] ^ table[1][(crc >> 8) & 0xFF] ^
+           table[2][(crc >> 16) & 0xFF] ^ table[3][crc >> 24];
+  }
+};
+
+// ----------------------------------------------------------------------
+// Software fallback: slicing-by-8 with runtime-generated tables
+
+struct Crc32cSoftwareTable {
+  uint32_t table[8][256];
+
+  Crc32cSoftwareTable() {
+    for (uint32_t b = 0; b < 256; ++b) {
+      uint32_t crc = b;
+      for (int bit = 0; bit < 8; ++bit) {
+        crc = (crc >> 1) ^ ((crc & 1) ? kCrc32cPoly : 0);
+      }
+      table[0][b] = crc;
+    }
+    for (int k = 1; k < 8; ++k) {
+      for (uint32_t b = 0; b < 256; ++b) {
+        table[k][b] = (table[k - 1][b] >> 8) ^ table[0][table[k - 1][b] & 0xFF];
+      }
+    }
+  }
+};
+
+// Takes and returns the raw (pre-inverted) CRC state
+uint32_t Crc32cSoftware(uint32_t crc, const uint8_t* data, size_t length) {
+  static const Crc32cSoftwareTable tables;
+  while (length >= 8) {
+    const uint64_t word = bit_util::ToLittleEndian(util::SafeLoadAs<uint64_t>(data)) ^
+                          static_cast<uint64_t>(crc);
+    crc = tables.table[7][word & 0xFF] ^ tables.table[6][(word >> 8) & 0xFF] ^
+          tables.table[5][(word >> 16) & 0xFF] ^ tables.table[4][(word >> 24) & 0xFF] ^
+          tables.table[3][(word >> 32) & 0xFF] ^ tables.table[2][(word >> 40) & 0xFF] ^
+          tables.table[1][(word >> 48) & 0xFF] ^ tables.table[0][word >> 56];
+    data += 8;
+    length -= 8;
+  }
+  while (length > 0) {
+    crc = (crc >> 8) ^ tables.table[0][(crc ^ *data) & 0xFF];
+    ++data;
+    --length;
+  }
+  return crc;
+}
+
+// ----------------------------------------------------------------------
+// Hardware kernels
+
+#if defined(ARROW_CRC32C_SSE42_DISPATCH) || defined(ARROW_CRC32C_ARMV8)
+
+#  if defined(ARROW_CRC32C_SSE42_DISPATCH)
+__attribute__((target("sse4.2"))) inline uint32_t CrcStep8(uint32_t crc, uint64_t word) {
+  return static_cast<uint32_t>(_mm_crc32_u64(crc, word));
+}
+__attribute__((target("sse4.2"))) inline uint32_t CrcStep1(uint32_t crc, uint8_t byte) {
+  return _mm_crc32_u8(crc, byte);
+}
+#    define ARROW_CRC32C_HW_TARGET __attribute__((target("sse4.2")))
+#  else
+inline uint32_t CrcStep8(uint32_t crc, uint64_t word) { return __crc32cd(crc, word); }
+inline uint32_t CrcStep1(uint32_t crc, uint8_t byte) { return __crc32cb(crc, byte); }
+#    define ARROW_CRC32C_HW_TARGET
+#  endif
+
+// Takes and returns the raw (pre-inverted) CRC state.  Bulk data is split
+// into three lanes processed with independent dependency chains, so that
+// the 3-cycle latency of the CRC32 instruction is hidden; the lane CRCs
+// are then merged with the zero-shift operator.
+ARROW_CRC32C_HW_TARGET
+uint32_t Crc32cHardware(uint32_t crc, const uint8_t* data, size_t length) {
+  static const Crc32cShiftTable shift_table;
+
+  // Align to 8 bytes
+  while (length > 0 && (reinterpret_cast<uintptr_t>(data) & 7) != 0) {
+    crc = CrcStep1(crc, *data);
+    ++data;
+    --length;
+  }
+  while (length >= 3 * kCrcLaneBytes) {
+    uint32_t crc0 = crc;
+    uint32_t crc1 = 0;
+    uint32_t crc2 = 0;
+    for (size_t i = 0; i < kCrcLaneBytes; i += 8) {
+      crc0 = CrcStep8(crc0, util::SafeLoadAs<uint64_t>(data + i));
+      crc1 = CrcStep8(crc1, util::SafeLoadAs<uint64_t>(data + kCrcLaneBytes + i));
+      crc2 = CrcStep8(crc2, util::SafeLoadAs<uint64_t>(data + 2 * kCrcLaneBytes + i));
+    }
+    crc = shift_table.Shift(crc0) ^ crc1;
+    crc = shift_table.Shift(crc) ^ crc2;
+    data += 3 * kCrcLaneBytes;
+    length -= 3 * kCrcLaneBytes;
+  }
+  while (length >= 8) {
+    crc = CrcStep8(crc, util::SafeLoadAs<uint64_t>(data));
+    data += 8;
+    length -= 8;
+  }
+  while (length > 0) {
+    crc = CrcStep1(crc, *data);
+    ++data;
+    --length;
+  }
+  return crc;
+}
+
+#endif  // defined(ARROW_CRC32C_SSE42_DISPATCH) || defined(ARROW_CRC32C_ARMV8)
+
+using Crc32cKernel = uint32_t (*)(uint32_t, const uint8_t*, size_t);
+
+Crc32cKernel ResolveCrc32cKernel() {
+#if defined(ARROW_CRC32C_SSE42_DISPATCH)
+  if (CpuInfo::GetInstance()->IsSupported(CpuInfo::SSE4_2)) {
+    return &Crc32cHardware;
+  }
+#elif defined(ARROW_CRC32C_ARMV8)
+  return &Crc32cHardware;
+#endif
+  return &Crc32cSoftware;
+}
+
+}  // namespace
+
+uint32_t crc32c(uint32_t prev, const void* data, size_t length) {
+  static const Crc32cKernel kernel = ResolveCrc32cKernel();
+  const uint32_t crc = kernel(prev ^ 0xFFFFFFFF, static_cast<const uint8_t*>(data),
+                              length);
+  return crc ^ 0xFFFFFFFF;
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -243,6 +243,42 @@ static void BinaryMathOpDivide256(
   state.SetItemsProcessed(state.iterations() * kValueSize);
 }
 
+static void BinaryMathOpRescale128(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<BasicDecimal128> v;
+  for (int x = 0; x < kValueSize; x++) {
+    v.emplace_back(0, 100 + x);
+  }
+
+  for (auto _ : state) {
+    for (int x = 0; x < kValueSize; ++x) {
+      BasicDecimal128 result;
+      auto s = v[x].Rescale(3, 6, &result);
+      benchmark::DoNotOptimize(s);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kValueSize);
+}
+
+static void BinaryMathOpRescale256(
+    benchmark::State& state) {  // NOLINT non-const reference
+  std::vector<BasicDecimal256> v;
+  for (uint64_t x = 0; x < kValueSize; x++) {
+    v.push_back(BasicDecimal256({100 + x, 0, 0, 0}));
+  }
+
+  for (auto _ : state) {
+    for (int x = 0; x < kValueSize; ++x) {
+      BasicDecimal256 result;
+      auto s = v[x].Rescale(3, 6, &result);
+      benchmark::DoNotOptimize(s);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kValueSize);
+}
+
 static void UnaryOp(benchmark::State& state) {  // NOLINT non-const reference
   std::vector<BasicDecimal128> v;
   for (int x = 0; x < kValueSize; x++) {
@@ -299,6 +335,8 @@ BENCHMARK(BinaryMathOpDivide128);
 BENCHMARK(BinaryMathOpAdd256);
 BENCHMARK(BinaryMathOpMultiply256);
 BENCHMARK(BinaryMathOpDivide256);
+BENCHMARK(BinaryMathOpRescale128);
+BENCHMARK(BinaryMathOpRescale256);
 BENCHMARK(BinaryMathOpAggregate);
 BENCHMARK(BinaryCompareOp);
 BENCHMARK(BinaryCompareOpConstant);
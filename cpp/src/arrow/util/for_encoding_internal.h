@@ -0,0 +1,236 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "arrow/util/bit_stream_utils_internal.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/bpacking.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+namespace util {
+
+/// Utility codec doing frame-of-reference (FOR) encoding with bit packing and
+/// patched exceptions, in the style of PFoR, for in-memory compression of
+/// monotonic-ish integer sequences (selection vectors, row id lists, offsets).
+///
+/// Values are processed in blocks of 128.  Each block stores the minimum value
+/// of the block (the "reference") and bit-packs the deltas from it at a common
+/// bit width.  The width is chosen to minimize the encoded size of the block:
+/// a few outliers do not inflate the width for everybody, they are instead
+/// stored byte-aligned after the packed section as "exceptions" and patched in
+/// after decoding.  Decoding of the packed section goes through unpack32 /
+/// unpack64, so it benefits from the SIMD bit-unpacking kernels.
+///
+/// The encoding is:
+///    encoded-stream  := varint(num_values) block*
+///    block           := varint(reference) byte(bit_width) byte(num_exceptions)
+///                       < 128 deltas bit-packed at bit_width, byte aligned >
+///                       exception*
+///    exception       := byte(position) varint(delta)
+///
+/// The packed section always holds 128 slots (the last block is zero padded),
+/// so that decoding can unpack whole blocks unconditionally.  The packed slot
+/// of an exception holds the low bit_width bits of its delta; the decoder
+/// overwrites it with the full patched value.
+///
+/// Supported value types are uint32_t and uint64_t.
+template <typename T>
+class ForEncoder {
+ public:
+  static constexpr int kBlockSize = 128;
+
+  /// An upper bound on the encoded size of 'num_values' values, suitable for
+  /// sizing the output buffer passed to Encode().
+  static int64_t MaxEncodedSize(int64_t num_values) {
+    const int64_t num_blocks = bit_util::CeilDiv(num_values, kBlockSize);
+    // Worst case per block: max-length varint reference, two header bytes and
+    // full-width packed deltas (a block at full width never has exceptions).
+    return bit_util::BitReader::kMaxVlqByteLengthForInt64 +
+           num_blocks * (bit_util::BitReader::kMaxVlqByteLengthForInt64 + 2 +
+                         kBlockSize * static_cast<int64_t>(sizeof(T)));
+  }
+
+  /// Encode 'num_values' values into 'buffer' of capacity 'buffer_len'.
+  /// Returns the number of bytes written, or -1 if the buffer is too small.
+  static int64_t Encode(const T* values, int64_t num_values, uint8_t* buffer,
+                        int64_t buffer_len) {
+    bit_util::BitWriter writer(buffer, static_cast<int>(buffer_len));
+    if (!writer.PutVlqInt(static_cast<uint64_t>(num_values))) return -1;
+    for (int64_t start = 0; start < num_values; start += kBlockSize) {
+      const int block_length =
+          static_cast<int>(std::min<int64_t>(kBlockSize, num_values - start));
+      if (!EncodeBlock(values + start, block_length, &writer)) return -1;
+    }
+    writer.Flush(/*align=*/true);
+    return writer.bytes_written();
+  }
+
+ private:
+  static bool EncodeBlock(const T* values, int block_length, bit_util::BitWriter* writer) {
+    const T reference = *std::min_element(values, values + block_length);
+    T deltas[kBlockSize] = {0};
+    int width_counts[sizeof(T) * 8 + 1] = {0};
+    int64_t vlq_bytes[sizeof(T) * 8 + 1] = {0};
+    for (int i = 0; i < block_length; ++i) {
+      deltas[i] = values[i] - reference;
+      const int width = bit_util::NumRequiredBits(deltas[i]);
+      ++width_counts[width];
+      vlq_bytes[width] += std::max(1, (width + 6) / 7);
+    }
+
+    // Pick the packed width minimizing the encoded block size.  Values wider
+    // than the packed width become exceptions, each costing a position byte
+    // plus a varint-encoded delta.
+    constexpr int kMaxWidth = static_cast<int>(sizeof(T) * 8);
+    int best_width = kMaxWidth;
+    int64_t best_cost = kBlockSize / 8 * kMaxWidth;
+    int64_t exception_cost = 0;
+    for (int width = kMaxWidth - 1; width >= 0; --width) {
+      exception_cost += width_counts[width + 1] + vlq_bytes[width + 1];
+      const int64_t cost = kBlockSize / 8 * width + exception_cost;
+      if (cost < best_cost) {
+        best_cost = cost;
+        best_width = width;
+      }
+    }
+
+    int num_exceptions = 0;
+    for (int width = best_width + 1; width <= kMaxWidth; ++width) {
+      num_exceptions += width_counts[width];
+    }
+
+    if (!writer->PutVlqInt(static_cast<uint64_t>(reference)) ||
+        !writer->PutAligned<uint8_t>(static_cast<uint8_t>(best_width), 1) ||
+        !writer->PutAligned<uint8_t>(static_cast<uint8_t>(num_exceptions), 1)) {
+      return false;
+    }
+    const uint64_t mask =
+        best_width == 64 ? ~uint64_t{0} : (uint64_t{1} << best_width) - 1;
+    for (int i = 0; i < kBlockSize; ++i) {
+      if (!writer->PutValue(static_cast<uint64_t>(deltas[i]) & mask, best_width)) {
+        return false;
+      }
+    }
+    writer->Flush(/*align=*/true);
+    for (int i = 0; i < block_length; ++i) {
+      if (bit_util::NumRequiredBits(deltas[i]) > best_width) {
+        if (!writer->PutAligned<uint8_t>(static_cast<uint8_t>(i), 1) ||
+            !writer->PutVlqInt(static_cast<uint64_t>(deltas[i]))) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+};
+
+template <typename T>
+class ForDecoder {
+ public:
+  static constexpr int kBlockSize = ForEncoder<T>::kBlockSize;
+
+  /// Read the value count stored at the head of an encoded stream.
+  /// Returns -1 if the stream is truncated.
+  static int64_t DecodedSize(const uint8_t* data, int64_t data_len) {
+    const uint8_t* pos = data;
+    uint64_t num_values = 0;
+    if (!ReadVlq(&pos, data + data_len, &num_values)) return -1;
+    return static_cast<int64_t>(num_values);
+  }
+
+  /// Decode a stream produced by ForEncoder<T>::Encode into 'out' of capacity
+  /// 'out_len' values.  Returns the number of values decoded, or -1 if the
+  /// stream is malformed or 'out' is too small.
+  static int64_t Decode(const uint8_t* data, int64_t data_len, T* out,
+                        int64_t out_len) {
+    const uint8_t* pos = data;
+    const uint8_t* end = data + data_len;
+    uint64_t num_values = 0;
+    if (!ReadVlq(&pos, end, &num_values)) return -1;
+    if (static_cast<int64_t>(num_values) > out_len) return -1;
+    for (int64_t start = 0; start < static_cast<int64_t>(num_values);
+         start += kBlockSize) {
+      const int block_length = static_cast<int>(
+          std::min<int64_t>(kBlockSize, static_cast<int64_t>(num_values) - start));
+      if (!DecodeBlock(&pos, end, out + start, block_length)) return -1;
+    }
+    return static_cast<int64_t>(num_values);
+  }
+
+ private:
+  static bool ReadVlq(const uint8_t** pos, const uint8_t* end, uint64_t* v) {
+    uint64_t result = 0;
+    int shift = 0;
+    while (*pos < end && shift < 64) {
+      const uint8_t byte = *(*pos)++;
+      result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if ((byte & 0x80) == 0) {
+        *v = result;
+        return true;
+      }
+      shift += 7;
+    }
+    return false;
+  }
+
+  static bool DecodeBlock(const uint8_t** pos, const uint8_t* end, T* out,
+                          int block_length) {
+    uint64_t reference = 0;
+    if (!ReadVlq(pos, end, &reference)) return false;
+    if (end - *pos < 2) return false;
+    const int width = *(*pos)++;
+    const int num_exceptions = *(*pos)++;
+    if (width > static_cast<int>(sizeof(T) * 8)) return false;
+    const int64_t packed_bytes = static_cast<int64_t>(kBlockSize) / 8 * width;
+    if (end - *pos < packed_bytes) return false;
+
+    T deltas[kBlockSize];
+    Unpack(*pos, deltas, width);
+    *pos += packed_bytes;
+
+    for (int i = 0; i < num_exceptions; ++i) {
+      if (*pos >= end) return false;
+      const int position = *(*pos)++;
+      uint64_t delta = 0;
+      if (!ReadVlq(pos, end, &delta)) return false;
+      if (position >= kBlockSize) return false;
+      deltas[position] = static_cast<T>(delta);
+    }
+    for (int i = 0; i < block_length; ++i) {
+      out[i] = static_cast<T>(reference) + deltas[i];
+    }
+    return true;
+  }
+
+  static void Unpack(const uint8_t* packed, uint32_t* deltas, int width) {
+    ::arrow::internal::unpack32(reinterpret_cast<const uint32_t*>(packed), deltas,
+                                kBlockSize, width);
+  }
+
+  static void Unpack(const uint8_t* packed, uint64_t* deltas, int width) {
+    ::arrow::internal::unpack64(packed, deltas, kBlockSize, width);
+  }
+};
+
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/for_encoding_internal.h"
+
+namespace arrow {
+namespace util {
+
+template <typename T>
+void CheckRoundTrip(const std::vector<T>& values) {
+  const int64_t num_values = static_cast<int64_t>(values.size());
+  std::vector<uint8_t> buffer(ForEncoder<T>::MaxEncodedSize(num_values));
+  const int64_t encoded_size = ForEncoder<T>::Encode(
+      values.data(), num_values, buffer.data(), static_cast<int64_t>(buffer.size()));
+  ASSERT_GT(encoded_size, 0);
+  ASSERT_LE(encoded_size, static_cast<int64_t>(buffer.size()));
+
+  ASSERT_EQ(ForDecoder<T>::DecodedSize(buffer.data(), encoded_size), num_values);
+  std::vector<T> decoded(values.size());
+  ASSERT_EQ(ForDecoder<T>::Decode(buffer.data(), encoded_size, decoded.data(),
+                                  num_values),
+            num_values);
+  ASSERT_EQ(decoded, values);
+}
+
+TEST(ForEncoding, Empty) { CheckRoundTrip<uint32_t>({}); }
+
+TEST(ForEncoding, Constant) {
+  CheckRoundTrip<uint32_t>(std::vector<uint32_t>(1000, 42));
+  CheckRoundTrip<uint64_t>(std::vector<uint64_t>(1000, uint64_t{1} << 50));
+}
+
+TEST(ForEncoding, Sequential) {
+  std::vector<uint32_t> values(5000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = 1000000 + static_cast<uint32_t>(i);
+  }
+  CheckRoundTrip(values);
+}
+
+TEST(ForEncoding, SequentialIsCompact) {
+  // A dense row id list should pack at a few bits per value, not 32
+  std::vector<uint32_t> values(4096);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = static_cast<uint32_t>(i);
+  }
+  std::vector<uint8_t> buffer(ForEncoder<uint32_t>::MaxEncodedSize(4096));
+  const int64_t encoded_size = ForEncoder<uint32_t>::Encode(
+      values.data(), 4096, buffer.data(), static_cast<int64_t>(buffer.size()));
+  ASSERT_GT(encoded_size, 0);
+  ASSERT_LT(encoded_size, 4096 * 2);
+}
+
+TEST(ForEncoding, Exceptions) {
+  // Mostly small deltas with rare large outliers; the outliers should be
+  // patched rather than inflating the packed width
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<uint32_t> small(0, 255);
+  std::vector<uint32_t> values(10000);
+  for (size_t i = 0; i < values.size(); ++i) {
+    values[i] = small(rng);
+    if (i % 300 == 0) {
+      values[i] = 0x7FFFFFFF;
+    }
+  }
+  CheckRoundTrip(values);
+  std::vector<uint8_t> buffer(ForEncoder<uint32_t>::MaxEncodedSize(10000));
+  const int64_t encoded_size = ForEncoder<uint32_t>::Encode(
+      values.data(), 10000, buffer.data(), static_cast<int64_t>(buffer.size()));
+  ASSERT_LT(encoded_size, 10000 * 2);
+}
+
+TEST(ForEncoding, Random64) {
+  std::mt19937_64 rng(43);
+  for (const uint64_t range : {uint64_t{100}, uint64_t{1} << 33, ~uint64_t{0}}) {
+    std::uniform_int_distribution<uint64_t> dist(0, range);
+    std::vector<uint64_t> values(3000);
+    for (auto& value : values) {
+      value = dist(rng);
+    }
+    CheckRoundTrip(values);
+  }
+}
+
+TEST(ForEncoding, PartialBlock) {
+  for (const int64_t length : {1, 127, 128, 129, 255}) {
+    std::vector<uint32_t> values(length);
+    for (int64_t i = 0; i < length; ++i) {
+      values[i] = static_cast<uint32_t>(i * 7 + 3);
+    }
+    CheckRoundTrip(values);
+  }
+}
+
+TEST(ForEncoding, BufferTooSmall) {
+  std::vector<uint32_t> values(1000, 123456789);
+  uint8_t buffer[16];
+  ASSERT_EQ(ForEncoder<uint32_t>::Encode(values.data(), 1000, buffer, sizeof(buffer)),
+            -1);
+}
+
+}  // namespace util
+}  // namespace arrow
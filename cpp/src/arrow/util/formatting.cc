@@ -15,11 +15,15 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <cmath>
+#include <cstring>
+
 #include "arrow/util/formatting.h"
 #include "arrow/util/config.h"
 #include "arrow/util/double_conversion.h"
 #include "arrow/util/float16.h"
 #include "arrow/util/logging_internal.h"
+#include "arrow/util/ryu_internal.h"
 
 namespace arrow {
 
@@ -42,8 +46,8 @@ const char digit_pairs[] =
 
 struct FloatToStringFormatter::Impl {
   Impl()
-      : converter_(DoubleToStringConverter::EMIT_POSITIVE_EXPONENT_SIGN, "inf", "nan",
-                   'e', -6, 10, 6, 0) {}
+      : Impl(DoubleToStringConverter::EMIT_POSITIVE_EXPONENT_SIGN, "inf", "nan", 'e', -6,
+             10, 6, 0) {}
 
   Impl(int flags, const char* inf_symbol, const char* nan_symbol, char exp_character,
        int decimal_in_shortest_low, int decimal_in_shortest_high,
@@ -51,9 +55,145 @@ struct FloatToStringFormatter::Impl {
        int max_trailing_padding_zeroes_in_precision_mode)
       : converter_(flags, inf_symbol, nan_symbol, exp_character, decimal_in_shortest_low,
                    decimal_in_shortest_high, max_leading_padding_zeroes_in_precision_mode,
-                   max_trailing_padding_zeroes_in_precision_mode) {}
+                   max_trailing_padding_zeroes_in_precision_mode),
+        flags_(flags),
+        inf_symbol_(inf_symbol),
+        nan_symbol_(nan_symbol),
+        exp_character_(exp_character),
+        decimal_in_shortest_low_(decimal_in_shortest_low),
+        decimal_in_shortest_high_(decimal_in_shortest_high) {
+    // The Ryu fast path reproduces double-conversion's shortest output
+    // (same digits, same layout) for the flags used in Arrow; fall back
+    // to double-conversion for the exotic ones.
+    constexpr int kSupportedFlags = DoubleToStringConverter::EMIT_POSITIVE_EXPONENT_SIGN |
+                                    DoubleToStringConverter::UNIQUE_ZERO;
+    use_ryu_ = (flags & ~kSupportedFlags) == 0;
+  }
+
+  // Lay out the shortest decimal representation the same way as
+  // double-conversion's ToShortest() does, honoring the configured
+  // decimal range, exponent character and exponent sign emission.
+  int FormatShortestDecimal(bool negative, ShortestDecimal shortest, char* out) {
+    // Generate the digit characters (at most 17 of them)
+    char digit_buffer[20];
+    char* digits_end = digit_buffer + sizeof(digit_buffer);
+    char* digits = digits_end;
+    detail::FormatAllDigits(shortest.digits, &digits);
+    const int num_digits = static_cast<int>(digits_end - digits);
+
+    // The value is 0.{digits} * 10^decimal_point
+    const int decimal_point = shortest.exponent + num_digits;
+    const int exponent = decimal_point - 1;
+
+    char* pos = out;
+    if (negative) {
+      *pos++ = '-';
+    }
+    if (decimal_in_shortest_low_ <= exponent && exponent < decimal_in_shortest_high_) {
+      // Positional notation
+      if (decimal_point <= 0) {
+        // "0.000digits"
+        *pos++ = '0';
+        *pos++ = '.';
+        for (int i = 0; i < -decimal_point; ++i) {
+          *pos++ = '0';
+        }
+        memcpy(pos, digits, num_digits);
+        pos += num_digits;
+      } else if (decimal_point >= num_digits) {
+        // "digits000"
+        memcpy(pos, digits, num_digits);
+        pos += num_digits;
+        for (int i = 0; i < decimal_point - num_digits; ++i) {
+          *pos++ = '0';
+        }
+      } else {
+        // "dig.its"
+        memcpy(pos, digits, decimal_point);
+        pos += decimal_point;
+        *pos++ = '.';
+        memcpy(pos, digits + decimal_point, num_digits - decimal_point);
+        pos += num_digits - decimal_point;
+      }
+    } else {
+      // Exponential notation: "d.igitse+xx"
+      *pos++ = digits[0];
+      if (num_digits > 1) {
+        *pos++ = '.';
+        memcpy(pos, digits + 1, num_digits - 1);
+        pos += num_digits - 1;
+      }
+      *pos++ = exp_character_;
+      int exp_value = exponent;
+      if (exp_value < 0) {
+        *pos++ = '-';
+        exp_value = -exp_value;
+      } else if (flags_ & DoubleToStringConverter::EMIT_POSITIVE_EXPONENT_SIGN) {
+        *pos++ = '+';
+      }
+      char exp_buffer[8];
+      char* exp_end = exp_buffer + sizeof(exp_buffer);
+      char* exp_digits = exp_end;
+      detail::FormatAllDigits(exp_value, &exp_digits);
+      memcpy(pos, exp_digits, exp_end - exp_digits);
+      pos += exp_end - exp_digits;
+    }
+    return static_cast<int>(pos - out);
+  }
+
+  template <typename Float>
+  int FormatSpecialOrZero(Float value, char* out) {
+    // Returns -1 if the value needs regular digit formatting
+    char* pos = out;
+    if (std::isnan(value)) {
+      const size_t n = strlen(nan_symbol_);
+      memcpy(pos, nan_symbol_, n);
+      return static_cast<int>(n);
+    }
+    if (std::isinf(value)) {
+      if (std::signbit(value)) {
+        *pos++ = '-';
+      }
+      const size_t n = strlen(inf_symbol_);
+      memcpy(pos, inf_symbol_, n);
+      return static_cast<int>(pos + n - out);
+    }
+    if (value == static_cast<Float>(0)) {
+      const bool unique_zero = (flags_ & DoubleToStringConverter::UNIQUE_ZERO) != 0;
+      if (std::signbit(value) && !unique_zero) {
+        *pos++ = '-';
+      }
+      *pos++ = '0';
+      return static_cast<int>(pos - out);
+    }
+    return -1;
+  }
+
+  int Format(float value, char* out) {
+    const int special_size = FormatSpecialOrZero(value, out);
+    if (special_size >= 0) {
+      return special_size;
+    }
+    return FormatShortestDecimal(std::signbit(value), FloatToShortestDecimal(value), out);
+  }
+
+  int Format(double value, char* out) {
+    const int special_size = FormatSpecialOrZero(value, out);
+    if (special_size >= 0) {
+      return special_size;
+    }
+    return FormatShortestDecimal(std::signbit(value), DoubleToShortestDecimal(value),
+                                 out);
+  }
 
   DoubleToStringConverter converter_;
+  int flags_;
+  const char* inf_symbol_;
+  const char* nan_symbol_;
+  char exp_character_;
+  int decimal_in_shortest_low_;
+  int decimal_in_shortest_high_;
+  bool use_ryu_;
 };
 
 FloatToStringFormatter::FloatToStringFormatter() : impl_(new Impl()) {}
@@ -72,6 +212,9 @@ FloatToStringFormatter::~FloatToStringFormatter() {}
 
 int FloatToStringFormatter::FormatFloat(float v, char* out_buffer, int out_size) {
   DCHECK_GE(out_size, kMinBufferSize);
+  if (impl_->use_ryu_) {
+    return impl_->Format(v, out_buffer);
+  }
   // StringBuilder checks bounds in debug mode for us
   util::double_conversion::StringBuilder builder(out_buffer, out_size);
   bool result = impl_->converter_.ToShortestSingle(v, &builder);
@@ -82,6 +225,9 @@ int FloatToStringFormatter::FormatFloat(float v, char* out_buffer, int out_size)
 
 int FloatToStringFormatter::FormatFloat(double v, char* out_buffer, int out_size) {
   DCHECK_GE(out_size, kMinBufferSize);
+  if (impl_->use_ryu_) {
+    return impl_->Format(v, out_buffer);
+  }
   util::double_conversion::StringBuilder builder(out_buffer, out_size);
   bool result = impl_->converter_.ToShortest(v, &builder);
   DCHECK(result);
@@ -91,8 +237,13 @@ int FloatToStringFormatter::FormatFloat(double v, char* out_buffer, int out_size
 
 int FloatToStringFormatter::FormatFloat(uint16_t v, char* out_buffer, int out_size) {
   DCHECK_GE(out_size, kMinBufferSize);
+  // Half floats have always been formatted through the double path
+  const double value = Float16::FromBits(v).ToFloat();
+  if (impl_->use_ryu_) {
+    return impl_->Format(value, out_buffer);
+  }
   util::double_conversion::StringBuilder builder(out_buffer, out_size);
-  bool result = impl_->converter_.ToShortest(Float16::FromBits(v).ToFloat(), &builder);
+  bool result = impl_->converter_.ToShortest(value, &builder);
   DCHECK(result);
   ARROW_UNUSED(result);
   return builder.position();
@@ -282,6 +282,30 @@ TEST(Formatting, Double) {
   AssertFormatting(formatter, -HUGE_VAL, "-inf");
 }
 
+TEST(Formatting, FloatExtremes) {
+  // Exercise the boundaries of the shortest-representation algorithm
+  {
+    StringFormatter<FloatType> formatter;
+    AssertFormatting(formatter, std::numeric_limits<float>::min(), "1.1754944e-38");
+    AssertFormatting(formatter, std::numeric_limits<float>::denorm_min(), "1e-45");
+    AssertFormatting(formatter, std::numeric_limits<float>::max(), "3.4028235e+38");
+    AssertFormatting(formatter, 16777216.0f, "16777216");
+    AssertFormatting(formatter, 16777218.0f, "16777218");
+  }
+  {
+    StringFormatter<DoubleType> formatter;
+    AssertFormatting(formatter, std::numeric_limits<double>::min(),
+                     "2.2250738585072014e-308");
+    AssertFormatting(formatter, std::numeric_limits<double>::denorm_min(), "5e-324");
+    AssertFormatting(formatter, std::numeric_limits<double>::max(),
+                     "1.7976931348623157e+308");
+    AssertFormatting(formatter, 9007199254740992.0, "9.007199254740992e+15");
+    AssertFormatting(formatter, 9007199254740994.0, "9.007199254740994e+15");
+    AssertFormatting(formatter, 0.1, "0.1");
+    AssertFormatting(formatter, 1.0 / 3.0, "0.3333333333333333");
+  }
+}
+
 TEST(Formatting, HalfFloat) {
   StringFormatter<HalfFloatType> formatter;
 
@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <new>
 #include <tuple>
 #include <type_traits>
 
@@ -119,6 +121,10 @@ struct call_traits {
 /// Invoking it results in destruction of the lambda, freeing any state/references
 /// immediately. Invoking a default constructed FnOnce or one which has already been
 /// invoked will segfault.
+///
+/// Small callables (up to kInlineSize bytes, including the vtable pointer) with a
+/// non-throwing move constructor are stored inline, avoiding a heap allocation per
+/// continuation on hot paths such as Future callback chains.
 template <typename Signature>
 class FnOnce;
 
@@ -130,30 +136,96 @@ class FnOnce<R(A...)> {
   template <typename Fn,
             typename = typename std::enable_if<std::is_convertible<
                 decltype(std::declval<Fn&&>()(std::declval<A>()...)), R>::value>::type>
-  FnOnce(Fn fn) : impl_(new FnImpl<Fn>(std::move(fn))) {  // NOLINT runtime/explicit
+  FnOnce(Fn fn) {  // NOLINT runtime/explicit
+    if constexpr (sizeof(FnImpl<Fn>) <= kInlineSize &&
+                  alignof(FnImpl<Fn>) <= alignof(std::max_align_t) &&
+                  std::is_nothrow_move_constructible<Fn>::value) {
+      impl_ = new (&storage_) FnImpl<Fn>(std::move(fn));
+    } else {
+      impl_ = new FnImpl<Fn>(std::move(fn));
+    }
+  }
+
+  FnOnce(FnOnce&& other) noexcept { MoveFrom(std::move(other)); }
+
+  FnOnce& operator=(FnOnce&& other) noexcept {
+    if (this != &other) {
+      Reset();
+      MoveFrom(std::move(other));
+    }
+    return *this;
   }
 
+  ~FnOnce() { Reset(); }
+
   explicit operator bool() const { return impl_ != NULLPTR; }
 
   R operator()(A... a) && {
-    auto bye = std::move(impl_);
-    return bye->invoke(std::forward<A&&>(a)...);
+    // Clear impl_ before invoking so this FnOnce can be reassigned reentrantly
+    Impl* impl = impl_;
+    const bool was_inline = IsInline();
+    impl_ = NULLPTR;
+    if (was_inline) {
+      struct Guard {
+        Impl* impl;
+        ~Guard() { impl->~Impl(); }
+      } guard{impl};
+      return impl->invoke(std::forward<A&&>(a)...);
+    } else {
+      std::unique_ptr<Impl> bye(impl);
+      return bye->invoke(std::forward<A&&>(a)...);
+    }
   }
 
  private:
+  static constexpr std::size_t kInlineSize = 48;
+
   struct Impl {
     virtual ~Impl() = default;
     virtual R invoke(A&&... a) = 0;
+    // Move-construct a copy of this impl into `storage` (only called for
+    // inline impls, whose callables never throw on move)
+    virtual Impl* MoveTo(void* storage) noexcept = 0;
   };
 
   template <typename Fn>
   struct FnImpl : Impl {
     explicit FnImpl(Fn fn) : fn_(std::move(fn)) {}
     R invoke(A&&... a) override { return std::move(fn_)(std::forward<A&&>(a)...); }
+    Impl* MoveTo(void* storage) noexcept override {
+      return new (storage) FnImpl(std::move(fn_));
+    }
     Fn fn_;
   };
 
-  std::unique_ptr<Impl> impl_;
+  bool IsInline() const {
+    return static_cast<const void*>(impl_) == static_cast<const void*>(&storage_);
+  }
+
+  void MoveFrom(FnOnce&& other) noexcept {
+    if (other.impl_ == NULLPTR) {
+      impl_ = NULLPTR;
+    } else if (other.IsInline()) {
+      impl_ = other.impl_->MoveTo(&storage_);
+      other.Reset();
+    } else {
+      impl_ = other.impl_;
+      other.impl_ = NULLPTR;
+    }
+  }
+
+  void Reset() noexcept {
+    if (impl_ == NULLPTR) return;
+    if (IsInline()) {
+      impl_->~Impl();
+    } else {
+      delete impl_;
+    }
+    impl_ = NULLPTR;
+  }
+
+  Impl* impl_ = NULLPTR;
+  typename std::aligned_storage<kInlineSize, alignof(std::max_align_t)>::type storage_;
 };
 
 }  // namespace internal
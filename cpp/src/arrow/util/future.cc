@@ -49,7 +49,6 @@ class ConcreteFutureImpl : public FutureImpl {
 
   void AddCallback(Callback callback, CallbackOptions opts) {
     CheckOptions(opts);
-    std::unique_lock<std::mutex> lock(mutex_);
 #ifdef ARROW_WITH_OPENTELEMETRY
     callback = [func = std::move(callback),
                 active_span = ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()](
@@ -59,10 +58,21 @@ class ConcreteFutureImpl : public FutureImpl {
     };
 #endif
     CallbackRecord callback_record{std::move(callback), opts};
+    // Fast path: a finished future can never transition back to pending and its
+    // queued callbacks have already been claimed, so the callback can be run
+    // immediately without taking the lock
+    if (IsFutureFinished(state_.load())) {
+      RunOrScheduleCallback(shared_from_this(), std::move(callback_record),
+                            /*in_add_callback=*/true);
+      return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
     if (IsFutureFinished(state_)) {
       lock.unlock();
       RunOrScheduleCallback(shared_from_this(), std::move(callback_record),
                             /*in_add_callback=*/true);
+    } else if (!first_callback_) {
+      first_callback_ = std::move(callback_record);
     } else {
       callbacks_.push_back(std::move(callback_record));
     }
@@ -71,9 +81,15 @@ class ConcreteFutureImpl : public FutureImpl {
   bool TryAddCallback(const std::function<Callback()>& callback_factory,
                       CallbackOptions opts) {
     CheckOptions(opts);
+    if (IsFutureFinished(state_.load())) {
+      return false;
+    }
     std::unique_lock<std::mutex> lock(mutex_);
     if (IsFutureFinished(state_)) {
       return false;
+    } else if (!first_callback_) {
+      first_callback_ = CallbackRecord{callback_factory(), opts};
+      return true;
     } else {
       callbacks_.push_back({callback_factory(), opts});
       return true;
@@ -112,6 +128,7 @@ class ConcreteFutureImpl : public FutureImpl {
   }
 
   void DoMarkFinishedOrFailed(FutureState state) {
+    std::optional<CallbackRecord> first_callback;
     std::vector<CallbackRecord> callbacks;
     std::shared_ptr<FutureImpl> self;
     {
@@ -124,7 +141,9 @@ class ConcreteFutureImpl : public FutureImpl {
 #endif
 
       DCHECK(!IsFutureFinished(state_)) << "Future already marked finished";
-      if (!callbacks_.empty()) {
+      if (first_callback_ || !callbacks_.empty()) {
+        first_callback = std::move(first_callback_);
+        first_callback_.reset();
         callbacks = std::move(callbacks_);
         auto self_inner = shared_from_this();
         self = std::move(self_inner);
@@ -136,7 +155,6 @@ class ConcreteFutureImpl : public FutureImpl {
       // it is performing a notify_all
       cv_.notify_all();
     }
-    if (callbacks.empty()) return;
 
     // run callbacks, lock not needed since the future is finished by this
     // point so nothing else can modify the callbacks list and it is safe
@@ -144,6 +162,9 @@ class ConcreteFutureImpl : public FutureImpl {
     //
     // In fact, it is important not to hold the locks because the callback
     // may be slow or do its own locking on other resources
+    if (first_callback) {
+      RunOrScheduleCallback(self, std::move(*first_callback), /*in_add_callback=*/false);
+    }
     for (auto& callback_record : callbacks) {
       RunOrScheduleCallback(self, std::move(callback_record), /*in_add_callback=*/false);
     }
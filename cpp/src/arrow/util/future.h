@@ -295,6 +295,10 @@ class ARROW_EXPORT FutureImpl : public std::enable_shared_from_this<FutureImpl>
     Callback callback;
     CallbackOptions options;
   };
+  // Most futures only ever get a single continuation, so the first callback is
+  // stored inline and the vector is only allocated for the second and
+  // subsequent callbacks.
+  std::optional<CallbackRecord> first_callback_;
   std::vector<CallbackRecord> callbacks_;
 #ifdef ARROW_WITH_OPENTELEMETRY
   util::tracing::Span* span_ = NULLPTR;
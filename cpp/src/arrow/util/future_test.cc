@@ -37,6 +37,7 @@
 #include "arrow/testing/future_util.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/matchers.h"
+#include "arrow/util/coroutine.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/thread_pool.h"
 
@@ -1598,5 +1599,72 @@ TEST(FutureTest, MatcherExamples) {
               Finishes(testing::Not(ResultWith(testing::HasSubstr("hello")))));
 }
 
+#ifdef ARROW_HAVE_COROUTINES
+
+namespace {
+
+Future<int> CoroAddFutures(Future<int> a, Future<int> b) {
+  co_return (co_await std::move(a)) + (co_await std::move(b));
+}
+
+Future<> CoroAwaitAndForget(Future<int> future) {
+  co_await std::move(future);
+  co_return Status::OK();
+}
+
+}  // namespace
+
+TEST(FutureCoroutineTest, Success) {
+  auto a = Future<int>::Make();
+  auto b = Future<int>::Make();
+  auto sum = CoroAddFutures(a, b);
+  ASSERT_FALSE(sum.is_finished());
+  a.MarkFinished(4);
+  b.MarkFinished(5);
+  ASSERT_FINISHES_OK_AND_EQ(9, sum);
+}
+
+TEST(FutureCoroutineTest, AlreadyFinished) {
+  auto sum =
+      CoroAddFutures(Future<int>::MakeFinished(4), Future<int>::MakeFinished(5));
+  ASSERT_FINISHES_OK_AND_EQ(9, sum);
+}
+
+TEST(FutureCoroutineTest, ErrorShortCircuits) {
+  auto a = Future<int>::Make();
+  auto b = Future<int>::Make();
+  auto sum = CoroAddFutures(a, b);
+  a.MarkFinished(Status::Invalid("XYZ"));
+  // The coroutine is aborted without ever awaiting b
+  ASSERT_FINISHES_AND_RAISES(Invalid, sum);
+}
+
+TEST(FutureCoroutineTest, EmptyFuture) {
+  auto source = Future<int>::Make();
+  auto fut = CoroAwaitAndForget(source);
+  ASSERT_FALSE(fut.is_finished());
+  source.MarkFinished(42);
+  ASSERT_FINISHES_OK(fut);
+}
+
+TEST(FutureCoroutineTest, Threaded) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(4));
+  std::vector<Future<int>> futures;
+  for (int i = 0; i < 100; ++i) {
+    ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit([i] { return i; }));
+    futures.push_back(std::move(fut));
+  }
+  std::vector<Future<int>> sums;
+  for (int i = 0; i < 100; i += 2) {
+    sums.push_back(CoroAddFutures(futures[i], futures[i + 1]));
+  }
+  for (int i = 0; i < 50; ++i) {
+    ASSERT_FINISHES_OK_AND_EQ(4 * i + 1, sums[i]);
+  }
+  ASSERT_OK(pool->Shutdown());
+}
+
+#endif  // ARROW_HAVE_COROUTINES
+
 }  // namespace internal
 }  // namespace arrow
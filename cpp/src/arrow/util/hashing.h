@@ -206,6 +206,21 @@ hash_t ComputeStringHash(const void* data, int64_t length) {
                                 XXH3_SECRET_SIZE_MIN);
 }
 
+// Compute hashes for a contiguous batch of scalar values.
+//
+// The results are identical to calling ScalarHelper<Scalar>::ComputeHash on
+// each value; batching merely exposes the loop to the compiler, so that the
+// integer mix (multiply + byte swap) gets vectorized and pipelined across
+// elements instead of being recomputed inside each hash table probe.  The
+// batched hashes can be fed back through the hash-taking GetOrInsert
+// overloads below.
+template <typename Scalar, uint64_t AlgNum = 0>
+void ComputeHashBatch(const Scalar* values, int64_t length, hash_t* out_hashes) {
+  for (int64_t i = 0; i < length; ++i) {
+    out_hashes[i] = ScalarHelper<Scalar, AlgNum>::ComputeHash(values[i]);
+  }
+}
+
 // XXX add a HashEq<ArrowType> struct with both hash and compare functions?
 
 // ----------------------------------------------------------------------
@@ -419,13 +434,16 @@ class ScalarMemoTable : public MemoTable {
     }
   }
 
+  // Overload taking a precomputed hash, which must have been obtained from
+  // ScalarHelper<Scalar, 0>::ComputeHash (e.g. a batch at a time through
+  // ComputeHashBatch) so that it is consistent with the hashes computed
+  // internally by Get().
   template <typename Func1, typename Func2>
-  Status GetOrInsert(const Scalar& value, Func1&& on_found, Func2&& on_not_found,
-                     int32_t* out_memo_index) {
+  Status GetOrInsert(const Scalar& value, hash_t h, Func1&& on_found,
+                     Func2&& on_not_found, int32_t* out_memo_index) {
     auto cmp_func = [value](const Payload* payload) -> bool {
       return ScalarHelper<Scalar, 0>::CompareScalars(value, payload->value);
     };
-    hash_t h = ComputeHash(value);
     auto p = hash_table_.Lookup(h, cmp_func);
     int32_t memo_index;
     if (p.second) {
@@ -440,6 +458,18 @@ class ScalarMemoTable : public MemoTable {
     return Status::OK();
   }
 
+  template <typename Func1, typename Func2>
+  Status GetOrInsert(const Scalar& value, Func1&& on_found, Func2&& on_not_found,
+                     int32_t* out_memo_index) {
+    return GetOrInsert(value, ComputeHash(value), std::forward<Func1>(on_found),
+                       std::forward<Func2>(on_not_found), out_memo_index);
+  }
+
+  Status GetOrInsert(const Scalar& value, hash_t h, int32_t* out_memo_index) {
+    return GetOrInsert(
+        value, h, [](int32_t i) {}, [](int32_t i) {}, out_memo_index);
+  }
+
   Status GetOrInsert(const Scalar& value, int32_t* out_memo_index) {
     return GetOrInsert(
         value, [](int32_t i) {}, [](int32_t i) {}, out_memo_index);
@@ -636,13 +666,39 @@ class SmallScalarMemoTable : public MemoTable {
 // ----------------------------------------------------------------------
 // A memoization table for variable-sized binary data.
 
+// To keep high-cardinality dictionary building well-behaved, the hash table
+// is radix-partitioned into kRadixFanout sub-tables (selected by the topmost
+// hash bits) once it grows past kRadixSplitThreshold entries.  Each sub-table
+// then grows independently, so rehashing stalls and allocation spikes are
+// bounded by a fraction of the total number of entries.  The value arena
+// stays a single builder, preserving insertion-ordered memo indices and the
+// contiguous data layout that CopyValues() and friends rely on.
+
 template <typename BinaryBuilderT>
 class BinaryMemoTable : public MemoTable {
  public:
   using builder_offset_type = typename BinaryBuilderT::offset_type;
+
+  // Number of sub-tables after radix partitioning
+  static constexpr int kRadixBits = 8;
+  static constexpr int kRadixFanout = 1 << kRadixBits;
+  // Partition the hash table once it holds this many entries
+  static constexpr uint64_t kRadixSplitThreshold = 1ULL << 20;
+
   explicit BinaryMemoTable(MemoryPool* pool, int64_t entries = 0,
                            int64_t values_size = -1)
-      : hash_table_(pool, static_cast<uint64_t>(entries)), binary_builder_(pool) {
+      : pool_(pool), binary_builder_(pool) {
+    if (static_cast<uint64_t>(entries) >= kRadixSplitThreshold) {
+      // The size hint announces a high-cardinality workload: start partitioned
+      // instead of paying for a split down the road.
+      hash_tables_.reserve(kRadixFanout);
+      for (int i = 0; i < kRadixFanout; ++i) {
+        hash_tables_.emplace_back(pool, static_cast<uint64_t>(entries) / kRadixFanout);
+      }
+    } else {
+      hash_tables_.reserve(1);
+      hash_tables_.emplace_back(pool, static_cast<uint64_t>(entries));
+    }
     const int64_t data_size = (values_size < 0) ? entries * 4 : values_size;
     ARROW_DCHECK_OK(binary_builder_.Resize(entries));
     ARROW_DCHECK_OK(binary_builder_.ReserveData(data_size));
@@ -676,8 +732,12 @@ class BinaryMemoTable : public MemoTable {
       // Insert string value
       RETURN_NOT_OK(binary_builder_.Append(static_cast<const char*>(data), length));
       // Insert hash entry
-      RETURN_NOT_OK(
-          hash_table_.Insert(const_cast<HashTableEntry*>(p.first), h, {memo_index}));
+      RETURN_NOT_OK(TableForHash(h).Insert(const_cast<HashTableEntry*>(p.first), h,
+                                           {memo_index}));
+      if (ARROW_PREDICT_FALSE(hash_tables_.size() == 1 &&
+                              hash_tables_[0].size() >= kRadixSplitThreshold)) {
+        RETURN_NOT_OK(SplitTable());
+      }
 
       on_not_found(memo_index);
     }
@@ -726,7 +786,9 @@ class BinaryMemoTable : public MemoTable {
   // The number of entries in the memo table
   // (which is also 1 + the largest memo index)
   int32_t size() const override {
-    return static_cast<int32_t>(hash_table_.size() + (GetNull() != kKeyNotFound));
+    // The builder holds one appended value per memo index (including the null
+    // entry, if any), which avoids summing over the partitioned hash tables.
+    return static_cast<int32_t>(binary_builder_.length());
   }
 
   int64_t values_size() const { return binary_builder_.value_data_length(); }
@@ -858,11 +920,49 @@ class BinaryMemoTable : public MemoTable {
 
   using HashTableType = HashTable<Payload>;
   using HashTableEntry = typename HashTable<Payload>::Entry;
-  HashTableType hash_table_;
+  static constexpr int kRadixShift = 64 - kRadixBits;
+
+  MemoryPool* pool_;
+  // A single table until kRadixSplitThreshold, then kRadixFanout sub-tables
+  std::vector<HashTableType> hash_tables_;
   BinaryBuilderT binary_builder_;
 
   int32_t null_index_ = kKeyNotFound;
 
+  HashTableType& TableForHash(hash_t h) {
+    return hash_tables_.size() == 1 ? hash_tables_[0] : hash_tables_[h >> kRadixShift];
+  }
+
+  const HashTableType& TableForHash(hash_t h) const {
+    return hash_tables_.size() == 1 ? hash_tables_[0] : hash_tables_[h >> kRadixShift];
+  }
+
+  // Redistribute the single hash table into kRadixFanout sub-tables keyed by
+  // the topmost hash bits.  Memo indices and the value arena are unaffected.
+  Status SplitTable() {
+    // Budget each sub-table for an equal share of the current entries
+    const uint64_t sub_capacity =
+        hash_tables_[0].size() * HashTableType::kLoadFactor / kRadixFanout;
+    std::vector<HashTableType> sub_tables;
+    sub_tables.reserve(kRadixFanout);
+    for (int i = 0; i < kRadixFanout; ++i) {
+      sub_tables.emplace_back(pool_, sub_capacity);
+    }
+    Status st = Status::OK();
+    hash_tables_[0].VisitEntries([&](const HashTableEntry* entry) {
+      auto& sub_table = sub_tables[entry->h >> kRadixShift];
+      // The stored hashes are all distinct from the sentinel and the entries
+      // they tag are unique, so a dummy compare always lands on an empty slot.
+      auto p = sub_table.Lookup(entry->h, [](const Payload*) { return false; });
+      if (st.ok()) {
+        st = sub_table.Insert(p.first, entry->h, entry->payload);
+      }
+    });
+    RETURN_NOT_OK(st);
+    hash_tables_ = std::move(sub_tables);
+    return Status::OK();
+  }
+
   std::pair<const HashTableEntry*, bool> Lookup(hash_t h, const void* data,
                                                 builder_offset_type length) const {
     auto cmp_func = [&](const Payload* payload) {
@@ -870,7 +970,7 @@ class BinaryMemoTable : public MemoTable {
       std::string_view rhs(static_cast<const char*>(data), length);
       return lhs == rhs;
     };
-    return hash_table_.Lookup(h, cmp_func);
+    return TableForHash(h).Lookup(h, cmp_func);
   }
 
  public:
@@ -219,6 +219,34 @@ TEST(ScalarMemoTable, Int64) {
   }
 }
 
+TEST(ScalarMemoTable, Int64BatchedHashes) {
+  // Batched hashes must agree with the hashes computed internally by the
+  // memo table, so that the hash-taking GetOrInsert overload and the plain
+  // one can be mixed freely on the same table
+  const auto values = MakeDistinctIntegers<int64_t>(1000);
+  std::vector<int64_t> value_vec(values.begin(), values.end());
+  std::vector<hash_t> hashes(value_vec.size());
+  ComputeHashBatch(value_vec.data(), static_cast<int64_t>(value_vec.size()),
+                   hashes.data());
+  for (size_t i = 0; i < value_vec.size(); ++i) {
+    ASSERT_EQ(hashes[i], (ScalarHelper<int64_t, 0>::ComputeHash(value_vec[i])));
+  }
+
+  ScalarMemoTable<int64_t> table(default_memory_pool(), 0);
+  for (size_t i = 0; i < value_vec.size(); ++i) {
+    int32_t memo_index;
+    ASSERT_OK(table.GetOrInsert(value_vec[i], hashes[i], &memo_index));
+    ASSERT_EQ(memo_index, static_cast<int32_t>(i));
+  }
+  // Lookups computing their own hash find the entries inserted with
+  // precomputed hashes
+  for (size_t i = 0; i < value_vec.size(); ++i) {
+    AssertGet(table, value_vec[i], static_cast<int32_t>(i));
+    AssertGetOrInsert(table, value_vec[i], static_cast<int32_t>(i));
+  }
+  ASSERT_EQ(table.size(), static_cast<int32_t>(value_vec.size()));
+}
+
 TEST(ScalarMemoTable, UInt16) {
   const uint16_t A = 1236, B = 0, C = 65535, D = 32767, E = 1;
 
@@ -480,6 +508,52 @@ TEST(BinaryMemoTable, Stress) {
   ASSERT_EQ(table.size(), map.size());
 }
 
+TEST(BinaryMemoTable, HighCardinality) {
+  // Exercise the radix-partitioned regime: a size hint past the split
+  // threshold makes the table start with partitioned sub-tables.
+  const int64_t entries_hint = BinaryMemoTable<BinaryBuilder>::kRadixSplitThreshold;
+  BinaryMemoTable<BinaryBuilder> table(default_memory_pool(), entries_hint);
+
+  const int32_t n_values = 1000;
+  const auto values = MakeDistinctStrings(n_values);
+
+  int32_t expected = 0;
+  for (const auto& value : values) {
+    int32_t actual;
+    ASSERT_OK(table.GetOrInsert(value, &actual));
+    ASSERT_EQ(actual, expected++);
+  }
+  ASSERT_EQ(table.size(), n_values);
+  expected = 0;
+  for (const auto& value : values) {
+    AssertGet(table, value, expected++);
+  }
+}
+
+TEST(BinaryMemoTable, RadixSplitStress) {
+#ifdef ARROW_VALGRIND
+  GTEST_SKIP() << "Test too slow under Valgrind";
+#endif
+  // Insert past the split threshold with no size hint, so that the single
+  // hash table gets redistributed into sub-tables mid-build.
+  const int64_t n_values =
+      static_cast<int64_t>(BinaryMemoTable<BinaryBuilder>::kRadixSplitThreshold) + 1000;
+  BinaryMemoTable<BinaryBuilder> table(default_memory_pool(), 0);
+
+  for (int64_t i = 0; i < n_values; ++i) {
+    const std::string value = "value-" + std::to_string(i);
+    int32_t actual;
+    ASSERT_OK(table.GetOrInsert(value, &actual));
+    ASSERT_EQ(actual, static_cast<int32_t>(i));
+  }
+  ASSERT_EQ(table.size(), n_values);
+  // Spot-check lookups across the whole insertion range
+  for (int64_t i = 0; i < n_values; i += 4096) {
+    const std::string value = "value-" + std::to_string(i);
+    AssertGet(table, value, static_cast<int32_t>(i));
+  }
+}
+
 TEST(BinaryMemoTable, Empty) {
   BinaryMemoTable<BinaryBuilder> table(default_memory_pool());
   ASSERT_EQ(table.size(), 0);
@@ -1050,9 +1050,33 @@ static Result<int64_t> lseek64_compat(int fd, int64_t pos, int whence) {
   return ret;
 }
 
-Result<FileDescriptor> FileOpenReadable(const PlatformFilename& file_name) {
+#if !defined(_WIN32)
+// Disable OS caching on an open descriptor, for platforms without O_DIRECT
+Status FileDisableCaching(const FileDescriptor& fd, const PlatformFilename& file_name) {
+#  if defined(O_DIRECT)
+  // Already requested at open() time
+  ARROW_UNUSED(fd);
+  ARROW_UNUSED(file_name);
+  return Status::OK();
+#  elif defined(F_NOCACHE)
+  // macOS
+  if (fcntl(fd.fd(), F_NOCACHE, 1) == -1) {
+    return IOErrorFromErrno(errno, "Failed to disable caching on local file '",
+                            file_name.ToString(), "'");
+  }
+  return Status::OK();
+#  else
+  return Status::NotImplemented("Direct I/O is not supported on this platform");
+#  endif
+}
+#endif
+
+Result<FileDescriptor> FileOpenReadable(const PlatformFilename& file_name, bool direct) {
   FileDescriptor fd;
 #if defined(_WIN32)
+  if (direct) {
+    return Status::NotImplemented("Direct I/O is not supported on this platform");
+  }
   HANDLE file_handle = CreateFileW(file_name.ToNative().c_str(), GENERIC_READ,
                                    FILE_SHARE_READ | FILE_SHARE_WRITE, NULL,
                                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
@@ -1069,13 +1093,22 @@ Result<FileDescriptor> FileOpenReadable(const PlatformFilename& file_name) {
   }
   fd = FileDescriptor(ret);
 #else
-  int ret = open(file_name.ToNative().c_str(), O_RDONLY);
+  int oflag = O_RDONLY;
+#  if defined(O_DIRECT)
+  if (direct) {
+    oflag |= O_DIRECT;
+  }
+#  endif
+  int ret = open(file_name.ToNative().c_str(), oflag);
   if (ret < 0) {
     return IOErrorFromErrno(errno, "Failed to open local file '", file_name.ToString(),
                             "'");
   }
   // open(O_RDONLY) succeeds on directories, check for it
   fd = FileDescriptor(ret);
+  if (direct) {
+    RETURN_NOT_OK(FileDisableCaching(fd, file_name));
+  }
   struct stat st;
   ret = fstat(fd.fd(), &st);
   if (ret == 0 && S_ISDIR(st.st_mode)) {
@@ -1088,10 +1121,14 @@ Result<FileDescriptor> FileOpenReadable(const PlatformFilename& file_name) {
 }
 
 Result<FileDescriptor> FileOpenWritable(const PlatformFilename& file_name,
-                                        bool write_only, bool truncate, bool append) {
+                                        bool write_only, bool truncate, bool append,
+                                        bool direct) {
   FileDescriptor fd;
 
 #if defined(_WIN32)
+  if (direct) {
+    return Status::NotImplemented("Direct I/O is not supported on this platform");
+  }
   DWORD desired_access = GENERIC_WRITE;
   DWORD share_mode = FILE_SHARE_READ | FILE_SHARE_WRITE;
   DWORD creation_disposition = OPEN_ALWAYS;
@@ -1135,6 +1172,11 @@ Result<FileDescriptor> FileOpenWritable(const PlatformFilename& file_name,
   } else {
     oflag |= O_RDWR;
   }
+#  if defined(O_DIRECT)
+  if (direct) {
+    oflag |= O_DIRECT;
+  }
+#  endif
 
   int ret = open(file_name.ToNative().c_str(), oflag, 0666);
   if (ret == -1) {
@@ -1142,6 +1184,9 @@ Result<FileDescriptor> FileOpenWritable(const PlatformFilename& file_name,
                             "'");
   }
   fd = FileDescriptor(ret);
+  if (direct) {
+    RETURN_NOT_OK(FileDisableCaching(fd, file_name));
+  }
 #endif
 
   if (append) {
@@ -158,14 +158,21 @@ class ARROW_EXPORT FileDescriptor {
 };
 
 /// Open a file for reading and return a file descriptor.
+///
+/// If `direct` is true, the OS page cache is bypassed (O_DIRECT on Linux,
+/// F_NOCACHE on macOS); with O_DIRECT, file offsets, transfer lengths and
+/// buffer addresses must be aligned to the device block size.
 ARROW_EXPORT
-Result<FileDescriptor> FileOpenReadable(const PlatformFilename& file_name);
+Result<FileDescriptor> FileOpenReadable(const PlatformFilename& file_name,
+                                        bool direct = false);
 
 /// Open a file for writing and return a file descriptor.
+///
+/// See FileOpenReadable for the semantics of `direct`.
 ARROW_EXPORT
 Result<FileDescriptor> FileOpenWritable(const PlatformFilename& file_name,
                                         bool write_only = true, bool truncate = true,
-                                        bool append = false);
+                                        bool append = false, bool direct = false);
 
 /// Read from current file position.  Return number of bytes read.
 ARROW_EXPORT
@@ -0,0 +1,95 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/metrics.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace arrow {
+namespace util {
+namespace metrics {
+
+size_t Counter::ThreadShard() {
+  // A cheap per-thread shard index; consecutive threads land on different
+  // cachelines.  The address of a thread_local is stable for the thread's
+  // lifetime, so the shard assignment is too.
+  static thread_local char shard_anchor;
+  return (reinterpret_cast<uintptr_t>(&shard_anchor) >> 6) & (kNumShards - 1);
+}
+
+struct MetricsRegistry::Impl {
+  mutable std::mutex mutex;
+  std::unordered_map<std::string, std::unique_ptr<Counter>> counters;
+  std::unordered_map<std::string, std::unique_ptr<Histogram>> histograms;
+};
+
+MetricsRegistry::MetricsRegistry() : impl_(new Impl()) {}
+
+MetricsRegistry::~MetricsRegistry() = default;
+
+MetricsRegistry* MetricsRegistry::Default() {
+  static auto registry = new MetricsRegistry();
+  return registry;
+}
+
+Counter* MetricsRegistry::GetCounter(std::string_view name) {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  auto it = impl_->counters.find(std::string(name));
+  if (it == impl_->counters.end()) {
+    it = impl_->counters
+             .emplace(std::string(name), std::make_unique<Counter>(std::string(name)))
+             .first;
+  }
+  return it->second.get();
+}
+
+Histogram* MetricsRegistry::GetHistogram(std::string_view name) {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  auto it = impl_->histograms.find(std::string(name));
+  if (it == impl_->histograms.end()) {
+    it = impl_->histograms
+             .emplace(std::string(name), std::make_unique<Histogram>(std::string(name)))
+             .first;
+  }
+  return it->second.get();
+}
+
+MetricsSnapshot MetricsRegistry::Snapshot() const {
+  std::lock_guard<std::mutex> lock(impl_->mutex);
+  MetricsSnapshot snapshot;
+  snapshot.counters.reserve(impl_->counters.size());
+  for (const auto& [name, counter] : impl_->counters) {
+    snapshot.counters.push_back({name, counter->Total()});
+  }
+  snapshot.histograms.reserve(impl_->histograms.size());
+  for (const auto& [name, histogram] : impl_->histograms) {
+    HistogramSnapshot hist{name, 0, histogram->sum(), {}};
+    for (int i = 0; i < Histogram::kNumBuckets; ++i) {
+      hist.bucket_counts[i] = histogram->bucket_count(i);
+      hist.count += hist.bucket_counts[i];
+    }
+    snapshot.histograms.push_back(std::move(hist));
+  }
+  return snapshot;
+}
+
+}  // namespace metrics
+}  // namespace util
+}  // namespace arrow
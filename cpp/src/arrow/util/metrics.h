@@ -0,0 +1,238 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "arrow/util/bit_util.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace util {
+namespace metrics {
+
+/// Cheap, always-on counters and histograms for hot-path instrumentation.
+///
+/// Counter::Add is a single relaxed atomic add on a thread-sharded,
+/// cacheline-padded slot and costs a few nanoseconds even under contention;
+/// Histogram::Record adds a bucketed value the same way.  Metrics are
+/// created once through MetricsRegistry and are meant to be declared as
+/// function-local statics via the ARROW_METRIC_* macros below, so that the
+/// registry lookup happens only on first use.
+///
+/// The registry snapshot is the integration point for exporters: it can be
+/// polled periodically and converted to OpenTelemetry instruments (or any
+/// other metrics backend) outside the hot path.
+///
+/// Recording can be compiled out entirely by defining ARROW_DISABLE_METRICS.
+
+class ARROW_EXPORT Counter {
+ public:
+  explicit Counter(std::string name) : name_(std::move(name)) {}
+
+  void Add(int64_t value) {
+    shards_[ThreadShard()].value.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  int64_t Total() const {
+    int64_t total = 0;
+    for (const auto& shard : shards_) {
+      total += shard.value.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  const std::string& name() const { return name_; }
+
+ private:
+  // Power of two; bounds the worst-case cross-thread contention on one slot
+  static constexpr size_t kNumShards = 16;
+
+  struct alignas(64) Shard {
+    std::atomic<int64_t> value{0};
+  };
+
+  static size_t ThreadShard();
+
+  std::string name_;
+  std::array<Shard, kNumShards> shards_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(Counter);
+};
+
+class ARROW_EXPORT Histogram {
+ public:
+  // Bucket i counts values whose bit length is i, i.e. in
+  // [2^(i-1), 2^i); bucket 0 counts values <= 0.
+  static constexpr int kNumBuckets = 64;
+
+  explicit Histogram(std::string name) : name_(std::move(name)) {}
+
+  void Record(int64_t value) {
+    buckets_[BucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+  }
+
+  /// \brief The inclusive upper bound of the given bucket
+  static int64_t BucketUpperBound(int bucket) {
+    return (bucket == 0) ? 0 : static_cast<int64_t>((uint64_t{1} << bucket) - 1);
+  }
+
+  int64_t count() const {
+    int64_t total = 0;
+    for (const auto& bucket : buckets_) {
+      total += bucket.load(std::memory_order_relaxed);
+    }
+    return total;
+  }
+
+  int64_t sum() const { return sum_.load(std::memory_order_relaxed); }
+
+  int64_t bucket_count(int bucket) const {
+    return buckets_[bucket].load(std::memory_order_relaxed);
+  }
+
+  const std::string& name() const { return name_; }
+
+ private:
+  static int BucketIndex(int64_t value) {
+    if (value <= 0) {
+      return 0;
+    }
+    return 64 - ::arrow::bit_util::CountLeadingZeros(static_cast<uint64_t>(value));
+  }
+
+  std::string name_;
+  std::array<std::atomic<int64_t>, kNumBuckets> buckets_{};
+  std::atomic<int64_t> sum_{0};
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(Histogram);
+};
+
+/// \brief Records the elapsed wall time, in nanoseconds, into a histogram
+/// when it goes out of scope
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(Histogram* histogram)
+      : histogram_(histogram), start_(std::chrono::steady_clock::now()) {}
+
+  ~ScopedTimer() {
+    histogram_->Record(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - start_)
+                           .count());
+  }
+
+ private:
+  Histogram* histogram_;
+  std::chrono::steady_clock::time_point start_;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(ScopedTimer);
+};
+
+struct CounterSnapshot {
+  std::string name;
+  int64_t value;
+};
+
+struct HistogramSnapshot {
+  std::string name;
+  int64_t count;
+  int64_t sum;
+  std::array<int64_t, Histogram::kNumBuckets> bucket_counts;
+};
+
+struct MetricsSnapshot {
+  std::vector<CounterSnapshot> counters;
+  std::vector<HistogramSnapshot> histograms;
+};
+
+class ARROW_EXPORT MetricsRegistry {
+ public:
+  /// \brief The process-wide registry
+  static MetricsRegistry* Default();
+
+  /// \brief Return the counter with the given name, creating it if needed
+  ///
+  /// The returned pointer stays valid for the lifetime of the registry.
+  Counter* GetCounter(std::string_view name);
+
+  /// \brief Return the histogram with the given name, creating it if needed
+  ///
+  /// The returned pointer stays valid for the lifetime of the registry.
+  Histogram* GetHistogram(std::string_view name);
+
+  /// \brief Take a consistent-enough snapshot of all registered metrics
+  ///
+  /// Counter and histogram values are read with relaxed ordering; exporters
+  /// polling periodically should not expect an atomic cut across metrics.
+  MetricsSnapshot Snapshot() const;
+
+  MetricsRegistry();
+  ~MetricsRegistry();
+
+ private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace metrics
+}  // namespace util
+}  // namespace arrow
+
+#ifndef ARROW_DISABLE_METRICS
+
+#define ARROW_METRIC_COUNTER_ADD(name, value)                                     \
+  do {                                                                            \
+    static ::arrow::util::metrics::Counter* ARROW_CONCAT(_metric_, __LINE__) =    \
+        ::arrow::util::metrics::MetricsRegistry::Default()->GetCounter(name);     \
+    ARROW_CONCAT(_metric_, __LINE__)->Add(value);                                 \
+  } while (false)
+
+#define ARROW_METRIC_HISTOGRAM_RECORD(name, value)                                \
+  do {                                                                            \
+    static ::arrow::util::metrics::Histogram* ARROW_CONCAT(_metric_, __LINE__) =  \
+        ::arrow::util::metrics::MetricsRegistry::Default()->GetHistogram(name);   \
+    ARROW_CONCAT(_metric_, __LINE__)->Record(value);                              \
+  } while (false)
+
+// Times the rest of the enclosing scope into a nanosecond histogram
+#define ARROW_METRIC_SCOPED_TIMER(name)                                           \
+  static ::arrow::util::metrics::Histogram* ARROW_CONCAT(_metric_, __LINE__) =    \
+      ::arrow::util::metrics::MetricsRegistry::Default()->GetHistogram(name);     \
+  ::arrow::util::metrics::ScopedTimer ARROW_CONCAT(_metric_timer_, __LINE__)(     \
+      ARROW_CONCAT(_metric_, __LINE__))
+
+#else
+
+#define ARROW_METRIC_COUNTER_ADD(name, value) \
+  do {                                        \
+  } while (false)
+#define ARROW_METRIC_HISTOGRAM_RECORD(name, value) \
+  do {                                             \
+  } while (false)
+#define ARROW_METRIC_SCOPED_TIMER(name)
+
+#endif  // ARROW_DISABLE_METRICS
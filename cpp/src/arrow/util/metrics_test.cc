@@ -0,0 +1,123 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/util/metrics.h"
+
+namespace arrow {
+namespace util {
+namespace metrics {
+
+TEST(Counter, Basics) {
+  Counter counter("test.counter");
+  ASSERT_EQ(counter.Total(), 0);
+  counter.Add(1);
+  counter.Add(41);
+  ASSERT_EQ(counter.Total(), 42);
+  ASSERT_EQ(counter.name(), "test.counter");
+}
+
+TEST(Counter, Threaded) {
+  constexpr int kNumThreads = 8;
+  constexpr int kAddsPerThread = 10000;
+  Counter counter("test.counter");
+
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kNumThreads; ++i) {
+    threads.emplace_back([&]() {
+      for (int j = 0; j < kAddsPerThread; ++j) {
+        counter.Add(1);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(counter.Total(), kNumThreads * kAddsPerThread);
+}
+
+TEST(Histogram, Buckets) {
+  Histogram hist("test.histogram");
+  hist.Record(0);    // bucket 0
+  hist.Record(1);    // bucket 1
+  hist.Record(2);    // bucket 2
+  hist.Record(3);    // bucket 2
+  hist.Record(4);    // bucket 3
+  hist.Record(100);  // bucket 7
+
+  ASSERT_EQ(hist.count(), 6);
+  ASSERT_EQ(hist.sum(), 110);
+  ASSERT_EQ(hist.bucket_count(0), 1);
+  ASSERT_EQ(hist.bucket_count(1), 1);
+  ASSERT_EQ(hist.bucket_count(2), 2);
+  ASSERT_EQ(hist.bucket_count(3), 1);
+  ASSERT_EQ(hist.bucket_count(7), 1);
+
+  ASSERT_EQ(Histogram::BucketUpperBound(0), 0);
+  ASSERT_EQ(Histogram::BucketUpperBound(1), 1);
+  ASSERT_EQ(Histogram::BucketUpperBound(2), 3);
+  ASSERT_EQ(Histogram::BucketUpperBound(7), 127);
+}
+
+TEST(ScopedTimer, RecordsElapsedTime) {
+  Histogram hist("test.timer");
+  {
+    ScopedTimer timer(&hist);
+  }
+  ASSERT_EQ(hist.count(), 1);
+  ASSERT_GE(hist.sum(), 0);
+}
+
+TEST(MetricsRegistry, GetAndSnapshot) {
+  MetricsRegistry registry;
+  auto* counter = registry.GetCounter("requests");
+  ASSERT_EQ(counter, registry.GetCounter("requests"));
+  counter->Add(3);
+  registry.GetHistogram("latency")->Record(5);
+
+  auto snapshot = registry.Snapshot();
+  ASSERT_EQ(snapshot.counters.size(), 1);
+  ASSERT_EQ(snapshot.counters[0].name, "requests");
+  ASSERT_EQ(snapshot.counters[0].value, 3);
+  ASSERT_EQ(snapshot.histograms.size(), 1);
+  ASSERT_EQ(snapshot.histograms[0].name, "latency");
+  ASSERT_EQ(snapshot.histograms[0].count, 1);
+  ASSERT_EQ(snapshot.histograms[0].sum, 5);
+}
+
+TEST(MetricsRegistry, Macros) {
+  // The macros record into the process-wide default registry
+  ARROW_METRIC_COUNTER_ADD("test.macro_counter", 2);
+  ARROW_METRIC_HISTOGRAM_RECORD("test.macro_histogram", 7);
+  {
+    ARROW_METRIC_SCOPED_TIMER("test.macro_timer");
+  }
+
+  auto* registry = MetricsRegistry::Default();
+  ASSERT_GE(registry->GetCounter("test.macro_counter")->Total(), 2);
+  ASSERT_GE(registry->GetHistogram("test.macro_histogram")->count(), 1);
+  ASSERT_GE(registry->GetHistogram("test.macro_timer")->count(), 1);
+}
+
+}  // namespace metrics
+}  // namespace util
+}  // namespace arrow
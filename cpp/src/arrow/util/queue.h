@@ -17,6 +17,15 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+#include "arrow/util/macros.h"
 #include "arrow/vendored/ProducerConsumerQueue.h"
 
 namespace arrow {
@@ -25,5 +34,173 @@ namespace util {
 template <typename T>
 using SpscQueue = arrow_vendored::folly::ProducerConsumerQueue<T>;
 
-}
+/// \brief A bounded lock-free multi-producer multi-consumer queue
+///
+/// Based on Dmitry Vyukov's bounded MPMC queue: each slot carries a sequence
+/// counter that producers and consumers use to claim it with a single
+/// compare-and-swap, so uncontended pushes and pops never take a lock and
+/// handoff latency does not suffer from mutex convoying.
+///
+/// TryPush() and TryPop() never block.  The blocking variants Push() and
+/// WaitAndPop() spin briefly and then park the thread on a condition
+/// variable; the condvar is only touched on the empty/full slow path, so the
+/// common case stays lock-free.
+///
+/// The capacity is rounded up to a power of two (minimum 2).
+template <typename T>
+class MpmcQueue {
+ public:
+  explicit MpmcQueue(uint32_t capacity) {
+    uint64_t size = 2;
+    while (size < capacity) {
+      size *= 2;
+    }
+    mask_ = size - 1;
+    cells_.reset(new Cell[size]);
+    for (uint64_t i = 0; i < size; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(MpmcQueue);
+
+  uint64_t capacity() const { return mask_ + 1; }
+
+  /// \brief Return an estimate of the number of queued items
+  ///
+  /// Only a point-in-time approximation when other threads are active.
+  uint64_t SizeGuess() const {
+    uint64_t tail = tail_.load(std::memory_order_relaxed);
+    uint64_t head = head_.load(std::memory_order_relaxed);
+    return (tail > head) ? tail - head : 0;
+  }
+
+  /// \brief Attempt to push an item without blocking
+  ///
+  /// Returns false if the queue is full; `item` is left untouched in that
+  /// case.
+  bool TryPush(T& item) {
+    Cell* cell;
+    uint64_t pos = tail_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      const uint64_t seq = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+      if (diff == 0) {
+        if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        // The slot still holds an unconsumed item => full
+        return false;
+      } else {
+        pos = tail_.load(std::memory_order_relaxed);
+      }
+    }
+    cell->storage.emplace(std::move(item));
+    cell->sequence.store(pos + 1, std::memory_order_release);
+    // Pairs with the fence in WaitAndPop(): either this load sees the
+    // consumer's registration, or the consumer's retry sees the new item
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_consumers_.load(std::memory_order_relaxed) > 0) {
+      // Lock before notifying so the wakeup cannot slip in between a
+      // consumer's failed TryPop() and its wait()
+      std::lock_guard<std::mutex> lock(mutex_);
+      not_empty_.notify_one();
+    }
+    return true;
+  }
+
+  bool TryPush(T&& item) { return TryPush(item); }
+
+  /// \brief Attempt to pop an item without blocking
+  ///
+  /// Returns nullopt if the queue is empty.
+  std::optional<T> TryPop() {
+    Cell* cell;
+    uint64_t pos = head_.load(std::memory_order_relaxed);
+    for (;;) {
+      cell = &cells_[pos & mask_];
+      const uint64_t seq = cell->sequence.load(std::memory_order_acquire);
+      const auto diff = static_cast<int64_t>(seq) - static_cast<int64_t>(pos + 1);
+      if (diff == 0) {
+        if (head_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return std::nullopt;
+      } else {
+        pos = head_.load(std::memory_order_relaxed);
+      }
+    }
+    T item = std::move(*cell->storage);
+    cell->storage.reset();
+    cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (waiting_producers_.load(std::memory_order_relaxed) > 0) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      not_full_.notify_one();
+    }
+    return item;
+  }
+
+  /// \brief Push an item, blocking while the queue is full
+  void Push(T item) {
+    for (int i = 0; i < kSpinsBeforeSleep; ++i) {
+      if (TryPush(item)) {
+        return;
+      }
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiting_producers_++;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    while (!TryPush(item)) {
+      not_full_.wait(lock);
+    }
+    waiting_producers_--;
+  }
+
+  /// \brief Pop an item, blocking while the queue is empty
+  T WaitAndPop() {
+    for (int i = 0; i < kSpinsBeforeSleep; ++i) {
+      if (auto item = TryPop()) {
+        return std::move(*item);
+      }
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    waiting_consumers_++;
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    for (;;) {
+      if (auto item = TryPop()) {
+        waiting_consumers_--;
+        return std::move(*item);
+      }
+      not_empty_.wait(lock);
+    }
+  }
+
+ private:
+  static constexpr int kSpinsBeforeSleep = 100;
+
+  struct alignas(64) Cell {
+    std::atomic<uint64_t> sequence{0};
+    std::optional<T> storage;
+  };
+
+  std::unique_ptr<Cell[]> cells_;
+  uint64_t mask_;
+  alignas(64) std::atomic<uint64_t> tail_{0};
+  alignas(64) std::atomic<uint64_t> head_{0};
+
+  // Slow path: used only when blocking on an empty or full queue.
+  // The waiter increments its counter before re-attempting the operation and
+  // the waker locks the mutex before notifying, so wakeups cannot be lost.
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::atomic<int> waiting_producers_{0};
+  std::atomic<int> waiting_consumers_{0};
+};
+
+}  // namespace util
 }  // namespace arrow
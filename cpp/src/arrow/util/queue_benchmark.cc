@@ -16,7 +16,10 @@
 // under the License.
 
 #include <algorithm>
+#include <condition_variable>
 #include <iterator>
+#include <mutex>
+#include <queue>
 #include <thread>
 #include <vector>
 
@@ -81,5 +84,80 @@ void SpscQueueThroughput(benchmark::State& state) {
 
 BENCHMARK(SpscQueueThroughput)->UseRealTime();
 
+// Simple mutex+condvar bounded queue, mirroring the concurrent queues this
+// benchmark compares MpmcQueue against
+template <typename T>
+class MutexQueue {
+ public:
+  explicit MutexQueue(size_t capacity) : capacity_(capacity) {}
+
+  void Push(T item) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_full_.wait(lock, [&] { return queue_.size() < capacity_; });
+    queue_.push(std::move(item));
+    not_empty_.notify_one();
+  }
+
+  T WaitAndPop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [&] { return !queue_.empty(); });
+    T item = std::move(queue_.front());
+    queue_.pop();
+    not_full_.notify_one();
+    return item;
+  }
+
+ private:
+  const size_t capacity_;
+  std::mutex mutex_;
+  std::condition_variable not_empty_;
+  std::condition_variable not_full_;
+  std::queue<T> queue_;
+};
+
+template <typename Queue>
+void QueueThroughput(benchmark::State& state, Queue& queue) {
+  const auto num_threads = static_cast<int>(state.range(0));
+  const int64_t items_per_thread = kSize / num_threads;
+  const uint8_t data[1] = {0};
+  auto buffer = std::make_shared<Buffer>(data, 1);
+
+  for (auto _ : state) {
+    std::vector<std::thread> threads;
+    for (int i = 0; i < num_threads; i++) {
+      threads.emplace_back([&] {
+        for (int64_t j = 0; j < items_per_thread; j++) {
+          queue.Push(buffer);
+        }
+      });
+    }
+    for (int i = 0; i < num_threads; i++) {
+      threads.emplace_back([&] {
+        for (int64_t j = 0; j < items_per_thread; j++) {
+          auto item = queue.WaitAndPop();
+          benchmark::DoNotOptimize(item);
+        }
+      });
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * items_per_thread * num_threads);
+}
+
+void MpmcQueueThroughput(benchmark::State& state) {
+  MpmcQueue<std::shared_ptr<Buffer>> queue(16);
+  QueueThroughput(state, queue);
+}
+
+void MutexQueueThroughput(benchmark::State& state) {
+  MutexQueue<std::shared_ptr<Buffer>> queue(16);
+  QueueThroughput(state, queue);
+}
+
+BENCHMARK(MpmcQueueThroughput)->Arg(1)->Arg(4)->UseRealTime();
+BENCHMARK(MutexQueueThroughput)->Arg(1)->Arg(4)->UseRealTime();
+
 }  // namespace util
 }  // namespace arrow
@@ -15,6 +15,11 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <atomic>
+#include <optional>
+#include <thread>
+#include <vector>
+
 #include <gtest/gtest.h>
 
 #include "arrow/testing/gtest_util.h"
@@ -51,5 +56,85 @@ TEST(TestSpscQueue, TestMoveOnly) {
   ASSERT_EQ(queue.SizeGuess(), 0);
 }
 
+TEST(TestMpmcQueue, TestMoveOnly) {
+  MpmcQueue<MoveOnlyDataType> queue(3);
+  ASSERT_EQ(queue.capacity(), 4);
+  ASSERT_EQ(queue.SizeGuess(), 0);
+  ASSERT_FALSE(queue.TryPop().has_value());
+
+  ASSERT_TRUE(queue.TryPush(MoveOnlyDataType(1)));
+  ASSERT_TRUE(queue.TryPush(MoveOnlyDataType(2)));
+  ASSERT_TRUE(queue.TryPush(MoveOnlyDataType(3)));
+  ASSERT_TRUE(queue.TryPush(MoveOnlyDataType(4)));
+  ASSERT_EQ(queue.SizeGuess(), 4);
+
+  // Full: the rejected item is left untouched
+  MoveOnlyDataType rejected(5);
+  ASSERT_FALSE(queue.TryPush(rejected));
+  ASSERT_EQ(*rejected.data, 5);
+
+  // FIFO order
+  for (int i = 1; i <= 4; ++i) {
+    auto out = queue.TryPop();
+    ASSERT_TRUE(out.has_value());
+    ASSERT_EQ(*out->data, i);
+  }
+  ASSERT_FALSE(queue.TryPop().has_value());
+  ASSERT_EQ(queue.SizeGuess(), 0);
+}
+
+TEST(TestMpmcQueue, TestBlocking) {
+  MpmcQueue<int> queue(2);
+  // Fill the queue, then have a producer block on a full queue
+  queue.Push(1);
+  queue.Push(2);
+  std::thread producer([&] { queue.Push(3); });
+  ASSERT_EQ(queue.WaitAndPop(), 1);
+  ASSERT_EQ(queue.WaitAndPop(), 2);
+  ASSERT_EQ(queue.WaitAndPop(), 3);
+  producer.join();
+
+  // Consumer blocks on an empty queue until an item arrives
+  std::thread consumer([&] { ASSERT_EQ(queue.WaitAndPop(), 4); });
+  SleepABit();
+  queue.Push(4);
+  consumer.join();
+}
+
+TEST(TestMpmcQueue, TestThreadedStress) {
+  constexpr int kNumProducers = 4;
+  constexpr int kNumConsumers = 4;
+  constexpr int kItemsPerProducer = 10000;
+
+  MpmcQueue<int> queue(8);
+  std::atomic<int64_t> total{0};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kNumProducers; ++p) {
+    threads.emplace_back([&] {
+      for (int i = 1; i <= kItemsPerProducer; ++i) {
+        queue.Push(i);
+      }
+    });
+  }
+  for (int c = 0; c < kNumConsumers; ++c) {
+    threads.emplace_back([&] {
+      constexpr int kItemsPerConsumer = kItemsPerProducer * kNumProducers / kNumConsumers;
+      int64_t sum = 0;
+      for (int i = 0; i < kItemsPerConsumer; ++i) {
+        sum += queue.WaitAndPop();
+      }
+      total += sum;
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  constexpr int64_t kExpected =
+      kNumProducers * static_cast<int64_t>(kItemsPerProducer) * (kItemsPerProducer + 1) /
+      2;
+  ASSERT_EQ(total.load(), kExpected);
+  ASSERT_FALSE(queue.TryPop().has_value());
+}
+
 }  // namespace util
 }  // namespace arrow
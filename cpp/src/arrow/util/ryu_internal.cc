@@ -0,0 +1,367 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/ryu_internal.h"
+
+#include <cassert>
+#include <vector>
+
+#include "arrow/util/int128_internal.h"
+#include "arrow/util/ubsan.h"
+
+namespace arrow {
+namespace internal {
+namespace {
+
+// Integer approximations of logarithms, valid on the exponent ranges
+// reachable from IEEE 754 binary32 and binary64 inputs.
+
+// Number of bits in 5^e, i.e. ceil(log2(5^e)) (e in [0, 3528])
+inline int32_t Pow5Bits(int32_t e) { return ((e * 1217359) >> 19) + 1; }
+
+// floor(log10(2^e)) (e in [1, 1650])
+inline uint32_t Log10Pow2(int32_t e) { return (static_cast<uint32_t>(e) * 78913) >> 18; }
+
+// floor(log10(5^e)) (e in [1, 2620])
+inline uint32_t Log10Pow5(int32_t e) { return (static_cast<uint32_t>(e) * 732923) >> 20; }
+
+// The Ryu multipliers: 125-bit truncations of 5^i (rounded down) and of
+// 1/5^q (rounded up), each stored as {low 64 bits, high 61 bits}.
+constexpr int kPow5BitCount = 125;
+constexpr int kPow5InvBitCount = 125;
+constexpr int kNumPow5 = 326;     // enough for the smallest double subnormal
+constexpr int kNumPow5Inv = 292;  // enough for the largest double
+
+// The tables are computed once at runtime with exact bignum arithmetic
+// (about 10 KiB and well under a millisecond), rather than spelling out
+// more than 600 128-bit constants in the source.
+struct RyuTables {
+  uint64_t pow5[kNumPow5][2];
+  uint64_t pow5_inv[kNumPow5Inv][2];
+
+  RyuTables() {
+    // `limbs` holds the exact value of 5^i, least significant limb first
+    std::vector<uint64_t> limbs = {1};
+    int32_t bit_length = 1;
+    for (int32_t i = 0; i < kNumPow5; ++i) {
+      // pow5[i] = floor(5^i / 2^(Pow5Bits(i) - 125)): the 125 top bits,
+      // zero-extended for the small powers.
+      const uint128_t top = ExtractShifted(limbs, bit_length - kPow5BitCount);
+      pow5[i][0] = static_cast<uint64_t>(top);
+      pow5[i][1] = static_cast<uint64_t>(top >> 64);
+
+      if (i < kNumPow5Inv) {
+        // pow5_inv[i] = floor(2^(Pow5Bits(i) - 1 + 125) / 5^i) + 1
+        const uint128_t inv = DividePowerOf2(bit_length - 1 + kPow5InvBitCount, limbs);
+        pow5_inv[i][0] = static_cast<uint64_t>(inv);
+        pow5_inv[i][1] = static_cast<uint64_t>(inv >> 64);
+      }
+
+      // Advance to 5^(i+1)
+      uint64_t carry = 0;
+      for (auto& limb : limbs) {
+        const uint128_t product = uint128_t(limb) * 5 + carry;
+        limb = static_cast<uint64_t>(product);
+        carry = static_cast<uint64_t>(product >> 64);
+      }
+      if (carry != 0) {
+        limbs.push_back(carry);
+      }
+      bit_length = BitLength(limbs);
+    }
+  }
+
+ private:
+  static int32_t BitLength(const std::vector<uint64_t>& limbs) {
+    uint64_t top = limbs.back();
+    int32_t bits = static_cast<int32_t>(64 * (limbs.size() - 1));
+    while (top != 0) {
+      top >>= 1;
+      ++bits;
+    }
+    return bits;
+  }
+
+  // Return floor(value / 2^shift); shift may be negative (a left shift).
+  // The result must fit in 128 bits.
+  static uint128_t ExtractShifted(const std::vector<uint64_t>& limbs, int32_t shift) {
+    if (shift < 0) {
+      // The value has fewer than 125 bits, hence at most two limbs
+      assert(limbs.size() <= 2);
+      const uint128_t value =
+          (uint128_t(limbs.size() > 1 ? limbs[1] : 0) << 64) | limbs[0];
+      return value << -shift;
+    }
+    const auto limb_at = [&](size_t index) -> uint64_t {
+      return index < limbs.size() ? limbs[index] : 0;
+    };
+    const size_t first = shift / 64;
+    const int32_t offset = shift % 64;
+    uint64_t lo, hi;
+    if (offset == 0) {
+      lo = limb_at(first);
+      hi = limb_at(first + 1);
+    } else {
+      lo = (limb_at(first) >> offset) | (limb_at(first + 1) << (64 - offset));
+      hi = (limb_at(first + 1) >> offset) | (limb_at(first + 2) << (64 - offset));
+    }
+    return (uint128_t(hi) << 64) | lo;
+  }
+
+  // Return floor(2^exponent / divisor) + 1 by restoring binary long division.
+  // The result must fit in 128 bits.
+  static uint128_t DividePowerOf2(int32_t exponent, const std::vector<uint64_t>& divisor) {
+    if (divisor.size() == 1 && divisor[0] == 1) {
+      return (uint128_t(1) << exponent) + 1;
+    }
+    std::vector<uint64_t> remainder(divisor.size() + 1, 0);
+    remainder[0] = 1;
+    uint128_t quotient = 0;
+    for (int32_t step = 0; step < exponent; ++step) {
+      // remainder <<= 1
+      uint64_t carry = 0;
+      for (auto& limb : remainder) {
+        const uint64_t next_carry = limb >> 63;
+        limb = (limb << 1) | carry;
+        carry = next_carry;
+      }
+      // if (remainder >= divisor) { remainder -= divisor; bit = 1; }
+      bool greater_equal = true;
+      for (size_t j = remainder.size(); j-- > 0;) {
+        const uint64_t other = j < divisor.size() ? divisor[j] : 0;
+        if (remainder[j] != other) {
+          greater_equal = remainder[j] > other;
+          break;
+        }
+      }
+      if (greater_equal) {
+        uint64_t borrow = 0;
+        for (size_t j = 0; j < remainder.size(); ++j) {
+          const uint64_t other = j < divisor.size() ? divisor[j] : 0;
+          const uint64_t diff = remainder[j] - other;
+          const uint64_t diff2 = diff - borrow;
+          borrow = (remainder[j] < other) | (diff < borrow);
+          remainder[j] = diff2;
+        }
+      }
+      quotient = (quotient << 1) | (greater_equal ? 1 : 0);
+    }
+    return quotient + 1;
+  }
+};
+
+const RyuTables& GetRyuTables() {
+  static RyuTables tables;
+  return tables;
+}
+
+// Compute floor((m * mul) / 2^j) where mul is a 125-bit multiplier
+// and j is in [64, 128)
+inline uint64_t MulShift64(uint64_t m, const uint64_t* mul, int32_t j) {
+  const uint128_t low = uint128_t(m) * mul[0];
+  const uint128_t high = uint128_t(m) * mul[1];
+  return static_cast<uint64_t>(((low >> 64) + high) >> (j - 64));
+}
+
+struct Bounds {
+  uint64_t vr;  // the value itself
+  uint64_t vp;  // upper bound of the rounding interval
+  uint64_t vm;  // lower bound of the rounding interval
+};
+
+inline Bounds MulShiftAll64(uint64_t m2, const uint64_t* mul, int32_t j,
+                            uint32_t mm_shift) {
+  Bounds bounds;
+  bounds.vp = MulShift64(4 * m2 + 2, mul, j);
+  bounds.vm = MulShift64(4 * m2 - 1 - mm_shift, mul, j);
+  bounds.vr = MulShift64(4 * m2, mul, j);
+  return bounds;
+}
+
+inline bool MultipleOfPowerOf5(uint64_t value, uint32_t p) {
+  uint32_t count = 0;
+  while (value % 5 == 0) {
+    value /= 5;
+    ++count;
+  }
+  return count >= p;
+}
+
+inline bool MultipleOfPowerOf2(uint64_t value, uint32_t p) {
+  return (value & ((uint64_t{1} << p) - 1)) == 0;
+}
+
+// The core of Ryu: given the value m2 * 2^e2 and its rounding interval,
+// compute the shortest decimal in the interval.  Works for any mantissa
+// up to 53 bits, so the float path reuses it with the double tables.
+ShortestDecimal ShortestFromBinary(uint64_t m2, int32_t e2, bool accept_bounds,
+                                   uint32_t mm_shift) {
+  const RyuTables& tables = GetRyuTables();
+  const uint64_t mv = 4 * m2;
+  bool vm_trailing_zeros = false;
+  bool vr_trailing_zeros = false;
+  int32_t e10;
+  Bounds bounds;
+
+  if (e2 >= 0) {
+    const uint32_t q = Log10Pow2(e2) - (e2 > 3);
+    e10 = static_cast<int32_t>(q);
+    const int32_t k = kPow5InvBitCount + Pow5Bits(static_cast<int32_t>(q)) - 1;
+    const int32_t j = -e2 + static_cast<int32_t>(q) + k;
+    bounds = MulShiftAll64(m2, tables.pow5_inv[q], j, mm_shift);
+    if (q <= 21) {
+      // Only one of mp, mv and mm can be a multiple of 5, if any
+      if (mv % 5 == 0) {
+        vr_trailing_zeros = MultipleOfPowerOf5(mv, q);
+      } else if (accept_bounds) {
+        vm_trailing_zeros = MultipleOfPowerOf5(mv - 1 - mm_shift, q);
+      } else {
+        bounds.vp -= MultipleOfPowerOf5(mv + 2, q);
+      }
+    }
+  } else {
+    const uint32_t q = Log10Pow5(-e2) - (-e2 > 1);
+    e10 = static_cast<int32_t>(q) + e2;
+    const int32_t i = -e2 - static_cast<int32_t>(q);
+    const int32_t k = Pow5Bits(i) - kPow5BitCount;
+    const int32_t j = static_cast<int32_t>(q) - k;
+    bounds = MulShiftAll64(m2, tables.pow5[i], j, mm_shift);
+    if (q <= 1) {
+      // {vr, vp, vm} are trailing-zero-exact when q is this small
+      vr_trailing_zeros = true;
+      if (accept_bounds) {
+        vm_trailing_zeros = mm_shift == 1;
+      } else {
+        --bounds.vp;
+      }
+    } else if (q < 63) {
+      vr_trailing_zeros = MultipleOfPowerOf2(mv, q);
+    }
+  }
+
+  int32_t removed = 0;
+  uint8_t last_removed_digit = 0;
+  uint64_t output;
+  if (vm_trailing_zeros || vr_trailing_zeros) {
+    // General case, which happens rarely (~0.7%)
+    for (;;) {
+      const uint64_t vp_div10 = bounds.vp / 10;
+      const uint64_t vm_div10 = bounds.vm / 10;
+      if (vp_div10 <= vm_div10) {
+        break;
+      }
+      vm_trailing_zeros &= bounds.vm % 10 == 0;
+      vr_trailing_zeros &= last_removed_digit == 0;
+      last_removed_digit = static_cast<uint8_t>(bounds.vr % 10);
+      bounds.vr /= 10;
+      bounds.vp = vp_div10;
+      bounds.vm = vm_div10;
+      ++removed;
+    }
+    if (vm_trailing_zeros) {
+      while (bounds.vm % 10 == 0) {
+        vr_trailing_zeros &= last_removed_digit == 0;
+        last_removed_digit = static_cast<uint8_t>(bounds.vr % 10);
+        bounds.vr /= 10;
+        bounds.vp /= 10;
+        bounds.vm /= 10;
+        ++removed;
+      }
+    }
+    if (vr_trailing_zeros && last_removed_digit == 5 && bounds.vr % 2 == 0) {
+      // Round even if the exact value is .....50..0
+      last_removed_digit = 4;
+    }
+    output = bounds.vr + ((bounds.vr == bounds.vm &&
+                           (!accept_bounds || !vm_trailing_zeros)) ||
+                          last_removed_digit >= 5);
+  } else {
+    // Common case: no trailing zeros to track
+    bool round_up = false;
+    const uint64_t vp_div100 = bounds.vp / 100;
+    const uint64_t vm_div100 = bounds.vm / 100;
+    if (vp_div100 > vm_div100) {
+      round_up = bounds.vr % 100 >= 50;
+      bounds.vr /= 100;
+      bounds.vp = vp_div100;
+      bounds.vm = vm_div100;
+      removed += 2;
+    }
+    for (;;) {
+      const uint64_t vp_div10 = bounds.vp / 10;
+      const uint64_t vm_div10 = bounds.vm / 10;
+      if (vp_div10 <= vm_div10) {
+        break;
+      }
+      round_up = bounds.vr % 10 >= 5;
+      bounds.vr /= 10;
+      bounds.vp = vp_div10;
+      bounds.vm = vm_div10;
+      ++removed;
+    }
+    output = bounds.vr + (bounds.vr == bounds.vm || round_up);
+  }
+  return {output, e10 + removed};
+}
+
+}  // namespace
+
+ShortestDecimal DoubleToShortestDecimal(double value) {
+  constexpr int kMantissaBits = 52;
+  constexpr int kExponentBias = 1023;
+  const uint64_t bits = util::SafeCopy<uint64_t>(value);
+  const uint64_t ieee_mantissa = bits & ((uint64_t{1} << kMantissaBits) - 1);
+  const uint32_t ieee_exponent = static_cast<uint32_t>(bits >> kMantissaBits) & 0x7FF;
+  assert(ieee_exponent != 0x7FF && (ieee_exponent != 0 || ieee_mantissa != 0));
+
+  uint64_t m2;
+  int32_t e2;
+  if (ieee_exponent == 0) {
+    e2 = 1 - kExponentBias - kMantissaBits - 2;
+    m2 = ieee_mantissa;
+  } else {
+    e2 = static_cast<int32_t>(ieee_exponent) - kExponentBias - kMantissaBits - 2;
+    m2 = (uint64_t{1} << kMantissaBits) | ieee_mantissa;
+  }
+  // The interval is symmetric except just above a power-of-two mantissa
+  const uint32_t mm_shift = (ieee_mantissa != 0 || ieee_exponent <= 1) ? 1 : 0;
+  return ShortestFromBinary(m2, e2, /*accept_bounds=*/(m2 & 1) == 0, mm_shift);
+}
+
+ShortestDecimal FloatToShortestDecimal(float value) {
+  constexpr int kMantissaBits = 23;
+  constexpr int kExponentBias = 127;
+  const uint32_t bits = util::SafeCopy<uint32_t>(value);
+  const uint32_t ieee_mantissa = bits & ((uint32_t{1} << kMantissaBits) - 1);
+  const uint32_t ieee_exponent = (bits >> kMantissaBits) & 0xFF;
+  assert(ieee_exponent != 0xFF && (ieee_exponent != 0 || ieee_mantissa != 0));
+
+  uint64_t m2;
+  int32_t e2;
+  if (ieee_exponent == 0) {
+    e2 = 1 - kExponentBias - kMantissaBits - 2;
+    m2 = ieee_mantissa;
+  } else {
+    e2 = static_cast<int32_t>(ieee_exponent) - kExponentBias - kMantissaBits - 2;
+    m2 = (uint64_t{1} << kMantissaBits) | ieee_mantissa;
+  }
+  const uint32_t mm_shift = (ieee_mantissa != 0 || ieee_exponent <= 1) ? 1 : 0;
+  return ShortestFromBinary(m2, e2, /*accept_bounds=*/(m2 & 1) == 0, mm_shift);
+}
+
+}  // namespace internal
+}  // namespace arrow
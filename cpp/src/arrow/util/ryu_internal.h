@@ -0,0 +1,52 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Private header, not to be exported
+
+#pragma once
+
+#include <cstdint>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+/// \brief The shortest round-tripping decimal representation of a
+/// floating point number, as computed by the Ryu algorithm
+/// (Ulf Adams, "Ryu: fast float-to-string conversion", PLDI 2018).
+///
+/// The represented value is `digits * 10^exponent`.  `digits` is the
+/// shortest decimal significand that converts back to the original binary
+/// value under round-to-nearest-even, and carries no trailing zeros.
+/// The digit strings are identical to those produced by the (much slower)
+/// shortest-output mode of the vendored double-conversion library.
+struct ShortestDecimal {
+  uint64_t digits;
+  int32_t exponent;
+};
+
+/// Compute the shortest decimal representation of a double.
+/// The value must be finite and non-zero; the sign is ignored.
+ARROW_EXPORT ShortestDecimal DoubleToShortestDecimal(double value);
+
+/// Compute the shortest decimal representation of a float.
+/// The value must be finite and non-zero; the sign is ignored.
+ARROW_EXPORT ShortestDecimal FloatToShortestDecimal(float value);
+
+}  // namespace internal
+}  // namespace arrow
@@ -341,6 +341,50 @@ class TDigest::TDigestImpl {
 
   double total_weight() const { return total_weight_; }
 
+  uint32_t delta() const { return delta_; }
+
+  // append min, max, total weight and the centroid (mean, weight) pairs
+  void Serialize(std::vector<double>* out) const {
+    const auto& td = tdigests_[current_];
+    out->push_back(min_);
+    out->push_back(max_);
+    out->push_back(total_weight_);
+    for (const auto& centroid : td) {
+      out->push_back(centroid.mean);
+      out->push_back(centroid.weight);
+    }
+  }
+
+  // restore state captured by Serialize(), validating the centroid invariants
+  Status SetState(double min, double max, double total_weight,
+                  const double* centroids, int64_t num_centroids) {
+    Reset();
+    if (num_centroids > static_cast<int64_t>(delta_)) {
+      return Status::Invalid("serialized tdigest holds more centroids than delta");
+    }
+    auto& td = tdigests_[current_];
+    double prev_mean = std::numeric_limits<double>::lowest();
+    for (int64_t i = 0; i < num_centroids; ++i) {
+      const double mean = centroids[2 * i];
+      const double weight = centroids[2 * i + 1];
+      if (std::isnan(mean) || std::isnan(weight) || weight < 1 || mean < prev_mean) {
+        return Status::Invalid("serialized tdigest centroids are invalid");
+      }
+      td.push_back(Centroid{mean, weight});
+      prev_mean = mean;
+    }
+    if (num_centroids > 0) {
+      if (std::isnan(min) || std::isnan(max) || min > td.front().mean ||
+          max < td.back().mean) {
+        return Status::Invalid("serialized tdigest min/max are invalid");
+      }
+      min_ = min;
+      max_ = max;
+      total_weight_ = total_weight;
+    }
+    return Status::OK();
+  }
+
  private:
   // must be declared before merger_, see constructor initialization list
   const uint32_t delta_;
@@ -407,6 +451,38 @@ double TDigest::Mean() const {
   return impl_->Mean();
 }
 
+std::vector<double> TDigest::Serialize() const {
+  MergeInput();
+  std::vector<double> out;
+  out.reserve(5);
+  out.push_back(static_cast<double>(impl_->delta()));
+  out.push_back(static_cast<double>(input_.capacity()));
+  impl_->Serialize(&out);
+  return out;
+}
+
+Result<TDigest> TDigest::Deserialize(const double* values, int64_t num_values) {
+  if (values == nullptr || num_values < 5 || (num_values - 5) % 2 != 0) {
+    return Status::Invalid("serialized tdigest has invalid size");
+  }
+  const double delta = values[0];
+  const double buffer_size = values[1];
+  constexpr double kMaxDelta = 1 << 20;
+  constexpr double kMaxBufferSize = 1 << 24;
+  if (!(delta >= 1 && delta <= kMaxDelta) ||
+      !(buffer_size >= 0 && buffer_size <= kMaxBufferSize)) {
+    return Status::Invalid("serialized tdigest parameters are out of range");
+  }
+  TDigest digest(static_cast<uint32_t>(delta), static_cast<uint32_t>(buffer_size));
+  RETURN_NOT_OK(digest.impl_->SetState(values[2], values[3], values[4], values + 5,
+                                       (num_values - 5) / 2));
+  return digest;
+}
+
+double TDigest::total_weight() const {
+  return impl_->total_weight() + static_cast<double>(input_.size());
+}
+
 bool TDigest::is_empty() const {
   return input_.size() == 0 && impl_->total_weight() == 0;
 }
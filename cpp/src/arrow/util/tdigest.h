@@ -26,6 +26,7 @@
 #include <memory>
 #include <vector>
 
+#include "arrow/result.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
@@ -78,6 +79,19 @@ class ARROW_EXPORT TDigest {
   void Merge(const std::vector<TDigest>& others);
   void Merge(const TDigest& other);
 
+  // export the digest state as a flat vector of doubles so it can be stored
+  // or shipped across processes and later reconstructed with Deserialize():
+  // delta, buffer size, min, max, total weight, then (mean, weight) per
+  // centroid; buffered inputs are folded in first
+  std::vector<double> Serialize() const;
+
+  // reconstruct a digest previously exported with Serialize()
+  static Result<TDigest> Deserialize(const double* values, int64_t num_values);
+
+  // total weight (number of data points) absorbed into the digest,
+  // including any still buffered
+  double total_weight() const;
+
   // calculate quantile
   double Quantile(double q) const;
 
@@ -287,5 +287,39 @@ TEST(TDigestTest, Misc) {
   }
 }
 
+TEST(TDigestTest, SerializeRoundTrip) {
+  TDigest td(100);
+  for (int i = 0; i < 10000; ++i) {
+    td.Add(i);
+  }
+  ASSERT_OK(td.Validate());
+
+  const std::vector<double> serialized = td.Serialize();
+  ASSERT_OK_AND_ASSIGN(
+      TDigest restored,
+      TDigest::Deserialize(serialized.data(), static_cast<int64_t>(serialized.size())));
+  ASSERT_OK(restored.Validate());
+  ASSERT_EQ(restored.total_weight(), td.total_weight());
+  for (double q : {0.0, 0.01, 0.25, 0.5, 0.75, 0.99, 1.0}) {
+    ASSERT_EQ(restored.Quantile(q), td.Quantile(q));
+  }
+
+  // A restored digest keeps absorbing data and merging
+  TDigest other(100);
+  for (int i = 10000; i < 20000; ++i) {
+    other.Add(i);
+  }
+  restored.Merge(other);
+  ASSERT_OK(restored.Validate());
+  ASSERT_EQ(restored.total_weight(), 20000);
+
+  // Malformed input is rejected
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(serialized.data(), 4));
+  std::vector<double> garbage(serialized);
+  garbage[5] = std::numeric_limits<double>::quiet_NaN();
+  ASSERT_RAISES(Invalid,
+                TDigest::Deserialize(garbage.data(), static_cast<int64_t>(garbage.size())));
+}
+
 }  // namespace internal
 }  // namespace arrow
@@ -18,10 +18,13 @@
 #include "arrow/util/thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <condition_variable>
 #include <deque>
 #include <list>
 #include <mutex>
+#include <optional>
+#include <random>
 #include <string>
 #include <thread>
 #include <vector>
@@ -31,6 +34,7 @@
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/mutex.h"
+#include "arrow/util/timer_wheel.h"
 
 #include "arrow/util/tracing_internal.h"
 
@@ -44,6 +48,45 @@ Executor::~Executor() = default;
 // lifetime of these resources.
 void Executor::KeepAlive(std::shared_ptr<Resource> resource) {}
 
+Future<> Executor::ScheduleAt(std::chrono::steady_clock::time_point deadline) {
+  TimerWheel* wheel = TimerWheel::GetGlobalWheel();
+  if (wheel == nullptr) {
+    return Future<>::MakeFinished(
+        Status::NotImplemented("Scheduled execution requires threading support"));
+  }
+  // TransferAlways: even an already-expired timer should not run its
+  // continuations on the caller's stack
+  return TransferAlways(wheel->ScheduleAt(deadline));
+}
+
+namespace {
+
+// Recursion guard for adaptive inline execution: an inline task spawning
+// further inline tasks must eventually fall back to real scheduling rather
+// than grow the stack without bound.
+constexpr int kMaxInlineSpawnDepth = 32;
+thread_local int inline_spawn_depth = 0;
+
+}  // namespace
+
+Status Executor::SpawnInternal(TaskHints hints, FnOnce<void()> task,
+                               StopToken stop_token, StopCallback&& stop_callback) {
+  const int64_t threshold = inline_cost_threshold_.load(std::memory_order_relaxed);
+  if (threshold > 0 && hints.cpu_cost >= 0 && hints.cpu_cost <= threshold &&
+      inline_spawn_depth < kMaxInlineSpawnDepth) {
+    ++inline_spawn_depth;
+    if (!stop_token.IsStopRequested()) {
+      std::move(task)();
+    } else if (stop_callback) {
+      std::move(stop_callback)(stop_token.Poll());
+    }
+    --inline_spawn_depth;
+    return Status::OK();
+  }
+  return SpawnReal(hints, std::move(task), std::move(stop_token),
+                   std::move(stop_callback));
+}
+
 namespace {
 
 struct Task {
@@ -686,6 +729,50 @@ Status ThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken sto
   return Status::OK();
 }
 
+Status ThreadPool::SpawnManyReal(TaskHints hints, std::vector<FnOnce<void()>> tasks,
+                                 StopToken stop_token) {
+  if (tasks.empty()) {
+    return Status::OK();
+  }
+#  ifdef ARROW_WITH_OPENTELEMETRY
+  // Wrap each task to propagate the parent tracing span, as in SpawnReal
+  for (auto& task : tasks) {
+    struct {
+      void operator()() {
+        auto scope = ::arrow::internal::tracing::GetTracer()->WithActiveSpan(activeSpan);
+        std::move(func)();
+      }
+      FnOnce<void()> func;
+      opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> activeSpan;
+    } wrapper{std::move(task), ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()};
+    task = std::move(wrapper);
+  }
+#  endif
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex_);
+    if (state_->please_shutdown_) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    CollectFinishedWorkersUnlocked();
+    state_->tasks_queued_or_running_ += static_cast<int>(tasks.size());
+    const int required =
+        std::min(state_->desired_capacity_ - static_cast<int>(state_->workers_.size()),
+                 state_->tasks_queued_or_running_ -
+                     static_cast<int>(state_->workers_.size()));
+    if (required > 0) {
+      LaunchWorkersUnlocked(required);
+    }
+    for (auto& task : tasks) {
+      state_->pending_tasks_.push(QueuedTask{{std::move(task), stop_token, StopCallback{}},
+                                             hints.priority,
+                                             state_->spawned_tasks_count_++});
+    }
+  }
+  // A single broadcast instead of one notify_one() per task
+  state_->cv_.notify_all();
+  return Status::OK();
+}
+
 void ThreadPool::KeepAlive(std::shared_ptr<Executor::Resource> resource) {
   // Seems unlikely but we might as well guard against concurrent calls to KeepAlive
   std::lock_guard<std::mutex> lk(state_->mutex_);
@@ -749,6 +836,392 @@ int ThreadPool::DefaultCapacity() {
   return capacity;
 }
 
+// ----------------------------------------------------------------------
+// Work-stealing thread pool
+
+// Index of the owning worker in its pool, when the current thread is a
+// work-stealing worker (used to route worker-local spawns to the LIFO slot).
+thread_local int ws_worker_index_ = -1;
+
+struct WorkStealingThreadPool::WsState {
+  // Per-worker execution state.  Padded to a cache line so that workers
+  // hammering their own deques don't false-share.
+  struct alignas(64) WorkerState {
+    std::mutex mutex;
+    // New local tasks displace the LIFO slot occupant to the back of the
+    // deque; the owner pops the slot first, then the deque back, while
+    // thieves take from the deque front.
+    std::optional<Task> lifo_slot;
+    std::deque<Task> deque;
+    std::thread thread;
+    bool running = false;
+  };
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::condition_variable cv_shutdown_;
+  std::condition_variable cv_idle_;
+
+  // Grows monotonically up to the high-water capacity; individual
+  // WorkerState objects are stable in memory and get relaunched on re-grow.
+  std::vector<std::unique_ptr<WorkerState>> workers_;
+  // Trashcan for finished threads, same motivation as ThreadPool::State
+  std::vector<std::thread> finished_workers_;
+
+  std::atomic<int> desired_capacity_{0};
+  int num_running_workers_ = 0;
+  std::atomic<int> tasks_queued_or_running_{0};
+  std::atomic<uint64_t> submit_counter_{0};
+  // Number of workers blocked in cv_.wait(); lets submitters skip the
+  // notify when everybody is busy.
+  std::atomic<int> num_sleepers_{0};
+  std::atomic<bool> please_shutdown_{false};
+  std::atomic<bool> quick_shutdown_{false};
+
+  std::vector<std::shared_ptr<Executor::Resource>> kept_alive_resources_;
+
+  // Take a task from any worker, scanning in randomized order.  Deque fronts
+  // are preferred; LIFO slots are raided last so that shutdown and idle
+  // workers can still drain tasks stranded by a blocked owner.
+  // Must be called with mutex_ held (the workers_ vector may otherwise grow
+  // concurrently).
+  std::optional<Task> StealAnyUnlocked(size_t thief_index) {
+    const size_t n = workers_.size();
+    if (n == 0) {
+      return std::nullopt;
+    }
+    thread_local std::minstd_rand gen(std::random_device{}());
+    const size_t start = gen() % n;
+    for (size_t i = 0; i < n; i++) {
+      WorkerState* victim = workers_[(start + i) % n].get();
+      std::lock_guard<std::mutex> lock(victim->mutex);
+      if (!victim->deque.empty()) {
+        std::optional<Task> task = std::move(victim->deque.front());
+        victim->deque.pop_front();
+        return task;
+      }
+      if (victim->lifo_slot.has_value()) {
+        std::optional<Task> task = std::move(victim->lifo_slot);
+        victim->lifo_slot.reset();
+        return task;
+      }
+    }
+    return std::nullopt;
+  }
+
+  void CollectFinishedWorkersUnlocked() {
+    for (auto& thread : finished_workers_) {
+      thread.join();
+    }
+    finished_workers_.clear();
+  }
+
+  // The worker loop is a member of the (shared) state so that it can keep
+  // running after the WorkStealingThreadPool is destroyed.
+  void WorkerLoop(int index) {
+    WorkerState* self;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      self = workers_[index].get();
+    }
+
+    while (true) {
+      if (quick_shutdown_.load()) {
+        break;
+      }
+      // If capacity shrank below our index, push our tasks to a surviving
+      // worker and secede from the pool.
+      const int desired_capacity = desired_capacity_.load();
+      if (index >= desired_capacity) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (index >= desired_capacity_.load() && desired_capacity_.load() > 0) {
+          WorkerState* heir = workers_[index % desired_capacity_.load()].get();
+          std::scoped_lock<std::mutex, std::mutex> task_locks(self->mutex, heir->mutex);
+          if (self->lifo_slot.has_value()) {
+            heir->deque.push_back(*std::move(self->lifo_slot));
+            self->lifo_slot.reset();
+          }
+          while (!self->deque.empty()) {
+            heir->deque.push_back(std::move(self->deque.front()));
+            self->deque.pop_front();
+          }
+          cv_.notify_all();
+          break;
+        }
+      }
+
+      std::optional<Task> task;
+      {
+        // Fast path: our LIFO slot, then the back of our own deque
+        std::lock_guard<std::mutex> lock(self->mutex);
+        if (self->lifo_slot.has_value()) {
+          task = std::move(self->lifo_slot);
+          self->lifo_slot.reset();
+        } else if (!self->deque.empty()) {
+          task = std::move(self->deque.back());
+          self->deque.pop_back();
+        }
+      }
+      if (!task.has_value()) {
+        // Slow path: steal from another worker, or go to sleep
+        std::unique_lock<std::mutex> lock(mutex_);
+        task = StealAnyUnlocked(index);
+        if (!task.has_value()) {
+          if (please_shutdown_.load()) {
+            // All deques and slots are empty, we can exit
+            break;
+          }
+          num_sleepers_.fetch_add(1);
+          cv_.wait(lock);
+          num_sleepers_.fetch_sub(1);
+          continue;
+        }
+      }
+      {
+        StopToken* stop_token = &task->stop_token;
+        if (!stop_token->IsStopRequested()) {
+          std::move(task->callable)();
+        } else {
+          if (task->stop_callback) {
+            std::move(task->stop_callback)(stop_token->Poll());
+          }
+        }
+        task.reset();  // release resources before signalling
+      }
+      if (ARROW_PREDICT_FALSE(tasks_queued_or_running_.fetch_sub(1) == 1)) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        cv_idle_.notify_all();
+      }
+    }
+
+    // We're done.  Move our thread object to the trashcan of finished
+    // workers so that Shutdown() can join the OS thread.
+    std::lock_guard<std::mutex> lock(mutex_);
+    self->running = false;
+    finished_workers_.push_back(std::move(self->thread));
+    if (--num_running_workers_ == 0 || please_shutdown_.load()) {
+      cv_shutdown_.notify_all();
+    }
+  }
+};
+
+WorkStealingThreadPool::WorkStealingThreadPool()
+    : ThreadPool(), ws_state_(std::make_shared<WsState>()) {}
+
+WorkStealingThreadPool::~WorkStealingThreadPool() {
+  if (shutdown_on_destroy_) {
+    ARROW_UNUSED(Shutdown(false /* wait */));
+  }
+  // ~ThreadPool then shuts down the (empty, never used) base pool state
+}
+
+int WorkStealingThreadPool::GetCapacity() {
+  return ws_state_->desired_capacity_.load();
+}
+
+int WorkStealingThreadPool::GetNumTasks() {
+  return ws_state_->tasks_queued_or_running_.load();
+}
+
+bool WorkStealingThreadPool::OwnsThisThread() { return current_thread_pool_ == this; }
+
+Status WorkStealingThreadPool::SetCapacity(int threads) {
+  std::lock_guard<std::mutex> lock(ws_state_->mutex_);
+  if (ws_state_->please_shutdown_.load()) {
+    return Status::Invalid("operation forbidden during or after shutdown");
+  }
+  if (threads <= 0) {
+    return Status::Invalid("ThreadPool capacity must be > 0");
+  }
+  ws_state_->CollectFinishedWorkersUnlocked();
+
+  ws_state_->desired_capacity_.store(threads);
+  while (static_cast<int>(ws_state_->workers_.size()) < threads) {
+    ws_state_->workers_.push_back(std::make_unique<WsState::WorkerState>());
+  }
+  // Unlike the base ThreadPool, workers are launched eagerly: idle workers
+  // are parked on the condition variable and each owns a task deque, so
+  // there is no benefit to spawning them lazily.
+  for (int index = 0; index < threads; index++) {
+    WsState::WorkerState* worker = ws_state_->workers_[index].get();
+    if (!worker->running) {
+      worker->running = true;
+      ws_state_->num_running_workers_++;
+      worker->thread = std::thread([pool = this, state = ws_state_, index] {
+        current_thread_pool_ = pool;
+        ws_worker_index_ = index;
+        state->WorkerLoop(index);
+      });
+    }
+  }
+  // Wake everybody so that excess workers notice the shrink and secede
+  ws_state_->cv_.notify_all();
+  return Status::OK();
+}
+
+Status WorkStealingThreadPool::Shutdown(bool wait) {
+  std::unique_lock<std::mutex> lock(ws_state_->mutex_);
+
+  if (ws_state_->please_shutdown_.load()) {
+    return Status::Invalid("Shutdown() already called");
+  }
+  ws_state_->please_shutdown_.store(true);
+  ws_state_->quick_shutdown_.store(!wait);
+  if (!wait) {
+    // Drop all queued tasks; currently executing tasks still finish
+    int dropped = 0;
+    for (auto& worker : ws_state_->workers_) {
+      std::lock_guard<std::mutex> worker_lock(worker->mutex);
+      dropped += static_cast<int>(worker->deque.size());
+      worker->deque.clear();
+      if (worker->lifo_slot.has_value()) {
+        worker->lifo_slot.reset();
+        dropped++;
+      }
+    }
+    ws_state_->tasks_queued_or_running_.fetch_sub(dropped);
+  }
+  ws_state_->cv_.notify_all();
+  ws_state_->cv_shutdown_.wait(lock,
+                               [this] { return ws_state_->num_running_workers_ == 0; });
+  if (wait) {
+    DCHECK_EQ(ws_state_->tasks_queued_or_running_.load(), 0);
+  }
+  ws_state_->CollectFinishedWorkersUnlocked();
+  return Status::OK();
+}
+
+void WorkStealingThreadPool::WaitForIdle() {
+  std::unique_lock<std::mutex> lock(ws_state_->mutex_);
+  ws_state_->cv_idle_.wait(
+      lock, [this] { return ws_state_->tasks_queued_or_running_.load() == 0; });
+}
+
+void WorkStealingThreadPool::KeepAlive(std::shared_ptr<Executor::Resource> resource) {
+  std::lock_guard<std::mutex> lock(ws_state_->mutex_);
+  ws_state_->kept_alive_resources_.push_back(std::move(resource));
+}
+
+Status WorkStealingThreadPool::SpawnReal(TaskHints hints, FnOnce<void()> task,
+                                         StopToken stop_token,
+                                         StopCallback&& stop_callback) {
+  // NOTE: TaskHints::priority is deliberately ignored; tasks run in
+  // per-worker LIFO / steal order instead of global priority order.
+#  ifdef ARROW_WITH_OPENTELEMETRY
+  // Wrap the task to propagate a parent tracing span to it (see
+  // ThreadPool::SpawnReal for why this happens before grabbing the mutex)
+  struct {
+    void operator()() {
+      auto scope = ::arrow::internal::tracing::GetTracer()->WithActiveSpan(activeSpan);
+      std::move(func)();
+    }
+    FnOnce<void()> func;
+    opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> activeSpan;
+  } wrapper{std::forward<FnOnce<void()>>(task),
+            ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()};
+  task = std::move(wrapper);
+#  endif
+  bool need_notify;
+  {
+    std::lock_guard<std::mutex> lock(ws_state_->mutex_);
+    if (ws_state_->please_shutdown_.load()) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    ws_state_->tasks_queued_or_running_.fetch_add(1);
+    const int capacity = ws_state_->desired_capacity_.load();
+    DCHECK_GT(capacity, 0);
+    const bool local_spawn = current_thread_pool_ == this && ws_worker_index_ >= 0 &&
+                             ws_worker_index_ < capacity;
+    const int target_index =
+        local_spawn ? ws_worker_index_
+                    : static_cast<int>(ws_state_->submit_counter_.fetch_add(1) %
+                                       static_cast<uint64_t>(capacity));
+    WsState::WorkerState* target = ws_state_->workers_[target_index].get();
+    {
+      std::lock_guard<std::mutex> worker_lock(target->mutex);
+      Task queued{std::move(task), std::move(stop_token), std::move(stop_callback)};
+      if (local_spawn) {
+        // Cache-hot continuation: claim the LIFO slot, displacing its
+        // occupant to the back of the deque where it can be stolen
+        if (target->lifo_slot.has_value()) {
+          target->deque.push_back(*std::move(target->lifo_slot));
+        }
+        target->lifo_slot = std::move(queued);
+      } else {
+        target->deque.push_back(std::move(queued));
+      }
+    }
+    need_notify = ws_state_->num_sleepers_.load() > 0;
+  }
+  if (need_notify) {
+    ws_state_->cv_.notify_one();
+  }
+  return Status::OK();
+}
+
+Status WorkStealingThreadPool::SpawnManyReal(TaskHints hints,
+                                             std::vector<FnOnce<void()>> tasks,
+                                             StopToken stop_token) {
+  if (tasks.empty()) {
+    return Status::OK();
+  }
+#  ifdef ARROW_WITH_OPENTELEMETRY
+  // Wrap each task to propagate the parent tracing span, as in SpawnReal
+  for (auto& task : tasks) {
+    struct {
+      void operator()() {
+        auto scope = ::arrow::internal::tracing::GetTracer()->WithActiveSpan(activeSpan);
+        std::move(func)();
+      }
+      FnOnce<void()> func;
+      opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> activeSpan;
+    } wrapper{std::move(task), ::arrow::internal::tracing::GetTracer()->GetCurrentSpan()};
+    task = std::move(wrapper);
+  }
+#  endif
+  bool need_notify;
+  {
+    std::lock_guard<std::mutex> lock(ws_state_->mutex_);
+    if (ws_state_->please_shutdown_.load()) {
+      return Status::Invalid("operation forbidden during or after shutdown");
+    }
+    ws_state_->tasks_queued_or_running_.fetch_add(static_cast<int>(tasks.size()));
+    const int capacity = ws_state_->desired_capacity_.load();
+    DCHECK_GT(capacity, 0);
+    const uint64_t start =
+        ws_state_->submit_counter_.fetch_add(static_cast<uint64_t>(tasks.size()));
+    for (size_t i = 0; i < tasks.size(); i++) {
+      WsState::WorkerState* target =
+          ws_state_->workers_[(start + i) % static_cast<uint64_t>(capacity)].get();
+      std::lock_guard<std::mutex> worker_lock(target->mutex);
+      target->deque.push_back(Task{std::move(tasks[i]), stop_token, StopCallback{}});
+    }
+    need_notify = ws_state_->num_sleepers_.load() > 0;
+  }
+  if (need_notify) {
+    // A single broadcast instead of one notify per task
+    ws_state_->cv_.notify_all();
+  }
+  return Status::OK();
+}
+
+Result<std::shared_ptr<WorkStealingThreadPool>> WorkStealingThreadPool::Make(
+    int threads) {
+  auto pool = std::shared_ptr<WorkStealingThreadPool>(new WorkStealingThreadPool());
+  RETURN_NOT_OK(pool->SetCapacity(threads));
+  return pool;
+}
+
+Result<std::shared_ptr<WorkStealingThreadPool>> WorkStealingThreadPool::MakeEternal(
+    int threads) {
+  ARROW_ASSIGN_OR_RAISE(auto pool, Make(threads));
+  // See ThreadPool::MakeEternal
+#  ifdef _WIN32
+  pool->shutdown_on_destroy_ = false;
+#  endif
+  return pool;
+}
+
 #else  // ARROW_ENABLE_THREADING
 ThreadPool::ThreadPool() {
   // default to max 'concurrency' of 8
@@ -808,11 +1281,32 @@ ThreadPool::~ThreadPool() {
   std::swap(state_->task_queue, empty);
 }
 
+Result<std::shared_ptr<WorkStealingThreadPool>> WorkStealingThreadPool::Make(
+    int threads) {
+  auto pool = std::shared_ptr<WorkStealingThreadPool>(new WorkStealingThreadPool());
+  RETURN_NOT_OK(pool->SetCapacity(threads));
+  return pool;
+}
+
+Result<std::shared_ptr<WorkStealingThreadPool>> WorkStealingThreadPool::MakeEternal(
+    int threads) {
+  return Make(threads);
+}
+
 #endif  // ARROW_ENABLE_THREADING
 
 // Helper for the singleton pattern
 std::shared_ptr<ThreadPool> ThreadPool::MakeCpuThreadPool() {
-  auto maybe_pool = ThreadPool::MakeEternal(ThreadPool::DefaultCapacity());
+  auto make = []() -> Result<std::shared_ptr<ThreadPool>> {
+    auto kind = GetEnvVar("ARROW_CPU_THREAD_POOL_KIND");
+    if (kind.ok() && *kind == "work-stealing") {
+      ARROW_ASSIGN_OR_RAISE(
+          auto pool, WorkStealingThreadPool::MakeEternal(ThreadPool::DefaultCapacity()));
+      return std::shared_ptr<ThreadPool>(std::move(pool));
+    }
+    return ThreadPool::MakeEternal(ThreadPool::DefaultCapacity());
+  };
+  auto maybe_pool = make();
   if (!maybe_pool.ok()) {
     maybe_pool.status().Abort("Failed to create global CPU thread pool");
   }
@@ -17,12 +17,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <queue>
 #include <type_traits>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "arrow/result.h"
 #include "arrow/status.h"
@@ -82,29 +86,81 @@ class ARROW_EXPORT Executor {
   // Spawn a fire-and-forget task.
   template <typename Function>
   Status Spawn(Function&& func) {
-    return SpawnReal(TaskHints{}, std::forward<Function>(func), StopToken::Unstoppable(),
-                     StopCallback{});
+    return SpawnInternal(TaskHints{}, std::forward<Function>(func),
+                         StopToken::Unstoppable(), StopCallback{});
   }
   template <typename Function>
   Status Spawn(Function&& func, StopToken stop_token) {
-    return SpawnReal(TaskHints{}, std::forward<Function>(func), std::move(stop_token),
-                     StopCallback{});
+    return SpawnInternal(TaskHints{}, std::forward<Function>(func),
+                         std::move(stop_token), StopCallback{});
   }
   template <typename Function>
   Status Spawn(TaskHints hints, Function&& func) {
-    return SpawnReal(hints, std::forward<Function>(func), StopToken::Unstoppable(),
-                     StopCallback{});
+    return SpawnInternal(hints, std::forward<Function>(func), StopToken::Unstoppable(),
+                         StopCallback{});
   }
   template <typename Function>
   Status Spawn(TaskHints hints, Function&& func, StopToken stop_token) {
-    return SpawnReal(hints, std::forward<Function>(func), std::move(stop_token),
-                     StopCallback{});
+    return SpawnInternal(hints, std::forward<Function>(func), std::move(stop_token),
+                         StopCallback{});
   }
   template <typename Function>
   Status Spawn(TaskHints hints, Function&& func, StopToken stop_token,
                StopCallback stop_callback) {
-    return SpawnReal(hints, std::forward<Function>(func), std::move(stop_token),
-                     std::move(stop_callback));
+    return SpawnInternal(hints, std::forward<Function>(func), std::move(stop_token),
+                         std::move(stop_callback));
+  }
+
+  // Configure adaptive inline execution.  When enabled, a task spawned with a
+  // non-negative TaskHints::cpu_cost at or below the threshold runs
+  // synchronously in the submitting thread instead of crossing the executor
+  // boundary; for micro-tasks the scheduling overhead dwarfs the task itself.
+  // A bounded recursion depth is enforced so that inline tasks spawning
+  // further inline tasks cannot overflow the stack.  Zero (the default)
+  // disables inline execution; tasks without a cost estimate are never run
+  // inline.
+  void SetInlineCostThreshold(int64_t max_cpu_cost) {
+    inline_cost_threshold_.store(max_cpu_cost, std::memory_order_relaxed);
+  }
+  int64_t inline_cost_threshold() const {
+    return inline_cost_threshold_.load(std::memory_order_relaxed);
+  }
+
+  // Spawn a batch of fire-and-forget tasks in one call.
+  //
+  // Implementations may enqueue the whole batch under a single lock
+  // acquisition and wakeup, which is noticeably cheaper than a loop of
+  // Spawn() calls when the tasks themselves are short.
+  Status SpawnMany(std::vector<internal::FnOnce<void()>> tasks, TaskHints hints = {},
+                   StopToken stop_token = StopToken::Unstoppable()) {
+    return SpawnManyReal(hints, std::move(tasks), std::move(stop_token));
+  }
+
+  // Call `func` with every index in [0, num_tasks), grouping the indices
+  // into at most GetCapacity() contiguous chunks each submitted as a single
+  // task.  This amortizes per-task scheduling overhead when the work done
+  // per index is small; use SpawnMany/Spawn directly when individual items
+  // are long-running, as a chunk occupies one worker until it is drained.
+  template <typename Function>
+  Status SpawnChunked(int64_t num_tasks, Function func,
+                      StopToken stop_token = StopToken::Unstoppable()) {
+    if (num_tasks <= 0) {
+      return Status::OK();
+    }
+    const int64_t num_chunks =
+        std::min<int64_t>(std::max(GetCapacity(), 1), num_tasks);
+    const int64_t chunk_size = (num_tasks + num_chunks - 1) / num_chunks;
+    std::vector<internal::FnOnce<void()>> tasks;
+    tasks.reserve(static_cast<size_t>(num_chunks));
+    for (int64_t begin = 0; begin < num_tasks; begin += chunk_size) {
+      const int64_t end = std::min(begin + chunk_size, num_tasks);
+      tasks.push_back([func, begin, end]() mutable {
+        for (int64_t i = begin; i < end; ++i) {
+          func(i);
+        }
+      });
+    }
+    return SpawnMany(std::move(tasks), TaskHints{}, std::move(stop_token));
   }
 
   // Transfers a future to this executor.  Any continuations added to the
@@ -135,6 +191,20 @@ class ARROW_EXPORT Executor {
     return DoTransfer(std::move(future), true);
   }
 
+  // Return a future that completes on this executor at the given steady-clock
+  // deadline.  Timers are managed by a process-wide timer wheel (see
+  // arrow::internal::TimerWheel) so thousands of concurrent timeouts share a
+  // single timer thread; the future is transferred to this executor so its
+  // continuations never run on the timer thread.
+  //
+  // Fails with NotImplemented if threading is disabled.
+  Future<> ScheduleAt(std::chrono::steady_clock::time_point deadline);
+
+  // Like ScheduleAt, with the deadline given as a delay from now
+  Future<> ScheduleAfter(std::chrono::steady_clock::duration delay) {
+    return ScheduleAt(std::chrono::steady_clock::now() + delay);
+  }
+
   // Submit a callable and arguments for execution.  Return a future that
   // will return the callable's result value once.
   // The callable's arguments are copied before execution.
@@ -158,8 +228,8 @@ class ARROW_EXPORT Executor {
         }
       }
     } stop_callback{WeakFuture<ValueType>(future)};
-    ARROW_RETURN_NOT_OK(SpawnReal(hints, std::move(task), std::move(stop_token),
-                                  std::move(stop_callback)));
+    ARROW_RETURN_NOT_OK(SpawnInternal(hints, std::move(task), std::move(stop_token),
+                                      std::move(stop_callback)));
 
     return future;
   }
@@ -263,6 +333,23 @@ class ARROW_EXPORT Executor {
   // Subclassing API
   virtual Status SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken,
                            StopCallback&&) = 0;
+
+  // Subclasses may override this to enqueue a whole batch at once; the
+  // default implementation just loops over SpawnReal.
+  virtual Status SpawnManyReal(TaskHints hints, std::vector<FnOnce<void()>> tasks,
+                               StopToken stop_token) {
+    for (auto& task : tasks) {
+      ARROW_RETURN_NOT_OK(SpawnReal(hints, std::move(task), stop_token, StopCallback{}));
+    }
+    return Status::OK();
+  }
+
+  // Funnel for Spawn()/Submit(): runs the task inline when adaptive inline
+  // execution permits it, otherwise defers to SpawnReal.
+  Status SpawnInternal(TaskHints hints, FnOnce<void()> task, StopToken stop_token,
+                       StopCallback&& stop_callback);
+
+  std::atomic<int64_t> inline_cost_threshold_{0};
 };
 
 /// \brief An executor implementation that runs all tasks on a single thread using an
@@ -461,7 +548,7 @@ class ARROW_EXPORT ThreadPool : public Executor {
   int GetCapacity() override;
 
   // Return the number of tasks either running or in the queue.
-  int GetNumTasks();
+  virtual int GetNumTasks();
 
   bool OwnsThisThread() override;
   // Dynamically change the number of worker threads.
@@ -471,7 +558,7 @@ class ARROW_EXPORT ThreadPool : public Executor {
   // on-demand when needed for task execution.
   // If more threads are running than this number, excess threads are reaped
   // as soon as possible.
-  Status SetCapacity(int threads);
+  virtual Status SetCapacity(int threads);
 
   // Heuristic for the default capacity of a thread pool for CPU-bound tasks.
   // This is exposed as a static method to help with testing.
@@ -482,12 +569,12 @@ class ARROW_EXPORT ThreadPool : public Executor {
   // If "wait" is true, shutdown waits for all pending tasks to be finished.
   // If "wait" is false, workers are stopped as soon as currently executing
   // tasks are finished.
-  Status Shutdown(bool wait = true);
+  virtual Status Shutdown(bool wait = true);
 
   // Wait for the thread pool to become idle
   //
   // This is useful for sequencing tests
-  void WaitForIdle();
+  virtual void WaitForIdle();
 
   void KeepAlive(std::shared_ptr<Executor::Resource> resource) override;
 
@@ -502,6 +589,8 @@ class ARROW_EXPORT ThreadPool : public Executor {
 
   Status SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken,
                    StopCallback&&) override;
+  Status SpawnManyReal(TaskHints hints, std::vector<FnOnce<void()>> tasks,
+                       StopToken stop_token) override;
 
   // Collect finished worker threads, making sure the OS threads have exited
   void CollectFinishedWorkersUnlocked();
@@ -516,6 +605,56 @@ class ARROW_EXPORT ThreadPool : public Executor {
   State* state_;
   bool shutdown_on_destroy_;
 };
+
+/// An Executor implementation with per-worker task deques and work stealing.
+///
+/// Each worker owns a deque and a single-task LIFO slot.  Tasks spawned from a
+/// worker thread go into that worker's LIFO slot (displacing its previous
+/// occupant to the deque), so cache-hot continuations run next on the same
+/// thread.  Tasks spawned from outside are distributed round-robin across
+/// worker deques.  Idle workers steal from the front of other workers' deques
+/// in randomized order.
+///
+/// Unlike the base ThreadPool, TaskHints::priority is ignored: tasks execute
+/// in per-worker LIFO / steal order rather than global priority order.
+///
+/// The process-global CPU pool can be switched to this implementation by
+/// setting the environment variable ARROW_CPU_THREAD_POOL_KIND to
+/// "work-stealing" before the pool is first used.
+///
+/// Note: this pool does not install fork handlers; using it across fork()
+/// is undefined behavior.
+class ARROW_EXPORT WorkStealingThreadPool : public ThreadPool {
+ public:
+  // Construct a work-stealing thread pool with the given number of workers
+  static Result<std::shared_ptr<WorkStealingThreadPool>> Make(int threads);
+
+  // Like Make(), but takes care that the returned pool is compatible
+  // with destruction late at process exit.
+  static Result<std::shared_ptr<WorkStealingThreadPool>> MakeEternal(int threads);
+
+  ~WorkStealingThreadPool() override;
+
+  int GetCapacity() override;
+  int GetNumTasks() override;
+  bool OwnsThisThread() override;
+  Status SetCapacity(int threads) override;
+  Status Shutdown(bool wait = true) override;
+  void WaitForIdle() override;
+  void KeepAlive(std::shared_ptr<Executor::Resource> resource) override;
+
+  struct WsState;
+
+ protected:
+  WorkStealingThreadPool();
+
+  Status SpawnReal(TaskHints hints, FnOnce<void()> task, StopToken,
+                   StopCallback&&) override;
+  Status SpawnManyReal(TaskHints hints, std::vector<FnOnce<void()>> tasks,
+                       StopToken stop_token) override;
+
+  std::shared_ptr<WsState> ws_state_;
+};
 #else  // ARROW_ENABLE_THREADING
 // an executor implementation which pretends to be a thread pool but runs everything
 // on the main thread using a static queue (shared between all thread pools, otherwise
@@ -555,18 +694,30 @@ class ARROW_EXPORT ThreadPool : public SerialExecutor {
   // If "wait" is true, shutdown waits for all pending tasks to be finished.
   // If "wait" is false, workers are stopped as soon as currently executing
   // tasks are finished.
-  Status Shutdown(bool wait = true);
+  virtual Status Shutdown(bool wait = true);
 
   // Wait for the thread pool to become idle
   //
   // This is useful for sequencing tests
-  void WaitForIdle();
+  virtual void WaitForIdle();
 
  protected:
   static std::shared_ptr<ThreadPool> MakeCpuThreadPool();
   ThreadPool();
 };
 
+// Without threading there are no workers to steal from; this is just a
+// ThreadPool under another name so code selecting the work-stealing pool
+// still compiles.
+class ARROW_EXPORT WorkStealingThreadPool : public ThreadPool {
+ public:
+  static Result<std::shared_ptr<WorkStealingThreadPool>> Make(int threads);
+  static Result<std::shared_ptr<WorkStealingThreadPool>> MakeEternal(int threads);
+
+ protected:
+  WorkStealingThreadPool() = default;
+};
+
 #endif  // ARROW_ENABLE_THREADING
 
 // Return the process-global thread pool for CPU-bound tasks.
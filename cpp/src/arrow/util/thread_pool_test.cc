@@ -719,6 +719,87 @@ TEST_F(TestThreadPool, StressSpawnThreadedWithStopTokenCancelled) {
                              &stop_source);
 }
 
+TEST_F(TestThreadPool, AdaptiveInlineExecution) {
+  auto pool = this->MakeThreadPool(3);
+  ASSERT_EQ(pool->inline_cost_threshold(), 0);
+  pool->SetInlineCostThreshold(1000);
+  ASSERT_EQ(pool->inline_cost_threshold(), 1000);
+
+  // A task with a cost estimate under the threshold runs in the submitting
+  // thread
+  TaskHints cheap;
+  cheap.cpu_cost = 500;
+  std::thread::id task_thread;
+  ASSERT_OK(pool->Spawn(cheap, [&] { task_thread = std::this_thread::get_id(); }));
+  ASSERT_EQ(task_thread, std::this_thread::get_id());
+
+  // Submit() with a cheap task returns an already-finished future
+  ASSERT_OK_AND_ASSIGN(auto fut, pool->Submit(cheap, add<int>, 4, 5));
+  ASSERT_TRUE(fut.is_finished());
+  ASSERT_OK_AND_EQ(9, fut.result());
+
+#ifdef ARROW_ENABLE_THREADING
+  // Tasks over the threshold or without a cost estimate are scheduled
+  const auto main_id = std::this_thread::get_id();
+  std::atomic<bool> ran_inline{true};
+  TaskHints costly;
+  costly.cpu_cost = 100000;
+  ASSERT_OK(pool->Spawn(costly,
+                        [&] { ran_inline = (std::this_thread::get_id() == main_id); }));
+  pool->WaitForIdle();
+  ASSERT_FALSE(ran_inline);
+#endif
+
+  // Deeply nested inline spawns hit the recursion limit and fall back to the
+  // pool instead of overflowing the stack
+  std::atomic<int> count{0};
+  std::function<void()> recurse = [&] {
+    if (++count < 100) {
+      ASSERT_OK(pool->Spawn(cheap, recurse));
+    }
+  };
+  ASSERT_OK(pool->Spawn(cheap, recurse));
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(count.load(), 100);
+}
+
+TEST_F(TestThreadPool, SpawnMany) {
+  auto pool = this->MakeThreadPool(3);
+  std::atomic<int> sum{0};
+  std::vector<FnOnce<void()>> tasks;
+  for (int i = 0; i < 100; ++i) {
+    tasks.push_back([&sum, i] { sum += i; });
+  }
+  ASSERT_OK(pool->SpawnMany(std::move(tasks)));
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(sum.load(), 99 * 100 / 2);
+}
+
+TEST_F(TestThreadPool, SpawnManyAfterShutdown) {
+  auto pool = this->MakeThreadPool(3);
+  ASSERT_OK(pool->Shutdown());
+  std::vector<FnOnce<void()>> tasks;
+  tasks.push_back([] {});
+  ASSERT_RAISES(Invalid, pool->SpawnMany(std::move(tasks)));
+}
+
+TEST_F(TestThreadPool, SpawnChunked) {
+  auto pool = this->MakeThreadPool(4);
+  // More indices than workers: chunked into at most GetCapacity() tasks
+  std::atomic<int64_t> sum{0};
+  ASSERT_OK(pool->SpawnChunked(1000, [&sum](int64_t i) { sum += i; }));
+  pool->WaitForIdle();
+  ASSERT_EQ(sum.load(), 999 * 1000 / 2);
+
+  // Fewer indices than workers
+  std::atomic<int64_t> count{0};
+  ASSERT_OK(pool->SpawnChunked(3, [&count](int64_t) { count++; }));
+  // Degenerate cases
+  ASSERT_OK(pool->SpawnChunked(0, [](int64_t) { FAIL(); }));
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(count.load(), 3);
+}
+
 TEST_F(TestThreadPool, QuickShutdown) {
   AddTester add_tester(100);
   {
@@ -878,6 +959,141 @@ TEST_F(TestThreadPool, SubmitWithStopTokenCancelled) {
   }
 }
 
+class TestWorkStealingThreadPool : public TestThreadPool {
+ public:
+  std::shared_ptr<WorkStealingThreadPool> MakeThreadPool(int threads) {
+    return *WorkStealingThreadPool::Make(threads);
+  }
+};
+
+TEST_F(TestWorkStealingThreadPool, ConstructDestruct) {
+  for (int threads : {1, 2, 3, 8, 32}) {
+    auto pool = this->MakeThreadPool(threads);
+    ASSERT_EQ(pool->GetCapacity(), threads);
+  }
+}
+
+TEST_F(TestWorkStealingThreadPool, Spawn) {
+  auto pool = this->MakeThreadPool(3);
+  SpawnAdds(pool.get(), 7, task_add<int>);
+}
+
+TEST_F(TestWorkStealingThreadPool, StressSpawn) {
+  auto pool = this->MakeThreadPool(30);
+  SpawnAdds(pool.get(), 1000, task_add<int>);
+}
+
+TEST_F(TestWorkStealingThreadPool, StressSpawnThreaded) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Test requires threading support";
+#endif
+  auto pool = this->MakeThreadPool(30);
+  SpawnAddsThreaded(pool.get(), 20, 100, task_add<int>);
+}
+
+TEST_F(TestWorkStealingThreadPool, StressSpawnSlowThreaded) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Test requires threading support";
+#endif
+  auto pool = this->MakeThreadPool(30);
+  SpawnAddsThreaded(pool.get(), 20, 100, task_slow_add<int>{/*seconds=*/0.002});
+}
+
+TEST_F(TestWorkStealingThreadPool, SpawnWithStopTokenCancelled) {
+  StopSource stop_source;
+  auto pool = this->MakeThreadPool(3);
+  SpawnAddsAndCancel(pool.get(), 100, task_slow_add<int>{/*seconds=*/0.02}, &stop_source);
+}
+
+TEST_F(TestWorkStealingThreadPool, OwnsCurrentThread) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Test requires threading support";
+#endif
+  auto pool = this->MakeThreadPool(4);
+  std::atomic<bool> one_failed{false};
+
+  for (int i = 0; i < 1000; ++i) {
+    ASSERT_OK(pool->Spawn([&] {
+      if (pool->OwnsThisThread()) return;
+      one_failed = true;
+    }));
+  }
+
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_FALSE(pool->OwnsThisThread());
+  ASSERT_FALSE(one_failed);
+}
+
+TEST_F(TestWorkStealingThreadPool, NestedSpawn) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Test requires threading support";
+#endif
+  // Tasks spawned from a worker go to that worker's LIFO slot; make sure
+  // nested spawning makes progress and all continuations run.
+  auto pool = this->MakeThreadPool(4);
+  std::atomic<int> count{0};
+  constexpr int kDepth = 100;
+  std::function<void(int)> recurse = [&](int depth) {
+    count++;
+    if (depth < kDepth) {
+      ASSERT_OK(pool->Spawn([&recurse, depth] { recurse(depth + 1); }));
+    }
+  };
+  ASSERT_OK(pool->Spawn([&recurse] { recurse(1); }));
+  pool->WaitForIdle();
+  ASSERT_EQ(count.load(), kDepth);
+  ASSERT_OK(pool->Shutdown());
+}
+
+TEST_F(TestWorkStealingThreadPool, SpawnMany) {
+  auto pool = this->MakeThreadPool(4);
+  std::atomic<int> sum{0};
+  std::vector<FnOnce<void()>> tasks;
+  for (int i = 0; i < 100; ++i) {
+    tasks.push_back([&sum, i] { sum += i; });
+  }
+  ASSERT_OK(pool->SpawnMany(std::move(tasks)));
+  ASSERT_OK(pool->Shutdown());
+  ASSERT_EQ(sum.load(), 99 * 100 / 2);
+}
+
+TEST_F(TestWorkStealingThreadPool, QuickShutdown) {
+  AddTester add_tester(100);
+  {
+    auto pool = this->MakeThreadPool(3);
+    add_tester.SpawnTasks(pool.get(), task_slow_add<int>{/*seconds=*/0.02});
+    ASSERT_OK(pool->Shutdown(false /* wait */));
+    add_tester.CheckNotAllComputed();
+  }
+  add_tester.CheckNotAllComputed();
+}
+
+TEST_F(TestWorkStealingThreadPool, SetCapacity) {
+#ifndef ARROW_ENABLE_THREADING
+  GTEST_SKIP() << "Test requires threading support";
+#endif
+  auto pool = this->MakeThreadPool(5);
+  ASSERT_EQ(pool->GetCapacity(), 5);
+
+  // Excess workers secede and their queued tasks migrate to survivors
+  auto gating_task = GatingTask::Make();
+  for (int i = 0; i < 10; ++i) {
+    ASSERT_OK(pool->Spawn(gating_task->Task()));
+  }
+  ASSERT_OK(gating_task->WaitForRunning(5));
+  ASSERT_OK(pool->SetCapacity(2));
+  ASSERT_EQ(pool->GetCapacity(), 2);
+  ASSERT_OK(gating_task->Unlock());
+  pool->WaitForIdle();
+  ASSERT_EQ(pool->GetNumTasks(), 0);
+
+  ASSERT_RAISES(Invalid, pool->SetCapacity(0));
+
+  // Growing back relaunches workers
+  ASSERT_OK(pool->SetCapacity(4));
+  SpawnAdds(pool.get(), 100, task_add<int>);
+}
+
 // Test fork safety on Unix
 
 #if !(defined(_WIN32) || defined(ARROW_VALGRIND) || defined(ADDRESS_SANITIZER) || \
@@ -0,0 +1,247 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/timer_wheel.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/config.h"
+#include "arrow/util/logging_internal.h"
+
+namespace arrow {
+namespace internal {
+
+namespace {
+
+enum TimerState : int { kPending = 0, kFired = 1, kCancelled = 2 };
+
+}  // namespace
+
+struct TimerEntry {
+  // The wheel tick at which the timer expires
+  uint64_t expiry_tick;
+  Future<> future;
+  std::atomic<int> state{kPending};
+
+  // Atomically claim the entry, so that a timer fires or cancels at most once
+  bool Claim(int new_state) {
+    int expected = kPending;
+    return state.compare_exchange_strong(expected, new_state);
+  }
+};
+
+void TimerHandle::Cancel() {
+  if (!entry_) return;
+  if (entry_->Claim(kCancelled)) {
+    entry_->future.MarkFinished(Status::Cancelled("Timer was cancelled"));
+  }
+  // The wheel drops the slot's reference lazily when the slot is next scanned,
+  // keeping cancellation O(1)
+}
+
+struct TimerWheelState {
+  using Clock = TimerWheel::Clock;
+
+  TimerWheelState(Clock::duration tick, int num_slots)
+      : tick(tick), origin(Clock::now()), slots(num_slots) {}
+
+  uint64_t TickFor(Clock::time_point deadline) const {
+    if (deadline <= origin) return 0;
+    auto elapsed = deadline - origin;
+    // Round up so a timer never fires before its deadline
+    return static_cast<uint64_t>((elapsed + tick - Clock::duration(1)) / tick);
+  }
+
+  Clock::time_point TimeOf(uint64_t tick_index) const {
+    return origin + tick * tick_index;
+  }
+
+  const Clock::duration tick;
+  const Clock::time_point origin;
+
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::vector<std::vector<std::shared_ptr<TimerEntry>>> slots;
+  uint64_t current_tick = 0;
+  int64_t num_pending = 0;
+  bool shutdown = false;
+#ifdef ARROW_ENABLE_THREADING
+  std::thread thread;
+#endif
+};
+
+#ifdef ARROW_ENABLE_THREADING
+
+namespace {
+
+void TimerThreadLoop(const std::shared_ptr<TimerWheelState>& state) {
+  std::unique_lock<std::mutex> lock(state->mutex);
+  while (true) {
+    if (state->shutdown) return;
+    if (state->num_pending == 0) {
+      // Idle wheel: block until a timer is scheduled instead of ticking
+      state->cv.wait(
+          lock, [&] { return state->shutdown || state->num_pending > 0; });
+      continue;
+    }
+    const auto next_tick_time = state->TimeOf(state->current_tick + 1);
+    if (state->cv.wait_until(lock, next_tick_time, [&] { return state->shutdown; })) {
+      return;
+    }
+    // Catch up on every tick that has elapsed, so a delayed wakeup (e.g. OS
+    // scheduling hiccup) fires all overdue timers at once
+    const uint64_t now_tick = state->TickFor(TimerWheel::Clock::now());
+    while (state->current_tick < now_tick) {
+      ++state->current_tick;
+      auto& slot = state->slots[state->current_tick % state->slots.size()];
+      auto it = slot.begin();
+      std::vector<std::shared_ptr<TimerEntry>> expired;
+      while (it != slot.end()) {
+        TimerEntry& entry = **it;
+        if (entry.state.load() != kPending) {
+          // Lazily drop cancelled timers
+          --state->num_pending;
+          it = slot.erase(it);
+        } else if (entry.expiry_tick <= state->current_tick) {
+          expired.push_back(std::move(*it));
+          --state->num_pending;
+          it = slot.erase(it);
+        } else {
+          // A later rotation of the wheel
+          ++it;
+        }
+      }
+      if (!expired.empty()) {
+        // Complete futures outside the lock; continuations may schedule new
+        // timers, which would deadlock otherwise
+        lock.unlock();
+        for (const auto& entry : expired) {
+          if (entry->Claim(kFired)) {
+            entry->future.MarkFinished();
+          }
+        }
+        lock.lock();
+      }
+    }
+  }
+}
+
+}  // namespace
+
+#endif  // ARROW_ENABLE_THREADING
+
+TimerWheel::TimerWheel(Clock::duration tick, int num_slots)
+    : state_(std::make_shared<TimerWheelState>(tick, num_slots)) {}
+
+TimerWheel::~TimerWheel() { Shutdown(); }
+
+Result<std::shared_ptr<TimerWheel>> TimerWheel::Make(Clock::duration tick,
+                                                     int num_slots) {
+  if (tick <= Clock::duration::zero()) {
+    return Status::Invalid("TimerWheel tick must be positive");
+  }
+  if (num_slots <= 0) {
+    return Status::Invalid("TimerWheel must have at least one slot");
+  }
+#ifndef ARROW_ENABLE_THREADING
+  return Status::NotImplemented("TimerWheel requires threading support");
+#else
+  std::shared_ptr<TimerWheel> wheel(new TimerWheel(tick, num_slots));
+  wheel->state_->thread = std::thread([state = wheel->state_] { TimerThreadLoop(state); });
+  return wheel;
+#endif
+}
+
+TimerWheel* TimerWheel::GetGlobalWheel() {
+  static std::shared_ptr<TimerWheel> global_wheel = []() -> std::shared_ptr<TimerWheel> {
+    auto maybe_wheel = Make();
+    if (!maybe_wheel.ok()) {
+      return nullptr;
+    }
+    return *std::move(maybe_wheel);
+  }();
+  return global_wheel.get();
+}
+
+Future<> TimerWheel::ScheduleAt(Clock::time_point deadline, TimerHandle* handle) {
+#ifndef ARROW_ENABLE_THREADING
+  return Future<>::MakeFinished(
+      Status::NotImplemented("TimerWheel requires threading support"));
+#else
+  auto entry = std::make_shared<TimerEntry>();
+  entry->future = Future<>::Make();
+  if (handle != NULLPTR) {
+    *handle = TimerHandle(entry);
+  }
+  Future<> future = entry->future;
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (state_->shutdown) {
+      entry->state.store(kCancelled);
+      future.MarkFinished(Status::Cancelled("TimerWheel was shut down"));
+      return future;
+    }
+    const uint64_t expiry_tick = state_->TickFor(deadline);
+    if (expiry_tick <= state_->current_tick) {
+      // Already expired; complete without involving the timer thread
+      entry->state.store(kFired);
+      future.MarkFinished();
+      return future;
+    }
+    entry->expiry_tick = expiry_tick;
+    state_->slots[expiry_tick % state_->slots.size()].push_back(std::move(entry));
+    ++state_->num_pending;
+  }
+  state_->cv.notify_one();
+  return future;
+#endif
+}
+
+void TimerWheel::Shutdown() {
+  std::vector<std::shared_ptr<TimerEntry>> pending;
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+    if (state_->shutdown) return;
+    state_->shutdown = true;
+    for (auto& slot : state_->slots) {
+      for (auto& entry : slot) {
+        pending.push_back(std::move(entry));
+      }
+      slot.clear();
+    }
+    state_->num_pending = 0;
+  }
+  state_->cv.notify_all();
+#ifdef ARROW_ENABLE_THREADING
+  if (state_->thread.joinable()) {
+    state_->thread.join();
+  }
+#endif
+  for (const auto& entry : pending) {
+    if (entry->Claim(kCancelled)) {
+      entry->future.MarkFinished(Status::Cancelled("TimerWheel was shut down"));
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace arrow
@@ -0,0 +1,117 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <chrono>
+#include <memory>
+
+#include "arrow/result.h"
+#include "arrow/status.h"
+#include "arrow/util/future.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace internal {
+
+struct TimerWheelState;
+struct TimerEntry;
+
+/// \brief A handle to a scheduled timer
+///
+/// Cancelling the handle completes the timer's future with Status::Cancelled
+/// and releases the timer's resources in O(1).  Destroying the handle does
+/// not cancel the timer.
+class ARROW_EXPORT TimerHandle {
+ public:
+  TimerHandle() = default;
+
+  /// \brief Cancel the timer, failing its future with Status::Cancelled
+  ///
+  /// Does nothing if the timer has already fired or been cancelled.
+  void Cancel();
+
+ private:
+  friend class TimerWheel;
+  explicit TimerHandle(std::shared_ptr<TimerEntry> entry) : entry_(std::move(entry)) {}
+
+  std::shared_ptr<TimerEntry> entry_;
+};
+
+/// \brief A hashed timer wheel for cheap deadline and timeout management
+///
+/// Timers are hashed into a fixed number of slots by expiry tick, so insertion
+/// and cancellation are O(1) regardless of how many timeouts are pending, and
+/// thousands of concurrent timeouts share a single timer thread instead of
+/// costing a thread (or a polling loop) each.  Expired timers are completed on
+/// the timer thread; continuations that do non-trivial work should transfer
+/// themselves to an executor (see Executor::ScheduleAt, which does this
+/// automatically).
+///
+/// The wheel resolution is configurable down to microseconds; actual firing
+/// accuracy is bounded below by the scheduling granularity of the host OS.
+///
+/// Requires threading support (Make fails with NotImplemented otherwise).
+class ARROW_EXPORT TimerWheel {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  ~TimerWheel();
+
+  /// \brief Create a timer wheel with its own timer thread
+  ///
+  /// \param tick the wheel resolution; timers fire no earlier than their
+  ///        deadline rounded up to the next tick
+  /// \param num_slots the number of wheel slots; a power of two close to the
+  ///        expected number of in-flight timers divided by ticks-per-rotation
+  ///        keeps slot scans short
+  static Result<std::shared_ptr<TimerWheel>> Make(
+      Clock::duration tick = std::chrono::microseconds(100), int num_slots = 512);
+
+  /// \brief Return the process-wide timer wheel, with default resolution
+  static TimerWheel* GetGlobalWheel();
+
+  /// \brief Return a future that completes at the given deadline
+  Future<> ScheduleAt(Clock::time_point deadline) {
+    return ScheduleAt(deadline, NULLPTR);
+  }
+
+  /// \brief Return a future that completes after the given delay
+  Future<> ScheduleAfter(Clock::duration delay) {
+    return ScheduleAt(Clock::now() + delay);
+  }
+
+  /// \brief Schedule a cancellable timer
+  ///
+  /// `*handle` is set to a handle that can be used to cancel the timer.
+  Future<> ScheduleAt(Clock::time_point deadline, TimerHandle* handle);
+
+  /// \brief Stop the timer thread, failing all pending timers with
+  /// Status::Cancelled
+  void Shutdown();
+
+ private:
+  TimerWheel(Clock::duration tick, int num_slots);
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(TimerWheel);
+
+  std::shared_ptr<TimerWheelState> state_;
+};
+
+}  // namespace internal
+}  // namespace arrow
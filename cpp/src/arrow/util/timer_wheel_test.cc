@@ -0,0 +1,116 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/timer_wheel.h"
+
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/future_util.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/config.h"
+#include "arrow/util/thread_pool.h"
+
+namespace arrow {
+namespace internal {
+
+#ifdef ARROW_ENABLE_THREADING
+
+using Clock = TimerWheel::Clock;
+
+TEST(TimerWheel, Basics) {
+  ASSERT_OK_AND_ASSIGN(auto wheel, TimerWheel::Make(std::chrono::milliseconds(1)));
+  const auto start = Clock::now();
+  auto fut = wheel->ScheduleAfter(std::chrono::milliseconds(5));
+  ASSERT_FINISHES_OK(fut);
+  ASSERT_GE(Clock::now() - start, std::chrono::milliseconds(5));
+}
+
+TEST(TimerWheel, AlreadyExpired) {
+  ASSERT_OK_AND_ASSIGN(auto wheel, TimerWheel::Make(std::chrono::milliseconds(1)));
+  auto fut = wheel->ScheduleAt(Clock::now() - std::chrono::seconds(1));
+  ASSERT_TRUE(fut.is_finished());
+  ASSERT_FINISHES_OK(fut);
+}
+
+TEST(TimerWheel, Cancel) {
+  ASSERT_OK_AND_ASSIGN(auto wheel, TimerWheel::Make(std::chrono::milliseconds(1)));
+  TimerHandle handle;
+  auto fut = wheel->ScheduleAt(Clock::now() + std::chrono::hours(1), &handle);
+  ASSERT_FALSE(fut.is_finished());
+  handle.Cancel();
+  ASSERT_TRUE(fut.is_finished());
+  ASSERT_FINISHES_AND_RAISES(Cancelled, fut);
+  // Cancelling again is a no-op
+  handle.Cancel();
+}
+
+TEST(TimerWheel, CancelAfterFire) {
+  ASSERT_OK_AND_ASSIGN(auto wheel, TimerWheel::Make(std::chrono::milliseconds(1)));
+  TimerHandle handle;
+  auto fut = wheel->ScheduleAt(Clock::now() + std::chrono::milliseconds(1), &handle);
+  ASSERT_FINISHES_OK(fut);
+  // Cancelling a fired timer does not change its result
+  handle.Cancel();
+  ASSERT_OK(fut.status());
+}
+
+TEST(TimerWheel, ManyConcurrentTimers) {
+  // Far more timers than wheel slots, scattered across deadlines, sharing the
+  // single timer thread
+  ASSERT_OK_AND_ASSIGN(auto wheel,
+                       TimerWheel::Make(std::chrono::microseconds(500), /*num_slots=*/16));
+  constexpr int kNumTimers = 1000;
+  std::vector<Future<>> futures;
+  futures.reserve(kNumTimers);
+  for (int i = 0; i < kNumTimers; ++i) {
+    futures.push_back(
+        wheel->ScheduleAfter(std::chrono::microseconds(100 + 37 * (i % 100))));
+  }
+  ASSERT_FINISHES_OK(AllComplete(futures));
+}
+
+TEST(TimerWheel, ShutdownFailsPending) {
+  ASSERT_OK_AND_ASSIGN(auto wheel, TimerWheel::Make(std::chrono::milliseconds(1)));
+  auto fut = wheel->ScheduleAt(Clock::now() + std::chrono::hours(1));
+  wheel->Shutdown();
+  ASSERT_FINISHES_AND_RAISES(Cancelled, fut);
+  // Scheduling after shutdown fails immediately
+  auto late = wheel->ScheduleAfter(std::chrono::milliseconds(1));
+  ASSERT_TRUE(late.is_finished());
+  ASSERT_FINISHES_AND_RAISES(Cancelled, late);
+}
+
+TEST(TimerWheel, ExecutorScheduleAt) {
+  ASSERT_OK_AND_ASSIGN(auto pool, ThreadPool::Make(2));
+  std::atomic<bool> ran{false};
+  auto fut = pool->ScheduleAfter(std::chrono::milliseconds(2)).Then([&ran, &pool] {
+    ASSERT_TRUE(pool->OwnsThisThread());
+    ran.store(true);
+  });
+  ASSERT_FINISHES_OK(fut);
+  ASSERT_TRUE(ran.load());
+  ASSERT_OK(pool->Shutdown());
+}
+
+#endif  // ARROW_ENABLE_THREADING
+
+}  // namespace internal
+}  // namespace arrow
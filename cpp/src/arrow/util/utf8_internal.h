@@ -29,6 +29,7 @@
 #endif
 
 #include "arrow/type_fwd.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/simd.h"
 #include "arrow/util/ubsan.h"
@@ -556,9 +557,18 @@ static inline bool UTF8AllOf(const uint8_t* first, const uint8_t* last, bool* re
 
 /// Count the number of codepoints in the given string (assuming it is valid UTF8).
 static inline int64_t UTF8Length(const uint8_t* first, const uint8_t* last) {
-  int64_t length = 0;
+  int64_t length = last - first;
+  // Count continuation bytes a word at a time.  A byte is a continuation
+  // iff its upper two bits are 10, i.e. bit 7 is set and bit 6 is clear;
+  // `w & ~(w << 1)` leaves bit 7 set exactly for such bytes.
+  while (last - first >= 8) {
+    const uint64_t w = SafeLoadAs<uint64_t>(first);
+    const uint64_t continuations = w & ~(w << 1) & 0x8080808080808080ULL;
+    length -= bit_util::PopCount(continuations);
+    first += 8;
+  }
   while (first != last) {
-    length += ((*first++ & 0xc0) != 0x80);
+    length -= ((*first++ & 0xc0) == 0x80);
   }
   return length;
 }
@@ -32,7 +32,9 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
+#include "arrow/util/endian.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/ubsan.h"
 #include "arrow/util/time.h"
 #include "arrow/util/visibility.h"
 #include "arrow/vendored/datetime.h"
@@ -184,6 +186,55 @@ struct StringConverter<HalfFloatType> {
 
 inline uint8_t ParseDecimalDigit(char c) { return static_cast<uint8_t>(c - '0'); }
 
+// SWAR (SIMD within a register) conversion of fixed-size digit groups.
+// A group of digit characters is loaded into a machine word, validated with
+// a couple of mask operations, then combined into a number with three
+// multiply-and-shift steps instead of one multiply-add per digit.
+// See https://johnnylee-sde.github.io/Fast-numeric-string-to-int/
+
+inline bool ParseTwoDigits(const char* s, uint8_t* out) {
+  const uint8_t d0 = ParseDecimalDigit(s[0]);
+  const uint8_t d1 = ParseDecimalDigit(s[1]);
+  if (ARROW_PREDICT_FALSE(d0 > 9U || d1 > 9U)) {
+    /* Non-digit */
+    return false;
+  }
+  *out = static_cast<uint8_t>(d0 * 10U + d1);
+  return true;
+}
+
+inline bool ParseFourDigits(const char* s, uint16_t* out) {
+  uint32_t bytes = bit_util::FromLittleEndian(
+      util::SafeLoadAs<uint32_t>(reinterpret_cast<const uint8_t*>(s)));
+  bytes -= 0x30303030U;
+  // Each byte must now be in [0, 9]: a set high nibble flags a character
+  // below '0' or above '?', adding 6 flags the ':' to '?' range.
+  if (ARROW_PREDICT_FALSE(((bytes | (bytes + 0x06060606U)) & 0xF0F0F0F0U) != 0)) {
+    /* Non-digit */
+    return false;
+  }
+  const uint32_t pairs = ((bytes * ((10U << 8) + 1U)) >> 8) & 0x00FF00FFU;
+  *out = static_cast<uint16_t>((pairs * ((100U << 16) + 1U)) >> 16);
+  return true;
+}
+
+inline bool ParseEightDigits(const char* s, uint32_t* out) {
+  uint64_t bytes = bit_util::FromLittleEndian(
+      util::SafeLoadAs<uint64_t>(reinterpret_cast<const uint8_t*>(s)));
+  bytes -= 0x3030303030303030ULL;
+  if (ARROW_PREDICT_FALSE(
+          ((bytes | (bytes + 0x0606060606060606ULL)) & 0xF0F0F0F0F0F0F0F0ULL) != 0)) {
+    /* Non-digit */
+    return false;
+  }
+  const uint64_t pairs =
+      ((bytes * ((10ULL << 8) + 1ULL)) >> 8) & 0x00FF00FF00FF00FFULL;
+  const uint64_t quads =
+      ((pairs * ((100ULL << 16) + 1ULL)) >> 16) & 0x0000FFFF0000FFFFULL;
+  *out = static_cast<uint32_t>((quads * ((10000ULL << 32) + 1ULL)) >> 32);
+  return true;
+}
+
 #define PARSE_UNSIGNED_ITERATION(C_TYPE)          \
   if (length > 0) {                               \
     uint8_t digit = ParseDecimalDigit(*s++);      \
@@ -249,6 +300,21 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
 
 inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
   uint32_t result = 0;
+  // Eight leading digits can be converted as a group, leaving at most
+  // two trailing digits (the usual overflow checks still apply to them).
+  if (length >= 8) {
+    if (ARROW_PREDICT_FALSE(!ParseEightDigits(s, &result))) {
+      return false;
+    }
+    s += 8;
+    length -= 8;
+    do {
+      PARSE_UNSIGNED_ITERATION(uint32_t);
+      PARSE_UNSIGNED_ITERATION_LAST(uint32_t);
+    } while (false);
+    *out = result;
+    return true;
+  }
   do {
     PARSE_UNSIGNED_ITERATION(uint32_t);
     PARSE_UNSIGNED_ITERATION(uint32_t);
@@ -269,6 +335,45 @@ inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
 
 inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
   uint64_t result = 0;
+  // Convert up to two groups of eight leading digits at once.  The value of
+  // the leading sixteen digits always fits a uint64; the usual overflow
+  // checks apply to the at most four digits that may follow two full groups.
+  if (length >= 8) {
+    uint32_t group = 0;
+    if (ARROW_PREDICT_FALSE(!ParseEightDigits(s, &group))) {
+      return false;
+    }
+    result = group;
+    s += 8;
+    length -= 8;
+    if (length >= 8) {
+      if (ARROW_PREDICT_FALSE(!ParseEightDigits(s, &group))) {
+        return false;
+      }
+      result = result * 100000000ULL + group;
+      s += 8;
+      length -= 8;
+      do {
+        PARSE_UNSIGNED_ITERATION(uint64_t);
+        PARSE_UNSIGNED_ITERATION(uint64_t);
+        PARSE_UNSIGNED_ITERATION(uint64_t);
+        PARSE_UNSIGNED_ITERATION_LAST(uint64_t);
+      } while (false);
+      *out = result;
+      return true;
+    }
+    do {
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION(uint64_t);
+      PARSE_UNSIGNED_ITERATION_LAST(uint64_t);
+    } while (false);
+    *out = result;
+    return true;
+  }
   do {
     PARSE_UNSIGNED_ITERATION(uint64_t);
     PARSE_UNSIGNED_ITERATION(uint64_t);
@@ -463,7 +568,7 @@ using ts_type = TimestampType::c_type;
 template <typename Duration>
 static inline bool ParseHH(const char* s, Duration* out) {
   uint8_t hours = 0;
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &hours))) {
+  if (ARROW_PREDICT_FALSE(!ParseTwoDigits(s + 0, &hours))) {
     return false;
   }
   if (ARROW_PREDICT_FALSE(hours >= 24)) {
@@ -480,10 +585,10 @@ static inline bool ParseHH_MM(const char* s, Duration* out) {
   if (ARROW_PREDICT_FALSE(s[2] != ':')) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &hours))) {
+  if (ARROW_PREDICT_FALSE(!ParseTwoDigits(s + 0, &hours))) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 3, 2, &minutes))) {
+  if (ARROW_PREDICT_FALSE(!ParseTwoDigits(s + 3, &minutes))) {
     return false;
   }
   if (ARROW_PREDICT_FALSE(hours >= 24)) {
@@ -501,10 +606,10 @@ template <typename Duration>
 static inline bool ParseHHMM(const char* s, Duration* out) {
   uint8_t hours = 0;
   uint8_t minutes = 0;
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &hours))) {
+  if (ARROW_PREDICT_FALSE(!ParseTwoDigits(s + 0, &hours))) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 2, 2, &minutes))) {
+  if (ARROW_PREDICT_FALSE(!ParseTwoDigits(s + 2, &minutes))) {
     return false;
   }
   if (ARROW_PREDICT_FALSE(hours >= 24)) {
@@ -526,13 +631,13 @@ static inline bool ParseHH_MM_SS(const char* s, Duration* out) {
   if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 2, &hours))) {
+  if (ARROW_PREDICT_FALSE(!ParseTwoDigits(s + 0, &hours))) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 3, 2, &minutes))) {
+  if (ARROW_PREDICT_FALSE(!ParseTwoDigits(s + 3, &minutes))) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 6, 2, &seconds))) {
+  if (ARROW_PREDICT_FALSE(!ParseTwoDigits(s + 6, &seconds))) {
     return false;
   }
   if (ARROW_PREDICT_FALSE(hours >= 24)) {
@@ -639,13 +744,13 @@ static inline bool ParseYYYY_MM_DD(const char* s, Duration* since_epoch) {
   if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 0, 4, &year))) {
+  if (ARROW_PREDICT_FALSE(!ParseFourDigits(s + 0, &year))) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 5, 2, &month))) {
+  if (ARROW_PREDICT_FALSE(!ParseTwoDigits(s + 5, &month))) {
     return false;
   }
-  if (ARROW_PREDICT_FALSE(!ParseUnsigned(s + 8, 2, &day))) {
+  if (ARROW_PREDICT_FALSE(!ParseTwoDigits(s + 8, &day))) {
     return false;
   }
   arrow_vendored::date::year_month_day ymd{arrow_vendored::date::year{year},
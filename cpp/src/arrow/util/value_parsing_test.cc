@@ -358,6 +358,7 @@ TEST(StringConversion, ToInt32) {
 
 TEST(StringConversion, ToUInt32) {
   AssertConversion<UInt32Type>("0", 0);
+  AssertConversion<UInt32Type>("12345678", 12345678UL);
   AssertConversion<UInt32Type>("432198765", 432198765UL);
   AssertConversion<UInt32Type>("4294967295", 4294967295UL);
   AssertConversion<UInt32Type>("04294967295", 4294967295UL);
@@ -367,6 +368,10 @@ TEST(StringConversion, ToUInt32) {
   AssertConversionFails<UInt32Type>("4294967296");
   AssertConversionFails<UInt32Type>("12345678901");
 
+  // Non-digits at various positions in an eight-digit group
+  AssertConversionFails<UInt32Type>("1234x678");
+  AssertConversionFails<UInt32Type>("12345678x");
+
   AssertConversionFails<UInt32Type>("");
   AssertConversionFails<UInt32Type>("-");
   AssertConversionFails<UInt32Type>("0.0");
@@ -415,11 +420,19 @@ TEST(StringConversion, ToInt64) {
 
 TEST(StringConversion, ToUInt64) {
   AssertConversion<UInt64Type>("0", 0);
+  AssertConversion<UInt64Type>("123456789", 123456789ULL);
+  AssertConversion<UInt64Type>("123456789012345", 123456789012345ULL);
+  AssertConversion<UInt64Type>("1234567890123456789", 1234567890123456789ULL);
   AssertConversion<UInt64Type>("18446744073709551615", 18446744073709551615ULL);
 
   // Non-representable values
   AssertConversionFails<UInt64Type>("-1");
   AssertConversionFails<UInt64Type>("18446744073709551616");
+  AssertConversionFails<UInt64Type>("184467440737095516150");
+
+  // Non-digits at various positions in an eight-digit group
+  AssertConversionFails<UInt64Type>("1234567890123x5678");
+  AssertConversionFails<UInt64Type>("123456789012345678x");
 
   AssertConversionFails<UInt64Type>("");
   AssertConversionFails<UInt64Type>("-");
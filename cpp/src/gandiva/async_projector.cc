@@ -0,0 +1,126 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/async_projector.h"
+
+#include <utility>
+
+#include "arrow/array/util.h"
+#include "arrow/compute/exec.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/thread_pool.h"
+
+#include "gandiva/expr_converter.h"
+
+namespace gandiva {
+
+AsyncProjector::AsyncProjector(SchemaPtr schema,
+                               std::vector<arrow::compute::Expression> bound_exprs,
+                               arrow::Future<std::shared_ptr<Projector>> compiled)
+    : schema_(std::move(schema)),
+      bound_exprs_(std::move(bound_exprs)),
+      compiled_(std::move(compiled)) {}
+
+Status AsyncProjector::Make(SchemaPtr schema, const ExpressionVector& exprs,
+                            std::shared_ptr<Configuration> configuration,
+                            std::shared_ptr<AsyncProjector>* projector) {
+  ARROW_RETURN_IF(schema == nullptr, Status::Invalid("Schema cannot be null"));
+  ARROW_RETURN_IF(exprs.empty(), Status::Invalid("Expressions cannot be empty"));
+  ARROW_RETURN_IF(configuration == nullptr,
+                  Status::Invalid("Configuration cannot be null"));
+
+  // Try to translate every expression. Interpretation is all-or-nothing: a
+  // partially interpreted batch would still block on compilation anyway.
+  std::vector<arrow::compute::Expression> bound_exprs;
+  bound_exprs.reserve(exprs.size());
+  bool interpretable = true;
+  for (auto& expr : exprs) {
+    auto maybe_converted = ToComputeExpression(expr->root());
+    if (!maybe_converted.ok()) {
+      interpretable = false;
+      break;
+    }
+    auto maybe_bound = maybe_converted->Bind(*schema);
+    if (!maybe_bound.ok() || !maybe_bound->type()->Equals(*expr->result()->type())) {
+      // No kernel available, or the kernel would promote to a different
+      // output type than the compiled expression.
+      interpretable = false;
+      break;
+    }
+    bound_exprs.push_back(*std::move(maybe_bound));
+  }
+
+  if (!interpretable) {
+    // Compile in the foreground, like Projector::Make.
+    std::shared_ptr<Projector> compiled;
+    ARROW_RETURN_NOT_OK(Projector::Make(schema, exprs, configuration, &compiled));
+    *projector = std::shared_ptr<AsyncProjector>(new AsyncProjector(
+        std::move(schema), {},
+        arrow::Future<std::shared_ptr<Projector>>::MakeFinished(std::move(compiled))));
+    return Status::OK();
+  }
+
+  auto compiled_future = arrow::DeferNotOk(arrow::internal::GetCpuThreadPool()->Submit(
+      [schema, exprs, configuration]() -> arrow::Result<std::shared_ptr<Projector>> {
+        std::shared_ptr<Projector> compiled;
+        ARROW_RETURN_NOT_OK(Projector::Make(schema, exprs, configuration, &compiled));
+        return compiled;
+      }));
+  *projector = std::shared_ptr<AsyncProjector>(new AsyncProjector(
+      std::move(schema), std::move(bound_exprs), std::move(compiled_future)));
+  return Status::OK();
+}
+
+Status AsyncProjector::Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                                arrow::ArrayVector* output) const {
+  ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
+  if (bound_exprs_.empty() || compiled_.is_finished()) {
+    ARROW_ASSIGN_OR_RAISE(auto compiled, compiled_.result());
+    return compiled->Evaluate(batch, pool, output);
+  }
+
+  ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
+                  Status::Invalid("Schema of batch must match the schema of the schema "
+                                  "on which the projector was built"));
+  arrow::compute::ExecContext exec_context(pool);
+  ARROW_ASSIGN_OR_RAISE(
+      auto input, arrow::compute::MakeExecBatch(*schema_, arrow::Datum(batch)));
+  arrow::ArrayVector results;
+  results.reserve(bound_exprs_.size());
+  for (const auto& bound_expr : bound_exprs_) {
+    ARROW_ASSIGN_OR_RAISE(arrow::Datum result, arrow::compute::ExecuteScalarExpression(
+                                                   bound_expr, input, &exec_context));
+    if (result.is_scalar()) {
+      ARROW_ASSIGN_OR_RAISE(
+          auto array,
+          arrow::MakeArrayFromScalar(*result.scalar(), batch.num_rows(), pool));
+      results.push_back(std::move(array));
+    } else {
+      results.push_back(result.make_array());
+    }
+  }
+  *output = std::move(results);
+  return Status::OK();
+}
+
+arrow::Result<std::shared_ptr<Projector>> AsyncProjector::WaitForCompilation() const {
+  return compiled_.result();
+}
+
+bool AsyncProjector::IsCompiled() const { return compiled_.is_finished(); }
+
+}  // namespace gandiva
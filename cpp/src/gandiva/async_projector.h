@@ -0,0 +1,88 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "arrow/compute/expression.h"
+#include "arrow/status.h"
+#include "arrow/util/future.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/configuration.h"
+#include "gandiva/expression.h"
+#include "gandiva/projector.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Projector that can evaluate batches before LLVM compilation
+/// finishes.
+///
+/// Make() starts LLVM compilation on a background thread and returns
+/// immediately. Until the compiled code is ready, Evaluate() interprets the
+/// expressions through arrow::compute, then hot-swaps to the compiled code
+/// for later batches. This trades some throughput on the first few batches
+/// for not paying the multi-second compilation latency up front.
+///
+/// If any expression has no compute equivalent (see expr_converter.h), Make()
+/// falls back to compiling in the foreground and behaves like Projector::Make.
+class GANDIVA_EXPORT AsyncProjector {
+ public:
+  /// Build an async projector for the given schema to evaluate the vector of
+  /// expressions.
+  ///
+  /// \param[in] schema schema for the record batches, and the expressions.
+  /// \param[in] exprs vector of expressions.
+  /// \param[in] configuration run time configuration.
+  /// \param[out] projector the returned projector object
+  static Status Make(SchemaPtr schema, const ExpressionVector& exprs,
+                     std::shared_ptr<Configuration> configuration,
+                     std::shared_ptr<AsyncProjector>* projector);
+
+  /// Evaluate the specified record batch, and return the allocated and
+  /// populated output arrays. The output arrays will be allocated from the
+  /// memory pool 'pool', and added to the vector 'output'.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate output arrays (if required).
+  /// \param[out] output the vector of allocated/populated arrays.
+  Status Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                  arrow::ArrayVector* output) const;
+
+  /// Wait for the background compilation to finish and return the compiled
+  /// projector.
+  arrow::Result<std::shared_ptr<Projector>> WaitForCompilation() const;
+
+  /// True once compilation has finished and Evaluate() delegates to the
+  /// compiled code.
+  bool IsCompiled() const;
+
+ private:
+  AsyncProjector(SchemaPtr schema, std::vector<arrow::compute::Expression> bound_exprs,
+                 arrow::Future<std::shared_ptr<Projector>> compiled);
+
+  SchemaPtr schema_;
+  /// Bound compute expressions, one per input expression; empty when Make()
+  /// fell back to foreground compilation.
+  std::vector<arrow::compute::Expression> bound_exprs_;
+  arrow::Future<std::shared_ptr<Projector>> compiled_;
+};
+
+}  // namespace gandiva
@@ -17,7 +17,12 @@
 
 #include "gandiva/cache.h"
 
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+
 #include "arrow/result.h"
+#include "arrow/util/hashing.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/value_parsing.h"
@@ -27,6 +32,12 @@ namespace gandiva {
 constexpr auto kCacheCapacityEnvVar = "GANDIVA_CACHE_SIZE";
 constexpr auto kDefaultCacheSize = 5000;
 
+constexpr auto kObjectCodeCacheDirEnvVar = "GANDIVA_OBJECT_CACHE_DIR";
+
+// Layout of a cache file: magic, little-endian uint32 fingerprint length, the
+// fingerprint itself, then the object code until end of file.
+constexpr char kObjectCodeCacheMagic[8] = {'G', 'D', 'V', 'O', 'B', 'J', '0', '1'};
+
 namespace internal {
 int GetCacheCapacityFromEnvVar() {
   auto maybe_env_value = ::arrow::internal::GetEnvVar(kCacheCapacityEnvVar);
@@ -47,6 +58,14 @@ int GetCacheCapacityFromEnvVar() {
   }
   return capacity;
 }
+
+std::string GetObjectCodeCacheDirFromEnvVar() {
+  auto maybe_env_value = ::arrow::internal::GetEnvVar(kObjectCodeCacheDirEnvVar);
+  if (!maybe_env_value.ok()) {
+    return "";
+  }
+  return *std::move(maybe_env_value);
+}
 }  // namespace internal
 
 int GetCacheCapacity() {
@@ -54,8 +73,141 @@ int GetCacheCapacity() {
   return capacity;
 }
 
+const std::string& GetObjectCodeCacheDir() {
+  static const std::string cache_dir = internal::GetObjectCodeCacheDirFromEnvVar();
+  return cache_dir;
+}
+
 void LogCacheSize(size_t capacity) {
   ARROW_LOG(INFO) << "Creating gandiva cache with capacity of " << capacity;
 }
 
+ObjectCodeFileCache::ObjectCodeFileCache(std::string cache_dir)
+    : cache_dir_(std::move(cache_dir)) {}
+
+std::shared_ptr<ObjectCodeFileCache> ObjectCodeFileCache::GetInstance() {
+  static const std::shared_ptr<ObjectCodeFileCache> instance =
+      []() -> std::shared_ptr<ObjectCodeFileCache> {
+    const std::string& cache_dir = GetObjectCodeCacheDir();
+    if (cache_dir.empty()) {
+      return nullptr;
+    }
+    auto maybe_name = ::arrow::internal::PlatformFilename::FromString(cache_dir);
+    if (maybe_name.ok()) {
+      auto maybe_created = ::arrow::internal::CreateDirTree(*maybe_name);
+      if (maybe_created.ok()) {
+        ARROW_LOG(INFO) << "Persisting gandiva object code in " << cache_dir;
+        return std::make_shared<ObjectCodeFileCache>(cache_dir);
+      }
+    }
+    ARROW_LOG(WARNING) << "Cannot use directory provided in "
+                       << kObjectCodeCacheDirEnvVar << " ('" << cache_dir
+                       << "'). Disabling the persistent object code cache.";
+    return nullptr;
+  }();
+  return instance;
+}
+
+std::string ObjectCodeFileCache::PathFor(const std::string& fingerprint) const {
+  // The file name only needs to spread entries out; the fingerprint stored in
+  // the file is what authoritatively identifies an entry.
+  const uint64_t h = ::arrow::internal::ComputeStringHash<0>(
+      fingerprint.data(), static_cast<int64_t>(fingerprint.size()));
+  char name[32];
+  snprintf(name, sizeof(name), "gdv-%016llx.cache",
+           static_cast<unsigned long long>(h));  // NOLINT runtime/int
+  return cache_dir_ + "/" + name;
+}
+
+std::optional<std::string> ObjectCodeFileCache::Get(const std::string& fingerprint) {
+  const std::string path = PathFor(fingerprint);
+  auto maybe_name = ::arrow::internal::PlatformFilename::FromString(path);
+  if (!maybe_name.ok()) {
+    return std::nullopt;
+  }
+  auto maybe_exists = ::arrow::internal::FileExists(*maybe_name);
+  if (!maybe_exists.ok() || !*maybe_exists) {
+    return std::nullopt;
+  }
+  auto maybe_fd = ::arrow::internal::FileOpenReadable(*maybe_name);
+  if (!maybe_fd.ok()) {
+    ARROW_LOG(WARNING) << "Failed opening cached object code file '" << path
+                       << "': " << maybe_fd.status().ToString();
+    return std::nullopt;
+  }
+  auto fd = *std::move(maybe_fd);
+  auto maybe_size = ::arrow::internal::FileGetSize(fd.fd());
+  if (!maybe_size.ok()) {
+    return std::nullopt;
+  }
+  const int64_t file_size = *maybe_size;
+  const int64_t header_size =
+      static_cast<int64_t>(sizeof(kObjectCodeCacheMagic) + sizeof(uint32_t));
+  if (file_size < header_size + static_cast<int64_t>(fingerprint.size())) {
+    return std::nullopt;
+  }
+  std::string contents(static_cast<size_t>(file_size), '\0');
+  auto maybe_read = ::arrow::internal::FileRead(
+      fd.fd(), reinterpret_cast<uint8_t*>(contents.data()), file_size);
+  if (!maybe_read.ok() || *maybe_read != file_size) {
+    ARROW_LOG(WARNING) << "Failed reading cached object code file '" << path << "'";
+    return std::nullopt;
+  }
+  if (memcmp(contents.data(), kObjectCodeCacheMagic, sizeof(kObjectCodeCacheMagic)) !=
+      0) {
+    return std::nullopt;
+  }
+  uint32_t fingerprint_length = 0;
+  memcpy(&fingerprint_length, contents.data() + sizeof(kObjectCodeCacheMagic),
+         sizeof(fingerprint_length));
+  if (fingerprint_length != fingerprint.size() ||
+      memcmp(contents.data() + header_size, fingerprint.data(), fingerprint.size()) !=
+          0) {
+    // File-name collision with another fingerprint, or a stale format
+    return std::nullopt;
+  }
+  return contents.substr(static_cast<size_t>(header_size) + fingerprint.size());
+}
+
+void ObjectCodeFileCache::Put(const std::string& fingerprint,
+                              std::string_view object_code) {
+  const std::string path = PathFor(fingerprint);
+  // Write to a unique temporary name, then rename into place so that
+  // concurrent readers (and other processes) never observe a torn entry.
+  static std::atomic<int64_t> counter{0};
+  const std::string tmp_path = path + ".tmp" + std::to_string(++counter);
+
+  auto status = [&]() -> ::arrow::Status {
+    ARROW_ASSIGN_OR_RAISE(
+        auto tmp_name, ::arrow::internal::PlatformFilename::FromString(tmp_path));
+    ARROW_ASSIGN_OR_RAISE(auto fd, ::arrow::internal::FileOpenWritable(tmp_name));
+    const auto fingerprint_length = static_cast<uint32_t>(fingerprint.size());
+    ARROW_RETURN_NOT_OK(::arrow::internal::FileWrite(
+        fd.fd(), reinterpret_cast<const uint8_t*>(kObjectCodeCacheMagic),
+        sizeof(kObjectCodeCacheMagic)));
+    ARROW_RETURN_NOT_OK(::arrow::internal::FileWrite(
+        fd.fd(), reinterpret_cast<const uint8_t*>(&fingerprint_length),
+        sizeof(fingerprint_length)));
+    ARROW_RETURN_NOT_OK(::arrow::internal::FileWrite(
+        fd.fd(), reinterpret_cast<const uint8_t*>(fingerprint.data()),
+        static_cast<int64_t>(fingerprint.size())));
+    ARROW_RETURN_NOT_OK(::arrow::internal::FileWrite(
+        fd.fd(), reinterpret_cast<const uint8_t*>(object_code.data()),
+        static_cast<int64_t>(object_code.size())));
+    ARROW_RETURN_NOT_OK(fd.Close());
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+      // Another process may have just installed the same entry; drop ours.
+      ARROW_ASSIGN_OR_RAISE(auto tmp_cleanup,
+                            ::arrow::internal::PlatformFilename::FromString(tmp_path));
+      ARROW_UNUSED(
+          ::arrow::internal::DeleteFile(tmp_cleanup, /*allow_not_found=*/true));
+    }
+    return ::arrow::Status::OK();
+  }();
+  if (!status.ok()) {
+    ARROW_LOG(WARNING) << "Failed persisting object code to '" << path
+                       << "': " << status.ToString();
+  }
+}
+
 }  // namespace gandiva
@@ -18,7 +18,11 @@
 #pragma once
 
 #include <cstdlib>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
 
 #include "arrow/util/macros.h"
 #include "gandiva/lru_cache.h"
@@ -32,14 +36,59 @@ namespace internal {
 // Also makes the testing easier.
 GANDIVA_EXPORT
 int GetCacheCapacityFromEnvVar();
+
+// Only called once by GetObjectCodeCacheDir().
+// Do the actual work of getting the cache directory from env var.
+// Also makes the testing easier.
+GANDIVA_EXPORT
+std::string GetObjectCodeCacheDirFromEnvVar();
 }  // namespace internal
 
 GANDIVA_EXPORT
 int GetCacheCapacity();
 
+// The directory used to persist compiled object code across processes, or an
+// empty string when persistence is disabled.
+GANDIVA_EXPORT
+const std::string& GetObjectCodeCacheDir();
+
 GANDIVA_EXPORT
 void LogCacheSize(size_t capacity);
 
+/// \brief File-backed store for compiled object code.
+///
+/// When the GANDIVA_OBJECT_CACHE_DIR environment variable points at a writable
+/// directory, compiled expressions are persisted there and survive process
+/// restarts, avoiding the LLVM compilation cost on warm starts.  Entries are
+/// keyed by a fingerprint string that must capture everything the object code
+/// depends on (expressions, schema, CPU features, gandiva version); the full
+/// fingerprint is stored inside each entry and verified on load, so hash
+/// collisions in file names degrade to cache misses.
+///
+/// All I/O errors are logged and treated as cache misses; this class never
+/// fails expression compilation.  Writes go through a temporary file followed
+/// by a rename, so concurrent processes sharing a directory see either the old
+/// or the new entry, never a torn one.
+class GANDIVA_EXPORT ObjectCodeFileCache {
+ public:
+  explicit ObjectCodeFileCache(std::string cache_dir);
+
+  /// The process-wide instance, or nullptr when persistence is disabled.
+  static std::shared_ptr<ObjectCodeFileCache> GetInstance();
+
+  /// Return the object code stored for this fingerprint, or nullopt on a miss
+  /// (including I/O errors and fingerprint mismatches).
+  std::optional<std::string> Get(const std::string& fingerprint);
+
+  /// Store object code under this fingerprint, replacing any previous entry.
+  void Put(const std::string& fingerprint, std::string_view object_code);
+
+ private:
+  std::string PathFor(const std::string& fingerprint) const;
+
+  std::string cache_dir_;
+};
+
 template <class KeyType, typename ValueType>
 class Cache {
  public:
@@ -105,4 +105,65 @@ TEST(TestCache, TestGetCacheCapacityEnvVar) {
   }
 }
 
+TEST(TestCache, TestObjectCodeCacheDirEnvVar) {
+  using ::arrow::EnvVarGuard;
+
+  // Unset or empty means disabled.
+  ASSERT_EQ(internal::GetObjectCodeCacheDirFromEnvVar(), "");
+  {
+    EnvVarGuard guard("GANDIVA_OBJECT_CACHE_DIR", "");
+    ASSERT_EQ(internal::GetObjectCodeCacheDirFromEnvVar(), "");
+  }
+  {
+    EnvVarGuard guard("GANDIVA_OBJECT_CACHE_DIR", "/some/dir");
+    ASSERT_EQ(internal::GetObjectCodeCacheDirFromEnvVar(), "/some/dir");
+  }
+}
+
+TEST(TestCache, TestObjectCodeFileCache) {
+  ASSERT_OK_AND_ASSIGN(auto tmp_dir, ::arrow::internal::TemporaryDir::Make("gandiva-"));
+  ObjectCodeFileCache file_cache(tmp_dir->path().ToString());
+
+  const std::string fingerprint = "expr: a + b\nschema: int32\nversion: test";
+  const std::string object_code("fake object code\0with embedded nul", 34);
+
+  // Miss before any Put.
+  ASSERT_EQ(file_cache.Get(fingerprint), std::nullopt);
+
+  file_cache.Put(fingerprint, object_code);
+  ASSERT_EQ(file_cache.Get(fingerprint), object_code);
+
+  // A different fingerprint is a miss.
+  ASSERT_EQ(file_cache.Get("some other fingerprint"), std::nullopt);
+
+  // Overwriting replaces the previous entry.
+  file_cache.Put(fingerprint, "new object code");
+  ASSERT_EQ(file_cache.Get(fingerprint), "new object code");
+
+  // A second cache instance over the same directory sees the entry, like
+  // another process would after a restart.
+  ObjectCodeFileCache other_cache(tmp_dir->path().ToString());
+  ASSERT_EQ(other_cache.Get(fingerprint), "new object code");
+}
+
+TEST(TestCache, TestObjectCodeFileCacheCorruptEntry) {
+  ASSERT_OK_AND_ASSIGN(auto tmp_dir, ::arrow::internal::TemporaryDir::Make("gandiva-"));
+  ObjectCodeFileCache file_cache(tmp_dir->path().ToString());
+
+  const std::string fingerprint = "some fingerprint";
+  file_cache.Put(fingerprint, "object code");
+  ASSERT_EQ(file_cache.Get(fingerprint), "object code");
+
+  // Truncate every file in the directory; the entry must degrade to a miss.
+  ASSERT_OK_AND_ASSIGN(auto entries, ::arrow::internal::ListDir(tmp_dir->path()));
+  for (const auto& entry : entries) {
+    ASSERT_OK_AND_ASSIGN(auto path, tmp_dir->path().Join(entry.ToString()));
+    ASSERT_OK_AND_ASSIGN(auto fd, ::arrow::internal::FileOpenWritable(path));
+    ASSERT_OK(::arrow::internal::FileWrite(
+        fd.fd(), reinterpret_cast<const uint8_t*>("garbage"), 7));
+    ASSERT_OK(fd.Close());
+  }
+  ASSERT_EQ(file_cache.Get(fingerprint), std::nullopt);
+}
+
 }  // namespace gandiva
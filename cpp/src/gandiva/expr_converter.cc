@@ -0,0 +1,164 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/expr_converter.h"
+
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "arrow/scalar.h"
+#include "gandiva/node.h"
+
+namespace gandiva {
+
+namespace {
+
+// Gandiva functions whose arrow::compute counterpart has identical semantics,
+// including overflow and null handling.  The checked variants and anything
+// involving holders or execution-context errors stay untranslated.
+const std::unordered_map<std::string, std::string>& FunctionNameMap() {
+  static const std::unordered_map<std::string, std::string> map = {
+      {"add", "add"},
+      {"subtract", "subtract"},
+      {"multiply", "multiply"},
+      {"equal", "equal"},
+      {"not_equal", "not_equal"},
+      {"less_than", "less"},
+      {"less_than_or_equal_to", "less_equal"},
+      {"greater_than", "greater"},
+      {"greater_than_or_equal_to", "greater_equal"},
+      {"isnull", "is_null"},
+      {"isnotnull", "is_valid"},
+      {"not", "invert"},
+  };
+  return map;
+}
+
+arrow::Result<std::shared_ptr<arrow::Scalar>> LiteralToScalar(const LiteralNode& node) {
+  if (node.is_null()) {
+    return arrow::MakeNullScalar(node.return_type());
+  }
+  std::shared_ptr<arrow::Scalar> scalar;
+  ARROW_RETURN_NOT_OK(std::visit(
+      [&](const auto& value) -> Status {
+        using ValueType = std::decay_t<decltype(value)>;
+        if constexpr (std::is_same_v<ValueType, DecimalScalar128>) {
+          return Status::NotImplemented("Cannot interpret decimal literal");
+        } else {
+          ARROW_ASSIGN_OR_RAISE(scalar, arrow::MakeScalar(node.return_type(), value));
+          return Status::OK();
+        }
+      },
+      node.holder()));
+  return scalar;
+}
+
+class ComputeExpressionBuilder : public NodeVisitor {
+ public:
+  arrow::Result<arrow::compute::Expression> Build(const Node& node) {
+    ARROW_RETURN_NOT_OK(node.Accept(*this));
+    return std::move(result_);
+  }
+
+  Status Visit(const FieldNode& node) override {
+    result_ = arrow::compute::field_ref(node.field()->name());
+    return Status::OK();
+  }
+
+  Status Visit(const LiteralNode& node) override {
+    ARROW_ASSIGN_OR_RAISE(auto scalar, LiteralToScalar(node));
+    result_ = arrow::compute::literal(std::move(scalar));
+    return Status::OK();
+  }
+
+  Status Visit(const FunctionNode& node) override {
+    const auto& map = FunctionNameMap();
+    auto found = map.find(node.descriptor()->name());
+    if (found == map.end()) {
+      return NotTranslatable(node);
+    }
+    ARROW_ASSIGN_OR_RAISE(auto arguments, BuildChildren(node.children()));
+    result_ = arrow::compute::call(found->second, std::move(arguments));
+    return Status::OK();
+  }
+
+  Status Visit(const IfNode& node) override {
+    // Gandiva takes the else branch on a null condition, whereas the compute
+    // "if_else" kernel produces null; the semantics do not match.
+    return NotTranslatable(node);
+  }
+
+  Status Visit(const BooleanNode& node) override {
+    ARROW_ASSIGN_OR_RAISE(auto arguments, BuildChildren(node.children()));
+    // Both gandiva and/or and the kleene kernels implement SQL semantics
+    result_ = node.expr_type() == BooleanNode::AND
+                  ? arrow::compute::and_(std::move(arguments))
+                  : arrow::compute::or_(std::move(arguments));
+    return Status::OK();
+  }
+
+  Status Visit(const InExpressionNode<int32_t>& node) override {
+    return NotTranslatable(node);
+  }
+  Status Visit(const InExpressionNode<int64_t>& node) override {
+    return NotTranslatable(node);
+  }
+  Status Visit(const InExpressionNode<float>& node) override {
+    return NotTranslatable(node);
+  }
+  Status Visit(const InExpressionNode<double>& node) override {
+    return NotTranslatable(node);
+  }
+  Status Visit(const InExpressionNode<gandiva::DecimalScalar128>& node) override {
+    return NotTranslatable(node);
+  }
+  Status Visit(const InExpressionNode<std::string>& node) override {
+    return NotTranslatable(node);
+  }
+
+ private:
+  Status NotTranslatable(const Node& node) {
+    return Status::NotImplemented("No compute equivalent for expression: ",
+                                  node.ToString());
+  }
+
+  arrow::Result<std::vector<arrow::compute::Expression>> BuildChildren(
+      const NodeVector& children) {
+    std::vector<arrow::compute::Expression> converted;
+    converted.reserve(children.size());
+    for (auto& child : children) {
+      ARROW_ASSIGN_OR_RAISE(auto expression, Build(*child));
+      converted.push_back(std::move(expression));
+    }
+    return converted;
+  }
+
+  arrow::compute::Expression result_;
+};
+
+}  // namespace
+
+arrow::Result<arrow::compute::Expression> ToComputeExpression(const NodePtr& node) {
+  ARROW_RETURN_IF(node == nullptr, Status::Invalid("Node cannot be null"));
+  ComputeExpressionBuilder builder;
+  return builder.Build(*node);
+}
+
+}  // namespace gandiva
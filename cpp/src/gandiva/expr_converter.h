@@ -0,0 +1,39 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/compute/expression.h"
+#include "arrow/result.h"
+
+#include "gandiva/gandiva_aliases.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+/// \brief Translate a gandiva expression tree into an equivalent arrow::compute
+/// expression.
+///
+/// Only the subset of nodes with a compute kernel of identical semantics is
+/// supported: field references, literals, basic arithmetic and comparisons,
+/// null checks, and boolean and/or/not.  Returns NotImplemented for anything
+/// else (e.g. if/else, whose null-condition semantics differ from the compute
+/// "if_else" kernel).  The returned expression is unbound.
+GANDIVA_EXPORT
+arrow::Result<arrow::compute::Expression> ToComputeExpression(const NodePtr& node);
+
+}  // namespace gandiva
@@ -50,6 +50,32 @@ class ExpressionCacheKey {
     hash_code_ = result;
   }
 
+  ExpressionCacheKey(SchemaPtr schema, std::shared_ptr<Configuration> configuration,
+                     Expression& condition, ExpressionVector expression_vector,
+                     SelectionVector::Mode mode)
+      : schema_(schema), mode_(mode), uniquifier_(0), configuration_(configuration) {
+    static const int kSeedValue = 4;
+    size_t result = kSeedValue;
+    // Prefix the condition so that a fused filter+project never collides with
+    // a plain projector over the same expression list (the generated modules
+    // differ even though the expression strings match).
+    std::string condition_as_string = "condition: " + condition.ToString();
+    expressions_as_strings_.push_back(condition_as_string);
+    arrow::internal::hash_combine(result, condition_as_string);
+    UpdateUniquifier(condition_as_string);
+    for (auto& expr : expression_vector) {
+      std::string expr_as_string = expr->ToString();
+      expressions_as_strings_.push_back(expr_as_string);
+      arrow::internal::hash_combine(result, expr_as_string);
+      UpdateUniquifier(expr_as_string);
+    }
+    arrow::internal::hash_combine(result, static_cast<size_t>(mode));
+    arrow::internal::hash_combine(result, configuration->Hash());
+    arrow::internal::hash_combine(result, schema_->ToString());
+    arrow::internal::hash_combine(result, uniquifier_);
+    hash_code_ = result;
+  }
+
   ExpressionCacheKey(SchemaPtr schema, std::shared_ptr<Configuration> configuration,
                      Expression& expression)
       : schema_(schema),
@@ -79,6 +105,22 @@ class ExpressionCacheKey {
 
   size_t Hash() const { return hash_code_; }
 
+  /// A stable textual description of this key.  Unlike Hash(), it does not go
+  /// through std::hash and is therefore reproducible across processes; it is
+  /// used as part of the fingerprint of the persistent object code cache.
+  std::string ToString() const {
+    std::string result = "schema: " + schema_->ToString();
+    result += "\nmode: " + std::to_string(static_cast<int>(mode_));
+    result += "\noptimize: " + std::to_string(configuration_->optimize());
+    result += "\ntarget_host_cpu: " + std::to_string(configuration_->target_host_cpu());
+    for (auto& expr : expressions_as_strings_) {
+      result += "\nexpression: " + expr;
+    }
+    return result;
+  }
+
+  const std::shared_ptr<Configuration>& configuration() const { return configuration_; }
+
   bool operator==(const ExpressionCacheKey& other) const {
     if (hash_code_ != other.hash_code_) {
       return false;
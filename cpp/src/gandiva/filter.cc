@@ -54,16 +54,15 @@ Status Filter::Make(SchemaPtr schema, ConditionPtr condition,
 
   bool is_cached = false;
 
-  std::shared_ptr<llvm::MemoryBuffer> prev_cached_obj;
-  prev_cached_obj = cache->GetObjectCode(cache_key);
+  GandivaObjectCache obj_cache(cache, cache_key);
 
-  // Verify if previous filter obj code was cached
+  // Verify if previous filter obj code was cached, in memory or on disk
+  std::shared_ptr<llvm::MemoryBuffer> prev_cached_obj;
+  prev_cached_obj = obj_cache.GetCachedObjectCode();
   if (prev_cached_obj != nullptr) {
     is_cached = true;
   }
 
-  GandivaObjectCache obj_cache(cache, cache_key);
-
   // Build LLVM generator, and generate code for the specified expression
   ARROW_ASSIGN_OR_RAISE(auto llvm_gen,
                         LLVMGenerator::Make(configuration, is_cached, obj_cache));
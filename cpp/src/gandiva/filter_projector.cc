@@ -0,0 +1,182 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/filter_projector.h"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "gandiva/cache.h"
+#include "gandiva/expr_validator.h"
+#include "gandiva/llvm_generator.h"
+#include "gandiva/projector.h"
+
+namespace gandiva {
+
+FilterProjector::FilterProjector(std::unique_ptr<LLVMGenerator> llvm_generator,
+                                 SchemaPtr schema, const FieldVector& output_fields,
+                                 SelectionVector::Mode selection_vector_mode,
+                                 std::shared_ptr<Configuration> configuration)
+    : llvm_generator_(std::move(llvm_generator)),
+      schema_(schema),
+      output_fields_(output_fields),
+      selection_vector_mode_(selection_vector_mode),
+      configuration_(configuration) {}
+
+FilterProjector::~FilterProjector() {}
+
+Status FilterProjector::Make(SchemaPtr schema, ConditionPtr condition,
+                             const ExpressionVector& exprs,
+                             SelectionVector::Mode selection_vector_mode,
+                             std::shared_ptr<Configuration> configuration,
+                             std::shared_ptr<FilterProjector>* filter_projector) {
+  ARROW_RETURN_IF(schema == nullptr, Status::Invalid("Schema cannot be null"));
+  ARROW_RETURN_IF(condition == nullptr, Status::Invalid("Condition cannot be null"));
+  ARROW_RETURN_IF(exprs.empty(), Status::Invalid("Expressions cannot be empty"));
+  ARROW_RETURN_IF(selection_vector_mode == SelectionVector::MODE_NONE,
+                  Status::Invalid("Selection vector mode cannot be MODE_NONE"));
+  ARROW_RETURN_IF(configuration == nullptr,
+                  Status::Invalid("Configuration cannot be null"));
+
+  // see if an equivalent filter-projector was already built
+  std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>> cache =
+      LLVMGenerator::GetCache();
+
+  ExpressionCacheKey cache_key(schema, configuration, *condition, exprs,
+                               selection_vector_mode);
+
+  bool is_cached = false;
+
+  GandivaObjectCache obj_cache(cache, cache_key);
+
+  // Verify if previous obj code was cached, in memory or on disk
+  std::shared_ptr<llvm::MemoryBuffer> prev_cached_obj;
+  prev_cached_obj = obj_cache.GetCachedObjectCode();
+  if (prev_cached_obj != nullptr) {
+    is_cached = true;
+  }
+
+  // Build LLVM generator, and generate code for the condition and expressions
+  ARROW_ASSIGN_OR_RAISE(auto llvm_gen,
+                        LLVMGenerator::Make(configuration, is_cached, obj_cache));
+
+  // Run the validation on the condition and the expressions.
+  // Return if any of them is invalid since we will not be able to
+  // process further.
+  if (!is_cached) {
+    ExprValidator expr_validator(llvm_gen->types(), schema,
+                                 configuration->function_registry());
+    ARROW_RETURN_NOT_OK(expr_validator.Validate(condition));
+    for (auto& expr : exprs) {
+      ARROW_RETURN_NOT_OK(expr_validator.Validate(expr));
+    }
+  }
+
+  // Set the object cache for LLVM
+  ARROW_RETURN_NOT_OK(llvm_gen->SetLLVMObjectCache(obj_cache));
+
+  ARROW_RETURN_NOT_OK(
+      llvm_gen->BuildFilterProject(condition, exprs, selection_vector_mode));
+
+  // save the output field types. Used for the output allocation at Evaluate() time.
+  std::vector<FieldPtr> output_fields;
+  output_fields.reserve(exprs.size());
+  for (auto& expr : exprs) {
+    output_fields.push_back(expr->result());
+  }
+
+  // Instantiate the filter-projector with the completely built llvm generator
+  *filter_projector = std::shared_ptr<FilterProjector>(
+      new FilterProjector(std::move(llvm_gen), schema, output_fields,
+                          selection_vector_mode, configuration));
+  filter_projector->get()->SetBuiltFromCache(is_cached);
+
+  return Status::OK();
+}
+
+Status FilterProjector::Evaluate(const arrow::RecordBatch& batch,
+                                 arrow::MemoryPool* pool, arrow::ArrayVector* output) {
+  const auto num_rows = batch.num_rows();
+  ARROW_RETURN_IF(!batch.schema()->Equals(*schema_),
+                  Status::Invalid("Schema in RecordBatch must match schema in Make()"));
+  ARROW_RETURN_IF(num_rows == 0, Status::Invalid("RecordBatch must be non-empty."));
+  ARROW_RETURN_IF(output == nullptr, Status::Invalid("Output must be non-null."));
+  ARROW_RETURN_IF(pool == nullptr, Status::Invalid("Memory pool must be non-null."));
+
+  // Grow (or create) the scratch selection vector; it is reused across batches.
+  if (selection_vector_ == nullptr || selection_vector_->GetMaxSlots() < num_rows) {
+    switch (selection_vector_mode_) {
+      case SelectionVector::MODE_UINT16:
+        ARROW_RETURN_NOT_OK(
+            SelectionVector::MakeInt16(num_rows, pool, &selection_vector_));
+        break;
+      case SelectionVector::MODE_UINT32:
+        ARROW_RETURN_NOT_OK(
+            SelectionVector::MakeInt32(num_rows, pool, &selection_vector_));
+        break;
+      case SelectionVector::MODE_UINT64:
+        ARROW_RETURN_NOT_OK(
+            SelectionVector::MakeInt64(num_rows, pool, &selection_vector_));
+        break;
+      default:
+        return Status::Invalid("Unsupported selection vector mode ",
+                               selection_vector_mode_);
+    }
+  }
+
+  // Allocate the output data vecs : the condition's boolean output first,
+  // followed by one output per expression. The projection outputs are sized
+  // for the full batch since the number of selected rows isn't known yet.
+  ArrayDataVector output_data_vecs;
+  output_data_vecs.reserve(output_fields_.size() + 1);
+
+  ArrayDataPtr condition_data;
+  ARROW_RETURN_NOT_OK(
+      internal::AllocOutputArrayData(arrow::boolean(), num_rows, pool, &condition_data));
+  output_data_vecs.push_back(condition_data);
+
+  for (auto& field : output_fields_) {
+    ArrayDataPtr output_data;
+    ARROW_RETURN_NOT_OK(
+        internal::AllocOutputArrayData(field->type(), num_rows, pool, &output_data));
+    output_data_vecs.push_back(output_data);
+  }
+
+  // Execute the condition and the expression(s).
+  ARROW_RETURN_NOT_OK(llvm_generator_->ExecuteFilterProject(
+      batch, selection_vector_.get(), output_data_vecs));
+
+  // The projections wrote only the selected rows; trim the lengths and return
+  // the arrays (skipping the condition output).
+  const auto num_output_rows = selection_vector_->GetNumSlots();
+  output->clear();
+  for (size_t idx = 1; idx < output_data_vecs.size(); ++idx) {
+    auto& array_data = output_data_vecs[idx];
+    array_data->length = num_output_rows;
+    output->push_back(arrow::MakeArray(array_data));
+  }
+  return Status::OK();
+}
+
+const std::string& FilterProjector::DumpIR() { return llvm_generator_->ir(); }
+
+void FilterProjector::SetBuiltFromCache(bool flag) { built_from_cache_ = flag; }
+
+bool FilterProjector::GetBuiltFromCache() { return built_from_cache_; }
+
+}  // namespace gandiva
@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/status.h"
+
+#include "gandiva/arrow.h"
+#include "gandiva/condition.h"
+#include "gandiva/configuration.h"
+#include "gandiva/expression.h"
+#include "gandiva/selection_vector.h"
+#include "gandiva/visibility.h"
+
+namespace gandiva {
+
+class LLVMGenerator;
+
+/// \brief fused filter and projection using expressions.
+///
+/// A FilterProjector combines a filter condition and a vector of projection
+/// expressions into a single compiled module : the condition and the
+/// projections share one LLVM compilation (and one cache entry), and the
+/// selection vector stays an internal scratch buffer that is piped directly
+/// from the condition to the projections. Once built, it can be used to
+/// evaluate many row batches.
+class GANDIVA_EXPORT FilterProjector {
+ public:
+  // Inline dtor will attempt to resolve the destructor for
+  // LLVMGenerator on MSVC, so we compile the dtor in the object code
+  ~FilterProjector();
+
+  /// Build a filter-projector for the given schema, condition and expressions,
+  /// with the default configuration.
+  ///
+  /// \param[in] schema schema for the record batches, the condition and the expressions.
+  /// \param[in] condition filter condition.
+  /// \param[in] exprs vector of projection expressions.
+  /// \param[in] selection_vector_mode mode of the internal selection vector. Must be
+  ///            wide enough to index all rows of the evaluated batches.
+  /// \param[out] filter_projector the returned filter-projector object
+  static Status Make(SchemaPtr schema, ConditionPtr condition,
+                     const ExpressionVector& exprs,
+                     SelectionVector::Mode selection_vector_mode,
+                     std::shared_ptr<FilterProjector>* filter_projector) {
+    return Make(schema, condition, exprs, selection_vector_mode,
+                ConfigurationBuilder::DefaultConfiguration(), filter_projector);
+  }
+
+  /// \brief Build a filter-projector for the given schema, condition and expressions.
+  /// Customize the filter-projector with runtime configuration.
+  ///
+  /// \param[in] schema schema for the record batches, the condition and the expressions.
+  /// \param[in] condition filter condition.
+  /// \param[in] exprs vector of projection expressions.
+  /// \param[in] selection_vector_mode mode of the internal selection vector. Must be
+  ///            wide enough to index all rows of the evaluated batches.
+  /// \param[in] configuration run time configuration.
+  /// \param[out] filter_projector the returned filter-projector object
+  static Status Make(SchemaPtr schema, ConditionPtr condition,
+                     const ExpressionVector& exprs,
+                     SelectionVector::Mode selection_vector_mode,
+                     std::shared_ptr<Configuration> configuration,
+                     std::shared_ptr<FilterProjector>* filter_projector);
+
+  /// Evaluate the specified record batch, and return the populated output arrays for
+  /// the rows that match the condition. The output arrays will be allocated from the
+  /// memory pool 'pool', and added to the vector 'output'.
+  ///
+  /// \param[in] batch the record batch. schema should be the same as the one in 'Make'
+  /// \param[in] pool memory pool used to allocate output arrays (if required).
+  /// \param[out] output the vector of allocated/populated arrays, one per expression.
+  Status Evaluate(const arrow::RecordBatch& batch, arrow::MemoryPool* pool,
+                  arrow::ArrayVector* output);
+
+  const std::string& DumpIR();
+
+  void SetBuiltFromCache(bool flag);
+
+  bool GetBuiltFromCache();
+
+ private:
+  FilterProjector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
+                  const FieldVector& output_fields,
+                  SelectionVector::Mode selection_vector_mode,
+                  std::shared_ptr<Configuration> configuration);
+
+  std::unique_ptr<LLVMGenerator> llvm_generator_;
+  SchemaPtr schema_;
+  FieldVector output_fields_;
+  SelectionVector::Mode selection_vector_mode_;
+  std::shared_ptr<Configuration> configuration_;
+  bool built_from_cache_;
+
+  // scratch selection vector, resized on demand and reused across batches.
+  std::shared_ptr<SelectionVector> selection_vector_;
+};
+
+}  // namespace gandiva
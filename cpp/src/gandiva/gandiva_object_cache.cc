@@ -17,16 +17,70 @@
 
 #include "gandiva/gandiva_object_cache.h"
 
+#include <algorithm>
 #include <utility>
+#include <vector>
+
+#include <llvm/Config/llvm-config.h>
+#if LLVM_VERSION_MAJOR >= 18
+#  include <llvm/TargetParser/Host.h>
+#else
+#  include <llvm/Support/Host.h>
+#endif
+
+#include "arrow/util/config.h"
+#include "gandiva/function_registry.h"
 
 namespace gandiva {
 
+namespace {
+
+// A stable description of everything the compiled object code depends on:
+// the expressions/schema/configuration (through ExpressionCacheKey::ToString),
+// the host CPU, and the gandiva version.  Entries fingerprinted on a different
+// machine or with a different gandiva build are never reused.
+std::string GetObjectCodeFingerprint(const ExpressionCacheKey& key) {
+  std::string result = "gandiva version: " ARROW_VERSION_STRING;
+  result += "\ncpu name: " + llvm::sys::getHostCPUName().str();
+#if LLVM_VERSION_MAJOR >= 19
+  auto host_features = llvm::sys::getHostCPUFeatures();
+  const bool have_host_features = true;
+#else
+  llvm::StringMap<bool> host_features;
+  const auto have_host_features = llvm::sys::getHostCPUFeatures(host_features);
+#endif
+  if (have_host_features) {
+    std::vector<std::string> attrs;
+    for (auto& f : host_features) {
+      attrs.push_back((f.second ? "+" : "-") + f.first().str());
+    }
+    // StringMap iteration order is unspecified
+    std::sort(attrs.begin(), attrs.end());
+    result += "\ncpu features:";
+    for (auto& attr : attrs) {
+      result += " " + attr;
+    }
+  }
+  result += "\n" + key.ToString();
+  return result;
+}
+
+}  // namespace
+
 GandivaObjectCache::GandivaObjectCache(
     std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>>&
         cache,
     ExpressionCacheKey key)
     : cache_key_(std::move(key)) {
   cache_ = cache;
+  // A non-default function registry may register external C functions that the
+  // fingerprint cannot capture, so such keys stay in-memory only.
+  if (cache_key_.configuration()->function_registry() == default_function_registry()) {
+    file_cache_ = ObjectCodeFileCache::GetInstance();
+    if (file_cache_ != nullptr) {
+      fingerprint_ = GetObjectCodeFingerprint(cache_key_);
+    }
+  }
 }
 
 void GandivaObjectCache::notifyObjectCompiled(const llvm::Module* M,
@@ -36,10 +90,14 @@ void GandivaObjectCache::notifyObjectCompiled(const llvm::Module* M,
   std::shared_ptr<llvm::MemoryBuffer> obj_code = std::move(obj_buffer);
 
   cache_->PutObjectCode(cache_key_, obj_code);
+  if (file_cache_ != nullptr) {
+    file_cache_->Put(fingerprint_, std::string_view(Obj.getBufferStart(),
+                                                    Obj.getBufferSize()));
+  }
 }
 
 std::unique_ptr<llvm::MemoryBuffer> GandivaObjectCache::getObject(const llvm::Module* M) {
-  std::shared_ptr<llvm::MemoryBuffer> cached_obj = cache_->GetObjectCode(cache_key_);
+  std::shared_ptr<llvm::MemoryBuffer> cached_obj = GetCachedObjectCode();
   if (cached_obj != nullptr) {
     std::unique_ptr<llvm::MemoryBuffer> cached_buffer = cached_obj->getMemBufferCopy(
         cached_obj->getBuffer(), cached_obj->getBufferIdentifier());
@@ -48,4 +106,21 @@ std::unique_ptr<llvm::MemoryBuffer> GandivaObjectCache::getObject(const llvm::Mo
   return nullptr;
 }
 
+std::shared_ptr<llvm::MemoryBuffer> GandivaObjectCache::GetCachedObjectCode() {
+  std::shared_ptr<llvm::MemoryBuffer> cached_obj = cache_->GetObjectCode(cache_key_);
+  if (cached_obj != nullptr) {
+    return cached_obj;
+  }
+  if (file_cache_ != nullptr) {
+    auto persisted = file_cache_->Get(fingerprint_);
+    if (persisted.has_value()) {
+      std::shared_ptr<llvm::MemoryBuffer> obj_code =
+          llvm::MemoryBuffer::getMemBufferCopy(*persisted, "cached_object_code");
+      cache_->PutObjectCode(cache_key_, obj_code);
+      return obj_code;
+    }
+  }
+  return nullptr;
+}
+
 }  // namespace gandiva
@@ -34,6 +34,11 @@
 
 namespace gandiva {
 /// Class that enables the LLVM to use a custom rule to deal with the object code.
+///
+/// Besides the in-memory per-process cache, compiled object code is persisted
+/// to (and reloaded from) the directory-backed ObjectCodeFileCache when one is
+/// configured, so equivalent expressions skip LLVM compilation even across
+/// process restarts.
 class GandivaObjectCache : public llvm::ObjectCache {
  public:
   explicit GandivaObjectCache(
@@ -47,8 +52,16 @@ class GandivaObjectCache : public llvm::ObjectCache {
 
   std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* M);
 
+  /// Look up the object code for the cache key, consulting the in-memory cache
+  /// first and then the persistent one.  A persistent hit is promoted into the
+  /// in-memory cache.  Returns nullptr on a miss.
+  std::shared_ptr<llvm::MemoryBuffer> GetCachedObjectCode();
+
  private:
   ExpressionCacheKey cache_key_;
   std::shared_ptr<Cache<ExpressionCacheKey, std::shared_ptr<llvm::MemoryBuffer>>> cache_;
+  // Null when persistence is disabled or the key cannot be fingerprinted
+  std::shared_ptr<ObjectCodeFileCache> file_cache_;
+  std::string fingerprint_;
 };
 }  // namespace gandiva
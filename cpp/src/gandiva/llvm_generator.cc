@@ -17,17 +17,20 @@
 
 #include "gandiva/llvm_generator.h"
 
+#include <algorithm>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/util/logging_internal.h"
 #include "gandiva/bitmap_accumulator.h"
+#include "gandiva/condition.h"
 #include "gandiva/decimal_ir.h"
 #include "gandiva/dex.h"
 #include "gandiva/expr_decomposer.h"
 #include "gandiva/expression.h"
 #include "gandiva/llvm_types.h"
+#include "gandiva/local_bitmaps_holder.h"
 #include "gandiva/lvalue.h"
 
 namespace gandiva {
@@ -118,6 +121,37 @@ Status LLVMGenerator::Build(const ExpressionVector& exprs) {
   return Build(exprs, SelectionVector::Mode::MODE_NONE);
 }
 
+Status LLVMGenerator::BuildFilterProject(ConditionPtr condition,
+                                         const ExpressionVector& exprs,
+                                         SelectionVector::Mode mode) {
+  // The condition runs over all rows, so its function is generated in
+  // MODE_NONE; the projections index through the selection vector.
+  selection_vector_mode_ = SelectionVector::MODE_NONE;
+  {
+    auto output = annotator_.AddOutputFieldDescriptor(condition->result());
+    ARROW_RETURN_NOT_OK(Add(condition, output));
+  }
+  selection_vector_mode_ = mode;
+  for (auto& expr : exprs) {
+    auto output = annotator_.AddOutputFieldDescriptor(expr->result());
+    ARROW_RETURN_NOT_OK(Add(expr, output));
+  }
+
+  // Compile and inject into the process' memory the generated functions.
+  ARROW_RETURN_NOT_OK(engine_->FinalizeModule());
+
+  // setup the jit functions; the first compiled expression is the condition.
+  for (size_t idx = 0; idx < compiled_exprs_.size(); ++idx) {
+    auto expr_mode = (idx == 0) ? SelectionVector::MODE_NONE : mode;
+    auto fn_name = compiled_exprs_[idx]->GetFunctionName(expr_mode);
+    ARROW_ASSIGN_OR_RAISE(auto fn_ptr, engine_->CompiledFunction(fn_name));
+    auto jit_fn = reinterpret_cast<EvalFunc>(fn_ptr);
+    compiled_exprs_[idx]->SetJITFunction(expr_mode, jit_fn);
+  }
+
+  return Status::OK();
+}
+
 /// Execute the compiled module against the provided vectors.
 Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
                               const ArrayDataVector& output_vector) const {
@@ -170,6 +204,59 @@ Status LLVMGenerator::Execute(const arrow::RecordBatch& record_batch,
   return Status::OK();
 }
 
+Status LLVMGenerator::ExecuteFilterProject(const arrow::RecordBatch& record_batch,
+                                           SelectionVector* selection_vector,
+                                           const ArrayDataVector& output_vector) const {
+  DCHECK_GT(record_batch.num_rows(), 0);
+  const auto num_rows = record_batch.num_rows();
+
+  auto eval_batch = annotator_.PrepareEvalBatch(record_batch, output_vector);
+  DCHECK_GT(eval_batch->GetNumBuffers(), 0);
+
+  // 1. Evaluate the condition over all rows.
+  auto& condition = compiled_exprs_.at(0);
+  EvalFunc condition_fn = condition->GetJITFunction(SelectionVector::MODE_NONE);
+  condition_fn(eval_batch->GetBufferArray(), eval_batch->GetBufferOffsetArray(),
+               eval_batch->GetLocalBitMapArray(), annotator_.GetHolderPointersArray(),
+               nullptr, (int64_t)eval_batch->GetExecutionContext(), num_rows);
+  ARROW_RETURN_IF(eval_batch->GetExecutionContext()->has_error(),
+                  Status::ExecutionError(eval_batch->GetExecutionContext()->get_error()));
+  ComputeBitMapsForExpr(*condition, nullptr, eval_batch.get());
+
+  // 2. Intersect the condition's value and validity bits, and populate the
+  // selection vector. The condition output was just written, so both bitmaps
+  // are still cache-resident.
+  const auto& condition_output = output_vector.at(0);
+  LocalBitMapsHolder intersected(num_rows, 1 /*local_bitmaps*/);
+  BitMapAccumulator::IntersectBitMaps(
+      intersected.GetLocalBitMap(0),
+      {condition_output->buffers[0]->data(), condition_output->buffers[1]->data()},
+      {0, 0}, num_rows);
+  ARROW_RETURN_NOT_OK(selection_vector->PopulateFromBitMap(
+      intersected.GetLocalBitMap(0), intersected.GetLocalBitMapSize(), num_rows - 1));
+
+  // 3. Evaluate the projections over the selected rows only.
+  const auto num_output_rows = selection_vector->GetNumSlots();
+  if (num_output_rows == 0) {
+    return Status::OK();
+  }
+  const uint8_t* selection_buffer = selection_vector->GetBuffer().data();
+  for (size_t idx = 1; idx < compiled_exprs_.size(); ++idx) {
+    auto& compiled_expr = compiled_exprs_[idx];
+    EvalFunc jit_function = compiled_expr->GetJITFunction(selection_vector_mode_);
+    jit_function(eval_batch->GetBufferArray(), eval_batch->GetBufferOffsetArray(),
+                 eval_batch->GetLocalBitMapArray(), annotator_.GetHolderPointersArray(),
+                 selection_buffer, (int64_t)eval_batch->GetExecutionContext(),
+                 num_output_rows);
+    ARROW_RETURN_IF(
+        eval_batch->GetExecutionContext()->has_error(),
+        Status::ExecutionError(eval_batch->GetExecutionContext()->get_error()));
+    ComputeBitMapsForExpr(*compiled_expr, selection_vector, eval_batch.get());
+  }
+
+  return Status::OK();
+}
+
 llvm::Value* LLVMGenerator::LoadVectorAtIndex(llvm::Value* arg_addrs, llvm::Type* type,
                                               int idx, const std::string& name) {
   auto* idx_val = types()->i32_constant(idx);
@@ -392,6 +479,14 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
 
   // add jump to "loop block" at the end of the "setup block".
   builder->SetInsertPoint(loop_entry);
+  std::vector<llvm::Value*> written_refs = {output_ref};
+  if (output_buffer_ptr_ref != nullptr) {
+    written_refs.push_back(output_buffer_ptr_ref);
+  }
+  if (output_offset_ref != nullptr) {
+    written_refs.push_back(output_offset_ref);
+  }
+  AddSeparateStorageAssumptions(loop_entry, arg_addrs, arg_local_bitmaps, written_refs);
   builder->CreateBr(loop_body);
 
   // save the value in the output vector.
@@ -434,7 +529,26 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
 
   llvm::Value* loop_var_check =
       builder->CreateICmpSLT(loop_update, arg_nrecords, "loop_var < nrec");
-  builder->CreateCondBr(loop_var_check, loop_body, loop_exit);
+  llvm::BranchInst* loop_branch =
+      builder->CreateCondBr(loop_var_check, loop_body, loop_exit);
+
+  // Ask the loop vectorizer to process this loop, overriding its cost model.
+  // Rows are independent once the iteration has no per-row arena allocations
+  // and no var-len output (which goes through an opaque populate call), so
+  // vectorization with if-conversion of the per-row branches is profitable.
+  if (!visitor.has_arena_allocs() && !arrow::is_binary_like(output_type_id)) {
+    llvm::Metadata* enable_operands[] = {
+        llvm::MDString::get(*context(), "llvm.loop.vectorize.enable"),
+        llvm::ConstantAsMetadata::get(
+            llvm::ConstantInt::get(llvm::Type::getInt1Ty(*context()), 1))};
+    auto temp_node = llvm::MDNode::getTemporary(*context(), {});
+    llvm::Metadata* loop_operands[] = {temp_node.get(),
+                                       llvm::MDNode::get(*context(), enable_operands)};
+    llvm::MDNode* loop_metadata = llvm::MDNode::getDistinct(*context(), loop_operands);
+    // The first operand of loop metadata must be a self-reference
+    loop_metadata->replaceOperandWith(0, loop_metadata);
+    loop_branch->setMetadata(llvm::LLVMContext::MD_loop, loop_metadata);
+  }
 
   // Loop exit
   builder->SetInsertPoint(loop_exit);
@@ -442,6 +556,75 @@ Status LLVMGenerator::CodeGenExprValue(DexPtr value_expr, int buffer_count,
   return Status::OK();
 }
 
+void LLVMGenerator::AddSeparateStorageAssumptions(
+    llvm::BasicBlock* entry_block, llvm::Value* arg_addrs,
+    llvm::Value* arg_local_bitmaps, const std::vector<llvm::Value*>& written_refs) {
+#if LLVM_VERSION_MAJOR >= 17
+  // The vector base pointers are loaded from opaque int64 arrays, so alias
+  // analysis must otherwise assume that any store may clobber any input and the
+  // loop vectorizer either bails out or emits runtime overlap checks.  Each
+  // slot of the addrs/local_bitmaps arrays refers to a distinct arrow buffer
+  // (outputs and local bitmaps are freshly allocated per batch), so assert
+  // pairwise separation between every written pointer and every other buffer.
+  struct BufferRef {
+    llvm::Value* ptr;
+    llvm::Value* base;
+    int64_t slot;
+    bool written;
+  };
+  std::vector<BufferRef> refs;
+  for (llvm::Instruction& instr : *entry_block) {
+    auto* cast = llvm::dyn_cast<llvm::IntToPtrInst>(&instr);
+    if (cast == nullptr) {
+      continue;
+    }
+    auto* load = llvm::dyn_cast<llvm::LoadInst>(cast->getOperand(0));
+    if (load == nullptr) {
+      continue;
+    }
+    auto* gep = llvm::dyn_cast<llvm::GetElementPtrInst>(load->getPointerOperand());
+    if (gep == nullptr || gep->getNumIndices() != 1) {
+      continue;
+    }
+    auto* slot = llvm::dyn_cast<llvm::ConstantInt>(gep->getOperand(1));
+    llvm::Value* base = gep->getPointerOperand();
+    if (slot == nullptr || (base != arg_addrs && base != arg_local_bitmaps)) {
+      continue;
+    }
+    const auto is_same_slot = [&](const BufferRef& ref) {
+      return ref.base == base && ref.slot == slot->getSExtValue();
+    };
+    if (std::any_of(refs.begin(), refs.end(), is_same_slot)) {
+      // A buffer referenced more than once; one representative is enough.
+      continue;
+    }
+    bool written = base == arg_local_bitmaps ||
+                   std::find(written_refs.begin(), written_refs.end(), cast) !=
+                       written_refs.end();
+    refs.push_back({cast, base, slot->getSExtValue(), written});
+  }
+
+  llvm::IRBuilder<>* builder = ir_builder();
+  for (size_t i = 0; i < refs.size(); ++i) {
+    for (size_t j = i + 1; j < refs.size(); ++j) {
+      if (!refs[i].written && !refs[j].written) {
+        // Aliasing among read-only pointers cannot create a dependence
+        continue;
+      }
+      builder->CreateAssumption(
+          builder->getTrue(),
+          {llvm::OperandBundleDef("separate_storage",
+                                  std::vector<llvm::Value*>{refs[i].ptr, refs[j].ptr})});
+    }
+  }
+#else
+  ARROW_UNUSED(entry_block);
+  ARROW_UNUSED(arg_addrs);
+  ARROW_UNUSED(arg_local_bitmaps);
+  ARROW_UNUSED(written_refs);
+#endif
+}
+
 /// Return value of a bit in bitMap.
 llvm::Value* LLVMGenerator::GetPackedBitValue(llvm::Value* bitmap,
                                               llvm::Value* position) {
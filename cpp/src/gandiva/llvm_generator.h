@@ -65,6 +65,21 @@ class GANDIVA_EXPORT LLVMGenerator {
   /// ObjectCache. Each element in the vector represents an expression tree
   Status Build(const ExpressionVector& exprs, SelectionVector::Mode mode);
 
+  /// \brief Build the code for a fused filter+project. The condition is
+  /// compiled to run over all rows, and the expression trees to run only over
+  /// the rows it selects, all in a single module (one compilation, one cache
+  /// entry).
+  Status BuildFilterProject(ConditionPtr condition, const ExpressionVector& exprs,
+                            SelectionVector::Mode mode);
+
+  /// \brief Execute a module built with BuildFilterProject: evaluate the
+  /// condition into 'selection_vector', then the projections for the selected
+  /// rows only. output_vector[0] must be a boolean array for the condition,
+  /// followed by one output per expression.
+  Status ExecuteFilterProject(const arrow::RecordBatch& record_batch,
+                              SelectionVector* selection_vector,
+                              const ArrayDataVector& output_vector) const;
+
   /// \brief Build the code for the expression trees for default mode. Each
   /// element in the vector represents an expression tree
   Status Build(const ExpressionVector& exprs);
@@ -215,6 +230,15 @@ class GANDIVA_EXPORT LLVMGenerator {
                           int suffix_idx, std::string& fn_name,
                           SelectionVector::Mode selection_vector_mode);
 
+  /// Generate llvm.assume "separate_storage" hints for the buffer pointers
+  /// materialized in the entry block, so that the loop vectorizer does not have
+  /// to assume the written vectors may alias the input vectors. No-op on LLVM
+  /// versions whose alias analysis ignores these hints.
+  void AddSeparateStorageAssumptions(llvm::BasicBlock* entry_block,
+                                     llvm::Value* arg_addrs,
+                                     llvm::Value* arg_local_bitmaps,
+                                     const std::vector<llvm::Value*>& written_refs);
+
   /// Generate code to load the local bitmap specified index and cast it as bitmap.
   llvm::Value* GetLocalBitMapReference(llvm::Value* arg_bitmaps, int idx);
 
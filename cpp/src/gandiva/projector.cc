@@ -69,16 +69,15 @@ Status Projector::Make(SchemaPtr schema, const ExpressionVector& exprs,
 
   bool is_cached = false;
 
-  std::shared_ptr<llvm::MemoryBuffer> prev_cached_obj;
-  prev_cached_obj = cache->GetObjectCode(cache_key);
+  GandivaObjectCache obj_cache(cache, cache_key);
 
-  // Verify if previous projector obj code was cached
+  // Verify if previous projector obj code was cached, in memory or on disk
+  std::shared_ptr<llvm::MemoryBuffer> prev_cached_obj;
+  prev_cached_obj = obj_cache.GetCachedObjectCode();
   if (prev_cached_obj != nullptr) {
     is_cached = true;
   }
 
-  GandivaObjectCache obj_cache(cache, cache_key);
-
   // Build LLVM generator, and generate code for the specified expressions
   ARROW_ASSIGN_OR_RAISE(auto llvm_gen,
                         LLVMGenerator::Make(configuration, is_cached, obj_cache));
@@ -168,7 +167,8 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
   for (auto& field : output_fields_) {
     ArrayDataPtr output_data;
 
-    ARROW_RETURN_NOT_OK(AllocArrayData(field->type(), num_rows, pool, &output_data));
+    ARROW_RETURN_NOT_OK(
+        internal::AllocOutputArrayData(field->type(), num_rows, pool, &output_data));
     output_data_vecs.push_back(output_data);
   }
 
@@ -185,9 +185,9 @@ Status Projector::Evaluate(const arrow::RecordBatch& batch,
 }
 
 // TODO : handle complex vectors (list/map/..)
-Status Projector::AllocArrayData(const DataTypePtr& type, int64_t num_records,
-                                 arrow::MemoryPool* pool,
-                                 ArrayDataPtr* array_data) const {
+Status internal::AllocOutputArrayData(const DataTypePtr& type, int64_t num_records,
+                                      arrow::MemoryPool* pool,
+                                      ArrayDataPtr* array_data) {
   arrow::Status astatus;
   std::vector<std::shared_ptr<arrow::Buffer>> buffers;
 
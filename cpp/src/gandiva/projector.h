@@ -128,10 +128,6 @@ class GANDIVA_EXPORT Projector {
   Projector(std::unique_ptr<LLVMGenerator> llvm_generator, SchemaPtr schema,
             const FieldVector& output_fields, std::shared_ptr<Configuration>);
 
-  /// Allocate an ArrowData of length 'length'.
-  Status AllocArrayData(const DataTypePtr& type, int64_t num_records,
-                        arrow::MemoryPool* pool, ArrayDataPtr* array_data) const;
-
   /// Validate that the ArrayData has sufficient capacity to accommodate 'num_records'.
   Status ValidateArrayDataCapacity(const arrow::ArrayData& array_data,
                                    const arrow::Field& field, int64_t num_records) const;
@@ -146,4 +142,12 @@ class GANDIVA_EXPORT Projector {
   bool built_from_cache_;
 };
 
+namespace internal {
+/// \brief Allocate an ArrayData with capacity for 'num_records' of 'type',
+/// suitable as expression output. Used by Projector and FilterProjector.
+GANDIVA_EXPORT
+Status AllocOutputArrayData(const DataTypePtr& type, int64_t num_records,
+                            arrow::MemoryPool* pool, ArrayDataPtr* array_data);
+}  // namespace internal
+
 }  // namespace gandiva
@@ -0,0 +1,119 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "gandiva/async_projector.h"
+
+#include <gtest/gtest.h>
+
+#include "arrow/memory_pool.h"
+#include "gandiva/tests/test_util.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace gandiva {
+
+using arrow::boolean;
+using arrow::int32;
+
+class TestAsyncProjector : public ::testing::Test {
+ public:
+  void SetUp() { pool_ = arrow::default_memory_pool(); }
+
+ protected:
+  arrow::MemoryPool* pool_;
+};
+
+TEST_F(TestAsyncProjector, TestInterpretedThenCompiled) {
+  // schema for input fields
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+
+  // output fields
+  auto field_sum = field("add", int32());
+  auto field_cmp = field("less", boolean());
+
+  // Build expressions with a compute equivalent: f0 + f1, f0 < f1
+  auto sum_expr = TreeExprBuilder::MakeExpression("add", {field0, field1}, field_sum);
+  auto cmp_expr =
+      TreeExprBuilder::MakeExpression("less_than", {field0, field1}, field_cmp);
+
+  std::shared_ptr<AsyncProjector> projector;
+  auto status = AsyncProjector::Make(schema, {sum_expr, cmp_expr},
+                                     TestConfiguration(), &projector);
+  ASSERT_TRUE(status.ok()) << status.message();
+
+  // Create a row-batch with some sample data
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 2, 3, 4}, {true, true, true, false});
+  auto array1 = MakeArrowArrayInt32({11, 13, 2, 5}, {true, true, true, true});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+
+  auto exp_sum = MakeArrowArrayInt32({12, 15, 5, 9}, {true, true, true, false});
+  auto exp_cmp = MakeArrowArrayBool({true, true, false, false},
+                                    {true, true, true, false});
+
+  // The first evaluation may run interpreted or compiled depending on timing;
+  // the results must be identical either way.
+  arrow::ArrayVector outputs;
+  status = projector->Evaluate(*in_batch, pool_, &outputs);
+  ASSERT_TRUE(status.ok()) << status.message();
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_cmp, outputs.at(1));
+
+  // After compilation finishes, evaluation goes through the compiled code.
+  ASSERT_OK(projector->WaitForCompilation().status());
+  ASSERT_TRUE(projector->IsCompiled());
+
+  outputs.clear();
+  status = projector->Evaluate(*in_batch, pool_, &outputs);
+  ASSERT_TRUE(status.ok()) << status.message();
+  EXPECT_ARROW_ARRAY_EQUALS(exp_sum, outputs.at(0));
+  EXPECT_ARROW_ARRAY_EQUALS(exp_cmp, outputs.at(1));
+}
+
+TEST_F(TestAsyncProjector, TestFallbackToForegroundCompile) {
+  auto field0 = field("f0", int32());
+  auto field1 = field("f1", int32());
+  auto schema = arrow::schema({field0, field1});
+  auto field_result = field("res", int32());
+
+  // if/else has no compute equivalent, so Make() compiles in the foreground.
+  auto node_f0 = TreeExprBuilder::MakeField(field0);
+  auto node_f1 = TreeExprBuilder::MakeField(field1);
+  auto condition = TreeExprBuilder::MakeFunction("less_than", {node_f0, node_f1},
+                                                 arrow::boolean());
+  auto if_node = TreeExprBuilder::MakeIf(condition, node_f0, node_f1, int32());
+  auto expr = TreeExprBuilder::MakeExpression(if_node, field_result);
+
+  std::shared_ptr<AsyncProjector> projector;
+  auto status = AsyncProjector::Make(schema, {expr}, TestConfiguration(), &projector);
+  ASSERT_TRUE(status.ok()) << status.message();
+  ASSERT_TRUE(projector->IsCompiled());
+
+  int num_records = 4;
+  auto array0 = MakeArrowArrayInt32({1, 20, 3, 40}, {true, true, true, true});
+  auto array1 = MakeArrowArrayInt32({11, 13, 2, 5}, {true, true, true, true});
+  auto in_batch = arrow::RecordBatch::Make(schema, num_records, {array0, array1});
+  auto exp_result = MakeArrowArrayInt32({1, 13, 2, 5}, {true, true, true, true});
+
+  arrow::ArrayVector outputs;
+  status = projector->Evaluate(*in_batch, pool_, &outputs);
+  ASSERT_TRUE(status.ok()) << status.message();
+  EXPECT_ARROW_ARRAY_EQUALS(exp_result, outputs.at(0));
+}
+
+}  // namespace gandiva
@@ -24,8 +24,10 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <functional>
+#include <numeric>
 #include <set>
 #include <sstream>
 #include <vector>
@@ -2368,6 +2370,109 @@ TEST(TestArrowReadWrite, ReadSingleRowGroup) {
   AssertTablesEqual(*table, *concatenated, /*same_chunk_layout=*/false);
 }
 
+TEST(TestArrowReadWrite, ReadRowRange) {
+  const int num_columns = 3;
+  const int num_rows = 500;
+
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  // Write several pages per row group and a page index so that leading pages
+  // can be skipped without decompressing them.
+  auto sink = CreateOutputStream();
+  auto writer_properties = WriterProperties::Builder()
+                               .enable_write_page_index()
+                               ->data_pagesize(1)
+                               ->write_batch_size(100)
+                               ->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                /*chunk_size=*/num_rows / 2, writer_properties,
+                                default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  ASSERT_OK_AND_ASSIGN(auto reader, OpenFile(std::make_shared<BufferReader>(buffer),
+                                             ::arrow::default_memory_pool()));
+  ASSERT_EQ(2, reader->num_row_groups());
+
+  // Ranges within one row group, spanning both, anchored at either end of the
+  // file, and empty.
+  for (const auto& [start_row, range_rows] :
+       std::vector<std::pair<int64_t, int64_t>>{
+           {0, 40}, {110, 25}, {200, 200}, {240, 20}, {499, 1}, {120, 0}, {0, 500}}) {
+    std::shared_ptr<Table> result;
+    ASSERT_OK_NO_THROW(reader->ReadRowRange(start_row, range_rows, &result));
+    AssertTablesEqual(*table->Slice(start_row, range_rows), *result,
+                      /*same_chunk_layout=*/false);
+  }
+
+  // Column subset.
+  std::shared_ptr<Table> subset;
+  ASSERT_OK_NO_THROW(reader->ReadRowRange(130, 250, {1}, &subset));
+  ASSERT_OK_AND_ASSIGN(auto expected_subset, table->SelectColumns({1}));
+  AssertTablesEqual(*expected_subset->Slice(130, 250), *subset,
+                    /*same_chunk_layout=*/false);
+
+  // Out-of-bounds ranges are rejected.
+  std::shared_ptr<Table> result;
+  ASSERT_RAISES(Invalid, reader->ReadRowRange(-1, 10, &result));
+  ASSERT_RAISES(Invalid, reader->ReadRowRange(0, -1, &result));
+  ASSERT_RAISES(Invalid, reader->ReadRowRange(400, 101, &result));
+}
+
+TEST(TestArrowReadWrite, ZeroCopyReads) {
+  std::vector<int64_t> i64_values = {11, 22, 33, 44, 55, 66, 77, 88};
+  std::vector<double> f64_values = {1.5, -2.5, 3.5, -4.5, 5.5, -6.5, 7.5, -8.5};
+  std::shared_ptr<Array> i64_array, f64_array;
+  ::arrow::ArrayFromVector<::arrow::Int64Type, int64_t>(i64_values, &i64_array);
+  ::arrow::ArrayFromVector<::arrow::DoubleType, double>(f64_values, &f64_array);
+  auto schema = ::arrow::schema(
+      {::arrow::field("i64", ::arrow::int64(), /*nullable=*/false),
+       ::arrow::field("f64", ::arrow::float64(), /*nullable=*/false)});
+  auto table = Table::Make(schema, {i64_array, f64_array});
+
+  // Zero-copy reads need uncompressed PLAIN pages; store the Arrow schema so
+  // that the fields read back as required.
+  auto writer_properties = WriterProperties::Builder().disable_dictionary()->build();
+  auto arrow_writer_properties = ArrowWriterProperties::Builder().store_schema()->build();
+  auto sink = CreateOutputStream();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                /*chunk_size=*/1024, writer_properties,
+                                arrow_writer_properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_zero_copy_reads(true);
+  std::unique_ptr<FileReader> reader;
+  FileReaderBuilder builder;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_OK(result->ValidateFull());
+  AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+
+  // Each column's PLAIN values appear verbatim in the file.  When their file
+  // position is naturally aligned, the returned buffer must alias them rather
+  // than hold a copy; otherwise the reader falls back to copying.
+  auto check_aliasing = [&](int column_index, const void* raw_values,
+                            int64_t num_bytes) {
+    const uint8_t* file_begin = buffer->data();
+    const uint8_t* file_end = file_begin + buffer->size();
+    const uint8_t* values_begin = static_cast<const uint8_t*>(raw_values);
+    const uint8_t* found =
+        std::search(file_begin, file_end, values_begin, values_begin + num_bytes);
+    ASSERT_NE(found, file_end);
+    const auto& values_buffer =
+        result->column(column_index)->chunk(0)->data()->buffers[1];
+    if (reinterpret_cast<uintptr_t>(found) % sizeof(int64_t) == 0) {
+      ASSERT_EQ(values_buffer->address(), reinterpret_cast<uintptr_t>(found));
+    }
+  };
+  check_aliasing(0, i64_values.data(), i64_values.size() * sizeof(int64_t));
+  check_aliasing(1, f64_values.data(), f64_values.size() * sizeof(double));
+}
+
 //  Exercise reading table manually with nested RowGroup and Column loops, i.e.
 //
 //  for (int i = 0; i < n_row_groups; i++)
@@ -4916,6 +5021,32 @@ INSTANTIATE_TEST_SUITE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
 
+TEST(TestArrowReadDictionaries, SameDictionarySingleChunk) {
+  // Row groups sharing a byte-identical dictionary come back as a single
+  // dictionary chunk with shared indices instead of one chunk per row group.
+  auto dict = ArrayFromJSON(::arrow::utf8(), R"(["a", "b", "c"])");
+  auto indices = ArrayFromJSON(::arrow::int32(), "[0, 1, 2, 0, null, 2, 0, 1]");
+  auto dict_type = ::arrow::dictionary(::arrow::int32(), ::arrow::utf8());
+  auto values = std::make_shared<DictionaryArray>(dict_type, indices, dict);
+  auto table = MakeSimpleTable(values, /*nullable=*/true);
+
+  std::shared_ptr<Buffer> buffer;
+  ASSERT_NO_FATAL_FAILURE(WriteTableToBuffer(table, /*row_group_size=*/4,
+                                             default_arrow_writer_properties(), &buffer));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_read_dictionary(0, true);
+  FileReaderBuilder builder;
+  std::unique_ptr<FileReader> reader;
+  ASSERT_OK(builder.Open(std::make_shared<BufferReader>(buffer)));
+  ASSERT_OK(builder.properties(properties)->Build(&reader));
+
+  std::shared_ptr<Table> actual;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&actual));
+  ASSERT_EQ(actual->column(0)->num_chunks(), 1);
+  ::arrow::AssertTablesEqual(*table, *actual, /*same_chunk_layout=*/false);
+}
+
 TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   constexpr int num_unique = 50;
   constexpr int repeat = 10000;
@@ -5628,6 +5759,208 @@ TEST(TestArrowReadWrite, MultithreadedWrite) {
   ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
 }
 
+TEST(TestArrowReadWrite, DictionaryFallbackSplit) {
+  constexpr int kNumBatches = 10;
+  constexpr int kBatchSize = 100;
+  constexpr int64_t kDictionaryLimit = 16 * 1024;
+
+  // All-unique values grow the dictionary by a fixed amount per batch.
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::utf8())});
+  ::arrow::StringBuilder string_builder;
+  for (int i = 0; i < kNumBatches * kBatchSize; ++i) {
+    ASSERT_OK(string_builder.Append("unique-value-" + std::to_string(100000 + i)));
+  }
+  std::shared_ptr<Array> values;
+  ASSERT_OK(string_builder.Finish(&values));
+  auto table = Table::Make(schema, {values});
+
+  auto write_with = [&](const std::shared_ptr<WriterProperties>& writer_properties) {
+    auto sink = CreateOutputStream();
+    PARQUET_ASSIGN_OR_THROW(
+        auto writer, FileWriter::Open(*schema, ::arrow::default_memory_pool(), sink,
+                                      writer_properties,
+                                      default_arrow_writer_properties()));
+    for (int i = 0; i < kNumBatches; ++i) {
+      auto batch = ::arrow::RecordBatch::Make(
+          schema, kBatchSize, {values->Slice(i * kBatchSize, kBatchSize)});
+      PARQUET_THROW_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    PARQUET_THROW_NOT_OK(writer->Close());
+    PARQUET_ASSIGN_OR_THROW(auto file_buffer, sink->Finish());
+    return std::make_pair(writer->metadata(), file_buffer);
+  };
+
+  auto plain_data_pages = [](const FileMetaData& metadata, int row_group) {
+    int count = 0;
+    auto chunk = metadata.RowGroup(row_group)->ColumnChunk(0);
+    for (const auto& stats : chunk->encoding_stats()) {
+      if (stats.page_type != PageType::DICTIONARY_PAGE &&
+          stats.encoding == Encoding::PLAIN) {
+        count += stats.count;
+      }
+    }
+    return count;
+  };
+
+  // Without early splits the dictionary overflows mid-chunk and the rest of
+  // the column falls back to PLAIN data pages.
+  auto [base_metadata, base_buffer] = write_with(
+      WriterProperties::Builder().dictionary_pagesize_limit(kDictionaryLimit)->build());
+  ASSERT_EQ(1, base_metadata->num_row_groups());
+  EXPECT_GT(plain_data_pages(*base_metadata, 0), 0);
+
+  // With early splits the row group is rotated before the dictionary
+  // overflows, so every row group stays fully dictionary-encoded.
+  auto [split_metadata, split_buffer] =
+      write_with(WriterProperties::Builder()
+                     .dictionary_pagesize_limit(kDictionaryLimit)
+                     ->enable_dictionary_fallback_split()
+                     ->build());
+  EXPECT_GT(split_metadata->num_row_groups(), 1);
+  for (int i = 0; i < split_metadata->num_row_groups(); ++i) {
+    EXPECT_EQ(0, plain_data_pages(*split_metadata, i)) << "row group " << i;
+  }
+
+  // Data is unchanged.
+  std::shared_ptr<Table> result;
+  ASSERT_OK_AND_ASSIGN(auto reader, OpenFile(std::make_shared<BufferReader>(split_buffer),
+                                             ::arrow::default_memory_pool()));
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+}
+
+TEST(TestArrowReadWrite, DecodedSizeRowGroupSplit) {
+  constexpr int kNumBatches = 8;
+  constexpr int kBatchSize = 1000;
+  constexpr int kStringLength = 40;
+  // Each batch decodes to roughly kBatchSize * (kStringLength + 4) bytes of
+  // value data plus offsets, so the limit is crossed after three batches.
+  constexpr int64_t kDecodedLimit = 100 * 1024;
+
+  auto schema = ::arrow::schema({::arrow::field("a", ::arrow::utf8())});
+  ::arrow::StringBuilder string_builder;
+  for (int i = 0; i < kNumBatches * kBatchSize; ++i) {
+    std::string value = "value-" + std::to_string(1000000 + i);
+    value.resize(kStringLength, 'x');
+    ASSERT_OK(string_builder.Append(value));
+  }
+  std::shared_ptr<Array> values;
+  ASSERT_OK(string_builder.Finish(&values));
+  auto table = Table::Make(schema, {values});
+
+  auto write_with = [&](const std::shared_ptr<WriterProperties>& writer_properties) {
+    auto sink = CreateOutputStream();
+    PARQUET_ASSIGN_OR_THROW(
+        auto writer, FileWriter::Open(*schema, ::arrow::default_memory_pool(), sink,
+                                      writer_properties,
+                                      default_arrow_writer_properties()));
+    for (int i = 0; i < kNumBatches; ++i) {
+      auto batch = ::arrow::RecordBatch::Make(
+          schema, kBatchSize, {values->Slice(i * kBatchSize, kBatchSize)});
+      PARQUET_THROW_NOT_OK(writer->WriteRecordBatch(*batch));
+    }
+    PARQUET_THROW_NOT_OK(writer->Close());
+    PARQUET_ASSIGN_OR_THROW(auto file_buffer, sink->Finish());
+    return std::make_pair(writer->metadata(), file_buffer);
+  };
+
+  // The decoded-size limit splits the row groups after every third batch.
+  auto [metadata, buffer] = write_with(
+      WriterProperties::Builder().max_row_group_decoded_bytes(kDecodedLimit)->build());
+  ASSERT_EQ(3, metadata->num_row_groups());
+  EXPECT_EQ(3000, metadata->RowGroup(0)->num_rows());
+  EXPECT_EQ(3000, metadata->RowGroup(1)->num_rows());
+  EXPECT_EQ(2000, metadata->RowGroup(2)->num_rows());
+
+  // With a row alignment, the decoded-size splits are deferred to the next
+  // multiple of the alignment.
+  constexpr int64_t kRowAlignment = 1800;
+  auto [aligned_metadata, aligned_buffer] =
+      write_with(WriterProperties::Builder()
+                     .max_row_group_decoded_bytes(kDecodedLimit)
+                     ->row_group_row_alignment(kRowAlignment)
+                     ->build());
+  EXPECT_GT(aligned_metadata->num_row_groups(), 1);
+  for (int i = 0; i + 1 < aligned_metadata->num_row_groups(); ++i) {
+    EXPECT_EQ(0, aligned_metadata->RowGroup(i)->num_rows() % kRowAlignment)
+        << "row group " << i;
+  }
+
+  // Data is unchanged.
+  std::shared_ptr<Table> result;
+  ASSERT_OK_AND_ASSIGN(auto reader, OpenFile(std::make_shared<BufferReader>(
+                                                 aligned_buffer),
+                                             ::arrow::default_memory_pool()));
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+}
+
+TEST(TestArrowReadWrite, AdaptiveEncoding) {
+  const int num_rows = 4000;
+  std::vector<int64_t> ascending(num_rows);
+  std::iota(ascending.begin(), ascending.end(), int64_t{0});
+  std::shared_ptr<Array> i64_array;
+  ::arrow::ArrayFromVector<::arrow::Int64Type, int64_t>(ascending, &i64_array);
+  auto gen = ::arrow::random::RandomArrayGenerator(/*seed=*/42);
+  auto f64_array = gen.Float64(num_rows, /*min=*/0.0, /*max=*/1.0);
+  auto table = Table::Make(::arrow::schema({::arrow::field("a", ::arrow::int64()),
+                                            ::arrow::field("b", ::arrow::float64())}),
+                           {i64_array, f64_array});
+
+  // The ascending column shrinks under DELTA_BINARY_PACKED while random
+  // doubles gain nothing from BYTE_STREAM_SPLIT, so adaptive selection should
+  // pick DELTA_BINARY_PACKED and PLAIN respectively.
+  auto sink = CreateOutputStream();
+  auto writer_properties = WriterProperties::Builder()
+                               .disable_dictionary()
+                               ->enable_adaptive_encoding()
+                               ->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, ::arrow::default_memory_pool(), sink,
+                                /*chunk_size=*/num_rows, writer_properties,
+                                default_arrow_writer_properties()));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  ASSERT_OK_AND_ASSIGN(auto reader, OpenFile(std::make_shared<BufferReader>(buffer),
+                                             ::arrow::default_memory_pool()));
+  auto metadata = reader->parquet_reader()->metadata();
+  auto encodings_of = [&](int column_index) {
+    auto encodings = metadata->RowGroup(0)->ColumnChunk(column_index)->encodings();
+    return std::set<Encoding::type>(encodings.begin(), encodings.end());
+  };
+  EXPECT_TRUE(encodings_of(0).count(Encoding::DELTA_BINARY_PACKED));
+  EXPECT_FALSE(encodings_of(1).count(Encoding::BYTE_STREAM_SPLIT));
+  EXPECT_TRUE(encodings_of(1).count(Encoding::PLAIN));
+
+  std::shared_ptr<Table> result;
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  AssertTablesEqual(*table, *result, /*same_chunk_layout=*/false);
+}
+
+TEST(TestArrowReadWrite, MultithreadedWriteTable) {
+  const int num_columns = 20;
+  const int num_rows = 1000;
+  std::shared_ptr<Table> table;
+  ASSERT_NO_FATAL_FAILURE(MakeDoubleTable(num_columns, num_rows, 1, &table));
+
+  // WriteTable encodes all columns of each row group in parallel when
+  // use_threads is enabled.
+  auto sink = CreateOutputStream();
+  auto write_props = WriterProperties::Builder().write_batch_size(100)->build();
+  auto pool = ::arrow::default_memory_pool();
+  auto arrow_properties = ArrowWriterProperties::Builder().set_use_threads(true)->build();
+  ASSERT_OK_NO_THROW(WriteTable(*table, pool, sink, /*chunk_size=*/num_rows / 4,
+                                write_props, arrow_properties));
+  ASSERT_OK_AND_ASSIGN(auto buffer, sink->Finish());
+
+  // Read to verify the data.
+  std::shared_ptr<Table> result;
+  ASSERT_OK_AND_ASSIGN(auto reader,
+                       OpenFile(std::make_shared<BufferReader>(buffer), pool));
+  ASSERT_EQ(4, reader->num_row_groups());
+  ASSERT_OK_NO_THROW(reader->ReadTable(&result));
+  ASSERT_NO_FATAL_FAILURE(::arrow::AssertTablesEqual(*table, *result));
+}
+
 TEST(TestArrowReadWrite, FuzzReader) {
   constexpr size_t kMaxFileSize = 1024 * 1024 * 1;
   auto check_bad_file = [&](const std::string& file_name) {
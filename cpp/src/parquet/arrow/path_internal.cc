@@ -101,7 +101,7 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_util.h"
-#include "arrow/util/bitmap_visit.h"
+#include "arrow/util/bitmap_reader.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/macros.h"
 #include "arrow/visit_array_inline.h"
@@ -177,6 +177,28 @@ struct PathWriteContext {
 
   void UnsafeAppendDefLevel(int16_t def_level) { def_levels.UnsafeAppend(def_level); }
 
+  void UnsafeAppendDefLevels(const int16_t* levels, int64_t count) {
+    def_levels.UnsafeAppend(levels, count);
+  }
+
+  void UnsafeAppendDefLevels(int64_t count, int16_t def_level) {
+    def_levels.UnsafeAppend(count, def_level);
+  }
+
+  IterationResult ReserveRepLevels(int64_t elements) {
+    last_status = rep_levels.Reserve(elements);
+    if (ARROW_PREDICT_TRUE(last_status.ok())) {
+      return kDone;
+    }
+    return kError;
+  }
+
+  void UnsafeAppendRepLevel(int16_t rep_level) { rep_levels.UnsafeAppend(rep_level); }
+
+  void UnsafeAppendRepLevels(int64_t count, int16_t rep_level) {
+    rep_levels.UnsafeAppend(count, rep_level);
+  }
+
   IterationResult AppendRepLevel(int16_t rep_level) {
     last_status = rep_levels.Append(rep_level);
 
@@ -269,6 +291,41 @@ struct AllPresentTerminalNode {
   int16_t def_level;
 };
 
+// Expands a validity bitmap into definition levels in bulk. This exploits the
+// fact that a present element's definition level is exactly one greater than a
+// null element's, so each level can be computed branch-free as
+// `def_level_if_null + validity_bit`, a bitmap word at a time. The fixed-size
+// inner loops vectorize on architectures with SIMD, mirroring the
+// word-at-a-time level processing on the read side (level_conversion.cc).
+void UnsafeAppendDefLevelsFromBitmap(const uint8_t* bitmap, int64_t offset,
+                                     int64_t length, int16_t def_level_if_null,
+                                     PathWriteContext* context) {
+  const int16_t def_level_if_present = def_level_if_null + 1;
+  ::arrow::internal::BitmapWordReader<uint64_t> reader(bitmap, offset, length);
+  int16_t levels[64];
+  for (int64_t word_index = reader.words(); word_index > 0; --word_index) {
+    const uint64_t word = reader.NextWord();
+    if (word == 0) {
+      context->UnsafeAppendDefLevels(/*count=*/64, def_level_if_null);
+    } else if (word == UINT64_MAX) {
+      context->UnsafeAppendDefLevels(/*count=*/64, def_level_if_present);
+    } else {
+      for (int i = 0; i < 64; ++i) {
+        levels[i] = static_cast<int16_t>(def_level_if_null + ((word >> i) & 1));
+      }
+      context->UnsafeAppendDefLevels(levels, /*count=*/64);
+    }
+  }
+  for (int byte_index = reader.trailing_bytes(); byte_index > 0; --byte_index) {
+    int valid_bits = 0;
+    const uint8_t byte = reader.NextTrailingByte(valid_bits);
+    for (int i = 0; i < valid_bits; ++i) {
+      context->UnsafeAppendDefLevel(
+          static_cast<int16_t>(def_level_if_null + ((byte >> i) & 1)));
+    }
+  }
+}
+
 /// Node for handling the case when the leaf-array is nullable
 /// and contains null elements.
 struct NullableTerminalNode {
@@ -278,7 +335,6 @@ struct NullableTerminalNode {
                        int16_t def_level_if_present)
       : bitmap_(bitmap),
         element_offset_(element_offset),
-        def_level_if_present_(def_level_if_present),
         def_level_if_null_(def_level_if_present - 1) {}
 
   IterationResult Run(const ElementRange& range, PathWriteContext* context) {
@@ -287,22 +343,12 @@ struct NullableTerminalNode {
 
     DCHECK_GT(elements, 0);
 
-    auto bit_visitor = [&](bool is_set) {
-      context->UnsafeAppendDefLevel(is_set ? def_level_if_present_ : def_level_if_null_);
-    };
-
-    if (elements > 16) {  // 16 guarantees at least one unrolled loop.
-      ::arrow::internal::VisitBitsUnrolled(bitmap_, range.start + element_offset_,
-                                           elements, bit_visitor);
-    } else {
-      ::arrow::internal::VisitBits(bitmap_, range.start + element_offset_, elements,
-                                   bit_visitor);
-    }
+    UnsafeAppendDefLevelsFromBitmap(bitmap_, range.start + element_offset_, elements,
+                                    def_level_if_null_, context);
     return kDone;
   }
   const uint8_t* bitmap_;
   int64_t element_offset_;
-  int16_t def_level_if_present_;
   int16_t def_level_if_null_;
 };
 
@@ -398,24 +444,35 @@ class ListPathNode {
     // Given these preconditions it should be safe to fill runs on non-empty
     // lists here and expand the range in the child node accordingly.
 
-    while (!range->Empty()) {
-      ElementRange size_check = selector_.GetRange(range->start);
+    // Scan ahead for the run of non-empty lists so their rep levels can be
+    // appended in bulk without per-list capacity checks.
+    int64_t num_lists = 0;
+    int64_t run_end = child_range->end;
+    while (range->start + num_lists < range->end) {
+      ElementRange size_check = selector_.GetRange(range->start + num_lists);
       if (size_check.Empty()) {
         // The empty range will need to be handled after we pass down the accumulated
         // range because it affects def_level placement and we need to get the children
         // def_levels entered first.
         break;
       }
-      // This is the start of a new list. We can be sure it only applies
-      // to the previous list (and doesn't jump to the start of any list
-      // further up in nesting due to the constraints mentioned at the start
-      // of the function).
-      RETURN_IF_ERROR(context->AppendRepLevel(prev_rep_level_));
-      RETURN_IF_ERROR(context->AppendRepLevels(size_check.Size() - 1, rep_level_));
-      DCHECK_EQ(size_check.start, child_range->end)
-          << size_check.start << " != " << child_range->end;
-      child_range->end = size_check.end;
-      ++range->start;
+      DCHECK_EQ(size_check.start, run_end) << size_check.start << " != " << run_end;
+      run_end = size_check.end;
+      ++num_lists;
+    }
+    if (num_lists > 0) {
+      RETURN_IF_ERROR(context->ReserveRepLevels(run_end - child_range->end));
+      for (int64_t i = 0; i < num_lists; ++i) {
+        // This is the start of a new list. We can be sure it only applies
+        // to the previous list (and doesn't jump to the start of any list
+        // further up in nesting due to the constraints mentioned at the start
+        // of the function).
+        const ElementRange list_range = selector_.GetRange(range->start + i);
+        context->UnsafeAppendRepLevel(prev_rep_level_);
+        context->UnsafeAppendRepLevels(list_range.Size() - 1, rep_level_);
+      }
+      child_range->end = run_end;
+      range->start += num_lists;
     }
 
     // Do book-keeping to track the elements of the arrays that are actually visited
@@ -18,6 +18,7 @@
 #include "parquet/arrow/path_internal.h"
 
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -643,4 +644,28 @@ TEST_F(MultipathLevelBuilderTest, TestPrimitiveNonNullable) {
   EXPECT_THAT(results_[0].post_list_elements[0].end, Eq(4));
 }
 
+TEST_F(MultipathLevelBuilderTest, TestPrimitiveNullableManyElements) {
+  // Exercises the word-at-a-time bitmap-to-def-level expansion: all-null,
+  // all-present and mixed full bitmap words plus trailing partial bytes.
+  constexpr int kCount = 200;
+  std::vector<int16_t> expected_def;
+  std::string json = "[";
+  for (int i = 0; i < kCount; ++i) {
+    const bool is_null = (i < 64) ? (i % 3 == 0) : (i < 128);
+    json += is_null ? "null" : std::to_string(i);
+    if (i + 1 < kCount) {
+      json += ", ";
+    }
+    expected_def.push_back(is_null ? 0 : 1);
+  }
+  json += "]";
+  auto array = ::arrow::ArrayFromJSON(::arrow::int64(), json);
+
+  ASSERT_OK(
+      MultipathLevelBuilder::Write(*array, /*nullable=*/true, &context_, callback_));
+
+  ASSERT_THAT(results_, SizeIs(1));
+  results_[0].CheckLevelsWithNullRepLevels(expected_def);
+}
+
 }  // namespace parquet::arrow
@@ -44,6 +44,7 @@
 #include "parquet/exception.h"
 #include "parquet/file_reader.h"
 #include "parquet/metadata.h"
+#include "parquet/page_index.h"
 #include "parquet/properties.h"
 #include "parquet/schema.h"
 
@@ -116,9 +117,25 @@ class ColumnReaderImpl : public ColumnReader {
 
   virtual ::arrow::Status LoadBatch(int64_t num_records) = 0;
 
+  // Skip the next num_records records. The default implementation decodes and
+  // discards them; leaf readers can skip more cheaply.
+  virtual ::arrow::Status SkipRecords(int64_t num_records) {
+    if (num_records <= 0) {
+      return Status::OK();
+    }
+    RETURN_NOT_OK(LoadBatch(num_records));
+    std::shared_ptr<::arrow::ChunkedArray> discarded;
+    return BuildArray(num_records, &discarded);
+  }
+
   virtual ::arrow::Status BuildArray(int64_t length_upper_bound,
                                      std::shared_ptr<::arrow::ChunkedArray>* out) = 0;
   virtual bool IsOrHasRepeatedChild() const = 0;
+
+  // Called on the children of nested readers: their def/rep levels and
+  // single-chunk output are consumed by the nested reconstruction, so
+  // loading shortcuts that do not preserve them must be disabled
+  virtual void NotifyNestedParent() {}
 };
 
 namespace {
@@ -233,6 +250,14 @@ class FileReaderImpl : public FileReader {
 
     auto included_leaves = VectorToSharedSet(column_indices);
 
+    if (reader_properties_.use_threads()) {
+      // Leaf readers consult the page index from concurrent column tasks and
+      // its lazy initialization is not thread-safe, so force it here
+      BEGIN_PARQUET_CATCH_EXCEPTIONS
+      reader_->GetPageIndexReader();
+      END_PARQUET_CATCH_EXCEPTIONS
+    }
+
     out->resize(field_indices.size());
     ::arrow::FieldVector out_fields(field_indices.size());
     for (size_t i = 0; i < out->size(); ++i) {
@@ -326,6 +351,16 @@ class FileReaderImpl : public FileReader {
     return ReadRowGroup(i, Iota(reader_->metadata()->num_columns()), table);
   }
 
+  Status ReadRowRange(int64_t start_row, int64_t num_rows,
+                      const std::vector<int>& column_indices,
+                      std::shared_ptr<Table>* out) override;
+
+  Status ReadRowRange(int64_t start_row, int64_t num_rows,
+                      std::shared_ptr<Table>* out) override {
+    return ReadRowRange(start_row, num_rows, Iota(reader_->metadata()->num_columns()),
+                        out);
+  }
+
   Result<std::unique_ptr<RecordBatchReader>> GetRecordBatchReader(
       const std::vector<int>& row_group_indices,
       const std::vector<int>& column_indices) override;
@@ -441,6 +476,33 @@ class RowGroupReaderImpl : public RowGroupReader {
 // ----------------------------------------------------------------------
 // Column reader implementations
 
+// Whether a leaf column may be read through the record reader's zero-copy
+// path: the column must be flat and required, and the transfer must go
+// through TransferZeroCopy, i.e. the Arrow type must map onto the physical
+// values unchanged.
+bool IsZeroCopyCompatible(const Field& field, const ColumnDescriptor* descr) {
+  if (descr->max_definition_level() != 0 || descr->max_repetition_level() != 0) {
+    return false;
+  }
+  switch (field.type()->id()) {
+    case ::arrow::Type::INT32:
+      return descr->physical_type() == Type::INT32;
+    case ::arrow::Type::INT64:
+      return descr->physical_type() == Type::INT64;
+    case ::arrow::Type::FLOAT:
+      return descr->physical_type() == Type::FLOAT;
+    case ::arrow::Type::DOUBLE:
+      return descr->physical_type() == Type::DOUBLE;
+    case ::arrow::Type::TIMESTAMP: {
+      const auto& ts_type = checked_cast<const ::arrow::TimestampType&>(*field.type());
+      return descr->physical_type() == Type::INT64 &&
+             ts_type.unit() != ::arrow::TimeUnit::SECOND;
+    }
+    default:
+      return false;
+  }
+}
+
 // Leaf reader is for primitive arrays and primitive children of nested arrays
 class LeafReader : public ColumnReaderImpl {
  public:
@@ -450,9 +512,14 @@ class LeafReader : public ColumnReaderImpl {
       : ctx_(std::move(ctx)),
         field_(std::move(field)),
         input_(std::move(input)),
-        descr_(input_->descr()) {
+        descr_(input_->descr()),
+        leaf_info_(leaf_info) {
     record_reader_ = RecordReader::Make(
         descr_, leaf_info, ctx_->pool, field_->type()->id() == ::arrow::Type::DICTIONARY);
+    if (ctx_->reader_properties->zero_copy_reads() &&
+        IsZeroCopyCompatible(*field_, descr_)) {
+      record_reader_->set_zero_copy_values(true);
+    }
     NextRowGroup();
   }
 
@@ -470,9 +537,32 @@ class LeafReader : public ColumnReaderImpl {
 
   bool IsOrHasRepeatedChild() const final { return false; }
 
+  void NotifyNestedParent() final { nested_parent_ = true; }
+
+  Status SkipRecords(int64_t num_records) final {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    while (num_records > 0 && record_reader_->HasMoreData()) {
+      TrySkipPagesWithOffsetIndex(&num_records);
+      const int64_t skipped = record_reader_->SkipRecords(num_records);
+      num_records -= skipped;
+      at_chunk_start_ = false;
+      if (skipped == 0) {
+        NextRowGroup();
+      }
+    }
+    return Status::OK();
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
   Status LoadBatch(int64_t records_to_read) final {
     BEGIN_PARQUET_CATCH_EXCEPTIONS
     out_ = nullptr;
+    at_chunk_start_ = false;
+    bool loaded_parallel = false;
+    RETURN_NOT_OK(TryLoadBatchParallel(records_to_read, &loaded_parallel));
+    if (loaded_parallel) {
+      return Status::OK();
+    }
     record_reader_->Reset();
     // Pre-allocation gives much better performance for flat columns
     record_reader_->Reserve(records_to_read);
@@ -514,17 +604,232 @@ class LeafReader : public ColumnReaderImpl {
   const std::shared_ptr<Field> field() override { return field_; }
 
  private:
+  // A contiguous run of data pages of one column chunk, decoded by one task
+  struct PageRange {
+    int row_group;
+    size_t first_page;
+    size_t end_page;
+    int64_t num_records;
+  };
+
+  // Ranges smaller than this are not worth a separate task
+  static constexpr int64_t kMinRecordsPerRange = 64 * 1024;
+
+  // Decode the remaining column chunks with one task per run of data pages,
+  // using the offset index to delimit the runs.  Only engaged for flat
+  // columns read in full: data pages of a flat column start at record
+  // boundaries, so every page range decodes independently into its own
+  // chunks of the output.
+  Status TryLoadBatchParallel(int64_t records_to_read, bool* done) {
+    *done = false;
+    const bool first_load = first_load_;
+    first_load_ = false;
+    if (!first_load || !ctx_->reader_properties->use_threads() ||
+        ctx_->reader_properties->should_load_statistics()) {
+      return Status::OK();
+    }
+    // Page boundaries are only guaranteed to be record boundaries for flat
+    // columns; dictionary output needs the chunk-wide dictionary built by the
+    // serial reader.
+    if (nested_parent_ || leaf_info_.rep_level > 0 ||
+        field_->type()->id() == ::arrow::Type::DICTIONARY) {
+      return Status::OK();
+    }
+    auto* executor = ::arrow::internal::GetCpuThreadPool();
+    // Column-level tasks of a table read may already occupy pool threads and
+    // would block on the page tasks below; engage only if those parents
+    // cannot saturate the pool.
+    const int column_tasks =
+        ctx_->filter_leaves ? static_cast<int>(ctx_->included_leaves->size()) : 1;
+    if (executor->GetCapacity() <= std::max(column_tasks, 1)) {
+      return Status::OK();
+    }
+    if (input_->row_group_index() < 0) {
+      return Status::OK();
+    }
+    std::vector<int> row_groups = {input_->row_group_index()};
+    for (int row_group : input_->pending_row_groups()) {
+      row_groups.push_back(row_group);
+    }
+
+    const int column_index = input_->column_index();
+    auto metadata = ctx_->reader->metadata();
+    int64_t total_records = 0;
+    for (int row_group : row_groups) {
+      auto chunk_metadata = metadata->RowGroup(row_group)->ColumnChunk(column_index);
+      // Decryption tracks page ordinals, so pages cannot be skipped
+      if (chunk_metadata->crypto_metadata() != nullptr) {
+        return Status::OK();
+      }
+      total_records += chunk_metadata->num_values();
+    }
+    // Only a full read of the chunks can be cut into page ranges up front
+    if (total_records == 0 || records_to_read != total_records) {
+      return Status::OK();
+    }
+
+    auto page_index_reader = ctx_->reader->GetPageIndexReader();
+    if (page_index_reader == nullptr) {
+      return Status::OK();
+    }
+    std::vector<PageRange> ranges;
+    for (int row_group : row_groups) {
+      auto row_group_index_reader = page_index_reader->RowGroup(row_group);
+      if (row_group_index_reader == nullptr) {
+        return Status::OK();
+      }
+      auto offset_index = row_group_index_reader->GetOffsetIndex(column_index);
+      if (offset_index == nullptr) {
+        return Status::OK();
+      }
+      const std::vector<PageLocation>& pages = offset_index->page_locations();
+      if (pages.empty()) {
+        return Status::OK();
+      }
+      const int64_t chunk_records =
+          metadata->RowGroup(row_group)->ColumnChunk(column_index)->num_values();
+      const auto num_pages = static_cast<int64_t>(pages.size());
+      const int64_t num_ranges =
+          std::clamp<int64_t>(chunk_records / kMinRecordsPerRange, 1,
+                              std::min<int64_t>(num_pages, executor->GetCapacity()));
+      for (int64_t range = 0; range < num_ranges; ++range) {
+        const auto first_page = static_cast<size_t>(range * num_pages / num_ranges);
+        const auto end_page = static_cast<size_t>((range + 1) * num_pages / num_ranges);
+        const int64_t first_record = pages[first_page].first_row_index;
+        const int64_t end_record = end_page == pages.size()
+                                       ? chunk_records
+                                       : pages[end_page].first_row_index;
+        ranges.push_back({row_group, first_page, end_page, end_record - first_record});
+      }
+    }
+    if (ranges.size() <= 1) {
+      return Status::OK();
+    }
+
+    ::arrow::ChunkedArrayVector range_outputs(ranges.size());
+    RETURN_NOT_OK(::arrow::internal::ParallelFor(
+        static_cast<int>(ranges.size()),
+        [&](int i) { return ReadPageRange(ranges[i], &range_outputs[i]); }, executor));
+
+    ::arrow::ArrayVector chunks;
+    for (const auto& range_output : range_outputs) {
+      for (const auto& chunk : range_output->chunks()) {
+        if (chunk->length() > 0) {
+          chunks.push_back(chunk);
+        }
+      }
+    }
+    out_ = std::make_shared<ChunkedArray>(std::move(chunks), field_->type());
+    // The serial reader state is no longer meaningful; mark it exhausted
+    input_->SkipPendingRowGroups();
+    record_reader_->SetPageReader(nullptr);
+    *done = true;
+    return Status::OK();
+  }
+
+  Status ReadPageRange(const PageRange& range,
+                       std::shared_ptr<ChunkedArray>* out) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    std::unique_ptr<PageReader> page_reader =
+        ctx_->reader->RowGroup(range.row_group)
+            ->GetColumnPageReader(input_->column_index());
+    // The offset index lists data pages in file order and the filter is only
+    // consulted for data pages, so a running ordinal lines the two up; pages
+    // outside the range are skipped without being decompressed.
+    page_reader->set_data_page_filter(
+        [range, ordinal = size_t{0}](const DataPageStats&) mutable {
+          const size_t page = ordinal++;
+          return page < range.first_page || page >= range.end_page;
+        });
+    std::shared_ptr<RecordReader> record_reader =
+        RecordReader::Make(descr_, leaf_info_, ctx_->pool, /*read_dictionary=*/false);
+    record_reader->SetPageReader(std::move(page_reader));
+    record_reader->Reserve(range.num_records);
+    const int64_t records_read = record_reader->ReadRecords(range.num_records);
+    if (records_read != range.num_records) {
+      return Status::IOError("Expected to decode ", range.num_records,
+                             " records from a range of data pages but got ",
+                             records_read);
+    }
+    return TransferColumnData(record_reader.get(), /*metadata=*/nullptr, field_, descr_,
+                              ctx_.get(), out);
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
   std::shared_ptr<ChunkedArray> out_;
   void NextRowGroup() {
     std::unique_ptr<PageReader> page_reader = input_->NextChunk();
+    current_page_reader_ = page_reader.get();
     record_reader_->SetPageReader(std::move(page_reader));
+    at_chunk_start_ = true;
+  }
+
+  // When positioned at the start of a column chunk, pages wholly inside the
+  // records to skip can be dropped via the data page filter without being
+  // decompressed, using the offset index to count the records they hold.
+  // Reduces *num_records by the records the dropped pages held.
+  void TrySkipPagesWithOffsetIndex(int64_t* num_records) {
+    if (!at_chunk_start_ || current_page_reader_ == nullptr) {
+      return;
+    }
+    const int row_group = input_->row_group_index();
+    if (row_group < 0) {
+      return;
+    }
+    // Decryption tracks page ordinals, so pages cannot be skipped
+    if (input_->column_chunk_metadata()->crypto_metadata() != nullptr) {
+      return;
+    }
+    auto page_index_reader = ctx_->reader->GetPageIndexReader();
+    if (page_index_reader == nullptr) {
+      return;
+    }
+    auto row_group_index_reader = page_index_reader->RowGroup(row_group);
+    if (row_group_index_reader == nullptr) {
+      return;
+    }
+    auto offset_index = row_group_index_reader->GetOffsetIndex(input_->column_index());
+    if (offset_index == nullptr) {
+      return;
+    }
+    const std::vector<PageLocation>& pages = offset_index->page_locations();
+    if (pages.empty()) {
+      return;
+    }
+    // The last page starting at or before the target record holds it; all
+    // earlier pages can be dropped.
+    auto it = std::upper_bound(pages.begin(), pages.end(), *num_records,
+                               [](int64_t target, const PageLocation& page) {
+                                 return target < page.first_row_index;
+                               });
+    if (it == pages.begin()) {
+      return;
+    }
+    const auto first_kept_page = static_cast<size_t>(it - pages.begin()) - 1;
+    if (first_kept_page == 0) {
+      return;
+    }
+    // The offset index lists data pages in file order and the filter is only
+    // consulted for data pages, so a running ordinal lines the two up.
+    current_page_reader_->set_data_page_filter(
+        [first_kept_page, ordinal = size_t{0}](const DataPageStats&) mutable {
+          return ordinal++ < first_kept_page;
+        });
+    *num_records -= pages[first_kept_page].first_row_index;
   }
 
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
   std::unique_ptr<FileColumnIterator> input_;
   const ColumnDescriptor* descr_;
+  ::parquet::internal::LevelInfo leaf_info_;
   std::shared_ptr<RecordReader> record_reader_;
+  // The page reader currently feeding record_reader_; owned by it
+  PageReader* current_page_reader_ = nullptr;
+  // Whether no page of the current column chunk has been consumed yet
+  bool at_chunk_start_ = false;
+  bool first_load_ = true;
+  bool nested_parent_ = false;
 };
 
 // Column reader for extension arrays
@@ -546,6 +851,12 @@ class ExtensionReader : public ColumnReaderImpl {
     return storage_reader_->LoadBatch(number_of_records);
   }
 
+  Status SkipRecords(int64_t num_records) final {
+    return storage_reader_->SkipRecords(num_records);
+  }
+
+  void NotifyNestedParent() final { storage_reader_->NotifyNestedParent(); }
+
   Status BuildArray(int64_t length_upper_bound,
                     std::shared_ptr<ChunkedArray>* out) override {
     std::shared_ptr<ChunkedArray> storage;
@@ -699,6 +1010,9 @@ class PARQUET_NO_EXPORT StructReader : public ColumnReaderImpl {
         filtered_field_(std::move(filtered_field)),
         level_info_(level_info),
         children_(std::move(children)) {
+    for (const std::unique_ptr<ColumnReaderImpl>& child : children_) {
+      child->NotifyNestedParent();
+    }
     // There could be a mix of children some might be repeated some might not be.
     // If possible use one that isn't since that will be guaranteed to have the least
     // number of levels to reconstruct a nullable bitmap.
@@ -1254,6 +1568,67 @@ Status FileReaderImpl::ReadRowGroups(const std::vector<int>& row_groups,
   return Status::OK();
 }
 
+Status FileReaderImpl::ReadRowRange(int64_t start_row, int64_t num_rows,
+                                    const std::vector<int>& column_indices,
+                                    std::shared_ptr<Table>* out) {
+  const int64_t total_rows = reader_->metadata()->num_rows();
+  if (start_row < 0 || num_rows < 0 || start_row + num_rows > total_rows) {
+    return Status::Invalid("Row range [", start_row, ", ", start_row + num_rows,
+                           ") is out of bounds for a file with ", total_rows, " rows");
+  }
+  for (int i : column_indices) {
+    RETURN_NOT_OK(BoundsCheckColumn(i));
+  }
+
+  // Select the row groups overlapping the range; the rows of the first one
+  // before start_row are skipped below.
+  std::vector<int> row_groups;
+  int64_t skip_rows = 0;
+  int64_t row_offset = 0;
+  for (int i = 0; i < num_row_groups(); ++i) {
+    int64_t row_group_rows;
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    row_group_rows = reader_->metadata()->RowGroup(i)->num_rows();
+    END_PARQUET_CATCH_EXCEPTIONS
+    if (row_offset + row_group_rows <= start_row) {
+      row_offset += row_group_rows;
+      continue;
+    }
+    if (row_offset >= start_row + num_rows) {
+      break;
+    }
+    if (row_groups.empty()) {
+      skip_rows = start_row - row_offset;
+    }
+    row_groups.push_back(i);
+    row_offset += row_group_rows;
+  }
+
+  if (reader_properties_.pre_buffer()) {
+    BEGIN_PARQUET_CATCH_EXCEPTIONS
+    parquet_reader()->PreBuffer(row_groups, column_indices,
+                                reader_properties_.io_context(),
+                                reader_properties_.cache_options());
+    END_PARQUET_CATCH_EXCEPTIONS
+  }
+
+  std::vector<std::shared_ptr<ColumnReaderImpl>> readers;
+  std::shared_ptr<::arrow::Schema> result_schema;
+  RETURN_NOT_OK(GetFieldReaders(column_indices, row_groups, &readers, &result_schema));
+
+  ::arrow::ChunkedArrayVector columns(readers.size());
+  RETURN_NOT_OK(::arrow::internal::OptionalParallelFor(
+      reader_properties_.use_threads(), static_cast<int>(readers.size()), [&](int i) {
+        RETURN_NOT_OK(readers[i]->SkipRecords(skip_rows));
+        return readers[i]->NextBatch(num_rows, &columns[i]);
+      }));
+
+  auto table = Table::Make(std::move(result_schema), std::move(columns), num_rows);
+  RETURN_NOT_OK(table->Validate());
+  *out = std::move(table);
+  return Status::OK();
+}
+
 Future<std::shared_ptr<Table>> FileReaderImpl::DecodeRowGroups(
     std::shared_ptr<FileReaderImpl> self, const std::vector<int>& row_groups,
     const std::vector<int>& column_indices, ::arrow::internal::Executor* cpu_executor) {
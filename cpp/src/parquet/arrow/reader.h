@@ -248,6 +248,24 @@ class PARQUET_EXPORT FileReader {
   virtual ::arrow::Status ReadRowGroups(const std::vector<int>& row_groups,
                                         std::shared_ptr<::arrow::Table>* out) = 0;
 
+  /// \brief Read rows [start_row, start_row + num_rows) of the file into a Table
+  ///
+  /// Only the row groups overlapping the range are opened. Rows of the first
+  /// row group before start_row are skipped rather than decoded, and when the
+  /// file has a page index, leading data pages wholly before start_row are not
+  /// even decompressed, making random access proportional to the pages touched
+  /// rather than to the file position.
+  ///
+  /// \note API EXPERIMENTAL
+  virtual ::arrow::Status ReadRowRange(int64_t start_row, int64_t num_rows,
+                                       const std::vector<int>& column_indices,
+                                       std::shared_ptr<::arrow::Table>* out) = 0;
+
+  /// \brief Read rows [start_row, start_row + num_rows) of all columns
+  /// \note API EXPERIMENTAL
+  virtual ::arrow::Status ReadRowRange(int64_t start_row, int64_t num_rows,
+                                       std::shared_ptr<::arrow::Table>* out) = 0;
+
   /// \brief Scan file contents with one thread, return number of rows
   virtual ::arrow::Status ScanContents(std::vector<int> columns,
                                        const int32_t column_batch_size,
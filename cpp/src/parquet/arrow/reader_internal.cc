@@ -422,14 +422,20 @@ template <typename ArrowType, typename ParquetType>
 std::shared_ptr<Array> TransferZeroCopy(
     RecordReader* reader, std::unique_ptr<::parquet::ColumnChunkMetaData> metadata,
     const ReaderContext* ctx, const std::shared_ptr<Field>& field) {
+  // Values may have been read as a slice of the page buffers instead of
+  // being copied into the record reader's own buffer.
+  std::shared_ptr<Buffer> values = reader->ReleaseZeroCopyValues();
+  if (values == nullptr) {
+    values = reader->ReleaseValues();
+  }
   std::shared_ptr<::arrow::ArrayData> data;
   if (field->nullable()) {
     std::vector<std::shared_ptr<Buffer>> buffers = {reader->ReleaseIsValid(),
-                                                    reader->ReleaseValues()};
+                                                    std::move(values)};
     data = std::make_shared<::arrow::ArrayData>(field->type(), reader->values_written(),
                                                 std::move(buffers), reader->null_count());
   } else {
-    std::vector<std::shared_ptr<Buffer>> buffers = {nullptr, reader->ReleaseValues()};
+    std::vector<std::shared_ptr<Buffer>> buffers = {nullptr, std::move(values)};
     data = std::make_shared<::arrow::ArrayData>(field->type(), reader->values_written(),
                                                 std::move(buffers), /*null_count=*/0);
   }
@@ -98,6 +98,14 @@ class FileColumnIterator {
 
   int column_index() const { return column_index_; }
 
+  // Row groups that NextChunk() has not returned yet
+  std::vector<int> pending_row_groups() const {
+    return std::vector<int>(row_groups_.begin(), row_groups_.end());
+  }
+
+  // Drop row groups that NextChunk() has not returned yet
+  void SkipPendingRowGroups() { row_groups_.clear(); }
+
   int row_group_index() const { return row_group_index_; }
 
  protected:
@@ -379,6 +379,9 @@ class FileWriterImpl : public FileWriter {
     }
 
     auto WriteRowGroup = [&](int64_t offset, int64_t size) {
+      if (arrow_properties_->use_threads()) {
+        return WriteRowGroupParallel(table, offset, size);
+      }
       RETURN_NOT_OK(NewRowGroup());
       for (int i = 0; i < table.num_columns(); i++) {
         RETURN_NOT_OK(WriteColumnChunk(table.column(i), offset, size));
@@ -421,7 +424,8 @@ class FileWriterImpl : public FileWriter {
 
     // Initialize a new buffered row group writer if necessary.
     if (row_group_writer_ == nullptr || !row_group_writer_->buffered() ||
-        row_group_writer_->num_rows() >= max_row_group_length) {
+        row_group_writer_->num_rows() >= max_row_group_length ||
+        ShouldSplitEarly()) {
       RETURN_NOT_OK(NewBufferedRowGroup());
     }
 
@@ -454,16 +458,27 @@ class FileWriterImpl : public FileWriter {
       return Status::OK();
     };
 
+    // Row alignment of early row group splits. Chunks never cross an
+    // alignment boundary, so every potential split point below lands on a
+    // multiple of the alignment.
+    const int64_t row_alignment = this->properties().row_group_row_alignment();
+
     int64_t offset = 0;
     while (offset < batch.num_rows()) {
-      const int64_t batch_size =
-          std::min(max_row_group_length - row_group_writer_->num_rows(),
-                   batch.num_rows() - offset);
+      int64_t batch_size = std::min(max_row_group_length - row_group_writer_->num_rows(),
+                                    batch.num_rows() - offset);
+      if (row_alignment > 1) {
+        batch_size = std::min(batch_size,
+                              row_alignment - row_group_writer_->num_rows() % row_alignment);
+      }
       RETURN_NOT_OK(WriteBatch(offset, batch_size));
       offset += batch_size;
 
-      // Flush current row group writer and create a new writer if it is full.
-      if (row_group_writer_->num_rows() >= max_row_group_length &&
+      // Flush the current row group writer and create a new writer if it is
+      // full, if a column's dictionary is about to overflow and early splits
+      // are enabled, or if the predicted decoded size reached its limit.
+      if ((row_group_writer_->num_rows() >= max_row_group_length ||
+           ShouldSplitEarly()) &&
           offset < batch.num_rows()) {
         RETURN_NOT_OK(NewBufferedRowGroup());
       }
@@ -474,6 +489,38 @@ class FileWriterImpl : public FileWriter {
 
   const WriterProperties& properties() const { return *writer_->properties(); }
 
+  // Whether the current row group should be closed early to give every
+  // column a fresh dictionary before one of them falls back to plain
+  // encoding (see WriterProperties::dictionary_fallback_split_enabled()).
+  bool ShouldSplitForDictionaryFallback() const {
+    return writer_->properties()->dictionary_fallback_split_enabled() &&
+           row_group_writer_->num_rows() > 0 &&
+           row_group_writer_->dictionary_fallback_imminent();
+  }
+
+  // Whether the current row group should be closed because its predicted
+  // in-memory decoded size reached the configured limit (see
+  // WriterProperties::max_row_group_decoded_bytes()).
+  bool ShouldSplitForDecodedSize() const {
+    const int64_t max_decoded_bytes =
+        writer_->properties()->max_row_group_decoded_bytes();
+    return max_decoded_bytes > 0 && row_group_writer_->num_rows() > 0 &&
+           row_group_writer_->estimated_decoded_bytes() >= max_decoded_bytes;
+  }
+
+  // Early splits (dictionary fallback, decoded size) only happen at multiples
+  // of the configured row alignment; WriteRecordBatch arranges for write
+  // chunks to stop at every alignment boundary, so a deferred split fires as
+  // soon as the next boundary is reached.
+  bool ShouldSplitEarly() const {
+    if (!ShouldSplitForDictionaryFallback() && !ShouldSplitForDecodedSize()) {
+      return false;
+    }
+    const int64_t row_alignment = writer_->properties()->row_group_row_alignment();
+    return row_alignment <= 1 ||
+           row_group_writer_->num_rows() % row_alignment == 0;
+  }
+
   ::arrow::MemoryPool* memory_pool() const override {
     return column_write_context_.memory_pool;
   }
@@ -493,6 +540,31 @@ class FileWriterImpl : public FileWriter {
  private:
   friend class FileWriter;
 
+  // Write one row group of a table with all columns encoded in parallel.
+  // Uses a buffered row group writer so that each column writer can encode
+  // and compress its pages independently; the completed chunks are
+  // serialized in column order when the row group is closed.
+  Status WriteRowGroupParallel(const Table& table, int64_t offset, int64_t size) {
+    RETURN_NOT_OK(NewBufferedRowGroup());
+    std::vector<std::unique_ptr<ArrowColumnWriterV2>> writers;
+    writers.reserve(table.num_columns());
+    int column_index_start = 0;
+    for (int i = 0; i < table.num_columns(); i++) {
+      ARROW_ASSIGN_OR_RAISE(
+          std::unique_ptr<ArrowColumnWriterV2> writer,
+          ArrowColumnWriterV2::Make(*table.column(i), offset, size, schema_manifest_,
+                                    row_group_writer_, column_index_start));
+      column_index_start += writer->leaf_count();
+      writers.emplace_back(std::move(writer));
+    }
+
+    DCHECK_EQ(parallel_column_write_contexts_.size(), writers.size());
+    return ::arrow::internal::ParallelFor(
+        static_cast<int>(writers.size()),
+        [&](int i) { return writers[i]->Write(&parallel_column_write_contexts_[i]); },
+        arrow_properties_->executor());
+  }
+
   std::shared_ptr<::arrow::Schema> schema_;
 
   SchemaManifest schema_manifest_;
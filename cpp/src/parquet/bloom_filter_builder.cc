@@ -0,0 +1,85 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/bloom_filter_builder.h"
+
+#include <map>
+#include <utility>
+#include <vector>
+
+#include "parquet/bloom_filter.h"
+#include "parquet/exception.h"
+#include "parquet/metadata.h"
+#include "parquet/schema.h"
+
+namespace parquet {
+
+namespace {
+
+class BloomFilterBuilderImpl : public BloomFilterBuilder {
+ public:
+  explicit BloomFilterBuilderImpl(const SchemaDescriptor* schema) : schema_(schema) {}
+
+  void AppendRowGroup() override { row_group_filters_.emplace_back(); }
+
+  void AddBloomFilter(int32_t column_ordinal,
+                      std::unique_ptr<BloomFilter> bloom_filter) override {
+    if (row_group_filters_.empty()) {
+      throw ParquetException(
+          "AppendRowGroup() must be called before AddBloomFilter()");
+    }
+    if (column_ordinal < 0 || column_ordinal >= schema_->num_columns()) {
+      throw ParquetException("Invalid column ordinal: ", column_ordinal);
+    }
+    row_group_filters_.back()[column_ordinal] = std::move(bloom_filter);
+  }
+
+  void WriteTo(::arrow::io::OutputStream* sink,
+               BloomFilterLocation* location) const override {
+    for (size_t row_group_ordinal = 0; row_group_ordinal < row_group_filters_.size();
+         ++row_group_ordinal) {
+      const auto& filters = row_group_filters_[row_group_ordinal];
+      if (filters.empty()) {
+        continue;
+      }
+      auto& row_group_location = location->bloom_filter_location[row_group_ordinal];
+      row_group_location.resize(schema_->num_columns(), std::nullopt);
+      for (const auto& [column_ordinal, filter] : filters) {
+        PARQUET_ASSIGN_OR_THROW(int64_t offset, sink->Tell());
+        filter->WriteTo(sink);
+        PARQUET_ASSIGN_OR_THROW(int64_t end, sink->Tell());
+        row_group_location[column_ordinal] =
+            IndexLocation{offset, static_cast<int32_t>(end - offset)};
+      }
+    }
+  }
+
+ private:
+  const SchemaDescriptor* schema_;
+  // Per row group, the filters of the chunks that produced one, by column
+  // ordinal.
+  std::vector<std::map<int32_t, std::unique_ptr<BloomFilter>>> row_group_filters_;
+};
+
+}  // namespace
+
+std::unique_ptr<BloomFilterBuilder> BloomFilterBuilder::Make(
+    const SchemaDescriptor* schema) {
+  return std::make_unique<BloomFilterBuilderImpl>(schema);
+}
+
+}  // namespace parquet
@@ -0,0 +1,63 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+
+#include "parquet/platform.h"
+
+namespace parquet {
+
+class BloomFilter;
+class SchemaDescriptor;
+struct BloomFilterLocation;
+
+/// \brief Collects the bloom filters built for each column chunk and
+/// serializes them before the footer is written.
+///
+/// Column writers hand over one finished filter per chunk via AddBloomFilter;
+/// the file writer serializes all of them with WriteTo and records the
+/// resulting locations in the file metadata.
+class PARQUET_EXPORT BloomFilterBuilder {
+ public:
+  /// \brief API convenience to create a BloomFilterBuilder.
+  static std::unique_ptr<BloomFilterBuilder> Make(const SchemaDescriptor* schema);
+
+  virtual ~BloomFilterBuilder() = default;
+
+  /// \brief Start a new row group.
+  virtual void AppendRowGroup() = 0;
+
+  /// \brief Add the finished bloom filter of a column chunk in the current
+  /// row group.
+  ///
+  /// \param column_ordinal Column ordinal of the chunk the filter was built for.
+  /// \param bloom_filter The filter; ownership is transferred to the builder.
+  virtual void AddBloomFilter(int32_t column_ordinal,
+                              std::unique_ptr<BloomFilter> bloom_filter) = 0;
+
+  /// \brief Serialize all collected bloom filters.
+  ///
+  /// \param[out] sink The output stream to write the bloom filters.
+  /// \param[out] location The location of every bloom filter in the sink.
+  virtual void WriteTo(::arrow::io::OutputStream* sink,
+                       BloomFilterLocation* location) const = 0;
+};
+
+}  // namespace parquet
@@ -16,20 +16,46 @@
 // under the License.
 
 #include "parquet/bloom_filter_reader.h"
+
+#include <numeric>
+#include <unordered_map>
+
+#include "arrow/io/caching.h"
+#include "arrow/io/memory.h"
 #include "parquet/bloom_filter.h"
 #include "parquet/exception.h"
 #include "parquet/metadata.h"
 
 namespace parquet {
 
+namespace {
+
+/// Coalesced prefetch state shared between the file-level reader and the
+/// row group readers it hands out. Created by the first call to WillNeed().
+struct BloomFilterPrefetch {
+  BloomFilterPrefetch(std::shared_ptr<::arrow::io::RandomAccessFile> input,
+                      MemoryPool* pool)
+      : cache(std::move(input), ::arrow::io::IOContext(pool)) {}
+
+  /// Caches and coalesces the raw bytes of the requested bloom filters.
+  ::arrow::io::internal::ReadRangeCache cache;
+
+  /// Ranges given to the cache, keyed by bloom filter offset.
+  std::unordered_map<int64_t, ::arrow::io::ReadRange> ranges;
+};
+
+}  // namespace
+
 class RowGroupBloomFilterReaderImpl final : public RowGroupBloomFilterReader {
  public:
   RowGroupBloomFilterReaderImpl(std::shared_ptr<::arrow::io::RandomAccessFile> input,
                                 std::shared_ptr<RowGroupMetaData> row_group_metadata,
-                                const ReaderProperties& properties)
+                                const ReaderProperties& properties,
+                                std::shared_ptr<BloomFilterPrefetch> prefetch)
       : input_(std::move(input)),
         row_group_metadata_(std::move(row_group_metadata)),
-        properties_(properties) {}
+        properties_(properties),
+        prefetch_(std::move(prefetch)) {}
 
   std::unique_ptr<BloomFilter> GetColumnBloomFilter(int i) override;
 
@@ -42,6 +68,9 @@ class RowGroupBloomFilterReaderImpl final : public RowGroupBloomFilterReader {
 
   /// Reader properties used to deserialize thrift object.
   const ReaderProperties& properties_;
+
+  /// Prefetched bloom filter bytes, if WillNeed() has been called.
+  std::shared_ptr<BloomFilterPrefetch> prefetch_;
 };
 
 std::unique_ptr<BloomFilter> RowGroupBloomFilterReaderImpl::GetColumnBloomFilter(int i) {
@@ -72,6 +101,18 @@ std::unique_ptr<BloomFilter> RowGroupBloomFilterReaderImpl::GetColumnBloomFilter
       throw ParquetException(
           "bloom filter length + bloom filter offset greater than file size");
     }
+    if (prefetch_ != nullptr) {
+      auto it = prefetch_->ranges.find(*bloom_filter_offset);
+      if (it != prefetch_->ranges.end()) {
+        /// The bloom filter was requested by WillNeed(), read it from the
+        /// coalesced cache instead of issuing a separate read.
+        PARQUET_ASSIGN_OR_THROW(auto buffer, prefetch_->cache.Read(it->second));
+        ::arrow::io::BufferReader buffer_reader(std::move(buffer));
+        auto bloom_filter = BlockSplitBloomFilter::Deserialize(
+            properties_, &buffer_reader, bloom_filter_length);
+        return std::make_unique<BlockSplitBloomFilter>(std::move(bloom_filter));
+      }
+    }
   }
   auto stream = ::arrow::io::RandomAccessFile::GetStream(
       input_, *bloom_filter_offset, file_size - *bloom_filter_offset);
@@ -101,7 +142,53 @@ class BloomFilterReaderImpl final : public BloomFilterReader {
 
     auto row_group_metadata = file_metadata_->RowGroup(i);
     return std::make_shared<RowGroupBloomFilterReaderImpl>(
-        input_, std::move(row_group_metadata), properties_);
+        input_, std::move(row_group_metadata), properties_, prefetch_);
+  }
+
+  void WillNeed(const std::vector<int32_t>& row_group_indices,
+                const std::vector<int32_t>& column_indices) override {
+    auto prefetch = prefetch_;
+    if (prefetch == nullptr) {
+      prefetch =
+          std::make_shared<BloomFilterPrefetch>(input_, properties_.memory_pool());
+    }
+    std::vector<::arrow::io::ReadRange> read_ranges;
+    for (int32_t row_group_ordinal : row_group_indices) {
+      if (row_group_ordinal < 0 || row_group_ordinal >= file_metadata_->num_row_groups()) {
+        throw ParquetException("Invalid row group ordinal: ", row_group_ordinal);
+      }
+      auto row_group_metadata = file_metadata_->RowGroup(row_group_ordinal);
+      std::vector<int32_t> columns = column_indices;
+      if (columns.empty()) {
+        columns.resize(row_group_metadata->num_columns());
+        std::iota(columns.begin(), columns.end(), 0);
+      }
+      for (int32_t column_ordinal : columns) {
+        if (column_ordinal < 0 || column_ordinal >= row_group_metadata->num_columns()) {
+          throw ParquetException("Invalid column index at column ordinal ",
+                                 column_ordinal);
+        }
+        auto col_chunk = row_group_metadata->ColumnChunk(column_ordinal);
+        if (col_chunk->crypto_metadata() != nullptr) {
+          /// GetColumnBloomFilter() will throw on access; nothing to prefetch.
+          continue;
+        }
+        auto bloom_filter_offset = col_chunk->bloom_filter_offset();
+        auto bloom_filter_length = col_chunk->bloom_filter_length();
+        if (!bloom_filter_offset.has_value() || !bloom_filter_length.has_value() ||
+            *bloom_filter_length <= 0) {
+          /// Without a serialized length the extent of the bloom filter is
+          /// unknown, so it cannot be fetched ahead of deserialization.
+          continue;
+        }
+        ::arrow::io::ReadRange read_range{*bloom_filter_offset, *bloom_filter_length};
+        if (prefetch->ranges.emplace(*bloom_filter_offset, read_range).second) {
+          read_ranges.push_back(read_range);
+        }
+      }
+    }
+    PARQUET_THROW_NOT_OK(prefetch->cache.Cache(std::move(read_ranges)));
+    prefetch_ = std::move(prefetch);
   }
 
  private:
@@ -113,6 +200,9 @@ class BloomFilterReaderImpl final : public BloomFilterReader {
 
   /// Reader properties used to deserialize thrift object.
   const ReaderProperties& properties_;
+
+  /// Coalesced prefetch state, created by the first call to WillNeed().
+  std::shared_ptr<BloomFilterPrefetch> prefetch_;
 };
 
 std::unique_ptr<BloomFilterReader> BloomFilterReader::Make(
@@ -17,6 +17,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "arrow/io/interfaces.h"
 #include "parquet/properties.h"
 #include "parquet/type_fwd.h"
@@ -63,6 +65,23 @@ class PARQUET_EXPORT BloomFilterReader {
   ///          to the RowGroupBloomFilterReader.
   /// \throws ParquetException if the index is out of bound.
   virtual std::shared_ptr<RowGroupBloomFilterReader> RowGroup(int i) = 0;
+
+  /// \brief Advise the reader which bloom filters will be read later.
+  ///
+  /// The reader fetches the bloom filters of the requested column chunks in a
+  /// single coalesced I/O pass and caches the raw bytes, so follow-up calls to
+  /// GetColumnBloomFilter() for these column chunks do not issue separate reads.
+  /// Column chunks whose metadata does not record a serialized bloom filter
+  /// length cannot be prefetched and are read directly on access.
+  ///
+  /// \param[in] row_group_indices list of row group ordinals whose bloom filters
+  ///            will be read later.
+  /// \param[in] column_indices list of column ordinals whose bloom filters will
+  ///            be read later. If empty, all columns of the row groups are
+  ///            prefetched.
+  /// \throws ParquetException if any index is out of bound.
+  virtual void WillNeed(const std::vector<int32_t>& row_group_indices,
+                        const std::vector<int32_t>& column_indices) = 0;
 };
 
 }  // namespace parquet
@@ -18,9 +18,12 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "arrow/io/memory.h"
+
 #include "parquet/bloom_filter.h"
 #include "parquet/bloom_filter_reader.h"
 #include "parquet/file_reader.h"
+#include "parquet/file_writer.h"
 #include "parquet/test_util.h"
 
 namespace parquet::test {
@@ -64,6 +67,40 @@ TEST(BloomFilterReader, ReadBloomFilter) {
   }
 }
 
+TEST(BloomFilterReader, WillNeedPrefetch) {
+  // Both files hold the same bloom filter, but only the second one records
+  // bloom_filter_length in its metadata and can actually be prefetched; the
+  // first one exercises the direct-read fallback after WillNeed().
+  std::vector<std::string> files = {"data_index_bloom_encoding_stats.parquet",
+                                    "data_index_bloom_encoding_with_length.parquet"};
+  for (const auto& test_file : files) {
+    std::string dir_string(parquet::test::get_data_dir());
+    std::string path = dir_string + "/" + test_file;
+    auto reader = ParquetFileReader::OpenFile(path, /*memory_map=*/false);
+    auto& bloom_filter_reader = reader->GetBloomFilterReader();
+    bloom_filter_reader.WillNeed(/*row_group_indices=*/{0}, /*column_indices=*/{});
+    EXPECT_THROW_THAT(
+        [&]() { bloom_filter_reader.WillNeed({1}, {}); }, ParquetException,
+        ::testing::Property(&ParquetException::what,
+                            ::testing::HasSubstr("Invalid row group ordinal")));
+    auto row_group_0 = bloom_filter_reader.RowGroup(0);
+    ASSERT_NE(nullptr, row_group_0);
+    auto bloom_filter = row_group_0->GetColumnBloomFilter(0);
+    ASSERT_NE(nullptr, bloom_filter);
+
+    {
+      std::string_view sv = "Hello";
+      ByteArray ba{sv};
+      EXPECT_TRUE(bloom_filter->FindHash(bloom_filter->Hash(&ba)));
+    }
+    {
+      std::string_view sv = "NOT_EXISTS";
+      ByteArray ba{sv};
+      EXPECT_FALSE(bloom_filter->FindHash(bloom_filter->Hash(&ba)));
+    }
+  }
+}
+
 TEST(BloomFilterReader, FileNotHaveBloomFilter) {
   // Can still get a BloomFilterReader and a RowGroupBloomFilter
   // reader, but cannot get a non-null BloomFilter.
@@ -80,4 +117,123 @@ TEST(BloomFilterReader, FileNotHaveBloomFilter) {
   ASSERT_EQ(nullptr, bloom_filter);
 }
 
+TEST(BloomFilterBuilder, WriteRoundtrip) {
+  // Write a file with bloom filters enabled and read the filters back.
+  schema::NodeVector fields;
+  fields.push_back(schema::PrimitiveNode::Make("i64", Repetition::REQUIRED,
+                                               Type::INT64, ConvertedType::NONE));
+  fields.push_back(schema::PrimitiveNode::Make("ba", Repetition::REQUIRED,
+                                               Type::BYTE_ARRAY, ConvertedType::UTF8));
+  fields.push_back(schema::PrimitiveNode::Make("b", Repetition::REQUIRED,
+                                               Type::BOOLEAN, ConvertedType::NONE));
+  auto schema = std::static_pointer_cast<schema::GroupNode>(
+      schema::GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+  auto properties = WriterProperties::Builder().enable_bloom_filter()->build();
+
+  constexpr int kNumRows = 256;
+  std::vector<int64_t> i64_values(kNumRows);
+  std::vector<std::string> strings(kNumRows);
+  std::vector<ByteArray> ba_values(kNumRows);
+  std::vector<bool> bool_values(kNumRows);
+  for (int i = 0; i < kNumRows; ++i) {
+    // Plenty of duplicates so the adaptive sizing sees far fewer distinct
+    // values than rows.
+    i64_values[i] = i % 16;
+    strings[i] = "string-" + std::to_string(i % 32);
+    ba_values[i] = ByteArray{strings[i]};
+    bool_values[i] = (i % 2) == 0;
+  }
+
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+  auto row_group_writer = file_writer->AppendRowGroup();
+  static_cast<Int64Writer*>(row_group_writer->NextColumn())
+      ->WriteBatch(kNumRows, nullptr, nullptr, i64_values.data());
+  static_cast<ByteArrayWriter*>(row_group_writer->NextColumn())
+      ->WriteBatch(kNumRows, nullptr, nullptr, ba_values.data());
+  {
+    std::vector<uint8_t> bool_buffer(bool_values.begin(), bool_values.end());
+    static_cast<BoolWriter*>(row_group_writer->NextColumn())
+        ->WriteBatch(kNumRows, nullptr, nullptr,
+                     reinterpret_cast<bool*>(bool_buffer.data()));
+  }
+  row_group_writer->Close();
+  file_writer->Close();
+
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto& bloom_filter_reader = file_reader->GetBloomFilterReader();
+  auto row_group_0 = bloom_filter_reader.RowGroup(0);
+  ASSERT_NE(nullptr, row_group_0);
+
+  auto i64_filter = row_group_0->GetColumnBloomFilter(0);
+  ASSERT_NE(nullptr, i64_filter);
+  for (int64_t value = 0; value < 16; ++value) {
+    EXPECT_TRUE(i64_filter->FindHash(i64_filter->Hash(value)));
+  }
+  int false_positives = 0;
+  for (int64_t value = 16; value < 116; ++value) {
+    false_positives += i64_filter->FindHash(i64_filter->Hash(value)) ? 1 : 0;
+  }
+  // The default false positive probability is 1%; 100 probes should not
+  // all pass.
+  EXPECT_LT(false_positives, 10);
+
+  auto ba_filter = row_group_0->GetColumnBloomFilter(1);
+  ASSERT_NE(nullptr, ba_filter);
+  for (int i = 0; i < 32; ++i) {
+    EXPECT_TRUE(ba_filter->FindHash(ba_filter->Hash(&ba_values[i])));
+  }
+  {
+    std::string_view sv = "NOT_EXISTS";
+    ByteArray ba{sv};
+    EXPECT_FALSE(ba_filter->FindHash(ba_filter->Hash(&ba)));
+  }
+
+  // Boolean columns never produce a bloom filter.
+  EXPECT_EQ(nullptr, row_group_0->GetColumnBloomFilter(2));
+}
+
+TEST(BloomFilterBuilder, PerColumnEnable) {
+  // Bloom filters can be enabled for a subset of the columns.
+  schema::NodeVector fields;
+  fields.push_back(schema::PrimitiveNode::Make("c0", Repetition::REQUIRED,
+                                               Type::INT64, ConvertedType::NONE));
+  fields.push_back(schema::PrimitiveNode::Make("c1", Repetition::REQUIRED,
+                                               Type::INT64, ConvertedType::NONE));
+  auto schema = std::static_pointer_cast<schema::GroupNode>(
+      schema::GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+  auto properties = WriterProperties::Builder().enable_bloom_filter("c1")->build();
+
+  std::vector<int64_t> values(100);
+  std::iota(values.begin(), values.end(), 0);
+
+  auto sink = CreateOutputStream();
+  auto file_writer = ParquetFileWriter::Open(sink, schema, properties);
+  auto row_group_writer = file_writer->AppendRowGroup();
+  for (int col = 0; col < 2; ++col) {
+    static_cast<Int64Writer*>(row_group_writer->NextColumn())
+        ->WriteBatch(static_cast<int64_t>(values.size()), nullptr, nullptr,
+                     values.data());
+  }
+  row_group_writer->Close();
+  file_writer->Close();
+
+  PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+  auto file_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+  auto row_group_0 = file_reader->GetBloomFilterReader().RowGroup(0);
+  EXPECT_EQ(nullptr, row_group_0->GetColumnBloomFilter(0));
+  EXPECT_NE(nullptr, row_group_0->GetColumnBloomFilter(1));
+}
+
+TEST(BloomFilterBuilder, InvalidFalsePositiveProbability) {
+  WriterProperties::Builder builder;
+  EXPECT_THROW(builder.bloom_filter_fpp(0.0), ParquetException);
+  EXPECT_THROW(builder.bloom_filter_fpp(1.5), ParquetException);
+}
+
 }  // namespace parquet::test
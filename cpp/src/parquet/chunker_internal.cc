@@ -0,0 +1,137 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "parquet/chunker_internal.h"
+
+#include <algorithm>
+#include <string>
+
+#include "arrow/util/bit_util.h"
+#include "parquet/exception.h"
+
+namespace parquet::internal {
+
+namespace {
+
+// Random 64-bit constants indexed by byte value, mixed into the rolling hash
+// one input byte at a time (the "gear" construction). The table is fixed so
+// that cut points are reproducible across processes and versions.
+constexpr uint64_t kGearTable[256] = {
+    0xf6f4ad5fd9fb95fcULL, 0x200d57194eec8a41ULL, 0xa5c833557fc958c3ULL, 0xe2a1e6090af0aadfULL,
+    0x727990b3663dc20fULL, 0x5a1a40cb2336d886ULL, 0x888b4ba22c894455ULL, 0x14d6334e36d1cf23ULL,
+    0xd8df6e56f0b3cbccULL, 0xc0f3942408b9c248ULL, 0xb2fcb1b572c5041cULL, 0xfd75332d6090925fULL,
+    0x28850e5796681805ULL, 0xaf8fb86cfaf123ccULL, 0xe724268816fb989fULL, 0x92f9ea2639fe2e8bULL,
+    0x412c43ec9f9fd3f9ULL, 0x72dc66e139ee5dddULL, 0x2c415f0d438b12e9ULL, 0x03ec9219818965c0ULL,
+    0xdfdc1de62315f438ULL, 0xec37412c4bfd3e1eULL, 0x8d243f01e403cc95ULL, 0x674a61a4b4fe2500ULL,
+    0x412aa7e4cc6f5b75ULL, 0x3f30ceb11a162b3dULL, 0x3ae694e19c8c8410ULL, 0xfe234ea1ebba627fULL,
+    0x3240599a5ecac046ULL, 0xda9754b50227bf1fULL, 0xe5d71bb02d66b1c0ULL, 0x8623e425f7f1a832ULL,
+    0xbd1e9b48601856e7ULL, 0x81eaf041af83a7beULL, 0x5fed9270b2102d02ULL, 0x6e4cde27832e4e05ULL,
+    0x27e4372b8b9eefccULL, 0xea45e78a217f7a4dULL, 0x233e0d19d6baffd4ULL, 0xb3ee063f90afde91ULL,
+    0x6114c8179a0e6465ULL, 0xf4852349640b0365ULL, 0x1d605e2ff1ae4f18ULL, 0xc7ed389240655138ULL,
+    0xbfd0a21ba5bff6c1ULL, 0xac095fc68caf7ce0ULL, 0xd4ed7d10fc6ffbe2ULL, 0xb1fde8c33f3fc0e6ULL,
+    0xe6478a110b5fd805ULL, 0x88243953b6f4ff2eULL, 0x9af713bc6158645aULL, 0x3ee89d5181aed867ULL,
+    0xd028b5e782fb5141ULL, 0xebe9724a464caf14ULL, 0xfd4a4d34dc9e55a7ULL, 0xc5d23a15e6257a55ULL,
+    0xa92bb2eb8fd807dcULL, 0x9f3f5c1e5855c8c9ULL, 0xd7d6333cf368156cULL, 0x98180133e1249a44ULL,
+    0x75c55d81e62362aaULL, 0x9ad30af1a57bdcebULL, 0x056dccbe2e0c4cb6ULL, 0x0856d6fa61af5aecULL,
+    0xf0f3ca130fdf5b50ULL, 0x855fc69e0eaf74e6ULL, 0xb8438960674f4f7eULL, 0xcaaa9e890d8e0d0aULL,
+    0x95beb03d49c50211ULL, 0xa2b7237d6e764b15ULL, 0x18fabe5275187893ULL, 0x3aa7b697557a5992ULL,
+    0x0cf75b55ff4d6215ULL, 0x577e767d5e3baab9ULL, 0x091dec304a02e339ULL, 0x4c5295282b100715ULL,
+    0x945efbfa0b80e5c7ULL, 0x5927776bb9ce5106ULL, 0x1e8a278189572761ULL, 0xb7b15123f8ed5073ULL,
+    0xc4321a80fd5cdd68ULL, 0x0df998526f87a9aeULL, 0xc69f6ac43329dce5ULL, 0xb08a3b87036dd08bULL,
+    0x736e78a8aca443bbULL, 0x59a5521445edefa7ULL, 0xa378993a3adbab8bULL, 0xbcb098c70c998a65ULL,
+    0x483ecd2c1c2b8b5dULL, 0xbcd548586b376b66ULL, 0x613bf4cae2e587f0ULL, 0x03ca936882716085ULL,
+    0xf5fd9fd5d0c9035dULL, 0xf2bf755a298f7c34ULL, 0x87a38727980013ffULL, 0xc774e8d4ac90bce6ULL,
+    0x8768b51accc6cb12ULL, 0x4355990915be6721ULL, 0x47de7d9d167f9c5aULL, 0x7bf2b54d84009c51ULL,
+    0x84527460fa198e5dULL, 0xe60d6666d4354655ULL, 0xd9e786f522aba6d6ULL, 0x3b2d9ac446c6f834ULL,
+    0xb5306f0fc5880704ULL, 0xf34f0c15f46eedbfULL, 0x664449a39b6ea1f4ULL, 0x1efeb27548ae7e65ULL,
+    0x44bb10ca537d170eULL, 0x2eaa1c9058da9c74ULL, 0x86753044d851ef40ULL, 0x63d368b8cca60d82ULL,
+    0xa75bb7c2920ffc59ULL, 0xe0b6db6e68e4c9eeULL, 0xed0da1ded50ea5acULL, 0x083a561746e1501fULL,
+    0x69e1645a5026be3bULL, 0x8f52410c90c954ecULL, 0x4b39603a5ab1740bULL, 0x3b1c4d0f0398b03eULL,
+    0xc41fd758f79ecfe5ULL, 0x57d7c77bc6dcd172ULL, 0xb2cca3c27e23ca2dULL, 0xe53b1b4da0219190ULL,
+    0x75d0790f837ae99bULL, 0x59583b08898468b1ULL, 0x41793efe09c8ad89ULL, 0x65b69e65a2f88f75ULL,
+    0xdf095663b4617e1aULL, 0x47b828717e92f8fdULL, 0xd442b8fbed26ab4bULL, 0xad87e414d6d85d25ULL,
+    0x635f34f056ac241fULL, 0xbab0da5be3b9819bULL, 0x505ccea4488730ffULL, 0x5f93ec2b45a8f2e1ULL,
+    0x633b31d26075662eULL, 0x2586e8a795532210ULL, 0x1ae1c27c0eb7844dULL, 0x866fc401252505f9ULL,
+    0x8be47d40d9780fa5ULL, 0x13f51474a0c863c2ULL, 0x6f84a59259b5975dULL, 0xfdbc468a32bee7acULL,
+    0x0767a794f393b411ULL, 0xd8f2b3e3e4b4dab8ULL, 0x7a718fb608e05178ULL, 0x061ed8c04913e904ULL,
+    0xc06973292bf90f9cULL, 0x86d99b803532e2ecULL, 0x73038486e3cda94aULL, 0x028e7455c8758234ULL,
+    0x80c1eac850986e6bULL, 0x83d93658ce51b9c4ULL, 0x260898daab0face2ULL, 0x2a601d86ac919ac8ULL,
+    0x35e45c50878179c5ULL, 0x593619308b871dc1ULL, 0x72a164941cf97388ULL, 0xde4f5802e4fb77d2ULL,
+    0x81f30dd331b6721cULL, 0xd8584ae67bf6bb7dULL, 0x042bdbf23f49a329ULL, 0x50873fe374b383a2ULL,
+    0xd5c40cda08f18c9cULL, 0x8be8bc470990bf22ULL, 0x3d798e3999b4c604ULL, 0x94d2167bf0f5dda4ULL,
+    0x5dbe4755161ffedfULL, 0xc9aab350c3219cb3ULL, 0xe87bcc0ab18b86d4ULL, 0x1dfd66e666708aadULL,
+    0xcba36a92dbc5fa9aULL, 0x6cafa00da70f907bULL, 0x0e1d87f51361f641ULL, 0x97ae79a0815ecc5aULL,
+    0xa931248e6c54744aULL, 0xfa6d348bf88e6857ULL, 0x0df5c0216c8a2a30ULL, 0xbb6a8576a069d82cULL,
+    0x7ff124026c7e8630ULL, 0x9e5cba12b602f874ULL, 0x35e3c114c8197373ULL, 0x99c61ae2dc282f0eULL,
+    0x8088eca0d23e3981ULL, 0x7046ffc880da2258ULL, 0x228c0bca6ce8ecddULL, 0xe6843e8f64c55be9ULL,
+    0xef83101f57808432ULL, 0x5e08b5e18619487eULL, 0x796a8cff9cafb78eULL, 0x8d53c9c98866f2d7ULL,
+    0xa905ba3222e6589cULL, 0x08d608c07fc099b2ULL, 0x1bf8eeef42339800ULL, 0xa33eb55077c8157cULL,
+    0x2e5fccc87c68275bULL, 0x6571747839901449ULL, 0x0443fdc72523be61ULL, 0x540f33b6638c5989ULL,
+    0x0d0787b0efbc950bULL, 0xd27cb1ce8e6304abULL, 0xb3399bc5608b77d3ULL, 0x720924911570e835ULL,
+    0x992be813344a410cULL, 0x6e7a198167154ee3ULL, 0x5ba32ce266c66a27ULL, 0x3499baaa41662b6aULL,
+    0x40081e01da3712bfULL, 0xfe3094ddf687a527ULL, 0xf5b0b190abed6a72ULL, 0x59a0fd3d83dfe6c5ULL,
+    0x7d347467cfb9d8d0ULL, 0xcdc02372270cb528ULL, 0xc05e3670fbff4091ULL, 0xe00aa76ab4b5f6bdULL,
+    0xa9ba341298ea47d1ULL, 0x0dfd758576982ad2ULL, 0xa34a8d240bb9935aULL, 0x034beb533dcd352aULL,
+    0xb1fb5fcc0153f98eULL, 0xa13e3d4ef8db94caULL, 0x10a2c6b864a71c14ULL, 0xf1b87232d07f5d01ULL,
+    0xff42eb8819b4f40cULL, 0xdc902a205184639cULL, 0x05b355226bc7804cULL, 0xa33fe24607d49cb8ULL,
+    0x39e93b6c95a1ce47ULL, 0x3beb2179b777584aULL, 0xd9f8f88941d5b237ULL, 0xbd6611352ff23647ULL,
+    0x5dfaeac822462d75ULL, 0x59ae15aeaa669929ULL, 0x6e93975e7235f1e3ULL, 0x263084f5b570e62fULL,
+    0x4ef3537e9a10371fULL, 0xc776e4afcd3ca91eULL, 0x7cdba634d77878b2ULL, 0xed2b8ff281852f6bULL,
+    0xdc00e5995199f35cULL, 0x96f595177faee6fbULL, 0xcd26b2b575ec159cULL, 0xa6a3c1b8377b2070ULL,
+    0x22f2e41b0b9f95c4ULL, 0xb1bfa9dbbfa31c9cULL, 0x33429b15e80ee75fULL, 0x212cabfd4d2d7cd2ULL,
+    0xc3ebe3dea1d70ea3ULL, 0xdc575f07ffabc768ULL, 0xf496b4f401f13b33ULL, 0x456fb4b8f638aa2fULL,
+    0x33fe13b255309665ULL, 0xf4baad78a713bbceULL, 0xc5e0bb2a7cdfc75cULL, 0x4279118980b1598cULL
+};
+
+uint64_t ComputeHashMask(int64_t min_chunk_size, int64_t max_chunk_size) {
+  if (min_chunk_size < 0 || max_chunk_size <= min_chunk_size) {
+    throw ParquetException("Invalid content-defined chunk size range: [" +
+                           std::to_string(min_chunk_size) + ", " +
+                           std::to_string(max_chunk_size) + "]");
+  }
+  // Aim for an average chunk size halfway between the bounds. With the cut
+  // predicate only evaluated past min_chunk_size, a mask of log2(average)
+  // bits yields chunks of roughly that size on random input.
+  const auto average = static_cast<uint64_t>(
+      std::max<int64_t>(1, min_chunk_size + (max_chunk_size - min_chunk_size) / 2));
+  return (uint64_t{1} << ::arrow::bit_util::Log2(average)) - 1;
+}
+
+}  // namespace
+
+ContentDefinedChunker::ContentDefinedChunker(int64_t min_chunk_size,
+                                             int64_t max_chunk_size)
+    : min_chunk_size_(min_chunk_size),
+      max_chunk_size_(max_chunk_size),
+      hash_mask_(ComputeHashMask(min_chunk_size, max_chunk_size)) {}
+
+bool ContentDefinedChunker::Roll(const uint8_t* data, int64_t size) {
+  bool has_cut = false;
+  for (int64_t i = 0; i < size; ++i) {
+    rolling_hash_ = (rolling_hash_ << 1) + kGearTable[data[i]];
+    ++chunk_size_;
+    if (chunk_size_ >= max_chunk_size_ ||
+        (chunk_size_ >= min_chunk_size_ && (rolling_hash_ & hash_mask_) == 0)) {
+      has_cut = true;
+      chunk_size_ = 0;
+      rolling_hash_ = 0;
+    }
+  }
+  return has_cut;
+}
+
+}  // namespace parquet::internal
@@ -0,0 +1,69 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "parquet/platform.h"
+
+namespace parquet::internal {
+
+/// \brief Incremental content-defined chunking over a column's value stream.
+///
+/// The chunker maintains a gear rolling hash over the raw bytes of the values
+/// written to a column chunk. A cut point is declared whenever the low bits of
+/// the hash are all zero, subject to the configured minimum and maximum chunk
+/// sizes. Since the gear hash only depends on the last 64 bytes seen, cut
+/// points are a pure function of local value content: editing a few rows only
+/// moves the cut points overlapping the edit, and the following ones fall back
+/// into place. Writers can use this to keep data page boundaries stable across
+/// small row edits, which makes the resulting files deduplicate well in
+/// content-addressed storage.
+class PARQUET_EXPORT ContentDefinedChunker {
+ public:
+  /// \param min_chunk_size minimum chunk size in bytes; cut points closer than
+  ///   this to the previous one are suppressed. Must be non-negative.
+  /// \param max_chunk_size maximum chunk size in bytes; a cut point is forced
+  ///   once this many bytes have accumulated. Must be greater than
+  ///   `min_chunk_size`.
+  ///
+  /// Throws ParquetException on invalid chunk size bounds.
+  ContentDefinedChunker(int64_t min_chunk_size, int64_t max_chunk_size);
+
+  /// \brief Feed value bytes to the rolling hash.
+  ///
+  /// Returns true if one or more cut points were crossed, in which case the
+  /// caller is expected to close the current data page at the next record
+  /// boundary. The hash keeps rolling across calls, so the granularity of the
+  /// caller's batches does not affect where the cut points fall.
+  bool Roll(const uint8_t* data, int64_t size);
+
+  /// \brief Number of bytes fed since the last cut point.
+  int64_t bytes_since_last_cut() const { return chunk_size_; }
+
+ private:
+  const int64_t min_chunk_size_;
+  const int64_t max_chunk_size_;
+  // A cut point is declared when (rolling_hash_ & hash_mask_) == 0; the number
+  // of bits in the mask is derived from the target average chunk size.
+  const uint64_t hash_mask_;
+  uint64_t rolling_hash_ = 0;
+  int64_t chunk_size_ = 0;
+};
+
+}  // namespace parquet::internal
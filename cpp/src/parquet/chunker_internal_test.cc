@@ -0,0 +1,131 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "parquet/chunker_internal.h"
+#include "parquet/exception.h"
+
+namespace parquet::internal {
+
+namespace {
+
+std::vector<uint8_t> RandomBytes(int64_t size, uint32_t seed) {
+  std::default_random_engine gen(seed);
+  std::uniform_int_distribution<int> dist(0, 255);
+  std::vector<uint8_t> bytes(size);
+  for (auto& byte : bytes) {
+    byte = static_cast<uint8_t>(dist(gen));
+  }
+  return bytes;
+}
+
+// Return the one-past-the-end byte offsets of the cut points the chunker
+// finds in `data` when fed in batches of `batch_size` bytes.
+std::vector<int64_t> CutOffsets(ContentDefinedChunker* chunker,
+                                const std::vector<uint8_t>& data, int64_t batch_size) {
+  std::vector<int64_t> offsets;
+  const auto size = static_cast<int64_t>(data.size());
+  for (int64_t offset = 0; offset < size; offset += batch_size) {
+    const int64_t length = std::min(batch_size, size - offset);
+    if (chunker->Roll(data.data() + offset, length)) {
+      offsets.push_back(offset + length - chunker->bytes_since_last_cut());
+    }
+  }
+  return offsets;
+}
+
+}  // namespace
+
+TEST(ContentDefinedChunker, InvalidChunkSizeRange) {
+  EXPECT_THROW(ContentDefinedChunker(-1, 1024), ParquetException);
+  EXPECT_THROW(ContentDefinedChunker(1024, 1024), ParquetException);
+  EXPECT_THROW(ContentDefinedChunker(1024, 512), ParquetException);
+}
+
+TEST(ContentDefinedChunker, ChunkSizeBounds) {
+  constexpr int64_t kMinChunkSize = 512;
+  constexpr int64_t kMaxChunkSize = 2048;
+  ContentDefinedChunker chunker(kMinChunkSize, kMaxChunkSize);
+  const auto data = RandomBytes(/*size=*/1 << 20, /*seed=*/42);
+
+  const auto offsets = CutOffsets(&chunker, data, /*batch_size=*/1);
+  ASSERT_GT(offsets.size(), 1);
+  int64_t previous = 0;
+  for (int64_t offset : offsets) {
+    const int64_t chunk_size = offset - previous;
+    EXPECT_GE(chunk_size, kMinChunkSize);
+    EXPECT_LE(chunk_size, kMaxChunkSize);
+    previous = offset;
+  }
+}
+
+TEST(ContentDefinedChunker, CutPointsIndependentOfBatchSize) {
+  const auto data = RandomBytes(/*size=*/1 << 18, /*seed=*/43);
+  ContentDefinedChunker byte_at_a_time(512, 2048);
+  const auto expected = CutOffsets(&byte_at_a_time, data, /*batch_size=*/1);
+
+  for (int64_t batch_size : {7, 64, 4096}) {
+    ContentDefinedChunker chunker(512, 2048);
+    std::vector<int64_t> cut_counts;
+    int64_t num_cuts = 0;
+    for (int64_t offset = 0; offset < static_cast<int64_t>(data.size());
+         offset += batch_size) {
+      const int64_t length =
+          std::min(batch_size, static_cast<int64_t>(data.size()) - offset);
+      if (chunker.Roll(data.data() + offset, length)) {
+        ++num_cuts;
+      }
+    }
+    // Batching can merge several cut points into one Roll() call, but the
+    // rolling hash is unaffected: the last cut must fall at the same offset.
+    ASSERT_GT(num_cuts, 0);
+    ASSERT_LE(num_cuts, static_cast<int64_t>(expected.size()));
+    EXPECT_EQ(chunker.bytes_since_last_cut(),
+              static_cast<int64_t>(data.size()) - expected.back());
+  }
+}
+
+TEST(ContentDefinedChunker, CutPointsResynchronizeAfterEdit) {
+  // Prepending bytes shifts every absolute offset, but once the rolling hash
+  // has seen enough unmodified input the cut points realign with the
+  // unedited stream.
+  const auto data = RandomBytes(/*size=*/1 << 18, /*seed=*/44);
+  std::vector<uint8_t> edited = RandomBytes(/*size=*/100, /*seed=*/45);
+  edited.insert(edited.end(), data.begin(), data.end());
+
+  ContentDefinedChunker base_chunker(512, 2048);
+  ContentDefinedChunker edited_chunker(512, 2048);
+  const auto base_offsets = CutOffsets(&base_chunker, data, /*batch_size=*/1);
+  auto edited_offsets = CutOffsets(&edited_chunker, edited, /*batch_size=*/1);
+  for (auto& offset : edited_offsets) {
+    offset -= 100;  // shift back into the coordinates of `data`
+  }
+
+  // All but the first few cut points must be identical.
+  ASSERT_GE(base_offsets.size(), 4);
+  ASSERT_GE(edited_offsets.size(), 4);
+  std::vector<int64_t> base_tail(base_offsets.end() - 4, base_offsets.end());
+  std::vector<int64_t> edited_tail(edited_offsets.end() - 4, edited_offsets.end());
+  EXPECT_EQ(base_tail, edited_tail);
+}
+
+}  // namespace parquet::internal
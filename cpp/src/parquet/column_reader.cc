@@ -18,12 +18,16 @@
 #include "parquet/column_reader.h"
 
 #include <algorithm>
+#include <condition_variable>
 #include <cstdint>
 #include <cstring>
+#include <deque>
 #include <exception>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
@@ -272,6 +276,23 @@ class SerializedPageReader : public PageReader {
 
   void set_max_page_header_size(uint32_t size) override { max_page_header_size_ = size; }
 
+  // Allocate fresh decryption and decompression buffers for every page instead
+  // of reusing them, so that returned pages stay valid across calls to
+  // NextPage(). Required when pages are produced ahead of their consumer.
+  void set_reuse_buffers(bool reuse_buffers) { reuse_buffers_ = reuse_buffers; }
+
+  bool page_buffers_stable() const override {
+    if (properties_.is_buffered_stream_enabled()) {
+      // Raw page reads may alias the buffered stream's internal buffer.
+      return false;
+    }
+    // Pages served straight from the stream are file slices or fresh
+    // allocations; decompressed or decrypted pages are only stable when the
+    // scratch buffers are not reused.
+    const bool transformed = decompressor_ != nullptr || data_decryptor_ != nullptr;
+    return !transformed || !reuse_buffers_;
+  }
+
  private:
   void UpdateDecryption(Decryptor* decryptor, int8_t module_type, std::string* page_aad);
 
@@ -296,6 +317,7 @@ class SerializedPageReader : public PageReader {
   std::shared_ptr<ResizableBuffer> decompression_buffer_;
 
   bool always_compressed_;
+  bool reuse_buffers_ = true;
 
   // The fields below are used for calculation of AAD (additional authenticated data)
   // suffix which is part of the Parquet Modular Encryption.
@@ -502,6 +524,9 @@ std::shared_ptr<Page> SerializedPageReader::NextPage() {
 
     // Decrypt it if we need to
     if (data_decryptor_ != nullptr) {
+      if (!reuse_buffers_) {
+        decryption_buffer_ = AllocateBuffer(properties_.memory_pool(), 0);
+      }
       PARQUET_THROW_NOT_OK(
           decryption_buffer_->Resize(data_decryptor_->PlaintextLength(compressed_len),
                                      /*shrink_to_fit=*/false));
@@ -581,6 +606,9 @@ std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
   }
 
   // Grow the uncompressed buffer if we need to.
+  if (!reuse_buffers_) {
+    decompression_buffer_ = AllocateBuffer(properties_.memory_pool(), 0);
+  }
   PARQUET_THROW_NOT_OK(
       decompression_buffer_->Resize(uncompressed_len, /*shrink_to_fit=*/false));
 
@@ -614,6 +642,101 @@ std::shared_ptr<Buffer> SerializedPageReader::DecompressIfNeeded(
   return decompression_buffer_;
 }
 
+// ----------------------------------------------------------------------
+// PipelinedPageReader runs a wrapped SerializedPageReader on a dedicated
+// thread, reading and decompressing up to `depth` pages ahead of the consumer
+// on a bounded queue. This overlaps page I/O and decompression with decoding
+// of the previous pages.
+
+class PipelinedPageReader : public PageReader {
+ public:
+  PipelinedPageReader(std::unique_ptr<SerializedPageReader> inner, int32_t depth)
+      : inner_(std::move(inner)), depth_(std::max<size_t>(1, depth)) {
+    // Pages outlive the producer's next call to NextPage()
+    inner_->set_reuse_buffers(false);
+  }
+
+  ~PipelinedPageReader() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      shutdown_ = true;
+    }
+    producer_cv_.notify_all();
+    if (producer_.joinable()) {
+      producer_.join();
+    }
+  }
+
+  std::shared_ptr<Page> NextPage() override {
+    if (!started_) {
+      // The data page filter must be in place before the first page is read;
+      // it is hereafter owned by the producer thread.
+      inner_->set_data_page_filter(std::move(data_page_filter_));
+      started_ = true;
+      producer_ = std::thread([this]() { ProducerLoop(); });
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    consumer_cv_.wait(lock, [this]() { return !queue_.empty() || finished_; });
+    if (queue_.empty()) {
+      if (error_ != nullptr) {
+        std::rethrow_exception(error_);
+      }
+      return nullptr;
+    }
+    std::shared_ptr<Page> page = std::move(queue_.front());
+    queue_.pop_front();
+    lock.unlock();
+    producer_cv_.notify_one();
+    return page;
+  }
+
+  void set_max_page_header_size(uint32_t size) override {
+    inner_->set_max_page_header_size(size);
+  }
+
+ private:
+  void ProducerLoop() {
+    while (true) {
+      std::shared_ptr<Page> page;
+      try {
+        page = inner_->NextPage();
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        error_ = std::current_exception();
+        finished_ = true;
+        consumer_cv_.notify_all();
+        return;
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (page == nullptr) {
+        finished_ = true;
+        consumer_cv_.notify_all();
+        return;
+      }
+      producer_cv_.wait(lock, [this]() { return queue_.size() < depth_ || shutdown_; });
+      if (shutdown_) {
+        return;
+      }
+      queue_.push_back(std::move(page));
+      consumer_cv_.notify_one();
+    }
+  }
+
+  std::unique_ptr<SerializedPageReader> inner_;
+  const size_t depth_;
+
+  bool started_ = false;
+  std::thread producer_;
+
+  std::mutex mutex_;
+  std::condition_variable consumer_cv_;
+  std::condition_variable producer_cv_;
+  std::deque<std::shared_ptr<Page>> queue_;
+  bool finished_ = false;
+  bool shutdown_ = false;
+  std::exception_ptr error_;
+};
+
 }  // namespace
 
 std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> stream,
@@ -622,8 +745,13 @@ std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> s
                                              const ReaderProperties& properties,
                                              bool always_compressed,
                                              const CryptoContext* ctx) {
-  return std::unique_ptr<PageReader>(new SerializedPageReader(
-      std::move(stream), total_num_values, codec, properties, ctx, always_compressed));
+  auto serialized_reader = std::make_unique<SerializedPageReader>(
+      std::move(stream), total_num_values, codec, properties, ctx, always_compressed);
+  if (properties.page_prefetch_depth() > 0) {
+    return std::make_unique<PipelinedPageReader>(std::move(serialized_reader),
+                                                 properties.page_prefetch_depth());
+  }
+  return serialized_reader;
 }
 
 std::unique_ptr<PageReader> PageReader::Open(std::shared_ptr<ArrowInputStream> stream,
@@ -1824,10 +1952,105 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
   // values_to_read.
   int64_t ReadRequiredRecords(int64_t num_records, int64_t* values_to_read) {
     *values_to_read = num_records;
+    if (ARROW_PREDICT_FALSE(zero_copy_values_enabled_)) {
+      if (TryReadValuesZeroCopy(*values_to_read)) {
+        return num_records;
+      }
+      // A slice taken by an earlier read in this batch must be copied into
+      // 'values_' before appending to it.
+      MaterializeZeroCopyValues();
+    }
     ReadValuesDense(*values_to_read);
     return num_records;
   }
 
+  // Start of the encoded values within the current data page, or null if it
+  // cannot be determined. Only meaningful for flat required columns, where V1
+  // pages carry no level bytes before the values.
+  const uint8_t* PageValuesStart() const {
+    const Page* page = this->current_page_.get();
+    if (page == nullptr) {
+      return nullptr;
+    }
+    if (page->type() == PageType::DATA_PAGE) {
+      return static_cast<const DataPageV1*>(page)->data();
+    }
+    if (page->type() == PageType::DATA_PAGE_V2) {
+      // ARROW-17453: level bytes may be present even with zero max levels.
+      const auto* v2 = static_cast<const DataPageV2*>(page);
+      return v2->data() + v2->repetition_levels_byte_length() +
+             v2->definition_levels_byte_length();
+    }
+    return nullptr;
+  }
+
+  // Try to serve a dense read of a flat required column as a zero-copy slice
+  // of the current page buffer. Only possible for PLAIN-encoded fixed-width
+  // values when the page reader guarantees stable page buffers, no values are
+  // buffered yet, the whole read is contained in the current page, and the
+  // values are naturally aligned for their type.
+  bool TryReadValuesZeroCopy(int64_t values_to_read) {
+    if (!uses_values_ || values_written_ != 0 || zero_copy_values_ != nullptr) {
+      return false;
+    }
+    switch (this->descr_->physical_type()) {
+      case Type::INT32:
+      case Type::INT64:
+      case Type::FLOAT:
+      case Type::DOUBLE:
+        break;
+      default:
+        return false;
+    }
+    if (this->current_encoding_ != Encoding::PLAIN ||
+        values_to_read > this->available_values_current_page()) {
+      return false;
+    }
+    if (this->pager_ == nullptr || !this->pager_->page_buffers_stable()) {
+      return false;
+    }
+    const uint8_t* values_start = PageValuesStart();
+    if (values_start == nullptr) {
+      return false;
+    }
+    std::shared_ptr<Buffer> page_buffer = this->current_page_->buffer();
+    const int64_t type_size = GetTypeByteSize(this->descr_->physical_type());
+    const int64_t byte_offset = (values_start - page_buffer->data()) +
+                                this->num_decoded_values_ * type_size;
+    const int64_t byte_length = values_to_read * type_size;
+    if (byte_offset + byte_length > page_buffer->size()) {
+      // Malformed page; let the decoder raise the error.
+      return false;
+    }
+    if (reinterpret_cast<uintptr_t>(page_buffer->data() + byte_offset) % type_size != 0) {
+      return false;
+    }
+    // Advance the decoder past the referenced values before slicing.
+    this->current_decoder_->SetData(
+        static_cast<int>(this->available_values_current_page() - values_to_read),
+        page_buffer->data() + byte_offset + byte_length,
+        static_cast<int>(page_buffer->size() - byte_offset - byte_length));
+    zero_copy_values_ = SliceBuffer(std::move(page_buffer), byte_offset, byte_length);
+    return true;
+  }
+
+  // Copy a previously taken zero-copy slice into the head of 'values_' so
+  // that subsequent dense reads can append to it. 'values_' capacity has
+  // already been reserved for the values the slice accounts for.
+  void MaterializeZeroCopyValues() {
+    if (zero_copy_values_ == nullptr) {
+      return;
+    }
+    ARROW_DCHECK_EQ(zero_copy_values_->size(), bytes_for_values(values_written_));
+    memcpy(values_->mutable_data(), zero_copy_values_->data(),
+           static_cast<size_t>(zero_copy_values_->size()));
+    zero_copy_values_.reset();
+  }
+
+  std::shared_ptr<Buffer> ReleaseZeroCopyValues() override {
+    return std::move(zero_copy_values_);
+  }
+
   // Reads dense for optional records. First it figures out how many values to
   // read.
   void ReadDenseForOptional(int64_t start_levels_position, int64_t* values_to_read) {
@@ -1955,6 +2178,7 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
       values_written_ = 0;
       values_capacity_ = 0;
       null_count_ = 0;
+      zero_copy_values_.reset();
     }
   }
 
@@ -1964,6 +2188,10 @@ class TypedRecordReader : public TypedColumnReaderImpl<DType>,
     return values_->mutable_data_as<T>() + values_written_;
   }
   LevelInfo leaf_info_;
+
+  // Values served directly from a page buffer when the zero-copy path was
+  // taken; see TryReadValuesZeroCopy().
+  std::shared_ptr<Buffer> zero_copy_values_;
 };
 
 /// In FLBARecordReader, we read fixed length byte array values.
@@ -2142,12 +2370,21 @@ class ByteArrayDictionaryRecordReader final : public TypedRecordReader<ByteArray
 
   void MaybeWriteNewDictionary() {
     if (this->new_dictionary_) {
+      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      if (DictionaryUnchanged(decoder)) {
+        /// The new dictionary is byte-identical to the previous one (common
+        /// when row groups share the same categorical values). Indices keep
+        /// their meaning against the builder's memo table, so keep appending
+        /// to the current chunk instead of flushing and re-unifying.
+        this->new_dictionary_ = false;
+        return;
+      }
       /// If there is a new dictionary, we may need to flush the builder, then
       /// insert the new dictionary values
       FlushBuilder();
       builder_.ResetFull();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
       decoder->InsertDictionary(&builder_);
+      RememberDictionary(decoder);
       this->new_dictionary_ = false;
     }
   }
@@ -2188,8 +2425,48 @@ class ByteArrayDictionaryRecordReader final : public TypedRecordReader<ByteArray
  private:
   using BinaryDictDecoder = DictDecoder<ByteArrayType>;
 
+  bool DictionaryUnchanged(BinaryDictDecoder* decoder) {
+    if (!have_dictionary_) {
+      return false;
+    }
+    const ByteArray* dictionary;
+    int32_t dictionary_length;
+    decoder->GetDictionary(&dictionary, &dictionary_length);
+    if (dictionary_length != static_cast<int32_t>(dictionary_lengths_.size())) {
+      return false;
+    }
+    const char* values = dictionary_values_.data();
+    for (int32_t i = 0; i < dictionary_length; ++i) {
+      if (dictionary[i].len != dictionary_lengths_[i] ||
+          memcmp(values, dictionary[i].ptr, dictionary[i].len) != 0) {
+        return false;
+      }
+      values += dictionary[i].len;
+    }
+    return true;
+  }
+
+  // Copy the decoder's dictionary (its storage does not survive advancing to
+  // the next row group) so the next one can be compared against it.
+  void RememberDictionary(BinaryDictDecoder* decoder) {
+    const ByteArray* dictionary;
+    int32_t dictionary_length;
+    decoder->GetDictionary(&dictionary, &dictionary_length);
+    dictionary_lengths_.clear();
+    dictionary_values_.clear();
+    for (int32_t i = 0; i < dictionary_length; ++i) {
+      dictionary_lengths_.push_back(dictionary[i].len);
+      dictionary_values_.append(reinterpret_cast<const char*>(dictionary[i].ptr),
+                                dictionary[i].len);
+    }
+    have_dictionary_ = true;
+  }
+
   ::arrow::BinaryDictionary32Builder builder_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
+  bool have_dictionary_ = false;
+  std::vector<uint32_t> dictionary_lengths_;
+  std::string dictionary_values_;
 };
 
 // TODO(wesm): Implement these to some satisfaction
@@ -150,6 +150,13 @@ class PARQUET_EXPORT PageReader {
 
   virtual void set_max_page_header_size(uint32_t size) = 0;
 
+  // Whether the buffers of pages returned by NextPage() remain valid across
+  // subsequent calls to NextPage(), i.e. they are file slices or dedicated
+  // allocations rather than reused scratch buffers. Consumers may only keep
+  // references into page buffers when this returns true.
+  // \note API EXPERIMENTAL
+  virtual bool page_buffers_stable() const { return false; }
+
  protected:
   // Callback that decides if we should skip a page or not.
   DataPageFilter data_page_filter_;
@@ -373,6 +380,24 @@ class PARQUET_EXPORT RecordReader {
   /// \brief True if reading dense for nullable columns.
   bool read_dense_for_nullable() const { return read_dense_for_nullable_; }
 
+  /// \brief EXPERIMENTAL: Enable returning values as zero-copy slices of page
+  /// buffers where possible.
+  ///
+  /// Only engages for flat required columns of fixed-width physical type when
+  /// the data is PLAIN-encoded, the page reader reports stable page buffers
+  /// (see PageReader::page_buffers_stable()), and a read is fully contained in
+  /// the current page. Callers enabling this must retrieve values through
+  /// ReleaseZeroCopyValues() after each read; values() and ReleaseValues() do
+  /// not cover values read through the zero-copy path.
+  void set_zero_copy_values(bool enabled) { zero_copy_values_enabled_ = enabled; }
+
+  /// \brief Transfer values read through the zero-copy path to the caller.
+  ///
+  /// Returns nullptr if the preceding reads did not take the zero-copy path,
+  /// in which case ReleaseValues() holds the values as usual.
+  /// \note API EXPERIMENTAL
+  virtual std::shared_ptr<Buffer> ReleaseZeroCopyValues() { return NULLPTR; }
+
  protected:
   /// \brief Indicates if we can have nullable values. Note that repeated fields
   /// may or may not be nullable.
@@ -427,6 +452,10 @@ class PARQUET_EXPORT RecordReader {
   // If read_dense_for_nullable_ is true, the BinaryRecordReader/DictionaryRecordReader
   // might still populate the validity bitmap buffer.
   bool read_dense_for_nullable_ = false;
+
+  // If true, eligible reads return page buffer slices through
+  // ReleaseZeroCopyValues() instead of copying into 'values_'.
+  bool zero_copy_values_enabled_ = false;
 };
 
 class BinaryRecordReader : virtual public RecordReader {
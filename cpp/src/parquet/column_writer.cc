@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <map>
 #include <memory>
 #include <utility>
@@ -32,6 +33,7 @@
 #include "arrow/status.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_run_reader.h"
 #include "arrow/util/bit_stream_utils_internal.h"
 #include "arrow/util/bit_util.h"
 #include "arrow/util/bitmap_ops.h"
@@ -45,6 +47,9 @@
 #include "arrow/util/rle_encoding_internal.h"
 #include "arrow/util/type_traits.h"
 #include "arrow/visit_array_inline.h"
+#include "parquet/bloom_filter.h"
+#include "parquet/bloom_filter_builder.h"
+#include "parquet/chunker_internal.h"
 #include "parquet/column_page.h"
 #include "parquet/encoding.h"
 #include "parquet/encryption/encryption_internal.h"
@@ -59,6 +64,7 @@
 #include "parquet/statistics.h"
 #include "parquet/thrift_internal.h"
 #include "parquet/types.h"
+#include "parquet/xxhasher.h"
 
 using arrow::Array;
 using arrow::ArrayData;
@@ -1229,7 +1235,8 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
 
   TypedColumnWriterImpl(ColumnChunkMetaDataBuilder* metadata,
                         std::unique_ptr<PageWriter> pager, const bool use_dictionary,
-                        Encoding::type encoding, const WriterProperties* properties)
+                        Encoding::type encoding, const WriterProperties* properties,
+                        BloomFilterBuilder* bloom_filter_builder, int32_t column_ordinal)
       : ColumnWriterImpl(metadata, std::move(pager), use_dictionary, encoding,
                          properties) {
     current_encoder_ = MakeEncoder(ParquetType::type_num, encoding, use_dictionary,
@@ -1263,9 +1270,27 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
     pages_change_on_record_boundaries_ =
         properties->data_page_version() == ParquetDataPageVersion::V2 ||
         properties->page_index_enabled(descr_->path());
+
+    adaptive_encoding_pending_ = properties->adaptive_encoding_enabled(descr_->path());
+
+    if (properties->content_defined_chunking_enabled()) {
+      content_defined_chunker_ = std::make_unique<internal::ContentDefinedChunker>(
+          properties->cdc_min_chunk_size(), properties->cdc_max_chunk_size());
+    }
+
+    // Boolean columns have at most two distinct values, so a bloom filter
+    // would never prune anything.
+    if (bloom_filter_builder != nullptr &&
+        descr_->physical_type() != Type::BOOLEAN) {
+      bloom_filter_builder_ = bloom_filter_builder;
+      bloom_filter_column_ordinal_ = column_ordinal;
+    }
   }
 
-  int64_t Close() override { return ColumnWriterImpl::Close(); }
+  int64_t Close() override {
+    FinalizeBloomFilter();
+    return ColumnWriterImpl::Close();
+  }
 
   int64_t WriteBatch(int64_t num_values, const int16_t* def_levels,
                      const int16_t* rep_levels, const T* values) override {
@@ -1485,6 +1510,37 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
 
   const WriterProperties* properties() override { return properties_; }
 
+  bool dictionary_fallback_imminent() const override {
+    if (!has_dictionary_) {
+      return false;
+    }
+    if (fallback_) {
+      return true;
+    }
+    return current_dict_encoder_->dict_encoded_size() >=
+           static_cast<int64_t>(
+               kDictionaryFallbackImminentRatio *
+               static_cast<double>(properties_->dictionary_pagesize_limit()));
+  }
+
+  int64_t estimated_decoded_bytes() const override {
+    // One validity bit per level.
+    int64_t bytes = bit_util::BytesForBits(chunk_levels_tracked_);
+    if constexpr (std::is_same_v<T, ByteArray>) {
+      // Variable-length data decodes to an offsets buffer plus the value
+      // bytes themselves.
+      bytes += byte_array_decoded_bytes_ +
+               (chunk_levels_tracked_ + 1) * static_cast<int64_t>(sizeof(int32_t));
+    } else if constexpr (std::is_same_v<T, bool>) {
+      bytes += bit_util::BytesForBits(chunk_values_tracked_);
+    } else if constexpr (std::is_same_v<T, FLBA>) {
+      bytes += chunk_values_tracked_ * descr_->type_length();
+    } else {
+      bytes += chunk_values_tracked_ * static_cast<int64_t>(sizeof(T));
+    }
+    return bytes;
+  }
+
   bool pages_change_on_record_boundaries() const {
     return pages_change_on_record_boundaries_;
   }
@@ -1524,6 +1580,28 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
   std::shared_ptr<SizeStatistics> chunk_size_statistics_;
   std::shared_ptr<geospatial::GeoStatistics> chunk_geospatial_statistics_;
   bool pages_change_on_record_boundaries_;
+  // True until adaptive encoding selection has picked an encoding for this
+  // column chunk (see MaybeSelectAdaptiveEncoding below).
+  bool adaptive_encoding_pending_;
+  // Non-null iff content-defined chunking is enabled; fed the raw value bytes
+  // so data page boundaries track value content (see RollContentDefinedChunker).
+  std::unique_ptr<internal::ContentDefinedChunker> content_defined_chunker_;
+  // True when the chunker crossed a cut point and the current page should be
+  // closed at the next commit that may change pages.
+  bool cdc_cut_pending_ = false;
+  // Running totals for the whole column chunk, used to predict the in-memory
+  // decoded size (see estimated_decoded_bytes).
+  int64_t chunk_levels_tracked_ = 0;
+  int64_t chunk_values_tracked_ = 0;
+  int64_t byte_array_decoded_bytes_ = 0;
+  // Non-null iff a bloom filter should be built for this column chunk. Value
+  // hashes are buffered in bloom_filter_hashes_ and turned into a
+  // right-sized filter when the chunk closes (see FinalizeBloomFilter).
+  BloomFilterBuilder* bloom_filter_builder_ = nullptr;
+  int32_t bloom_filter_column_ordinal_ = -1;
+  XxHasher bloom_filter_hasher_;
+  std::vector<uint64_t> bloom_filter_hashes_;
+  std::vector<ByteArray> bloom_filter_byte_array_scratch_;
 
   // If writing a sequence of ::arrow::DictionaryArray to the writer, we keep the
   // dictionary passed to DictEncoder<T>::PutDictionary so we can check
@@ -1688,11 +1766,13 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
   }
 
   // Update the unencoded data bytes for ByteArray only per the specification.
-  void UpdateUnencodedDataBytes() const {
+  // The same counter feeds the decoded-size estimate for row group sizing.
+  void UpdateUnencodedDataBytes() {
     if constexpr (std::is_same_v<T, ByteArray>) {
+      const int64_t unencoded_bytes = current_encoder_->ReportUnencodedDataBytes();
+      byte_array_decoded_bytes_ += unencoded_bytes;
       if (page_size_statistics_ != nullptr) {
-        page_size_statistics_->IncrementUnencodedByteArrayDataBytes(
-            current_encoder_->ReportUnencodedDataBytes());
+        page_size_statistics_->IncrementUnencodedByteArrayDataBytes(unencoded_bytes);
       }
     }
   }
@@ -1702,9 +1782,12 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
     num_buffered_values_ += num_levels;
     num_buffered_encoded_values_ += num_values;
     num_buffered_nulls_ += num_nulls;
+    chunk_levels_tracked_ += num_levels;
+    chunk_values_tracked_ += num_values;
 
     if (check_page_size &&
-        current_encoder_->EstimatedDataEncodedSize() >= properties_->data_pagesize()) {
+        (std::exchange(cdc_cut_pending_, false) ||
+         current_encoder_->EstimatedDataEncodedSize() >= properties_->data_pagesize())) {
       AddDataPage();
     }
   }
@@ -1743,8 +1826,222 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
     }
   }
 
+  // Fraction of the dictionary page size limit at which
+  // dictionary_fallback_imminent() starts reporting true.
+  static constexpr double kDictionaryFallbackImminentRatio = 0.8;
+
+  // Number of leading values trial-encoded when adaptive encoding selection
+  // is enabled.
+  static constexpr int64_t kAdaptiveEncodingSampleSize = 4096;
+  // A candidate has to shrink the sample to below this fraction of its PLAIN
+  // encoded size to be picked, biasing ties towards PLAIN which is the
+  // cheapest encoding to decode.
+  static constexpr double kAdaptiveEncodingMaxRatio = 0.9;
+
+  // Candidate encodings trialled by adaptive encoding selection for this
+  // physical type, in order of increasing decoding cost. PLAIN is always
+  // implied as the baseline.
+  static std::vector<Encoding::type> AdaptiveEncodingCandidates() {
+    switch (ParquetType::type_num) {
+      case Type::BOOLEAN:
+        return {Encoding::RLE};
+      case Type::INT32:
+      case Type::INT64:
+        return {Encoding::DELTA_BINARY_PACKED};
+      case Type::FLOAT:
+      case Type::DOUBLE:
+        return {Encoding::BYTE_STREAM_SPLIT};
+      case Type::BYTE_ARRAY:
+        return {Encoding::DELTA_LENGTH_BYTE_ARRAY, Encoding::DELTA_BYTE_ARRAY};
+      case Type::FIXED_LEN_BYTE_ARRAY:
+        return {Encoding::BYTE_STREAM_SPLIT, Encoding::DELTA_BYTE_ARRAY};
+      default:
+        return {};
+    }
+  }
+
+  // Compare the sizes reported by 'trial_size' for PLAIN and each candidate
+  // encoding and switch the current encoder to the winner. Candidates that
+  // throw (e.g. an unsupported type length) are skipped.
+  template <typename TrialSize>
+  void SelectAdaptiveEncoding(TrialSize&& trial_size) {
+    const std::vector<Encoding::type> candidates = AdaptiveEncodingCandidates();
+    if (candidates.empty()) {
+      return;
+    }
+    Encoding::type best_encoding = Encoding::PLAIN;
+    int64_t best_size = static_cast<int64_t>(
+        kAdaptiveEncodingMaxRatio * static_cast<double>(trial_size(Encoding::PLAIN)));
+    for (Encoding::type candidate : candidates) {
+      int64_t candidate_size;
+      try {
+        candidate_size = trial_size(candidate);
+      } catch (const ParquetException&) {
+        continue;
+      }
+      if (candidate_size < best_size) {
+        best_encoding = candidate;
+        best_size = candidate_size;
+      }
+    }
+    if (best_encoding != current_encoder_->encoding()) {
+      // The current encoder has not been written to yet, so it can simply be
+      // replaced. The chosen encoding shows up in the column chunk metadata
+      // through the regular page encoding stats.
+      current_encoder_ = MakeEncoder(ParquetType::type_num, best_encoding,
+                                     /*use_dictionary=*/false, descr_,
+                                     properties_->memory_pool());
+      current_value_encoder_ = dynamic_cast<ValueEncoderType*>(current_encoder_.get());
+      encoding_ = best_encoding;
+    }
+  }
+
+  // Pick the encoding for this column chunk by trial-encoding a sample of the
+  // first values written to it. Must be called before the values are put into
+  // the current encoder. While dictionary encoding is active the decision is
+  // deferred to the first batch after a dictionary fallback, where the
+  // adaptive choice replaces the hard-coded PLAIN fallback. When 'valid_bits'
+  // is non-null, 'num_values' counts the spaced values.
+  void MaybeSelectAdaptiveEncoding(const T* values, int64_t num_values,
+                                   const uint8_t* valid_bits = nullptr,
+                                   int64_t valid_bits_offset = 0) {
+    if (current_dict_encoder_ != nullptr || num_values == 0) {
+      return;
+    }
+    adaptive_encoding_pending_ = false;
+    const int sample_size =
+        static_cast<int>(std::min(num_values, kAdaptiveEncodingSampleSize));
+    SelectAdaptiveEncoding([&](Encoding::type encoding) -> int64_t {
+      auto encoder = MakeTypedEncoder<ParquetType>(
+          encoding, /*use_dictionary=*/false, descr_, properties_->memory_pool());
+      if (valid_bits != nullptr) {
+        encoder->PutSpaced(values, sample_size, valid_bits, valid_bits_offset);
+      } else {
+        encoder->Put(values, sample_size);
+      }
+      return encoder->FlushValues()->size();
+    });
+  }
+
+  // As above, for the direct Arrow write path.
+  void MaybeSelectAdaptiveEncoding(const ::arrow::Array& values) {
+    if (current_dict_encoder_ != nullptr || values.length() == 0) {
+      return;
+    }
+    adaptive_encoding_pending_ = false;
+    std::shared_ptr<::arrow::Array> sample =
+        values.Slice(0, std::min(values.length(), kAdaptiveEncodingSampleSize));
+    SelectAdaptiveEncoding([&](Encoding::type encoding) -> int64_t {
+      auto encoder = MakeTypedEncoder<ParquetType>(
+          encoding, /*use_dictionary=*/false, descr_, properties_->memory_pool());
+      encoder->Put(*sample);
+      return encoder->FlushValues()->size();
+    });
+  }
+
+  // Feed the raw bytes of `values` to the content-defined chunker and remember
+  // whether a cut point was crossed; the page is then cut at the next commit,
+  // so the boundary lands on the write batch enclosing the cut point.
+  void RollContentDefinedChunker(const T* values, int64_t num_values) {
+    if constexpr (std::is_same<T, ByteArray>::value) {
+      for (int64_t i = 0; i < num_values; ++i) {
+        cdc_cut_pending_ |= content_defined_chunker_->Roll(values[i].ptr, values[i].len);
+      }
+    } else if constexpr (std::is_same<T, FLBA>::value) {
+      const int64_t type_length = descr_->type_length();
+      for (int64_t i = 0; i < num_values; ++i) {
+        cdc_cut_pending_ |= content_defined_chunker_->Roll(values[i].ptr, type_length);
+      }
+    } else {
+      cdc_cut_pending_ |= content_defined_chunker_->Roll(
+          reinterpret_cast<const uint8_t*>(values),
+          num_values * static_cast<int64_t>(sizeof(T)));
+    }
+  }
+
+  // As above for spaced values: only valid slots are rolled so the chunker
+  // never sees the undefined bytes behind null positions.
+  void RollContentDefinedChunkerSpaced(const T* values, int64_t num_spaced_values,
+                                       const uint8_t* valid_bits,
+                                       int64_t valid_bits_offset) {
+    ::arrow::internal::VisitSetBitRunsVoid(
+        valid_bits, valid_bits_offset, num_spaced_values,
+        [&](int64_t position, int64_t length) {
+          RollContentDefinedChunker(values + position, length);
+        });
+  }
+
+  // Batch-hash freshly written values into the bloom filter hash buffer.
+  // The filter itself is sized and built when the chunk closes, once the
+  // distinct hash count is known.
+  void AccumulateBloomFilterHashes(const T* values, int64_t num_values) {
+    if constexpr (!std::is_same_v<T, bool>) {
+      const size_t offset = bloom_filter_hashes_.size();
+      bloom_filter_hashes_.resize(offset + static_cast<size_t>(num_values));
+      uint64_t* out = bloom_filter_hashes_.data() + offset;
+      if constexpr (std::is_same_v<T, FLBA>) {
+        bloom_filter_hasher_.Hashes(values,
+                                    static_cast<uint32_t>(descr_->type_length()),
+                                    static_cast<int>(num_values), out);
+      } else {
+        bloom_filter_hasher_.Hashes(values, static_cast<int>(num_values), out);
+      }
+    }
+  }
+
+  void AccumulateBloomFilterHashesSpaced(const T* values, int64_t num_spaced_values,
+                                         const uint8_t* valid_bits,
+                                         int64_t valid_bits_offset) {
+    ::arrow::internal::VisitSetBitRunsVoid(
+        valid_bits, valid_bits_offset, num_spaced_values,
+        [&](int64_t position, int64_t length) {
+          AccumulateBloomFilterHashes(values + position, length);
+        });
+  }
+
+  // Build the chunk's bloom filter from the buffered hashes. Deduplicating
+  // the buffer gives the exact number of distinct hashes, so the filter is
+  // sized for the chunk's actual cardinality instead of a worst-case NDV
+  // guess.
+  void FinalizeBloomFilter() {
+    if (bloom_filter_builder_ == nullptr || bloom_filter_hashes_.empty()) {
+      return;
+    }
+    std::sort(bloom_filter_hashes_.begin(), bloom_filter_hashes_.end());
+    const auto distinct_end =
+        std::unique(bloom_filter_hashes_.begin(), bloom_filter_hashes_.end());
+    const auto num_distinct =
+        static_cast<int64_t>(distinct_end - bloom_filter_hashes_.begin());
+    auto bloom_filter =
+        std::make_unique<BlockSplitBloomFilter>(properties_->memory_pool());
+    bloom_filter->Init(BlockSplitBloomFilter::OptimalNumOfBytes(
+        static_cast<uint32_t>(std::min<int64_t>(
+            num_distinct, std::numeric_limits<uint32_t>::max())),
+        properties_->bloom_filter_fpp()));
+    int64_t position = 0;
+    while (position < num_distinct) {
+      const int batch_size = static_cast<int>(std::min<int64_t>(
+          num_distinct - position, std::numeric_limits<int>::max()));
+      bloom_filter->InsertHashes(bloom_filter_hashes_.data() + position, batch_size);
+      position += batch_size;
+    }
+    bloom_filter_builder_->AddBloomFilter(bloom_filter_column_ordinal_,
+                                          std::move(bloom_filter));
+    bloom_filter_hashes_.clear();
+    bloom_filter_hashes_.shrink_to_fit();
+  }
+
   void WriteValues(const T* values, int64_t num_values, int64_t num_nulls) {
+    if (ARROW_PREDICT_FALSE(adaptive_encoding_pending_)) {
+      MaybeSelectAdaptiveEncoding(values, num_values);
+    }
     current_value_encoder_->Put(values, static_cast<int>(num_values));
+    if (ARROW_PREDICT_FALSE(content_defined_chunker_ != nullptr)) {
+      RollContentDefinedChunker(values, num_values);
+    }
+    if (ARROW_PREDICT_FALSE(bloom_filter_builder_ != nullptr)) {
+      AccumulateBloomFilterHashes(values, num_values);
+    }
     if (page_statistics_ != nullptr) {
       page_statistics_->Update(values, num_values, num_nulls);
     }
@@ -1775,10 +2072,31 @@ class TypedColumnWriterImpl : public ColumnWriterImpl,
                          const uint8_t* valid_bits, int64_t valid_bits_offset,
                          int64_t num_levels, int64_t num_nulls) {
     if (num_values != num_spaced_values) {
+      if (ARROW_PREDICT_FALSE(adaptive_encoding_pending_)) {
+        MaybeSelectAdaptiveEncoding(values, num_spaced_values, valid_bits,
+                                    valid_bits_offset);
+      }
       current_value_encoder_->PutSpaced(values, static_cast<int>(num_spaced_values),
                                         valid_bits, valid_bits_offset);
+      if (ARROW_PREDICT_FALSE(content_defined_chunker_ != nullptr)) {
+        RollContentDefinedChunkerSpaced(values, num_spaced_values, valid_bits,
+                                        valid_bits_offset);
+      }
+      if (ARROW_PREDICT_FALSE(bloom_filter_builder_ != nullptr)) {
+        AccumulateBloomFilterHashesSpaced(values, num_spaced_values, valid_bits,
+                                          valid_bits_offset);
+      }
     } else {
+      if (ARROW_PREDICT_FALSE(adaptive_encoding_pending_)) {
+        MaybeSelectAdaptiveEncoding(values, num_values);
+      }
       current_value_encoder_->Put(values, static_cast<int>(num_values));
+      if (ARROW_PREDICT_FALSE(content_defined_chunker_ != nullptr)) {
+        RollContentDefinedChunker(values, num_values);
+      }
+      if (ARROW_PREDICT_FALSE(bloom_filter_builder_ != nullptr)) {
+        AccumulateBloomFilterHashes(values, num_values);
+      }
     }
     if (page_statistics_ != nullptr) {
       page_statistics_->UpdateSpaced(values, valid_bits, valid_bits_offset,
@@ -2324,6 +2642,24 @@ Status TypedColumnWriterImpl<DoubleType>::WriteArrowDense(
 // ----------------------------------------------------------------------
 // Write Arrow to BYTE_ARRAY
 
+namespace {
+
+// Visit the non-null values of a binary-like array, forwarding the value bytes
+// to `roll_value`.
+template <typename ArrayType, typename RollValue>
+void RollBinaryArrayValues(const ::arrow::Array& array, RollValue&& roll_value) {
+  const auto& binary_array = checked_cast<const ArrayType&>(array);
+  for (int64_t i = 0; i < binary_array.length(); ++i) {
+    if (binary_array.IsValid(i)) {
+      const auto value = binary_array.GetView(i);
+      roll_value(reinterpret_cast<const uint8_t*>(value.data()),
+                 static_cast<int64_t>(value.size()));
+    }
+  }
+}
+
+}  // namespace
+
 template <>
 Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
     const int16_t* def_levels, const int16_t* rep_levels, int64_t num_levels,
@@ -2347,7 +2683,37 @@ Status TypedColumnWriterImpl<ByteArrayType>::WriteArrowDense(
     PARQUET_ASSIGN_OR_THROW(
         data_slice, MaybeReplaceValidity(data_slice, null_count, ctx->memory_pool));
 
+    if (ARROW_PREDICT_FALSE(adaptive_encoding_pending_)) {
+      MaybeSelectAdaptiveEncoding(*data_slice);
+    }
     current_encoder_->Put(*data_slice);
+    if (ARROW_PREDICT_FALSE(content_defined_chunker_ != nullptr)) {
+      auto roll_value = [this](const uint8_t* data, int64_t size) {
+        cdc_cut_pending_ |= content_defined_chunker_->Roll(data, size);
+      };
+      if (::arrow::is_binary_like(data_slice->type()->id())) {
+        RollBinaryArrayValues<::arrow::BinaryArray>(*data_slice, roll_value);
+      } else {
+        RollBinaryArrayValues<::arrow::LargeBinaryArray>(*data_slice, roll_value);
+      }
+    }
+    if (ARROW_PREDICT_FALSE(bloom_filter_builder_ != nullptr)) {
+      bloom_filter_byte_array_scratch_.clear();
+      bloom_filter_byte_array_scratch_.reserve(data_slice->length() -
+                                               data_slice->null_count());
+      auto collect_value = [this](const uint8_t* data, int64_t size) {
+        bloom_filter_byte_array_scratch_.emplace_back(static_cast<uint32_t>(size),
+                                                      data);
+      };
+      if (::arrow::is_binary_like(data_slice->type()->id())) {
+        RollBinaryArrayValues<::arrow::BinaryArray>(*data_slice, collect_value);
+      } else {
+        RollBinaryArrayValues<::arrow::LargeBinaryArray>(*data_slice, collect_value);
+      }
+      AccumulateBloomFilterHashes(
+          bloom_filter_byte_array_scratch_.data(),
+          static_cast<int64_t>(bloom_filter_byte_array_scratch_.size()));
+    }
     // Null values in ancestors count as nulls.
     const int64_t non_null = data_slice->length() - data_slice->null_count();
     if (page_statistics_ != nullptr) {
@@ -2518,7 +2884,9 @@ Status TypedColumnWriterImpl<FLBAType>::WriteArrowDense(
 
 std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* metadata,
                                                  std::unique_ptr<PageWriter> pager,
-                                                 const WriterProperties* properties) {
+                                                 const WriterProperties* properties,
+                                                 BloomFilterBuilder* bloom_filter_builder,
+                                                 int32_t column_ordinal) {
   const ColumnDescriptor* descr = metadata->descr();
   const bool use_dictionary = properties->dictionary_enabled(descr->path()) &&
                               descr->physical_type() != Type::BOOLEAN;
@@ -2536,28 +2904,36 @@ std::shared_ptr<ColumnWriter> ColumnWriter::Make(ColumnChunkMetaDataBuilder* met
   switch (descr->physical_type()) {
     case Type::BOOLEAN:
       return std::make_shared<TypedColumnWriterImpl<BooleanType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder, column_ordinal);
     case Type::INT32:
       return std::make_shared<TypedColumnWriterImpl<Int32Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder, column_ordinal);
     case Type::INT64:
       return std::make_shared<TypedColumnWriterImpl<Int64Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder, column_ordinal);
     case Type::INT96:
       return std::make_shared<TypedColumnWriterImpl<Int96Type>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder, column_ordinal);
     case Type::FLOAT:
       return std::make_shared<TypedColumnWriterImpl<FloatType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder, column_ordinal);
     case Type::DOUBLE:
       return std::make_shared<TypedColumnWriterImpl<DoubleType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder, column_ordinal);
     case Type::BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<ByteArrayType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder, column_ordinal);
     case Type::FIXED_LEN_BYTE_ARRAY:
       return std::make_shared<TypedColumnWriterImpl<FLBAType>>(
-          metadata, std::move(pager), use_dictionary, encoding, properties);
+          metadata, std::move(pager), use_dictionary, encoding, properties,
+          bloom_filter_builder, column_ordinal);
     default:
       ParquetException::NYI("type reader not implemented");
   }
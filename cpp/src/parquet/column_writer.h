@@ -45,6 +45,7 @@ class CodecOptions;
 namespace parquet {
 
 struct ArrowWriteContext;
+class BloomFilterBuilder;
 class ColumnChunkMetaDataBuilder;
 class ColumnDescriptor;
 class ColumnIndexBuilder;
@@ -127,9 +128,17 @@ class PARQUET_EXPORT ColumnWriter {
  public:
   virtual ~ColumnWriter() = default;
 
+  /// \brief Create a column writer.
+  ///
+  /// When `bloom_filter_builder` is non-null, the writer hashes the column's
+  /// values in batches while writing and hands a bloom filter sized for the
+  /// chunk's distinct count to the builder when the chunk closes.
+  /// `column_ordinal` identifies the column chunk to the builder.
   static std::shared_ptr<ColumnWriter> Make(ColumnChunkMetaDataBuilder*,
                                             std::unique_ptr<PageWriter>,
-                                            const WriterProperties* properties);
+                                            const WriterProperties* properties,
+                                            BloomFilterBuilder* bloom_filter_builder = NULLPTR,
+                                            int32_t column_ordinal = -1);
 
   /// \brief Closes the ColumnWriter, commits any buffered values to pages.
   /// \return Total size of the column in bytes
@@ -164,6 +173,23 @@ class PARQUET_EXPORT ColumnWriter {
   /// \brief Estimated size of the values that are not written to a page yet.
   virtual int64_t estimated_buffered_value_bytes() const = 0;
 
+  /// \brief Whether the column's dictionary page is nearly full or the column
+  /// has already fallen back to plain encoding.
+  ///
+  /// Always false for columns written without dictionary encoding. Callers can
+  /// use this to close the row group early so that subsequent values get a
+  /// fresh dictionary instead of plain-encoded pages.
+  virtual bool dictionary_fallback_imminent() const = 0;
+
+  /// \brief Predicted in-memory size of this column chunk once decoded:
+  /// raw value bytes plus offsets for variable-length data and one validity
+  /// bit per level.
+  ///
+  /// Unlike total_bytes_written() this does not depend on encoding or
+  /// compression, so callers can use it to bound the memory a reader needs
+  /// to materialize the row group.
+  virtual int64_t estimated_decoded_bytes() const = 0;
+
   /// \brief The file-level writer properties
   virtual const WriterProperties* properties() = 0;
 
@@ -41,6 +41,7 @@
 #include "arrow/util/int_util_overflow.h"
 #include "arrow/util/logging_internal.h"
 #include "arrow/util/rle_encoding_internal.h"
+#include "arrow/util/simd.h"
 #include "arrow/util/spaced.h"
 #include "arrow/util/ubsan.h"
 #include "arrow/visit_data_inline.h"
@@ -1344,6 +1345,92 @@ class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
 // ----------------------------------------------------------------------
 // DELTA_BINARY_PACKED decoder
 
+#if defined(ARROW_HAVE_AVX2)
+
+// Add `min_delta` to each element of `deltas`, compute the inclusive prefix
+// sum and add the running value `last` to every element. All additions wrap
+// around like the unsigned arithmetic mandated by the format.
+inline __m256i DeltaRunningSumAvx2(__m256i deltas, int32_t min_delta, int32_t last) {
+  __m256i x = _mm256_add_epi32(deltas, _mm256_set1_epi32(min_delta));
+  x = _mm256_add_epi32(x, _mm256_slli_si256(x, 4));
+  x = _mm256_add_epi32(x, _mm256_slli_si256(x, 8));
+  // Carry the low lane's total into every element of the high lane.
+  __m256i carry = _mm256_permute2x128_si256(x, x, 0x08);
+  carry = _mm256_shuffle_epi32(carry, _MM_SHUFFLE(3, 3, 3, 3));
+  x = _mm256_add_epi32(x, carry);
+  return _mm256_add_epi32(x, _mm256_set1_epi32(last));
+}
+
+inline __m256i DeltaRunningSumAvx2(__m256i deltas, int64_t min_delta, int64_t last) {
+  __m256i x = _mm256_add_epi64(deltas, _mm256_set1_epi64x(min_delta));
+  x = _mm256_add_epi64(x, _mm256_slli_si256(x, 8));
+  __m256i carry = _mm256_permute2x128_si256(x, x, 0x08);
+  carry = _mm256_shuffle_epi32(carry, _MM_SHUFFLE(3, 2, 3, 2));
+  x = _mm256_add_epi64(x, carry);
+  return _mm256_add_epi64(x, _mm256_set1_epi64x(last));
+}
+
+#endif  // defined(ARROW_HAVE_AVX2)
+
+#if defined(ARROW_HAVE_AVX512)
+
+inline __m512i DeltaRunningSumAvx512(__m512i deltas, int32_t min_delta, int32_t last) {
+  const __m512i zero = _mm512_setzero_si512();
+  __m512i x = _mm512_add_epi32(deltas, _mm512_set1_epi32(min_delta));
+  // Log-step prefix sum: add a copy of the vector shifted left by 1, 2, 4
+  // then 8 elements (valignd with a zero vector shifts in zeroes).
+  x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 16 - 1));
+  x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 16 - 2));
+  x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 16 - 4));
+  x = _mm512_add_epi32(x, _mm512_alignr_epi32(x, zero, 16 - 8));
+  return _mm512_add_epi32(x, _mm512_set1_epi32(last));
+}
+
+inline __m512i DeltaRunningSumAvx512(__m512i deltas, int64_t min_delta, int64_t last) {
+  const __m512i zero = _mm512_setzero_si512();
+  __m512i x = _mm512_add_epi64(deltas, _mm512_set1_epi64(min_delta));
+  x = _mm512_add_epi64(x, _mm512_alignr_epi64(x, zero, 8 - 1));
+  x = _mm512_add_epi64(x, _mm512_alignr_epi64(x, zero, 8 - 2));
+  x = _mm512_add_epi64(x, _mm512_alignr_epi64(x, zero, 8 - 4));
+  return _mm512_add_epi64(x, _mm512_set1_epi64(last));
+}
+
+#endif  // defined(ARROW_HAVE_AVX512)
+
+// Reconstruct delta-encoded values in place: each element becomes
+// element + min_delta + previous element, seeded with `last`. Returns the new
+// running value. Additions are performed on unsigned integers so that
+// overflow wraps around as required by the format.
+template <typename T>
+T DeltaReconstructValues(T* buffer, int num_values, T min_delta, T last) {
+  using UT = std::make_unsigned_t<T>;
+  int i = 0;
+#if defined(ARROW_HAVE_AVX512)
+  constexpr int kAvx512BatchSize = static_cast<int>(sizeof(__m512i) / sizeof(T));
+  for (; i + kAvx512BatchSize <= num_values; i += kAvx512BatchSize) {
+    __m512i x = _mm512_loadu_si512(buffer + i);
+    x = DeltaRunningSumAvx512(x, min_delta, last);
+    _mm512_storeu_si512(buffer + i, x);
+    last = buffer[i + kAvx512BatchSize - 1];
+  }
+#endif
+#if defined(ARROW_HAVE_AVX2)
+  constexpr int kAvx2BatchSize = static_cast<int>(sizeof(__m256i) / sizeof(T));
+  for (; i + kAvx2BatchSize <= num_values; i += kAvx2BatchSize) {
+    __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(buffer + i));
+    x = DeltaRunningSumAvx2(x, min_delta, last);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(buffer + i), x);
+    last = buffer[i + kAvx2BatchSize - 1];
+  }
+#endif
+  for (; i < num_values; ++i) {
+    buffer[i] =
+        static_cast<UT>(min_delta) + static_cast<UT>(buffer[i]) + static_cast<UT>(last);
+    last = buffer[i];
+  }
+  return last;
+}
+
 template <typename DType>
 class DeltaBitPackDecoder : public DecoderImpl, public TypedDecoderImpl<DType> {
  public:
@@ -1535,13 +1622,10 @@ class DeltaBitPackDecoder : public DecoderImpl, public TypedDecoderImpl<DType> {
           values_decode) {
         ParquetException::EofException();
       }
-      for (int j = 0; j < values_decode; ++j) {
-        // Addition between min_delta, packed int and last_value should be treated as
-        // unsigned addition. Overflow is as expected.
-        buffer[i + j] = static_cast<UT>(min_delta_) + static_cast<UT>(buffer[i + j]) +
-                        static_cast<UT>(last_value_);
-        last_value_ = buffer[i + j];
-      }
+      // Addition between min_delta, packed int and last_value should be treated as
+      // unsigned addition. Overflow is as expected.
+      last_value_ =
+          DeltaReconstructValues(buffer + i, values_decode, min_delta_, last_value_);
       values_remaining_current_mini_block_ -= values_decode;
       i += values_decode;
     }
@@ -1087,15 +1087,22 @@ void DeltaBitPackEncoder<DType>::Put(const T* src, int num_values) {
   total_value_count_ += num_values;
 
   while (idx < num_values) {
-    T value = src[idx];
+    const int chunk_size = std::min(
+        num_values - idx, static_cast<int>(values_per_block_ - values_current_block_));
+    T* deltas = deltas_.data() + values_current_block_;
     // Calculate deltas. The possible overflow is handled by use of unsigned integers
     // making subtraction operations well-defined and correct even in case of overflow.
     // Encoded integers will wrap back around on decoding.
     // See http://en.wikipedia.org/wiki/Modular_arithmetic#Integers_modulo_n
-    deltas_[values_current_block_] = SafeSignedSubtract(value, current_value_);
-    current_value_ = value;
-    idx++;
-    values_current_block_++;
+    // Each delta only depends on adjacent source values, so the loop carries no
+    // dependency and vectorizes well.
+    deltas[0] = SafeSignedSubtract(src[idx], current_value_);
+    for (int j = 1; j < chunk_size; ++j) {
+      deltas[j] = SafeSignedSubtract(src[idx + j], src[idx + j - 1]);
+    }
+    current_value_ = src[idx + chunk_size - 1];
+    idx += chunk_size;
+    values_current_block_ += chunk_size;
     if (values_current_block_ == values_per_block_) {
       FlushBlock();
     }
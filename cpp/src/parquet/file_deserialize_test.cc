@@ -778,6 +778,86 @@ TEST_F(TestPageSerde, PageSizeResetWhenRead) {
   this->TestPageCompressionRoundTrip(page_sizes);
 }
 
+TEST_F(TestPageSerde, PipelinedPageReader) {
+  // With a non-zero page prefetch depth, pages are read and decompressed on a
+  // producer thread ahead of the consumer. Contents and ordering must not
+  // change, and unlike the serial reader every returned page must stay valid
+  // across subsequent NextPage() calls.
+  auto codec_types = GetSupportedCodecTypes();
+  codec_types.insert(codec_types.begin(), Compression::UNCOMPRESSED);
+
+  const int num_pages = 10;
+  const int32_t num_rows = 32;  // dummy value
+  data_page_header_.num_values = num_rows;
+
+  std::vector<std::vector<uint8_t>> faux_data(num_pages);
+  for (int i = 0; i < num_pages; ++i) {
+    test::random_bytes((i + 1) * 64, 0, &faux_data[i]);
+  }
+  for (auto codec_type : codec_types) {
+    std::vector<uint8_t> buffer;
+    for (int i = 0; i < num_pages; ++i) {
+      const uint8_t* data = faux_data[i].data();
+      int data_size = static_cast<int>(faux_data[i].size());
+      int64_t actual_size = data_size;
+      if (codec_type == Compression::UNCOMPRESSED) {
+        buffer.assign(data, data + data_size);
+      } else {
+        auto codec = GetCodec(codec_type);
+        int64_t max_compressed_size = codec->MaxCompressedLen(data_size, data);
+        buffer.resize(max_compressed_size);
+        ASSERT_OK_AND_ASSIGN(actual_size, codec->Compress(data_size, data,
+                                                          max_compressed_size,
+                                                          &buffer[0]));
+      }
+      ASSERT_NO_FATAL_FAILURE(
+          WriteDataPageHeader(1024, data_size, static_cast<int32_t>(actual_size)));
+      ASSERT_OK(out_stream_->Write(buffer.data(), actual_size));
+    }
+
+    ReaderProperties properties;
+    properties.set_page_prefetch_depth(3);
+    InitSerializedPageReader(num_rows * num_pages, codec_type, properties);
+
+    std::vector<std::shared_ptr<Page>> pages;
+    for (int i = 0; i < num_pages; ++i) {
+      pages.push_back(page_reader_->NextPage());
+      ASSERT_NE(pages.back(), nullptr);
+    }
+    ASSERT_EQ(page_reader_->NextPage(), nullptr);
+
+    for (int i = 0; i < num_pages; ++i) {
+      int data_size = static_cast<int>(faux_data[i].size());
+      const auto* data_page = static_cast<const DataPageV1*>(pages[i].get());
+      ASSERT_EQ(data_size, data_page->size());
+      ASSERT_EQ(0, memcmp(faux_data[i].data(), data_page->data(), data_size));
+    }
+
+    ResetStream();
+  }
+}
+
+TEST_F(TestPageSerde, PipelinedPageReaderEarlyShutdown) {
+  // Destroying the reader while the producer is blocked on a full queue must
+  // not hang or leak the producer thread.
+  const int num_pages = 16;
+  const int32_t num_rows = 32;
+  data_page_header_.num_values = num_rows;
+  std::vector<uint8_t> faux_data(64);
+  test::random_bytes(64, 0, &faux_data);
+  for (int i = 0; i < num_pages; ++i) {
+    ASSERT_NO_FATAL_FAILURE(WriteDataPageHeader(1024, 64, 64));
+    ASSERT_OK(out_stream_->Write(faux_data.data(), 64));
+  }
+
+  ReaderProperties properties;
+  properties.set_page_prefetch_depth(2);
+  InitSerializedPageReader(num_rows * num_pages, Compression::UNCOMPRESSED, properties);
+
+  ASSERT_NE(page_reader_->NextPage(), nullptr);
+  page_reader_.reset();
+}
+
 TEST_F(TestPageSerde, LZONotSupported) {
   // Must await PARQUET-530
   int data_size = 1024;
@@ -20,6 +20,7 @@
 
 #include "arrow/testing/gtest_compat.h"
 #include "arrow/util/config.h"
+#include "arrow/util/key_value_metadata.h"
 
 #include "parquet/column_reader.h"
 #include "parquet/column_writer.h"
@@ -438,6 +439,177 @@ TEST(TestBufferedRowGroupWriter, MultiPageDisabledDictionary) {
   }
 }
 
+TEST(TestAppendRowGroupData, CopiedRowGroupsRoundtrip) {
+  constexpr int kNumRowGroups = 2;
+  constexpr int kValuesPerGroup = 100;
+  schema::NodeVector fields;
+  fields.push_back(
+      PrimitiveNode::Make("col", parquet::Repetition::REQUIRED, parquet::Type::INT32));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+  // Write a source file with two row groups.
+  auto src_sink = CreateOutputStream();
+  auto src_writer = ParquetFileWriter::Open(src_sink, schema);
+  for (int rg = 0; rg < kNumRowGroups; ++rg) {
+    auto rg_writer = src_writer->AppendRowGroup();
+    auto col_writer = static_cast<Int32Writer*>(rg_writer->NextColumn());
+    std::vector<int32_t> values(kValuesPerGroup);
+    std::iota(values.begin(), values.end(), rg * kValuesPerGroup);
+    col_writer->WriteBatch(kValuesPerGroup, nullptr, nullptr, values.data());
+    rg_writer->Close();
+  }
+  src_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto src_buffer, src_sink->Finish());
+  auto src_file = std::make_shared<::arrow::io::BufferReader>(src_buffer);
+  auto src_metadata = ParquetFileReader::Open(src_file)->metadata();
+
+  // Copy both row groups into a new file without decoding any pages.
+  auto dest_sink = CreateOutputStream();
+  auto dest_writer = ParquetFileWriter::Open(dest_sink, schema);
+  for (int rg = 0; rg < src_metadata->num_row_groups(); ++rg) {
+    dest_writer->AppendRowGroupData(*src_metadata->RowGroup(rg), src_file.get());
+  }
+  dest_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto dest_buffer, dest_sink->Finish());
+
+  auto dest_reader =
+      ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(dest_buffer));
+  auto dest_metadata = dest_reader->metadata();
+  ASSERT_EQ(kNumRowGroups, dest_metadata->num_row_groups());
+  ASSERT_EQ(kNumRowGroups * kValuesPerGroup, dest_metadata->num_rows());
+  for (int rg = 0; rg < kNumRowGroups; ++rg) {
+    auto rg_reader = dest_reader->RowGroup(rg);
+    ASSERT_EQ(kValuesPerGroup, rg_reader->metadata()->num_rows());
+    auto chunk = rg_reader->metadata()->ColumnChunk(0);
+    auto src_chunk = src_metadata->RowGroup(rg)->ColumnChunk(0);
+    ASSERT_TRUE(chunk->has_dictionary_page());
+    ASSERT_TRUE(chunk->is_stats_set());
+    ASSERT_EQ(src_chunk->total_compressed_size(), chunk->total_compressed_size());
+    ASSERT_EQ(src_chunk->encodings(), chunk->encodings());
+
+    auto col_reader = std::static_pointer_cast<Int32Reader>(rg_reader->Column(0));
+    std::vector<int32_t> values_out(kValuesPerGroup);
+    int64_t values_read = 0;
+    col_reader->ReadBatch(kValuesPerGroup, nullptr, nullptr, values_out.data(),
+                          &values_read);
+    ASSERT_EQ(kValuesPerGroup, values_read);
+    for (int i = 0; i < kValuesPerGroup; ++i) {
+      ASSERT_EQ(rg * kValuesPerGroup + i, values_out[i]);
+    }
+  }
+}
+
+TEST(TestColumnChunkAlignment, ChunksStartAtAlignedOffsets) {
+  constexpr int64_t kAlignment = 4096;
+  constexpr int kNumRows = 100;
+  schema::NodeVector fields;
+  fields.push_back(
+      PrimitiveNode::Make("a", parquet::Repetition::REQUIRED, parquet::Type::INT32));
+  fields.push_back(
+      PrimitiveNode::Make("b", parquet::Repetition::REQUIRED, parquet::Type::INT64));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+  auto writer_props =
+      WriterProperties::Builder().column_chunk_alignment(kAlignment)->build();
+
+  for (bool buffered : {false, true}) {
+    auto sink = CreateOutputStream();
+    auto file_writer = ParquetFileWriter::Open(sink, schema, writer_props);
+    std::vector<int32_t> a_values(kNumRows);
+    std::vector<int64_t> b_values(kNumRows);
+    std::iota(a_values.begin(), a_values.end(), 0);
+    std::iota(b_values.begin(), b_values.end(), 0);
+    for (int rg = 0; rg < 2; ++rg) {
+      auto rg_writer =
+          buffered ? file_writer->AppendBufferedRowGroup() : file_writer->AppendRowGroup();
+      auto a_writer = static_cast<Int32Writer*>(buffered ? rg_writer->column(0)
+                                                         : rg_writer->NextColumn());
+      a_writer->WriteBatch(kNumRows, nullptr, nullptr, a_values.data());
+      auto b_writer = static_cast<Int64Writer*>(buffered ? rg_writer->column(1)
+                                                         : rg_writer->NextColumn());
+      b_writer->WriteBatch(kNumRows, nullptr, nullptr, b_values.data());
+      rg_writer->Close();
+    }
+    file_writer->Close();
+    PARQUET_ASSIGN_OR_THROW(auto buffer, sink->Finish());
+
+    auto file_reader =
+        ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+    auto file_metadata = file_reader->metadata();
+    ASSERT_EQ(2, file_metadata->num_row_groups());
+    for (int rg = 0; rg < file_metadata->num_row_groups(); ++rg) {
+      for (int col = 0; col < file_metadata->num_columns(); ++col) {
+        auto chunk = file_metadata->RowGroup(rg)->ColumnChunk(col);
+        int64_t first_page_offset = chunk->data_page_offset();
+        if (chunk->has_dictionary_page()) {
+          first_page_offset =
+              std::min(first_page_offset, chunk->dictionary_page_offset());
+        }
+        ASSERT_EQ(0, first_page_offset % kAlignment)
+            << "row group " << rg << " column " << col
+            << " buffered=" << buffered;
+      }
+      // The padded file must still decode.
+      std::vector<int32_t> a_out(kNumRows);
+      int64_t values_read = 0;
+      auto a_reader = std::static_pointer_cast<Int32Reader>(
+          file_reader->RowGroup(rg)->Column(0));
+      a_reader->ReadBatch(kNumRows, nullptr, nullptr, a_out.data(), &values_read);
+      ASSERT_EQ(kNumRows, values_read);
+      ASSERT_EQ(a_values, a_out);
+    }
+    // The guarantee is advertised in the key-value metadata.
+    auto key_value_metadata = file_metadata->key_value_metadata();
+    ASSERT_NE(nullptr, key_value_metadata);
+    PARQUET_ASSIGN_OR_THROW(auto advertised,
+                            key_value_metadata->Get("parquet.column_chunk.alignment"));
+    ASSERT_EQ(std::to_string(kAlignment), advertised);
+  }
+
+  ASSERT_THROW(WriterProperties::Builder().column_chunk_alignment(1000),
+               ParquetException);
+}
+
+TEST(TestAppendRowGroupData, MismatchedFileFails) {
+  schema::NodeVector fields;
+  fields.push_back(
+      PrimitiveNode::Make("col", parquet::Repetition::REQUIRED, parquet::Type::INT32));
+  auto schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, fields));
+
+  auto src_sink = CreateOutputStream();
+  auto src_writer = ParquetFileWriter::Open(src_sink, schema);
+  auto rg_writer = src_writer->AppendRowGroup();
+  auto col_writer = static_cast<Int32Writer*>(rg_writer->NextColumn());
+  int32_t value = 42;
+  col_writer->WriteBatch(1, nullptr, nullptr, &value);
+  rg_writer->Close();
+  src_writer->Close();
+  PARQUET_ASSIGN_OR_THROW(auto src_buffer, src_sink->Finish());
+  auto src_file = std::make_shared<::arrow::io::BufferReader>(src_buffer);
+  auto src_metadata = ParquetFileReader::Open(src_file)->metadata();
+
+  // The destination compresses with gzip while the source is uncompressed.
+  auto gzip_writer = ParquetFileWriter::Open(
+      CreateOutputStream(), schema,
+      WriterProperties::Builder().compression(Compression::GZIP)->build());
+  EXPECT_THROW(gzip_writer->AppendRowGroupData(*src_metadata->RowGroup(0),
+                                               src_file.get()),
+               ParquetException);
+
+  // The destination schema names a different column.
+  schema::NodeVector other_fields;
+  other_fields.push_back(
+      PrimitiveNode::Make("other", parquet::Repetition::REQUIRED, parquet::Type::INT32));
+  auto other_schema = std::static_pointer_cast<GroupNode>(
+      GroupNode::Make("schema", Repetition::REQUIRED, other_fields));
+  auto other_writer = ParquetFileWriter::Open(CreateOutputStream(), other_schema);
+  EXPECT_THROW(other_writer->AppendRowGroupData(*src_metadata->RowGroup(0),
+                                                src_file.get()),
+               ParquetException);
+}
+
 TEST(ParquetRoundtrip, AllNulls) {
   auto primitive_node =
       PrimitiveNode::Make("nulls", Repetition::OPTIONAL, nullptr, Type::INT32);
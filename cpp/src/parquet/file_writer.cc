@@ -17,14 +17,19 @@
 
 #include "parquet/file_writer.h"
 
+#include <algorithm>
+#include <map>
 #include <memory>
 #include <ostream>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "arrow/util/bit_util.h"
 #include "arrow/util/key_value_metadata.h"
 #include "arrow/util/logging_internal.h"
+#include "parquet/bloom_filter_builder.h"
 #include "parquet/column_writer.h"
 #include "parquet/encryption/encryption_internal.h"
 #include "parquet/encryption/internal_file_encryptor.h"
@@ -32,6 +37,7 @@
 #include "parquet/page_index.h"
 #include "parquet/platform.h"
 #include "parquet/schema.h"
+#include "parquet/statistics.h"
 
 using arrow::MemoryPool;
 
@@ -69,6 +75,14 @@ int64_t RowGroupWriter::total_compressed_bytes_written() const {
 
 bool RowGroupWriter::buffered() const { return contents_->buffered(); }
 
+bool RowGroupWriter::dictionary_fallback_imminent() const {
+  return contents_->dictionary_fallback_imminent();
+}
+
+int64_t RowGroupWriter::estimated_decoded_bytes() const {
+  return contents_->estimated_decoded_bytes();
+}
+
 int RowGroupWriter::current_column() { return contents_->current_column(); }
 
 int RowGroupWriter::num_columns() const { return contents_->num_columns(); }
@@ -91,7 +105,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
                      RowGroupMetaDataBuilder* metadata, int16_t row_group_ordinal,
                      const WriterProperties* properties, bool buffered_row_group = false,
                      InternalFileEncryptor* file_encryptor = nullptr,
-                     PageIndexBuilder* page_index_builder = nullptr)
+                     PageIndexBuilder* page_index_builder = nullptr,
+                     BloomFilterBuilder* bloom_filter_builder = nullptr)
       : sink_(std::move(sink)),
         metadata_(metadata),
         properties_(properties),
@@ -103,7 +118,8 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         num_rows_(0),
         buffered_row_group_(buffered_row_group),
         file_encryptor_(file_encryptor),
-        page_index_builder_(page_index_builder) {
+        page_index_builder_(page_index_builder),
+        bloom_filter_builder_(bloom_filter_builder) {
     if (buffered_row_group) {
       InitColumns();
     } else {
@@ -137,6 +153,7 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
       total_compressed_bytes_written_ +=
           column_writers_[0]->total_compressed_bytes_written();
     }
+    MaybePadForChunkAlignment();
 
     const int32_t column_ordinal = next_column_index_++;
     column_writers_[0] = CreateColumnWriterForColumn(col_meta, column_ordinal);
@@ -196,6 +213,25 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
 
   bool buffered() const override { return buffered_row_group_; }
 
+  bool dictionary_fallback_imminent() const override {
+    for (size_t i = 0; i < column_writers_.size(); i++) {
+      if (column_writers_[i] && column_writers_[i]->dictionary_fallback_imminent()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  int64_t estimated_decoded_bytes() const override {
+    int64_t total_bytes = 0;
+    for (size_t i = 0; i < column_writers_.size(); i++) {
+      if (column_writers_[i]) {
+        total_bytes += column_writers_[i]->estimated_decoded_bytes();
+      }
+    }
+    return total_bytes;
+  }
+
   void Close() override {
     if (!closed_) {
       closed_ = true;
@@ -205,6 +241,11 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
       auto column_writers = std::move(column_writers_);
       for (size_t i = 0; i < column_writers.size(); i++) {
         if (column_writers[i]) {
+          if (buffered_row_group_) {
+            // Buffered chunks reach the sink when their writer closes, so this
+            // is the last point where the chunk start can still be aligned.
+            MaybePadForChunkAlignment();
+          }
           total_bytes_written_ += column_writers[i]->Close();
           total_compressed_bytes_written_ +=
               column_writers[i]->total_compressed_bytes_written();
@@ -230,6 +271,23 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
   bool buffered_row_group_;
   InternalFileEncryptor* file_encryptor_;
   PageIndexBuilder* page_index_builder_;
+  BloomFilterBuilder* bloom_filter_builder_;
+
+  // Pad the sink with zeros so the next column chunk starts at the file-offset
+  // alignment requested in the writer properties. Readers locate chunks
+  // through the metadata offsets, so the padding bytes are never interpreted.
+  void MaybePadForChunkAlignment() {
+    const int64_t alignment = properties_->column_chunk_alignment();
+    if (alignment <= 0) {
+      return;
+    }
+    PARQUET_ASSIGN_OR_THROW(int64_t position, sink_->Tell());
+    const int64_t padding = ::arrow::bit_util::RoundUp(position, alignment) - position;
+    if (padding > 0) {
+      const std::vector<uint8_t> zeros(static_cast<size_t>(padding), 0);
+      PARQUET_THROW_NOT_OK(sink_->Write(zeros.data(), padding));
+    }
+  }
 
   void CheckRowsWritten() const {
     // verify when only one column is written at a time
@@ -293,7 +351,12 @@ class RowGroupSerializer : public RowGroupWriter::Contents {
         static_cast<int16_t>(column_ordinal), properties_->memory_pool(),
         buffered_row_group_, meta_encryptor, data_encryptor,
         properties_->page_checksum_enabled(), ci_builder, oi_builder, *codec_options);
-    return ColumnWriter::Make(col_meta, std::move(pager), properties_);
+    auto bloom_filter_builder = bloom_filter_builder_ &&
+                                        column_properties.bloom_filter_enabled()
+                                    ? bloom_filter_builder_
+                                    : nullptr;
+    return ColumnWriter::Make(col_meta, std::move(pager), properties_,
+                              bloom_filter_builder, column_ordinal);
   }
 
   // If buffered_row_group_ is false, only column_writers_[0] is used as current writer.
@@ -331,6 +394,14 @@ class FileSerializer : public ParquetFileWriter::Contents {
       }
       row_group_writer_.reset();
 
+      if (properties_->column_chunk_alignment() > 0) {
+        // Advertise the layout guarantee so aligned consumers can detect it.
+        AddKeyValueMetadata(KeyValueMetadata::Make(
+            {"parquet.column_chunk.alignment"},
+            {std::to_string(properties_->column_chunk_alignment())}));
+      }
+
+      WriteBloomFilters();
       WritePageIndex();
 
       // Write magic bytes and metadata
@@ -375,9 +446,12 @@ class FileSerializer : public ParquetFileWriter::Contents {
     if (page_index_builder_) {
       page_index_builder_->AppendRowGroup();
     }
+    if (bloom_filter_builder_) {
+      bloom_filter_builder_->AppendRowGroup();
+    }
     std::unique_ptr<RowGroupWriter::Contents> contents(new RowGroupSerializer(
         sink_, rg_metadata, row_group_ordinal, properties_.get(), buffered_row_group,
-        file_encryptor_.get(), page_index_builder_.get()));
+        file_encryptor_.get(), page_index_builder_.get(), bloom_filter_builder_.get()));
     row_group_writer_ = std::make_unique<RowGroupWriter>(std::move(contents));
     return row_group_writer_.get();
   }
@@ -386,6 +460,104 @@ class FileSerializer : public ParquetFileWriter::Contents {
 
   RowGroupWriter* AppendBufferedRowGroup() override { return AppendRowGroup(true); }
 
+  void AppendRowGroupData(const RowGroupMetaData& row_group,
+                          ArrowInputFile* source) override {
+    if (!is_open_) {
+      throw ParquetException("Cannot append a row group to closed file");
+    }
+    if (properties_->file_encryption_properties() != nullptr) {
+      throw ParquetException("Cannot copy row group data into an encrypted file");
+    }
+    std::stringstream diff;
+    if (!schema_.Equals(*row_group.schema(), &diff)) {
+      throw ParquetException("Cannot copy row group with a different schema: " +
+                             diff.str());
+    }
+    if (row_group_writer_) {
+      row_group_writer_->Close();
+      row_group_writer_.reset();
+    }
+    num_row_groups_++;
+    auto rg_metadata = metadata_->AppendRowGroup();
+    if (page_index_builder_) {
+      // Keep row group ordinals aligned. Copied row groups carry no page index.
+      page_index_builder_->AppendRowGroup();
+    }
+    if (bloom_filter_builder_) {
+      // Same for bloom filters: they are not carried over from the source.
+      bloom_filter_builder_->AppendRowGroup();
+    }
+
+    int64_t total_uncompressed_size = 0;
+    for (int i = 0; i < row_group.num_columns(); ++i) {
+      auto src_chunk = row_group.ColumnChunk(i);
+      if (src_chunk->crypto_metadata() != nullptr) {
+        throw ParquetException("Cannot copy encrypted column chunk data");
+      }
+      auto col_metadata = rg_metadata->NextColumnChunk();
+      if (src_chunk->compression() !=
+          properties_->compression(col_metadata->descr()->path())) {
+        std::stringstream ss;
+        ss << "Cannot copy column chunk '" << col_metadata->descr()->path()->ToDotString()
+           << "': source compression does not match the writer properties";
+        throw ParquetException(ss.str());
+      }
+
+      const bool has_dictionary = src_chunk->has_dictionary_page();
+      int64_t src_offset = src_chunk->data_page_offset();
+      if (has_dictionary) {
+        src_offset = std::min(src_offset, src_chunk->dictionary_page_offset());
+      }
+      const int64_t chunk_length = src_chunk->total_compressed_size();
+      PARQUET_ASSIGN_OR_THROW(int64_t dest_offset, sink_->Tell());
+      PARQUET_ASSIGN_OR_THROW(auto chunk_data, source->ReadAt(src_offset, chunk_length));
+      if (chunk_data->size() != chunk_length) {
+        throw ParquetException("Unexpected end of file while copying column chunk data");
+      }
+      PARQUET_THROW_NOT_OK(sink_->Write(chunk_data));
+      const int64_t shift = dest_offset - src_offset;
+
+      if (src_chunk->is_stats_set()) {
+        col_metadata->SetStatistics(src_chunk->statistics()->Encode());
+      }
+      if (auto size_stats = src_chunk->size_statistics()) {
+        col_metadata->SetSizeStatistics(*size_stats);
+      }
+      std::map<Encoding::type, int32_t> dict_encoding_stats;
+      std::map<Encoding::type, int32_t> data_encoding_stats;
+      for (const auto& page_stats : src_chunk->encoding_stats()) {
+        if (page_stats.page_type == PageType::DICTIONARY_PAGE) {
+          dict_encoding_stats[page_stats.encoding] += page_stats.count;
+        } else {
+          data_encoding_stats[page_stats.encoding] += page_stats.count;
+        }
+      }
+      // A dictionary-encoded chunk that also holds data pages with a
+      // non-dictionary encoding fell back to plain encoding when it was first
+      // written.
+      bool dictionary_fallback = false;
+      if (has_dictionary) {
+        for (const auto& entry : data_encoding_stats) {
+          if (entry.first != Encoding::RLE_DICTIONARY &&
+              entry.first != Encoding::PLAIN_DICTIONARY) {
+            dictionary_fallback = true;
+          }
+        }
+      }
+      col_metadata->Finish(
+          src_chunk->num_values(),
+          has_dictionary ? src_chunk->dictionary_page_offset() + shift : -1,
+          /*index_page_offset=*/-1, src_chunk->data_page_offset() + shift, chunk_length,
+          src_chunk->total_uncompressed_size(), has_dictionary, dictionary_fallback,
+          dict_encoding_stats, data_encoding_stats);
+      total_uncompressed_size += src_chunk->total_uncompressed_size();
+    }
+
+    rg_metadata->set_num_rows(row_group.num_rows());
+    rg_metadata->Finish(total_uncompressed_size);
+    num_rows_ += row_group.num_rows();
+  }
+
   void AddKeyValueMetadata(
       const std::shared_ptr<const KeyValueMetadata>& key_value_metadata) override {
     if (key_value_metadata_ == nullptr) {
@@ -450,6 +622,16 @@ class FileSerializer : public ParquetFileWriter::Contents {
     }
   }
 
+  void WriteBloomFilters() {
+    if (bloom_filter_builder_ != nullptr) {
+      // Serialize the bloom filters after all row groups have been written
+      // and record their locations in the file metadata.
+      BloomFilterLocation bloom_filter_location;
+      bloom_filter_builder_->WriteTo(sink_.get(), &bloom_filter_location);
+      metadata_->SetBloomFilterLocation(bloom_filter_location);
+    }
+  }
+
   void WritePageIndex() {
     if (page_index_builder_ != nullptr) {
       // Serialize page index after all row groups have been written and report
@@ -470,6 +652,7 @@ class FileSerializer : public ParquetFileWriter::Contents {
   // Only one of the row group writers is active at a time
   std::unique_ptr<RowGroupWriter> row_group_writer_;
   std::unique_ptr<PageIndexBuilder> page_index_builder_;
+  std::unique_ptr<BloomFilterBuilder> bloom_filter_builder_;
   std::unique_ptr<InternalFileEncryptor> file_encryptor_;
 
   void StartFile() {
@@ -512,6 +695,13 @@ class FileSerializer : public ParquetFileWriter::Contents {
     if (properties_->page_index_enabled()) {
       page_index_builder_ = PageIndexBuilder::Make(&schema_, file_encryptor_.get());
     }
+
+    if (properties_->bloom_filter_enabled()) {
+      if (file_encryptor_ != nullptr) {
+        throw ParquetException("Bloom filters are not supported in encrypted files");
+      }
+      bloom_filter_builder_ = BloomFilterBuilder::Make(&schema_);
+    }
   }
 };
 
@@ -629,6 +819,15 @@ RowGroupWriter* ParquetFileWriter::AppendBufferedRowGroup() {
   return contents_->AppendBufferedRowGroup();
 }
 
+void ParquetFileWriter::AppendRowGroupData(const RowGroupMetaData& row_group,
+                                           ArrowInputFile* source) {
+  if (contents_) {
+    contents_->AppendRowGroupData(row_group, source);
+  } else {
+    throw ParquetException("Cannot append row group data to closed file");
+  }
+}
+
 void ParquetFileWriter::AddKeyValueMetadata(
     const std::shared_ptr<const KeyValueMetadata>& key_value_metadata) {
   if (contents_) {
@@ -60,6 +60,14 @@ class PARQUET_EXPORT RowGroupWriter {
     virtual int64_t total_compressed_bytes_written() const = 0;
 
     virtual bool buffered() const = 0;
+
+    /// \brief Whether any column's dictionary page is nearly full or has
+    /// already fallen back to plain encoding.
+    virtual bool dictionary_fallback_imminent() const { return false; }
+
+    /// \brief Predicted in-memory size of the row group once decoded, summed
+    /// over all column chunks.
+    virtual int64_t estimated_decoded_bytes() const { return 0; }
   };
 
   explicit RowGroupWriter(std::unique_ptr<Contents> contents);
@@ -104,6 +112,18 @@ class PARQUET_EXPORT RowGroupWriter {
   /// by calling ParquetFileWriter::AppendBufferedRowGroup.
   bool buffered() const;
 
+  /// Returns whether any column's dictionary page is nearly full or has already
+  /// fallen back to plain encoding. Callers that rotate row groups on this
+  /// signal give every column a fresh dictionary instead of plain-encoded
+  /// pages for the remainder of the chunk.
+  bool dictionary_fallback_imminent() const;
+
+  /// Returns the predicted in-memory size of the row group once decoded to
+  /// Arrow memory, summed over all column chunks. Callers can use this to
+  /// close row groups before readers would need oversized buffers to
+  /// materialize them.
+  int64_t estimated_decoded_bytes() const;
+
  private:
   // Holds a pointer to an instance of Contents implementation
   std::unique_ptr<Contents> contents_;
@@ -150,6 +170,9 @@ class PARQUET_EXPORT ParquetFileWriter {
     virtual RowGroupWriter* AppendRowGroup() = 0;
     virtual RowGroupWriter* AppendBufferedRowGroup() = 0;
 
+    virtual void AppendRowGroupData(const RowGroupMetaData& row_group,
+                                    ArrowInputFile* source) = 0;
+
     virtual int64_t num_rows() const = 0;
     virtual int num_columns() const = 0;
     virtual int num_row_groups() const = 0;
@@ -200,6 +223,27 @@ class PARQUET_EXPORT ParquetFileWriter {
   /// until the next call to AppendRowGroup or AppendBufferedRowGroup or Close.
   RowGroupWriter* AppendBufferedRowGroup();
 
+  /// \brief Copy a complete row group from another file without decoding it.
+  ///
+  /// The compressed page data of every column chunk described by \c row_group
+  /// is copied verbatim from \c source and the chunk metadata is rebuilt with
+  /// the offsets adjusted to their new location, so no pages are decompressed,
+  /// decoded or re-encoded. Rewrite jobs that keep most columns untouched can
+  /// combine this with the regular write path (which transcodes) for the
+  /// columns they do change.
+  ///
+  /// The source row group must have the same schema as this writer and its
+  /// column chunks must use the compression configured in the writer
+  /// properties, so that the copied metadata stays truthful. Page indexes and
+  /// bloom filters are not carried over. Not supported on encrypted files.
+  ///
+  /// \param[in] row_group metadata of the row group to copy, obtained from the
+  ///   source file's FileMetaData.
+  /// \param[in] source the file the row group metadata refers to.
+  /// \throw ParquetException if the schemas or compression do not match, or if
+  ///   either file uses encryption.
+  void AppendRowGroupData(const RowGroupMetaData& row_group, ArrowInputFile* source);
+
   /// \brief Add key-value metadata to the file.
   /// \param[in] key_value_metadata the metadata to add.
   /// \note This will overwrite any existing metadata with the same key(s).
@@ -2008,6 +2008,24 @@ class FileMetaDataBuilder::FileMetaDataBuilderImpl {
     }
   }
 
+  void SetBloomFilterLocation(const BloomFilterLocation& location) {
+    for (const auto& [row_group_ordinal, row_group_location] :
+         location.bloom_filter_location) {
+      auto& row_group_metadata = this->row_groups_.at(row_group_ordinal);
+      for (size_t i = 0; i < row_group_location.size(); ++i) {
+        if (i >= row_group_metadata.columns.size()) {
+          throw ParquetException("Cannot find metadata for column ordinal ", i);
+        }
+        const auto& filter_location = row_group_location.at(i);
+        if (filter_location.has_value()) {
+          auto& column_metadata = row_group_metadata.columns.at(i).meta_data;
+          column_metadata.__set_bloom_filter_offset(filter_location->offset);
+          column_metadata.__set_bloom_filter_length(filter_location->length);
+        }
+      }
+    }
+  }
+
   std::unique_ptr<FileMetaData> Finish(
       const std::shared_ptr<const KeyValueMetadata>& key_value_metadata) {
     int64_t total_rows = 0;
@@ -2126,6 +2144,10 @@ void FileMetaDataBuilder::SetPageIndexLocation(const PageIndexLocation& location
   impl_->SetPageIndexLocation(location);
 }
 
+void FileMetaDataBuilder::SetBloomFilterLocation(const BloomFilterLocation& location) {
+  impl_->SetBloomFilterLocation(location);
+}
+
 std::unique_ptr<FileMetaData> FileMetaDataBuilder::Finish(
     const std::shared_ptr<const KeyValueMetadata>& key_value_metadata) {
   return impl_->Finish(key_value_metadata);
@@ -504,6 +504,16 @@ class PARQUET_EXPORT RowGroupMetaDataBuilder {
   std::unique_ptr<RowGroupMetaDataBuilderImpl> impl_;
 };
 
+/// \brief Public struct for location to all bloom filters in a parquet file.
+struct BloomFilterLocation {
+  /// Alias type of bloom filter location of a row group. The filter location
+  /// is located by column ordinal. If the column does not have a bloom filter,
+  /// its value is set to std::nullopt.
+  using RowGroupBloomFilterLocation = std::vector<std::optional<IndexLocation>>;
+  /// Bloom filter locations which use row group ordinal as the key.
+  std::map<size_t, RowGroupBloomFilterLocation> bloom_filter_location;
+};
+
 /// \brief Public struct for location to all page indexes in a parquet file.
 struct PageIndexLocation {
   /// Alias type of page index location of a row group. The index location
@@ -533,6 +543,9 @@ class PARQUET_EXPORT FileMetaDataBuilder {
   // Update location to all page indexes in the parquet file
   void SetPageIndexLocation(const PageIndexLocation& location);
 
+  // Update location to all bloom filters in the parquet file
+  void SetBloomFilterLocation(const BloomFilterLocation& location);
+
   // Complete the Thrift structure
   std::unique_ptr<FileMetaData> Finish(
       const std::shared_ptr<const KeyValueMetadata>& key_value_metadata = NULLPTR);
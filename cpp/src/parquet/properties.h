@@ -139,6 +139,15 @@ class PARQUET_EXPORT ReaderProperties {
   void set_footer_read_size(size_t size) { footer_read_size_ = size; }
   size_t footer_read_size() const { return footer_read_size_; }
 
+  /// \brief Return the number of pages a page reader may read and decompress
+  /// ahead of its consumer (0 means pipelining is disabled).
+  int32_t page_prefetch_depth() const { return page_prefetch_depth_; }
+  /// Let each page reader read and decompress up to `depth` pages ahead of
+  /// its consumer on a dedicated thread, overlapping page I/O and
+  /// decompression with decoding. Disabled (0) by default.
+  /// \note API EXPERIMENTAL
+  void set_page_prefetch_depth(int32_t depth) { page_prefetch_depth_ = depth; }
+
  private:
   MemoryPool* pool_;
   int64_t buffer_size_ = kDefaultBufferSize;
@@ -149,6 +158,7 @@ class PARQUET_EXPORT ReaderProperties {
   // Used with a RecordReader.
   bool read_dense_for_nullable_ = false;
   size_t footer_read_size_ = kDefaultFooterReadSize;
+  int32_t page_prefetch_depth_ = 0;
   std::shared_ptr<FileDecryptionProperties> file_decryption_properties_;
 };
 
@@ -159,12 +169,21 @@ static constexpr bool DEFAULT_IS_DICTIONARY_ENABLED = true;
 static constexpr int64_t DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT = kDefaultDataPageSize;
 static constexpr int64_t DEFAULT_WRITE_BATCH_SIZE = 1024;
 static constexpr int64_t DEFAULT_MAX_ROW_GROUP_LENGTH = 1024 * 1024;
+static constexpr int64_t DEFAULT_MAX_ROW_GROUP_DECODED_BYTES = 0;
+static constexpr int64_t DEFAULT_ROW_GROUP_ROW_ALIGNMENT = 1;
+static constexpr int64_t DEFAULT_COLUMN_CHUNK_ALIGNMENT = 0;
 static constexpr bool DEFAULT_ARE_STATISTICS_ENABLED = true;
 static constexpr int64_t DEFAULT_MAX_STATISTICS_SIZE = 4096;
 static constexpr Encoding::type DEFAULT_ENCODING = Encoding::UNKNOWN;
 static const char DEFAULT_CREATED_BY[] = CREATED_BY_VERSION;
 static constexpr Compression::type DEFAULT_COMPRESSION_TYPE = Compression::UNCOMPRESSED;
 static constexpr bool DEFAULT_IS_PAGE_INDEX_ENABLED = true;
+static constexpr bool DEFAULT_IS_ADAPTIVE_ENCODING_ENABLED = false;
+static constexpr bool DEFAULT_IS_BLOOM_FILTER_ENABLED = false;
+static constexpr double DEFAULT_BLOOM_FILTER_FPP = 0.01;
+static constexpr bool DEFAULT_IS_CONTENT_DEFINED_CHUNKING_ENABLED = false;
+static constexpr int64_t DEFAULT_CDC_MIN_CHUNK_SIZE = 256 * 1024;
+static constexpr int64_t DEFAULT_CDC_MAX_CHUNK_SIZE = 1024 * 1024;
 static constexpr SizeStatisticsLevel DEFAULT_SIZE_STATISTICS_LEVEL =
     SizeStatisticsLevel::PageAndColumnChunk;
 
@@ -175,13 +194,17 @@ class PARQUET_EXPORT ColumnProperties {
                    bool dictionary_enabled = DEFAULT_IS_DICTIONARY_ENABLED,
                    bool statistics_enabled = DEFAULT_ARE_STATISTICS_ENABLED,
                    size_t max_stats_size = DEFAULT_MAX_STATISTICS_SIZE,
-                   bool page_index_enabled = DEFAULT_IS_PAGE_INDEX_ENABLED)
+                   bool page_index_enabled = DEFAULT_IS_PAGE_INDEX_ENABLED,
+                   bool adaptive_encoding_enabled = DEFAULT_IS_ADAPTIVE_ENCODING_ENABLED,
+                   bool bloom_filter_enabled = DEFAULT_IS_BLOOM_FILTER_ENABLED)
       : encoding_(encoding),
         codec_(codec),
         dictionary_enabled_(dictionary_enabled),
         statistics_enabled_(statistics_enabled),
         max_stats_size_(max_stats_size),
-        page_index_enabled_(page_index_enabled) {}
+        page_index_enabled_(page_index_enabled),
+        adaptive_encoding_enabled_(adaptive_encoding_enabled),
+        bloom_filter_enabled_(bloom_filter_enabled) {}
 
   void set_encoding(Encoding::type encoding) { encoding_ = encoding; }
 
@@ -214,6 +237,14 @@ class PARQUET_EXPORT ColumnProperties {
     page_index_enabled_ = page_index_enabled;
   }
 
+  void set_adaptive_encoding_enabled(bool adaptive_encoding_enabled) {
+    adaptive_encoding_enabled_ = adaptive_encoding_enabled;
+  }
+
+  void set_bloom_filter_enabled(bool bloom_filter_enabled) {
+    bloom_filter_enabled_ = bloom_filter_enabled;
+  }
+
   Encoding::type encoding() const { return encoding_; }
 
   Compression::type compression() const { return codec_; }
@@ -235,6 +266,10 @@ class PARQUET_EXPORT ColumnProperties {
 
   bool page_index_enabled() const { return page_index_enabled_; }
 
+  bool adaptive_encoding_enabled() const { return adaptive_encoding_enabled_; }
+
+  bool bloom_filter_enabled() const { return bloom_filter_enabled_; }
+
  private:
   Encoding::type encoding_;
   Compression::type codec_;
@@ -243,6 +278,8 @@ class PARQUET_EXPORT ColumnProperties {
   size_t max_stats_size_;
   std::shared_ptr<CodecOptions> codec_options_;
   bool page_index_enabled_;
+  bool adaptive_encoding_enabled_;
+  bool bloom_filter_enabled_;
 };
 
 class PARQUET_EXPORT WriterProperties {
@@ -254,19 +291,30 @@ class PARQUET_EXPORT WriterProperties {
           dictionary_pagesize_limit_(DEFAULT_DICTIONARY_PAGE_SIZE_LIMIT),
           write_batch_size_(DEFAULT_WRITE_BATCH_SIZE),
           max_row_group_length_(DEFAULT_MAX_ROW_GROUP_LENGTH),
+          max_row_group_decoded_bytes_(DEFAULT_MAX_ROW_GROUP_DECODED_BYTES),
+          row_group_row_alignment_(DEFAULT_ROW_GROUP_ROW_ALIGNMENT),
+          column_chunk_alignment_(DEFAULT_COLUMN_CHUNK_ALIGNMENT),
           pagesize_(kDefaultDataPageSize),
           version_(ParquetVersion::PARQUET_2_6),
           data_page_version_(ParquetDataPageVersion::V1),
           created_by_(DEFAULT_CREATED_BY),
           store_decimal_as_integer_(false),
           page_checksum_enabled_(false),
-          size_statistics_level_(DEFAULT_SIZE_STATISTICS_LEVEL) {}
+          size_statistics_level_(DEFAULT_SIZE_STATISTICS_LEVEL),
+          dictionary_fallback_split_enabled_(false),
+          content_defined_chunking_enabled_(DEFAULT_IS_CONTENT_DEFINED_CHUNKING_ENABLED),
+          cdc_min_chunk_size_(DEFAULT_CDC_MIN_CHUNK_SIZE),
+          cdc_max_chunk_size_(DEFAULT_CDC_MAX_CHUNK_SIZE),
+          bloom_filter_fpp_(DEFAULT_BLOOM_FILTER_FPP) {}
 
     explicit Builder(const WriterProperties& properties)
         : pool_(properties.memory_pool()),
           dictionary_pagesize_limit_(properties.dictionary_pagesize_limit()),
           write_batch_size_(properties.write_batch_size()),
           max_row_group_length_(properties.max_row_group_length()),
+          max_row_group_decoded_bytes_(properties.max_row_group_decoded_bytes()),
+          row_group_row_alignment_(properties.row_group_row_alignment()),
+          column_chunk_alignment_(properties.column_chunk_alignment()),
           pagesize_(properties.data_pagesize()),
           version_(properties.version()),
           data_page_version_(properties.data_page_version()),
@@ -274,6 +322,13 @@ class PARQUET_EXPORT WriterProperties {
           store_decimal_as_integer_(properties.store_decimal_as_integer()),
           page_checksum_enabled_(properties.page_checksum_enabled()),
           size_statistics_level_(properties.size_statistics_level()),
+          dictionary_fallback_split_enabled_(
+              properties.dictionary_fallback_split_enabled()),
+          content_defined_chunking_enabled_(
+              properties.content_defined_chunking_enabled()),
+          cdc_min_chunk_size_(properties.cdc_min_chunk_size()),
+          cdc_max_chunk_size_(properties.cdc_max_chunk_size()),
+          bloom_filter_fpp_(properties.bloom_filter_fpp()),
           sorting_columns_(properties.sorting_columns()),
           default_column_properties_(properties.default_column_properties()) {}
 
@@ -325,6 +380,31 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_dictionary(path->ToDotString());
     }
 
+    /// \brief Enable closing the current row group early when a column's
+    /// dictionary approaches the dictionary page size limit, instead of
+    /// letting the column fall back to PLAIN for the rest of the chunk.
+    /// Default disabled.
+    ///
+    /// A dictionary fallback loses the dictionary for all subsequent values
+    /// of the chunk, which bloats files badly on skewed data. With this
+    /// option, writers that buffer row groups (such as the Arrow
+    /// FileWriter::WriteRecordBatch path) start a new row group - giving
+    /// every column a fresh dictionary - as soon as any column reports that
+    /// its dictionary page is nearly full or has already fallen back. The
+    /// check runs between record batches, so the split granularity follows
+    /// the batch size fed to the writer.
+    Builder* enable_dictionary_fallback_split() {
+      dictionary_fallback_split_enabled_ = true;
+      return this;
+    }
+
+    /// Disable early row group splits on imminent dictionary fallback.
+    /// Default disabled.
+    Builder* disable_dictionary_fallback_split() {
+      dictionary_fallback_split_enabled_ = false;
+      return this;
+    }
+
     /// Specify the dictionary page size limit per row group. Default 1MB.
     Builder* dictionary_pagesize_limit(int64_t dictionary_psize_limit) {
       dictionary_pagesize_limit_ = dictionary_psize_limit;
@@ -345,6 +425,53 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// Specify the maximum predicted in-memory decoded size of a row group in
+    /// bytes. Default 0 (disabled).
+    ///
+    /// When set, writers that buffer row groups (e.g. the Arrow
+    /// FileWriter::WriteRecordBatch path) close the current row group once the
+    /// estimated decoded size of its column chunks - raw value bytes plus
+    /// offsets and validity - reaches this limit, in addition to the row-count
+    /// limit. This bounds the memory a reader needs to materialize any one row
+    /// group regardless of how well the data compresses. The check runs at
+    /// write-batch granularity, so the limit can be exceeded by up to one
+    /// batch worth of data.
+    Builder* max_row_group_decoded_bytes(int64_t max_decoded_bytes) {
+      max_row_group_decoded_bytes_ = max_decoded_bytes;
+      return this;
+    }
+
+    /// Specify the row alignment of early row group splits. Default 1
+    /// (no alignment).
+    ///
+    /// When greater than one, row groups closed before the row-count limit
+    /// (because of the decoded-size limit or dictionary fallback splits) end
+    /// on a multiple of this many rows, which keeps row group boundaries
+    /// predictable for readers that parallelize scans on fixed row ranges.
+    Builder* row_group_row_alignment(int64_t row_alignment) {
+      row_group_row_alignment_ = row_alignment;
+      return this;
+    }
+
+    /// Specify the file-offset alignment of column chunks. Default 0
+    /// (disabled).
+    ///
+    /// When set to a power of two, the sink is padded with zeros before each
+    /// column chunk so that the chunk's first page starts at a multiple of
+    /// this many bytes. Consumers that map or DMA whole column chunks (e.g.
+    /// GPU readers) can then transfer them without a staging copy. The
+    /// guarantee is recorded in the "parquet.column_chunk.alignment" key-value
+    /// metadata entry. Readers locate column chunks through the file metadata,
+    /// so padded files stay valid Parquet.
+    Builder* column_chunk_alignment(int64_t alignment) {
+      if (alignment < 0 || (alignment & (alignment - 1)) != 0) {
+        throw ParquetException("Column chunk alignment must be a power of two, got " +
+                               std::to_string(alignment));
+      }
+      column_chunk_alignment_ = alignment;
+      return this;
+    }
+
     /// Specify the data page size.
     /// Default 1MB.
     Builder* data_pagesize(int64_t pg_size) {
@@ -663,6 +790,109 @@ class PARQUET_EXPORT WriterProperties {
       return this->disable_write_page_index(path->ToDotString());
     }
 
+    /// \brief Enable writing bloom filters in general for all columns.
+    /// Default disabled.
+    ///
+    /// The writer hashes column values in batches as they are written and
+    /// serializes one bloom filter per column chunk before the footer. The
+    /// filter is sized from the exact number of distinct hashes seen in the
+    /// chunk and the configured false positive probability, so small or
+    /// repetitive chunks get small filters.
+    Builder* enable_bloom_filter() {
+      default_column_properties_.set_bloom_filter_enabled(true);
+      return this;
+    }
+
+    /// Disable writing bloom filters in general for all columns. Default disabled.
+    Builder* disable_bloom_filter() {
+      default_column_properties_.set_bloom_filter_enabled(false);
+      return this;
+    }
+
+    /// Enable writing a bloom filter for the column specified by `path`.
+    /// Default disabled.
+    Builder* enable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = true;
+      return this;
+    }
+
+    /// Enable writing a bloom filter for the column specified by `path`.
+    /// Default disabled.
+    Builder* enable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_bloom_filter(path->ToDotString());
+    }
+
+    /// Disable writing a bloom filter for the column specified by `path`.
+    Builder* disable_bloom_filter(const std::string& path) {
+      bloom_filter_enabled_[path] = false;
+      return this;
+    }
+
+    /// Disable writing a bloom filter for the column specified by `path`.
+    Builder* disable_bloom_filter(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_bloom_filter(path->ToDotString());
+    }
+
+    /// Specify the false positive probability used to size bloom filters.
+    /// Default 0.01.
+    Builder* bloom_filter_fpp(double fpp) {
+      if (!(fpp > 0.0 && fpp < 1.0)) {
+        throw ParquetException("Bloom filter false positive probability must be in " +
+                               std::string("(0, 1), got ") + std::to_string(fpp));
+      }
+      bloom_filter_fpp_ = fpp;
+      return this;
+    }
+
+    /// \brief Enable adaptive encoding selection in general for all columns.
+    /// Default disabled.
+    ///
+    /// When enabled, the writer trial-encodes a sample of the first values
+    /// written to each column chunk with the candidate encodings for the
+    /// column's physical type and picks the one producing the smallest
+    /// output, with a bias towards encodings that are cheaper to decode.
+    /// The decision is recorded in the column chunk's encoding list as
+    /// usual. Takes precedence over `encoding()` for the affected columns;
+    /// dictionary encoding, when enabled, is still tried first and the
+    /// adaptive choice applies to the dictionary fallback encoding.
+    Builder* enable_adaptive_encoding() {
+      default_column_properties_.set_adaptive_encoding_enabled(true);
+      return this;
+    }
+
+    /// \brief Disable adaptive encoding selection in general for all columns.
+    /// Default disabled.
+    Builder* disable_adaptive_encoding() {
+      default_column_properties_.set_adaptive_encoding_enabled(false);
+      return this;
+    }
+
+    /// \brief Enable adaptive encoding selection for column specified by
+    /// `path`. Default disabled.
+    Builder* enable_adaptive_encoding(const std::string& path) {
+      adaptive_encoding_enabled_[path] = true;
+      return this;
+    }
+
+    /// \brief Enable adaptive encoding selection for column specified by
+    /// `path`. Default disabled.
+    Builder* enable_adaptive_encoding(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->enable_adaptive_encoding(path->ToDotString());
+    }
+
+    /// \brief Disable adaptive encoding selection for column specified by
+    /// `path`. Default disabled.
+    Builder* disable_adaptive_encoding(const std::string& path) {
+      adaptive_encoding_enabled_[path] = false;
+      return this;
+    }
+
+    /// \brief Disable adaptive encoding selection for column specified by
+    /// `path`. Default disabled.
+    Builder* disable_adaptive_encoding(const std::shared_ptr<schema::ColumnPath>& path) {
+      return this->disable_adaptive_encoding(path->ToDotString());
+    }
+
     /// \brief Set the level to write size statistics for all columns. Default is None.
     ///
     /// \param level The level to write size statistics. Note that if page index is not
@@ -673,6 +903,44 @@ class PARQUET_EXPORT WriterProperties {
       return this;
     }
 
+    /// \brief Enable content-defined chunking of data pages. Default disabled.
+    ///
+    /// When enabled, data page boundaries are additionally chosen by a rolling
+    /// hash over the raw value bytes, so the boundaries depend on value
+    /// content instead of accumulated encoded size alone. Inserting or
+    /// modifying a few rows then only changes the pages overlapping the edit
+    /// and subsequent page boundaries resynchronize, which makes the written
+    /// files deduplicate well in content-addressed storage.
+    ///
+    /// `data_pagesize()` still applies as an upper bound on page size.
+    /// Columns written through the dictionary encoding path keep the default
+    /// size-based boundaries, so this option is most effective with
+    /// dictionary encoding disabled.
+    Builder* enable_content_defined_chunking() {
+      content_defined_chunking_enabled_ = true;
+      return this;
+    }
+
+    /// \brief Disable content-defined chunking of data pages. Default
+    /// disabled.
+    Builder* disable_content_defined_chunking() {
+      content_defined_chunking_enabled_ = false;
+      return this;
+    }
+
+    /// \brief Set the chunk size bounds for content-defined chunking.
+    ///
+    /// Cut points closer than `min_chunk_size` bytes to the previous one are
+    /// suppressed and a cut is forced after `max_chunk_size` bytes; the
+    /// average chunk size falls roughly halfway between the bounds. Only
+    /// relevant when content-defined chunking is enabled.
+    Builder* content_defined_chunk_size_range(int64_t min_chunk_size,
+                                              int64_t max_chunk_size) {
+      cdc_min_chunk_size_ = min_chunk_size;
+      cdc_max_chunk_size_ = max_chunk_size;
+      return this;
+    }
+
     /// \brief Build the WriterProperties with the builder parameters.
     /// \return The WriterProperties defined by the builder.
     std::shared_ptr<WriterProperties> build() {
@@ -695,11 +963,19 @@ class PARQUET_EXPORT WriterProperties {
         get(item.first).set_statistics_enabled(item.second);
       for (const auto& item : page_index_enabled_)
         get(item.first).set_page_index_enabled(item.second);
+      for (const auto& item : adaptive_encoding_enabled_)
+        get(item.first).set_adaptive_encoding_enabled(item.second);
+      for (const auto& item : bloom_filter_enabled_)
+        get(item.first).set_bloom_filter_enabled(item.second);
 
       return std::shared_ptr<WriterProperties>(new WriterProperties(
           pool_, dictionary_pagesize_limit_, write_batch_size_, max_row_group_length_,
-          pagesize_, version_, created_by_, page_checksum_enabled_,
-          size_statistics_level_, std::move(file_encryption_properties_),
+          max_row_group_decoded_bytes_, row_group_row_alignment_,
+          column_chunk_alignment_, pagesize_, version_,
+          created_by_, page_checksum_enabled_,
+          size_statistics_level_, dictionary_fallback_split_enabled_,
+          content_defined_chunking_enabled_, cdc_min_chunk_size_, cdc_max_chunk_size_,
+          bloom_filter_fpp_, std::move(file_encryption_properties_),
           default_column_properties_, column_properties, data_page_version_,
           store_decimal_as_integer_, std::move(sorting_columns_)));
     }
@@ -709,6 +985,9 @@ class PARQUET_EXPORT WriterProperties {
     int64_t dictionary_pagesize_limit_;
     int64_t write_batch_size_;
     int64_t max_row_group_length_;
+    int64_t max_row_group_decoded_bytes_;
+    int64_t row_group_row_alignment_;
+    int64_t column_chunk_alignment_;
     int64_t pagesize_;
     ParquetVersion::type version_;
     ParquetDataPageVersion data_page_version_;
@@ -716,6 +995,11 @@ class PARQUET_EXPORT WriterProperties {
     bool store_decimal_as_integer_;
     bool page_checksum_enabled_;
     SizeStatisticsLevel size_statistics_level_;
+    bool dictionary_fallback_split_enabled_;
+    bool content_defined_chunking_enabled_;
+    int64_t cdc_min_chunk_size_;
+    int64_t cdc_max_chunk_size_;
+    double bloom_filter_fpp_;
 
     std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -730,6 +1014,8 @@ class PARQUET_EXPORT WriterProperties {
     std::unordered_map<std::string, bool> dictionary_enabled_;
     std::unordered_map<std::string, bool> statistics_enabled_;
     std::unordered_map<std::string, bool> page_index_enabled_;
+    std::unordered_map<std::string, bool> adaptive_encoding_enabled_;
+    std::unordered_map<std::string, bool> bloom_filter_enabled_;
   };
 
   inline MemoryPool* memory_pool() const { return pool_; }
@@ -740,6 +1026,14 @@ class PARQUET_EXPORT WriterProperties {
 
   inline int64_t max_row_group_length() const { return max_row_group_length_; }
 
+  inline int64_t max_row_group_decoded_bytes() const {
+    return max_row_group_decoded_bytes_;
+  }
+
+  inline int64_t row_group_row_alignment() const { return row_group_row_alignment_; }
+
+  inline int64_t column_chunk_alignment() const { return column_chunk_alignment_; }
+
   inline int64_t data_pagesize() const { return pagesize_; }
 
   inline ParquetDataPageVersion data_page_version() const {
@@ -758,6 +1052,18 @@ class PARQUET_EXPORT WriterProperties {
     return size_statistics_level_;
   }
 
+  inline bool dictionary_fallback_split_enabled() const {
+    return dictionary_fallback_split_enabled_;
+  }
+
+  inline bool content_defined_chunking_enabled() const {
+    return content_defined_chunking_enabled_;
+  }
+
+  inline int64_t cdc_min_chunk_size() const { return cdc_min_chunk_size_; }
+
+  inline int64_t cdc_max_chunk_size() const { return cdc_max_chunk_size_; }
+
   inline Encoding::type dictionary_index_encoding() const {
     if (parquet_version_ == ParquetVersion::PARQUET_1_0) {
       return Encoding::PLAIN_DICTIONARY;
@@ -816,6 +1122,10 @@ class PARQUET_EXPORT WriterProperties {
     return column_properties(path).page_index_enabled();
   }
 
+  bool adaptive_encoding_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).adaptive_encoding_enabled();
+  }
+
   bool page_index_enabled() const {
     if (default_column_properties_.page_index_enabled()) {
       return true;
@@ -828,6 +1138,24 @@ class PARQUET_EXPORT WriterProperties {
     return false;
   }
 
+  bool bloom_filter_enabled(const std::shared_ptr<schema::ColumnPath>& path) const {
+    return column_properties(path).bloom_filter_enabled();
+  }
+
+  bool bloom_filter_enabled() const {
+    if (default_column_properties_.bloom_filter_enabled()) {
+      return true;
+    }
+    for (const auto& item : column_properties_) {
+      if (item.second.bloom_filter_enabled()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  inline double bloom_filter_fpp() const { return bloom_filter_fpp_; }
+
   inline FileEncryptionProperties* file_encryption_properties() const {
     return file_encryption_properties_.get();
   }
@@ -849,9 +1177,13 @@ class PARQUET_EXPORT WriterProperties {
  private:
   explicit WriterProperties(
       MemoryPool* pool, int64_t dictionary_pagesize_limit, int64_t write_batch_size,
-      int64_t max_row_group_length, int64_t pagesize, ParquetVersion::type version,
+      int64_t max_row_group_length, int64_t max_row_group_decoded_bytes,
+      int64_t row_group_row_alignment, int64_t column_chunk_alignment, int64_t pagesize,
+      ParquetVersion::type version,
       const std::string& created_by, bool page_write_checksum_enabled,
-      SizeStatisticsLevel size_statistics_level,
+      SizeStatisticsLevel size_statistics_level, bool dictionary_fallback_split_enabled,
+      bool content_defined_chunking_enabled, int64_t cdc_min_chunk_size,
+      int64_t cdc_max_chunk_size, double bloom_filter_fpp,
       std::shared_ptr<FileEncryptionProperties> file_encryption_properties,
       const ColumnProperties& default_column_properties,
       const std::unordered_map<std::string, ColumnProperties>& column_properties,
@@ -861,6 +1193,9 @@ class PARQUET_EXPORT WriterProperties {
         dictionary_pagesize_limit_(dictionary_pagesize_limit),
         write_batch_size_(write_batch_size),
         max_row_group_length_(max_row_group_length),
+        max_row_group_decoded_bytes_(max_row_group_decoded_bytes),
+        row_group_row_alignment_(row_group_row_alignment),
+        column_chunk_alignment_(column_chunk_alignment),
         pagesize_(pagesize),
         parquet_data_page_version_(data_page_version),
         parquet_version_(version),
@@ -868,6 +1203,11 @@ class PARQUET_EXPORT WriterProperties {
         store_decimal_as_integer_(store_short_decimal_as_integer),
         page_checksum_enabled_(page_write_checksum_enabled),
         size_statistics_level_(size_statistics_level),
+        dictionary_fallback_split_enabled_(dictionary_fallback_split_enabled),
+        content_defined_chunking_enabled_(content_defined_chunking_enabled),
+        cdc_min_chunk_size_(cdc_min_chunk_size),
+        cdc_max_chunk_size_(cdc_max_chunk_size),
+        bloom_filter_fpp_(bloom_filter_fpp),
         file_encryption_properties_(file_encryption_properties),
         sorting_columns_(std::move(sorting_columns)),
         default_column_properties_(default_column_properties),
@@ -877,6 +1217,9 @@ class PARQUET_EXPORT WriterProperties {
   int64_t dictionary_pagesize_limit_;
   int64_t write_batch_size_;
   int64_t max_row_group_length_;
+  int64_t max_row_group_decoded_bytes_;
+  int64_t row_group_row_alignment_;
+  int64_t column_chunk_alignment_;
   int64_t pagesize_;
   ParquetDataPageVersion parquet_data_page_version_;
   ParquetVersion::type parquet_version_;
@@ -884,6 +1227,11 @@ class PARQUET_EXPORT WriterProperties {
   bool store_decimal_as_integer_;
   bool page_checksum_enabled_;
   SizeStatisticsLevel size_statistics_level_;
+  bool dictionary_fallback_split_enabled_;
+  bool content_defined_chunking_enabled_;
+  int64_t cdc_min_chunk_size_;
+  int64_t cdc_max_chunk_size_;
+  double bloom_filter_fpp_;
 
   std::shared_ptr<FileEncryptionProperties> file_encryption_properties_;
 
@@ -1006,6 +1354,20 @@ class PARQUET_EXPORT ArrowReaderProperties {
   /// Return whether loading statistics as much as possible.
   bool should_load_statistics() const { return should_load_statistics_; }
 
+  /// \brief EXPERIMENTAL: Set whether to read eligible columns without copying
+  /// their values (default false).
+  ///
+  /// When enabled, flat required columns of fixed-width physical type whose
+  /// pages are PLAIN-encoded, uncompressed and unencrypted are returned as
+  /// slices of the page buffers instead of being copied into fresh
+  /// allocations. This avoids double-buffering when the file source is a
+  /// memory-mapped file or an in-memory buffer. The resulting arrays keep the
+  /// underlying pages (and thus the mapped region or buffer) alive for their
+  /// own lifetime.
+  void set_zero_copy_reads(bool zero_copy_reads) { zero_copy_reads_ = zero_copy_reads; }
+  /// Return whether zero-copy reads are enabled.
+  bool zero_copy_reads() const { return zero_copy_reads_; }
+
  private:
   bool use_threads_;
   std::unordered_set<int> read_dict_indices_;
@@ -1016,6 +1378,7 @@ class PARQUET_EXPORT ArrowReaderProperties {
   ::arrow::TimeUnit::type coerce_int96_timestamp_unit_;
   bool arrow_extensions_enabled_;
   bool should_load_statistics_;
+  bool zero_copy_reads_ = false;
 };
 
 /// EXPERIMENTAL: Constructs the default ArrowReaderProperties
@@ -1113,7 +1476,12 @@ class PARQUET_EXPORT ArrowWriterProperties {
     }
 
     /// \brief Set whether to use multiple threads to write columns
-    /// in parallel in the buffered row group mode.
+    /// in parallel.
+    ///
+    /// This applies to FileWriter::WriteRecordBatch as well as
+    /// FileWriter::WriteTable, which switches to buffered row groups
+    /// so that each column can encode and compress its pages
+    /// independently before the chunks are serialized in order.
     ///
     /// WARNING: If writing multiple files in parallel in the same
     /// executor, deadlock may occur if use_threads is true. Please
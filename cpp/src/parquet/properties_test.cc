@@ -80,6 +80,20 @@ TEST(TestWriterProperties, AdvancedHandling) {
   ASSERT_EQ(ParquetDataPageVersion::V2, props->data_page_version());
 }
 
+TEST(TestWriterProperties, AdaptiveEncoding) {
+  std::shared_ptr<WriterProperties> default_props = WriterProperties::Builder().build();
+  ASSERT_FALSE(
+      default_props->adaptive_encoding_enabled(ColumnPath::FromDotString("any")));
+
+  WriterProperties::Builder builder;
+  builder.enable_adaptive_encoding();
+  builder.disable_adaptive_encoding("plain");
+  std::shared_ptr<WriterProperties> props = builder.build();
+
+  ASSERT_TRUE(props->adaptive_encoding_enabled(ColumnPath::FromDotString("any")));
+  ASSERT_FALSE(props->adaptive_encoding_enabled(ColumnPath::FromDotString("plain")));
+}
+
 TEST(TestWriterProperties, SetCodecOptions) {
   WriterProperties::Builder builder;
   builder.compression("gzip", Compression::GZIP);